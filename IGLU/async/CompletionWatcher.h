@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#if !defined(__cpp_impl_coroutine)
+#error "IGLU/async is a C++20 module; compile the consuming target with -std=c++20 or newer"
+#endif
+
+#include <coroutine>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <igl/Texture.h>
+
+namespace iglu::async {
+
+/// Decides where a coroutine resumed by CompletionWatcher continues executing. The watcher calls
+/// the executor with the handle of every coroutine whose completion token signaled; the executor
+/// may resume it inline, post it to a thread pool, or queue it for a later point in the frame. An
+/// empty executor resumes inline on the thread pumping processCompletions().
+using Executor = std::function<void(std::coroutine_handle<> handle)>;
+
+/// Polls IGL completion tokens on behalf of suspended coroutines and resumes them once their
+/// token signals. IGL's completion primitives (e.g. ITextureUploadToken) are poll-based, so a
+/// co_await-based pipeline would otherwise need a dedicated polling thread; instead the
+/// application pumps processCompletions() once per frame from a thread of its choosing -
+/// typically next to its other per-frame IGL work - which keeps continuations on a deterministic
+/// thread and adds no cross-thread latency:
+///
+///   iglu::async::Task streamTexture(iglu::async::CompletionWatcher& watcher,
+///                                   std::shared_ptr<igl::ITexture> texture, ...) {
+///     co_await watcher.until(texture->uploadAsync(uploads, count)); // upload
+///     co_await watcher.until(generateMipmapsAsync(texture));        // mip-generate
+///     notifyReady(texture);                                         // notify
+///   }
+///
+/// The watcher must outlive every coroutine suspended on it. Awaitables and processCompletions()
+/// may be used from different threads; resumption happens outside the internal lock, so a resumed
+/// coroutine can immediately co_await the same watcher again.
+class CompletionWatcher final {
+ public:
+  explicit CompletionWatcher(Executor executor = {}) : executor_(std::move(executor)) {}
+
+  CompletionWatcher(const CompletionWatcher&) = delete;
+  CompletionWatcher& operator=(const CompletionWatcher&) = delete;
+
+  /// Returns an awaitable that suspends the calling coroutine until `isCompleted` returns true.
+  /// The predicate is polled from processCompletions() and must not block; it is the extension
+  /// point for backend-specific tokens (fences, SubmitHandles, GLsync) that expose a
+  /// non-blocking query
+  [[nodiscard]] auto until(std::function<bool()> isCompleted) {
+    struct Awaitable {
+      CompletionWatcher& watcher;
+      std::function<bool()> isCompleted;
+
+      [[nodiscard]] bool await_ready() const {
+        return isCompleted();
+      }
+      void await_suspend(std::coroutine_handle<> handle) {
+        watcher.watch(std::move(isCompleted), handle);
+      }
+      void await_resume() const noexcept {}
+    };
+    return Awaitable{*this, std::move(isCompleted)};
+  }
+
+  /// Returns an awaitable over a batched texture upload (see ITexture::uploadAsync()). Resumes
+  /// once the uploaded data is visible to the GPU
+  [[nodiscard]] auto until(std::shared_ptr<igl::ITextureUploadToken> token) {
+    return until([token = std::move(token)]() { return token->isCompleted(); });
+  }
+
+  /// Polls the tokens of all suspended coroutines and hands those that completed to the executor.
+  /// Call once per frame from the thread that should run the continuations. Returns the number of
+  /// coroutines resumed
+  size_t processCompletions() {
+    std::vector<Waiter> ready;
+    {
+      const std::lock_guard<std::mutex> lock(mutex_);
+      for (size_t i = 0; i < waiters_.size();) {
+        if (waiters_[i].isCompleted()) {
+          ready.push_back(std::move(waiters_[i]));
+          waiters_.erase(waiters_.begin() + static_cast<ptrdiff_t>(i));
+        } else {
+          ++i;
+        }
+      }
+    }
+    for (Waiter& waiter : ready) {
+      if (executor_) {
+        executor_(waiter.handle);
+      } else {
+        waiter.handle.resume();
+      }
+    }
+    return ready.size();
+  }
+
+  /// Returns the number of coroutines currently suspended on this watcher
+  [[nodiscard]] size_t pendingCount() const {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    return waiters_.size();
+  }
+
+ private:
+  struct Waiter {
+    std::function<bool()> isCompleted;
+    std::coroutine_handle<> handle;
+  };
+
+  void watch(std::function<bool()> isCompleted, std::coroutine_handle<> handle) {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    waiters_.push_back({std::move(isCompleted), handle});
+  }
+
+  Executor executor_;
+  mutable std::mutex mutex_;
+  /// Suspended coroutines in the order they suspended; completions resume in that order too
+  std::vector<Waiter> waiters_;
+};
+
+} // namespace iglu::async
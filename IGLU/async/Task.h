@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#if !defined(__cpp_impl_coroutine)
+#error "IGLU/async is a C++20 module; compile the consuming target with -std=c++20 or newer"
+#endif
+
+#include <coroutine>
+#include <exception>
+
+namespace iglu::async {
+
+/// Minimal fire-and-forget coroutine type for asset-streaming pipelines. A Task starts eagerly,
+/// runs until its first co_await (typically a CompletionWatcher awaitable) and destroys itself
+/// when it runs off the end, so callers can launch a pipeline step and drop the returned object:
+///
+///   iglu::async::Task streamTexture(iglu::async::CompletionWatcher& watcher, ...) {
+///     co_await watcher.until(texture->uploadAsync(uploads, count));
+///     generateMipmaps(...);
+///   }
+///
+/// Codebases with their own task types can ignore this one; the CompletionWatcher awaitables work
+/// with any coroutine.
+class Task {
+ public:
+  struct promise_type {
+    Task get_return_object() noexcept {
+      return {};
+    }
+    std::suspend_never initial_suspend() noexcept {
+      return {};
+    }
+    std::suspend_never final_suspend() noexcept {
+      return {};
+    }
+    void return_void() noexcept {}
+    void unhandled_exception() noexcept {
+      // IGL reports failures through igl::Result; an exception escaping a pipeline coroutine has
+      // no one left to observe it
+      std::terminate();
+    }
+  };
+};
+
+} // namespace iglu::async
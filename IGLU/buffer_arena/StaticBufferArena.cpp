@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#if defined(IGL_UWP_VS_FIX)
+#include <igl/IGLU/buffer_arena/StaticBufferArena.h>
+#else
+#include <IGLU/buffer_arena/StaticBufferArena.h>
+#endif
+
+#include <algorithm>
+
+namespace iglu {
+namespace {
+
+size_t alignTo(size_t value, size_t alignment) {
+  return (value + alignment - 1) & ~(alignment - 1);
+}
+
+} // namespace
+
+StaticBufferArena::StaticBufferArena(igl::IDevice& device,
+                                     igl::BufferDesc::BufferType bufferType,
+                                     size_t pageSize,
+                                     const char* debugName) :
+  device_(device), bufferType_(bufferType), pageSize_(pageSize), debugName_(debugName) {}
+
+StaticBufferArena::Allocation StaticBufferArena::upload(const void* data,
+                                                        size_t length,
+                                                        igl::Result* outResult,
+                                                        size_t alignment) {
+  if (!IGL_VERIFY(data != nullptr && length > 0 && alignment > 0 &&
+                  (alignment & (alignment - 1)) == 0)) {
+    igl::Result::setResult(outResult, igl::Result::Code::ArgumentInvalid);
+    return {};
+  }
+
+  // first page with enough space left wins; static uploads happen in large batches at load time,
+  // so the walk stays short and the waste at page tails is bounded by the largest alignment
+  Page* page = nullptr;
+  size_t offset = 0;
+  for (auto& candidate : pages_) {
+    offset = alignTo(candidate.head, alignment);
+    if (offset + length <= candidate.capacity) {
+      page = &candidate;
+      break;
+    }
+  }
+
+  if (page == nullptr) {
+    // oversized uploads get a dedicated buffer of exactly their size
+    const size_t capacity = std::max(pageSize_, length);
+    igl::Result result;
+    const igl::BufferDesc desc(bufferType_,
+                               nullptr,
+                               capacity,
+                               igl::ResourceStorage::Private,
+                               0,
+                               debugName_);
+    auto buffer = device_.createBuffer(desc, &result);
+    if (!buffer) {
+      igl::Result::setResult(outResult, std::move(result));
+      return {};
+    }
+    pages_.push_back({std::move(buffer), 0, capacity});
+    page = &pages_.back();
+    offset = 0;
+  }
+
+  const igl::Result uploadResult = page->buffer->upload(data, igl::BufferRange(length, offset));
+  if (!uploadResult.isOk()) {
+    igl::Result::setResult(outResult, uploadResult);
+    return {};
+  }
+
+  page->head = offset + length;
+  igl::Result::setResult(outResult, igl::Result::Code::Ok);
+  return {page->buffer, offset, length};
+}
+
+} // namespace iglu
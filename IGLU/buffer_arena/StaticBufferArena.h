@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <igl/IGL.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace iglu {
+
+// Packs static vertex/index data from many meshes into a few large shared device buffers.
+// Each upload() bump-allocates a block from a shared page and returns the page buffer plus the
+// block's offset, so consecutive draws from different meshes keep the same vertex/index buffer
+// bound (only the offsets change) and multi-draw-indirect can address several meshes through one
+// binding.
+//
+// The arena is append-only: individual blocks are never freed. Keep one arena per scene/level and
+// destroy the whole arena when its meshes are unloaded.
+class StaticBufferArena {
+ public:
+  struct Allocation {
+    std::shared_ptr<igl::IBuffer> buffer;
+    size_t offset = 0;
+    size_t size = 0;
+
+    [[nodiscard]] bool valid() const {
+      return buffer != nullptr;
+    }
+  };
+
+  // `bufferType` is a mask of igl::BufferDesc::BufferTypeBits (typically Vertex or Index; use
+  // separate arenas per type). `pageSize` is the capacity of each shared buffer; uploads larger
+  // than a page get a dedicated buffer of exactly their size.
+  StaticBufferArena(igl::IDevice& device,
+                    igl::BufferDesc::BufferType bufferType,
+                    size_t pageSize = 16u * 1024u * 1024u,
+                    const char* debugName = "StaticBufferArena");
+
+  StaticBufferArena(const StaticBufferArena&) = delete;
+  StaticBufferArena& operator=(const StaticBufferArena&) = delete;
+
+  // Copies `length` bytes into the arena and returns the shared buffer plus the block's offset.
+  // `alignment` must be a power of two; index data should pass its index size so offsets stay
+  // valid for indexed draws. Returns an invalid Allocation on failure.
+  Allocation upload(const void* data,
+                    size_t length,
+                    igl::Result* outResult = nullptr,
+                    size_t alignment = 4);
+
+  // Number of page buffers created so far (dedicated oversized buffers included)
+  [[nodiscard]] size_t getNumPages() const {
+    return pages_.size();
+  }
+
+ private:
+  struct Page {
+    std::shared_ptr<igl::IBuffer> buffer;
+    size_t head = 0;
+    size_t capacity = 0;
+  };
+
+  igl::IDevice& device_;
+  igl::BufferDesc::BufferType bufferType_;
+  size_t pageSize_;
+  std::string debugName_;
+  std::vector<Page> pages_;
+};
+
+} // namespace iglu
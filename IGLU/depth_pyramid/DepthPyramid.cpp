@@ -0,0 +1,405 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "DepthPyramid.h"
+
+#include <algorithm>
+#include <igl/ShaderCreator.h>
+#include <vector>
+
+namespace iglu::depth_pyramid {
+namespace {
+
+// The passes carry all per-level state in the vertex data: each pass draws one fullscreen
+// triangle whose vertices store {clip x, clip y, source lod}. The lod is constant across the
+// triangle, so plain interpolation delivers it exactly and the shaders need no uniforms — that
+// sidesteps per-backend uniform plumbing entirely.
+
+const char* reduceFnName(ReduceOp op, igl::BackendType backendType) {
+  if (op == ReduceOp::Min) {
+    return backendType == igl::BackendType::Metal ? "fmin" : "min";
+  }
+  return backendType == igl::BackendType::Metal ? "fmax" : "max";
+}
+
+std::string getGlslVersionHeader(igl::ShaderVersion shaderVersion) {
+  if (shaderVersion.family == igl::ShaderFamily::GlslEs) {
+    return "#version 300 es\nprecision highp float;\n";
+  }
+  // textureLod()/textureSize() in fragment shaders need GLSL 1.30+
+  return "#version 130\n";
+}
+
+std::string getOpenGLVertexShaderSource(igl::ShaderVersion shaderVersion) {
+  return getGlslVersionHeader(shaderVersion) + R"(
+in vec3 aPositionLod;
+out vec2 vUV;
+out float vLod;
+void main() {
+  vUV = aPositionLod.xy * 0.5 + 0.5;
+  vLod = aPositionLod.z;
+  gl_Position = vec4(aPositionLod.xy, 0.0, 1.0);
+})";
+}
+
+std::string getOpenGLCopyFragmentShaderSource(igl::ShaderVersion shaderVersion) {
+  return getGlslVersionHeader(shaderVersion) + R"(
+uniform sampler2D uSource;
+in vec2 vUV;
+in float vLod;
+out vec4 oLevel;
+void main() {
+  oLevel = vec4(textureLod(uSource, vUV, vLod).r, 0.0, 0.0, 1.0);
+})";
+}
+
+std::string getOpenGLReduceFragmentShaderSource(igl::ShaderVersion shaderVersion, ReduceOp op) {
+  const std::string reduce = reduceFnName(op, igl::BackendType::OpenGL);
+  return getGlslVersionHeader(shaderVersion) + R"(
+uniform sampler2D uSource;
+in vec2 vUV;
+in float vLod;
+out vec4 oLevel;
+void main() {
+  int lod = int(vLod + 0.5);
+  vec2 halfTexel = 0.5 / vec2(textureSize(uSource, lod));
+  float d00 = textureLod(uSource, vUV + vec2(-halfTexel.x, -halfTexel.y), vLod).r;
+  float d10 = textureLod(uSource, vUV + vec2( halfTexel.x, -halfTexel.y), vLod).r;
+  float d01 = textureLod(uSource, vUV + vec2(-halfTexel.x,  halfTexel.y), vLod).r;
+  float d11 = textureLod(uSource, vUV + vec2( halfTexel.x,  halfTexel.y), vLod).r;
+  oLevel = vec4()" +
+         reduce + "(" + reduce + "(d00, d10), " + reduce + R"((d01, d11)), 0.0, 0.0, 1.0);
+})";
+}
+
+const char* getVulkanVertexShaderSource() {
+  return R"(
+layout(location = 0) in vec3 aPositionLod;
+
+layout(location = 0) out vec2 vUV;
+layout(location = 1) out float vLod;
+
+out gl_PerVertex { vec4 gl_Position; };
+
+void main() {
+  vUV = aPositionLod.xy * 0.5 + 0.5;
+  vLod = aPositionLod.z;
+  gl_Position = vec4(aPositionLod.xy, 0.0, 1.0);
+})";
+}
+
+const char* getVulkanCopyFragmentShaderSource() {
+  return R"(
+layout(location = 0) in vec2 vUV;
+layout(location = 1) in float vLod;
+layout(location = 0) out vec4 oLevel;
+
+layout(set = 0, binding = 0) uniform sampler2D uSource;
+
+void main() {
+  oLevel = vec4(textureLod(uSource, vUV, vLod).r, 0.0, 0.0, 1.0);
+})";
+}
+
+std::string getVulkanReduceFragmentShaderSource(ReduceOp op) {
+  const std::string reduce = reduceFnName(op, igl::BackendType::Vulkan);
+  return R"(
+layout(location = 0) in vec2 vUV;
+layout(location = 1) in float vLod;
+layout(location = 0) out vec4 oLevel;
+
+layout(set = 0, binding = 0) uniform sampler2D uSource;
+
+void main() {
+  int lod = int(vLod + 0.5);
+  vec2 halfTexel = 0.5 / vec2(textureSize(uSource, lod));
+  float d00 = textureLod(uSource, vUV + vec2(-halfTexel.x, -halfTexel.y), vLod).r;
+  float d10 = textureLod(uSource, vUV + vec2( halfTexel.x, -halfTexel.y), vLod).r;
+  float d01 = textureLod(uSource, vUV + vec2(-halfTexel.x,  halfTexel.y), vLod).r;
+  float d11 = textureLod(uSource, vUV + vec2( halfTexel.x,  halfTexel.y), vLod).r;
+  oLevel = vec4()" +
+         reduce + "(" + reduce + "(d00, d10), " + reduce + R"((d01, d11)), 0.0, 0.0, 1.0);
+})";
+}
+
+std::string getMetalShaderSource(ReduceOp op) {
+  const std::string reduce = reduceFnName(op, igl::BackendType::Metal);
+  return R"(
+using namespace metal;
+
+struct VertexIn {
+  float3 positionLod [[attribute(0)]];
+};
+
+struct VertexOut {
+  float4 position [[position]];
+  float2 uv;
+  float lod;
+};
+
+vertex VertexOut vertex_main(VertexIn in [[stage_in]]) {
+  VertexOut out;
+  out.uv = in.positionLod.xy * 0.5 + 0.5;
+  out.lod = in.positionLod.z;
+  out.position = float4(in.positionLod.xy, 0.0, 1.0);
+  return out;
+}
+
+constexpr sampler kNearestSampler(coord::normalized, filter::nearest, mip_filter::nearest);
+
+fragment float4 fragment_copy(VertexOut in [[stage_in]],
+                              texture2d<float> uSource [[texture(0)]]) {
+  return float4(uSource.sample(kNearestSampler, in.uv, level(in.lod)).r, 0.0, 0.0, 1.0);
+}
+
+fragment float4 fragment_reduce(VertexOut in [[stage_in]],
+                                texture2d<float> uSource [[texture(0)]]) {
+  uint lod = uint(in.lod + 0.5);
+  float2 halfTexel = 0.5 / float2(uSource.get_width(lod), uSource.get_height(lod));
+  float d00 = uSource.sample(kNearestSampler, in.uv + float2(-halfTexel.x, -halfTexel.y), level(in.lod)).r;
+  float d10 = uSource.sample(kNearestSampler, in.uv + float2( halfTexel.x, -halfTexel.y), level(in.lod)).r;
+  float d01 = uSource.sample(kNearestSampler, in.uv + float2(-halfTexel.x,  halfTexel.y), level(in.lod)).r;
+  float d11 = uSource.sample(kNearestSampler, in.uv + float2( halfTexel.x,  halfTexel.y), level(in.lod)).r;
+  return float4()" +
+         reduce + "(" + reduce + "(d00, d10), " + reduce + R"((d01, d11)), 0.0, 0.0, 1.0);
+})";
+}
+
+std::unique_ptr<igl::IShaderStages> createStages(igl::IDevice& device,
+                                                 bool copyPass,
+                                                 ReduceOp op,
+                                                 igl::Result* outResult) {
+  switch (device.getBackendType()) {
+  case igl::BackendType::Vulkan: {
+    const std::string fragment = copyPass ? getVulkanCopyFragmentShaderSource()
+                                          : getVulkanReduceFragmentShaderSource(op);
+    return igl::ShaderStagesCreator::fromModuleStringInput(
+        device,
+        getVulkanVertexShaderSource(),
+        "main",
+        "Shader Module: DepthPyramid::vertex",
+        fragment.c_str(),
+        "main",
+        copyPass ? "Shader Module: DepthPyramid::copy" : "Shader Module: DepthPyramid::reduce",
+        outResult);
+  }
+  case igl::BackendType::Metal: {
+    const std::string library = getMetalShaderSource(op);
+    return igl::ShaderStagesCreator::fromLibraryStringInput(
+        device,
+        library.c_str(),
+        "vertex_main",
+        copyPass ? "fragment_copy" : "fragment_reduce",
+        "Shader Library: DepthPyramid",
+        outResult);
+  }
+  case igl::BackendType::OpenGL: {
+    const auto shaderVersion = device.getShaderVersion();
+    const std::string vertex = getOpenGLVertexShaderSource(shaderVersion);
+    const std::string fragment = copyPass
+                                     ? getOpenGLCopyFragmentShaderSource(shaderVersion)
+                                     : getOpenGLReduceFragmentShaderSource(shaderVersion, op);
+    return igl::ShaderStagesCreator::fromModuleStringInput(
+        device, vertex.c_str(), "main", "", fragment.c_str(), "main", "", outResult);
+  }
+  default:
+    igl::Result::setResult(outResult, igl::Result::Code::Unsupported, "Unsupported backend");
+    return nullptr;
+  }
+}
+
+} // namespace
+
+std::unique_ptr<DepthPyramid> DepthPyramid::create(igl::IDevice& device,
+                                                   size_t width,
+                                                   size_t height,
+                                                   ReduceOp reduceOp,
+                                                   igl::Result* IGL_NULLABLE outResult) {
+  std::unique_ptr<DepthPyramid> pyramid(new DepthPyramid());
+  const igl::Result result = pyramid->initialize(device, width, height, reduceOp);
+  igl::Result::setResult(outResult, result);
+  return result.isOk() ? std::move(pyramid) : nullptr;
+}
+
+igl::Result DepthPyramid::initialize(igl::IDevice& device,
+                                     size_t width,
+                                     size_t height,
+                                     ReduceOp reduceOp) {
+  if (width == 0 || height == 0) {
+    return igl::Result(igl::Result::Code::ArgumentInvalid, "Pyramid dimensions must be non-zero");
+  }
+
+  const auto formatCaps = device.getTextureFormatCapabilities(igl::TextureFormat::R_F32);
+  if (!igl::contains(formatCaps, igl::ICapabilities::TextureFormatCapabilityBits::Sampled) ||
+      !igl::contains(formatCaps, igl::ICapabilities::TextureFormatCapabilityBits::Attachment)) {
+    return igl::Result(igl::Result::Code::Unsupported,
+                       "R_F32 must be sampleable and attachable for depth pyramids");
+  }
+  if (device.getBackendType() == igl::BackendType::OpenGL) {
+    const auto shaderVersion = device.getShaderVersion();
+    const bool hasTextureLod = shaderVersion.family == igl::ShaderFamily::GlslEs
+                                   ? shaderVersion.majorVersion >= 3
+                                   : (shaderVersion.majorVersion > 1 ||
+                                      shaderVersion.minorVersion >= 30);
+    if (!hasTextureLod) {
+      return igl::Result(igl::Result::Code::Unsupported,
+                         "Depth pyramids need GLSL 1.30 / GLSL ES 3.00");
+    }
+  }
+
+  width_ = width;
+  height_ = height;
+  numMipLevels_ = igl::TextureDesc::calcNumMipLevels(width, height);
+
+  igl::Result result;
+
+  auto pyramidDesc = igl::TextureDesc::new2D(igl::TextureFormat::R_F32,
+                                             width,
+                                             height,
+                                             igl::TextureDesc::TextureUsageBits::Sampled |
+                                                 igl::TextureDesc::TextureUsageBits::Attachment,
+                                             "DepthPyramid::pyramid");
+  pyramidDesc.numMipLevels = numMipLevels_;
+  pyramid_ = device.createTexture(pyramidDesc, &result);
+  if (!result.isOk()) {
+    return result;
+  }
+
+  auto scratchDesc = igl::TextureDesc::new2D(igl::TextureFormat::R_F32,
+                                             width,
+                                             height,
+                                             igl::TextureDesc::TextureUsageBits::Sampled |
+                                                 igl::TextureDesc::TextureUsageBits::Attachment,
+                                             "DepthPyramid::scratch");
+  scratchDesc.numMipLevels = numMipLevels_;
+  scratch_ = device.createTexture(scratchDesc, &result);
+  if (!result.isOk()) {
+    return result;
+  }
+
+  igl::FramebufferDesc framebufferDesc;
+  framebufferDesc.colorAttachments[0].texture = scratch_;
+  framebuffer_ = device.createFramebuffer(framebufferDesc, &result);
+  if (!result.isOk()) {
+    return result;
+  }
+
+  igl::SamplerStateDesc samplerDesc;
+  samplerDesc.minFilter = igl::SamplerMinMagFilter::Nearest;
+  samplerDesc.magFilter = igl::SamplerMinMagFilter::Nearest;
+  samplerDesc.mipFilter = igl::SamplerMipFilter::Nearest;
+  samplerDesc.addressModeU = igl::SamplerAddressMode::Clamp;
+  samplerDesc.addressModeV = igl::SamplerAddressMode::Clamp;
+  sampler_ = device.createSamplerState(samplerDesc, &result);
+  if (!result.isOk()) {
+    return result;
+  }
+
+  // One fullscreen triangle per pass, {x, y, source lod} per vertex. The copy pass (level 0)
+  // samples the depth texture at lod 0; reduce pass i samples pyramid level i - 1.
+  std::vector<float> vertices;
+  vertices.reserve(static_cast<size_t>(numMipLevels_) * 9);
+  for (uint32_t level = 0; level < numMipLevels_; ++level) {
+    const float lod = level == 0 ? 0.0f : static_cast<float>(level - 1);
+    const float triangle[9] = {-1.0f, -1.0f, lod, 3.0f, -1.0f, lod, -1.0f, 3.0f, lod};
+    vertices.insert(vertices.end(), triangle, triangle + 9);
+  }
+  const igl::BufferDesc vertexBufferDesc(igl::BufferDesc::BufferTypeBits::Vertex,
+                                         vertices.data(),
+                                         vertices.size() * sizeof(float));
+  vertexBuffer_ = device.createBuffer(vertexBufferDesc, &result);
+  if (!result.isOk()) {
+    return result;
+  }
+
+  igl::VertexInputStateDesc inputDesc;
+  inputDesc.numAttributes = 1;
+  inputDesc.attributes[0] =
+      igl::VertexAttribute(0, igl::VertexAttributeFormat::Float3, 0, "aPositionLod", 0);
+  inputDesc.numInputBindings = 1;
+  inputDesc.inputBindings[0].stride = 3 * sizeof(float);
+  auto vertexInputState = device.createVertexInputState(inputDesc, &result);
+  if (!result.isOk()) {
+    return result;
+  }
+
+  for (const bool copyPass : {true, false}) {
+    auto stages = createStages(device, copyPass, reduceOp, &result);
+    if (!result.isOk()) {
+      return result;
+    }
+
+    igl::RenderPipelineDesc pipelineDesc;
+    pipelineDesc.vertexInputState = vertexInputState;
+    pipelineDesc.shaderStages = std::move(stages);
+    pipelineDesc.targetDesc.colorAttachments.resize(1);
+    pipelineDesc.targetDesc.colorAttachments[0].textureFormat = igl::TextureFormat::R_F32;
+    pipelineDesc.cullMode = igl::CullMode::Disabled;
+    pipelineDesc.fragmentUnitSamplerMap[0] = IGL_NAMEHANDLE("uSource");
+    auto pipeline = device.createRenderPipeline(pipelineDesc, &result);
+    if (!result.isOk()) {
+      return result;
+    }
+    (copyPass ? copyPipeline_ : reducePipeline_) = std::move(pipeline);
+  }
+
+  return igl::Result();
+}
+
+void DepthPyramid::generate(igl::IDevice& device,
+                            igl::ICommandQueue& commandQueue,
+                            const std::shared_ptr<igl::ITexture>& depthTexture) {
+  if (!IGL_VERIFY(depthTexture && pyramid_)) {
+    return;
+  }
+
+  // Level 0 copies the depth attachment; each further level reduces the one above it. The pass
+  // renders into scratch_ and the result is copied into pyramid_, so the sampled texture is
+  // never simultaneously a render target (see the class comment).
+  encodeLevel(device, commandQueue, depthTexture, 0);
+  for (uint32_t level = 1; level < numMipLevels_; ++level) {
+    encodeLevel(device, commandQueue, pyramid_, level);
+  }
+}
+
+void DepthPyramid::encodeLevel(igl::IDevice& device,
+                               igl::ICommandQueue& commandQueue,
+                               const std::shared_ptr<igl::ITexture>& source,
+                               uint32_t mipLevel) {
+  const auto levelWidth = std::max<size_t>(width_ >> mipLevel, 1);
+  const auto levelHeight = std::max<size_t>(height_ >> mipLevel, 1);
+
+  igl::RenderPassDesc renderPass;
+  renderPass.colorAttachments.resize(1);
+  renderPass.colorAttachments[0].loadAction = igl::LoadAction::DontCare;
+  renderPass.colorAttachments[0].storeAction = igl::StoreAction::Store;
+  renderPass.colorAttachments[0].mipLevel = static_cast<uint8_t>(mipLevel);
+
+  auto commandBuffer = commandQueue.createCommandBuffer({}, nullptr);
+  if (!IGL_VERIFY(commandBuffer)) {
+    return;
+  }
+  auto encoder = commandBuffer->createRenderCommandEncoder(renderPass, framebuffer_);
+  if (!IGL_VERIFY(encoder)) {
+    return;
+  }
+
+  encoder->bindViewport(igl::Viewport{
+      0.0f, 0.0f, static_cast<float>(levelWidth), static_cast<float>(levelHeight), 0.0f, 1.0f});
+  encoder->bindRenderPipelineState(mipLevel == 0 ? copyPipeline_ : reducePipeline_);
+  encoder->bindTexture(0, igl::BindTarget::kFragment, source.get());
+  encoder->bindSamplerState(0, igl::BindTarget::kFragment, sampler_.get());
+  encoder->bindVertexBuffer(0, vertexBuffer_, static_cast<size_t>(mipLevel) * 9 * sizeof(float));
+  encoder->draw(igl::PrimitiveType::Triangle, 0, 3);
+  encoder->endEncoding();
+  commandQueue.submit(*commandBuffer);
+
+  framebuffer_->copyTextureColorAttachment(
+      commandQueue, 0, pyramid_, igl::TextureRangeDesc::new2D(0, 0, levelWidth, levelHeight, mipLevel));
+}
+
+} // namespace iglu::depth_pyramid
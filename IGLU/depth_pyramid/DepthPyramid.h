@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <igl/IGL.h>
+#include <memory>
+
+namespace iglu::depth_pyramid {
+
+// Which reduction each pyramid level applies over the 2x2 footprint below it. Min is the usual
+// choice for Hi-Z occlusion culling with a standard depth test; Max suits reverse-Z.
+enum class ReduceOp : uint8_t { Min, Max };
+
+// Builds a full min/max depth mip pyramid (Hi-Z) from a depth attachment, as needed by GPU
+// occlusion culling and screen-space reflections.
+//
+// Each level is produced by a fullscreen reduction pass into a scratch render target and then
+// copied into the pyramid texture, so no pass ever samples the texture it renders into — that
+// keeps the Vulkan backend's whole-image layout transitions and GL's framebuffer completeness
+// rules happy without per-mip texture views, which IGL does not expose. The pyramid itself is a
+// plain sampled R_F32 texture consumers read with textureLod().
+//
+// Requires an R_F32 sampled render target and GLSL 1.30 / GLSL ES 3.00 on OpenGL; create()
+// reports Unsupported otherwise. When a source dimension is odd, the last row/column is not
+// folded into the next level (the standard Hi-Z caveat); conservative consumers should treat
+// pyramid bounds accordingly.
+class DepthPyramid final {
+ public:
+  // Creates a pyramid for depth attachments of the given size. The pyramid has
+  // TextureDesc::calcNumMipLevels(width, height) levels; level 0 matches the source size.
+  static std::unique_ptr<DepthPyramid> create(igl::IDevice& device,
+                                              size_t width,
+                                              size_t height,
+                                              ReduceOp reduceOp,
+                                              igl::Result* IGL_NULLABLE outResult = nullptr);
+
+  // Rebuilds every pyramid level from depthTexture, submitting its own command buffers on
+  // commandQueue. depthTexture must be sampleable and match the size passed to create().
+  void generate(igl::IDevice& device,
+                igl::ICommandQueue& commandQueue,
+                const std::shared_ptr<igl::ITexture>& depthTexture);
+
+  // The pyramid texture; valid after the first generate() call
+  [[nodiscard]] const std::shared_ptr<igl::ITexture>& texture() const noexcept {
+    return pyramid_;
+  }
+
+  [[nodiscard]] uint32_t numMipLevels() const noexcept {
+    return numMipLevels_;
+  }
+
+ private:
+  DepthPyramid() = default;
+  igl::Result initialize(igl::IDevice& device, size_t width, size_t height, ReduceOp reduceOp);
+
+  // One reduction (or copy, for level 0) pass rendering scratch_ mip `mipLevel` while sampling
+  // `source`, followed by a copy into pyramid_ mip `mipLevel`
+  void encodeLevel(igl::IDevice& device,
+                   igl::ICommandQueue& commandQueue,
+                   const std::shared_ptr<igl::ITexture>& source,
+                   uint32_t mipLevel);
+
+  size_t width_ = 0;
+  size_t height_ = 0;
+  uint32_t numMipLevels_ = 0;
+
+  std::shared_ptr<igl::ITexture> pyramid_;
+  std::shared_ptr<igl::ITexture> scratch_;
+  std::shared_ptr<igl::IFramebuffer> framebuffer_;
+  std::shared_ptr<igl::ISamplerState> sampler_;
+  // One fullscreen triangle per pass; the per-vertex source lod is baked into the vertex data so
+  // the passes need no uniforms (see DepthPyramid.cpp)
+  std::shared_ptr<igl::IBuffer> vertexBuffer_;
+  std::shared_ptr<igl::IRenderPipelineState> copyPipeline_; // level 0: depth -> pyramid
+  std::shared_ptr<igl::IRenderPipelineState> reducePipeline_; // level i: pyramid i-1 -> i
+};
+
+} // namespace iglu::depth_pyramid
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <IGLU/device_group/DeviceGroup.h>
+
+#if IGL_BACKEND_VULKAN
+#include <igl/vulkan/PlatformDevice.h>
+#endif // IGL_BACKEND_VULKAN
+
+namespace iglu::device_group {
+
+DeviceGroup::DeviceGroup(std::vector<std::shared_ptr<igl::IDevice>> devices) :
+  devices_(std::move(devices)) {
+  IGL_ASSERT_MSG(!devices_.empty(), "A DeviceGroup needs at least one device");
+}
+
+const std::shared_ptr<igl::IDevice>& DeviceGroup::getDevice(size_t index) const {
+  IGL_ASSERT(index < devices_.size());
+  return devices_[index];
+}
+
+size_t DeviceGroup::getNextDeviceIndex() {
+  return static_cast<size_t>(nextDevice_.fetch_add(1, std::memory_order_relaxed) %
+                             devices_.size());
+}
+
+size_t DeviceGroup::getDeviceIndexForKey(uint64_t affinityKey) const {
+  // finalizer step of splitmix64: mixes the key so that sequential ids (the common case for job
+  // or tile indices) still spread evenly across the devices
+  affinityKey ^= affinityKey >> 30;
+  affinityKey *= 0xbf58476d1ce4e5b9ull;
+  affinityKey ^= affinityKey >> 27;
+  affinityKey *= 0x94d049bb133111ebull;
+  affinityKey ^= affinityKey >> 31;
+  return static_cast<size_t>(affinityKey % devices_.size());
+}
+
+std::shared_ptr<igl::ITexture> DeviceGroup::shareTexture(
+    size_t sourceDeviceIndex,
+    const std::shared_ptr<igl::ITexture>& texture,
+    size_t destinationDeviceIndex,
+    igl::Result* outResult) {
+  if (!IGL_VERIFY(sourceDeviceIndex < devices_.size() &&
+                  destinationDeviceIndex < devices_.size() && texture != nullptr)) {
+    igl::Result::setResult(outResult, igl::Result::Code::ArgumentInvalid);
+    return nullptr;
+  }
+
+#if IGL_BACKEND_VULKAN
+  auto* srcPlatformDevice =
+      devices_[sourceDeviceIndex]->getPlatformDevice<igl::vulkan::PlatformDevice>();
+  auto* dstPlatformDevice =
+      devices_[destinationDeviceIndex]->getPlatformDevice<igl::vulkan::PlatformDevice>();
+  if (srcPlatformDevice && dstPlatformDevice) {
+    igl::vulkan::PlatformDevice::TextureExportInfo exportInfo;
+    const igl::Result result = srcPlatformDevice->getTextureExportInfo(*texture, exportInfo);
+    if (!result.isOk()) {
+      igl::Result::setResult(outResult, result);
+      return nullptr;
+    }
+
+    // rebuild the descriptor of the exported texture; the import must match it exactly
+    igl::TextureDesc desc;
+    const igl::Dimensions dimensions = texture->getDimensions();
+    desc.width = dimensions.width;
+    desc.height = dimensions.height;
+    desc.depth = dimensions.depth;
+    desc.numLayers = texture->getNumLayers();
+    desc.numSamples = texture->getSamples();
+    desc.usage = texture->getUsage();
+    desc.numMipLevels = texture->getNumMipLevels();
+    desc.type = texture->getType();
+    desc.format = texture->getFormat();
+
+    return dstPlatformDevice->createTextureFromExportedMemory(
+        exportInfo.fileDescriptor, exportInfo.memoryAllocationSize, desc, outResult);
+  }
+#endif // IGL_BACKEND_VULKAN
+
+  igl::Result::setResult(outResult,
+                         igl::Result::Code::Unsupported,
+                         "Cross-device texture sharing is only supported between Vulkan devices");
+  return nullptr;
+}
+
+} // namespace iglu::device_group
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <igl/Device.h>
+#include <igl/Texture.h>
+
+namespace iglu::device_group {
+
+/// Coordinates several independent igl::IDevice instances on a multi-GPU machine. The group does
+/// not synchronize the devices in any way - work submitted to different devices runs fully
+/// independently - it only answers "which device should run this work item" (affinity) and moves
+/// shared assets between devices through external memory instead of per-device copies.
+///
+/// The devices are typically created with igl::vulkan::HWDevice::createDevices(), but any set of
+/// devices works; cross-device texture sharing is only available between Vulkan devices.
+class DeviceGroup {
+ public:
+  explicit DeviceGroup(std::vector<std::shared_ptr<igl::IDevice>> devices);
+
+  [[nodiscard]] size_t getDeviceCount() const {
+    return devices_.size();
+  }
+  [[nodiscard]] const std::shared_ptr<igl::IDevice>& getDevice(size_t index) const;
+
+  /// Returns the device that should execute the next independent work item, cycling through the
+  /// group round-robin. Thread-safe.
+  size_t getNextDeviceIndex();
+
+  /// Returns a stable device index for `affinityKey`. All work items sharing a key (one scene
+  /// tile, one bake job, ...) land on the same device and reuse the resources already resident
+  /// there.
+  [[nodiscard]] size_t getDeviceIndexForKey(uint64_t affinityKey) const;
+
+  /// Imports a texture created on `sourceDeviceIndex` with
+  /// igl::TextureDesc::TextureUsageBits::Shareable into `destinationDeviceIndex`, so both devices
+  /// read the one allocation instead of keeping redundant copies. The returned texture aliases
+  /// the source memory; the caller is responsible for not writing it from both devices at once.
+  /// Only supported between Vulkan devices; fails with Unsupported otherwise.
+  std::shared_ptr<igl::ITexture> shareTexture(size_t sourceDeviceIndex,
+                                              const std::shared_ptr<igl::ITexture>& texture,
+                                              size_t destinationDeviceIndex,
+                                              igl::Result* outResult = nullptr);
+
+ private:
+  std::vector<std::shared_ptr<igl::IDevice>> devices_;
+  std::atomic<uint64_t> nextDevice_ = 0;
+};
+
+} // namespace iglu::device_group
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <IGLU/gpu_load/GpuLoadMonitor.h>
+
+#include <algorithm>
+
+namespace iglu::gpu_load {
+namespace {
+
+// Span from the earliest begin to the latest end of one command buffer's zones
+double bufferSpanNanoseconds(const std::vector<igl::GpuTimestampZone>& zones) {
+  if (zones.empty()) {
+    return 0.0;
+  }
+  uint64_t begin = zones.front().beginNanoseconds;
+  uint64_t end = zones.front().endNanoseconds;
+  for (const auto& zone : zones) {
+    begin = std::min(begin, zone.beginNanoseconds);
+    end = std::max(end, zone.endNanoseconds);
+  }
+  return end > begin ? static_cast<double>(end - begin) : 0.0;
+}
+
+void accumulatePassTotals(const std::vector<igl::GpuTimestampZone>& zones,
+                          std::unordered_map<std::string, double>& passTotals) {
+  for (const auto& zone : zones) {
+    if (zone.endNanoseconds > zone.beginNanoseconds) {
+      passTotals[zone.name] += static_cast<double>(zone.endNanoseconds - zone.beginNanoseconds);
+    }
+  }
+}
+
+} // namespace
+
+GpuLoadMonitor::GpuLoadMonitor(const GpuLoadMonitorDesc& desc) : desc_(desc) {
+  IGL_ASSERT_MSG(desc_.lowWatermark <= desc_.highWatermark,
+                 "lowWatermark above highWatermark leaves no Nominal band");
+}
+
+void GpuLoadMonitor::track(std::shared_ptr<igl::ICommandBuffer> commandBuffer) {
+  if (IGL_VERIFY(commandBuffer)) {
+    pending_.push_back(std::move(commandBuffer));
+  }
+}
+
+void GpuLoadMonitor::update() {
+  if (pending_.empty()) {
+    return;
+  }
+
+  // Everything that resolved since the last update() counts as one frame; with driver queueing
+  // that is usually exactly the buffers of one earlier frame. Timestamps only share an origin
+  // within a buffer, so the frame time is the sum of the per-buffer spans.
+  double frameNanoseconds = 0.0;
+  std::unordered_map<std::string, double> passTotals;
+  bool resolvedAny = false;
+
+  auto it = pending_.begin();
+  while (it != pending_.end()) {
+    scratchZones_.clear();
+    if ((*it)->getGpuTimestampZones(scratchZones_)) {
+      frameNanoseconds += bufferSpanNanoseconds(scratchZones_);
+      accumulatePassTotals(scratchZones_, passTotals);
+      resolvedAny = true;
+      it = pending_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+
+  if (resolvedAny) {
+    commitSample(frameNanoseconds, passTotals);
+  }
+}
+
+void GpuLoadMonitor::addFrameSample(const std::vector<igl::GpuTimestampZone>& zones) {
+  std::unordered_map<std::string, double> passTotals;
+  accumulatePassTotals(zones, passTotals);
+  commitSample(bufferSpanNanoseconds(zones), passTotals);
+}
+
+uint64_t GpuLoadMonitor::frameGpuTimeNanoseconds() const noexcept {
+  return static_cast<uint64_t>(frameAverage_);
+}
+
+uint64_t GpuLoadMonitor::headroomNanoseconds() const noexcept {
+  const auto frame = frameGpuTimeNanoseconds();
+  return frame < desc_.frameBudgetNanoseconds ? desc_.frameBudgetNanoseconds - frame : 0;
+}
+
+uint64_t GpuLoadMonitor::passGpuTimeNanoseconds(const std::string& name) const {
+  const auto it = passAverages_.find(name);
+  return it != passAverages_.end() ? static_cast<uint64_t>(it->second) : 0;
+}
+
+void GpuLoadMonitor::commitSample(double frameNanoseconds,
+                                  const std::unordered_map<std::string, double>& passTotals) {
+  fold(frameAverage_, frameNanoseconds);
+  for (const auto& [name, total] : passTotals) {
+    fold(passAverages_[name], total);
+  }
+
+  // The raw (unsmoothed) classification must hold for hysteresisFrames consecutive frames before
+  // the reported level changes; a single queued-up frame spiking over budget is not a reason to
+  // drop resolution.
+  const LoadLevel candidate = classify(frameNanoseconds);
+  if (candidate == level_) {
+    candidateFrames_ = 0;
+    return;
+  }
+  if (candidate != candidateLevel_) {
+    candidateLevel_ = candidate;
+    candidateFrames_ = 0;
+  }
+  if (++candidateFrames_ >= std::max(desc_.hysteresisFrames, 1u)) {
+    level_ = candidateLevel_;
+    candidateFrames_ = 0;
+    if (callback_) {
+      callback_(level_);
+    }
+  }
+}
+
+LoadLevel GpuLoadMonitor::classify(double frameNanoseconds) const noexcept {
+  const auto budget = static_cast<double>(desc_.frameBudgetNanoseconds);
+  if (frameNanoseconds > desc_.highWatermark * budget) {
+    return LoadLevel::OverBudget;
+  }
+  if (frameNanoseconds < desc_.lowWatermark * budget) {
+    return LoadLevel::UnderBudget;
+  }
+  return LoadLevel::Nominal;
+}
+
+void GpuLoadMonitor::fold(double& average, double sample) const noexcept {
+  // The first sample for an average (or a new zone name) seeds it directly so startup does not
+  // ramp from zero
+  if (average == 0.0) {
+    average = sample;
+    return;
+  }
+  average += desc_.smoothingFactor * (sample - average);
+}
+
+} // namespace iglu::gpu_load
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <igl/IGL.h>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace iglu::gpu_load {
+
+// Where the smoothed frame GPU time sits relative to the frame budget. UnderBudget means there is
+// headroom to scale quality up, OverBudget means work should be scaled down to keep vsync.
+enum class LoadLevel : uint8_t { UnderBudget, Nominal, OverBudget };
+
+struct GpuLoadMonitorDesc {
+  // Target GPU time per frame, e.g. 16'666'667 for 60 Hz
+  uint64_t frameBudgetNanoseconds = 16'666'667;
+  // EMA weight of the newest frame sample; higher reacts faster but is noisier
+  double smoothingFactor = 0.1;
+  // Smoothed frame time above highWatermark * budget classifies as OverBudget, below
+  // lowWatermark * budget as UnderBudget; the band between them is Nominal and acts as a dead
+  // zone so the level does not flap around a single threshold
+  double highWatermark = 0.9;
+  double lowWatermark = 0.7;
+  // A level change is reported only after this many consecutive frames classify the same way.
+  // Driver queueing makes single-frame GPU spikes common and meaningless for scaling decisions.
+  uint32_t hysteresisFrames = 3;
+};
+
+// Closed-loop GPU load tracking on top of the GPU timestamp zones recorded with
+// ICommandBuffer::pushGpuTimestampZone(). Engines feed every submitted command buffer to track();
+// update(), called once per frame, polls the pending buffers without blocking, folds resolved
+// zones into per-zone and whole-frame exponential moving averages, and reports hysteresis-filtered
+// LoadLevel changes through an optional callback. The smoothed times and headroom queries give
+// dynamic-resolution and effect-scaling heuristics actual GPU durations instead of CPU-side
+// guesses, which mis-fire whenever the driver queues frames ahead.
+//
+// Tracked command buffers are kept alive until their timestamps resolve, as the timestamp API
+// requires. On devices without GPU timestamp support pushGpuTimestampZone() returns false and no
+// zones ever resolve; the monitor then simply reports no samples and the level stays Nominal.
+class GpuLoadMonitor final {
+ public:
+  explicit GpuLoadMonitor(const GpuLoadMonitorDesc& desc);
+
+  // Registers a submitted command buffer whose timestamp zones should feed the averages. Call
+  // after ICommandQueue::submit(); the buffer is retained until its zones resolve.
+  void track(std::shared_ptr<igl::ICommandBuffer> commandBuffer);
+
+  // Polls tracked command buffers without blocking and releases the ones whose zones resolved.
+  // All buffers that resolve in one update() are folded into the averages as a single frame
+  // sample. Call once per frame, e.g. right before building the next one.
+  void update();
+
+  // Folds one frame's worth of resolved zones directly into the averages, bypassing command
+  // buffer tracking; update() is implemented on top of the same folding path. The zones must come
+  // from a single command buffer (timestamps share an origin only within one buffer); the frame
+  // GPU time is the span from the earliest begin to the latest end, so nested zones are not
+  // double-counted.
+  void addFrameSample(const std::vector<igl::GpuTimestampZone>& zones);
+
+  // Smoothed whole-frame GPU time; 0 until the first sample resolves
+  [[nodiscard]] uint64_t frameGpuTimeNanoseconds() const noexcept;
+
+  // Budget minus the smoothed frame time; 0 when over budget
+  [[nodiscard]] uint64_t headroomNanoseconds() const noexcept;
+
+  // Smoothed GPU time of the zones pushed under `name`; 0 for names never seen
+  [[nodiscard]] uint64_t passGpuTimeNanoseconds(const std::string& name) const;
+
+  [[nodiscard]] LoadLevel loadLevel() const noexcept {
+    return level_;
+  }
+
+  // Invoked from update()/addFrameSample() whenever the load level changes after passing the
+  // hysteresis filter
+  void setLoadLevelCallback(std::function<void(LoadLevel)> callback) {
+    callback_ = std::move(callback);
+  }
+
+ private:
+  // Folds one frame sample (whole-frame GPU time plus per-zone-name totals) into the averages and
+  // advances the hysteresis state
+  void commitSample(double frameNanoseconds,
+                    const std::unordered_map<std::string, double>& passTotals);
+  [[nodiscard]] LoadLevel classify(double frameNanoseconds) const noexcept;
+  void fold(double& average, double sample) const noexcept;
+
+  GpuLoadMonitorDesc desc_;
+
+  std::vector<std::shared_ptr<igl::ICommandBuffer>> pending_;
+  std::vector<igl::GpuTimestampZone> scratchZones_;
+
+  double frameAverage_ = 0.0;
+  std::unordered_map<std::string, double> passAverages_;
+
+  LoadLevel level_ = LoadLevel::Nominal;
+  LoadLevel candidateLevel_ = LoadLevel::Nominal;
+  uint32_t candidateFrames_ = 0;
+  std::function<void(LoadLevel)> callback_;
+};
+
+} // namespace iglu::gpu_load
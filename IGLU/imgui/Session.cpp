@@ -164,25 +164,39 @@ static std::unique_ptr<igl::IShaderStages> getShaderStagesForBackend(igl::IDevic
   IGL_UNREACHABLE_RETURN(nullptr)
 }
 
+// Starting sizes for the pooled per-draw-list buffers; they grow geometrically on demand and
+// then persist, so a steady-state HUD settles after a few frames and never reallocates again.
+constexpr size_t kInitialVertexBufferSize = 1024 * sizeof(ImDrawVert);
+constexpr size_t kInitialIndexBufferSize = 4096 * sizeof(ImDrawIdx);
+
+static size_t grownCapacity(size_t capacity, size_t requiredSize) {
+  while (capacity < requiredSize) {
+    capacity *= 2;
+  }
+  return capacity;
+}
+
 struct DrawableData {
   std::shared_ptr<iglu::vertexdata::VertexData> vertexData;
   std::shared_ptr<iglu::drawable::Drawable> drawable;
+  size_t vertexBufferSize = 0;
+  size_t indexBufferSize = 0;
 
   DrawableData(igl::IDevice& device,
                const std::shared_ptr<igl::IVertexInputState>& inputState,
-               const std::shared_ptr<iglu::material::Material>& material) {
+               const std::shared_ptr<iglu::material::Material>& material,
+               size_t vertexBufferSize,
+               size_t indexBufferSize) :
+    vertexBufferSize(vertexBufferSize), indexBufferSize(indexBufferSize) {
     IGL_ASSERT_MSG(sizeof(ImDrawIdx) == 2, "The constants below may not work with the ImGui data.");
-    const size_t kMaxVertices = (1l << 16);
-    const size_t kMaxVertexBufferSize = kMaxVertices * sizeof(ImDrawVert);
-    const size_t kMaxIndexBufferSize = kMaxVertices * sizeof(ImDrawIdx);
 
     const igl::BufferDesc vbDesc(igl::BufferDesc::BufferTypeBits::Vertex,
                                  nullptr,
-                                 kMaxVertexBufferSize,
+                                 vertexBufferSize,
                                  igl::ResourceStorage::Shared);
     const igl::BufferDesc ibDesc(igl::BufferDesc::BufferTypeBits::Index,
                                  nullptr,
-                                 kMaxIndexBufferSize,
+                                 indexBufferSize,
                                  igl::ResourceStorage::Shared);
 
     iglu::vertexdata::PrimitiveDesc primitiveDesc;
@@ -348,16 +362,79 @@ void Session::Renderer::renderDrawData(igl::IDevice& device,
   for (int n = 0; n < drawData->CmdListsCount; n++) {
     const ImDrawList* cmd_list = drawData->CmdLists[n];
 
+    const size_t vertexBytes = cmd_list->VtxBuffer.Size * sizeof(ImDrawVert);
+    const size_t indexBytes = cmd_list->IdxBuffer.Size * sizeof(ImDrawIdx);
+
     if (n >= curFrameDrawables.size()) {
-      curFrameDrawables.emplace_back(device, _vertexInputState, _material);
+      curFrameDrawables.emplace_back(device,
+                                     _vertexInputState,
+                                     _material,
+                                     grownCapacity(kInitialVertexBufferSize, vertexBytes),
+                                     grownCapacity(kInitialIndexBufferSize, indexBytes));
+    } else if (curFrameDrawables[n].vertexBufferSize < vertexBytes ||
+               curFrameDrawables[n].indexBufferSize < indexBytes) {
+      // Grow geometrically. Replacing this slot's buffers is safe: they were last in flight three
+      // frames ago, which is what the buffering ring below protects against.
+      curFrameDrawables[n] =
+          DrawableData(device,
+                       _vertexInputState,
+                       _material,
+                       grownCapacity(curFrameDrawables[n].vertexBufferSize, vertexBytes),
+                       grownCapacity(curFrameDrawables[n].indexBufferSize, indexBytes));
     }
     DrawableData& drawableData = curFrameDrawables[n];
 
     // Upload vertex/index buffers
-    drawableData.vertexData->vertexBuffer().upload(
-        cmd_list->VtxBuffer.Data, {cmd_list->VtxBuffer.Size * sizeof(ImDrawVert), 0});
-    drawableData.vertexData->indexBuffer().upload(
-        cmd_list->IdxBuffer.Data, {cmd_list->IdxBuffer.Size * sizeof(ImDrawIdx), 0});
+    drawableData.vertexData->vertexBuffer().upload(cmd_list->VtxBuffer.Data, {vertexBytes, 0});
+    drawableData.vertexData->indexBuffer().upload(cmd_list->IdxBuffer.Data, {indexBytes, 0});
+
+    // ImGui splits commands on any state change, so UI-heavy scenes produce long runs of
+    // adjacent ImDrawCmds that share the same texture (everything in the font/icon atlas) and
+    // the same clip rectangle. The index data of consecutive commands is contiguous, which makes
+    // a merged run just a longer index range; coalescing them collapses hundreds of tiny
+    // drawIndexed calls (each with a scissor rebind) into a handful. Reordering commands to sort
+    // by texture is deliberately not done: UI correctness depends on painter's order, and
+    // overlap testing would cost more than the merge saves.
+    struct PendingDraw {
+      igl::ScissorRect scissor;
+      ImTextureID textureId = nullptr;
+      uint32_t idxOffset = 0;
+      uint32_t elemCount = 0;
+    };
+    PendingDraw pending;
+
+    auto flushPendingDraw = [&]() {
+      if (pending.elemCount == 0) {
+        return;
+      }
+
+      cmdEncoder.bindScissorRect(pending.scissor);
+
+      if (pending.textureId != lastBoundTextureId) {
+        lastBoundTextureId = pending.textureId;
+        auto* tex = reinterpret_cast<igl::ITexture*>(pending.textureId);
+        if (isVulkan) {
+          // @fb-only
+          // Add Vulkan support for texture reflection info in ShaderUniforms so we don't need to
+          // bind the texture directly
+          cmdEncoder.bindTexture(0, igl::BindTarget::kFragment, tex);
+          cmdEncoder.bindSamplerState(0, igl::BindTarget::kFragment, _linearSampler.get());
+        } else {
+          _material->shaderUniforms().setTexture(
+              "texture", tex ? tex : _fontTexture.get(), _linearSampler);
+        }
+      }
+
+      drawableData.vertexData->primitiveDesc().numEntries = pending.elemCount;
+      drawableData.vertexData->primitiveDesc().offset = pending.idxOffset * sizeof(ImDrawIdx);
+
+      drawableData.drawable->draw(device,
+                                  cmdEncoder,
+                                  _renderPipelineDesc,
+                                  isVulkan ? sizeof(orthoProjection) : 0,
+                                  &orthoProjection);
+      pending.elemCount = 0;
+    };
 
     for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++) {
       const ImDrawCmd cmd = cmd_list->CmdBuffer[cmd_i];
@@ -379,32 +456,22 @@ void Session::Renderer::renderDrawData(igl::IDevice& device,
                                            : uint32_t(clipMin.y),
                                   uint32_t(clipMax.x - clipMin.x),
                                   uint32_t(clipMax.y - clipMin.y)};
-      cmdEncoder.bindScissorRect(rect);
 
-      if (cmd.TextureId != lastBoundTextureId) {
-        lastBoundTextureId = cmd.TextureId;
-        auto* tex = reinterpret_cast<igl::ITexture*>(cmd.TextureId);
-        if (isVulkan) {
-          // @fb-only
-          // Add Vulkan support for texture reflection info in ShaderUniforms so we don't need to
-          // bind the texture directly
-          cmdEncoder.bindTexture(0, igl::BindTarget::kFragment, tex);
-          cmdEncoder.bindSamplerState(0, igl::BindTarget::kFragment, _linearSampler.get());
-        } else {
-          _material->shaderUniforms().setTexture(
-              "texture", tex ? tex : _fontTexture.get(), _linearSampler);
-        }
+      const bool canMerge = pending.elemCount > 0 && cmd.TextureId == pending.textureId &&
+                            cmd.IdxOffset == pending.idxOffset + pending.elemCount &&
+                            rect.x == pending.scissor.x && rect.y == pending.scissor.y &&
+                            rect.width == pending.scissor.width &&
+                            rect.height == pending.scissor.height;
+      if (canMerge) {
+        pending.elemCount += cmd.ElemCount;
+        continue;
       }
 
-      drawableData.vertexData->primitiveDesc().numEntries = cmd.ElemCount;
-      drawableData.vertexData->primitiveDesc().offset = cmd.IdxOffset * sizeof(ImDrawIdx);
-
-      drawableData.drawable->draw(device,
-                                  cmdEncoder,
-                                  _renderPipelineDesc,
-                                  isVulkan ? sizeof(orthoProjection) : 0,
-                                  &orthoProjection);
+      flushPendingDraw();
+      pending = {rect, cmd.TextureId, cmd.IdxOffset, cmd.ElemCount};
     }
+
+    flushPendingDraw();
   }
 
   if (isOpenGL) {
@@ -7,10 +7,13 @@
 
 #if defined(IGL_UWP_VS_FIX)
 #include <igl/IGLU/managedUniformBuffer/ManagedUniformBuffer.h>
+#include <igl/IGLU/managedUniformBuffer/ManagedUniformBufferArena.h>
 #else
 #include <IGLU/managedUniformBuffer/ManagedUniformBuffer.h>
+#include <IGLU/managedUniformBuffer/ManagedUniformBufferArena.h>
 #endif
 
+#include <algorithm>
 #include <cstdlib>
 #include <igl/Macros.h>
 
@@ -33,14 +36,41 @@ namespace iglu {
 ManagedUniformBuffer::ManagedUniformBuffer(igl::IDevice& device,
                                            const ManagedUniformBufferInfo& info) :
   uniformInfo(info) {
-  igl::BufferDesc desc;
-  desc.length = info.length;
+  if (!IGL_VERIFY(info.length != 0)) {
+    result.code = igl::Result::Code::ArgumentInvalid;
+    return;
+  }
 
-  if (!IGL_VERIFY(desc.length != 0)) {
+  initStandalone(device);
+}
+
+ManagedUniformBuffer::ManagedUniformBuffer(igl::IDevice& device,
+                                           const ManagedUniformBufferInfo& info,
+                                           ManagedUniformBufferArena& arena) :
+  uniformInfo(info) {
+  if (!IGL_VERIFY(info.length != 0)) {
     result.code = igl::Result::Code::ArgumentInvalid;
     return;
   }
 
+  data_ = arena.alloc(info.length, arenaOffset_);
+  if (data_ != nullptr) {
+    arena_ = &arena;
+    return;
+  }
+
+  // The arena is exhausted; fall back to standalone storage so rendering stays correct. The
+  // arena's high-water mark (getUsedSize()) is a good value to re-size it with.
+  IGL_LOG_ERROR_ONCE(
+      "iglu::ManagedUniformBuffer: uniform arena exhausted, falling back to standalone "
+      "allocation\n");
+  initStandalone(device);
+}
+
+void ManagedUniformBuffer::initStandalone(igl::IDevice& device) {
+  igl::BufferDesc desc;
+  desc.length = uniformInfo.length;
+
   // Currently, the OpenGL code path always uses individual uniforms so no need to allocate a
   // buffer.
   bool createBuffer = device.getBackendType() != igl::BackendType::OpenGL;
@@ -105,6 +135,10 @@ ManagedUniformBuffer::ManagedUniformBuffer(igl::IDevice& device,
 }
 
 ManagedUniformBuffer::~ManagedUniformBuffer() {
+  if (arena_) {
+    // the block belongs to the arena and is recycled wholesale by ManagedUniformBufferArena::reset
+    return;
+  }
 #if IGL_PLATFORM_IOS_SIMULATOR
   if (vmAllocLength_) {
     // if vmAllocLength_ is nonzero it implies we used vm_alloc to allocate the memory
@@ -146,16 +180,15 @@ void ManagedUniformBuffer::bind(const igl::IDevice& device,
     IGL_ASSERT_MSG(0, "Should not use OpenGL backend on Mac Catalyst, use Metal instead\n");
 #endif
   } else {
-    if (useBindBytes_) {
+    if (arena_) {
+      // The data was written in place into the arena's CPU block and uploaded in one copy by
+      // ManagedUniformBufferArena::flush()
+      IGL_ASSERT_MSG(arena_->getBuffer(), "bind() called before ManagedUniformBufferArena::flush");
+      encoder.bindBuffer(uniformInfo.index, bindTarget, arena_->getBuffer(), arenaOffset_);
+    } else if (useBindBytes_) {
       encoder.bindBytes(uniformInfo.index, bindTarget, data_, length_);
     } else {
-      // Need to ensure the latest data is present in the buffer
-      // TODO: Have callers handle this when data has changed.
-      void* data = data_;
-      if (buffer_->acceptedApiHints() & igl::BufferDesc::BufferAPIHintBits::NoCopy) {
-        data = nullptr;
-      }
-      buffer_->upload(data, {buffer_->getSizeInBytes(), 0});
+      uploadToBuffer();
       encoder.bindBuffer(uniformInfo.index, bindTarget, buffer_, 0);
     }
   }
@@ -165,16 +198,13 @@ void ManagedUniformBuffer::bind(const igl::IDevice& device, igl::IComputeCommand
   if (device.getBackendType() == igl::BackendType::OpenGL) {
     IGL_ASSERT_MSG(0, "No ComputeEncoder supported for OpenGL\n");
   } else {
-    if (useBindBytes_) {
+    if (arena_) {
+      IGL_ASSERT_MSG(arena_->getBuffer(), "bind() called before ManagedUniformBufferArena::flush");
+      encoder.bindBuffer(uniformInfo.index, arena_->getBuffer(), arenaOffset_);
+    } else if (useBindBytes_) {
       encoder.bindBytes(uniformInfo.index, data_, length_);
     } else {
-      // Need to ensure the latest data is present in the buffer
-      // TODO: Have callers handle this when data has changed.
-      void* data = data_;
-      if (buffer_->acceptedApiHints() & igl::BufferDesc::BufferAPIHintBits::NoCopy) {
-        data = nullptr;
-      }
-      buffer_->upload(data, {buffer_->getSizeInBytes(), 0});
+      uploadToBuffer();
       encoder.bindBuffer(uniformInfo.index, buffer_, 0);
     }
   }
@@ -184,6 +214,78 @@ void* ManagedUniformBuffer::getData() {
   return data_;
 }
 
+namespace {
+// dirty ranges closer than this are merged, so one slightly scattered update does not degrade
+// into many tiny upload calls
+constexpr size_t kDirtyRangeMergeGap = 64;
+// past this many disjoint ranges the tracking has stopped paying for itself; collapse to one span
+constexpr size_t kMaxDirtyRanges = 16;
+} // namespace
+
+void ManagedUniformBuffer::setDeltaUpdatesEnabled(bool enabled) {
+  if (enabled == deltaUpdatesEnabled_) {
+    return;
+  }
+  deltaUpdatesEnabled_ = enabled;
+  dirtyRanges_.clear();
+  if (enabled) {
+    // the buffer content predating the tracking is unknown: re-upload everything once
+    dirtyRanges_.emplace_back(uniformInfo.length, 0);
+  }
+}
+
+void ManagedUniformBuffer::markDirtyRange(size_t offset, size_t size) {
+  if (!deltaUpdatesEnabled_ || size == 0 || offset >= uniformInfo.length) {
+    return;
+  }
+  size = std::min(size, uniformInfo.length - offset);
+
+  // merge into an overlapping or nearby range when possible
+  for (auto& range : dirtyRanges_) {
+    const size_t rangeEnd = range.offset + range.size;
+    if (offset <= rangeEnd + kDirtyRangeMergeGap && range.offset <= offset + size) {
+      const size_t begin = std::min(range.offset, offset);
+      const size_t end = std::max(rangeEnd, offset + size);
+      range.offset = begin;
+      range.size = end - begin;
+      return;
+    }
+  }
+
+  if (dirtyRanges_.size() >= kMaxDirtyRanges) {
+    size_t begin = offset;
+    size_t end = offset + size;
+    for (const auto& range : dirtyRanges_) {
+      begin = std::min(begin, range.offset);
+      end = std::max(end, range.offset + range.size);
+    }
+    dirtyRanges_.clear();
+    dirtyRanges_.emplace_back(end - begin, begin);
+    return;
+  }
+
+  dirtyRanges_.emplace_back(size, offset);
+}
+
+void ManagedUniformBuffer::uploadToBuffer() {
+  if (buffer_->acceptedApiHints() & igl::BufferDesc::BufferAPIHintBits::NoCopy) {
+    // the backend reads data_ in place; no bytes are copied, so there is nothing to slice
+    buffer_->upload(nullptr, {buffer_->getSizeInBytes(), 0});
+    dirtyRanges_.clear();
+    return;
+  }
+  if (!deltaUpdatesEnabled_) {
+    // Need to ensure the latest data is present in the buffer
+    buffer_->upload(data_, {buffer_->getSizeInBytes(), 0});
+    return;
+  }
+  const char* bytes = reinterpret_cast<const char*>(data_);
+  for (const auto& range : dirtyRanges_) {
+    buffer_->upload(bytes + range.offset, range);
+  }
+  dirtyRanges_.clear();
+}
+
 void ManagedUniformBuffer::buildUnifromLUT() {
   uniformLUT_ = std::make_unique<std::unordered_map<std::string, size_t>>();
   for (size_t i = 0; i < uniformInfo.uniforms.size(); ++i) {
@@ -230,6 +332,7 @@ bool ManagedUniformBuffer::updateData(const char* name, const void* data, size_t
       }
       char* ptr = reinterpret_cast<char*>(data_);
       checked_memcpy(ptr + uniform.offset, uniformDataSize, data, dataSize);
+      markDirtyRange(uniform.offset, dataSize);
       return true;
     }
   }
@@ -237,6 +340,41 @@ bool ManagedUniformBuffer::updateData(const char* name, const void* data, size_t
   return false;
 }
 
+bool ManagedUniformBuffer::updateDataAtIndex(size_t uniformIndex,
+                                             const void* data,
+                                             size_t dataSize) {
+  if (!IGL_VERIFY(uniformIndex < uniformInfo.uniforms.size())) {
+    return false;
+  }
+  auto& uniform = uniformInfo.uniforms[uniformIndex];
+  const size_t uniformDataSize = getUniformDataSizeInternal(uniform);
+  if (dataSize > uniformDataSize) {
+    // same policy as updateData: never write past the uniform's extent
+    dataSize = uniformDataSize;
+  }
+  char* ptr = reinterpret_cast<char*>(data_);
+  checked_memcpy(ptr + uniform.offset, uniformDataSize, data, dataSize);
+  markDirtyRange(uniform.offset, dataSize);
+  return true;
+}
+
+ManagedUniformBufferInfo ManagedUniformBufferInfo::fromLayout(
+    const igl::UniformBlockLayout& layout) {
+  ManagedUniformBufferInfo info;
+  info.index = layout.bufferIndex;
+  info.length = layout.dataSize;
+  info.uniforms.reserve(layout.members.size());
+  for (const auto& member : layout.members) {
+    igl::UniformDesc desc;
+    desc.name = member.name.toString();
+    desc.type = member.type;
+    desc.numElements = member.arrayLength;
+    desc.offset = member.offset;
+    info.uniforms.push_back(std::move(desc));
+  }
+  return info;
+}
+
 size_t ManagedUniformBuffer::getUniformDataSize(const char* name) {
   for (auto& uniform : uniformInfo.uniforms) {
     if (strcmp(name, uniform.name.c_str()) == 0) {
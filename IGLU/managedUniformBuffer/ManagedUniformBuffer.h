@@ -8,6 +8,7 @@
 #pragma once
 
 #include <igl/IGL.h>
+#include <igl/RenderPipelineReflection.h>
 #include <vector>
 
 namespace igl {
@@ -15,10 +16,16 @@ class IDevice;
 } // namespace igl
 
 namespace iglu {
+class ManagedUniformBufferArena;
+
 struct ManagedUniformBufferInfo {
   int index = -1;
   size_t length = 0;
   std::vector<igl::UniformDesc> uniforms;
+
+  // Builds the info straight from a baked reflection layout (see
+  // igl::UniformBlockLayout::getOrCreate), so apps don't re-derive offsets and types per pipeline
+  static ManagedUniformBufferInfo fromLayout(const igl::UniformBlockLayout& layout);
 };
 
 class ManagedUniformBuffer {
@@ -26,15 +33,37 @@ class ManagedUniformBuffer {
   igl::Result result;
   ManagedUniformBufferInfo uniformInfo;
   ManagedUniformBuffer(igl::IDevice& device, const ManagedUniformBufferInfo& info);
+  // Arena-backed mode: the block is bump-allocated from `arena` and bind() binds the arena's
+  // shared buffer at this block's offset. The instance must not be bound after the arena is
+  // reset. Falls back to standalone storage when the arena is exhausted.
+  ManagedUniformBuffer(igl::IDevice& device,
+                       const ManagedUniformBufferInfo& info,
+                       ManagedUniformBufferArena& arena);
   ~ManagedUniformBuffer();
   // This function takes a chunk of data and use it to update the value of uniform 'name'
   bool updateData(const char* name, const void* data, size_t dataSize);
+  // Same as updateData but addresses the uniform by its index in uniformInfo.uniforms, skipping
+  // the name lookup. When the info came from ManagedUniformBufferInfo::fromLayout, indices match
+  // igl::UniformBlockLayout::members (resolve them once with findMember)
+  bool updateDataAtIndex(size_t uniformIndex, const void* data, size_t dataSize);
   // This function returns the expected data size for uniform with given name
   // If uniform has type UniformType::Float3, this function will return
   // 3 * sizeof(float) if elementStride is zero and return elementStride otherwise
   // if no uniform with given name exists, the function will return 0
   size_t getUniformDataSize(const char* name);
 
+  // When enabled, bind() uploads only the byte ranges touched since the previous bind instead of
+  // the whole block - updateData()/updateDataAtIndex() track their ranges automatically, writers
+  // going through getData() must call markDirtyRange(). Big mostly-static blocks (e.g. bone
+  // matrix arrays where few bones move per frame) then cost bandwidth proportional to what
+  // changed. Enabling marks the whole block dirty once, so the first bind is a full upload.
+  // Only the standalone-buffer path is affected; bindBytes and arena-backed blocks have no
+  // per-bind upload of their own
+  void setDeltaUpdatesEnabled(bool enabled);
+  // Marks [offset, offset + size) as needing upload at the next bind(). No-op unless delta
+  // updates are enabled; overlapping and nearby ranges are coalesced
+  void markDirtyRange(size_t offset, size_t size);
+
   void bind(const igl::IDevice& device,
             const igl::IRenderPipelineState& pipelineState,
             igl::IRenderCommandEncoder& encoder);
@@ -49,10 +78,16 @@ class ManagedUniformBuffer {
   void buildUnifromLUT();
 
  private:
+  void initStandalone(igl::IDevice& device);
   size_t getUniformDataSizeInternal(igl::UniformDesc& uniform);
+  // issues the per-bind upload into buffer_: the dirty ranges when delta updates are enabled,
+  // the whole block otherwise
+  void uploadToBuffer();
   void* data_ = nullptr;
   int length_ = 0;
   std::shared_ptr<igl::IBuffer> buffer_ = nullptr;
+  ManagedUniformBufferArena* arena_ = nullptr;
+  size_t arenaOffset_ = 0;
   std::unique_ptr<std::unordered_map<std::string, size_t>> uniformLUT_ = nullptr;
 #if IGL_PLATFORM_IOS_SIMULATOR
   /// If we're in the simulator we need to hold onto length so we can deallocate memory buffer
@@ -62,5 +97,8 @@ class ManagedUniformBuffer {
   size_t vmAllocLength_ = 0;
 #endif
   bool useBindBytes_ = false;
+  // coalesced not-yet-uploaded ranges; only maintained while deltaUpdatesEnabled_ is set
+  std::vector<igl::BufferRange> dirtyRanges_;
+  bool deltaUpdatesEnabled_ = false;
 };
 } // namespace iglu
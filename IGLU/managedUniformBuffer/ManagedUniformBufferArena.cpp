@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#if defined(IGL_UWP_VS_FIX)
+#include <igl/IGLU/managedUniformBuffer/ManagedUniformBufferArena.h>
+#else
+#include <IGLU/managedUniformBuffer/ManagedUniformBufferArena.h>
+#endif
+
+namespace iglu {
+
+ManagedUniformBufferArena::ManagedUniformBufferArena(igl::IDevice& device, size_t capacity) :
+  device_(device), data_(capacity) {
+  size_t alignment = 0;
+  if (device.getFeatureLimits(igl::DeviceFeatureLimits::BufferAlignment, alignment) &&
+      alignment > alignment_) {
+    alignment_ = alignment;
+  }
+}
+
+void* ManagedUniformBufferArena::alloc(size_t length, size_t& outOffset) {
+  const size_t offset = ((head_ + alignment_ - 1) / alignment_) * alignment_;
+  if (offset + length > data_.size()) {
+    return nullptr;
+  }
+  head_ = offset + length;
+  outOffset = offset;
+  return data_.data() + offset;
+}
+
+void ManagedUniformBufferArena::flush() {
+  if (head_ == 0) {
+    return;
+  }
+  // The OpenGL backend binds individual uniforms straight from the CPU blocks, so there is
+  // nothing to upload
+  if (device_.getBackendType() == igl::BackendType::OpenGL) {
+    return;
+  }
+  if (!buffer_) {
+    igl::BufferDesc desc;
+    desc.length = data_.size();
+    desc.type = igl::BufferDesc::BufferTypeBits::Uniform;
+    desc.storage = igl::ResourceStorage::Shared;
+    buffer_ = device_.createBuffer(desc, nullptr);
+    if (!IGL_VERIFY(buffer_)) {
+      return;
+    }
+  }
+  buffer_->upload(data_.data(), {head_, 0});
+}
+
+void ManagedUniformBufferArena::reset() {
+  head_ = 0;
+}
+
+} // namespace iglu
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <igl/IGL.h>
+#include <vector>
+
+namespace igl {
+class IDevice;
+} // namespace igl
+
+namespace iglu {
+
+// A per-frame linear arena backing many ManagedUniformBuffer instances with a single large
+// buffer. Instead of one allocation and one upload per material per frame, instances constructed
+// with an arena bump-allocate their block from it, bind the shared buffer at their offset, and
+// the whole arena is uploaded once per frame with flush() and recycled with reset().
+//
+// Typical frame loop (use one arena per frame in flight so the GPU never reads a reset arena):
+//   arena.reset();
+//   ... construct ManagedUniformBuffer(device, info, arena) per material, updateData() ...
+//   arena.flush();
+//   ... encode passes; each bind() is just a buffer bind at an offset ...
+//
+// reset() invalidates every block handed out since the previous reset, so arena-backed
+// ManagedUniformBuffer instances must not be bound after the arena they came from is reset.
+class ManagedUniformBufferArena {
+ public:
+  // Creates the arena with a fixed capacity in bytes. The backing buffer is created lazily on
+  // the first flush() so arenas on the OpenGL backend (which binds individual uniforms from CPU
+  // memory) never allocate GPU storage.
+  ManagedUniformBufferArena(igl::IDevice& device, size_t capacity);
+
+  ManagedUniformBufferArena(const ManagedUniformBufferArena&) = delete;
+  ManagedUniformBufferArena& operator=(const ManagedUniformBufferArena&) = delete;
+
+  // Bump-allocates a block of `length` bytes aligned to the device's uniform buffer offset
+  // alignment. Returns the CPU pointer for the block and stores its offset in `outOffset`, or
+  // nullptr when the arena is exhausted.
+  void* alloc(size_t length, size_t& outOffset);
+
+  // Uploads everything allocated since the last reset() to the GPU buffer in one copy. Call once
+  // per frame, after the frame's uniform data has been written and before encoding.
+  void flush();
+
+  // Recycles the arena for a new frame. Every block handed out so far becomes invalid.
+  void reset();
+
+  [[nodiscard]] const std::shared_ptr<igl::IBuffer>& getBuffer() const {
+    return buffer_;
+  }
+
+  [[nodiscard]] size_t getCapacity() const {
+    return data_.size();
+  }
+
+  // Bytes allocated since the last reset(). The high-water mark across frames is a good value to
+  // size the arena with.
+  [[nodiscard]] size_t getUsedSize() const {
+    return head_;
+  }
+
+ private:
+  igl::IDevice& device_;
+  std::vector<uint8_t> data_;
+  std::shared_ptr<igl::IBuffer> buffer_;
+  size_t head_ = 0;
+  size_t alignment_ = 16;
+};
+
+} // namespace iglu
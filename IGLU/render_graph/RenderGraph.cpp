@@ -0,0 +1,273 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <IGLU/render_graph/RenderGraph.h>
+
+namespace iglu::render_graph {
+
+const std::shared_ptr<igl::ITexture>& PassResources::texture(TextureHandle handle) const {
+  IGL_ASSERT_MSG(handle.valid() && handle.index < graph_.textures_.size(),
+                 "Texture handle does not belong to this graph");
+  const auto& resource = graph_.textures_[handle.index];
+  IGL_ASSERT_MSG(resource.texture != nullptr,
+                 "Texture is not alive in the pass being encoded; check the declared read/write "
+                 "sets");
+  return resource.texture;
+}
+
+RenderGraph::RenderGraph(igl::IDevice& device) : transientPool_(device) {}
+
+TextureHandle RenderGraph::declareTexture(const igl::TextureDesc& desc) {
+  TextureResource resource;
+  resource.desc = desc;
+  textures_.push_back(std::move(resource));
+  return TextureHandle{textures_.size() - 1};
+}
+
+TextureHandle RenderGraph::importTexture(std::shared_ptr<igl::ITexture> texture) {
+  IGL_ASSERT(texture != nullptr);
+  TextureResource resource;
+  resource.texture = std::move(texture);
+  resource.imported = true;
+  textures_.push_back(std::move(resource));
+  return TextureHandle{textures_.size() - 1};
+}
+
+void RenderGraph::addPass(PassDesc desc) {
+  IGL_ASSERT_MSG(desc.encode != nullptr, "A pass needs an encode callback");
+  passes_.push_back(std::move(desc));
+}
+
+std::shared_ptr<igl::ICommandBuffer> RenderGraph::execute(igl::ICommandQueue& queue,
+                                                          igl::Result* outResult) {
+  const size_t passCount = passes_.size();
+  const size_t textureCount = textures_.size();
+  lastCulledPassCount_ = 0;
+
+  // the graph is rebuilt every frame: whatever happens below, recorded passes and declared
+  // resources are gone afterwards and the transient pool advances one frame
+  const auto finishFrame = [this]() {
+    passes_.clear();
+    textures_.clear();
+    transientPool_.endFrame();
+  };
+
+  if (passCount == 0) {
+    finishFrame();
+    igl::Result::setOk(outResult);
+    return nullptr;
+  }
+
+  // per-resource use lists, in pass insertion order
+  std::vector<std::vector<size_t>> writers(textureCount);
+  std::vector<std::vector<size_t>> readers(textureCount);
+  for (size_t pass = 0; pass < passCount; ++pass) {
+    for (const TextureHandle handle : passes_[pass].writes) {
+      if (IGL_VERIFY(handle.valid() && handle.index < textureCount)) {
+        writers[handle.index].push_back(pass);
+      }
+    }
+    for (const TextureHandle handle : passes_[pass].reads) {
+      if (IGL_VERIFY(handle.valid() && handle.index < textureCount)) {
+        readers[handle.index].push_back(pass);
+      }
+    }
+  }
+
+  // Dependency edges. Writers of the same resource are chained in insertion order; a reader
+  // depends on the last writer added before it (or, when it was added before every writer, on
+  // all of them via the end of the chain); a writer added after a reader of the previous
+  // version must wait for that reader
+  std::vector<std::vector<size_t>> adjacency(passCount);
+  std::vector<size_t> inDegree(passCount, 0);
+  const auto addEdge = [&adjacency, &inDegree](size_t from, size_t to) {
+    if (from == to) {
+      return;
+    }
+    adjacency[from].push_back(to);
+    ++inDegree[to];
+  };
+
+  for (size_t r = 0; r < textureCount; ++r) {
+    const auto& resourceWriters = writers[r];
+    for (size_t w = 1; w < resourceWriters.size(); ++w) {
+      addEdge(resourceWriters[w - 1], resourceWriters[w]);
+    }
+    for (const size_t reader : readers[r]) {
+      size_t producer = TextureHandle::kInvalid;
+      for (const size_t writer : resourceWriters) {
+        if (writer < reader) {
+          producer = writer;
+        }
+      }
+      const bool readsEarlierVersion = producer != TextureHandle::kInvalid;
+      if (!readsEarlierVersion && !resourceWriters.empty()) {
+        producer = resourceWriters.back();
+      }
+      if (producer != TextureHandle::kInvalid) {
+        addEdge(producer, reader);
+      }
+      if (readsEarlierVersion) {
+        for (const size_t writer : resourceWriters) {
+          if (writer > reader) {
+            addEdge(reader, writer);
+            break;
+          }
+        }
+      }
+    }
+  }
+
+  // Culling: keep passes with side effects or writes the outside world can observe, plus
+  // (transitively) every writer of anything a kept pass touches. Writes are included because a
+  // pass may load the previous contents of its targets
+  std::vector<uint8_t> alive(passCount, 0);
+  for (size_t pass = 0; pass < passCount; ++pass) {
+    if (passes_[pass].hasSideEffects) {
+      alive[pass] = 1;
+      continue;
+    }
+    for (const TextureHandle handle : passes_[pass].writes) {
+      if (handle.valid() && handle.index < textureCount && textures_[handle.index].imported) {
+        alive[pass] = 1;
+        break;
+      }
+    }
+  }
+  for (bool changed = true; changed;) {
+    changed = false;
+    for (size_t pass = 0; pass < passCount; ++pass) {
+      if (!alive[pass]) {
+        continue;
+      }
+      const auto markWriters = [&](const std::vector<TextureHandle>& handles) {
+        for (const TextureHandle handle : handles) {
+          if (!handle.valid() || handle.index >= textureCount) {
+            continue;
+          }
+          for (const size_t writer : writers[handle.index]) {
+            if (!alive[writer]) {
+              alive[writer] = 1;
+              changed = true;
+            }
+          }
+        }
+      };
+      markWriters(passes_[pass].reads);
+      markWriters(passes_[pass].writes);
+    }
+  }
+
+  size_t aliveCount = 0;
+  for (size_t pass = 0; pass < passCount; ++pass) {
+    aliveCount += alive[pass];
+  }
+  lastCulledPassCount_ = passCount - aliveCount;
+  if (aliveCount == 0) {
+    finishFrame();
+    igl::Result::setOk(outResult);
+    return nullptr;
+  }
+
+  // Topological order (Kahn's algorithm, lowest insertion index first so independent passes keep
+  // their recording order), then filtered down to the alive passes
+  std::vector<size_t> order;
+  order.reserve(aliveCount);
+  {
+    std::vector<size_t> remainingDegree = inDegree;
+    std::vector<uint8_t> emitted(passCount, 0);
+    for (size_t emittedCount = 0; emittedCount < passCount;) {
+      size_t next = TextureHandle::kInvalid;
+      for (size_t pass = 0; pass < passCount; ++pass) {
+        if (!emitted[pass] && remainingDegree[pass] == 0) {
+          next = pass;
+          break;
+        }
+      }
+      if (next == TextureHandle::kInvalid) {
+        finishFrame();
+        igl::Result::setResult(outResult,
+                               igl::Result::Code::InvalidOperation,
+                               "RenderGraph: pass dependencies form a cycle");
+        return nullptr;
+      }
+      emitted[next] = 1;
+      ++emittedCount;
+      for (const size_t successor : adjacency[next]) {
+        --remainingDegree[successor];
+      }
+      if (alive[next]) {
+        order.push_back(next);
+      }
+    }
+  }
+
+  // transient lifetimes: the span of ordered positions that touch each resource. Allocations
+  // happen at the first position and are released after the last, so textures with disjoint
+  // spans share pool entries within the frame
+  std::vector<size_t> firstUse(textureCount, TextureHandle::kInvalid);
+  std::vector<size_t> lastUse(textureCount, TextureHandle::kInvalid);
+  for (size_t position = 0; position < order.size(); ++position) {
+    const auto touch = [&](const std::vector<TextureHandle>& handles) {
+      for (const TextureHandle handle : handles) {
+        if (!handle.valid() || handle.index >= textureCount ||
+            textures_[handle.index].imported) {
+          continue;
+        }
+        if (firstUse[handle.index] == TextureHandle::kInvalid) {
+          firstUse[handle.index] = position;
+        }
+        lastUse[handle.index] = position;
+      }
+    };
+    touch(passes_[order[position]].reads);
+    touch(passes_[order[position]].writes);
+  }
+
+  igl::Result ret;
+  auto cmdBuffer = queue.createCommandBuffer(igl::CommandBufferDesc(), &ret);
+  if (!ret.isOk() || cmdBuffer == nullptr) {
+    finishFrame();
+    if (outResult) {
+      *outResult = ret;
+    }
+    return nullptr;
+  }
+
+  PassResources resources(*this);
+  for (size_t position = 0; position < order.size(); ++position) {
+    for (size_t r = 0; r < textureCount; ++r) {
+      if (firstUse[r] == position) {
+        textures_[r].texture = transientPool_.acquireTexture(textures_[r].desc, &ret);
+        if (!ret.isOk() || textures_[r].texture == nullptr) {
+          finishFrame();
+          if (outResult) {
+            *outResult = ret;
+          }
+          return nullptr;
+        }
+      }
+    }
+
+    passes_[order[position]].encode(resources, *cmdBuffer);
+
+    // drop our reference after the last pass that touches the texture, so a transient declared
+    // later in the frame can reuse the allocation
+    for (size_t r = 0; r < textureCount; ++r) {
+      if (lastUse[r] == position && !textures_[r].imported) {
+        textures_[r].texture = nullptr;
+      }
+    }
+  }
+
+  queue.submit(*cmdBuffer);
+  finishFrame();
+  igl::Result::setOk(outResult);
+  return cmdBuffer;
+}
+
+} // namespace iglu::render_graph
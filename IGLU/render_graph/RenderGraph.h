@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <igl/CommandBuffer.h>
+#include <igl/CommandQueue.h>
+#include <igl/Texture.h>
+#include <igl/TransientResourcePool.h>
+
+namespace igl {
+class IDevice;
+} // namespace igl
+
+namespace iglu::render_graph {
+
+/// Opaque handle to a texture declared on (or imported into) a RenderGraph. Handles are only
+/// meaningful for the graph that issued them and only until the next execute().
+struct TextureHandle {
+  static constexpr size_t kInvalid = ~static_cast<size_t>(0);
+
+  size_t index = kInvalid;
+
+  [[nodiscard]] bool valid() const {
+    return index != kInvalid;
+  }
+};
+
+class RenderGraph;
+
+/// Resolves the handles of the pass being encoded to the concrete resources the graph picked for
+/// this execution. Only valid for the duration of the encode callback it is passed to.
+class PassResources {
+ public:
+  /// Returns the texture behind `handle`. Transient textures exist only while some pass between
+  /// their first and last use is being encoded; asking for a handle outside the declared
+  /// read/write sets of the current pass is a programming error.
+  [[nodiscard]] const std::shared_ptr<igl::ITexture>& texture(TextureHandle handle) const;
+
+ private:
+  friend class RenderGraph;
+  explicit PassResources(const RenderGraph& graph) : graph_(graph) {}
+  const RenderGraph& graph_;
+};
+
+/// Declarative pass scheduling above ICommandBuffer. Passes declare the textures they read and
+/// write; execute() then culls passes nothing observes, orders the rest by their data
+/// dependencies, allocates transient textures from a TransientResourcePool for exactly the span
+/// of passes that touch them (so non-overlapping lifetimes share allocations), and encodes
+/// everything into one command buffer.
+///
+/// Synchronization stays where IGL already puts it: the backends emit their own transitions at
+/// pass boundaries (the Vulkan backend batches them), so the graph's job is ordering the passes
+/// such that each dependency needs exactly one transition. Encoding is single-threaded because
+/// command buffer encoding is thread-confined by contract in every backend; independent passes
+/// are encoded back to back instead of in parallel.
+///
+/// Multiple writers of the same texture execute in the order they were added. A reader executes
+/// after every writer added before it; a reader added before any writer of its input is
+/// conservatively ordered after all of them. Declare producers before their consumers for
+/// precise placement.
+///
+/// Build the graph every frame and call execute(); the transient pool persists across frames so
+/// steady-state frames allocate nothing. The graph is not thread-safe.
+class RenderGraph {
+ public:
+  using EncodeFn = std::function<void(PassResources&, igl::ICommandBuffer&)>;
+
+  struct PassDesc {
+    std::string name;
+    std::vector<TextureHandle> reads;
+    std::vector<TextureHandle> writes;
+    /// Passes whose observable effect is not a declared write (presenting, CPU readback,
+    /// queries) must set this so culling keeps them. Writes to imported textures count as
+    /// observable on their own.
+    bool hasSideEffects = false;
+    EncodeFn encode;
+  };
+
+  explicit RenderGraph(igl::IDevice& device);
+
+  /// Declares a transient texture. The graph allocates it from its pool right before the first
+  /// pass that uses it and releases it after the last one, so textures with disjoint pass spans
+  /// reuse the same allocation. Contents are undefined before the first write.
+  TextureHandle declareTexture(const igl::TextureDesc& desc);
+
+  /// Imports an externally owned texture (typically the swapchain drawable) so passes can
+  /// declare reads and writes against it. The graph never allocates or releases it.
+  TextureHandle importTexture(std::shared_ptr<igl::ITexture> texture);
+
+  /// Records a pass. Order of addition only matters between passes whose declared sets overlap.
+  void addPass(PassDesc desc);
+
+  /// Culls, orders, allocates, encodes, and submits. Returns the submitted command buffer, or
+  /// nullptr when every pass was culled or the declared dependencies are cyclic (reported
+  /// through `outResult`). Recorded passes and declared resources are cleared; the transient
+  /// pool is kept and advanced one frame.
+  std::shared_ptr<igl::ICommandBuffer> execute(igl::ICommandQueue& queue,
+                                               igl::Result* IGL_NULLABLE outResult = nullptr);
+
+  /// Number of passes recorded since the last execute().
+  [[nodiscard]] size_t getPassCount() const {
+    return passes_.size();
+  }
+
+  /// Number of passes the last execute() culled.
+  [[nodiscard]] size_t getLastCulledPassCount() const {
+    return lastCulledPassCount_;
+  }
+
+  /// The pool backing transient textures; exposed for eviction tuning and memory-pressure
+  /// purges.
+  [[nodiscard]] igl::TransientResourcePool& getTransientPool() {
+    return transientPool_;
+  }
+
+ private:
+  friend class PassResources;
+
+  struct TextureResource {
+    igl::TextureDesc desc; // only meaningful for transient resources
+    std::shared_ptr<igl::ITexture> texture; // fixed for imported, bound during execute otherwise
+    bool imported = false;
+  };
+
+  igl::TransientResourcePool transientPool_;
+  std::vector<TextureResource> textures_;
+  std::vector<PassDesc> passes_;
+  size_t lastCulledPassCount_ = 0;
+};
+
+} // namespace iglu::render_graph
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <IGLU/sentinel/InstrumentedCommandQueue.h>
+
+#include <chrono>
+
+namespace iglu::sentinel {
+
+namespace {
+
+uint64_t elapsedNsSince(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() -
+                                                              start)
+      .count();
+}
+
+} // namespace
+
+InstrumentedCommandQueue::InstrumentedCommandQueue(std::shared_ptr<igl::ICommandQueue> commandQueue,
+                                                   std::shared_ptr<Profiler> profiler) :
+  commandQueue_(std::move(commandQueue)), profiler_(std::move(profiler)) {
+  IGL_ASSERT(commandQueue_ != nullptr);
+  IGL_ASSERT(profiler_ != nullptr);
+}
+
+std::shared_ptr<igl::ICommandBuffer> InstrumentedCommandQueue::createCommandBuffer(
+    const igl::CommandBufferDesc& desc,
+    igl::Result* IGL_NULLABLE outResult) {
+  if (!profiler_->isEnabled()) {
+    return commandQueue_->createCommandBuffer(desc, outResult);
+  }
+  const auto start = std::chrono::steady_clock::now();
+  auto commandBuffer = commandQueue_->createCommandBuffer(desc, outResult);
+  profiler_->recordCall("createCommandBuffer", elapsedNsSince(start));
+  if (commandBuffer) {
+    profiler_->recordCommandBufferCreation();
+  }
+  return commandBuffer;
+}
+
+igl::SubmitHandle InstrumentedCommandQueue::submit(const igl::ICommandBuffer& commandBuffer,
+                                                   bool endOfFrame) {
+  if (!profiler_->isEnabled()) {
+    return commandQueue_->submit(commandBuffer, endOfFrame);
+  }
+  const auto start = std::chrono::steady_clock::now();
+  const igl::SubmitHandle handle = commandQueue_->submit(commandBuffer, endOfFrame);
+  profiler_->recordCall("submit", elapsedNsSince(start));
+  profiler_->recordSubmit(endOfFrame);
+  return handle;
+}
+
+} // namespace iglu::sentinel
@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <IGLU/sentinel/Profiler.h>
+#include <igl/CommandQueue.h>
+
+#include <memory>
+
+namespace iglu::sentinel {
+
+/**
+ * Pass-through ICommandQueue decorator that forwards to a real backend queue while counting and
+ * timing createCommandBuffer and submit calls. A submit with endOfFrame set closes the profiler's
+ * current frame, so per-frame allocation statistics line up with real frames.
+ *
+ * InstrumentedDevice wraps queues it creates in this class automatically.
+ */
+class InstrumentedCommandQueue final : public igl::ICommandQueue {
+ public:
+  InstrumentedCommandQueue(std::shared_ptr<igl::ICommandQueue> commandQueue,
+                           std::shared_ptr<Profiler> profiler);
+
+  [[nodiscard]] std::shared_ptr<igl::ICommandBuffer> createCommandBuffer(
+      const igl::CommandBufferDesc& desc,
+      igl::Result* IGL_NULLABLE outResult) final;
+  igl::SubmitHandle submit(const igl::ICommandBuffer& commandBuffer, bool endOfFrame = false) final;
+
+ private:
+  std::shared_ptr<igl::ICommandQueue> commandQueue_;
+  std::shared_ptr<Profiler> profiler_;
+};
+
+} // namespace iglu::sentinel
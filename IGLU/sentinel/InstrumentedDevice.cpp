@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <IGLU/sentinel/InstrumentedDevice.h>
+
+#include <IGLU/sentinel/InstrumentedCommandQueue.h>
+#include <chrono>
+#include <igl/Buffer.h>
+
+namespace iglu::sentinel {
+
+namespace {
+
+// Times one forwarded call and records it on destruction. Recording is skipped entirely when the
+// profiler is disabled so the wrapper stays cheap enough to leave in production.
+class ScopedApiTimer {
+ public:
+  ScopedApiTimer(Profiler& profiler, const char* api) noexcept :
+    profiler_(profiler), api_(api), enabled_(profiler.isEnabled()) {
+    if (enabled_) {
+      start_ = std::chrono::steady_clock::now();
+    }
+  }
+
+  ~ScopedApiTimer() {
+    if (enabled_) {
+      const auto elapsed = std::chrono::steady_clock::now() - start_;
+      profiler_.recordCall(
+          api_, std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    }
+  }
+
+ private:
+  Profiler& profiler_;
+  const char* api_;
+  bool enabled_;
+  std::chrono::steady_clock::time_point start_;
+};
+
+} // namespace
+
+InstrumentedDevice::InstrumentedDevice(std::shared_ptr<igl::IDevice> device,
+                                       std::shared_ptr<Profiler> profiler) :
+  device_(std::move(device)), profiler_(std::move(profiler)) {
+  IGL_ASSERT(device_ != nullptr);
+  IGL_ASSERT(profiler_ != nullptr);
+}
+
+bool InstrumentedDevice::hasFeature(igl::DeviceFeatures feature) const {
+  return device_->hasFeature(feature);
+}
+
+bool InstrumentedDevice::hasRequirement(igl::DeviceRequirement requirement) const {
+  return device_->hasRequirement(requirement);
+}
+
+igl::ICapabilities::TextureFormatCapabilities InstrumentedDevice::getTextureFormatCapabilities(
+    igl::TextureFormat format) const {
+  return device_->getTextureFormatCapabilities(format);
+}
+
+bool InstrumentedDevice::getFeatureLimits(igl::DeviceFeatureLimits featureLimits,
+                                          size_t& result) const {
+  return device_->getFeatureLimits(featureLimits, result);
+}
+
+igl::ShaderVersion InstrumentedDevice::getShaderVersion() const {
+  return device_->getShaderVersion();
+}
+
+igl::Holder<igl::BindGroupHandle> InstrumentedDevice::createBindGroup(
+    const igl::BindGroupDesc& desc,
+    igl::Result* IGL_NULLABLE outResult) {
+  // Bind groups must live in the real device's pool so backend encoders can resolve the handles.
+  const ScopedApiTimer timer(*profiler_, "createBindGroup");
+  return device_->createBindGroup(desc, outResult);
+}
+
+void InstrumentedDevice::destroy(igl::BindGroupHandle handle) {
+  device_->destroy(handle);
+}
+
+std::shared_ptr<igl::IQueueEvent> InstrumentedDevice::createQueueEvent(
+    igl::Result* IGL_NULLABLE outResult) {
+  const ScopedApiTimer timer(*profiler_, "createQueueEvent");
+  return device_->createQueueEvent(outResult);
+}
+
+std::shared_ptr<igl::IQueryPool> InstrumentedDevice::createQueryPool(
+    const igl::QueryPoolDesc& desc,
+    igl::Result* IGL_NULLABLE outResult) {
+  const ScopedApiTimer timer(*profiler_, "createQueryPool");
+  return device_->createQueryPool(desc, outResult);
+}
+
+std::shared_ptr<igl::ICommandQueue> InstrumentedDevice::createCommandQueue(
+    const igl::CommandQueueDesc& desc,
+    igl::Result* IGL_NULLABLE outResult) {
+  const ScopedApiTimer timer(*profiler_, "createCommandQueue");
+  auto queue = device_->createCommandQueue(desc, outResult);
+  if (!queue) {
+    return nullptr;
+  }
+  return std::make_shared<InstrumentedCommandQueue>(std::move(queue), profiler_);
+}
+
+std::unique_ptr<igl::IBuffer> InstrumentedDevice::createBuffer(
+    const igl::BufferDesc& desc,
+    igl::Result* IGL_NULLABLE outResult) const noexcept {
+  const ScopedApiTimer timer(*profiler_, "createBuffer");
+  auto buffer = device_->createBuffer(desc, outResult);
+  if (buffer && profiler_->isEnabled()) {
+    profiler_->recordBufferAllocation(desc.length);
+  }
+  return buffer;
+}
+
+std::shared_ptr<igl::IDepthStencilState> InstrumentedDevice::createDepthStencilState(
+    const igl::DepthStencilStateDesc& desc,
+    igl::Result* IGL_NULLABLE outResult) const {
+  const ScopedApiTimer timer(*profiler_, "createDepthStencilState");
+  return device_->createDepthStencilState(desc, outResult);
+}
+
+std::shared_ptr<igl::ISamplerState> InstrumentedDevice::createSamplerState(
+    const igl::SamplerStateDesc& desc,
+    igl::Result* IGL_NULLABLE outResult) const {
+  const ScopedApiTimer timer(*profiler_, "createSamplerState");
+  return device_->createSamplerState(desc, outResult);
+}
+
+std::shared_ptr<igl::ITexture> InstrumentedDevice::createTexture(
+    const igl::TextureDesc& desc,
+    igl::Result* IGL_NULLABLE outResult) const noexcept {
+  const ScopedApiTimer timer(*profiler_, "createTexture");
+  auto texture = device_->createTexture(desc, outResult);
+  if (texture && profiler_->isEnabled()) {
+    profiler_->recordTextureAllocation();
+  }
+  return texture;
+}
+
+std::shared_ptr<igl::IVertexInputState> InstrumentedDevice::createVertexInputState(
+    const igl::VertexInputStateDesc& desc,
+    igl::Result* IGL_NULLABLE outResult) const {
+  const ScopedApiTimer timer(*profiler_, "createVertexInputState");
+  return device_->createVertexInputState(desc, outResult);
+}
+
+std::shared_ptr<igl::IComputePipelineState> InstrumentedDevice::createComputePipeline(
+    const igl::ComputePipelineDesc& desc,
+    igl::Result* IGL_NULLABLE outResult) const {
+  const ScopedApiTimer timer(*profiler_, "createComputePipeline");
+  return device_->createComputePipeline(desc, outResult);
+}
+
+std::shared_ptr<igl::IRenderPipelineState> InstrumentedDevice::createRenderPipeline(
+    const igl::RenderPipelineDesc& desc,
+    igl::Result* IGL_NULLABLE outResult) const {
+  const ScopedApiTimer timer(*profiler_, "createRenderPipeline");
+  return device_->createRenderPipeline(desc, outResult);
+}
+
+std::shared_ptr<igl::IShaderModule> InstrumentedDevice::createShaderModule(
+    const igl::ShaderModuleDesc& desc,
+    igl::Result* IGL_NULLABLE outResult) const {
+  const ScopedApiTimer timer(*profiler_, "createShaderModule");
+  return device_->createShaderModule(desc, outResult);
+}
+
+std::shared_ptr<igl::IFramebuffer> InstrumentedDevice::createFramebuffer(
+    const igl::FramebufferDesc& desc,
+    igl::Result* IGL_NULLABLE outResult) {
+  const ScopedApiTimer timer(*profiler_, "createFramebuffer");
+  return device_->createFramebuffer(desc, outResult);
+}
+
+const igl::IPlatformDevice& InstrumentedDevice::getPlatformDevice() const noexcept {
+  return device_->getPlatformDevice();
+}
+
+bool InstrumentedDevice::verifyScope() {
+  return device_->verifyScope();
+}
+
+igl::BackendType InstrumentedDevice::getBackendType() const {
+  return device_->getBackendType();
+}
+
+igl::NormalizedZRange InstrumentedDevice::getNormalizedZRange() const {
+  return device_->getNormalizedZRange();
+}
+
+size_t InstrumentedDevice::getCurrentDrawCount() const {
+  return device_->getCurrentDrawCount();
+}
+
+bool InstrumentedDevice::getMemoryStatistics(igl::DeviceMemoryStatistics& outStatistics) const {
+  return device_->getMemoryStatistics(outStatistics);
+}
+
+std::unique_ptr<igl::IShaderLibrary> InstrumentedDevice::createShaderLibrary(
+    const igl::ShaderLibraryDesc& desc,
+    igl::Result* IGL_NULLABLE outResult) const {
+  const ScopedApiTimer timer(*profiler_, "createShaderLibrary");
+  return device_->createShaderLibrary(desc, outResult);
+}
+
+void InstrumentedDevice::updateSurface(void* IGL_NONNULL nativeWindowType) {
+  device_->updateSurface(nativeWindowType);
+}
+
+std::unique_ptr<igl::IShaderStages> InstrumentedDevice::createShaderStages(
+    const igl::ShaderStagesDesc& desc,
+    igl::Result* IGL_NULLABLE outResult) const {
+  const ScopedApiTimer timer(*profiler_, "createShaderStages");
+  return device_->createShaderStages(desc, outResult);
+}
+
+} // namespace iglu::sentinel
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <IGLU/sentinel/Profiler.h>
+#include <igl/Device.h>
+
+namespace iglu::sentinel {
+
+/**
+ * Pass-through IDevice decorator that forwards every call to a real backend device while
+ * recording call counts, per-API wall time and allocation events into a Profiler. Unlike the
+ * assert-on-use sentinel Device, this wrapper is meant to sit in front of a live device in
+ * production so API-level costs can be measured without a GPU capture tool attached.
+ *
+ * Command queues created through this device are wrapped in InstrumentedCommandQueue so submits
+ * are counted and end-of-frame submits advance the profiler's frame.
+ */
+class InstrumentedDevice final : public igl::IDevice {
+ public:
+  InstrumentedDevice(std::shared_ptr<igl::IDevice> device, std::shared_ptr<Profiler> profiler);
+
+  [[nodiscard]] bool hasFeature(igl::DeviceFeatures feature) const final;
+  [[nodiscard]] bool hasRequirement(igl::DeviceRequirement requirement) const final;
+  [[nodiscard]] TextureFormatCapabilities getTextureFormatCapabilities(
+      igl::TextureFormat format) const final;
+  [[nodiscard]] bool getFeatureLimits(igl::DeviceFeatureLimits featureLimits,
+                                      size_t& result) const final;
+  [[nodiscard]] igl::ShaderVersion getShaderVersion() const final;
+  igl::Holder<igl::BindGroupHandle> createBindGroup(const igl::BindGroupDesc& desc,
+                                                    igl::Result* IGL_NULLABLE outResult) final;
+  void destroy(igl::BindGroupHandle handle) final;
+  [[nodiscard]] std::shared_ptr<igl::IQueueEvent> createQueueEvent(
+      igl::Result* IGL_NULLABLE outResult) final;
+  [[nodiscard]] std::shared_ptr<igl::IQueryPool> createQueryPool(
+      const igl::QueryPoolDesc& desc,
+      igl::Result* IGL_NULLABLE outResult) final;
+  [[nodiscard]] std::shared_ptr<igl::ICommandQueue> createCommandQueue(
+      const igl::CommandQueueDesc& desc,
+      igl::Result* IGL_NULLABLE outResult) final;
+  [[nodiscard]] std::unique_ptr<igl::IBuffer> createBuffer(const igl::BufferDesc& desc,
+                                                           igl::Result* IGL_NULLABLE
+                                                               outResult) const noexcept final;
+  [[nodiscard]] std::shared_ptr<igl::IDepthStencilState> createDepthStencilState(
+      const igl::DepthStencilStateDesc& desc,
+      igl::Result* IGL_NULLABLE outResult) const final;
+  [[nodiscard]] std::shared_ptr<igl::ISamplerState> createSamplerState(
+      const igl::SamplerStateDesc& desc,
+      igl::Result* IGL_NULLABLE outResult) const final;
+  [[nodiscard]] std::shared_ptr<igl::ITexture> createTexture(const igl::TextureDesc& desc,
+                                                             igl::Result* IGL_NULLABLE
+                                                                 outResult) const noexcept final;
+  [[nodiscard]] std::shared_ptr<igl::IVertexInputState> createVertexInputState(
+      const igl::VertexInputStateDesc& desc,
+      igl::Result* IGL_NULLABLE outResult) const final;
+  [[nodiscard]] std::shared_ptr<igl::IComputePipelineState> createComputePipeline(
+      const igl::ComputePipelineDesc& desc,
+      igl::Result* IGL_NULLABLE outResult) const final;
+  [[nodiscard]] std::shared_ptr<igl::IRenderPipelineState> createRenderPipeline(
+      const igl::RenderPipelineDesc& desc,
+      igl::Result* IGL_NULLABLE outResult) const final;
+  [[nodiscard]] std::shared_ptr<igl::IShaderModule> createShaderModule(
+      const igl::ShaderModuleDesc& desc,
+      igl::Result* IGL_NULLABLE outResult) const final;
+  [[nodiscard]] std::shared_ptr<igl::IFramebuffer> createFramebuffer(
+      const igl::FramebufferDesc& desc,
+      igl::Result* IGL_NULLABLE outResult) final;
+  [[nodiscard]] const igl::IPlatformDevice& getPlatformDevice() const noexcept final;
+  [[nodiscard]] bool verifyScope() final;
+  [[nodiscard]] igl::BackendType getBackendType() const final;
+  [[nodiscard]] igl::NormalizedZRange getNormalizedZRange() const final;
+  [[nodiscard]] size_t getCurrentDrawCount() const final;
+  [[nodiscard]] bool getMemoryStatistics(igl::DeviceMemoryStatistics& outStatistics) const final;
+  [[nodiscard]] std::unique_ptr<igl::IShaderLibrary> createShaderLibrary(
+      const igl::ShaderLibraryDesc& desc,
+      igl::Result* IGL_NULLABLE outResult) const final;
+  void updateSurface(void* IGL_NONNULL nativeWindowType) final;
+  [[nodiscard]] std::unique_ptr<igl::IShaderStages> createShaderStages(
+      const igl::ShaderStagesDesc& desc,
+      igl::Result* IGL_NULLABLE outResult) const final;
+
+  [[nodiscard]] const std::shared_ptr<Profiler>& profiler() const noexcept {
+    return profiler_;
+  }
+
+ private:
+  std::shared_ptr<igl::IDevice> device_;
+  std::shared_ptr<Profiler> profiler_;
+};
+
+} // namespace iglu::sentinel
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <IGLU/sentinel/Profiler.h>
+
+namespace iglu::sentinel {
+
+void Profiler::recordCall(const char* api, uint64_t elapsedNs) {
+  const std::lock_guard<std::mutex> guard(mutex_);
+  auto& stats = apiStats_[api];
+  ++stats.callCount;
+  stats.totalTimeNs += elapsedNs;
+}
+
+void Profiler::recordBufferAllocation(size_t numBytes) {
+  const std::lock_guard<std::mutex> guard(mutex_);
+  ++currentFrame_.buffersCreated;
+  currentFrame_.bufferBytes += numBytes;
+}
+
+void Profiler::recordTextureAllocation() {
+  const std::lock_guard<std::mutex> guard(mutex_);
+  ++currentFrame_.texturesCreated;
+}
+
+void Profiler::recordCommandBufferCreation() {
+  const std::lock_guard<std::mutex> guard(mutex_);
+  ++currentFrame_.commandBuffersCreated;
+}
+
+void Profiler::recordSubmit(bool endOfFrame) {
+  const std::lock_guard<std::mutex> guard(mutex_);
+  ++currentFrame_.submits;
+  if (endOfFrame) {
+    lastFrame_ = currentFrame_;
+    currentFrame_ = FrameStats();
+    ++frameCount_;
+  }
+}
+
+std::unordered_map<std::string, Profiler::ApiStats> Profiler::apiStats() const {
+  const std::lock_guard<std::mutex> guard(mutex_);
+  return apiStats_;
+}
+
+Profiler::FrameStats Profiler::currentFrameStats() const {
+  const std::lock_guard<std::mutex> guard(mutex_);
+  return currentFrame_;
+}
+
+Profiler::FrameStats Profiler::lastFrameStats() const {
+  const std::lock_guard<std::mutex> guard(mutex_);
+  return lastFrame_;
+}
+
+uint64_t Profiler::frameCount() const {
+  const std::lock_guard<std::mutex> guard(mutex_);
+  return frameCount_;
+}
+
+void Profiler::reset() {
+  const std::lock_guard<std::mutex> guard(mutex_);
+  apiStats_.clear();
+  currentFrame_ = FrameStats();
+  lastFrame_ = FrameStats();
+  frameCount_ = 0;
+}
+
+} // namespace iglu::sentinel
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace iglu::sentinel {
+
+/**
+ * Collects API-level statistics recorded by InstrumentedDevice and InstrumentedCommandQueue:
+ * per-API call counts and accumulated wall time, plus per-frame allocation events. A frame ends
+ * when a command buffer is submitted with endOfFrame set.
+ *
+ * Recording is thread safe and can be toggled at runtime; when disabled the instrumented wrappers
+ * forward without timing, so the profiler can stay wired up in production builds.
+ */
+class Profiler final {
+ public:
+  struct ApiStats {
+    uint64_t callCount = 0;
+    uint64_t totalTimeNs = 0;
+  };
+
+  struct FrameStats {
+    uint64_t buffersCreated = 0;
+    uint64_t bufferBytes = 0;
+    uint64_t texturesCreated = 0;
+    uint64_t commandBuffersCreated = 0;
+    uint64_t submits = 0;
+  };
+
+  void setEnabled(bool enabled) noexcept {
+    enabled_.store(enabled, std::memory_order_relaxed);
+  }
+
+  [[nodiscard]] bool isEnabled() const noexcept {
+    return enabled_.load(std::memory_order_relaxed);
+  }
+
+  void recordCall(const char* api, uint64_t elapsedNs);
+  void recordBufferAllocation(size_t numBytes);
+  void recordTextureAllocation();
+  void recordCommandBufferCreation();
+  void recordSubmit(bool endOfFrame);
+
+  /** Per-API call counts and accumulated wall time since the last reset. */
+  [[nodiscard]] std::unordered_map<std::string, ApiStats> apiStats() const;
+  /** Allocation events recorded in the frame currently being built. */
+  [[nodiscard]] FrameStats currentFrameStats() const;
+  /** Allocation events recorded in the most recently completed frame. */
+  [[nodiscard]] FrameStats lastFrameStats() const;
+  /** Number of completed frames (end-of-frame submits) since the last reset. */
+  [[nodiscard]] uint64_t frameCount() const;
+
+  void reset();
+
+ private:
+  mutable std::mutex mutex_;
+  std::atomic<bool> enabled_{true};
+  std::unordered_map<std::string, ApiStats> apiStats_;
+  FrameStats currentFrame_;
+  FrameStats lastFrame_;
+  uint64_t frameCount_ = 0;
+};
+
+} // namespace iglu::sentinel
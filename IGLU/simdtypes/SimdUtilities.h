@@ -10,6 +10,18 @@
 #include <IGLU/simdtypes/SimdTypes.h>
 #include <cmath>
 
+// Detect SIMD intrinsics for the non-Apple path. Every x86-64 target has SSE; MSVC does not
+// define __SSE__ so check its architecture macros too.
+#if !defined(__APPLE__)
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define IGLU_SIMDTYPES_HAS_SSE 1
+#include <xmmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#define IGLU_SIMDTYPES_HAS_NEON 1
+#include <arm_neon.h>
+#endif
+#endif // !defined(__APPLE__)
+
 namespace iglu {
 namespace simdtypes {
 
@@ -37,8 +49,40 @@ inline float4x4 multiply(const float4x4& m1, const float4x4& m2) {
   return simd_mul(m1, m2);
 }
 
+inline float4x4 transpose(const float4x4& m) {
+  return simd_transpose(m);
+}
+
+inline float4 normalize(const float4& v) {
+  return simd_normalize(v);
+}
+
 #else
 
+#if IGLU_SIMDTYPES_HAS_SSE
+// float4 is only guaranteed 4-byte alignment when it falls back to a plain struct (MSVC), so use
+// the unaligned load/store forms; they cost nothing extra on any SSE hardware this code targets.
+inline __m128 loadFloat4(const float4& v) {
+  return _mm_loadu_ps(reinterpret_cast<const float*>(&v));
+}
+
+inline float4 storeFloat4(__m128 v) {
+  float4 result;
+  _mm_storeu_ps(reinterpret_cast<float*>(&result), v);
+  return result;
+}
+#elif IGLU_SIMDTYPES_HAS_NEON
+inline float32x4_t loadFloat4(const float4& v) {
+  return vld1q_f32(reinterpret_cast<const float*>(&v));
+}
+
+inline float4 storeFloat4(float32x4_t v) {
+  float4 result;
+  vst1q_f32(reinterpret_cast<float*>(&result), v);
+  return result;
+}
+#endif
+
 inline float1 clamp(float1 x, float1 min, float1 max) {
   if (x < min) {
     return min;
@@ -188,6 +232,29 @@ inline float4x4 inverse(const float4x4& m) {
 
 // result = m * v;
 inline float4 multiply(const float4x4& m, const float4& v) {
+#if IGLU_SIMDTYPES_HAS_SSE
+  const __m128 vv = loadFloat4(v);
+  __m128 result =
+      _mm_mul_ps(loadFloat4(m.columns[0]), _mm_shuffle_ps(vv, vv, _MM_SHUFFLE(0, 0, 0, 0)));
+  result = _mm_add_ps(
+      result,
+      _mm_mul_ps(loadFloat4(m.columns[1]), _mm_shuffle_ps(vv, vv, _MM_SHUFFLE(1, 1, 1, 1))));
+  result = _mm_add_ps(
+      result,
+      _mm_mul_ps(loadFloat4(m.columns[2]), _mm_shuffle_ps(vv, vv, _MM_SHUFFLE(2, 2, 2, 2))));
+  result = _mm_add_ps(
+      result,
+      _mm_mul_ps(loadFloat4(m.columns[3]), _mm_shuffle_ps(vv, vv, _MM_SHUFFLE(3, 3, 3, 3))));
+  return storeFloat4(result);
+#elif IGLU_SIMDTYPES_HAS_NEON
+  // vmulq_n/vmlaq_n keep this valid on both ARMv7 and AArch64.
+  const float32x4_t vv = loadFloat4(v);
+  float32x4_t result = vmulq_n_f32(loadFloat4(m.columns[0]), vgetq_lane_f32(vv, 0));
+  result = vmlaq_n_f32(result, loadFloat4(m.columns[1]), vgetq_lane_f32(vv, 1));
+  result = vmlaq_n_f32(result, loadFloat4(m.columns[2]), vgetq_lane_f32(vv, 2));
+  result = vmlaq_n_f32(result, loadFloat4(m.columns[3]), vgetq_lane_f32(vv, 3));
+  return storeFloat4(result);
+#else
   float4 result;
   result[0] = m.columns[0][0] * v[0] + m.columns[1][0] * v[1] + m.columns[2][0] * v[2] +
               m.columns[3][0] * v[3];
@@ -198,6 +265,7 @@ inline float4 multiply(const float4x4& m, const float4& v) {
   result[3] = m.columns[0][3] * v[0] + m.columns[1][3] * v[1] + m.columns[2][3] * v[2] +
               m.columns[3][3] * v[3];
   return result;
+#endif
 }
 
 // result = m1 * m2
@@ -209,6 +277,64 @@ inline float4x4 multiply(const float4x4& m1, const float4x4& m2) {
   result.columns[3] = multiply(m1, m2.columns[3]);
   return result;
 }
+
+inline float4x4 transpose(const float4x4& m) {
+#if IGLU_SIMDTYPES_HAS_SSE
+  __m128 c0 = loadFloat4(m.columns[0]);
+  __m128 c1 = loadFloat4(m.columns[1]);
+  __m128 c2 = loadFloat4(m.columns[2]);
+  __m128 c3 = loadFloat4(m.columns[3]);
+  _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+  return {storeFloat4(c0), storeFloat4(c1), storeFloat4(c2), storeFloat4(c3)};
+#elif IGLU_SIMDTYPES_HAS_NEON
+  const float32x4x2_t t01 = vtrnq_f32(loadFloat4(m.columns[0]), loadFloat4(m.columns[1]));
+  const float32x4x2_t t23 = vtrnq_f32(loadFloat4(m.columns[2]), loadFloat4(m.columns[3]));
+  return {
+      storeFloat4(vcombine_f32(vget_low_f32(t01.val[0]), vget_low_f32(t23.val[0]))),
+      storeFloat4(vcombine_f32(vget_low_f32(t01.val[1]), vget_low_f32(t23.val[1]))),
+      storeFloat4(vcombine_f32(vget_high_f32(t01.val[0]), vget_high_f32(t23.val[0]))),
+      storeFloat4(vcombine_f32(vget_high_f32(t01.val[1]), vget_high_f32(t23.val[1]))),
+  };
+#else
+  float4x4 result;
+  for (int i = 0; i < 4; i++) {
+    for (int j = 0; j < 4; j++) {
+      result.columns[i][j] = m.columns[j][i];
+    }
+  }
+  return result;
+#endif
+}
+
+inline float4 normalize(const float4& v) {
+#if IGLU_SIMDTYPES_HAS_SSE
+  const __m128 vv = loadFloat4(v);
+  __m128 dot = _mm_mul_ps(vv, vv);
+  dot = _mm_add_ps(dot, _mm_shuffle_ps(dot, dot, _MM_SHUFFLE(2, 3, 0, 1)));
+  dot = _mm_add_ps(dot, _mm_shuffle_ps(dot, dot, _MM_SHUFFLE(1, 0, 3, 2)));
+  return storeFloat4(_mm_div_ps(vv, _mm_sqrt_ps(dot)));
+#elif IGLU_SIMDTYPES_HAS_NEON
+  const float32x4_t vv = loadFloat4(v);
+  const float32x4_t prod = vmulq_f32(vv, vv);
+  float32x2_t sum = vadd_f32(vget_low_f32(prod), vget_high_f32(prod));
+  sum = vpadd_f32(sum, sum);
+  const float32x4_t dot = vcombine_f32(sum, sum);
+  // vrsqrte is only an estimate; two Newton-Raphson steps bring it to full precision, and this
+  // stays valid on ARMv7 where there is no vector sqrt.
+  float32x4_t invLength = vrsqrteq_f32(dot);
+  invLength = vmulq_f32(invLength, vrsqrtsq_f32(vmulq_f32(dot, invLength), invLength));
+  invLength = vmulq_f32(invLength, vrsqrtsq_f32(vmulq_f32(dot, invLength), invLength));
+  return storeFloat4(vmulq_f32(vv, invLength));
+#else
+  const float length = sqrtf(v[0] * v[0] + v[1] * v[1] + v[2] * v[2] + v[3] * v[3]);
+  float4 result;
+  result[0] = v[0] / length;
+  result[1] = v[1] / length;
+  result[2] = v[2] / length;
+  result[3] = v[3] / length;
+  return result;
+#endif
+}
 #endif
 } // namespace simdtypes
 } // namespace iglu
@@ -20,7 +20,8 @@ void Drawable::draw(igl::IDevice& device,
                     igl::IRenderCommandEncoder& commandEncoder,
                     const igl::RenderPipelineDesc& pipelineDesc,
                     size_t pushConstantsDataSize,
-                    const void* pushConstantsData) {
+                    const void* pushConstantsData,
+                    uint32_t instanceCount) {
   // Assumption: _vertexData and _material are immutable
   size_t pipelineDescHash = std::hash<igl::RenderPipelineDesc>()(pipelineDesc);
   if (!_pipelineState || pipelineDescHash != _lastPipelineDescHash) {
@@ -40,7 +41,7 @@ void Drawable::draw(igl::IDevice& device,
     commandEncoder.bindPushConstants(pushConstantsData, pushConstantsDataSize);
   }
 
-  _vertexData->draw(commandEncoder);
+  _vertexData->draw(commandEncoder, instanceCount);
 }
 
 } // namespace drawable
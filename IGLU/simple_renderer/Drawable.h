@@ -26,7 +26,16 @@ class Drawable final {
             igl::IRenderCommandEncoder& commandEncoder,
             const igl::RenderPipelineDesc& pipelineDesc,
             size_t pushConstantsDataSize = 0,
-            const void* pushConstantsData = nullptr);
+            const void* pushConstantsData = nullptr,
+            uint32_t instanceCount = 1);
+
+  const std::shared_ptr<vertexdata::VertexData>& vertexData() const {
+    return _vertexData;
+  }
+
+  const std::shared_ptr<material::Material>& material() const {
+    return _material;
+  }
 
   /// A Drawable is "immutable" in that there's no API to modify its inputs after
   /// creation. They're lightweight objects and should be recreated instead of updated.
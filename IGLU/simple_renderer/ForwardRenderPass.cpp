@@ -7,6 +7,8 @@
 
 #include "ForwardRenderPass.h"
 
+#include <algorithm>
+#include <cstring>
 #include <utility>
 
 namespace iglu {
@@ -54,6 +56,86 @@ void ForwardRenderPass::draw(drawable::Drawable& drawable, igl::IDevice& device)
   drawable.draw(device, *_commandEncoder, _renderPipelineDesc);
 }
 
+void ForwardRenderPass::drawQueued(std::shared_ptr<drawable::Drawable> drawable,
+                                   const iglu::simdtypes::float4x4& transform) {
+  IGL_ASSERT_MSG(isActive(), "Drawing not in progress");
+  _queuedDraws.push_back({std::move(drawable), transform});
+}
+
+void ForwardRenderPass::flushQueuedDraws(igl::IDevice& device, int instanceBufferIndex) {
+  IGL_ASSERT_MSG(isActive(), "Drawing not in progress");
+  if (_queuedDraws.empty()) {
+    return;
+  }
+
+  // A stable sort clusters drawables sharing a pipeline while keeping submission order within
+  // each group
+  std::stable_sort(_queuedDraws.begin(),
+                   _queuedDraws.end(),
+                   [](const QueuedDraw& a, const QueuedDraw& b) {
+                     const auto* materialA = a.drawable->material().get();
+                     const auto* materialB = b.drawable->material().get();
+                     if (materialA != materialB) {
+                       return materialA < materialB;
+                     }
+                     return a.drawable->vertexData().get() < b.drawable->vertexData().get();
+                   });
+
+  // Pack each group's transforms contiguously; groups start at aligned offsets so they can be
+  // bound with a plain buffer offset
+  constexpr size_t kOffsetAlignment = 256;
+  struct Group {
+    size_t firstDraw = 0;
+    uint32_t instanceCount = 0;
+    size_t byteOffset = 0;
+  };
+  std::vector<Group> groups;
+  std::vector<uint8_t> instanceData;
+  for (size_t i = 0; i < _queuedDraws.size();) {
+    const auto& first = *_queuedDraws[i].drawable;
+    size_t end = i + 1;
+    while (end < _queuedDraws.size() &&
+           _queuedDraws[end].drawable->material() == first.material() &&
+           _queuedDraws[end].drawable->vertexData() == first.vertexData()) {
+      end++;
+    }
+
+    const size_t offset =
+        ((instanceData.size() + kOffsetAlignment - 1) / kOffsetAlignment) * kOffsetAlignment;
+    instanceData.resize(offset + (end - i) * sizeof(iglu::simdtypes::float4x4));
+    for (size_t draw = i; draw < end; ++draw) {
+      memcpy(instanceData.data() + offset + (draw - i) * sizeof(iglu::simdtypes::float4x4),
+             &_queuedDraws[draw].transform,
+             sizeof(iglu::simdtypes::float4x4));
+    }
+
+    groups.push_back({i, static_cast<uint32_t>(end - i), offset});
+    i = end;
+  }
+
+  if (!_instanceBuffer || _instanceBuffer->getSizeInBytes() < instanceData.size()) {
+    const igl::BufferDesc desc(igl::BufferDesc::BufferTypeBits::Storage,
+                               nullptr,
+                               instanceData.size(),
+                               igl::ResourceStorage::Shared);
+    _instanceBuffer = device.createBuffer(desc, nullptr);
+  }
+  if (!IGL_VERIFY(_instanceBuffer)) {
+    _queuedDraws.clear();
+    return;
+  }
+  _instanceBuffer->upload(instanceData.data(), igl::BufferRange(instanceData.size(), 0));
+
+  for (const auto& group : groups) {
+    _commandEncoder->bindBuffer(
+        instanceBufferIndex, igl::BindTarget::kVertex, _instanceBuffer, group.byteOffset);
+    _queuedDraws[group.firstDraw].drawable->draw(
+        device, *_commandEncoder, _renderPipelineDesc, 0, nullptr, group.instanceCount);
+  }
+
+  _queuedDraws.clear();
+}
+
 void ForwardRenderPass::end(bool shouldPresent) {
   IGL_ASSERT_MSG(isActive(), "Drawing not in progress");
 
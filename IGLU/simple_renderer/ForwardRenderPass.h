@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <IGLU/simdtypes/SimdTypes.h>
 #include <IGLU/simple_renderer/Drawable.h>
 #include <igl/IGL.h>
 #include <memory>
@@ -30,6 +31,18 @@ class ForwardRenderPass final {
   /// Call once per drawable.
   void draw(drawable::Drawable& drawable, igl::IDevice& device) const;
 
+  /// Instancing-aware submission: queues 'drawable' with its per-instance transform instead of
+  /// drawing it immediately. Drawables sharing the same Material and VertexData are merged into
+  /// one instanced draw by flushQueuedDraws().
+  void drawQueued(std::shared_ptr<drawable::Drawable> drawable,
+                  const iglu::simdtypes::float4x4& transform);
+
+  /// Stable-sorts the queue by material then vertex data to minimize pipeline switches, uploads
+  /// all per-instance transforms into an internal instance buffer in one copy, and issues one
+  /// instanced draw per group. Each group's transforms are bound as a vertex-stage buffer at
+  /// 'instanceBufferIndex'; shaders index them with the instance id. Clears the queue.
+  void flushQueuedDraws(igl::IDevice& device, int instanceBufferIndex);
+
   /// Call after all drawing within this render pass is finished. The 'present'
   /// parameter controls whether to present the target framebuffer and must be set
   /// to true exactly once per frame, when targeting the "onscreen" framebuffer.
@@ -58,6 +71,13 @@ class ForwardRenderPass final {
 
   std::shared_ptr<igl::ICommandBuffer> _commandBuffer;
   std::unique_ptr<igl::IRenderCommandEncoder> _commandEncoder;
+
+  struct QueuedDraw {
+    std::shared_ptr<drawable::Drawable> drawable;
+    iglu::simdtypes::float4x4 transform;
+  };
+  std::vector<QueuedDraw> _queuedDraws;
+  std::shared_ptr<igl::IBuffer> _instanceBuffer;
 };
 
 } // namespace renderpass
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "MaterialParameterBlock.h"
+
+#include <cstring>
+#include <utility>
+
+namespace iglu {
+namespace material {
+namespace {
+
+uint8_t bindTargetForShaderStage(igl::ShaderStage stage) {
+  switch (stage) {
+  case igl::ShaderStage::Vertex:
+    return igl::BindTarget::kVertex;
+  case igl::ShaderStage::Fragment:
+  default:
+    return igl::BindTarget::kFragment;
+  }
+}
+
+} // namespace
+
+std::unique_ptr<MaterialParameterBlock> MaterialParameterBlock::create(
+    const igl::IRenderPipelineReflection& reflection,
+    const igl::NameHandle& blockName,
+    igl::Result* outResult) {
+  for (const igl::BufferArgDesc& bufferDesc : reflection.allUniformBuffers()) {
+    if (bufferDesc.name != blockName) {
+      continue;
+    }
+    auto layout = igl::UniformBlockLayout::getOrCreate(bufferDesc);
+    if (!layout || layout->dataSize == 0) {
+      break;
+    }
+    igl::Result::setOk(outResult);
+    return std::unique_ptr<MaterialParameterBlock>(
+        new MaterialParameterBlock(std::move(layout), bufferDesc.shaderStage));
+  }
+  igl::Result::setResult(outResult,
+                         igl::Result::Code::RuntimeError,
+                         "No uniform buffer named '" + blockName.toString() + "' in reflection");
+  return nullptr;
+}
+
+std::unique_ptr<MaterialParameterBlock> MaterialParameterBlock::create(
+    const ShaderProgram& shaderProgram,
+    const igl::NameHandle& blockName,
+    igl::Result* outResult) {
+  return create(shaderProgram.renderPipelineReflection(), blockName, outResult);
+}
+
+MaterialParameterBlock::MaterialParameterBlock(
+    std::shared_ptr<const igl::UniformBlockLayout> layout,
+    igl::ShaderStage shaderStage) :
+  _layout(std::move(layout)), _shaderStage(shaderStage), _snapshot(_layout->dataSize, 0) {}
+
+int MaterialParameterBlock::memberIndex(const char* memberName) const {
+  return _layout->findMember(memberName);
+}
+
+void MaterialParameterBlock::setMemberBytes(int memberIndex,
+                                            const void* data,
+                                            size_t size,
+                                            size_t arrayIndex) {
+  if (!IGL_VERIFY(memberIndex >= 0 &&
+                  static_cast<size_t>(memberIndex) < _layout->members.size())) {
+    return;
+  }
+  const igl::UniformBlockLayout::Member& member = _layout->members[memberIndex];
+  const size_t elementSize = member.arrayLength > 0 ? member.size / member.arrayLength : 0;
+  const size_t offset = member.offset + arrayIndex * elementSize;
+  if (!IGL_VERIFY(offset + size <= member.offset + member.size &&
+                  offset + size <= _snapshot.size())) {
+    return;
+  }
+  std::memcpy(_snapshot.data() + offset, data, size);
+}
+
+void MaterialParameterBlock::bind(igl::IDevice& device,
+                                  igl::IRenderCommandEncoder& encoder,
+                                  const std::shared_ptr<igl::IBuffer>& buffer,
+                                  size_t bufferOffset) const {
+  const uint8_t bindTarget = device.getBackendType() == igl::BackendType::Vulkan
+                                 ? igl::BindTarget::kAllGraphics
+                                 : bindTargetForShaderStage(_shaderStage);
+  encoder.bindBuffer(_layout->bufferIndex, bindTarget, buffer, bufferOffset);
+}
+
+} // namespace material
+} // namespace iglu
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include "ShaderProgram.h"
+
+#include <igl/IGL.h>
+#include <memory>
+#include <vector>
+
+namespace iglu {
+namespace material {
+
+/// A compiled material parameter block: the POD counterpart of ShaderUniforms for one uniform
+/// block.
+///
+/// At creation it bakes the block's layout from shader reflection (igl::UniformBlockLayout) and
+/// keeps a CPU snapshot laid out exactly like the GPU block. Members are resolved to integer
+/// indices once; per-frame updates are a memcpy into the snapshot; per-draw binding uploads
+/// nothing and touches no maps — the application memcpy's the snapshot into GPU memory it
+/// manages (typically a per-frame arena) and bind() issues a single bindBuffer() at that offset.
+///
+/// The dynamic ShaderUniforms path on Material is unaffected; it remains the right tool for
+/// tooling and editor code that discovers parameters by name per draw.
+class MaterialParameterBlock final {
+ public:
+  /// Bakes the block named 'blockName' from 'reflection'. Fails when the reflection does not
+  /// expose a uniform buffer with that name.
+  static std::unique_ptr<MaterialParameterBlock> create(
+      const igl::IRenderPipelineReflection& reflection,
+      const igl::NameHandle& blockName,
+      igl::Result* outResult = nullptr);
+
+  /// Convenience overload baking from a ShaderProgram's reflection.
+  static std::unique_ptr<MaterialParameterBlock> create(const ShaderProgram& shaderProgram,
+                                                        const igl::NameHandle& blockName,
+                                                        igl::Result* outResult = nullptr);
+
+  const igl::UniformBlockLayout& layout() const {
+    return *_layout;
+  }
+
+  /// Resolves a member name to its index in layout().members, or -1. Resolve at setup time and
+  /// store the index; per-frame code should only call setMemberBytes().
+  int memberIndex(const char* memberName) const;
+
+  /// Copies 'size' bytes into the snapshot at the member's baked offset (plus 'arrayIndex'
+  /// elements for array members). Out-of-bounds writes are dropped with an assert.
+  void setMemberBytes(int memberIndex, const void* data, size_t size, size_t arrayIndex = 0);
+
+  /// The snapshot, laid out exactly like the GPU block; memcpy it into the frame arena.
+  const void* data() const {
+    return _snapshot.data();
+  }
+  size_t size() const {
+    return _snapshot.size();
+  }
+
+  /// Binds 'buffer' at 'bufferOffset' to the block's baked binding point. The buffer is expected
+  /// to already contain the snapshot at that offset.
+  void bind(igl::IDevice& device,
+            igl::IRenderCommandEncoder& encoder,
+            const std::shared_ptr<igl::IBuffer>& buffer,
+            size_t bufferOffset) const;
+
+ private:
+  MaterialParameterBlock(std::shared_ptr<const igl::UniformBlockLayout> layout,
+                         igl::ShaderStage shaderStage);
+
+  std::shared_ptr<const igl::UniformBlockLayout> _layout;
+  igl::ShaderStage _shaderStage;
+  std::vector<uint8_t> _snapshot;
+};
+
+} // namespace material
+} // namespace iglu
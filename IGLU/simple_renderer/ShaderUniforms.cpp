@@ -254,7 +254,9 @@ void ShaderUniforms::setUniformBytes(const UniformDesc& uniformDesc,
   );
   if (err != 0) {
     IGL_LOG_ERROR_ONCE("[IGL][Error] Failed to update uniform buffer\n");
+    return;
   }
+  strongBuffer->allocation->dirty = true;
 }
 
 void ShaderUniforms::setUniformBytes(const igl::NameHandle& blockTypeName,
@@ -305,6 +307,88 @@ void ShaderUniforms::setUniformBytes(const igl::NameHandle& name,
   }
 }
 
+ShaderUniforms::UniformSlot ShaderUniforms::getUniformSlot(const igl::NameHandle& uniformName) {
+  auto cachedIt = _slotsByName.find(uniformName);
+  if (cachedIt != _slotsByName.end()) {
+    return cachedIt->second;
+  }
+
+  auto range = _allUniformsByName.equal_range(uniformName);
+  if (range.first == range.second) {
+    IGL_LOG_ERROR_ONCE("[IGL][Error] Invalid uniform name: %s\n", uniformName.c_str());
+    _slotsByName[uniformName] = kInvalidSlot;
+    return kInvalidSlot;
+  }
+
+  std::vector<UniformDesc> uniforms;
+  for (auto it = range.first; it != range.second; ++it) {
+    uniforms.push_back(it->second);
+  }
+
+  const auto slot = static_cast<UniformSlot>(_slots.size());
+  _slots.push_back(std::move(uniforms));
+  _slotsByName[uniformName] = slot;
+  return slot;
+}
+
+ShaderUniforms::UniformSlot ShaderUniforms::getUniformSlot(
+    const igl::NameHandle& blockTypeName,
+    const igl::NameHandle& blockInstanceName,
+    const igl::NameHandle& memberName) {
+  const auto qualifiedName = getQualifiedMemberName(blockTypeName, blockInstanceName, memberName);
+  auto cachedIt = _slotsByQualifiedName.find(qualifiedName);
+  if (cachedIt != _slotsByQualifiedName.end()) {
+    return cachedIt->second;
+  }
+
+  auto possibleBufferNames =
+      getPossibleBufferAndMemberNames(blockTypeName, blockInstanceName, memberName);
+
+  // Mirrors the resolution in the name-based setUniformBytes: the first buffer name with any
+  // matching descs wins
+  std::vector<UniformDesc> uniforms;
+  for (auto& [bufferName, bufferMemberName] : possibleBufferNames) {
+    auto range = _bufferDescs.equal_range(bufferName);
+    if (range.first == range.second) {
+      continue;
+    }
+
+    for (auto bufferDescIt = range.first; bufferDescIt != range.second; ++bufferDescIt) {
+      auto& bufferDesc = bufferDescIt->second;
+      auto memberIndexIt = bufferDesc->memberIndices.find(bufferMemberName);
+      if (memberIndexIt == bufferDesc->memberIndices.end()) {
+        continue;
+      }
+      uniforms.push_back(bufferDesc->uniforms[memberIndexIt->second]);
+    }
+    break;
+  }
+
+  if (uniforms.empty()) {
+    IGL_LOG_ERROR_ONCE("Buffer block not found: %s", blockTypeName.c_str());
+    _slotsByQualifiedName[qualifiedName] = kInvalidSlot;
+    return kInvalidSlot;
+  }
+
+  const auto slot = static_cast<UniformSlot>(_slots.size());
+  _slots.push_back(std::move(uniforms));
+  _slotsByQualifiedName[qualifiedName] = slot;
+  return slot;
+}
+
+void ShaderUniforms::setSlotBytes(UniformSlot slot,
+                                  const void* data,
+                                  size_t elementSize,
+                                  size_t count,
+                                  size_t arrayIndex) {
+  if (slot == kInvalidSlot || !IGL_VERIFY(static_cast<size_t>(slot) < _slots.size())) {
+    return;
+  }
+  for (const auto& uniformDesc : _slots[slot]) {
+    setUniformBytes(uniformDesc, data, elementSize, count, arrayIndex);
+  }
+}
+
 void ShaderUniforms::setBool(const igl::NameHandle& uniformName,
                              const bool& value,
                              size_t arrayIndex) {
@@ -848,8 +932,11 @@ void ShaderUniforms::bindBuffer(igl::IDevice& device,
     const auto& uniformName = buffer->iglBufferDesc.name;
     if (buffer->iglBufferDesc.isUniformBlock) {
       IGL_ASSERT(buffer->allocation->iglBuffer != nullptr);
-      buffer->allocation->iglBuffer->upload(buffer->allocation->ptr,
-                                            igl::BufferRange(buffer->allocation->size, 0));
+      if (buffer->allocation->dirty) {
+        buffer->allocation->iglBuffer->upload(buffer->allocation->ptr,
+                                              igl::BufferRange(buffer->allocation->size, 0));
+        buffer->allocation->dirty = false;
+      }
       const auto& glPipelineState =
           static_cast<const igl::opengl::RenderPipelineState&>(pipelineState);
       encoder.bindBuffer(glPipelineState.getUniformBlockBindingPoint(uniformName),
@@ -875,8 +962,18 @@ void ShaderUniforms::bindBuffer(igl::IDevice& device,
         uploadSize = buffer->suballocationsSize;
       }
 
-      buffer->allocation->iglBuffer->upload((uint8_t*)buffer->allocation->ptr + subAllocatedOffset,
-                                            igl::BufferRange(uploadSize, subAllocatedOffset));
+      // Ring buffers keep one copy per swapchain image, so they must be re-uploaded every frame
+      // regardless of the dirty bit; other buffers skip the upload when nothing changed
+      const bool isRing = (buffer->allocation->iglBuffer->acceptedApiHints() &
+                           igl::BufferDesc::BufferAPIHintBits::Ring) != 0;
+      if (buffer->allocation->dirty || isRing) {
+        buffer->allocation->iglBuffer->upload(
+            (uint8_t*)buffer->allocation->ptr + subAllocatedOffset,
+            igl::BufferRange(uploadSize, subAllocatedOffset));
+        if (!isRing) {
+          buffer->allocation->dirty = false;
+        }
+      }
       uint8_t bindTarget;
       if (device.getBackendType() == igl::BackendType::Vulkan) {
         bindTarget = igl::BindTarget::kAllGraphics;
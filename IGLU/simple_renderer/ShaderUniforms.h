@@ -235,6 +235,28 @@ class ShaderUniforms final {
    */
   igl::Result setSuballocationIndex(const igl::NameHandle& name, int index);
 
+  /// Compiled-binding API: resolve a uniform name to an integer slot once, then write per-frame
+  /// updates through the slot with no name hashing. Slots index a flat table and stay valid for
+  /// the lifetime of this ShaderUniforms instance.
+  using UniformSlot = int32_t;
+  static constexpr UniformSlot kInvalidSlot = -1;
+
+  /// Resolves 'uniformName' to a slot, or kInvalidSlot when no such uniform exists. Results are
+  /// cached, so calling this every frame is cheap; storing the slot is cheaper still.
+  UniformSlot getUniformSlot(const igl::NameHandle& uniformName);
+  UniformSlot getUniformSlot(const igl::NameHandle& blockTypeName,
+                             const igl::NameHandle& blockInstanceName,
+                             const igl::NameHandle& memberName);
+
+  /// Writes raw bytes through a slot; same semantics as the name-based setters. Only the buffer
+  /// holding the uniform is marked dirty, so buffers whose contents did not change since the last
+  /// bind() skip their re-upload.
+  void setSlotBytes(UniformSlot slot,
+                    const void* data,
+                    size_t elementSize,
+                    size_t count = 1,
+                    size_t arrayIndex = 0);
+
   inline bool containsUniform(const igl::NameHandle& uniformName) const {
     return _allUniformsByName.count(uniformName) > 0;
   }
@@ -266,7 +288,8 @@ class ShaderUniforms final {
     void* ptr = nullptr;
     size_t size = 0;
     std::shared_ptr<igl::IBuffer> iglBuffer;
-    bool dirty = false;
+    // starts dirty so the first bind uploads even when no uniform was set
+    bool dirty = true;
 
     BufferAllocation(void* ptr, size_t size, std::shared_ptr<igl::IBuffer> buffer) :
       ptr(ptr), size(size), iglBuffer(std::move(buffer)) {}
@@ -298,6 +321,15 @@ class ShaderUniforms final {
 
   std::unordered_multimap<igl::NameHandle, UniformDesc> _allUniformsByName;
 
+  // Flat slot table for the compiled-binding API; each slot holds every UniformDesc the name
+  // resolved to (a name can map to one desc per shader stage)
+  std::vector<std::vector<UniformDesc>> _slots;
+  std::unordered_map<igl::NameHandle, UniformSlot> _slotsByName;
+  // caches the block-member overload of getUniformSlot(), keyed on the qualified
+  // "blockInstanceName.memberName" handle; kept separate from _slotsByName so a qualified name
+  // can never shadow a plain uniform of the same spelling
+  std::unordered_map<igl::NameHandle, UniformSlot> _slotsByQualifiedName;
+
   MemoizedQualifiedMemberNameCalculator memoizedQualifiedMemberNameCalculator_;
 
   struct TextureSlot {
@@ -64,7 +64,7 @@ bool VertexData::appendData(const void* data, size_t size, size_t numPrimitives)
   return true;
 }
 
-void VertexData::draw(igl::IRenderCommandEncoder& commandEncoder) {
+void VertexData::draw(igl::IRenderCommandEncoder& commandEncoder, uint32_t instanceCount) {
   if (primitiveDesc_.numEntries == 0) {
     return;
   }
@@ -74,10 +74,15 @@ void VertexData::draw(igl::IRenderCommandEncoder& commandEncoder) {
   }
 
   if (ib_) {
-    commandEncoder.drawIndexed(
-        primitiveDesc_.type, primitiveDesc_.numEntries, ibFormat_, *ib_, primitiveDesc_.offset);
+    commandEncoder.drawIndexed(primitiveDesc_.type,
+                               primitiveDesc_.numEntries,
+                               ibFormat_,
+                               *ib_,
+                               primitiveDesc_.offset,
+                               instanceCount);
   } else {
-    commandEncoder.draw(primitiveDesc_.type, primitiveDesc_.offset, primitiveDesc_.numEntries);
+    commandEncoder.draw(
+        primitiveDesc_.type, primitiveDesc_.offset, primitiveDesc_.numEntries, instanceCount);
   }
 }
 
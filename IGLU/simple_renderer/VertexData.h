@@ -29,8 +29,9 @@ class VertexData final {
   /// before draw().
   void populatePipelineDescriptor(igl::RenderPipelineDesc& pipelineDesc) const;
 
-  /// Invokes the draw command of the lower level APIs.
-  void draw(igl::IRenderCommandEncoder& commandEncoder);
+  /// Invokes the draw command of the lower level APIs. When 'instanceCount' is larger than 1,
+  /// the draw is instanced and shaders distinguish instances via the instance id.
+  void draw(igl::IRenderCommandEncoder& commandEncoder, uint32_t instanceCount = 1);
 
   PrimitiveDesc& primitiveDesc();
   std::shared_ptr<igl::IVertexInputState> vertexInputState();
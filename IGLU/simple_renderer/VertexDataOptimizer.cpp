@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "VertexDataOptimizer.h"
+
+#include <cstring>
+#include <meshoptimizer.h>
+
+namespace iglu {
+namespace vertexdata {
+namespace {
+
+uint32_t packSnorm_10_10_10_2(const float* value) {
+  const auto x = static_cast<uint32_t>(meshopt_quantizeSnorm(value[0], 10)) & 0x3FFu;
+  const auto y = static_cast<uint32_t>(meshopt_quantizeSnorm(value[1], 10)) & 0x3FFu;
+  const auto z = static_cast<uint32_t>(meshopt_quantizeSnorm(value[2], 10)) & 0x3FFu;
+  return x | (y << 10u) | (z << 20u);
+}
+
+} // namespace
+
+bool optimizeVertexData(const igl::VertexInputStateDesc& inputStateDesc,
+                        const void* vertexData,
+                        size_t vertexCount,
+                        const uint32_t* indexData,
+                        size_t indexCount,
+                        const VertexOptimizationOptions& options,
+                        OptimizedVertexData& outData,
+                        igl::Result* outResult) {
+  if (inputStateDesc.numInputBindings != 1 || inputStateDesc.numAttributes == 0) {
+    igl::Result::setResult(outResult,
+                           igl::Result::Code::ArgumentInvalid,
+                           "Optimization requires a single interleaved buffer binding.");
+    return false;
+  }
+  if (vertexData == nullptr || indexData == nullptr || vertexCount == 0 || indexCount == 0 ||
+      indexCount % 3 != 0) {
+    igl::Result::setResult(
+        outResult, igl::Result::Code::ArgumentInvalid, "Expected a non-empty triangle mesh.");
+    return false;
+  }
+  if (options.optimizeOverdraw &&
+      (options.positionAttributeIndex < 0 ||
+       static_cast<size_t>(options.positionAttributeIndex) >= inputStateDesc.numAttributes ||
+       inputStateDesc.attributes[options.positionAttributeIndex].format !=
+           igl::VertexAttributeFormat::Float3)) {
+    igl::Result::setResult(outResult,
+                           igl::Result::Code::ArgumentInvalid,
+                           "Overdraw sorting requires a Float3 position attribute.");
+    return false;
+  }
+  if (options.normalAttributeIndex >= 0 &&
+      (static_cast<size_t>(options.normalAttributeIndex) >= inputStateDesc.numAttributes ||
+       inputStateDesc.attributes[options.normalAttributeIndex].format !=
+           igl::VertexAttributeFormat::Float3)) {
+    igl::Result::setResult(outResult,
+                           igl::Result::Code::ArgumentInvalid,
+                           "Normal quantization requires a Float3 attribute.");
+    return false;
+  }
+  if (options.uvAttributeIndex >= 0 &&
+      (static_cast<size_t>(options.uvAttributeIndex) >= inputStateDesc.numAttributes ||
+       inputStateDesc.attributes[options.uvAttributeIndex].format !=
+           igl::VertexAttributeFormat::Float2)) {
+    igl::Result::setResult(outResult,
+                           igl::Result::Code::ArgumentInvalid,
+                           "UV quantization requires a Float2 attribute.");
+    return false;
+  }
+
+  const size_t vertexSize = inputStateDesc.inputBindings[0].stride;
+  const auto* vertexBytes = static_cast<const uint8_t*>(vertexData);
+
+  // Triangle reordering operates on a copy of the index list.
+  outData.indexData.assign(indexData, indexData + indexCount);
+
+  if (options.optimizeVertexCache) {
+    meshopt_optimizeVertexCache(
+        outData.indexData.data(), outData.indexData.data(), indexCount, vertexCount);
+  }
+  if (options.optimizeOverdraw) {
+    const auto& positionAttribute = inputStateDesc.attributes[options.positionAttributeIndex];
+    const auto* positions =
+        reinterpret_cast<const float*>(vertexBytes + positionAttribute.offset);
+    meshopt_optimizeOverdraw(outData.indexData.data(),
+                             outData.indexData.data(),
+                             indexCount,
+                             positions,
+                             vertexCount,
+                             vertexSize,
+                             options.overdrawThreshold);
+  }
+
+  // Reorder vertices to match the final triangle order so fetches walk the buffer sequentially.
+  // This also drops vertices the index list never references.
+  std::vector<uint8_t> reorderedVertexData(vertexCount * vertexSize);
+  if (options.optimizeVertexFetch) {
+    vertexCount = meshopt_optimizeVertexFetch(reorderedVertexData.data(),
+                                              outData.indexData.data(),
+                                              indexCount,
+                                              vertexBytes,
+                                              vertexCount,
+                                              vertexSize);
+    reorderedVertexData.resize(vertexCount * vertexSize);
+  } else {
+    std::memcpy(reorderedVertexData.data(), vertexBytes, vertexCount * vertexSize);
+  }
+  outData.vertexCount = vertexCount;
+
+  outData.inputStateDesc = inputStateDesc;
+
+  if (options.normalAttributeIndex < 0 && options.uvAttributeIndex < 0) {
+    outData.vertexData = std::move(reorderedVertexData);
+    igl::Result::setOk(outResult);
+    return true;
+  }
+
+  // Quantization changes attribute sizes, so rebuild the interleaved layout tightly packed in
+  // attribute order, keeping every offset 4-byte aligned.
+  size_t newOffsets[IGL_VERTEX_ATTRIBUTES_MAX];
+  size_t newSizes[IGL_VERTEX_ATTRIBUTES_MAX];
+  size_t newStride = 0;
+  for (size_t i = 0; i < inputStateDesc.numAttributes; ++i) {
+    auto format = inputStateDesc.attributes[i].format;
+    if (static_cast<int>(i) == options.normalAttributeIndex) {
+      format = igl::VertexAttributeFormat::Int_2_10_10_10_REV;
+    } else if (static_cast<int>(i) == options.uvAttributeIndex) {
+      format = igl::VertexAttributeFormat::HalfFloat2;
+    }
+    newSizes[i] = igl::VertexInputStateDesc::sizeForVertexAttributeFormat(format);
+    newOffsets[i] = newStride;
+    newStride += (newSizes[i] + 3u) & ~size_t(3);
+
+    outData.inputStateDesc.attributes[i].format = format;
+    outData.inputStateDesc.attributes[i].offset = newOffsets[i];
+  }
+  outData.inputStateDesc.inputBindings[0].stride = newStride;
+
+  outData.vertexData.resize(vertexCount * newStride);
+  for (size_t v = 0; v < vertexCount; ++v) {
+    const uint8_t* src = reorderedVertexData.data() + v * vertexSize;
+    uint8_t* dst = outData.vertexData.data() + v * newStride;
+    for (size_t i = 0; i < inputStateDesc.numAttributes; ++i) {
+      const uint8_t* attributeSrc = src + inputStateDesc.attributes[i].offset;
+      if (static_cast<int>(i) == options.normalAttributeIndex) {
+        float normal[3];
+        std::memcpy(normal, attributeSrc, sizeof(normal));
+        const uint32_t packed = packSnorm_10_10_10_2(normal);
+        std::memcpy(dst + newOffsets[i], &packed, sizeof(packed));
+      } else if (static_cast<int>(i) == options.uvAttributeIndex) {
+        float uv[2];
+        std::memcpy(uv, attributeSrc, sizeof(uv));
+        const uint16_t packed[2] = {meshopt_quantizeHalf(uv[0]), meshopt_quantizeHalf(uv[1])};
+        std::memcpy(dst + newOffsets[i], packed, sizeof(packed));
+      } else {
+        std::memcpy(dst + newOffsets[i], attributeSrc, newSizes[i]);
+      }
+    }
+  }
+
+  igl::Result::setOk(outResult);
+  return true;
+}
+
+} // namespace vertexdata
+} // namespace iglu
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <igl/IGL.h>
+#include <vector>
+
+namespace iglu {
+namespace vertexdata {
+
+/// Controls the stages optimizeVertexData() runs. The attribute indices refer to entries in the
+/// VertexInputStateDesc handed to optimizeVertexData(), which is what drives the pass: reordering
+/// needs to know where positions live and quantization which attributes hold normals and UVs.
+struct VertexOptimizationOptions {
+  /// Reorders triangles to maximize post-transform vertex cache hits.
+  bool optimizeVertexCache = true;
+  /// Sorts triangles front-to-back-ish to reduce overdraw without ruining cache order.
+  /// Requires a Float3 attribute at 'positionAttributeIndex'.
+  bool optimizeOverdraw = true;
+  /// Reorders vertices to match the final triangle order, making vertex fetches sequential.
+  bool optimizeVertexFetch = true;
+  /// How much ACMR degradation overdraw sorting may introduce; 1.05 allows 5%.
+  float overdrawThreshold = 1.05f;
+
+  /// Index of the Float3 position attribute; only used when optimizeOverdraw is enabled.
+  int positionAttributeIndex = 0;
+  /// When >= 0, the Float3 attribute at this index is packed to Int_2_10_10_10_REV (4 bytes).
+  int normalAttributeIndex = -1;
+  /// When >= 0, the Float2 attribute at this index is packed to HalfFloat2 (4 bytes).
+  int uvAttributeIndex = -1;
+};
+
+/// Output of optimizeVertexData(): tightly repacked vertices, the remapped index list, and an
+/// input state descriptor whose formats, offsets and stride reflect any quantization.
+struct OptimizedVertexData {
+  std::vector<uint8_t> vertexData;
+  std::vector<uint32_t> indexData;
+  igl::VertexInputStateDesc inputStateDesc;
+  size_t vertexCount = 0;
+};
+
+/// Runs an offline-style optimization pass over an interleaved triangle mesh before it is
+/// uploaded into a VertexData: post-transform cache reordering, overdraw-aware triangle sorting
+/// and vertex fetch reordering (all via meshoptimizer), plus attribute quantization of normals to
+/// 10-10-10-2 and UVs to half floats. Quantization alone cuts 8 bytes per vertex from the common
+/// position/normal/UV layout; together the stages substantially reduce vertex fetch bandwidth.
+///
+/// 'inputStateDesc' must describe a single interleaved buffer binding. Indices are 32-bit here
+/// regardless of what the final index buffer uses; narrow them when uploading if appropriate.
+/// Fails with ArgumentInvalid when the descriptor or the selected attributes don't match.
+bool optimizeVertexData(const igl::VertexInputStateDesc& inputStateDesc,
+                        const void* vertexData,
+                        size_t vertexCount,
+                        const uint32_t* indexData,
+                        size_t indexCount,
+                        const VertexOptimizationOptions& options,
+                        OptimizedVertexData& outData,
+                        igl::Result* outResult = nullptr);
+
+} // namespace vertexdata
+} // namespace iglu
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <IGLU/skinning/JointPalette.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace iglu::skinning {
+
+JointPalette::JointPalette(uint32_t maxJoints, int bufferIndex, const char* uniformName) :
+  maxJoints_(maxJoints), bufferIndex_(bufferIndex), uniformName_(uniformName) {
+  inverseBind_.resize(maxJoints_, glm::mat4(1.0f));
+  palette_.resize(maxJoints_, glm::mat4(1.0f));
+}
+
+void JointPalette::setInverseBindMatrices(const glm::mat4* matrices, uint32_t count) {
+  IGL_ASSERT(count <= maxJoints_);
+  count = std::min(count, maxJoints_);
+  std::copy(matrices, matrices + count, inverseBind_.begin());
+}
+
+void JointPalette::updateJoints(const glm::mat4* jointWorldMatrices, uint32_t count) {
+  IGL_ASSERT(count <= maxJoints_);
+  count = std::min(count, maxJoints_);
+  for (uint32_t j = 0; j < count; ++j) {
+    palette_[j] = jointWorldMatrices[j] * inverseBind_[j];
+  }
+}
+
+void JointPalette::bind(igl::IDevice& device,
+                        const igl::IRenderPipelineState& pipelineState,
+                        igl::IRenderCommandEncoder& encoder) {
+  ManagedUniformBufferInfo info;
+  info.index = bufferIndex_;
+  info.length = sizeof(glm::mat4) * maxJoints_;
+  {
+    igl::UniformDesc e;
+    e.name = uniformName_;
+    e.type = igl::UniformType::Mat4x4;
+    e.numElements = maxJoints_;
+    e.offset = 0;
+    e.elementStride = sizeof(glm::mat4);
+    info.uniforms.push_back(std::move(e));
+  }
+
+  ManagedUniformBuffer uniformBuffer(device, info);
+  IGL_ASSERT(uniformBuffer.result.isOk());
+  std::memcpy(uniformBuffer.getData(), palette_.data(), info.length);
+  uniformBuffer.bind(device, pipelineState, encoder);
+}
+
+} // namespace iglu::skinning
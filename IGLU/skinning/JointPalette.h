@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <IGLU/managedUniformBuffer/ManagedUniformBuffer.h>
+#include <glm/glm.hpp>
+#include <string>
+#include <vector>
+
+namespace iglu::skinning {
+
+// Maintains the joint-matrix palette for GPU skinning. Callers provide the inverse bind matrices
+// once and the joint world transforms each frame; the palette (world * inverseBind) is uploaded
+// as a mat4 array uniform and bound for the next draw. The vertex shader indexes the array with
+// the per-vertex joint indices and blends with the per-vertex weights, so skinned vertices never
+// touch the CPU after the initial mesh upload.
+class JointPalette final {
+ public:
+  JointPalette(uint32_t maxJoints, int bufferIndex, const char* uniformName = "jointMatrices");
+
+  void setInverseBindMatrices(const glm::mat4* matrices, uint32_t count);
+
+  // palette[j] = jointWorldMatrices[j] * inverseBindMatrix[j]
+  void updateJoints(const glm::mat4* jointWorldMatrices, uint32_t count);
+
+  // Uploads the palette and binds it for subsequent draws. A fresh uniform block is created per
+  // call so multiple skinned draws in one command buffer don't alias each other's palettes.
+  void bind(igl::IDevice& device,
+            const igl::IRenderPipelineState& pipelineState,
+            igl::IRenderCommandEncoder& encoder);
+
+  [[nodiscard]] uint32_t maxJoints() const noexcept {
+    return maxJoints_;
+  }
+
+ private:
+  uint32_t maxJoints_;
+  int bufferIndex_;
+  std::string uniformName_;
+  std::vector<glm::mat4> inverseBind_;
+  std::vector<glm::mat4> palette_;
+};
+
+} // namespace iglu::skinning
@@ -7,9 +7,11 @@
 
 #pragma once
 
+#include <atomic>
 #include <igl/Common.h>
-#include <list>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <unordered_map>
 #include <utility>
 
@@ -35,70 +37,111 @@ class IStatePool {
   virtual ~IStatePool() = default;
 };
 
+/// Cache effectiveness counters for a state pool; counters are cumulative since construction, so
+/// periodic reporters can diff consecutive snapshots.
+struct StatePoolStats {
+  uint64_t hits = 0;
+  uint64_t misses = 0;
+  size_t size = 0;
+};
+
 ///--------------------------------------
 /// MARK: - LRUStatePool
 
+/// Capacity-bounded, thread-safe state cache with least-recently-used eviction.
+///
+/// The pool is read-mostly concurrent: cache hits take a shared lock and only bump an atomic
+/// recency stamp, so lookups from multiple threads proceed in parallel. Misses create the state
+/// object outside any lock (a slow pipeline build does not serialize other lookups) and then
+/// insert under an exclusive lock; when two threads race to create the same state, the first
+/// insert wins and the other object is discarded.
 template<class TDescriptor, class TStateObject>
 class LRUStatePool : public IStatePool<TDescriptor, TStateObject> {
  public:
+  /// Caps the number of cached states; shrinking evicts the least recently used entries.
   void setCacheSize(uint32_t maxCacheSize) {
+    const std::unique_lock<std::shared_mutex> lock(mutex_);
     maxCacheSize_ = maxCacheSize;
-    while (stateList_.size() >= maxCacheSize_) {
-      deleteLastUsed_();
+    while (states_.size() > maxCacheSize_) {
+      evictLeastRecentlyUsed();
     }
   }
 
-  // Implememnts LRU Cache https://www.geeksforgeeks.org/lru-cache-implementation/
-  // Gets or creates a state object and moves the strong reference to it to the beginning of the
-  // pool's queue so it remains in cache longer if frequently used
   std::shared_ptr<TStateObject> getOrCreate(igl::IDevice& dev,
                                             const TDescriptor& desc,
                                             igl::Result* outResult) final {
-    auto it = stateMap_.find(desc);
-    if (it != stateMap_.cend()) {
-      // Cache hit
-      if (it->second != stateList_.begin()) {
-        stateList_.splice(stateList_.begin(), stateList_, it->second);
+    {
+      const std::shared_lock<std::shared_mutex> lock(mutex_);
+      auto it = states_.find(desc);
+      if (it != states_.cend()) {
+        it->second->lastUsed.store(clock_.fetch_add(1, std::memory_order_relaxed),
+                                   std::memory_order_relaxed);
+        hits_.fetch_add(1, std::memory_order_relaxed);
+        igl::Result::setOk(outResult);
+        return it->second->state;
       }
-    } else {
-      // Cache miss
-      if (stateList_.size() >= maxCacheSize_) {
-        // If the cache is full delete the last used
-        deleteLastUsed_();
-      }
-
-      // Add new element to start of queue
-      auto stateResource = createStateObject(dev, desc, outResult);
+    }
+    misses_.fetch_add(1, std::memory_order_relaxed);
 
-      if (!IGL_VERIFY(stateResource != nullptr)) {
-        return nullptr;
-      }
+    auto stateResource = createStateObject(dev, desc, outResult);
+    if (!IGL_VERIFY(stateResource != nullptr)) {
+      return nullptr;
+    }
 
-      auto stateDesc = desc; // force r-value c-tor: pair(U1&& x, U2&& y)
-      stateList_.push_front(TStateItem(std::move(stateDesc), std::move(stateResource)));
-      it = stateMap_.insert(std::make_pair(desc, stateList_.begin())).first;
+    const std::unique_lock<std::shared_mutex> lock(mutex_);
+    auto it = states_.find(desc);
+    if (it != states_.cend()) {
+      // another thread created the same state while ours was building; keep the first one
+      return it->second->state;
     }
+    while (states_.size() >= maxCacheSize_) {
+      evictLeastRecentlyUsed();
+    }
+    auto entry = std::make_unique<Entry>();
+    entry->state = std::move(stateResource);
+    entry->lastUsed.store(clock_.fetch_add(1, std::memory_order_relaxed),
+                          std::memory_order_relaxed);
+    it = states_.emplace(desc, std::move(entry)).first;
+    return it->second->state;
+  }
 
-    return it->second->second;
+  [[nodiscard]] StatePoolStats getStats() const {
+    const std::shared_lock<std::shared_mutex> lock(mutex_);
+    return {hits_.load(std::memory_order_relaxed),
+            misses_.load(std::memory_order_relaxed),
+            states_.size()};
   }
 
  private:
-  using TStateItem = std::pair<TDescriptor, std::shared_ptr<TStateObject>>;
+  struct Entry {
+    std::shared_ptr<TStateObject> state;
+    std::atomic<uint64_t> lastUsed{0};
+  };
+
   virtual std::shared_ptr<TStateObject> createStateObject(igl::IDevice& dev,
                                                           const TDescriptor& desc,
                                                           igl::Result* outResult) = 0;
 
-  void deleteLastUsed_() {
-    auto last = stateList_.back();
-    stateList_.pop_back();
-    stateMap_.erase(last.first);
+  // Evictions are rare (cache at capacity), so a linear scan for the oldest stamp beats paying a
+  // list splice under an exclusive lock on every hit
+  void evictLeastRecentlyUsed() {
+    auto oldest = states_.begin();
+    for (auto it = states_.begin(); it != states_.end(); ++it) {
+      if (it->second->lastUsed.load(std::memory_order_relaxed) <
+          oldest->second->lastUsed.load(std::memory_order_relaxed)) {
+        oldest = it;
+      }
+    }
+    if (oldest != states_.end()) {
+      states_.erase(oldest);
+    }
   }
 
-  // Queue to store the values
-  std::list<TStateItem> stateList_;
-
-  // Map to check existance
-  std::unordered_map<TDescriptor, typename std::list<TStateItem>::iterator> stateMap_;
+  mutable std::shared_mutex mutex_;
+  std::unordered_map<TDescriptor, std::unique_ptr<Entry>> states_;
+  std::atomic<uint64_t> clock_{0};
+  std::atomic<uint64_t> hits_{0};
+  std::atomic<uint64_t> misses_{0};
 
   uint32_t maxCacheSize_ = 1024; // maximum capacity of cache
 };
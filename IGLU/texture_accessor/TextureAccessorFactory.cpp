@@ -12,6 +12,9 @@
 #if IGL_PLATFORM_APPLE
 #include "MetalTextureAccessor.h"
 #endif
+#if IGL_BACKEND_VULKAN
+#include "VulkanTextureAccessor.h"
+#endif
 
 namespace iglu {
 namespace textureaccessor {
@@ -29,6 +32,10 @@ std::unique_ptr<ITextureAccessor> TextureAccessorFactory::createTextureAccessor(
   case igl::BackendType::Metal:
     return std::make_unique<MetalTextureAccessor>(texture, device);
 #endif // IGL_PLATFORM_APPLE
+#if IGL_BACKEND_VULKAN
+  case igl::BackendType::Vulkan:
+    return std::make_unique<VulkanTextureAccessor>(texture, device);
+#endif // IGL_BACKEND_VULKAN
   default:
     IGL_ASSERT_NOT_IMPLEMENTED();
     return nullptr;
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "VulkanTextureAccessor.h"
+#include "ITextureAccessor.h"
+#include "igl/Texture.h"
+#include "igl/vulkan/Device.h"
+#include "igl/vulkan/Texture.h"
+#include "igl/vulkan/VulkanContext.h"
+#include "igl/vulkan/VulkanImage.h"
+#include "igl/vulkan/VulkanTexture.h"
+
+namespace iglu::textureaccessor {
+
+VulkanTextureAccessor::VulkanTextureAccessor(std::shared_ptr<igl::ITexture> texture,
+                                             igl::IDevice& device) :
+  ITextureAccessor(std::move(texture)) {
+  ctx_ = &static_cast<igl::vulkan::Device&>(device).getVulkanContext();
+
+  auto& vkTexture = static_cast<igl::vulkan::Texture&>(*texture_);
+  const auto dimensions = vkTexture.getDimensions();
+  textureWidth_ = dimensions.width;
+  textureHeight_ = dimensions.height;
+
+  textureBytesPerImage_ = vkTexture.getProperties().getBytesPerRange(vkTexture.getFullRange());
+  latestBytesRead_.resize(textureBytesPerImage_);
+
+  // CPU readback goes through the framebuffer attachment copy, like the OpenGL accessor
+  igl::FramebufferDesc framebufferDesc;
+  framebufferDesc.colorAttachments[0].texture = texture_;
+  frameBuffer_ = device.createFramebuffer(framebufferDesc, nullptr);
+
+#if IGL_PLATFORM_WIN || IGL_PLATFORM_LINUX || IGL_PLATFORM_ANDROID
+  for (size_t i = 0; i != exportImages_.size(); i++) {
+    exportImages_[i] = igl::vulkan::VulkanImage::createWithExportMemory(
+        *ctx_,
+        ctx_->getVkDevice(),
+        VkExtent3D{(uint32_t)textureWidth_, (uint32_t)textureHeight_, 1u},
+        VK_IMAGE_TYPE_2D,
+        vkTexture.getVkFormat(),
+        1u,
+        1u,
+        VK_IMAGE_TILING_OPTIMAL,
+        VK_IMAGE_USAGE_TRANSFER_DST_BIT,
+        0,
+        VK_SAMPLE_COUNT_1_BIT,
+        IGL_FORMAT("Image: VulkanTextureAccessor export {}", i).c_str());
+  }
+  if (!exportImages_[0] || !exportImages_[1]) {
+    IGL_LOG_INFO(
+        "External memory export is not supported - VulkanTextureAccessor falls back to CPU "
+        "readback only\n");
+    exportImages_ = {};
+  }
+#endif // IGL_PLATFORM_WIN || IGL_PLATFORM_LINUX || IGL_PLATFORM_ANDROID
+}
+
+void VulkanTextureAccessor::copyToExportImage(igl::vulkan::VulkanImage& src,
+                                              igl::vulkan::VulkanImage& dst) {
+  const auto& wrapper = ctx_->immediate_->acquire();
+
+  const VkImageSubresourceRange range = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1};
+
+  src.transitionLayout(wrapper.cmdBuf_,
+                       VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                       VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                       VK_PIPELINE_STAGE_TRANSFER_BIT,
+                       range);
+  dst.transitionLayout(wrapper.cmdBuf_,
+                       VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                       VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                       VK_PIPELINE_STAGE_TRANSFER_BIT,
+                       range);
+
+  const VkImageCopy copyRegion = {
+      VkImageSubresourceLayers{VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1},
+      VkOffset3D{0, 0, 0},
+      VkImageSubresourceLayers{VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1},
+      VkOffset3D{0, 0, 0},
+      VkExtent3D{(uint32_t)textureWidth_, (uint32_t)textureHeight_, 1u},
+  };
+  ctx_->vf_.vkCmdCopyImage(wrapper.cmdBuf_,
+                           src.getVkImage(),
+                           VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                           dst.getVkImage(),
+                           VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                           1,
+                           &copyRegion);
+
+  // the media encoder reads the exported memory outside of this Vulkan instance
+  dst.transitionLayout(wrapper.cmdBuf_,
+                       VK_IMAGE_LAYOUT_GENERAL,
+                       VK_PIPELINE_STAGE_TRANSFER_BIT,
+                       VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                       range);
+  // restore the layout the rest of IGL expects textures to be in between render passes
+  src.transitionLayout(wrapper.cmdBuf_,
+                       VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                       VK_PIPELINE_STAGE_TRANSFER_BIT,
+                       VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                       range);
+
+  lastSubmitHandle_ = ctx_->immediate_->submit(wrapper);
+}
+
+void VulkanTextureAccessor::requestBytes(igl::ICommandQueue& commandQueue,
+                                         std::shared_ptr<igl::ITexture> texture) {
+  dataCopied_ = false;
+  if (texture) {
+    IGL_ASSERT(textureWidth_ == texture->getDimensions().width &&
+               textureHeight_ == texture->getDimensions().height);
+    texture_ = std::move(texture);
+    frameBuffer_->updateDrawable(texture_);
+  }
+  lastCommandQueue_ = &commandQueue;
+
+  if (exportImages_[writeIndex_]) {
+    auto& srcImage =
+        static_cast<igl::vulkan::Texture&>(*texture_).getVulkanTexture().getVulkanImage();
+    copyToExportImage(srcImage, *exportImages_[writeIndex_]);
+
+    pendingIndex_ = (int32_t)writeIndex_;
+    writeIndex_ = 1u - writeIndex_;
+    status_ = RequestStatus::InProgress;
+    return;
+  }
+
+  // external memory export is unavailable: synchronous CPU readback
+  const auto range = igl::TextureRangeDesc::new2D(0, 0, textureWidth_, textureHeight_);
+  frameBuffer_->copyBytesColorAttachment(commandQueue, 0, latestBytesRead_.data(), range);
+
+  dataCopied_ = true;
+  status_ = RequestStatus::Ready;
+}
+
+RequestStatus VulkanTextureAccessor::getRequestStatus() {
+  if (status_ == RequestStatus::InProgress && ctx_->immediate_->isReady(lastSubmitHandle_)) {
+    status_ = RequestStatus::Ready;
+    readyIndex_ = pendingIndex_;
+  }
+  return status_;
+}
+
+std::vector<unsigned char>& VulkanTextureAccessor::getBytes() {
+  if (status_ == RequestStatus::InProgress) {
+    ctx_->immediate_->wait(lastSubmitHandle_);
+    status_ = RequestStatus::Ready;
+    readyIndex_ = pendingIndex_;
+  }
+  if (!dataCopied_ && IGL_VERIFY(lastCommandQueue_)) {
+    const auto range = igl::TextureRangeDesc::new2D(0, 0, textureWidth_, textureHeight_);
+    frameBuffer_->copyBytesColorAttachment(*lastCommandQueue_, 0, latestBytesRead_.data(), range);
+    dataCopied_ = true;
+  }
+  return latestBytesRead_;
+}
+
+const igl::vulkan::VulkanImage* VulkanTextureAccessor::getExportedImage() const {
+  // readyIndex_ only ever points at a buffer whose copy has completed; the buffer being written
+  // by an in-flight request is always the other one
+  return readyIndex_ >= 0 ? exportImages_[readyIndex_].get() : nullptr;
+}
+
+int VulkanTextureAccessor::getExportedFd() const {
+  const auto* image = getExportedImage();
+  return image ? image->exportedFd_ : -1;
+}
+
+void* VulkanTextureAccessor::getExportedMemoryHandle() const {
+  const auto* image = getExportedImage();
+  return image ? image->exportedMemoryHandle_ : nullptr;
+}
+
+} // namespace iglu::textureaccessor
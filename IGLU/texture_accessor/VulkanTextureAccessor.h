@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include "ITextureAccessor.h"
+#include "igl/Framebuffer.h"
+#include <igl/CommandQueue.h>
+#include <igl/IGL.h>
+#include <igl/Texture.h>
+#include <igl/vulkan/VulkanImage.h>
+#include <igl/vulkan/VulkanImmediateCommands.h>
+
+#include <array>
+
+namespace iglu {
+namespace textureaccessor {
+
+/// Vulkan implementation of ITextureAccessor. In addition to the CPU readback path of the
+/// interface, the accessor keeps two exportable VkImages (double-buffered): every requestBytes()
+/// copies the texture into one of them on the GPU, and the external memory handle of the image
+/// holding the most recently completed frame can be handed to a media encoder for zero-copy
+/// consumption (a file descriptor on Linux/Android, a HANDLE on Windows). When external memory
+/// export is not supported, only the CPU readback path is available.
+class VulkanTextureAccessor : public ITextureAccessor {
+ public:
+  VulkanTextureAccessor(std::shared_ptr<igl::ITexture> texture, igl::IDevice& device);
+
+  void requestBytes(igl::ICommandQueue& commandQueue,
+                    std::shared_ptr<igl::ITexture> texture = nullptr) override;
+  RequestStatus getRequestStatus() override;
+  std::vector<unsigned char>& getBytes() override;
+
+  /// Returns the exportable image holding the most recently completed frame, or nullptr when no
+  /// request has completed yet or external memory export is not supported. The image stays valid
+  /// while the next frame is being copied into the other buffer
+  const igl::vulkan::VulkanImage* getExportedImage() const;
+
+  /// File descriptor of the exported memory backing getExportedImage() on Linux/Android, or -1
+  /// when not available. The descriptor is owned by the accessor
+  int getExportedFd() const;
+
+  /// HANDLE of the exported memory backing getExportedImage() on Windows, or nullptr when not
+  /// available
+  void* getExportedMemoryHandle() const;
+
+ private:
+  /// Records a GPU copy of `src` into `dst` on an immediate command buffer and submits it,
+  /// caching the submit handle for getRequestStatus()/getBytes()
+  void copyToExportImage(igl::vulkan::VulkanImage& src, igl::vulkan::VulkanImage& dst);
+
+  const igl::vulkan::VulkanContext* ctx_ = nullptr;
+  std::vector<unsigned char> latestBytesRead_;
+  RequestStatus status_ = RequestStatus::NotInitialized;
+  std::shared_ptr<igl::IFramebuffer> frameBuffer_;
+  igl::ICommandQueue* lastCommandQueue_ = nullptr;
+  size_t textureWidth_ = 0;
+  size_t textureHeight_ = 0;
+  size_t textureBytesPerImage_ = 0;
+
+  // double-buffered exportable images: the GPU copies into exportImages_[writeIndex_] while the
+  // consumer can still read the frame at readyIndex_
+  std::array<std::shared_ptr<igl::vulkan::VulkanImage>, 2> exportImages_;
+  uint32_t writeIndex_ = 0;
+  int32_t pendingIndex_ = -1;
+  int32_t readyIndex_ = -1;
+  igl::vulkan::VulkanImmediateCommands::SubmitHandle lastSubmitHandle_ = {};
+  bool dataCopied_ = false;
+};
+
+} // namespace textureaccessor
+} // namespace iglu
@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <IGLU/texture_atlas/ShelfPacker.h>
+
+namespace iglu::textureatlas {
+
+bool ShelfPacker::insert(uint32_t width, uint32_t height, Rect& outRect) {
+  const uint32_t paddedWidth = width + padding_;
+  const uint32_t paddedHeight = height + padding_;
+  if (paddedWidth > width_ || paddedHeight > height_) {
+    return false;
+  }
+
+  // best-fit among the existing shelves: the one wasting the least vertical space
+  Shelf* bestShelf = nullptr;
+  for (auto& shelf : shelves_) {
+    if (paddedHeight > shelf.height || shelf.cursorX + paddedWidth > width_) {
+      continue;
+    }
+    if (!bestShelf || shelf.height < bestShelf->height) {
+      bestShelf = &shelf;
+    }
+  }
+
+  if (!bestShelf) {
+    // open a new shelf below the last one
+    if (nextShelfY_ + paddedHeight > height_) {
+      return false;
+    }
+    shelves_.push_back({nextShelfY_, paddedHeight, 0});
+    nextShelfY_ += paddedHeight;
+    bestShelf = &shelves_.back();
+  }
+
+  outRect = {bestShelf->cursorX + padding_, bestShelf->y + padding_, width, height};
+  bestShelf->cursorX += paddedWidth;
+  return true;
+}
+
+} // namespace iglu::textureatlas
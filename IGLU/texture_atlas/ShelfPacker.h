@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace iglu::textureatlas {
+
+/// Packs axis-aligned rectangles into a fixed-size page using the shelf heuristic: rectangles
+/// are placed left to right on horizontal shelves, and a new shelf is opened below the last one
+/// when no existing shelf fits. Shelf packing wastes more area than skyline or guillotine
+/// packers on wildly varying sizes, but it is simple, fast and never fragments - which is the
+/// right trade-off for UI glyphs, icons and decals that tend to come in similar heights.
+class ShelfPacker final {
+ public:
+  struct Rect {
+    uint32_t x = 0;
+    uint32_t y = 0;
+    uint32_t width = 0;
+    uint32_t height = 0;
+  };
+
+  /// @param padding pixels of empty space kept around every rectangle; use at least 1 when the
+  /// atlas is sampled with bilinear filtering to avoid bleeding between neighbors
+  ShelfPacker(uint32_t width, uint32_t height, uint32_t padding = 0) :
+    width_(width), height_(height), padding_(padding) {}
+
+  /// Finds space for a `width` x `height` rectangle. Prefers the existing shelf that wastes the
+  /// least vertical space; opens a new shelf when none fits. Returns false when the page is full
+  bool insert(uint32_t width, uint32_t height, Rect& outRect);
+
+  /// Forgets all placed rectangles; previously returned rects become dangling
+  void reset() {
+    shelves_.clear();
+    nextShelfY_ = 0;
+  }
+
+  [[nodiscard]] uint32_t width() const {
+    return width_;
+  }
+
+  [[nodiscard]] uint32_t height() const {
+    return height_;
+  }
+
+ private:
+  struct Shelf {
+    uint32_t y = 0;
+    uint32_t height = 0;
+    uint32_t cursorX = 0;
+  };
+
+  uint32_t width_ = 0;
+  uint32_t height_ = 0;
+  uint32_t padding_ = 0;
+  uint32_t nextShelfY_ = 0;
+  std::vector<Shelf> shelves_;
+};
+
+} // namespace iglu::textureatlas
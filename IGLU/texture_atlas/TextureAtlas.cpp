@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <IGLU/texture_atlas/TextureAtlas.h>
+
+#include <cstring>
+
+namespace iglu::textureatlas {
+namespace {
+
+std::shared_ptr<igl::ITextureUploadToken> flushPending(
+    const std::shared_ptr<igl::ITexture>& texture,
+    std::vector<igl::TextureUploadDesc>&& uploads,
+    igl::Result* IGL_NULLABLE outResult) {
+  if (uploads.empty()) {
+    // an empty batch still yields a valid (already completed) token
+    const igl::TextureUploadDesc noop{};
+    return texture->uploadAsync(&noop, 0, outResult);
+  }
+  return texture->uploadAsync(uploads.data(), uploads.size(), outResult);
+}
+
+} // namespace
+
+std::unique_ptr<TextureAtlas> TextureAtlas::create(igl::IDevice& device,
+                                                   const Desc& desc,
+                                                   igl::Result* IGL_NULLABLE outResult) {
+  const igl::TextureDesc textureDesc =
+      igl::TextureDesc::new2D(desc.format,
+                              desc.width,
+                              desc.height,
+                              igl::TextureDesc::TextureUsageBits::Sampled,
+                              desc.debugName ? desc.debugName : "TextureAtlas");
+  auto texture = device.createTexture(textureDesc, outResult);
+  if (!texture) {
+    return nullptr;
+  }
+  return std::unique_ptr<TextureAtlas>(new TextureAtlas(std::move(texture), desc));
+}
+
+TextureAtlas::TextureAtlas(std::shared_ptr<igl::ITexture> texture, const Desc& desc) :
+  texture_(std::move(texture)),
+  properties_(igl::TextureFormatProperties::fromTextureFormat(desc.format)),
+  packer_(desc.width, desc.height, desc.padding) {}
+
+SlotId TextureAtlas::insert(const void* IGL_NONNULL data,
+                            uint32_t width,
+                            uint32_t height,
+                            size_t bytesPerRow) {
+  ShelfPacker::Rect rect;
+  if (!packer_.insert(width, height, rect)) {
+    return kInvalidSlot;
+  }
+  const auto slot = static_cast<SlotId>(slots_.size());
+  slots_.push_back(rect);
+  stage(igl::TextureRangeDesc::new2D(rect.x, rect.y, rect.width, rect.height), data, bytesPerRow);
+  return slot;
+}
+
+igl::Result TextureAtlas::update(SlotId slot, const void* IGL_NONNULL data, size_t bytesPerRow) {
+  if (slot >= slots_.size()) {
+    return igl::Result(igl::Result::Code::ArgumentOutOfRange, "Invalid atlas slot");
+  }
+  const ShelfPacker::Rect& rect = slots_[slot];
+  stage(igl::TextureRangeDesc::new2D(rect.x, rect.y, rect.width, rect.height), data, bytesPerRow);
+  return igl::Result();
+}
+
+void TextureAtlas::stage(const igl::TextureRangeDesc& range,
+                         const void* data,
+                         size_t bytesPerRow) {
+  // copy the pixels so the caller does not have to keep them alive until flush()
+  const size_t rowBytes = bytesPerRow != 0 ? bytesPerRow : properties_.getBytesPerRow(range.width);
+  const auto* bytes = static_cast<const uint8_t*>(data);
+  pendingUploads_.push_back({range, {bytes, bytes + rowBytes * range.height}, bytesPerRow});
+}
+
+std::shared_ptr<igl::ITextureUploadToken> TextureAtlas::flush(igl::Result* IGL_NULLABLE outResult) {
+  std::vector<igl::TextureUploadDesc> uploads;
+  uploads.reserve(pendingUploads_.size());
+  for (const PendingUpload& pending : pendingUploads_) {
+    uploads.push_back({pending.range, pending.data.data(), pending.bytesPerRow});
+  }
+  auto token = flushPending(texture_, std::move(uploads), outResult);
+  pendingUploads_.clear();
+  return token;
+}
+
+ShelfPacker::Rect TextureAtlas::rect(SlotId slot) const {
+  return slot < slots_.size() ? slots_[slot] : ShelfPacker::Rect{};
+}
+
+UVRect TextureAtlas::uvRect(SlotId slot) const {
+  if (slot >= slots_.size()) {
+    return {};
+  }
+  const ShelfPacker::Rect& rect = slots_[slot];
+  const auto width = static_cast<float>(packer_.width());
+  const auto height = static_cast<float>(packer_.height());
+  return {static_cast<float>(rect.x) / width,
+          static_cast<float>(rect.y) / height,
+          static_cast<float>(rect.x + rect.width) / width,
+          static_cast<float>(rect.y + rect.height) / height};
+}
+
+std::unique_ptr<TextureArrayBuilder> TextureArrayBuilder::create(
+    igl::IDevice& device,
+    const Desc& desc,
+    igl::Result* IGL_NULLABLE outResult) {
+  const igl::TextureDesc textureDesc =
+      igl::TextureDesc::new2DArray(desc.format,
+                                   desc.width,
+                                   desc.height,
+                                   desc.numLayers,
+                                   igl::TextureDesc::TextureUsageBits::Sampled,
+                                   desc.debugName ? desc.debugName : "TextureArrayBuilder");
+  auto texture = device.createTexture(textureDesc, outResult);
+  if (!texture) {
+    return nullptr;
+  }
+  return std::unique_ptr<TextureArrayBuilder>(new TextureArrayBuilder(std::move(texture), desc));
+}
+
+TextureArrayBuilder::TextureArrayBuilder(std::shared_ptr<igl::ITexture> texture, const Desc& desc) :
+  texture_(std::move(texture)),
+  properties_(igl::TextureFormatProperties::fromTextureFormat(desc.format)),
+  desc_(desc) {}
+
+SlotId TextureArrayBuilder::insert(const void* IGL_NONNULL data, size_t bytesPerRow) {
+  if (nextLayer_ >= desc_.numLayers) {
+    return kInvalidSlot;
+  }
+  const SlotId slot = nextLayer_++;
+  const igl::Result result = update(slot, data, bytesPerRow);
+  return result.isOk() ? slot : kInvalidSlot;
+}
+
+igl::Result TextureArrayBuilder::update(SlotId slot,
+                                        const void* IGL_NONNULL data,
+                                        size_t bytesPerRow) {
+  if (slot >= nextLayer_) {
+    return igl::Result(igl::Result::Code::ArgumentOutOfRange, "Invalid array slot");
+  }
+  const igl::TextureRangeDesc range =
+      igl::TextureRangeDesc::new2DArray(0, 0, desc_.width, desc_.height, slot, 1);
+  const size_t rowBytes = bytesPerRow != 0 ? bytesPerRow : properties_.getBytesPerRow(desc_.width);
+  const auto* bytes = static_cast<const uint8_t*>(data);
+  pendingUploads_.push_back({range, {bytes, bytes + rowBytes * desc_.height}, bytesPerRow});
+  return igl::Result();
+}
+
+std::shared_ptr<igl::ITextureUploadToken> TextureArrayBuilder::flush(
+    igl::Result* IGL_NULLABLE outResult) {
+  std::vector<igl::TextureUploadDesc> uploads;
+  uploads.reserve(pendingUploads_.size());
+  for (const PendingUpload& pending : pendingUploads_) {
+    uploads.push_back({pending.range, pending.data.data(), pending.bytesPerRow});
+  }
+  auto token = flushPending(texture_, std::move(uploads), outResult);
+  pendingUploads_.clear();
+  return token;
+}
+
+} // namespace iglu::textureatlas
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <IGLU/texture_atlas/ShelfPacker.h>
+#include <igl/Device.h>
+#include <igl/Texture.h>
+#include <memory>
+#include <vector>
+
+namespace iglu::textureatlas {
+
+/// Stable identifier of a slot inside a TextureAtlas or TextureArrayBuilder.
+using SlotId = uint32_t;
+constexpr SlotId kInvalidSlot = 0xFFFFFFFF;
+
+/// Normalized texture coordinates of an atlas slot, for building UVs at draw time.
+struct UVRect {
+  float u0 = 0.0f;
+  float v0 = 0.0f;
+  float u1 = 0.0f;
+  float v1 = 0.0f;
+};
+
+/// Assembles many small images into one 2D texture so UI and decal systems can draw them with a
+/// single bind. Slots are placed with a shelf packer; the pixel data of inserts and updates is
+/// buffered CPU-side and sent in one batched upload (ITexture::uploadAsync()) when flush() is
+/// called, instead of one staging operation per image. Individual slots can be updated later
+/// without re-uploading the rest of the atlas.
+///
+/// Slots cannot be removed: the shelf packer never reclaims space. Systems that recycle images
+/// should update slots in place or rebuild the atlas.
+class TextureAtlas final {
+ public:
+  struct Desc {
+    uint32_t width = 1024;
+    uint32_t height = 1024;
+    igl::TextureFormat format = igl::TextureFormat::RGBA_UNorm8;
+    /// Pixels of empty space around every slot; keep at least 1 when sampling with bilinear
+    /// filtering to avoid bleeding between neighbors
+    uint32_t padding = 1;
+    const char* IGL_NULLABLE debugName = nullptr;
+  };
+
+  /// Creates the atlas texture on `device`. Returns nullptr when texture creation fails
+  static std::unique_ptr<TextureAtlas> create(igl::IDevice& device,
+                                              const Desc& desc,
+                                              igl::Result* IGL_NULLABLE outResult);
+
+  /// Packs a `width` x `height` image into the atlas and stages its pixels for the next flush().
+  /// The data is copied, so the caller may release it on return. Returns kInvalidSlot when the
+  /// atlas is full.
+  /// @param bytesPerRow number of bytes per row of `data`; 0 assumes tight packing
+  SlotId insert(const void* IGL_NONNULL data,
+                uint32_t width,
+                uint32_t height,
+                size_t bytesPerRow = 0);
+
+  /// Stages new pixels for an existing slot; only that slot's rectangle is re-uploaded at the
+  /// next flush(). `data` must cover the slot's full width and height
+  igl::Result update(SlotId slot, const void* IGL_NONNULL data, size_t bytesPerRow = 0);
+
+  /// Sends all staged inserts and updates in one batched upload and returns its completion
+  /// token (already completed when nothing was staged). @see igl::ITexture::uploadAsync
+  std::shared_ptr<igl::ITextureUploadToken> flush(igl::Result* IGL_NULLABLE outResult = nullptr);
+
+  /// Returns the pixel rectangle of a slot
+  [[nodiscard]] ShelfPacker::Rect rect(SlotId slot) const;
+
+  /// Returns the normalized texture coordinates of a slot
+  [[nodiscard]] UVRect uvRect(SlotId slot) const;
+
+  [[nodiscard]] const std::shared_ptr<igl::ITexture>& texture() const {
+    return texture_;
+  }
+
+ private:
+  TextureAtlas(std::shared_ptr<igl::ITexture> texture, const Desc& desc);
+
+  void stage(const igl::TextureRangeDesc& range, const void* data, size_t bytesPerRow);
+
+  std::shared_ptr<igl::ITexture> texture_;
+  igl::TextureFormatProperties properties_;
+  ShelfPacker packer_;
+  std::vector<ShelfPacker::Rect> slots_;
+
+  struct PendingUpload {
+    igl::TextureRangeDesc range;
+    std::vector<uint8_t> data;
+    size_t bytesPerRow = 0;
+  };
+  std::vector<PendingUpload> pendingUploads_;
+};
+
+/// Array-slice variant of TextureAtlas for images that all share one size: every image gets its
+/// own layer of a 2D texture array, so draws can select images with a layer index instead of a
+/// texture bind (and without the UV remapping an atlas requires). Uploads are batched through
+/// flush() the same way.
+class TextureArrayBuilder final {
+ public:
+  struct Desc {
+    uint32_t width = 256;
+    uint32_t height = 256;
+    uint32_t numLayers = 64;
+    igl::TextureFormat format = igl::TextureFormat::RGBA_UNorm8;
+    const char* IGL_NULLABLE debugName = nullptr;
+  };
+
+  /// Creates the array texture on `device`. Returns nullptr when texture creation fails
+  static std::unique_ptr<TextureArrayBuilder> create(igl::IDevice& device,
+                                                     const Desc& desc,
+                                                     igl::Result* IGL_NULLABLE outResult);
+
+  /// Assigns the next free layer to the image and stages its pixels for the next flush().
+  /// Returns kInvalidSlot when all layers are taken; the slot id doubles as the layer index
+  SlotId insert(const void* IGL_NONNULL data, size_t bytesPerRow = 0);
+
+  /// Stages new pixels for an existing layer; only that layer is re-uploaded at the next flush()
+  igl::Result update(SlotId slot, const void* IGL_NONNULL data, size_t bytesPerRow = 0);
+
+  /// Sends all staged inserts and updates in one batched upload and returns its completion
+  /// token (already completed when nothing was staged). @see igl::ITexture::uploadAsync
+  std::shared_ptr<igl::ITextureUploadToken> flush(igl::Result* IGL_NULLABLE outResult = nullptr);
+
+  [[nodiscard]] const std::shared_ptr<igl::ITexture>& texture() const {
+    return texture_;
+  }
+
+ private:
+  TextureArrayBuilder(std::shared_ptr<igl::ITexture> texture, const Desc& desc);
+
+  std::shared_ptr<igl::ITexture> texture_;
+  igl::TextureFormatProperties properties_;
+  Desc desc_;
+  uint32_t nextLayer_ = 0;
+
+  struct PendingUpload {
+    igl::TextureRangeDesc range;
+    std::vector<uint8_t> data;
+    size_t bytesPerRow = 0;
+  };
+  std::vector<PendingUpload> pendingUploads_;
+};
+
+} // namespace iglu::textureatlas
@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <IGLU/texture_loader/AsyncTextureLoader.h>
+
+#include <algorithm>
+#include <igl/Device.h>
+
+namespace iglu::textureloader {
+
+AsyncTextureLoader::AsyncTextureLoader(igl::IDevice& device, size_t workerCount) :
+  device_(device) {
+  if (workerCount == 0) {
+    const auto cores = static_cast<size_t>(std::thread::hardware_concurrency());
+    workerCount = cores > 1 ? cores - 1 : 1;
+  }
+  workers_.reserve(workerCount);
+  for (size_t i = 0; i < workerCount; ++i) {
+    workers_.emplace_back([this] { workerLoop(); });
+  }
+}
+
+AsyncTextureLoader::~AsyncTextureLoader() {
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  decodeCondition_.notify_all();
+  for (auto& worker : workers_) {
+    worker.join();
+  }
+}
+
+void AsyncTextureLoader::loadAsync(std::unique_ptr<ITextureLoader> loader,
+                                   CompletionCallback callback,
+                                   LoadPriority priority) {
+  if (!IGL_VERIFY(loader != nullptr)) {
+    return;
+  }
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    decodeQueues_[static_cast<size_t>(priority)].push_back(
+        Job{std::move(loader), std::move(callback), nullptr, igl::Result()});
+  }
+  decodeCondition_.notify_one();
+}
+
+void AsyncTextureLoader::loadProgressiveAsync(std::unique_ptr<ITextureLoader> loader,
+                                              uint32_t initialMipLevels,
+                                              ProgressCallback progressCallback,
+                                              CompletionCallback callback,
+                                              LoadPriority priority) {
+  if (!IGL_VERIFY(loader != nullptr)) {
+    return;
+  }
+  Job job{std::move(loader), std::move(callback), nullptr, igl::Result()};
+  job.progressCallback = std::move(progressCallback);
+  job.initialMipLevels = std::max(initialMipLevels, 1u);
+  job.progressive = true;
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    decodeQueues_[static_cast<size_t>(priority)].push_back(std::move(job));
+  }
+  decodeCondition_.notify_one();
+}
+
+bool AsyncTextureLoader::popDecodeJob(Job& outJob, size_t& outPriority) {
+  for (size_t priority = 0; priority < kNumPriorities; ++priority) {
+    if (!decodeQueues_[priority].empty()) {
+      outJob = std::move(decodeQueues_[priority].front());
+      decodeQueues_[priority].pop_front();
+      outPriority = priority;
+      return true;
+    }
+  }
+  return false;
+}
+
+void AsyncTextureLoader::workerLoop() {
+  while (true) {
+    Job job;
+    size_t priority = 0;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      decodeCondition_.wait(lock, [this, &job, &priority] {
+        return stop_ || popDecodeJob(job, priority);
+      });
+      if (stop_) {
+        return;
+      }
+      decodesInFlight_++;
+    }
+
+    // Loaders that upload straight from the source bytes (e.g. ktx) have nothing to decode;
+    // everything else does its CPU decode here, in parallel across workers
+    if (!job.loader->canUploadSourceData()) {
+      job.decodedData = job.loader->load(&job.decodeResult);
+    }
+
+    {
+      const std::lock_guard<std::mutex> lock(mutex_);
+      decodesInFlight_--;
+      uploadQueues_[priority].push_back(std::move(job));
+    }
+  }
+}
+
+size_t AsyncTextureLoader::processUploads(size_t maxUploads) {
+  size_t processed = 0;
+  while (processed < maxUploads) {
+    Job job;
+    size_t priority = 0;
+    {
+      const std::lock_guard<std::mutex> lock(mutex_);
+      bool found = false;
+      for (; priority < kNumPriorities; ++priority) {
+        if (!uploadQueues_[priority].empty()) {
+          job = std::move(uploadQueues_[priority].front());
+          uploadQueues_[priority].pop_front();
+          found = true;
+          break;
+        }
+      }
+      if (!found) {
+        break;
+      }
+    }
+
+    processed++;
+
+    if (job.texture != nullptr) {
+      // Progressive job mid-stream: upload the next finer level and re-queue until level 0 lands.
+      igl::Result result;
+      job.loader->uploadMipRange(*job.texture, job.nextMipLevel, 1u, &result);
+      if (!result.isOk()) {
+        if (job.callback) {
+          job.callback(nullptr, std::move(result));
+        }
+        continue;
+      }
+      if (job.progressCallback) {
+        job.progressCallback(job.texture, job.nextMipLevel);
+      }
+      if (job.nextMipLevel == 0) {
+        if (job.callback) {
+          job.callback(std::move(job.texture), igl::Result());
+        }
+      } else {
+        job.nextMipLevel--;
+        const std::lock_guard<std::mutex> lock(mutex_);
+        uploadQueues_[priority].push_back(std::move(job));
+      }
+      continue;
+    }
+
+    if (!job.decodeResult.isOk()) {
+      if (job.callback) {
+        job.callback(nullptr, std::move(job.decodeResult));
+      }
+      continue;
+    }
+
+    igl::Result result;
+    auto texture = job.loader->create(device_, &result);
+    if (texture) {
+      const auto numMipLevels = static_cast<uint32_t>(texture->getNumMipLevels());
+      // Streaming needs per-level access to source data; CPU-decoded and mipmap-generating
+      // loaders upload in one shot below instead.
+      const bool streamable = job.progressive && job.loader->canUploadSourceData() &&
+                              !job.loader->shouldGenerateMipmaps() &&
+                              numMipLevels > job.initialMipLevels;
+      if (streamable) {
+        const uint32_t firstCoarseLevel = numMipLevels - job.initialMipLevels;
+        job.loader->uploadMipRange(*texture, firstCoarseLevel, job.initialMipLevels, &result);
+        if (result.isOk()) {
+          // The texture is usable now; re-queue to the back so other pending textures get their
+          // coarse levels before anything streams fine detail.
+          job.texture = texture;
+          job.nextMipLevel = firstCoarseLevel - 1u;
+          if (job.progressCallback) {
+            job.progressCallback(job.texture, firstCoarseLevel);
+          }
+          const std::lock_guard<std::mutex> lock(mutex_);
+          uploadQueues_[priority].push_back(std::move(job));
+          continue;
+        }
+      } else if (job.decodedData) {
+        const auto range = job.loader->shouldGenerateMipmaps() ? texture->getFullRange()
+                                                               : texture->getFullMipRange();
+        result = texture->upload(range, job.decodedData->data());
+      } else {
+        job.loader->upload(*texture, &result);
+      }
+    }
+    if (job.progressive && result.isOk() && texture != nullptr && job.progressCallback) {
+      job.progressCallback(texture, 0u);
+    }
+    if (job.callback) {
+      job.callback(result.isOk() ? std::move(texture) : nullptr, std::move(result));
+    }
+  }
+  return processed;
+}
+
+size_t AsyncTextureLoader::pendingCount() const {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  size_t count = decodesInFlight_;
+  for (size_t priority = 0; priority < kNumPriorities; ++priority) {
+    count += decodeQueues_[priority].size() + uploadQueues_[priority].size();
+  }
+  return count;
+}
+
+} // namespace iglu::textureloader
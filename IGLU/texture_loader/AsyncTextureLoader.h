@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <IGLU/texture_loader/ITextureLoader.h>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace igl {
+class IDevice;
+} // namespace igl
+
+namespace iglu::textureloader {
+
+/// Scheduling priority for asynchronous texture loads. Workers always drain higher priorities
+/// first, so on-screen textures preempt prefetches that were queued earlier.
+enum class LoadPriority : uint8_t {
+  High = 0, ///< Visible right now; decode before anything else
+  Normal = 1,
+  Low = 2, ///< Prefetch; only decoded when nothing more urgent is queued
+};
+
+/// Two-stage asynchronous texture loading pipeline.
+///
+/// Stage one is a worker pool that runs ITextureLoader::load() — pure CPU decode work that
+/// parallelizes across cores. Stage two is the GPU upload, which runs on whatever thread calls
+/// processUploads(); keeping uploads on one caller-owned thread works with thread-affine
+/// backends (OpenGL) and lets the app bound per-frame upload time. Completion callbacks fire
+/// from processUploads() after the texture is created and its data uploaded.
+class AsyncTextureLoader final {
+ public:
+  /// Called from processUploads() with the finished texture, or nullptr and a failing Result
+  /// when decode, creation, or upload failed.
+  using CompletionCallback =
+      std::function<void(std::shared_ptr<igl::ITexture> texture, igl::Result result)>;
+
+  /// @param device the device textures are created on; must outlive the loader
+  /// @param workerCount number of decode threads; 0 picks one per core, leaving one for the
+  /// render thread
+  explicit AsyncTextureLoader(igl::IDevice& device, size_t workerCount = 0);
+
+  /// Joins the workers. Loads still queued or decoded but not yet uploaded are discarded and
+  /// their callbacks never fire.
+  ~AsyncTextureLoader();
+
+  AsyncTextureLoader(const AsyncTextureLoader&) = delete;
+  AsyncTextureLoader& operator=(const AsyncTextureLoader&) = delete;
+
+  /// Called from processUploads() each time more mip levels become valid.
+  /// 'finestUploadedMipLevel' is the lowest (most detailed) level uploaded so far; the app hands
+  /// off by lowering its sampler min LOD (or mip bias) to that level. Level 0 means complete.
+  using ProgressCallback =
+      std::function<void(const std::shared_ptr<igl::ITexture>& texture,
+                         uint32_t finestUploadedMipLevel)>;
+
+  /// Queues 'loader' for decoding on the worker pool. The loader is consumed; the callback fires
+  /// from a later processUploads() call.
+  void loadAsync(std::unique_ptr<ITextureLoader> loader,
+                 CompletionCallback callback,
+                 LoadPriority priority = LoadPriority::Normal);
+
+  /// Like loadAsync(), but streams the texture progressively: the smallest 'initialMipLevels'
+  /// levels upload first (a cheap contiguous read for containers like ktx2) and 'progressCallback'
+  /// fires with a usable texture right away. Remaining levels then stream coarse-to-fine, one
+  /// level per processUploads() pass, interleaved with other queued loads so every pending
+  /// texture gets its coarse levels before any gets its fine ones. 'callback' fires once level 0
+  /// has landed. Loaders that decode on the CPU or generate mipmaps fall back to a single full
+  /// upload, with 'progressCallback' and 'callback' firing together.
+  void loadProgressiveAsync(std::unique_ptr<ITextureLoader> loader,
+                            uint32_t initialMipLevels,
+                            ProgressCallback progressCallback,
+                            CompletionCallback callback,
+                            LoadPriority priority = LoadPriority::Normal);
+
+  /// Runs the GPU-upload stage for decoded loads, highest priority first: creates each texture,
+  /// uploads its data, and fires the completion callback. Call once per frame from the thread
+  /// that owns GPU submission.
+  /// @param maxUploads caps the number of uploads this call performs, to bound per-frame time
+  /// @return the number of loads completed (including failed ones)
+  size_t processUploads(size_t maxUploads = SIZE_MAX);
+
+  /// Loads queued or decoded but not yet handed to a completion callback.
+  [[nodiscard]] size_t pendingCount() const;
+
+ private:
+  struct Job {
+    std::unique_ptr<ITextureLoader> loader;
+    CompletionCallback callback;
+    std::unique_ptr<IData> decodedData; // stage two input; nullptr when uploading source data
+    igl::Result decodeResult;
+    // Progressive streaming state; 'texture' is set once the coarse levels have uploaded and the
+    // job is re-queued for the remaining levels.
+    ProgressCallback progressCallback;
+    std::shared_ptr<igl::ITexture> texture;
+    uint32_t initialMipLevels = 0;
+    uint32_t nextMipLevel = 0;
+    bool progressive = false;
+  };
+
+  static constexpr size_t kNumPriorities = 3;
+
+  void workerLoop();
+  [[nodiscard]] bool popDecodeJob(Job& outJob, size_t& outPriority);
+
+  igl::IDevice& device_;
+
+  mutable std::mutex mutex_;
+  std::condition_variable decodeCondition_;
+  std::deque<Job> decodeQueues_[kNumPriorities];
+  std::deque<Job> uploadQueues_[kNumPriorities];
+  size_t decodesInFlight_ = 0;
+  bool stop_ = false;
+
+  std::vector<std::thread> workers_;
+};
+
+} // namespace iglu::textureloader
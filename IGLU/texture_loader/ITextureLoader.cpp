@@ -103,6 +103,36 @@ void ITextureLoader::upload(igl::ITexture& texture,
   uploadInternal(texture, outResult);
 }
 
+void ITextureLoader::uploadMipRange(igl::ITexture& texture,
+                                    uint32_t fromMipLevel,
+                                    uint32_t numMipLevels,
+                                    igl::Result* IGL_NULLABLE outResult) const noexcept {
+  if (shouldGenerateMipmaps()) {
+    igl::Result::setResult(outResult,
+                           igl::Result::Code::InvalidOperation,
+                           "Loader only carries level 0 data; mip ranges cannot be streamed.");
+    return;
+  }
+  if (numMipLevels == 0 ||
+      static_cast<size_t>(fromMipLevel) + static_cast<size_t>(numMipLevels) >
+          texture.getNumMipLevels()) {
+    igl::Result::setResult(
+        outResult, igl::Result::Code::ArgumentOutOfRange, "Mip range is out of range.");
+    return;
+  }
+  const auto dimensions = texture.getDimensions();
+  if (texture.getType() != desc_.type || texture.getNumMipLevels() != desc_.numMipLevels ||
+      texture.getNumLayers() != desc_.numLayers || dimensions.width != desc_.width ||
+      dimensions.height != desc_.height || dimensions.depth != desc_.depth ||
+      texture.getFormat() != desc_.format) {
+    igl::Result::setResult(
+        outResult, igl::Result::Code::InvalidOperation, "Texture descriptor mismatch.");
+    return;
+  }
+
+  uploadMipRangeInternal(texture, fromMipLevel, numMipLevels, outResult);
+}
+
 std::unique_ptr<IData> ITextureLoader::load(igl::Result* IGL_NULLABLE outResult) const noexcept {
   return loadInternal(outResult);
 }
@@ -146,6 +176,31 @@ void ITextureLoader::defaultUpload(igl::ITexture& texture,
   igl::Result::setResult(outResult, std::move(result));
 }
 
+void ITextureLoader::defaultUploadMipRange(igl::ITexture& texture,
+                                           uint32_t fromMipLevel,
+                                           uint32_t numMipLevels,
+                                           igl::Result* IGL_NULLABLE outResult) const noexcept {
+  std::unique_ptr<IData> data;
+
+  if (!canUploadSourceData()) {
+    data = load(outResult);
+    if (!data) {
+      return;
+    }
+  }
+
+  // Levels are contiguous in the loaded blob, largest first; skip the levels before the range.
+  const auto properties = igl::TextureFormatProperties::fromTextureFormat(desc_.format);
+  size_t offset = 0;
+  for (uint32_t mipLevel = 0; mipLevel < fromMipLevel; ++mipLevel) {
+    offset += properties.getBytesPerRange(texture.getFullRange(mipLevel));
+  }
+
+  auto result = texture.upload(texture.getFullRange(fromMipLevel, numMipLevels),
+                               (data ? data->data() : reader_.data()) + offset);
+  igl::Result::setResult(outResult, std::move(result));
+}
+
 std::unique_ptr<IData> ITextureLoader::defaultLoad(
     igl::Result* IGL_NULLABLE outResult) const noexcept {
   const uint32_t length = memorySizeInBytes();
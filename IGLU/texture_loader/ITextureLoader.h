@@ -53,6 +53,14 @@ class ITextureLoader {
 
   void upload(igl::ITexture& texture, igl::Result* IGL_NULLABLE outResult) const noexcept;
 
+  /// Uploads only mip levels [fromMipLevel, fromMipLevel + numMipLevels). Lets callers stream a
+  /// texture progressively: coarse levels first so it is usable immediately, finer levels later.
+  /// Fails with InvalidOperation for loaders that only carry level 0 data (shouldGenerateMipmaps).
+  void uploadMipRange(igl::ITexture& texture,
+                      uint32_t fromMipLevel,
+                      uint32_t numMipLevels,
+                      igl::Result* IGL_NULLABLE outResult) const noexcept;
+
   [[nodiscard]] std::unique_ptr<IData> load(igl::Result* IGL_NULLABLE outResult) const noexcept;
   void loadToExternalMemory(uint8_t* IGL_NONNULL data,
                             uint32_t length,
@@ -73,6 +81,13 @@ class ITextureLoader {
     defaultUpload(texture, outResult);
   }
 
+  virtual void uploadMipRangeInternal(igl::ITexture& texture,
+                                      uint32_t fromMipLevel,
+                                      uint32_t numMipLevels,
+                                      igl::Result* IGL_NULLABLE outResult) const noexcept {
+    defaultUploadMipRange(texture, fromMipLevel, numMipLevels, outResult);
+  }
+
   [[nodiscard]] virtual std::unique_ptr<IData> loadInternal(
       igl::Result* IGL_NULLABLE outResult) const noexcept {
     return defaultLoad(outResult);
@@ -86,6 +101,10 @@ class ITextureLoader {
 
  private:
   void defaultUpload(igl::ITexture& texture, igl::Result* IGL_NULLABLE outResult) const noexcept;
+  void defaultUploadMipRange(igl::ITexture& texture,
+                             uint32_t fromMipLevel,
+                             uint32_t numMipLevels,
+                             igl::Result* IGL_NULLABLE outResult) const noexcept;
   [[nodiscard]] std::unique_ptr<IData> defaultLoad(
       igl::Result* IGL_NULLABLE outResult) const noexcept;
   void defaultLoadToExternalMemory(uint8_t* IGL_NONNULL data,
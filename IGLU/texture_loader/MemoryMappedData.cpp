@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <IGLU/texture_loader/MemoryMappedData.h>
+
+#include <igl/Macros.h>
+#include <limits>
+
+#if IGL_PLATFORM_WIN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace iglu::textureloader {
+
+std::unique_ptr<IData> MemoryMappedData::tryCreate(const char* IGL_NONNULL path,
+                                                   igl::Result* IGL_NULLABLE outResult) {
+#if IGL_PLATFORM_WIN
+  HANDLE file = CreateFileA(
+      path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE) {
+    igl::Result::setResult(outResult, igl::Result::Code::RuntimeError, "could not open file.");
+    return nullptr;
+  }
+
+  LARGE_INTEGER fileSize = {};
+  if (!GetFileSizeEx(file, &fileSize)) {
+    CloseHandle(file);
+    igl::Result::setResult(outResult, igl::Result::Code::RuntimeError, "could not stat file.");
+    return nullptr;
+  }
+  if (fileSize.QuadPart <= 0 ||
+      fileSize.QuadPart > static_cast<LONGLONG>(std::numeric_limits<uint32_t>::max())) {
+    CloseHandle(file);
+    igl::Result::setResult(
+        outResult, igl::Result::Code::ArgumentInvalid, "file is empty or too large.");
+    return nullptr;
+  }
+
+  HANDLE fileMapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (fileMapping == nullptr) {
+    CloseHandle(file);
+    igl::Result::setResult(outResult, igl::Result::Code::RuntimeError, "could not map file.");
+    return nullptr;
+  }
+
+  void* mapping = MapViewOfFile(fileMapping, FILE_MAP_READ, 0, 0, 0);
+  // the view keeps the mapping and file alive; the handles can be dropped right away
+  CloseHandle(fileMapping);
+  CloseHandle(file);
+  if (mapping == nullptr) {
+    igl::Result::setResult(outResult, igl::Result::Code::RuntimeError, "could not map file.");
+    return nullptr;
+  }
+
+  igl::Result::setOk(outResult);
+  return std::unique_ptr<IData>(
+      new MemoryMappedData(mapping, static_cast<uint32_t>(fileSize.QuadPart)));
+#else
+  const int fd = open(path, O_RDONLY); // NOLINT(cppcoreguidelines-pro-type-vararg)
+  if (fd < 0) {
+    igl::Result::setResult(outResult, igl::Result::Code::RuntimeError, "could not open file.");
+    return nullptr;
+  }
+
+  struct stat fileInfo = {};
+  if (fstat(fd, &fileInfo) != 0) {
+    close(fd);
+    igl::Result::setResult(outResult, igl::Result::Code::RuntimeError, "could not stat file.");
+    return nullptr;
+  }
+  if (fileInfo.st_size <= 0 ||
+      static_cast<uint64_t>(fileInfo.st_size) > std::numeric_limits<uint32_t>::max()) {
+    close(fd);
+    igl::Result::setResult(
+        outResult, igl::Result::Code::ArgumentInvalid, "file is empty or too large.");
+    return nullptr;
+  }
+
+  void* mapping =
+      mmap(nullptr, static_cast<size_t>(fileInfo.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+  // the mapping keeps the file alive; the descriptor can be dropped right away
+  close(fd);
+  if (mapping == MAP_FAILED) {
+    igl::Result::setResult(outResult, igl::Result::Code::RuntimeError, "could not map file.");
+    return nullptr;
+  }
+
+  igl::Result::setOk(outResult);
+  return std::unique_ptr<IData>(
+      new MemoryMappedData(mapping, static_cast<uint32_t>(fileInfo.st_size)));
+#endif
+}
+
+MemoryMappedData::MemoryMappedData(void* IGL_NONNULL mapping, uint32_t length) noexcept :
+  mapping_(mapping), length_(length) {}
+
+MemoryMappedData::~MemoryMappedData() {
+#if IGL_PLATFORM_WIN
+  UnmapViewOfFile(mapping_);
+#else
+  munmap(mapping_, static_cast<size_t>(length_));
+#endif
+}
+
+const uint8_t* IGL_NONNULL MemoryMappedData::data() const noexcept {
+  return static_cast<const uint8_t*>(mapping_);
+}
+
+uint32_t MemoryMappedData::length() const noexcept {
+  return length_;
+}
+
+} // namespace iglu::textureloader
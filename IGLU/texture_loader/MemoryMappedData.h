@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <IGLU/texture_loader/IData.h>
+
+namespace iglu::textureloader {
+
+/// IData backed by a read-only memory-mapped file.
+///
+/// Mapping keeps the file bytes in the page cache instead of duplicating them on the heap, so
+/// loaders parse headers and upload texel data straight from the mapping: a DataReader created
+/// over this data is zero-copy, and upload paths that copy from the pointer (e.g. the Vulkan
+/// staging device) read directly from the mapped region. Ideal for container formats like ktx
+/// whose payload is uploaded as-is; decoded formats (png/jpeg) still avoid the transient
+/// file-sized heap copy.
+class MemoryMappedData final : public IData {
+ public:
+  /// Maps 'path' read-only. Fails with Result::Code::RuntimeError when the file cannot be opened
+  /// or mapped, and with ArgumentInvalid when it is empty or too large for IData's 32-bit length.
+  static std::unique_ptr<IData> tryCreate(const char* IGL_NONNULL path,
+                                          igl::Result* IGL_NULLABLE outResult);
+
+  ~MemoryMappedData() final;
+
+  MemoryMappedData(const MemoryMappedData&) = delete;
+  MemoryMappedData& operator=(const MemoryMappedData&) = delete;
+
+  [[nodiscard]] const uint8_t* IGL_NONNULL data() const noexcept final;
+  [[nodiscard]] uint32_t length() const noexcept final;
+
+ private:
+  MemoryMappedData(void* IGL_NONNULL mapping, uint32_t length) noexcept;
+
+  void* IGL_NONNULL mapping_;
+  uint32_t length_ = 0;
+};
+
+} // namespace iglu::textureloader
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <IGLU/texture_loader/cache/DiskCache.h>
+
+#include <IGLU/texture_loader/MemoryMappedData.h>
+#include <IGLU/texture_loader/cache/Header.h>
+#include <atomic>
+#include <cstdio>
+#include <igl/Macros.h>
+
+#if IGL_PLATFORM_WIN
+#include <windows.h>
+#endif
+
+namespace iglu::textureloader::cache {
+namespace {
+
+bool renameReplacing(const char* IGL_NONNULL from, const char* IGL_NONNULL to) noexcept {
+#if IGL_PLATFORM_WIN
+  // std::rename() fails on Windows when the destination exists
+  return MoveFileExA(from, to, MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+  return std::rename(from, to) == 0;
+#endif
+}
+
+} // namespace
+
+DiskCache::DiskCache(std::string directory) noexcept : directory_(std::move(directory)) {
+  while (!directory_.empty() && (directory_.back() == '/' || directory_.back() == '\\')) {
+    directory_.pop_back();
+  }
+}
+
+std::string DiskCache::blobPath(uint64_t assetHash, igl::TextureFormat format) const {
+  char fileName[64];
+  snprintf(fileName,
+           sizeof(fileName),
+           "/%016llx-%02x.igltc",
+           static_cast<unsigned long long>(assetHash),
+           static_cast<unsigned>(format));
+  return directory_ + fileName;
+}
+
+std::unique_ptr<ITextureLoader> DiskCache::tryLoad(uint64_t assetHash,
+                                                   igl::TextureFormat format,
+                                                   igl::Result* IGL_NULLABLE
+                                                       outResult) const noexcept {
+  auto data = MemoryMappedData::tryCreate(blobPath(assetHash, format).c_str(), outResult);
+  if (!data) {
+    return nullptr;
+  }
+
+  return factory_.tryCreateOwning(std::move(data), outResult);
+}
+
+void DiskCache::store(uint64_t assetHash,
+                      const igl::TextureDesc& desc,
+                      bool shouldGenerateMipmaps,
+                      const uint8_t* IGL_NONNULL payload,
+                      uint32_t payloadLength,
+                      igl::Result* IGL_NULLABLE outResult) const noexcept {
+  if (payload == nullptr) {
+    igl::Result::setResult(outResult, igl::Result::Code::ArgumentNull, "payload is nullptr.");
+    return;
+  }
+
+  Header header;
+  header.tag = currentTag();
+  header.format = static_cast<uint32_t>(desc.format);
+  header.type = static_cast<uint32_t>(desc.type);
+  header.width = static_cast<uint32_t>(desc.width);
+  header.height = static_cast<uint32_t>(desc.height);
+  header.depth = static_cast<uint32_t>(desc.depth);
+  header.numLayers = static_cast<uint32_t>(desc.numLayers);
+  header.numMipLevels = shouldGenerateMipmaps ? 0u : static_cast<uint32_t>(desc.numMipLevels);
+  header.payloadLength = payloadLength;
+
+  const auto properties = igl::TextureFormatProperties::fromTextureFormat(desc.format);
+  igl::TextureRangeDesc range;
+  range.width = desc.width;
+  range.height = desc.height;
+  range.depth = desc.depth;
+  range.numFaces = desc.type == igl::TextureType::Cube ? 6u : 1u;
+  range.numLayers = desc.numLayers;
+  range.numMipLevels = std::max(header.numMipLevels, 1u);
+  if (properties.getBytesPerRange(range) != static_cast<size_t>(payloadLength)) {
+    igl::Result::setResult(outResult,
+                           igl::Result::Code::ArgumentInvalid,
+                           "payloadLength doesn't match the texture descriptor.");
+    return;
+  }
+
+  const std::string path = blobPath(assetHash, desc.format);
+
+  // per-writer temporary name: two threads storing the same key race on the rename, not on the
+  // file contents, and the rename is atomic either way
+  static std::atomic<uint32_t> writeCounter{0};
+  char suffix[32];
+  snprintf(suffix, sizeof(suffix), ".%u.tmp", writeCounter.fetch_add(1u) + 1u);
+  const std::string temporaryPath = path + suffix;
+
+  FILE* file = fopen(temporaryPath.c_str(), "wb"); // NOLINT(cppcoreguidelines-pro-type-vararg)
+  if (file == nullptr) {
+    igl::Result::setResult(
+        outResult, igl::Result::Code::RuntimeError, "could not open cache file for writing.");
+    return;
+  }
+
+  const bool written = fwrite(&header, kHeaderLength, 1, file) == 1 &&
+                       fwrite(payload, payloadLength, 1, file) == 1;
+  const bool closed = fclose(file) == 0;
+  if (!written || !closed) {
+    std::remove(temporaryPath.c_str());
+    igl::Result::setResult(
+        outResult, igl::Result::Code::RuntimeError, "could not write cache file.");
+    return;
+  }
+
+  if (!renameReplacing(temporaryPath.c_str(), path.c_str())) {
+    std::remove(temporaryPath.c_str());
+    igl::Result::setResult(
+        outResult, igl::Result::Code::RuntimeError, "could not move cache file into place.");
+    return;
+  }
+
+  igl::Result::setOk(outResult);
+}
+
+} // namespace iglu::textureloader::cache
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <IGLU/texture_loader/cache/TextureLoaderFactory.h>
+#include <igl/Texture.h>
+#include <string>
+
+namespace iglu::textureloader::cache {
+
+/// Persistent store of device-native texture blobs, keyed by (asset hash, texture format).
+///
+/// Intended for runtime transcoding flows where the shipped container format is not native to
+/// the device (e.g. ASTC assets on a BC-only desktop GPU): the first load transcodes and calls
+/// store() with the device-native bytes; later launches hit tryLoad(), which memory-maps the
+/// blob and returns a loader that uploads straight from the mapping - no decode, no transcode
+/// and no file-sized heap copy. Keying on the texture format keeps caches for different devices
+/// (or a swapped GPU) from colliding, and the blob tag carries a format version so stale blobs
+/// are re-generated rather than migrated.
+///
+/// store() writes to a temporary file and renames it into place, so concurrent loads never
+/// observe a partial blob. tryLoad() and store() keep no shared mutable state and can be called
+/// from any thread - e.g. from AsyncTextureLoader decode workers, which is where first-load
+/// transcodes parallelize across cores.
+class DiskCache {
+ public:
+  /// @param directory an existing, writable directory the blobs are stored in
+  explicit DiskCache(std::string directory) noexcept;
+
+  /// Returns a loader over the cached blob for (assetHash, format), or nullptr on a cache miss
+  /// or when the blob fails validation. The loader owns the file mapping.
+  [[nodiscard]] std::unique_ptr<ITextureLoader> tryLoad(
+      uint64_t assetHash,
+      igl::TextureFormat format,
+      igl::Result* IGL_NULLABLE outResult) const noexcept;
+
+  /// Writes the device-native payload for (assetHash, desc.format). The payload must have the
+  /// layout igl::ITexture::upload() consumes: levels tightly packed, largest first.
+  /// @param shouldGenerateMipmaps true when the payload carries level 0 only and the remaining
+  /// levels are generated at upload time
+  void store(uint64_t assetHash,
+             const igl::TextureDesc& desc,
+             bool shouldGenerateMipmaps,
+             const uint8_t* IGL_NONNULL payload,
+             uint32_t payloadLength,
+             igl::Result* IGL_NULLABLE outResult) const noexcept;
+
+  /// Path of the blob for (assetHash, format); exposed so callers can evict or inspect entries
+  [[nodiscard]] std::string blobPath(uint64_t assetHash, igl::TextureFormat format) const;
+
+ private:
+  std::string directory_;
+  TextureLoaderFactory factory_;
+};
+
+} // namespace iglu::textureloader::cache
@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <IGLU/texture_loader/cache/Header.h>
+
+#include <cstring>
+
+namespace iglu::textureloader::cache {
+namespace {
+// the trailing bytes are the blob format version; bump them when the layout changes
+constexpr const Tag kCacheBlobIdentifier{{'I', 'G', 'L', 'T', 'C', '\n', '0', '1'}};
+} // namespace
+
+bool Header::tagIsValid() const noexcept {
+  return std::memcmp(tag.data(), kCacheBlobIdentifier.data(), kCacheBlobIdentifier.size()) == 0;
+}
+
+Tag currentTag() noexcept {
+  return kCacheBlobIdentifier;
+}
+
+} // namespace iglu::textureloader::cache
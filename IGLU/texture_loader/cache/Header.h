@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <igl/Texture.h>
+
+namespace iglu::textureloader::cache {
+
+using Tag = std::array<uint8_t, 8>;
+
+/// On-disk header of a device-native texture blob written by DiskCache. The tag embeds the blob
+/// format version, so blobs written by an incompatible version fail tagIsValid() and are simply
+/// re-generated instead of being migrated.
+struct Header {
+  Tag tag;
+  uint32_t format = 0; ///< igl::TextureFormat the payload is encoded in
+  uint32_t type = 0; ///< igl::TextureType
+  uint32_t width = 0;
+  uint32_t height = 0;
+  uint32_t depth = 0;
+  uint32_t numLayers = 0;
+  /// 0 means the payload carries level 0 only and the remaining levels are generated at upload
+  uint32_t numMipLevels = 0;
+  /// bytes following the header: levels tightly packed, largest first, exactly the layout
+  /// igl::ITexture::upload() consumes for a multi-mip range
+  uint32_t payloadLength = 0;
+
+  [[nodiscard]] bool tagIsValid() const noexcept;
+};
+static_assert(sizeof(Header) == 40);
+
+constexpr uint32_t kHeaderLength = static_cast<uint32_t>(sizeof(Header));
+
+/// The tag (including format version) blobs are written with; see Header::tagIsValid()
+[[nodiscard]] Tag currentTag() noexcept;
+
+} // namespace iglu::textureloader::cache
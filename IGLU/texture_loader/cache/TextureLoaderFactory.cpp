@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <IGLU/texture_loader/cache/TextureLoaderFactory.h>
+
+#include <IGLU/texture_loader/cache/Header.h>
+
+namespace iglu::textureloader::cache {
+namespace {
+
+/**
+ * @brief Uploads the cached payload directly from the source bytes. The payload already has the
+ * layout igl::ITexture::upload() expects for a multi-mip range, so the only remaining copy on
+ * the way to the GPU is the one into the backend's staging buffer. Optionally owns the backing
+ * IData so a memory-mapped cache file lives exactly as long as the loader.
+ */
+class BlobTextureLoader : public ITextureLoader {
+  using Super = ITextureLoader;
+
+ public:
+  BlobTextureLoader(DataReader payloadReader,
+                    const Header& header,
+                    std::unique_ptr<IData> ownedData) noexcept;
+
+  [[nodiscard]] bool canUploadSourceData() const noexcept final {
+    return true;
+  }
+  [[nodiscard]] bool shouldGenerateMipmaps() const noexcept final {
+    return shouldGenerateMipmaps_;
+  }
+
+ private:
+  std::unique_ptr<IData> ownedData_;
+  bool shouldGenerateMipmaps_ = false;
+};
+
+BlobTextureLoader::BlobTextureLoader(DataReader payloadReader,
+                                     const Header& header,
+                                     std::unique_ptr<IData> ownedData) noexcept :
+  Super(payloadReader),
+  ownedData_(std::move(ownedData)),
+  shouldGenerateMipmaps_(header.numMipLevels == 0u) {
+  auto& desc = mutableDescriptor();
+  desc.format = static_cast<igl::TextureFormat>(header.format);
+  desc.type = static_cast<igl::TextureType>(header.type);
+  desc.width = std::max(header.width, 1u);
+  desc.height = std::max(header.height, 1u);
+  desc.depth = std::max(header.depth, 1u);
+  desc.numLayers = std::max(header.numLayers, 1u);
+  desc.numMipLevels = std::max(header.numMipLevels, 1u);
+}
+
+const Header* IGL_NULLABLE validateHeader(DataReader reader,
+                                          igl::Result* IGL_NULLABLE outResult) noexcept {
+  if (reader.data() == nullptr) {
+    igl::Result::setResult(
+        outResult, igl::Result::Code::ArgumentInvalid, "Reader's data is nullptr.");
+    return nullptr;
+  }
+  if (reader.length() < kHeaderLength) {
+    igl::Result::setResult(
+        outResult, igl::Result::Code::ArgumentOutOfRange, "Not enough data for header.");
+    return nullptr;
+  }
+
+  const Header* header = reader.as<Header>();
+  if (!header->tagIsValid()) {
+    igl::Result::setResult(outResult, igl::Result::Code::InvalidOperation, "Incorrect identifier.");
+    return nullptr;
+  }
+
+  const auto format = static_cast<igl::TextureFormat>(header->format);
+  if (header->format > 0xffu || format == igl::TextureFormat::Invalid) {
+    igl::Result::setResult(
+        outResult, igl::Result::Code::InvalidOperation, "Unrecognized texture format.");
+    return nullptr;
+  }
+
+  const auto type = static_cast<igl::TextureType>(header->type);
+  if (type != igl::TextureType::TwoD && type != igl::TextureType::TwoDArray &&
+      type != igl::TextureType::ThreeD && type != igl::TextureType::Cube) {
+    igl::Result::setResult(
+        outResult, igl::Result::Code::InvalidOperation, "Unrecognized texture type.");
+    return nullptr;
+  }
+
+  if (header->width == 0u || header->height == 0u) {
+    igl::Result::setResult(outResult, igl::Result::Code::InvalidOperation, "Invalid dimensions.");
+    return nullptr;
+  }
+
+  return header;
+}
+
+bool validatePayload(DataReader reader,
+                     const Header& header,
+                     igl::Result* IGL_NULLABLE outResult) noexcept {
+  if (static_cast<uint64_t>(kHeaderLength) + static_cast<uint64_t>(header.payloadLength) !=
+      static_cast<uint64_t>(reader.length())) {
+    igl::Result::setResult(
+        outResult, igl::Result::Code::InvalidOperation, "Payload length doesn't match the file.");
+    return false;
+  }
+
+  const auto properties = igl::TextureFormatProperties::fromTextureFormat(
+      static_cast<igl::TextureFormat>(header.format));
+  igl::TextureRangeDesc range;
+  range.width = std::max(header.width, 1u);
+  range.height = std::max(header.height, 1u);
+  range.depth = std::max(header.depth, 1u);
+  range.numFaces =
+      static_cast<igl::TextureType>(header.type) == igl::TextureType::Cube ? 6u : 1u;
+  range.numLayers = std::max(header.numLayers, 1u);
+  range.numMipLevels = std::max(header.numMipLevels, 1u);
+
+  if (properties.getBytesPerRange(range) != static_cast<size_t>(header.payloadLength)) {
+    igl::Result::setResult(
+        outResult, igl::Result::Code::InvalidOperation, "Unexpected payload length.");
+    return false;
+  }
+
+  return true;
+}
+
+std::unique_ptr<ITextureLoader> tryCreateLoader(DataReader reader,
+                                                std::unique_ptr<IData> ownedData,
+                                                igl::Result* IGL_NULLABLE outResult) noexcept {
+  const Header* header = validateHeader(reader, outResult);
+  if (header == nullptr) {
+    return nullptr;
+  }
+  if (!validatePayload(reader, *header, outResult)) {
+    return nullptr;
+  }
+
+  auto payloadReader =
+      DataReader::tryCreate(reader.data() + kHeaderLength, header->payloadLength, outResult);
+  if (!payloadReader.has_value()) {
+    return nullptr;
+  }
+
+  return std::make_unique<BlobTextureLoader>(*payloadReader, *header, std::move(ownedData));
+}
+
+} // namespace
+
+uint32_t TextureLoaderFactory::headerLength() const noexcept {
+  return kHeaderLength;
+}
+
+std::unique_ptr<ITextureLoader> TextureLoaderFactory::tryCreateOwning(
+    std::unique_ptr<IData> data,
+    igl::Result* IGL_NULLABLE outResult) const noexcept {
+  if (!data) {
+    igl::Result::setResult(outResult, igl::Result::Code::ArgumentNull, "data is nullptr.");
+    return nullptr;
+  }
+  auto reader = DataReader::tryCreate(data->data(), data->length(), outResult);
+  if (!reader.has_value()) {
+    return nullptr;
+  }
+
+  return tryCreateLoader(*reader, std::move(data), outResult);
+}
+
+bool TextureLoaderFactory::canCreateInternal(DataReader headerReader,
+                                             igl::Result* IGL_NULLABLE outResult) const noexcept {
+  return validateHeader(headerReader, outResult) != nullptr;
+}
+
+std::unique_ptr<ITextureLoader> TextureLoaderFactory::tryCreateInternal(
+    DataReader reader,
+    igl::Result* IGL_NULLABLE outResult) const noexcept {
+  return tryCreateLoader(reader, nullptr, outResult);
+}
+
+} // namespace iglu::textureloader::cache
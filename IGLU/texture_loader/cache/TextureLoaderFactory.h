@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <IGLU/texture_loader/IData.h>
+#include <IGLU/texture_loader/ITextureLoaderFactory.h>
+
+namespace iglu::textureloader::cache {
+
+/// Factory for the device-native blobs written by DiskCache. The payload is stored exactly the
+/// way igl::ITexture::upload() consumes it (levels tightly packed, largest first), so loaders
+/// upload straight from the source bytes - typically a memory-mapped cache file.
+class TextureLoaderFactory final : public ITextureLoaderFactory {
+ public:
+  TextureLoaderFactory() noexcept = default;
+
+  [[nodiscard]] uint32_t headerLength() const noexcept final;
+
+  /// Like tryCreate(), but the returned loader takes ownership of 'data' (e.g. a memory-mapped
+  /// cache file), so callers don't have to keep the mapping alive alongside the loader.
+  [[nodiscard]] std::unique_ptr<ITextureLoader> tryCreateOwning(
+      std::unique_ptr<IData> data,
+      igl::Result* IGL_NULLABLE outResult) const noexcept;
+
+ protected:
+  [[nodiscard]] bool canCreateInternal(DataReader headerReader,
+                                       igl::Result* IGL_NULLABLE outResult) const noexcept final;
+  [[nodiscard]] std::unique_ptr<ITextureLoader> tryCreateInternal(
+      DataReader reader,
+      igl::Result* IGL_NULLABLE outResult) const noexcept final;
+};
+
+} // namespace iglu::textureloader::cache
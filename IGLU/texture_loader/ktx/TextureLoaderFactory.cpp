@@ -7,6 +7,7 @@
 
 #include <IGLU/texture_loader/ktx/TextureLoaderFactory.h>
 
+#include <igl/DeviceFeatures.h>
 #include <igl/IGLSafeC.h>
 #include <ktx.h>
 #include <numeric>
@@ -15,6 +16,36 @@
 namespace iglu::textureloader::ktx {
 namespace {
 
+ktx_transcode_fmt_e chooseTranscodeTarget(
+    const igl::ICapabilities* IGL_NULLABLE capabilities) noexcept {
+  if (capabilities != nullptr) {
+    const auto sampled = igl::ICapabilities::TextureFormatCapabilityBits::Sampled;
+    // Highest quality first; every candidate is 8bpp or less so the download/memory win over
+    // uncompressed RGBA holds for all of them.
+    if (contains(capabilities->getTextureFormatCapabilities(igl::TextureFormat::RGBA_ASTC_4x4),
+                 sampled)) {
+      return KTX_TTF_ASTC_4x4_RGBA;
+    }
+    if (contains(
+            capabilities->getTextureFormatCapabilities(igl::TextureFormat::RGBA_BC7_UNORM_4x4),
+            sampled)) {
+      return KTX_TTF_BC7_RGBA;
+    }
+    if (contains(capabilities->getTextureFormatCapabilities(igl::TextureFormat::RGBA8_EAC_ETC2),
+                 sampled)) {
+      return KTX_TTF_ETC2_RGBA;
+    }
+    return KTX_TTF_RGBA32;
+  }
+
+  // No device information; assume the platform's dominant format family.
+#if IGL_PLATFORM_ANDROID || IGL_PLATFORM_IOS
+  return KTX_TTF_ASTC_4x4_RGBA;
+#else
+  return KTX_TTF_BC7_RGBA;
+#endif
+}
+
 struct KtxDeleter {
   void operator()(void* p) const {
     ktxTexture_Destroy(ktxTexture(p));
@@ -36,6 +67,10 @@ class TextureLoader : public ITextureLoader {
  private:
   void uploadInternal(igl::ITexture& texture,
                       igl::Result* IGL_NULLABLE outResult) const noexcept final;
+  void uploadMipRangeInternal(igl::ITexture& texture,
+                              uint32_t fromMipLevel,
+                              uint32_t numMipLevels,
+                              igl::Result* IGL_NULLABLE outResult) const noexcept final;
   void loadToExternalMemoryInternal(uint8_t* IGL_NONNULL data,
                                     uint32_t length,
                                     igl::Result* IGL_NULLABLE outResult) const noexcept final;
@@ -94,6 +129,31 @@ void TextureLoader::uploadInternal(igl::ITexture& texture,
   igl::Result::setOk(outResult);
 }
 
+void TextureLoader::uploadMipRangeInternal(igl::ITexture& texture,
+                                           uint32_t fromMipLevel,
+                                           uint32_t numMipLevels,
+                                           igl::Result* IGL_NULLABLE outResult) const noexcept {
+  size_t offset;
+  for (uint32_t mipLevel = fromMipLevel;
+       mipLevel < fromMipLevel + numMipLevels && mipLevel < texture_->numLevels;
+       ++mipLevel) {
+    auto error = ktxTexture_GetImageOffset(ktxTexture(texture_.get()), mipLevel, 0, 0, &offset);
+    if (error != KTX_SUCCESS) {
+      IGL_LOG_ERROR("Error getting KTX texture data: %d %s\n", error, ktxErrorString(error));
+      igl::Result::setResult(
+          outResult, igl::Result::Code::RuntimeError, "Error getting KTX texture data.");
+      return;
+    }
+    auto result = texture.upload(texture.getFullRange(mipLevel), texture_->pData + offset);
+    if (!result.isOk()) {
+      igl::Result::setResult(outResult, std::move(result));
+      return;
+    }
+  }
+
+  igl::Result::setOk(outResult);
+}
+
 void TextureLoader::loadToExternalMemoryInternal(uint8_t* IGL_NONNULL data,
                                                  uint32_t length,
                                                  igl::Result* IGL_NULLABLE
@@ -131,6 +191,10 @@ std::unique_ptr<ITextureLoader> TextureLoaderFactory::tryCreateInternal(
     return nullptr;
   }
 
+  if (auto fastPathLoader = tryCreateFastPathInternal(reader, range)) {
+    return fastPathLoader;
+  }
+
   ktxTexture* rawTexture = nullptr;
   auto error = ktxTexture_CreateFromMemory(
       reader.data(), reader.length(), KTX_TEXTURE_CREATE_LOAD_IMAGE_DATA_BIT, &rawTexture);
@@ -148,11 +212,7 @@ std::unique_ptr<ITextureLoader> TextureLoaderFactory::tryCreateInternal(
   auto texture = std::unique_ptr<ktxTexture, KtxDeleter>(rawTexture);
 
   if (ktxTexture_NeedsTranscoding(rawTexture)) {
-#if IGL_PLATFORM_ANDROID || IGL_PLATFORM_IOS
-    ktx_transcode_fmt_e transcodeFormat = KTX_TTF_ASTC_4x4_RGBA;
-#else
-    ktx_transcode_fmt_e transcodeFormat = KTX_TTF_BC7_RGBA;
-#endif
+    const ktx_transcode_fmt_e transcodeFormat = chooseTranscodeTarget(capabilities_);
     error =
         ktxTexture2_TranscodeBasis(reinterpret_cast<ktxTexture2*>(rawTexture), transcodeFormat, 0);
     if (error != KTX_SUCCESS) {
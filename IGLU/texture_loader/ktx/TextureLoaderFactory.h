@@ -15,10 +15,16 @@ namespace iglu::textureloader::ktx {
 
 /**
  * @brief ITextureLoaderFactory base class for loading KTX v1 and v2 textures
+ *
+ * When 'capabilities' is provided, Basis Universal / UASTC payloads are transcoded to the best
+ * block-compressed format the device can sample (ASTC, then BC7, then ETC2, falling back to
+ * uncompressed RGBA). Without it the target defaults to the platform's dominant format family.
  */
 class TextureLoaderFactory : public ITextureLoaderFactory {
  protected:
-  TextureLoaderFactory() noexcept = default;
+  explicit TextureLoaderFactory(
+      const igl::ICapabilities* IGL_NULLABLE capabilities = nullptr) noexcept :
+    capabilities_(capabilities) {}
   [[nodiscard]] virtual igl::TextureRangeDesc textureRange(DataReader reader) const noexcept = 0;
 
   [[nodiscard]] virtual bool validate(DataReader reader,
@@ -28,10 +34,24 @@ class TextureLoaderFactory : public ITextureLoaderFactory {
   [[nodiscard]] virtual igl::TextureFormat textureFormat(
       const ktxTexture* IGL_NONNULL texture) const noexcept = 0;
 
+  /**
+   * @brief Gives format-specific subclasses a chance to create a loader that uploads straight
+   * from the (typically memory-mapped) source bytes, skipping libktx's heap copy of the image
+   * data. Called after validate(), so implementations may trust the container's level index.
+   * Return nullptr to fall back to the libktx-backed loader.
+   */
+  [[nodiscard]] virtual std::unique_ptr<ITextureLoader> tryCreateFastPathInternal(
+      DataReader /*reader*/,
+      const igl::TextureRangeDesc& /*range*/) const noexcept {
+    return nullptr;
+  }
+
  private:
   [[nodiscard]] std::unique_ptr<ITextureLoader> tryCreateInternal(
       DataReader reader,
       igl::Result* IGL_NULLABLE outResult) const noexcept final;
+
+  const igl::ICapabilities* IGL_NULLABLE capabilities_ = nullptr;
 };
 
 } // namespace iglu::textureloader::ktx
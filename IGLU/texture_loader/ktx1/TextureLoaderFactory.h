@@ -18,7 +18,9 @@ namespace iglu::textureloader::ktx1 {
  */
 class TextureLoaderFactory final : public ktx::TextureLoaderFactory {
  public:
-  explicit TextureLoaderFactory() noexcept = default;
+  explicit TextureLoaderFactory(
+      const igl::ICapabilities* IGL_NULLABLE capabilities = nullptr) noexcept :
+    ktx::TextureLoaderFactory(capabilities) {}
 
   [[nodiscard]] uint32_t headerLength() const noexcept final;
 
@@ -18,7 +18,9 @@ namespace iglu::textureloader::ktx2 {
  */
 class TextureLoaderFactory final : public ktx::TextureLoaderFactory {
  public:
-  explicit TextureLoaderFactory() noexcept = default;
+  explicit TextureLoaderFactory(
+      const igl::ICapabilities* IGL_NULLABLE capabilities = nullptr) noexcept :
+    ktx::TextureLoaderFactory(capabilities) {}
 
   [[nodiscard]] uint32_t headerLength() const noexcept final;
 
@@ -34,6 +36,15 @@ class TextureLoaderFactory final : public ktx::TextureLoaderFactory {
 
   [[nodiscard]] igl::TextureFormat textureFormat(
       const ktxTexture* IGL_NONNULL texture) const noexcept final;
+
+  /// Creates a loader that uploads each mip level straight from the (typically memory-mapped)
+  /// file bytes using the container's level index, with no libktx heap copy in between. Only
+  /// applies when the payload is GPU-ready as stored: a concrete vkFormat and no
+  /// supercompression. Basis/UASTC and supercompressed containers return nullptr and take the
+  /// transcoding path.
+  [[nodiscard]] std::unique_ptr<ITextureLoader> tryCreateFastPathInternal(
+      DataReader reader,
+      const igl::TextureRangeDesc& range) const noexcept final;
 };
 
 } // namespace iglu::textureloader::ktx2
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <IGLU/uniform/BatchedCollectionEncoder.h>
+
+#include <IGLU/uniform/Collection.h>
+#include <IGLU/uniform/Descriptor.h>
+
+#include <cstring>
+#include <igl/Buffer.h>
+#include <igl/Device.h>
+#include <igl/RenderCommandEncoder.h>
+
+namespace iglu {
+namespace uniform {
+
+namespace {
+
+size_t alignTo(size_t value, size_t alignment) {
+  return (value + alignment - 1) & ~(alignment - 1);
+}
+
+} // namespace
+
+// ----------------------------------------------------------------------------
+
+BatchLayout BatchLayout::create(const Collection& collection,
+                                const std::vector<igl::NameHandle>& uniformNames,
+                                size_t offsetAlignment) noexcept {
+  BatchLayout layout;
+  layout.entries.reserve(uniformNames.size());
+  for (const auto& name : uniformNames) {
+    const Descriptor& uniform = collection.get(name);
+    Entry entry;
+    entry.name = name;
+    entry.offset = alignTo(layout.numBytes, offsetAlignment);
+    entry.numBytes = uniform.numBytes(Alignment::Aligned);
+    layout.numBytes = entry.offset + entry.numBytes;
+    layout.entries.push_back(std::move(entry));
+  }
+  return layout;
+}
+
+// ----------------------------------------------------------------------------
+
+BatchedCollectionEncoder::BatchedCollectionEncoder(igl::IDevice& device) :
+  device_(device), fallbackEncoder_(device.getBackendType()) {
+  size_t alignment = 0;
+  if (device.getFeatureLimits(igl::DeviceFeatureLimits::BufferAlignment, alignment) &&
+      alignment > offsetAlignment_) {
+    offsetAlignment_ = alignment;
+  }
+}
+
+void BatchedCollectionEncoder::operator()(const Collection& collection,
+                                          igl::IRenderCommandEncoder& commandEncoder,
+                                          uint8_t bindTarget,
+                                          const std::vector<igl::NameHandle>& uniformNames,
+                                          igl::Result* outResult) noexcept {
+  if (device_.getBackendType() == igl::BackendType::OpenGL) {
+    // The OpenGL backend shaders use individual uniforms instead of uniform buffers, so
+    // there is no contiguous allocation to batch into.
+    fallbackEncoder_(collection, commandEncoder, bindTarget, uniformNames);
+    igl::Result::setOk(outResult);
+    return;
+  }
+
+  const BatchLayout layout = BatchLayout::create(collection, uniformNames, offsetAlignment_);
+  if (layout.numBytes == 0) {
+    igl::Result::setOk(outResult);
+    return;
+  }
+
+  // Pack every descriptor into one staging allocation...
+  stagingData_.resize(layout.numBytes);
+  for (const auto& entry : layout.entries) {
+    const Descriptor& uniform = collection.get(entry.name);
+    std::memcpy(stagingData_.data() + entry.offset, uniform.data(Alignment::Aligned),
+                entry.numBytes);
+  }
+
+  // ...and write it to the device with a single upload, growing the buffer as needed.
+  if (!buffer_ || buffer_->getSizeInBytes() < layout.numBytes) {
+    const igl::BufferDesc desc(igl::BufferDesc::BufferTypeBits::Uniform,
+                               nullptr,
+                               layout.numBytes,
+                               igl::ResourceStorage::Shared,
+                               0,
+                               "iglu::uniform::BatchedCollectionEncoder");
+    igl::Result ret;
+    buffer_ = device_.createBuffer(desc, &ret);
+    if (!buffer_) {
+      igl::Result::setResult(outResult, std::move(ret));
+      return;
+    }
+  }
+  auto ret = buffer_->upload(stagingData_.data(), igl::BufferRange(layout.numBytes, 0));
+  if (!ret.isOk()) {
+    igl::Result::setResult(outResult, std::move(ret));
+    return;
+  }
+
+  const igl::ShaderStage stage = bindTarget == igl::BindTarget::kVertex
+                                     ? igl::ShaderStage::Vertex
+                                     : igl::ShaderStage::Fragment;
+  for (const auto& entry : layout.entries) {
+    const int bufferIndex = collection.get(entry.name).getIndex(stage);
+    if (!IGL_VERIFY(bufferIndex >= 0)) {
+      continue;
+    }
+    commandEncoder.bindBuffer(bufferIndex, bindTarget, buffer_, entry.offset);
+  }
+  igl::Result::setOk(outResult);
+}
+
+} // namespace uniform
+} // namespace iglu
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <IGLU/uniform/CollectionEncoder.h>
+#include <igl/Common.h>
+#include <igl/NameHandle.h>
+
+#include <memory>
+#include <vector>
+
+namespace igl {
+class IBuffer;
+class IDevice;
+class IRenderCommandEncoder;
+} // namespace igl
+
+namespace iglu {
+namespace uniform {
+
+struct Collection;
+
+// BatchLayout
+//
+// Describes where each descriptor of a Collection lands inside one contiguous
+// allocation. Offsets respect the device's uniform buffer alignment so each
+// descriptor can be bound at its offset.
+struct BatchLayout {
+  struct Entry {
+    igl::NameHandle name;
+    size_t offset = 0;
+    size_t numBytes = 0;
+  };
+  std::vector<Entry> entries;
+  size_t numBytes = 0;
+
+  // Lays out the named descriptors of 'collection' back to back, aligning each
+  // offset to 'offsetAlignment' (which must be a power of two).
+  static BatchLayout create(const Collection& collection,
+                            const std::vector<igl::NameHandle>& uniformNames,
+                            size_t offsetAlignment) noexcept;
+};
+
+// BatchedCollectionEncoder
+//
+// Submits uniforms corresponding to uniformNames in the source collection through one
+// contiguous device buffer: all descriptors are packed into a single allocation, uploaded
+// with one buffer write, and each bound at its offset. This replaces the per-descriptor
+// data copies that CollectionEncoder issues, which matters for material systems that pay
+// one update per parameter today.
+//
+// The encoder owns the buffer and grows it as needed, so reuse one instance across frames.
+// It does not synchronize against frames in flight; use one instance per frame in flight
+// when the collection changes every frame.
+//
+// On OpenGL, shaders consume individual uniforms rather than buffers, so encoding falls
+// back to the unbatched CollectionEncoder path.
+class BatchedCollectionEncoder {
+ public:
+  explicit BatchedCollectionEncoder(igl::IDevice& device);
+
+  void operator()(const Collection& collection,
+                  igl::IRenderCommandEncoder& commandEncoder,
+                  uint8_t bindTarget,
+                  const std::vector<igl::NameHandle>& uniformNames,
+                  igl::Result* outResult = nullptr) noexcept;
+
+ private:
+  igl::IDevice& device_;
+  CollectionEncoder fallbackEncoder_;
+  std::shared_ptr<igl::IBuffer> buffer_;
+  std::vector<uint8_t> stagingData_;
+  size_t offsetAlignment_ = 16;
+};
+
+} // namespace uniform
+} // namespace iglu
@@ -201,6 +201,8 @@ class XrApp {
   std::vector<float> supportedRefreshRates_;
   float currentRefreshRate_ = 0.0f;
 
+  bool foveationSupported_ = false;
+
   PFN_xrGetDisplayRefreshRateFB xrGetDisplayRefreshRateFB_ = nullptr;
   PFN_xrEnumerateDisplayRefreshRatesFB xrEnumerateDisplayRefreshRatesFB_ = nullptr;
   PFN_xrRequestDisplayRefreshRateFB xrRequestDisplayRefreshRateFB_ = nullptr;
@@ -53,6 +53,12 @@ bool XrSwapchainProvider::initialize() {
   colorSwapchain_ =
       createXrSwapchain(XR_SWAPCHAIN_USAGE_COLOR_ATTACHMENT_BIT, selectedColorFormat_);
 
+#if defined(XR_FB_foveation)
+  if (foveationLevel_ != XR_FOVEATION_LEVEL_NONE_FB) {
+    applyFoveationProfile(colorSwapchain_);
+  }
+#endif
+
 // @fb-only
   auto depthFormat = impl_->preferredDepthFormat();
   if (std::any_of(std::begin(swapchainFormats),
@@ -91,6 +97,19 @@ XrSwapchain XrSwapchainProvider::createXrSwapchain(XrSwapchainUsageFlags extraUs
   swapChainCreateInfo.arraySize = numViews_;
   swapChainCreateInfo.mipCount = 1;
 
+#if defined(XR_FB_foveation)
+  XrSwapchainCreateInfoFoveationFB foveationCreateInfo = {
+      XR_TYPE_SWAPCHAIN_CREATE_INFO_FOVEATION_FB, nullptr};
+  if (foveationLevel_ != XR_FOVEATION_LEVEL_NONE_FB &&
+      (extraUsageFlags & XR_SWAPCHAIN_USAGE_COLOR_ATTACHMENT_BIT) != 0) {
+    foveationCreateInfo.flags =
+        platform_->getDevice().getBackendType() == igl::BackendType::Vulkan
+            ? XR_SWAPCHAIN_CREATE_FOVEATION_FRAGMENT_DENSITY_MAP_BIT_FB
+            : XR_SWAPCHAIN_CREATE_FOVEATION_SCALED_BIN_BIT_FB;
+    swapChainCreateInfo.next = &foveationCreateInfo;
+  }
+#endif
+
   XrSwapchain swapchain;
   XR_CHECK(xrCreateSwapchain(session_, &swapChainCreateInfo, &swapchain));
   IGL_LOG_INFO("XrSwapchain created");
@@ -100,6 +119,52 @@ XrSwapchain XrSwapchainProvider::createXrSwapchain(XrSwapchainUsageFlags extraUs
   return swapchain;
 }
 
+#if defined(XR_FB_foveation)
+void XrSwapchainProvider::enableFoveation(XrInstance instance, XrFoveationLevelFB level) {
+  IGL_ASSERT_MSG(colorSwapchain_ == XR_NULL_HANDLE,
+                 "enableFoveation() must be called before initialize()");
+  foveationInstance_ = instance;
+  foveationLevel_ = level;
+}
+
+void XrSwapchainProvider::applyFoveationProfile(XrSwapchain swapchain) const {
+  PFN_xrCreateFoveationProfileFB xrCreateFoveationProfileFB = nullptr;
+  PFN_xrDestroyFoveationProfileFB xrDestroyFoveationProfileFB = nullptr;
+  PFN_xrUpdateSwapchainFB xrUpdateSwapchainFB = nullptr;
+  XR_CHECK(xrGetInstanceProcAddr(foveationInstance_,
+                                 "xrCreateFoveationProfileFB",
+                                 (PFN_xrVoidFunction*)&xrCreateFoveationProfileFB));
+  XR_CHECK(xrGetInstanceProcAddr(foveationInstance_,
+                                 "xrDestroyFoveationProfileFB",
+                                 (PFN_xrVoidFunction*)&xrDestroyFoveationProfileFB));
+  XR_CHECK(xrGetInstanceProcAddr(
+      foveationInstance_, "xrUpdateSwapchainFB", (PFN_xrVoidFunction*)&xrUpdateSwapchainFB));
+  if (!xrCreateFoveationProfileFB || !xrDestroyFoveationProfileFB || !xrUpdateSwapchainFB) {
+    IGL_LOG_ERROR("Foveation function pointers unavailable; foveation not applied");
+    return;
+  }
+
+  XrFoveationLevelProfileCreateInfoFB levelProfileCreateInfo = {
+      XR_TYPE_FOVEATION_LEVEL_PROFILE_CREATE_INFO_FB, nullptr};
+  levelProfileCreateInfo.level = foveationLevel_;
+  levelProfileCreateInfo.verticalOffset = 0.0f;
+  levelProfileCreateInfo.dynamic = XR_FOVEATION_DYNAMIC_DISABLED_FB;
+
+  XrFoveationProfileCreateInfoFB profileCreateInfo = {XR_TYPE_FOVEATION_PROFILE_CREATE_INFO_FB,
+                                                      &levelProfileCreateInfo};
+  XrFoveationProfileFB foveationProfile = XR_NULL_HANDLE;
+  XR_CHECK(xrCreateFoveationProfileFB(session_, &profileCreateInfo, &foveationProfile));
+
+  XrSwapchainStateFoveationFB foveationState = {XR_TYPE_SWAPCHAIN_STATE_FOVEATION_FB, nullptr};
+  foveationState.profile = foveationProfile;
+  XR_CHECK(xrUpdateSwapchainFB(swapchain, (XrSwapchainStateBaseHeaderFB*)&foveationState));
+
+  // The swapchain keeps the foveation pattern; the profile is no longer needed.
+  XR_CHECK(xrDestroyFoveationProfileFB(foveationProfile));
+  IGL_LOG_INFO("XrSwapchain foveation applied (level %d)", (int)foveationLevel_);
+}
+#endif // defined(XR_FB_foveation)
+
 igl::SurfaceTextures XrSwapchainProvider::getSurfaceTextures() const {
   return impl_->getSurfaceTextures(platform_->getDevice(),
                                    colorSwapchain_,
@@ -35,6 +35,13 @@ class XrSwapchainProvider {
 
   bool initialize();
 
+#if defined(XR_FB_foveation)
+  // Enables fixed-foveated rendering on the color swapchain. Must be called before initialize()
+  // so the swapchain is created with the foveation flags; the runtime then reduces peripheral
+  // fragment shading via a fragment density map (Vulkan) or scaled bins (OpenGL).
+  void enableFoveation(XrInstance instance, XrFoveationLevelFB level);
+#endif
+
   inline uint32_t currentImageIndex() const {
     return currentImageIndex_;
   }
@@ -51,6 +58,9 @@ class XrSwapchainProvider {
 
  private:
   XrSwapchain createXrSwapchain(XrSwapchainUsageFlags extraUsageFlags, int64_t format);
+#if defined(XR_FB_foveation)
+  void applyFoveationProfile(XrSwapchain swapchain) const;
+#endif
 
  private:
   std::unique_ptr<impl::XrSwapchainProviderImpl> impl_;
@@ -65,5 +75,10 @@ class XrSwapchainProvider {
   uint32_t currentImageIndex_;
   const uint32_t numViews_ =
       1; // The number of layers of the underlying swapchain image would match numViews_.
+
+#if defined(XR_FB_foveation)
+  XrInstance foveationInstance_ = XR_NULL_HANDLE;
+  XrFoveationLevelFB foveationLevel_ = XR_FOVEATION_LEVEL_NONE_FB;
+#endif
 };
 } // namespace igl::shell::openxr
@@ -227,6 +227,22 @@ bool XrApp::checkExtensions() {
     requiredExtensions_.push_back(XR_FB_DISPLAY_REFRESH_RATE_EXTENSION_NAME);
   }
 
+#if defined(XR_FB_foveation)
+  // XR_FB_SWAPCHAIN_UPDATE_STATE (needed for xrUpdateSwapchainFB) is always requested above.
+  foveationSupported_ = checkExtensionSupported(XR_FB_FOVEATION_EXTENSION_NAME) &&
+                        checkExtensionSupported(XR_FB_FOVEATION_CONFIGURATION_EXTENSION_NAME);
+  IGL_LOG_INFO("Foveation is %s", foveationSupported_ ? "supported" : "not supported");
+
+  if (foveationSupported_) {
+    if (checkNeedRequiredExtension(XR_FB_FOVEATION_EXTENSION_NAME)) {
+      requiredExtensions_.push_back(XR_FB_FOVEATION_EXTENSION_NAME);
+    }
+    if (checkNeedRequiredExtension(XR_FB_FOVEATION_CONFIGURATION_EXTENSION_NAME)) {
+      requiredExtensions_.push_back(XR_FB_FOVEATION_CONFIGURATION_EXTENSION_NAME);
+    }
+  }
+#endif
+
   return true;
 }
 
@@ -681,6 +697,11 @@ void XrApp::createSwapchainProviders(const std::unique_ptr<igl::IDevice>& device
                                               session_,
                                               viewports_[i],
                                               numViewsPerSwapchain));
+#if defined(XR_FB_foveation)
+    if (foveationSupported_) {
+      swapchainProviders_.back()->enableFoveation(instance_, XR_FOVEATION_LEVEL_MEDIUM_FB);
+    }
+#endif
     swapchainProviders_.back()->initialize();
   }
 }
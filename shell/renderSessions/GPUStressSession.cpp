@@ -16,12 +16,18 @@
 // @lint-ignore CLANGTIDY
 #include <stdlib.h>
 
+#include <algorithm>
 #include <chrono>
 #include <cstddef>
 #include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
 #include <future>
+#include <iostream>
 #include <memory>
 #include <random>
+#include <sstream>
 
 #include <glm/detail/qualifier.hpp>
 #include <glm/ext/matrix_clip_space.hpp>
@@ -50,9 +56,11 @@ struct VertexPosUvw {
 
 namespace {
 
-const int kCubeCount = 1; // number of cubes in the vertex buffer
-// number of times to draw the vertex buffer (triangles = 12 * kDrawCount * kCubeCount)
-const int kDrawCount = 1;
+// number of cubes in the vertex buffer; configurable via --cubes in benchmark mode
+int kCubeCount = 1;
+// number of times to draw the vertex buffer (triangles = 12 * kDrawCount * kCubeCount);
+// benchmark mode overrides this per phase via --draws
+int kDrawCount = 1;
 // turn this on and set kDrawCount to 1.  Cube count will be the number of layers you'll see
 const bool kTestOverdraw = false;
 
@@ -63,9 +71,9 @@ const int kMsaaSamples = 4; // this is the max number possible
 const float kScaleFill = .05f;
 // each light will add about 45 ish instructions to your pixel shader (tested using powerVR compiler
 // so grain of salt)arc lint --engine LintCPP
-const int kLightCount = 0;
+int kLightCount = 0;
 // number of times to do a lof of math that does not calculate pi
-const int kGoSlowOnCpu = 0; // max10000000;
+int kGoSlowOnCpu = 0; // max10000000;
 // cpu threads - these are really necessary to get our CPU usage up  to 100% (otherwise the
 // framerate just throttles)
 int kThreadCount = 8;
@@ -506,8 +514,214 @@ void getOffset(int counter, float& x, float& y, float& z) {
   y = 2.1f * half * (static_cast<float>((counter % (igrid * igrid)) / fgrid) - grid / 2.f);
 }
 
+double percentile(std::vector<double> values, double p) {
+  if (values.empty()) {
+    return 0.0;
+  }
+  std::sort(values.begin(), values.end());
+  const auto index = static_cast<size_t>((p / 100.0) * static_cast<double>(values.size() - 1));
+  return values[index];
+}
+
+struct PhaseSummary {
+  double avg = 0.0;
+  double min = 0.0;
+  double max = 0.0;
+  double p50 = 0.0;
+  double p90 = 0.0;
+  double p99 = 0.0;
+};
+
+PhaseSummary summarize(const std::vector<double>& values) {
+  PhaseSummary summary;
+  if (values.empty()) {
+    return summary;
+  }
+  double sum = 0.0;
+  summary.min = summary.max = values[0];
+  for (const double value : values) {
+    sum += value;
+    summary.min = std::min(summary.min, value);
+    summary.max = std::max(summary.max, value);
+  }
+  summary.avg = sum / static_cast<double>(values.size());
+  summary.p50 = percentile(values, 50.0);
+  summary.p90 = percentile(values, 90.0);
+  summary.p99 = percentile(values, 99.0);
+  return summary;
+}
+
+std::vector<int> parseIntList(const char* list) {
+  std::vector<int> values;
+  std::stringstream stream(list);
+  std::string token;
+  while (std::getline(stream, token, ',')) {
+    const int value = atoi(token.c_str());
+    if (value > 0) {
+      values.push_back(value);
+    }
+  }
+  return values;
+}
+
 } // namespace
 
+//
+// parseBenchmarkArgs()
+//
+// Benchmark mode is driven by command line arguments (with a GPUSTRESS_BENCHMARK_ARGS environment
+// variable fallback for platforms whose shells do not forward argv, e.g. Android):
+//
+//   --benchmark                run headless (no UI), fixed frame count, then exit
+//   --benchmark-frames=N       measured frames per phase (default 500)
+//   --benchmark-warmup=N       warmup frames per phase, not recorded (default 30)
+//   --benchmark-output=PATH    write results to PATH; .json selects JSON, anything else CSV
+//   --benchmark-draws=1,16,256 workload matrix: one phase per draw count
+//   --cubes=N                  cubes in the vertex buffer
+//   --lights=N                 per-pixel lights in the fragment shader
+//   --threads=N                CPU stress threads
+//   --cpu-load=N               iterations of CPU busywork per frame
+//   --thrash-memory            enable the memory stress path
+//
+void GPUStressSession::parseBenchmarkArgs() {
+  std::vector<std::string> args;
+  if (Platform::hasCommandLineArgs()) {
+    for (int i = 1; i < Platform::argc(); ++i) {
+      args.emplace_back(Platform::argv()[i]);
+    }
+  }
+  if (const char* envArgs = std::getenv("GPUSTRESS_BENCHMARK_ARGS")) {
+    std::stringstream stream(envArgs);
+    std::string token;
+    while (stream >> token) {
+      args.push_back(token);
+    }
+  }
+
+  std::vector<int> drawCounts;
+  for (const auto& arg : args) {
+    if (arg == "--benchmark") {
+      benchmarkEnabled_ = true;
+    } else if (arg.rfind("--benchmark-frames=", 0) == 0) {
+      benchmarkFrameCount_ = std::max(1, atoi(arg.c_str() + strlen("--benchmark-frames=")));
+    } else if (arg.rfind("--benchmark-warmup=", 0) == 0) {
+      benchmarkWarmupFrames_ = std::max(0, atoi(arg.c_str() + strlen("--benchmark-warmup=")));
+    } else if (arg.rfind("--benchmark-output=", 0) == 0) {
+      benchmarkOutputPath_ = arg.substr(strlen("--benchmark-output="));
+    } else if (arg.rfind("--benchmark-draws=", 0) == 0) {
+      drawCounts = parseIntList(arg.c_str() + strlen("--benchmark-draws="));
+    } else if (arg.rfind("--cubes=", 0) == 0) {
+      kCubeCount = std::max(1, atoi(arg.c_str() + strlen("--cubes=")));
+    } else if (arg.rfind("--lights=", 0) == 0) {
+      kLightCount = std::max(0, atoi(arg.c_str() + strlen("--lights=")));
+    } else if (arg.rfind("--threads=", 0) == 0) {
+      kThreadCount = std::max(0, atoi(arg.c_str() + strlen("--threads=")));
+    } else if (arg.rfind("--cpu-load=", 0) == 0) {
+      kGoSlowOnCpu = std::max(0, atoi(arg.c_str() + strlen("--cpu-load=")));
+    } else if (arg == "--thrash-memory") {
+      kThrashMemory = true;
+    }
+  }
+
+  if (!benchmarkEnabled_) {
+    return;
+  }
+  if (drawCounts.empty()) {
+    drawCounts.push_back(kDrawCount);
+  }
+  for (const int drawCount : drawCounts) {
+    BenchmarkPhase phase;
+    phase.drawCount = drawCount;
+    phase.frameMs.reserve(benchmarkFrameCount_);
+    phase.gpuWaitMs.reserve(benchmarkFrameCount_);
+    benchmarkPhases_.push_back(std::move(phase));
+  }
+  benchmarkFrameIndex_ = -benchmarkWarmupFrames_;
+}
+
+void GPUStressSession::recordBenchmarkFrame(double frameMs, double gpuWaitMs) {
+  if (benchmarkPhaseIndex_ >= benchmarkPhases_.size()) {
+    return;
+  }
+
+  // Warmup frames (negative indices) and the first frame of each phase are not recorded; the
+  // frame delta measured at the top of update() belongs to the previous phase's workload.
+  if (benchmarkFrameIndex_ > 0) {
+    auto& phase = benchmarkPhases_[benchmarkPhaseIndex_];
+    phase.frameMs.push_back(frameMs);
+    phase.gpuWaitMs.push_back(gpuWaitMs);
+  }
+  ++benchmarkFrameIndex_;
+
+  if (benchmarkFrameIndex_ > benchmarkFrameCount_) {
+    ++benchmarkPhaseIndex_;
+    benchmarkFrameIndex_ = -benchmarkWarmupFrames_;
+    if (benchmarkPhaseIndex_ >= benchmarkPhases_.size()) {
+      const bool ok = writeBenchmarkResults();
+      IGL_LOG_INFO("GPUStressSession benchmark complete (%s)\n", ok ? "results written" : "FAILED");
+      appParamsRef().exitRequested = true;
+    }
+  }
+}
+
+//
+// writeBenchmarkResults()
+//
+// Emits one record per phase with the configuration, the per-frame draw count and frame-time /
+// GPU-wait percentiles. IGL has no timestamp query API, so GPU time is approximated by the time
+// update() spends in waitUntilCompleted() after submitting the frame's command buffer.
+//
+bool GPUStressSession::writeBenchmarkResults() const {
+  std::ostream* out = &std::cout;
+  std::ofstream file;
+  if (!benchmarkOutputPath_.empty()) {
+    file.open(benchmarkOutputPath_);
+    if (!file.is_open()) {
+      IGL_LOG_ERROR("GPUStressSession: cannot open benchmark output file '%s'\n",
+                    benchmarkOutputPath_.c_str());
+      return false;
+    }
+    out = &file;
+  }
+
+  const bool json = benchmarkOutputPath_.size() >= 5 &&
+                    benchmarkOutputPath_.compare(benchmarkOutputPath_.size() - 5, 5, ".json") == 0;
+  if (json) {
+    *out << "{\n  \"cubes\": " << kCubeCount << ",\n  \"lights\": " << kLightCount
+         << ",\n  \"threads\": " << kThreadCount << ",\n  \"frames\": " << benchmarkFrameCount_
+         << ",\n  \"phases\": [\n";
+    for (size_t i = 0; i < benchmarkPhases_.size(); ++i) {
+      const auto& phase = benchmarkPhases_[i];
+      const PhaseSummary frame = summarize(phase.frameMs);
+      const PhaseSummary gpu = summarize(phase.gpuWaitMs);
+      *out << "    {\"draws_per_frame\": " << phase.drawCount
+           << ", \"frame_ms\": {\"avg\": " << frame.avg << ", \"min\": " << frame.min
+           << ", \"max\": " << frame.max << ", \"p50\": " << frame.p50
+           << ", \"p90\": " << frame.p90 << ", \"p99\": " << frame.p99
+           << "}, \"gpu_wait_ms\": {\"avg\": " << gpu.avg << ", \"min\": " << gpu.min
+           << ", \"max\": " << gpu.max << ", \"p50\": " << gpu.p50 << ", \"p90\": " << gpu.p90
+           << ", \"p99\": " << gpu.p99 << "}}" << (i + 1 < benchmarkPhases_.size() ? "," : "")
+           << "\n";
+    }
+    *out << "  ]\n}\n";
+  } else {
+    *out << "cubes,lights,threads,draws_per_frame,frames,"
+            "frame_ms_avg,frame_ms_min,frame_ms_max,frame_ms_p50,frame_ms_p90,frame_ms_p99,"
+            "gpu_wait_ms_avg,gpu_wait_ms_min,gpu_wait_ms_max,gpu_wait_ms_p50,gpu_wait_ms_p90,"
+            "gpu_wait_ms_p99\n";
+    for (const auto& phase : benchmarkPhases_) {
+      const PhaseSummary frame = summarize(phase.frameMs);
+      const PhaseSummary gpu = summarize(phase.gpuWaitMs);
+      *out << kCubeCount << ',' << kLightCount << ',' << kThreadCount << ',' << phase.drawCount
+           << ',' << phase.frameMs.size() << ',' << frame.avg << ',' << frame.min << ','
+           << frame.max << ',' << frame.p50 << ',' << frame.p90 << ',' << frame.p99 << ','
+           << gpu.avg << ',' << gpu.min << ',' << gpu.max << ',' << gpu.p50 << ',' << gpu.p90
+           << ',' << gpu.p99 << '\n';
+    }
+  }
+  return out->good();
+}
+
 void GPUStressSession::createSamplerAndTextures(const igl::IDevice& device) {
   // Sampler & Texture
   SamplerStateDesc samplerDesc;
@@ -610,6 +824,9 @@ void GPUStressSession::initialize() noexcept {
     return;
   }
 
+  // Must run before createCubes() so --cubes takes effect on the first build of the vertex data.
+  parseBenchmarkArgs();
+
   createCubes();
   imguiSession_ = std::make_unique<iglu::imgui::Session>(getPlatform().getDevice(),
                                                          getPlatform().getInputDispatcher());
@@ -858,6 +1075,10 @@ void GPUStressSession::update(igl::SurfaceTextures surfaceTextures) noexcept {
   fps_.updateFPS((double)delta / 1000000.0);
   lastTime_ = newTime;
 
+  if (benchmarkEnabled_ && benchmarkPhaseIndex_ < benchmarkPhases_.size()) {
+    kDrawCount = benchmarkPhases_[benchmarkPhaseIndex_].drawCount;
+  }
+
   initState(surfaceTextures);
 
   // Command buffers (1-N per thread): create, submit and forget
@@ -869,24 +1090,26 @@ void GPUStressSession::update(igl::SurfaceTextures surfaceTextures) noexcept {
   framebufferDesc.colorAttachments[0].texture = framebuffer_->getColorAttachment(0);
   framebufferDesc.depthAttachment.texture = framebuffer_->getDepthAttachment();
 
-  // setup UI
-  const ImGuiViewport* v = ImGui::GetMainViewport();
-  imguiSession_->beginFrame(framebufferDesc, getPlatform().getDisplayContext().pixelsPerPoint);
-  bool open;
-  ImGui::SetNextWindowPos(
-      {
-          v->WorkPos.x + v->WorkSize.x - 60.0f,
-          v->WorkPos.y + v->WorkSize.y * .25f + 15.0f,
-      },
-      ImGuiCond_Always,
-      {1.0f, 0.0f});
-  ImGui::Begin("GPU", &open, ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoBackground);
-  ImGui::SetWindowFontScale(2.f);
+  // setup UI (skipped in benchmark mode so the overlay doesn't pollute the measurements)
+  if (!benchmarkEnabled_) {
+    const ImGuiViewport* v = ImGui::GetMainViewport();
+    imguiSession_->beginFrame(framebufferDesc, getPlatform().getDisplayContext().pixelsPerPoint);
+    bool open;
+    ImGui::SetNextWindowPos(
+        {
+            v->WorkPos.x + v->WorkSize.x - 60.0f,
+            v->WorkPos.y + v->WorkSize.y * .25f + 15.0f,
+        },
+        ImGuiCond_Always,
+        {1.0f, 0.0f});
+    ImGui::Begin("GPU", &open, ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoBackground);
+    ImGui::SetWindowFontScale(2.f);
+  }
 
   // draw stuff
   drawCubes(surfaceTextures, commands);
 
-  { // Draw using ImGui every frame
+  if (!benchmarkEnabled_) { // Draw using ImGui every frame
 
     ImGui::TextColored(ImVec4(1.f, 0.f, 0.f, 1.f),
                        "FPS: (%f)   PI: (%lf)  Memory (%f)",
@@ -903,6 +1126,18 @@ void GPUStressSession::update(igl::SurfaceTextures surfaceTextures) noexcept {
                            : framebuffer_->getColorAttachment(0));
 
   commandQueue_->submit(*buffer); // Guarantees ordering between command buffers
+
+  if (benchmarkEnabled_) {
+    // IGL's query pools have no timestamp type, so approximate GPU time by how long the CPU
+    // waits for this frame's command buffer to complete after submission.
+    const auto waitStart = std::chrono::high_resolution_clock::now();
+    buffer->waitUntilCompleted();
+    const double gpuWaitMs = std::chrono::duration_cast<std::chrono::microseconds>(
+                                 std::chrono::high_resolution_clock::now() - waitStart)
+                                 .count() /
+                             1000.0;
+    recordBenchmarkFrame((double)delta / 1000.0, gpuWaitMs);
+  }
 }
 
 } // namespace igl::shell
@@ -15,6 +15,8 @@
 #include <igl/FPSCounter.h>
 #include <igl/IGL.h>
 #include <shell/shared/platform/Platform.h>
+#include <string>
+#include <vector>
 
 namespace igl::shell {
 
@@ -57,6 +59,25 @@ class GPUStressSession : public RenderSession {
 
   igl::FPSCounter fps_;
   unsigned long long lastTime_{0};
+
+  // Benchmark mode (see --benchmark in the .cpp): runs a fixed number of frames per draw-count
+  // phase without UI, then writes machine-readable results and requests exit.
+  struct BenchmarkPhase {
+    int drawCount = 1;
+    std::vector<double> frameMs;
+    std::vector<double> gpuWaitMs;
+  };
+  void parseBenchmarkArgs();
+  void recordBenchmarkFrame(double frameMs, double gpuWaitMs);
+  bool writeBenchmarkResults() const;
+
+  bool benchmarkEnabled_ = false;
+  int benchmarkFrameCount_ = 500;
+  int benchmarkWarmupFrames_ = 30;
+  std::string benchmarkOutputPath_;
+  std::vector<BenchmarkPhase> benchmarkPhases_;
+  size_t benchmarkPhaseIndex_ = 0;
+  int benchmarkFrameIndex_ = 0;
 };
 
 } // namespace igl::shell
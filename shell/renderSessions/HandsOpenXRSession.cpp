@@ -8,6 +8,7 @@
 #include <IGLU/managedUniformBuffer/ManagedUniformBuffer.h>
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstdint>
 #include <glm/detail/qualifier.hpp>
@@ -114,23 +115,26 @@ const char* getVulkanVertexShaderSource() {
 
                       #define XR_HAND_JOINT_COUNT_EXT 26
                       layout (set = 1, binding = 1, std140) uniform PerFrame {
-                        mat4 jointMatrices[XR_HAND_JOINT_COUNT_EXT];
                         mat4 viewProjectionMatrix[2];
                       } perFrame;
 
+                      layout (set = 1, binding = 2, std140) uniform Skinning {
+                        mat4 jointMatrices[XR_HAND_JOINT_COUNT_EXT];
+                      } skin;
+
                       layout(location = 0) out vec3 worldNormal;
 
                       void main() {
-                        vec4 p1 = perFrame.jointMatrices[int(joint.x)] * vec4(position, 1.0);
-                        vec4 p2 = perFrame.jointMatrices[int(joint.y)] * vec4(position, 1.0);
-                        vec4 p3 = perFrame.jointMatrices[int(joint.z)] * vec4(position, 1.0);
-                        vec4 p4 = perFrame.jointMatrices[int(joint.w)] * vec4(position, 1.0);
+                        vec4 p1 = skin.jointMatrices[int(joint.x)] * vec4(position, 1.0);
+                        vec4 p2 = skin.jointMatrices[int(joint.y)] * vec4(position, 1.0);
+                        vec4 p3 = skin.jointMatrices[int(joint.z)] * vec4(position, 1.0);
+                        vec4 p4 = skin.jointMatrices[int(joint.w)] * vec4(position, 1.0);
                         vec4 worldPos = p1 * weight.x + p2 * weight.y + p3 * weight.z + p4 * weight.w;
 
-                        vec4 n1 = perFrame.jointMatrices[int(joint.x)] * vec4(normal, 0.0);
-                        vec4 n2 = perFrame.jointMatrices[int(joint.y)] * vec4(normal, 0.0);
-                        vec4 n3 = perFrame.jointMatrices[int(joint.z)] * vec4(normal, 0.0);
-                        vec4 n4 = perFrame.jointMatrices[int(joint.w)] * vec4(normal, 0.0);
+                        vec4 n1 = skin.jointMatrices[int(joint.x)] * vec4(normal, 0.0);
+                        vec4 n2 = skin.jointMatrices[int(joint.y)] * vec4(normal, 0.0);
+                        vec4 n3 = skin.jointMatrices[int(joint.z)] * vec4(normal, 0.0);
+                        vec4 n4 = skin.jointMatrices[int(joint.w)] * vec4(normal, 0.0);
                         worldNormal = (n1 * weight.x + n2 * weight.y + n3 * weight.z + n4 * weight.w).xyz;
 
                         gl_Position = perFrame.viewProjectionMatrix[gl_ViewID_OVR] * vec4(worldPos.xyz, 1.0);
@@ -243,9 +247,15 @@ void HandsOpenXRSession::initialize() noexcept {
       indices.push_back(baseVertex + static_cast<uint16_t>(handMeshes[i].indices[j]));
     }
 
+    std::array<glm::mat4, kMaxJoints> inverseBind{};
+    IGL_ASSERT(handMeshes[i].jointBindPoses.size() <= kMaxJoints);
     for (size_t j = 0; j < handMeshes[i].jointBindPoses.size(); ++j) {
-      jointInvBindMatrix_[i][j] = glm::inverse(poseToMat4(handMeshes[i].jointBindPoses[j]));
+      inverseBind[j] = glm::inverse(poseToMat4(handMeshes[i].jointBindPoses[j]));
     }
+    // The palette binds at binding 2 (see the Skinning block in the vertex shaders).
+    jointPalettes_[i] = std::make_unique<iglu::skinning::JointPalette>(kMaxJoints, 2);
+    jointPalettes_[i]->setInverseBindMatrices(
+        inverseBind.data(), static_cast<uint32_t>(handMeshes[i].jointBindPoses.size()));
   }
 
   const BufferDesc vb0Desc = BufferDesc(
@@ -362,15 +372,6 @@ void HandsOpenXRSession::update(igl::SurfaceTextures surfaceTextures) noexcept {
   info.index = 1;
   info.length = sizeof(UniformBlock);
 
-  {
-    igl::UniformDesc e;
-    e.name = "jointMatrices";
-    e.type = igl::UniformType::Mat4x4;
-    e.numElements = kMaxJoints;
-    e.offset = offsetof(UniformBlock, jointMatrices);
-    e.elementStride = sizeof(glm::mat4);
-    info.uniforms.push_back(std::move(e));
-  }
   {
     igl::UniformDesc e;
     e.name = "viewProjectionMatrix";
@@ -385,13 +386,7 @@ void HandsOpenXRSession::update(igl::SurfaceTextures surfaceTextures) noexcept {
   info.index = 1;
   info.length = sizeof(UniformBlock);
   info.uniforms =
-      std::vector<igl::UniformDesc>{igl::UniformDesc{"jointMatrices",
-                                                     -1,
-                                                     igl::UniformType::Mat4x4,
-                                                     kMaxJoints,
-                                                     offsetof(UniformBlock, jointMatrices),
-                                                     sizeof(glm::mat4)},
-                                    igl::UniformDesc{"viewProjectionMatrix",
+      std::vector<igl::UniformDesc>{igl::UniformDesc{"viewProjectionMatrix",
                                                      -1,
                                                      igl::UniformType::Mat4x4,
                                                      2,
@@ -402,18 +397,23 @@ void HandsOpenXRSession::update(igl::SurfaceTextures surfaceTextures) noexcept {
   commands->bindRenderPipelineState(pipelineState_);
   commands->bindDepthStencilState(depthStencilState_);
 
+  // The view-projection matrices are shared by both hands; bind them once.
+  const auto uniformBuffer = std::make_shared<iglu::ManagedUniformBuffer>(device, info);
+  IGL_ASSERT(uniformBuffer->result.isOk());
+  *static_cast<UniformBlock*>(uniformBuffer->getData()) = ub_;
+  uniformBuffer->bind(device, *pipelineState_, *commands);
+
   for (int i = 0; i < 2; ++i) {
     auto& handTracking = shellParams().handTracking[i];
     IGL_ASSERT(handTracking.jointPose.size() <= kMaxJoints);
+    std::array<glm::mat4, kMaxJoints> jointWorld{};
     for (size_t j = 0; j < handTracking.jointPose.size(); ++j) {
-      ub_.jointMatrices[j] = poseToMat4(handTracking.jointPose[j]) * jointInvBindMatrix_[i][j];
+      jointWorld[j] = poseToMat4(handTracking.jointPose[j]);
     }
 
-    const auto uniformBuffer = std::make_shared<iglu::ManagedUniformBuffer>(device, info);
-    IGL_ASSERT(uniformBuffer->result.isOk());
-    *static_cast<UniformBlock*>(uniformBuffer->getData()) = ub_;
-
-    uniformBuffer->bind(device, *pipelineState_, *commands);
+    jointPalettes_[i]->updateJoints(jointWorld.data(),
+                                    static_cast<uint32_t>(handTracking.jointPose.size()));
+    jointPalettes_[i]->bind(device, *pipelineState_, *commands);
 
     commands->drawIndexed(PrimitiveType::Triangle,
                           handsDrawParams_[i].indexCount,
@@ -9,6 +9,7 @@
 
 #include <shell/shared/renderSession/RenderSession.h>
 
+#include <IGLU/skinning/JointPalette.h>
 #include <array>
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
@@ -21,7 +22,6 @@ namespace igl::shell {
 constexpr int kMaxJoints = 26;
 
 struct UniformBlock {
-  glm::mat4 jointMatrices[kMaxJoints]{};
   glm::mat4 viewProjectionMatrix[2]{};
 };
 
@@ -41,7 +41,7 @@ class HandsOpenXRSession : public RenderSession {
   std::shared_ptr<IBuffer> vb0_, ib0_;
   std::shared_ptr<IFramebuffer> framebuffer_;
 
-  std::array<std::array<glm::mat4, kMaxJoints>, 2> jointInvBindMatrix_;
+  std::array<std::unique_ptr<iglu::skinning::JointPalette>, 2> jointPalettes_;
 
   struct DrawParams {
     size_t indexCount = 0;
@@ -9,6 +9,7 @@
 
 #include <cstdio>
 #include <igl/Common.h>
+#include <igl/Macros.h>
 
 #if defined(IGL_CMAKE_BUILD)
 #include <filesystem>
@@ -18,6 +19,15 @@ namespace fs = std::filesystem;
 namespace fs = boost::filesystem;
 #endif
 
+#if IGL_PLATFORM_WIN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 namespace igl::shell {
 
 FileLoader::FileData FileLoader::loadBinaryDataInternal(const std::string& filePath) {
@@ -47,4 +57,103 @@ FileLoader::FileData FileLoader::loadBinaryDataInternal(const std::string& fileP
   return {std::move(data), static_cast<uint32_t>(length)};
 }
 
+FileLoader::MappedData FileLoader::mapBinaryData(const std::string& fileName) {
+  MappedData mapped = mapBinaryDataInternal(fullPath(fileName));
+  if (mapped.data != nullptr) {
+    return mapped;
+  }
+
+  // Mapping is unavailable (no filesystem path, archive-backed asset, ...): keep the copying
+  // path working so callers can use mapBinaryData() unconditionally.
+  FileData fileData = loadBinaryData(fileName);
+  if (fileData.data == nullptr) {
+    return {};
+  }
+  const std::shared_ptr<const uint8_t[]> owned = std::move(fileData.data);
+  mapped.data = owned.get();
+  mapped.length = fileData.length;
+  mapped.handle = owned;
+  return mapped;
+}
+
+FileLoader::MappedData FileLoader::mapBinaryDataInternal(const std::string& filePath) {
+  if (filePath.empty() || !fs::exists(filePath)) {
+    return {};
+  }
+
+#if IGL_PLATFORM_WIN
+  HANDLE file = CreateFileA(filePath.c_str(),
+                            GENERIC_READ,
+                            FILE_SHARE_READ,
+                            nullptr,
+                            OPEN_EXISTING,
+                            FILE_ATTRIBUTE_NORMAL,
+                            nullptr);
+  if (file == INVALID_HANDLE_VALUE) {
+    return {};
+  }
+
+  LARGE_INTEGER fileSize = {};
+  if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart <= 0 ||
+      fileSize.QuadPart > static_cast<LONGLONG>(std::numeric_limits<uint32_t>::max())) {
+    CloseHandle(file);
+    return {};
+  }
+
+  HANDLE fileMapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (fileMapping == nullptr) {
+    CloseHandle(file);
+    return {};
+  }
+
+  void* mapping = MapViewOfFile(fileMapping, FILE_MAP_READ, 0, 0, 0);
+  // the view keeps the mapping and file alive; the handles can be dropped right away
+  CloseHandle(fileMapping);
+  CloseHandle(file);
+  if (mapping == nullptr) {
+    return {};
+  }
+
+  MappedData mapped;
+  mapped.data = static_cast<const uint8_t*>(mapping);
+  mapped.length = static_cast<uint32_t>(fileSize.QuadPart);
+  mapped.handle = std::shared_ptr<const void>(mapping, [](const void* p) {
+    UnmapViewOfFile(const_cast<void*>(p));
+  });
+  return mapped;
+#else
+  const int fd = open(filePath.c_str(), O_RDONLY); // NOLINT(cppcoreguidelines-pro-type-vararg)
+  if (fd < 0) {
+    return {};
+  }
+
+  struct stat fileInfo = {};
+  if (fstat(fd, &fileInfo) != 0 || fileInfo.st_size <= 0 ||
+      static_cast<uint64_t>(fileInfo.st_size) > std::numeric_limits<uint32_t>::max()) {
+    close(fd);
+    return {};
+  }
+
+  const auto size = static_cast<size_t>(fileInfo.st_size);
+  void* mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  // the mapping keeps the file alive; the descriptor can be dropped right away
+  close(fd);
+  if (mapping == MAP_FAILED) {
+    return {};
+  }
+
+  // Asset loads read the file front to back exactly once; tell the kernel so it reads ahead
+  // aggressively and starts paging the data in before the first access.
+  madvise(mapping, size, MADV_SEQUENTIAL);
+  madvise(mapping, size, MADV_WILLNEED);
+
+  MappedData mapped;
+  mapped.data = static_cast<const uint8_t*>(mapping);
+  mapped.length = static_cast<uint32_t>(size);
+  mapped.handle = std::shared_ptr<const void>(
+      mapping, [size](const void* p) { munmap(const_cast<void*>(p), size); });
+  return mapped;
+#endif
+}
+
 } // namespace igl::shell
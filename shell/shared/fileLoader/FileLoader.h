@@ -21,11 +21,23 @@ class FileLoader {
     uint32_t length;
   };
 
+  // A non-owning view of file contents backed by a memory mapping (or, when mapping is not
+  // possible, by a heap copy). 'data' stays valid for as long as 'handle' is held.
+  struct MappedData {
+    const uint8_t* data = nullptr;
+    uint32_t length = 0;
+    std::shared_ptr<const void> handle;
+  };
+
   FileLoader() = default;
   virtual ~FileLoader() = default;
   virtual FileData loadBinaryData(const std::string& /* filename */) {
     return {};
   }
+  // Maps the file read-only instead of copying it through the heap, advising the kernel of
+  // sequential access. Falls back to loadBinaryData() when the file cannot be mapped (e.g.
+  // assets inside an Android APK).
+  virtual MappedData mapBinaryData(const std::string& filename);
   virtual bool fileExists(const std::string& /* filename */) const {
     return false;
   }
@@ -38,6 +50,7 @@ class FileLoader {
 
  protected:
   FileData loadBinaryDataInternal(const std::string& filePath);
+  MappedData mapBinaryDataInternal(const std::string& filePath);
 };
 
 } // namespace igl::shell
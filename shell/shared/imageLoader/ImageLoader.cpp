@@ -12,7 +12,10 @@
 #include <IGLU/texture_loader/stb_png/TextureLoaderFactory.h>
 #include <array>
 #include <cstdio>
+#include <filesystem>
+#include <mutex>
 #include <shell/shared/fileLoader/FileLoader.h>
+#include <unordered_map>
 
 namespace igl::shell {
 namespace {
@@ -51,6 +54,46 @@ const uint8_t* IGL_NONNULL CheckerboardData::data() const noexcept {
 uint32_t CheckerboardData::length() const noexcept {
   return kNumBytes;
 }
+
+// Non-owning view into a cached decoded image; keeps the shared decode result alive while the
+// caller holds the ImageData.
+class CachedData : public iglu::textureloader::IData {
+ public:
+  explicit CachedData(std::shared_ptr<iglu::textureloader::IData> data) : data_(std::move(data)) {}
+  [[nodiscard]] const uint8_t* IGL_NONNULL data() const noexcept final {
+    return data_->data();
+  }
+  [[nodiscard]] uint32_t length() const noexcept final {
+    return data_->length();
+  }
+
+ private:
+  std::shared_ptr<iglu::textureloader::IData> data_;
+};
+
+// Decoded images keyed by full path + modification time, shared across ImageLoader instances so
+// relaunching a session in the same process skips decoding while edited files are still noticed.
+struct DecodedImageCache {
+  struct Entry {
+    TextureDesc desc;
+    std::shared_ptr<iglu::textureloader::IData> data;
+  };
+
+  std::mutex mutex;
+  std::unordered_map<std::string, Entry> entries;
+
+  static DecodedImageCache& instance() {
+    static DecodedImageCache cache;
+    return cache;
+  }
+};
+
+std::string cacheKey(const std::string& fullPath) {
+  std::error_code ec;
+  const auto mtime = std::filesystem::last_write_time(fullPath, ec);
+  const auto ticks = ec ? 0LL : static_cast<long long>(mtime.time_since_epoch().count());
+  return fullPath + '|' + std::to_string(ticks);
+}
 } // namespace
 
 ImageLoader::ImageLoader(FileLoader& fileLoader) :
@@ -60,13 +103,51 @@ ImageLoader::ImageLoader(FileLoader& fileLoader) :
 ImageData ImageLoader::defaultLoadImageData(const std::string& imageName) noexcept {
   std::string fullName = fileLoader().fullPath(imageName);
 
-  return loadImageDataFromFile(fullName);
+  auto& cache = DecodedImageCache::instance();
+  const std::string key = cacheKey(fullName);
+  {
+    const std::lock_guard<std::mutex> lock(cache.mutex);
+    auto it = cache.entries.find(key);
+    if (it != cache.entries.end()) {
+      ImageData imageData;
+      imageData.desc = it->second.desc;
+      imageData.data = std::make_unique<CachedData>(it->second.data);
+      return imageData;
+    }
+  }
+
+  // Decode outside the lock; a concurrent miss on the same file decodes twice, which is harmless.
+  ImageData imageData = loadImageDataFromFile(fullName);
+  if (imageData.data == nullptr) {
+    return imageData;
+  }
+
+  const std::shared_ptr<iglu::textureloader::IData> shared = std::move(imageData.data);
+  {
+    const std::lock_guard<std::mutex> lock(cache.mutex);
+    cache.entries[key] = {imageData.desc, shared};
+  }
+  imageData.data = std::make_unique<CachedData>(shared);
+  return imageData;
+}
+
+std::future<ImageData> ImageLoader::loadImageDataAsync(const std::string& imageName) noexcept {
+  return std::async(std::launch::async,
+                    [this, imageName]() noexcept { return loadImageData(imageName); });
+}
+
+void ImageLoader::clearImageCache() noexcept {
+  auto& cache = DecodedImageCache::instance();
+  const std::lock_guard<std::mutex> lock(cache.mutex);
+  cache.entries.clear();
 }
 
 ImageData ImageLoader::loadImageDataFromFile(const std::string& fileName) noexcept {
-  auto [data, length] = fileLoader_.loadBinaryData(fileName);
-  if (IGL_VERIFY(data && length > 0)) {
-    return loadImageDataFromMemory(data.get(), length);
+  // Mapping avoids the transient file-sized heap copy; decoding still reads straight from the
+  // page cache. Falls back to a heap copy internally when the file cannot be mapped.
+  const auto mapped = fileLoader_.mapBinaryData(fileName);
+  if (IGL_VERIFY(mapped.data && mapped.length > 0)) {
+    return loadImageDataFromMemory(mapped.data, mapped.length);
   }
 
   return {};
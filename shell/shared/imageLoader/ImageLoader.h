@@ -9,6 +9,7 @@
 
 #include <IGLU/texture_loader/IData.h>
 #include <IGLU/texture_loader/TextureLoaderFactory.h>
+#include <future>
 #include <igl/IGL.h>
 #include <memory>
 #include <string>
@@ -30,6 +31,11 @@ class ImageLoader {
   virtual ImageData loadImageData(const std::string& imageName) noexcept {
     return defaultLoadImageData(imageName);
   }
+  // Decodes on a worker thread so callers can overlap decode with device initialization.
+  std::future<ImageData> loadImageDataAsync(const std::string& imageName) noexcept;
+  // Drops all cached decoded images (e.g. to reclaim memory between sessions). The cache is
+  // process-wide so that it survives session relaunches.
+  static void clearImageCache() noexcept;
   static ImageData checkerboard() noexcept;
 
  protected:
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <shell/shared/imageWriter/AsyncImageWriter.h>
+
+#include <cstring>
+
+namespace igl::shell {
+
+AsyncImageWriter::AsyncImageWriter(const ImageWriter& writer, size_t maxQueueDepth) :
+  writer_(writer), maxQueueDepth_(maxQueueDepth ? maxQueueDepth : 1) {
+  worker_ = std::thread([this] { workerLoop(); });
+}
+
+AsyncImageWriter::~AsyncImageWriter() {
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    shutdown_ = true;
+  }
+  queueChanged_.notify_all();
+  if (worker_.joinable()) {
+    worker_.join(); // the worker drains the queue before exiting
+  }
+}
+
+void AsyncImageWriter::writeImageAsync(const std::string& imageName,
+                                       ImageData&& imageData) const noexcept {
+  std::unique_lock<std::mutex> lock(mutex_);
+  // bounded queue depth: block the capturing thread instead of accumulating uncompressed frames
+  queueChanged_.wait(lock, [this] { return queue_.size() < maxQueueDepth_; });
+  queue_.push_back({imageName, std::move(imageData)});
+  lock.unlock();
+  queueChanged_.notify_all();
+}
+
+void AsyncImageWriter::writeImage(const std::string& imageName,
+                                  const ImageData& imageData) const noexcept {
+  // the generic interface only hands us a reference - copy the pixels so the write can outlive
+  // the caller's buffer
+  ImageData copy;
+  copy.desc = imageData.desc;
+  if (imageData.data) {
+    const uint32_t length = imageData.data->length();
+    auto pixels = std::make_unique<uint8_t[]>(length);
+    memcpy(pixels.get(), imageData.data->data(), length);
+    copy.data = iglu::textureloader::IData::tryCreate(std::move(pixels), length, nullptr);
+  }
+  writeImageAsync(imageName, std::move(copy));
+}
+
+void AsyncImageWriter::wait() const noexcept {
+  std::unique_lock<std::mutex> lock(mutex_);
+  queueChanged_.wait(lock, [this] { return queue_.empty() && numInFlight_ == 0; });
+}
+
+void AsyncImageWriter::workerLoop() {
+  for (;;) {
+    PendingWrite entry;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      queueChanged_.wait(lock, [this] { return !queue_.empty() || shutdown_; });
+      if (queue_.empty()) {
+        break; // shutdown requested and everything has been drained
+      }
+      entry = std::move(queue_.front());
+      queue_.pop_front();
+      numInFlight_++;
+    }
+    queueChanged_.notify_all(); // a queue slot freed up
+    writer_.writeImage(entry.imageName, entry.imageData);
+    {
+      const std::lock_guard<std::mutex> lock(mutex_);
+      numInFlight_--;
+    }
+    queueChanged_.notify_all();
+  }
+}
+
+} // namespace igl::shell
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include <shell/shared/imageWriter/ImageWriter.h>
+
+namespace igl::shell {
+
+// Decorates another ImageWriter with a single background worker thread: captures are enqueued and
+// encoded/written off the calling thread, so a session that saves every frame is only blocked for
+// the framebuffer readback, not for the tens of milliseconds of PNG/JPEG encode and file I/O.
+// The queue depth is bounded; when the queue is full, enqueueing blocks until the worker catches
+// up instead of buffering an unbounded number of uncompressed frames.
+class AsyncImageWriter final : public ImageWriter {
+ public:
+  // default number of captures that can be queued before writers start blocking; every queued
+  // entry holds one uncompressed frame, so keep this small
+  static constexpr size_t kDefaultMaxQueueDepth = 3;
+
+  // `writer` performs the actual encode and file write on the worker thread; it must outlive
+  // this object
+  explicit AsyncImageWriter(const ImageWriter& writer,
+                            size_t maxQueueDepth = kDefaultMaxQueueDepth);
+  ~AsyncImageWriter() override; // drains the queue before returning
+
+  // Enqueues a capture, taking ownership of the pixel data. Blocks while the queue is full
+  void writeImageAsync(const std::string& imageName, ImageData&& imageData) const noexcept;
+
+  // ImageWriter interface: ImageData is move-only, so this copies the pixels before enqueueing.
+  // Prefer writeImageAsync() when the caller can hand over ownership
+  void writeImage(const std::string& imageName,
+                  const ImageData& imageData) const noexcept override;
+
+  // Blocks until every queued capture has been written
+  void wait() const noexcept;
+
+ private:
+  struct PendingWrite {
+    std::string imageName;
+    ImageData imageData;
+  };
+
+  void workerLoop();
+
+  const ImageWriter& writer_;
+  const size_t maxQueueDepth_;
+
+  mutable std::mutex mutex_;
+  mutable std::condition_variable queueChanged_;
+  mutable std::deque<PendingWrite> queue_;
+  mutable size_t numInFlight_ = 0; // entries popped by the worker but not yet written
+  bool shutdown_ = false; // guarded by mutex_
+  std::thread worker_;
+};
+
+} // namespace igl::shell
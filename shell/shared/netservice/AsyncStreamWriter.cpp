@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <shell/shared/netservice/AsyncStreamWriter.h>
+
+#include <igl/Common.h>
+
+namespace igl::shell::netservice {
+
+AsyncStreamWriter::AsyncStreamWriter(std::shared_ptr<OutputStream> stream) noexcept :
+  stream_(std::move(stream)) {
+  IGL_ASSERT(stream_);
+  stream_->setObserver([this](Stream& /*sender*/, Stream::Event event) { onStreamEvent(event); });
+}
+
+AsyncStreamWriter::~AsyncStreamWriter() {
+  if (stream_) {
+    stream_->setObserver(nullptr);
+  }
+}
+
+void AsyncStreamWriter::send(std::shared_ptr<const Message> message) noexcept {
+  if (IGL_UNEXPECTED(message == nullptr || message->size == 0)) {
+    return;
+  }
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    pendingBytes_ += message->size;
+    queue_.push_back({std::move(message), 0});
+  }
+  drain();
+}
+
+size_t AsyncStreamWriter::pendingBytes() const noexcept {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  return pendingBytes_;
+}
+
+size_t AsyncStreamWriter::bytesSent() const noexcept {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  return bytesSent_;
+}
+
+void AsyncStreamWriter::onStreamEvent(Stream::Event event) noexcept {
+  switch (event) {
+  case Stream::Event::HasSpaceAvailable:
+  case Stream::Event::OpenCompleted:
+    drain();
+    break;
+  case Stream::Event::ErrorOccurred:
+  case Stream::Event::EndEncountered: {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    queue_.clear();
+    pendingBytes_ = 0;
+    break;
+  }
+  default:
+    break;
+  }
+}
+
+void AsyncStreamWriter::drain() noexcept {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  while (!queue_.empty() && stream_->hasSpaceAvailable()) {
+    Pending& front = queue_.front();
+    const uint8_t* data = front.message->data() + front.offset;
+    const size_t remaining = front.message->size - front.offset;
+    const int written = stream_->write(data, remaining);
+    if (written <= 0) {
+      break; // the stream will signal HasSpaceAvailable when it can take more
+    }
+    front.offset += static_cast<size_t>(written);
+    pendingBytes_ -= static_cast<size_t>(written);
+    bytesSent_ += static_cast<size_t>(written);
+    if (front.offset == front.message->size) {
+      queue_.pop_front(); // releases the message back to its pool
+    }
+  }
+}
+
+} // namespace igl::shell::netservice
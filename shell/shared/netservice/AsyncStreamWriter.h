@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <shell/shared/netservice/MessagePool.h>
+#include <shell/shared/netservice/Stream.h>
+
+namespace igl::shell::netservice {
+
+// ----------------------------------------------------------------------------
+
+// Non-blocking send queue over an OutputStream. send() enqueues a message and returns
+// immediately; bytes are written straight from the (pooled) message storage whenever the stream
+// reports space, so large transfers never copy through intermediate buffers and never stall the
+// caller. Messages are drained in order; partially written messages resume at their offset on
+// the next HasSpaceAvailable event. Thread safe; the stream's observer is taken over while the
+// writer is attached.
+class AsyncStreamWriter final {
+ public:
+  explicit AsyncStreamWriter(std::shared_ptr<OutputStream> stream) noexcept;
+  ~AsyncStreamWriter();
+
+  AsyncStreamWriter(const AsyncStreamWriter&) = delete;
+  AsyncStreamWriter& operator=(const AsyncStreamWriter&) = delete;
+
+  // Enqueues the message and writes as much as the stream accepts right away.
+  void send(std::shared_ptr<const Message> message) noexcept;
+
+  [[nodiscard]] size_t pendingBytes() const noexcept;
+  [[nodiscard]] size_t bytesSent() const noexcept;
+  [[nodiscard]] bool idle() const noexcept {
+    return pendingBytes() == 0;
+  }
+
+ private:
+  void onStreamEvent(Stream::Event event) noexcept;
+  void drain() noexcept;
+
+  struct Pending {
+    std::shared_ptr<const Message> message;
+    size_t offset = 0;
+  };
+
+  std::shared_ptr<OutputStream> stream_;
+  mutable std::mutex mutex_;
+  std::deque<Pending> queue_;
+  size_t pendingBytes_ = 0;
+  size_t bytesSent_ = 0;
+};
+
+// ----------------------------------------------------------------------------
+
+} // namespace igl::shell::netservice
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <shell/shared/netservice/MessagePool.h>
+
+namespace igl::shell::netservice {
+
+MessagePool::MessagePool(size_t bufferSize, size_t maxPooledBuffers) :
+  bufferSize_(bufferSize), maxPooledBuffers_(maxPooledBuffers) {
+  freeBuffers_.reserve(maxPooledBuffers_);
+}
+
+std::shared_ptr<Message> MessagePool::acquire(size_t size) noexcept {
+  auto* message = new Message;
+  if (size <= bufferSize_) {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    if (!freeBuffers_.empty()) {
+      message->storage = std::move(freeBuffers_.back());
+      freeBuffers_.pop_back();
+    }
+  }
+  message->storage.resize(size <= bufferSize_ ? bufferSize_ : size);
+  message->size = size;
+
+  // The deleter recycles the storage, so the pool must outlive every message acquired from it.
+  return std::shared_ptr<Message>(message, [this](Message* m) {
+    recycle(std::move(m->storage));
+    delete m;
+  });
+}
+
+size_t MessagePool::numPooledBuffers() const noexcept {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  return freeBuffers_.size();
+}
+
+void MessagePool::recycle(std::vector<uint8_t>&& storage) noexcept {
+  if (storage.size() != bufferSize_) {
+    return; // oversize payloads use dedicated allocations
+  }
+  const std::lock_guard<std::mutex> lock(mutex_);
+  if (freeBuffers_.size() < maxPooledBuffers_) {
+    freeBuffers_.push_back(std::move(storage));
+  }
+}
+
+} // namespace igl::shell::netservice
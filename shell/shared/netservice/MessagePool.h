@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace igl::shell::netservice {
+
+// ----------------------------------------------------------------------------
+
+// A reusable message buffer. 'size' is the number of valid bytes; capacity is the pool's buffer
+// size (larger payloads get a dedicated allocation that is not returned to the pool).
+struct Message {
+  std::vector<uint8_t> storage;
+  size_t size = 0;
+
+  [[nodiscard]] const uint8_t* data() const noexcept {
+    return storage.data();
+  }
+  [[nodiscard]] uint8_t* data() noexcept {
+    return storage.data();
+  }
+};
+
+// ----------------------------------------------------------------------------
+
+// Recycles message buffers so steady-state streaming performs no per-message allocation.
+// acquire() hands out a pooled buffer (or a fresh one when the pool is dry); the buffer returns
+// to the pool automatically when the last shared reference is dropped. Thread safe.
+class MessagePool final {
+ public:
+  static constexpr size_t kDefaultBufferSize = 64 * 1024;
+
+  explicit MessagePool(size_t bufferSize = kDefaultBufferSize, size_t maxPooledBuffers = 16);
+
+  // Returns a message with at least 'size' bytes of capacity and 'size' valid bytes.
+  [[nodiscard]] std::shared_ptr<Message> acquire(size_t size) noexcept;
+
+  [[nodiscard]] size_t bufferSize() const noexcept {
+    return bufferSize_;
+  }
+  [[nodiscard]] size_t numPooledBuffers() const noexcept;
+
+ private:
+  void recycle(std::vector<uint8_t>&& storage) noexcept;
+
+  const size_t bufferSize_;
+  const size_t maxPooledBuffers_;
+  mutable std::mutex mutex_;
+  std::vector<std::vector<uint8_t>> freeBuffers_;
+};
+
+// ----------------------------------------------------------------------------
+
+} // namespace igl::shell::netservice
@@ -49,6 +49,10 @@ std::shared_ptr<ITexture> Platform::loadTexture(const char* filename,
   return tex;
 }
 
+bool Platform::hasCommandLineArgs() {
+  return g_argsInitialized;
+}
+
 int Platform::argc() {
   IGL_ASSERT_MSG(g_argsInitialized, "Accessing command line args before they are initialized.");
   return g_argc;
@@ -49,7 +49,9 @@ class Platform {
       igl::TextureFormat format = igl::TextureFormat::RGBA_SRGB,
       igl::TextureDesc::TextureUsageBits usage = igl::TextureDesc::TextureUsageBits::Sampled);
 
-  // 'argc' and 'argv' are the exact arguments received in 'main()'.
+  // 'argc' and 'argv' are the exact arguments received in 'main()'. Not every platform entry
+  // point provides them (e.g. Android); check hasCommandLineArgs() before accessing.
+  static bool hasCommandLineArgs();
   static int argc();
   static char** argv();
 
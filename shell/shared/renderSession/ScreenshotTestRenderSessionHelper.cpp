@@ -7,16 +7,82 @@
 
 #include <igl/Macros.h>
 
+#include <mutex>
+#include <vector>
+
+#include <shell/shared/imageWriter/AsyncImageWriter.h>
 #include <shell/shared/imageWriter/ImageWriter.h>
 #include <shell/shared/renderSession/ScreenshotTestRenderSessionHelper.h>
 #include <shell/shared/renderSession/ShellParams.h>
 
 namespace igl::shell {
+namespace {
 
-void SaveFrameBufferToPng(const char* absoluteFilename,
-                          const std::shared_ptr<IFramebuffer>& framebuffer,
-                          Platform& platform) {
-  igl::Result ret;
+// Readback staging buffers are recycled between captures: a visual-diff harness capturing every
+// frame would otherwise allocate and free one uncompressed frame's worth of memory per capture
+class PixelBufferPool {
+ public:
+  static PixelBufferPool& instance() {
+    static PixelBufferPool pool;
+    return pool;
+  }
+
+  std::unique_ptr<uint8_t[]> acquire(size_t size) {
+    {
+      const std::lock_guard<std::mutex> lock(mutex_);
+      if (size == bufferSize_ && !freeBuffers_.empty()) {
+        auto buffer = std::move(freeBuffers_.back());
+        freeBuffers_.pop_back();
+        return buffer;
+      }
+      if (size != bufferSize_) {
+        // the capture resolution changed; the old buffers can never be reused
+        freeBuffers_.clear();
+        bufferSize_ = size;
+      }
+    }
+    return std::make_unique<uint8_t[]>(size);
+  }
+
+  void release(std::unique_ptr<uint8_t[]> buffer, size_t size) {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    if (size == bufferSize_ && freeBuffers_.size() < kMaxPooledBuffers) {
+      freeBuffers_.push_back(std::move(buffer));
+    }
+  }
+
+ private:
+  // one buffer per queued capture plus the one being filled is all a bounded pipeline can use
+  static constexpr size_t kMaxPooledBuffers = AsyncImageWriter::kDefaultMaxQueueDepth + 1;
+
+  std::mutex mutex_;
+  std::vector<std::unique_ptr<uint8_t[]>> freeBuffers_;
+  size_t bufferSize_ = 0;
+};
+
+// IData wrapper that hands its buffer back to the pool once the capture has been written
+class PooledPixelData final : public iglu::textureloader::IData {
+ public:
+  PooledPixelData(std::unique_ptr<uint8_t[]> buffer, uint32_t length) :
+    buffer_(std::move(buffer)), length_(length) {}
+  ~PooledPixelData() override {
+    PixelBufferPool::instance().release(std::move(buffer_), length_);
+  }
+
+  [[nodiscard]] const uint8_t* IGL_NONNULL data() const noexcept override {
+    return buffer_.get();
+  }
+  [[nodiscard]] uint32_t length() const noexcept override {
+    return length_;
+  }
+
+ private:
+  std::unique_ptr<uint8_t[]> buffer_;
+  uint32_t length_ = 0;
+};
+
+ImageData readFrameBufferPixels(const std::shared_ptr<IFramebuffer>& framebuffer,
+                                Platform& platform) {
   auto drawableSurface = framebuffer->getColorAttachment(0);
   auto frameBuffersize = drawableSurface->getDimensions();
   int const bytesPerPixel = 4;
@@ -26,15 +92,14 @@ void SaveFrameBufferToPng(const char* absoluteFilename,
   imageData.desc.format = drawableSurface->getFormat();
   imageData.desc.width = frameBuffersize.width;
   imageData.desc.height = frameBuffersize.height;
-  auto buffer =
-      std::make_unique<uint8_t[]>(frameBuffersize.width * frameBuffersize.height * bytesPerPixel);
+
+  const size_t numPixels = frameBuffersize.width * frameBuffersize.height * bytesPerPixel;
+  auto buffer = PixelBufferPool::instance().acquire(numPixels);
 
   const CommandQueueDesc desc{igl::CommandQueueType::Graphics};
   auto commandQueue = platform.getDevice().createCommandQueue(desc, nullptr);
   framebuffer->copyBytesColorAttachment(*commandQueue, 0, buffer.get(), rangeDesc);
 
-  const size_t numPixels = frameBuffersize.width * frameBuffersize.height * bytesPerPixel;
-
 #if IGL_PLATFORM_WIN
   if (imageData.desc.format == TextureFormat::BGRA_UNorm8) {
     // Swap B and R channels, as image writer expects RGBA.
@@ -46,10 +111,30 @@ void SaveFrameBufferToPng(const char* absoluteFilename,
   }
 #endif
 
-  imageData.data = iglu::textureloader::IData::tryCreate(std::move(buffer), numPixels, nullptr);
+  imageData.data = std::make_unique<PooledPixelData>(std::move(buffer), (uint32_t)numPixels);
+
+  return imageData;
+}
+
+} // namespace
+
+void SaveFrameBufferToPng(const char* absoluteFilename,
+                          const std::shared_ptr<IFramebuffer>& framebuffer,
+                          Platform& platform) {
+  ImageData imageData = readFrameBufferPixels(framebuffer, platform);
 
   IGLLog(IGLLogLevel::LOG_INFO, "Writing screenshot to: %s", absoluteFilename);
   platform.getImageWriter().writeImage(absoluteFilename, imageData);
 }
 
+void SaveFrameBufferToPng(const char* absoluteFilename,
+                          const std::shared_ptr<IFramebuffer>& framebuffer,
+                          Platform& platform,
+                          const AsyncImageWriter& imageWriter) {
+  ImageData imageData = readFrameBufferPixels(framebuffer, platform);
+
+  IGLLog(IGLLogLevel::LOG_INFO, "Queueing screenshot to: %s", absoluteFilename);
+  imageWriter.writeImageAsync(absoluteFilename, std::move(imageData));
+}
+
 } // namespace igl::shell
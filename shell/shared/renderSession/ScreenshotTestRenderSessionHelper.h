@@ -16,8 +16,20 @@ class IFramebuffer;
 } // namespace igl
 
 namespace igl::shell {
+
+class AsyncImageWriter;
+
 void SaveFrameBufferToPng(const char* absoluteFilename,
                           const std::shared_ptr<IFramebuffer>& framebuffer,
                           Platform& platform);
 
+// Pipelined variant for harnesses that capture every frame: the readback still runs on the
+// calling thread, but the encode and file write happen on `imageWriter`'s worker thread (see
+// AsyncImageWriter), and the readback staging buffer is recycled once the file has been written.
+// Construct the writer once per session around platform.getImageWriter()
+void SaveFrameBufferToPng(const char* absoluteFilename,
+                          const std::shared_ptr<IFramebuffer>& framebuffer,
+                          Platform& platform,
+                          const AsyncImageWriter& imageWriter);
+
 } // namespace igl::shell
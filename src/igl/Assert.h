@@ -54,6 +54,9 @@
 //   }
 //
 
+#include <atomic>
+#include <cstdint>
+
 #include <igl/Log.h>
 
 IGL_API void _IGLDebugBreak();
@@ -105,6 +108,46 @@ static inline const T& _IGLVerify(const T& cond,
 #define IGL_ASSERT_NOT_REACHED() IGL_ASSERT_MSG(0, "Code should NOT be reached")
 #define IGL_ASSERT_NOT_IMPLEMENTED() IGL_ASSERT_MSG(0, "Code NOT implemented")
 
+///--------------------------------------
+/// MARK: - Validation tiers
+
+// The macros above form two contract tiers: IGL_ASSERT/IGL_ASSERT_MSG vanish on release builds,
+// while IGL_VERIFY/IGL_UNEXPECTED keep evaluating because callers branch on them. That still
+// leaves every surviving check active on the per-draw and per-row hot paths, which adds up.
+// IGL_VALIDATION_LEVEL selects how much of that hot-path validation is compiled in:
+//
+//   2 - full checks; the hot-path contracts below behave like IGL_ASSERT/IGL_VERIFY
+//       (default on debug builds)
+//   1 - API-boundary checks only; the hot-path contracts fold away, sampled validation stays
+//       (default on release builds)
+//   0 - zero-check hot loops; hot-path contracts and sampled validation are all compiled out
+//       (opt in with the IGL_DISABLE_HOT_PATH_VALIDATION CMake option)
+//
+// Checks that guard memory safety (checked_memcpy() and friends) are not tiered and always run.
+
+#if !defined(IGL_VALIDATION_LEVEL)
+#if IGL_DEBUG
+#define IGL_VALIDATION_LEVEL 2
+#else
+#define IGL_VALIDATION_LEVEL 1
+#endif
+#endif // !defined(IGL_VALIDATION_LEVEL)
+
+// Contracts for code that runs once per draw call, per row or per element. Unlike IGL_VERIFY,
+// the condition of IGL_VERIFY_HOT is not evaluated at all below the full tier - it folds to
+// `true` and the compiler drops the failure branch - so it must be free of side effects.
+#if IGL_VALIDATION_LEVEL >= 2
+
+#define IGL_ASSERT_HOT(cond) IGL_ASSERT(cond)
+#define IGL_VERIFY_HOT(cond) IGL_VERIFY(cond)
+
+#else
+
+#define IGL_ASSERT_HOT(cond) static_cast<void>(0)
+#define IGL_VERIFY_HOT(cond) (true)
+
+#endif // IGL_VALIDATION_LEVEL >= 2
+
 ///--------------------------------------
 /// MARK: - Custom
 
@@ -144,3 +187,41 @@ IGL_API IGLReportErrorFunc IGLReportErrorGetHandler(void);
 #define IGL_REPORT_ERROR_MSG(condition, format, ...) static_cast<void>(0)
 
 #endif // IGL_REPORT_ERROR_ENABLED
+
+///--------------------------------------
+/// MARK: - Sampled validation
+
+// IGL_ASSERT_SAMPLED checks its condition on every call at the full tier, once every
+// IGL_VALIDATION_SAMPLE_PERIOD calls per call site at the boundary tier, and never at tier 0.
+// Failures go through the IGL_REPORT_ERROR handler, so production telemetry still sees hot-path
+// misuse at a fraction of the cost of checking every call. The per-call-site counter is
+// relaxed-atomic; the sampling cadence under contention is approximate on purpose.
+#if !defined(IGL_VALIDATION_SAMPLE_PERIOD)
+#define IGL_VALIDATION_SAMPLE_PERIOD 256
+#endif // !defined(IGL_VALIDATION_SAMPLE_PERIOD)
+
+#if IGL_VALIDATION_LEVEL >= 2 && IGL_REPORT_ERROR_ENABLED
+
+#define IGL_ASSERT_SAMPLED(cond, format, ...) IGL_REPORT_ERROR_MSG(cond, format, ##__VA_ARGS__)
+
+#elif IGL_VALIDATION_LEVEL >= 2
+
+#define IGL_ASSERT_SAMPLED(cond, format, ...) IGL_ASSERT_MSG(cond, format, ##__VA_ARGS__)
+
+#elif IGL_VALIDATION_LEVEL == 1 && IGL_REPORT_ERROR_ENABLED
+
+#define IGL_ASSERT_SAMPLED(cond, format, ...)                           \
+  do {                                                                  \
+    static std::atomic<uint32_t> _iglSampledCheckCount{0};              \
+    if (_iglSampledCheckCount.fetch_add(1, std::memory_order_relaxed) % \
+            (IGL_VALIDATION_SAMPLE_PERIOD) ==                           \
+        0) {                                                            \
+      IGL_REPORT_ERROR_MSG(cond, format, ##__VA_ARGS__);                \
+    }                                                                   \
+  } while (0)
+
+#else
+
+#define IGL_ASSERT_SAMPLED(cond, format, ...) static_cast<void>(0)
+
+#endif // IGL_VALIDATION_LEVEL
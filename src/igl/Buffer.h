@@ -58,7 +58,7 @@ struct BufferDesc {
     UniformBlock = 1 << 1, // Enforces UBO for OpenGL
     Query = 1 << 2,
     // @fb-only
-    Ring = 1 << 4, // Metal/Vulkan: Ring buffers with memory for each swapchain image
+    Ring = 1 << 4, // Metal/Vulkan/OpenGL: Ring buffers with memory for each swapchain image
     NoCopy = 1 << 5, // Metal: The buffer should re-use previously allocated memory.
   };
 
@@ -85,6 +85,16 @@ struct BufferDesc {
    */
   BufferType type = 0;
 
+  /**
+   * @brief Explicit memory placement. When not Default, this overrides the placement derived from
+   * storage. Use DeviceLocal for GPU-heavy data uploaded through staging, HostUpload for
+   * per-frame streamed data, Readback for GPU->CPU transfers, and DeviceLocalHostVisible to
+   * request CPU-visible VRAM (BAR/ReBAR) for data that is both written every frame and read
+   * heavily by the GPU.
+   * @See igl::MemoryPlacement
+   */
+  MemoryPlacement placement = MemoryPlacement::Default;
+
   /** @brief Identifier used for debugging */
   std::string debugName;
 
@@ -123,16 +133,67 @@ class IBuffer : public ITrackedResource<IBuffer> {
    */
   virtual Result upload(const void* IGL_NULLABLE data, const BufferRange& range) = 0;
 
+  /**
+   * @brief Alignment guarantee of map(): mapped buffer base addresses are aligned to at least
+   * this many bytes on every backend (Vulkan guarantees minMemoryMapAlignment >= 64, OpenGL
+   * MIN_MAP_BUFFER_ALIGNMENT >= 64, and suballocated/staging regions are placed accordingly), so
+   * a mapped range whose offset is a multiple of kMapAlignment can be filled with aligned SIMD
+   * stores.
+   */
+  static constexpr size_t kMapAlignment = 64;
+
   /**
    * @brief Map a portion of the contents of a GPU Buffer into memory. Not efficient on OpenGL.
    * unmap() must be called before the buffer is used again in any GPU operations.
    *
+   * The returned pointer is aligned to kMapAlignment bytes whenever range.offset is a multiple of
+   * kMapAlignment.
+   *
    * @param range offset (in IBuffer) and size
    * @param outResult result of the operation,  Result::Code::Ok On success
    * @return a pointer to the data mapped into memory.
    */
   virtual void* IGL_NULLABLE map(const BufferRange& range, Result* IGL_NULLABLE outResult) = 0;
 
+  /**
+   * @brief Typed view of a mapped buffer range: `data[0..size)` elements of T. Returned by
+   * mapSpan(); unmap() invalidates it.
+   */
+  template<typename T>
+  struct MappedSpan {
+    T* IGL_NULLABLE data = nullptr;
+    /** @brief Number of elements (not bytes) in the mapped range */
+    size_t size = 0;
+
+    T& operator[](size_t index) const {
+      IGL_ASSERT(data != nullptr && index < size);
+      return data[index];
+    }
+    T* IGL_NULLABLE begin() const {
+      return data;
+    }
+    T* IGL_NULLABLE end() const {
+      return data ? data + size : nullptr;
+    }
+  };
+
+  /**
+   * @brief Typed map(): maps `range` and returns it as a span of T. Debug builds assert that
+   * range.offset is a multiple of kMapAlignment - so SIMD writers may assume aligned stores - and
+   * that range.size is a whole number of elements. unmap() must still be called when done; on
+   * failure the returned span is empty.
+   */
+  template<typename T>
+  MappedSpan<T> mapSpan(const BufferRange& range, Result* IGL_NULLABLE outResult = nullptr) {
+    static_assert(alignof(T) <= kMapAlignment, "T is over-aligned for a mapped buffer range");
+    IGL_ASSERT_MSG(range.offset % kMapAlignment == 0,
+                   "mapSpan() offset must be a multiple of IBuffer::kMapAlignment");
+    IGL_ASSERT_MSG(range.size % sizeof(T) == 0,
+                   "mapSpan() size must be a whole number of elements");
+    void* IGL_NULLABLE ptr = map(range, outResult);
+    return ptr ? MappedSpan<T>{static_cast<T*>(ptr), range.size / sizeof(T)} : MappedSpan<T>{};
+  }
+
   /**
    * @brief Unmap a GPU Buffer from memory. Should be called after map().
    *
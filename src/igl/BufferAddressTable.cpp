@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <igl/BufferAddressTable.h>
+
+#include <cstring>
+
+#include <igl/Device.h>
+
+namespace igl {
+
+BufferAddressTable::BufferAddressTable(IDevice& device, uint32_t initialCapacity) :
+  device_(device), initialCapacity_(initialCapacity > 0 ? initialCapacity : 1) {}
+
+uint32_t BufferAddressTable::registerBuffer(const IBuffer& buffer,
+                                            size_t offset,
+                                            Result* IGL_NULLABLE outResult) {
+  const uint64_t address = buffer.gpuAddress(offset);
+  if (address == 0) {
+    Result::setResult(outResult,
+                      Result::Code::Unsupported,
+                      "Buffer has no GPU address; the backend does not support buffer device "
+                      "addresses or the feature was not enabled at context creation");
+    return kInvalidSlot;
+  }
+
+  uint32_t slot = kInvalidSlot;
+  if (!freeSlots_.empty()) {
+    slot = freeSlots_.back();
+    freeSlots_.pop_back();
+  } else {
+    if (!ensureCapacity(static_cast<uint32_t>(addresses_.size()) + 1, outResult)) {
+      return kInvalidSlot;
+    }
+    slot = static_cast<uint32_t>(addresses_.size());
+    addresses_.push_back(0);
+  }
+
+  addresses_[slot] = address;
+  uploadEntry(slot);
+
+  Result::setOk(outResult);
+  return slot;
+}
+
+void BufferAddressTable::updateBuffer(uint32_t slot, const IBuffer& buffer, size_t offset) {
+  if (!IGL_VERIFY(slot < addresses_.size())) {
+    return;
+  }
+  const uint64_t address = buffer.gpuAddress(offset);
+  if (!IGL_VERIFY(address != 0)) {
+    return;
+  }
+  addresses_[slot] = address;
+  uploadEntry(slot);
+}
+
+void BufferAddressTable::unregisterBuffer(uint32_t slot) {
+  if (!IGL_VERIFY(slot < addresses_.size())) {
+    return;
+  }
+  addresses_[slot] = 0;
+  uploadEntry(slot);
+  freeSlots_.push_back(slot);
+}
+
+bool BufferAddressTable::ensureCapacity(uint32_t numEntries, Result* outResult) {
+  if (numEntries <= bufferCapacity_) {
+    return true;
+  }
+
+  uint32_t newCapacity = bufferCapacity_ > 0 ? bufferCapacity_ : initialCapacity_;
+  while (newCapacity < numEntries) {
+    newCapacity *= 2;
+  }
+
+  // re-create the buffer at the new capacity and re-upload every live entry; the old buffer is
+  // released here, but callers that bound it for in-flight frames keep it alive via shared_ptr
+  std::vector<uint64_t> contents(addresses_);
+  contents.resize(newCapacity, 0);
+
+  Result result;
+  auto buffer = device_.createBuffer(BufferDesc(BufferDesc::BufferTypeBits::Storage,
+                                                contents.data(),
+                                                newCapacity * sizeof(uint64_t),
+                                                ResourceStorage::Shared,
+                                                0,
+                                                "Buffer: buffer address table"),
+                                     &result);
+  if (!result.isOk() || !buffer) {
+    Result::setResult(outResult, std::move(result));
+    return false;
+  }
+
+  tableBuffer_ = std::move(buffer);
+  bufferCapacity_ = newCapacity;
+  return true;
+}
+
+void BufferAddressTable::uploadEntry(uint32_t slot) {
+  if (!IGL_VERIFY(tableBuffer_)) {
+    return;
+  }
+  tableBuffer_->upload(&addresses_[slot], BufferRange(sizeof(uint64_t), slot * sizeof(uint64_t)));
+}
+
+} // namespace igl
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <igl/Buffer.h>
+#include <igl/Common.h>
+
+#include <memory>
+#include <vector>
+
+namespace igl {
+
+class IDevice;
+
+/// @brief A growable, GPU-visible table of buffer device addresses for GPU-driven rendering.
+///
+/// Shaders that chase buffer references need a stable way to name a buffer with a small integer:
+/// register a buffer here and the table stores its 64-bit GPU address (IBuffer::gpuAddress()) at
+/// the returned slot. Bind tableBuffer() once as a storage buffer of uint64 entries and per-draw
+/// data shrinks to slot indices — or to the raw 8-byte addresses themselves — instead of
+/// descriptor machinery.
+///
+/// Requires a backend with GPU buffer addresses: Vulkan with
+/// VulkanContextConfig::enableBufferDeviceAddress (VK_KHR_buffer_device_address) and shaders
+/// using GL_EXT_buffer_reference. Registration fails with Unsupported on backends where
+/// IBuffer::gpuAddress() is not implemented.
+///
+/// The table grows by reallocating at double capacity and re-uploading all live entries; the old
+/// buffer stays alive until every frame that bound it completes (callers hold it via the
+/// shared_ptr returned by tableBuffer()), but work encoded against the old buffer does not see
+/// entries added after the growth. Grow at load time, not mid-frame. Slots of unregistered
+/// buffers are reused. Not thread-safe; drive it from the thread that owns resource loading.
+class BufferAddressTable final {
+ public:
+  static constexpr uint32_t kInvalidSlot = 0xFFFFFFFF;
+
+  /// @brief Constructs a table on top of `device`, which must outlive the table. The backing
+  /// buffer is created lazily on the first registration, sized for `initialCapacity` entries.
+  explicit BufferAddressTable(IDevice& device, uint32_t initialCapacity = 256);
+
+  BufferAddressTable(const BufferAddressTable&) = delete;
+  BufferAddressTable& operator=(const BufferAddressTable&) = delete;
+
+  /// @brief Stores `buffer.gpuAddress(offset)` in the table and returns its slot, growing the
+  /// table when full. The table records the address only; the caller keeps the buffer alive.
+  /// Returns kInvalidSlot when the backend has no GPU addresses or the allocation fails.
+  uint32_t registerBuffer(const IBuffer& buffer,
+                          size_t offset = 0,
+                          Result* IGL_NULLABLE outResult = nullptr);
+
+  /// @brief Overwrites the address stored at `slot`, e.g. after the underlying buffer was
+  /// re-created. Work already encoded against the table may still read the old address.
+  void updateBuffer(uint32_t slot, const IBuffer& buffer, size_t offset = 0);
+
+  /// @brief Clears `slot` to a null address and makes it available for reuse.
+  void unregisterBuffer(uint32_t slot);
+
+  /// @brief The GPU-visible table: a storage buffer of uint64 device addresses, indexable by
+  /// slot. Null until the first registration. Re-fetch after registrations that may have grown
+  /// the table.
+  [[nodiscard]] std::shared_ptr<IBuffer> tableBuffer() const {
+    return tableBuffer_;
+  }
+
+  /// @brief Number of entries the current backing buffer can hold.
+  [[nodiscard]] uint32_t capacity() const {
+    return bufferCapacity_;
+  }
+
+ private:
+  bool ensureCapacity(uint32_t numEntries, Result* outResult);
+  void uploadEntry(uint32_t slot);
+
+  IDevice& device_;
+  uint32_t initialCapacity_;
+  uint32_t bufferCapacity_ = 0;
+
+  // CPU shadow of the table; re-uploaded wholesale when the buffer is re-created on growth
+  std::vector<uint64_t> addresses_;
+  std::vector<uint32_t> freeSlots_;
+  std::shared_ptr<IBuffer> tableBuffer_;
+};
+
+} // namespace igl
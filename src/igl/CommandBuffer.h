@@ -11,10 +11,13 @@
 #include <igl/Common.h>
 #include <igl/Framebuffer.h>
 #include <igl/RenderCommandEncoder.h>
+#include <string>
+#include <vector>
 
 namespace igl {
 
 class IComputeCommandEncoder;
+class IQueueEvent;
 class ISamplerState;
 class ITexture;
 struct RenderPassDesc;
@@ -24,14 +27,81 @@ struct RenderPassDesc;
  */
 struct CommandBufferDesc {
   std::string debugName;
+
+  /**
+   * @brief Hint that this command buffer will be submitted multiple times without re-encoding
+   * (e.g. a shadow or static-geometry pass that is identical every frame).
+   *
+   * When a backend honors the hint (currently Vulkan), the recorded commands stay valid after
+   * submission: keep the ICommandBuffer alive and pass it to ICommandQueue::submit() again on
+   * later frames to replay it. Re-submission waits for the previous submission of the same
+   * buffer to complete. The recorded work must not reference per-frame transient state
+   * (bindBytes data, ring buffers, swapchain images), and there is no automatic invalidation —
+   * when any referenced resource is destroyed or re-created, drop the buffer and encode a new
+   * one. Backends without reuse support ignore the hint and the buffer stays one-shot.
+   */
+  bool reusable = false;
 };
 
 /**
- * Struct containing data about the command buffer usage. Currently used to track the number of draw
- * calls performed by this command buffer (see specific method usage below).
+ * Struct containing data about the command buffer usage. The counters are accumulated by the
+ * command encoders of every backend as commands are encoded; they are cheap enough to stay
+ * always-on and are retrievable after submission via ICommandBuffer::getStatistics(). Content
+ * budget tooling can gate on them without instrumenting the engine layer above IGL (which would
+ * miss IGL-internal binds).
  */
 struct CommandBufferStatistics {
+  /** @brief Number of draw calls, direct and indirect. */
   uint32_t currentDrawCount = 0;
+  /** @brief Sum of the instance counts of all direct draw calls. */
+  uint32_t instanceCount = 0;
+  /** @brief Estimated primitives (triangles, lines or points) of all direct draw calls. Derived
+   * from vertex/index counts, so primitive restart and indirect draws are not reflected. */
+  uint64_t estimatedPrimitiveCount = 0;
+  /** @brief Number of compute dispatches, direct and indirect. */
+  uint32_t dispatchCount = 0;
+  /** @brief Number of render and compute pipeline state binds. */
+  uint32_t pipelineBindCount = 0;
+  /** @brief Number of texture and sampler state binds. */
+  uint32_t textureBindCount = 0;
+  /** @brief Number of vertex, uniform and storage buffer binds (including bindBytes). */
+  uint32_t bufferBindCount = 0;
+  /** @brief Number of memory/image barriers recorded by the encoders (e.g. for Dependencies or
+   * storage-image transitions). Backends with driver-managed hazards (Metal, OpenGL) report 0 or
+   * only explicit barriers. */
+  uint32_t barrierCount = 0;
+};
+
+/**
+ * @brief Estimates the number of primitives a direct draw of `vertexCount` vertices (or indices)
+ * produces; used for CommandBufferStatistics::estimatedPrimitiveCount.
+ */
+inline uint64_t estimatedPrimitiveCount(PrimitiveType primitiveType, uint64_t vertexCount) {
+  switch (primitiveType) {
+  case PrimitiveType::Point:
+    return vertexCount;
+  case PrimitiveType::Line:
+    return vertexCount / 2;
+  case PrimitiveType::LineStrip:
+    return vertexCount > 1 ? vertexCount - 1 : 0;
+  case PrimitiveType::Triangle:
+    return vertexCount / 3;
+  case PrimitiveType::TriangleStrip:
+    return vertexCount > 2 ? vertexCount - 2 : 0;
+  }
+  return 0;
+}
+
+/**
+ * A resolved GPU timing zone recorded via ICommandBuffer::pushGpuTimestampZone() /
+ * popGpuTimestampZone(). The begin/end values are GPU timestamps converted to nanoseconds; they
+ * share a common origin within one command buffer, so (end - begin) is the GPU time spent in the
+ * zone and zones from the same command buffer can be ordered relative to each other.
+ */
+struct GpuTimestampZone {
+  std::string name;
+  uint64_t beginNanoseconds = 0;
+  uint64_t endNanoseconds = 0;
 };
 
 /**
@@ -86,6 +156,31 @@ class ICommandBuffer {
    */
   virtual void present(std::shared_ptr<ITexture> surface) const = 0;
 
+  /**
+   * @brief Encodes a GPU-side wait: commands encoded into this CommandBuffer do not execute
+   * until the event's timeline value reaches `value`. Must be called before creating encoders,
+   * since backends encode the wait inline. Backends without queue-event support assert; check
+   * IDevice::createQueueEvent.
+   * @see igl::IQueueEvent
+   */
+  virtual void waitEvent(const std::shared_ptr<IQueueEvent>& event, uint64_t value) {
+    (void)event;
+    (void)value;
+    IGL_ASSERT_NOT_IMPLEMENTED();
+  }
+
+  /**
+   * @brief Encodes a GPU-side signal: the event's timeline value is set to `value` once all
+   * previously encoded commands in this CommandBuffer complete. Must be called after ending the
+   * encoders whose work the signal covers. Backends without queue-event support assert.
+   * @see igl::IQueueEvent
+   */
+  virtual void signalEvent(const std::shared_ptr<IQueueEvent>& event, uint64_t value) {
+    (void)event;
+    (void)value;
+    IGL_ASSERT_NOT_IMPLEMENTED();
+  }
+
   /**
    * @brief Blocks execution of the current thread until the commands encoded in this
    * CommandBuffer have been scheduled for execution.
@@ -117,6 +212,33 @@ class ICommandBuffer {
    */
   virtual void popDebugGroupLabel() const = 0;
 
+  /**
+   * @brief Begins a named GPU timing zone. Zones may be nested; each successful call must be
+   * matched by popGpuTimestampZone(). Must be called while no command encoder created from this
+   * CommandBuffer is active.
+   * @returns false when the backend or the current device cannot record GPU timestamps; in that
+   * case no zone is opened and popGpuTimestampZone() must not be called for it.
+   */
+  virtual bool pushGpuTimestampZone(const char* IGL_NONNULL /*name*/) {
+    return false;
+  }
+
+  /**
+   * @brief Ends the most recently opened GPU timing zone.
+   */
+  virtual void popGpuTimestampZone() {}
+
+  /**
+   * @brief Non-blocking retrieval of the GPU timing zones recorded into this CommandBuffer. Call
+   * after the CommandBuffer has been submitted; keep the CommandBuffer alive until the results have
+   * been retrieved.
+   * @returns true once all recorded zones have resolved on the GPU, with the zones written to
+   * outZones; false while results are still pending or when no zones were recorded.
+   */
+  virtual bool getGpuTimestampZones(std::vector<GpuTimestampZone>& /*outZones*/) const {
+    return false;
+  }
+
   /**
    * @returns the number of draw operations tracked by this CommandBuffer. This is tracked manually
    * via calls to incrementCurrentDrawCount().
@@ -132,6 +254,20 @@ class ICommandBuffer {
     statistics_.currentDrawCount++;
   }
 
+  /**
+   * @returns all usage counters tracked by this CommandBuffer; valid any time, typically read
+   * after submission.
+   */
+  const CommandBufferStatistics& getStatistics() const {
+    return statistics_;
+  }
+  /**
+   * @brief Mutable access to the usage counters; used by the command encoders while encoding.
+   */
+  CommandBufferStatistics& mutableStatistics() {
+    return statistics_;
+  }
+
  private:
   CommandBufferStatistics statistics_;
 };
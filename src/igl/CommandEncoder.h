@@ -13,7 +13,10 @@
 
 namespace igl {
 
+class IBuffer;
+class ICommandBuffer;
 class IDevice;
+class ITexture;
 
 /**
  * Dependencies are used to issue proper memory barriers for external resources, such as textures
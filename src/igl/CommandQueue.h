@@ -47,6 +47,18 @@ struct CommandQueueStatistics {
 /// GPU Fence Handle
 using SubmitHandle = uint64_t;
 
+/**
+ * Opaque cross-queue synchronization primitive with a monotonically increasing 64-bit timeline
+ * value. Created via IDevice::createQueueEvent; signal and wait points are attached to command
+ * buffers via ICommandBuffer::signalEvent / waitEvent, so work submitted to one queue (e.g. async
+ * compute) can overlap with and synchronize against another (e.g. graphics) without a CPU
+ * round-trip. Maps to MTLEvent on Metal and timeline semaphores on Vulkan.
+ */
+class IQueueEvent {
+ public:
+  virtual ~IQueueEvent() = default;
+};
+
 /**
  * Overarching structure used to create specific command buffers that accept device commands.
  * There are three different command queue types: compute, graphics, and memory transfer.
@@ -62,6 +74,22 @@ class ICommandQueue {
   virtual std::shared_ptr<ICommandBuffer> createCommandBuffer(const CommandBufferDesc& desc,
                                                               Result* IGL_NULLABLE outResult) = 0;
   virtual SubmitHandle submit(const ICommandBuffer& commandBuffer, bool endOfFrame = false) = 0;
+  /**
+   * Submits several command buffers in order with one call. The returned handle completes when
+   * the last buffer in the batch completes; since buffers execute in submission order on the
+   * queue, that handle fences the whole batch. The base implementation loops over submit();
+   * backends can override it to amortize per-submission driver overhead.
+   */
+  virtual SubmitHandle submitBatch(const ICommandBuffer* IGL_NONNULL const* IGL_NONNULL
+                                       commandBuffers,
+                                   size_t count,
+                                   bool endOfFrame = false) {
+    SubmitHandle handle = 0;
+    for (size_t i = 0; i < count; ++i) {
+      handle = submit(*commandBuffers[i], endOfFrame && i + 1 == count);
+    }
+    return handle;
+  }
   uint32_t getLastFrameDrawCount() const {
     return statistics.lastFrameDrawCount;
   }
@@ -13,9 +13,11 @@
 #include <cstdarg>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <igl/Core.h>
 #include <limits>
 #include <memory>
+#include <ostream>
 #include <string>
 #include <type_traits>
 #include <utility>
@@ -56,6 +58,17 @@ enum class ResourceStorage {
              /// pass
 };
 
+/// Explicit memory placement for buffers, more precise than ResourceStorage. Default derives the
+/// placement from ResourceStorage as before; the other values name the heap directly so backends
+/// do not have to guess (Vulkan memory property flags, MTLStorageMode, GL usage hints).
+enum class MemoryPlacement : uint8_t {
+  Default, /// Derive placement from ResourceStorage
+  DeviceLocal, /// VRAM; CPU uploads go through a staging copy
+  HostUpload, /// CPU-visible upload heap; ideal for write-once data the GPU reads a few times
+  Readback, /// CPU-cached memory for GPU->CPU readback
+  DeviceLocalHostVisible, /// CPU-visible VRAM (BAR/ReBAR); falls back to HostUpload when absent
+};
+
 enum class CullMode : uint8_t { Disabled, Front, Back };
 enum class WindingMode : uint8_t { Clockwise, CounterClockwise };
 enum class NormalizedZRange : uint8_t { NegOneToOne, ZeroToOne };
@@ -96,8 +109,54 @@ struct Result {
     RuntimeError,
   };
 
+  /**
+   * @brief Holds a Result's message without allocating in the common cases.
+   *
+   * Most call sites pass string literals; those are stored as the pointer itself, so
+   * constructing, copying and clearing such a Result never touches the heap. Messages built
+   * from a std::string keep their characters alive in a shared detail payload, allocated only
+   * when such a message is actually created.
+   */
+  class Message {
+   public:
+    Message() = default;
+    /// The pointer is stored, not copied: it must reference storage that outlives every copy of
+    /// the Result, e.g. a string literal.
+    Message(const char* IGL_NULLABLE str) : literal_(str != nullptr ? str : "") {}
+    Message(std::string str) :
+      detail_(str.empty() ? nullptr : std::make_shared<const std::string>(std::move(str))) {}
+
+    const char* IGL_NONNULL c_str() const {
+      return detail_ ? detail_->c_str() : literal_;
+    }
+
+    bool empty() const {
+      return c_str()[0] == '\0';
+    }
+
+    std::string toString() const {
+      return c_str();
+    }
+
+    bool operator==(const Message& other) const {
+      return strcmp(c_str(), other.c_str()) == 0;
+    }
+
+    bool operator!=(const Message& other) const {
+      return !(*this == other);
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, const Message& message) {
+      return os << message.c_str();
+    }
+
+   private:
+    const char* IGL_NONNULL literal_ = "";
+    std::shared_ptr<const std::string> detail_;
+  };
+
   Code code = Code::Ok;
-  std::string message;
+  Message message;
   explicit Result() = default;
   explicit Result(Code code, const char* IGL_NULLABLE message = "") :
     code(code), message(message) {}
@@ -107,15 +166,19 @@ struct Result {
     return code == Result::Code::Ok;
   }
 
-  static void setResult(Result* IGL_NULLABLE outResult,
-                        Code code,
-                        const std::string& message = "") {
+  static void setResult(Result* IGL_NULLABLE outResult, Code code, Message message) {
     if (outResult != nullptr) {
       outResult->code = code;
-      outResult->message = message;
+      outResult->message = std::move(message);
     }
   }
 
+  // not a default argument: GCC rejects `Message{}` as a default argument here because the
+  // nested class's member initializers are not complete until the end of Result itself
+  static void setResult(Result* IGL_NULLABLE outResult, Code code) {
+    setResult(outResult, code, Message());
+  }
+
   static void setResult(Result* IGL_NULLABLE outResult, const Result& sourceResult) {
     if (outResult != nullptr) {
       *outResult = sourceResult;
@@ -131,7 +194,7 @@ struct Result {
   static void setOk(Result* IGL_NULLABLE outResult) {
     if (outResult != nullptr) {
       outResult->code = Code::Ok;
-      outResult->message = std::string();
+      outResult->message = Message();
     }
   }
 };
@@ -38,8 +38,10 @@ class IComputeCommandEncoder : public ICommandEncoder {
   /**
    * @brief Construct a new IComputeCommandEncoder object
    *
+   * @param commandBuffer The command buffer the encoder encodes into.
    */
-  IComputeCommandEncoder() : ICommandEncoder::ICommandEncoder(nullptr) {}
+  explicit IComputeCommandEncoder(std::shared_ptr<ICommandBuffer> commandBuffer = nullptr) :
+    ICommandEncoder(std::move(commandBuffer)) {}
 
   /**
    * @brief Destroy the IComputeCommandEncoder object
@@ -0,0 +1,599 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <igl/DeferredCommandStream.h>
+
+#include <cstring>
+#include <igl/Uniform.h>
+
+namespace igl {
+namespace {
+
+// POD records stored in the tape. Resources recorded by shared_ptr are referenced by index into
+// the stream's side tables; resources recorded by raw pointer must outlive the replay, matching
+// the contract of the underlying encoder API.
+
+struct ViewportRec {
+  Viewport viewport;
+};
+struct ScissorRec {
+  ScissorRect rect;
+};
+struct IndexRec {
+  uint32_t index;
+};
+struct BindBufferRec {
+  int32_t index;
+  uint8_t target;
+  uint32_t buffer;
+  uint64_t offset;
+};
+struct BindVertexBufferRec {
+  uint32_t index;
+  uint32_t buffer;
+  uint64_t offset;
+};
+struct PayloadRec {
+  uint64_t index;
+  uint8_t target;
+  uint32_t payload;
+  uint32_t length;
+};
+struct PushConstantsRec {
+  uint32_t payload;
+  uint64_t length;
+  uint64_t offset;
+};
+struct BindSamplerRec {
+  uint64_t index;
+  uint8_t target;
+  ISamplerState* IGL_NULLABLE sampler;
+};
+struct BindTextureRec {
+  uint64_t index;
+  uint8_t target;
+  ITexture* IGL_NULLABLE texture;
+};
+struct BindUniformRec {
+  uint32_t desc;
+  uint32_t payload;
+};
+struct DrawRec {
+  PrimitiveType primitiveType;
+  uint64_t vertexStart;
+  uint64_t vertexCount;
+  uint32_t instanceCount;
+  uint32_t baseInstance;
+};
+struct DrawIndexedRec {
+  PrimitiveType primitiveType;
+  IndexFormat indexFormat;
+  uint64_t indexCount;
+  IBuffer* IGL_NONNULL indexBuffer;
+  uint64_t indexBufferOffset;
+  uint32_t instanceCount;
+  int32_t baseVertex;
+  uint32_t baseInstance;
+};
+struct DrawIndexedIndirectRec {
+  PrimitiveType primitiveType;
+  IndexFormat indexFormat;
+  IBuffer* IGL_NONNULL indexBuffer;
+  IBuffer* IGL_NONNULL indirectBuffer;
+  uint64_t indirectBufferOffset;
+};
+struct MultiDrawIndirectRec {
+  PrimitiveType primitiveType;
+  IBuffer* IGL_NONNULL indirectBuffer;
+  uint64_t indirectBufferOffset;
+  uint32_t drawCount;
+  uint32_t stride;
+};
+struct MultiDrawIndexedIndirectRec {
+  PrimitiveType primitiveType;
+  IndexFormat indexFormat;
+  IBuffer* IGL_NONNULL indexBuffer;
+  IBuffer* IGL_NONNULL indirectBuffer;
+  uint64_t indirectBufferOffset;
+  uint32_t drawCount;
+  uint32_t stride;
+};
+struct MultiDrawIndexedIndirectCountRec {
+  PrimitiveType primitiveType;
+  IndexFormat indexFormat;
+  IBuffer* IGL_NONNULL indexBuffer;
+  IBuffer* IGL_NONNULL indirectBuffer;
+  uint64_t indirectBufferOffset;
+  IBuffer* IGL_NONNULL countBuffer;
+  uint64_t countBufferOffset;
+  uint32_t maxDrawCount;
+  uint32_t stride;
+};
+struct StencilRefRec {
+  uint32_t value;
+};
+struct StencilRefsRec {
+  uint32_t frontValue;
+  uint32_t backValue;
+};
+struct BlendColorRec {
+  Color color{0, 0, 0, 0};
+};
+struct DepthBiasRec {
+  float depthBias;
+  float slopeScale;
+  float clamp;
+};
+struct LabelRec {
+  uint32_t label;
+  Color color{1, 1, 1, 1};
+};
+
+constexpr size_t alignUp(size_t offset, size_t alignment) {
+  return (offset + alignment - 1) & ~(alignment - 1);
+}
+
+// Sequential tape reader used by replay()
+class TapeReader {
+ public:
+  explicit TapeReader(const std::vector<uint8_t>& tape) : tape_(tape) {}
+
+  [[nodiscard]] bool done() const {
+    return cursor_ >= tape_.size();
+  }
+
+  uint8_t readOp() {
+    return tape_[cursor_++];
+  }
+
+  template<typename T>
+  const T& read() {
+    cursor_ = alignUp(cursor_, alignof(T));
+    const T* record = reinterpret_cast<const T*>(tape_.data() + cursor_);
+    cursor_ += sizeof(T);
+    return *record;
+  }
+
+ private:
+  const std::vector<uint8_t>& tape_;
+  size_t cursor_ = 0;
+};
+
+} // namespace
+
+DeferredRenderCommandStream::DeferredRenderCommandStream() : IRenderCommandEncoder(nullptr) {}
+
+template<typename T>
+T& DeferredRenderCommandStream::push(Op op) {
+  static_assert(std::is_trivially_copyable<T>::value, "tape records must be trivially copyable");
+  IGL_ASSERT_MSG(!encodingEnded_, "recording into a stream after endEncoding()");
+
+  tape_.push_back(static_cast<uint8_t>(op));
+  const size_t offset = alignUp(tape_.size(), alignof(T));
+  tape_.resize(offset + sizeof(T));
+  numCommands_++;
+  return *(new (tape_.data() + offset) T{});
+}
+
+uint32_t DeferredRenderCommandStream::pushPayload(const void* data, size_t length) {
+  const auto offset = static_cast<uint32_t>(payloads_.size());
+  const auto* bytes = static_cast<const uint8_t*>(data);
+  payloads_.insert(payloads_.end(), bytes, bytes + length);
+  return offset;
+}
+
+uint32_t DeferredRenderCommandStream::retain(std::shared_ptr<IRenderPipelineState> state) {
+  pipelineStates_.push_back(std::move(state));
+  return static_cast<uint32_t>(pipelineStates_.size() - 1);
+}
+
+uint32_t DeferredRenderCommandStream::retain(std::shared_ptr<IDepthStencilState> state) {
+  depthStencilStates_.push_back(std::move(state));
+  return static_cast<uint32_t>(depthStencilStates_.size() - 1);
+}
+
+uint32_t DeferredRenderCommandStream::retain(std::shared_ptr<IBuffer> buffer) {
+  buffers_.push_back(std::move(buffer));
+  return static_cast<uint32_t>(buffers_.size() - 1);
+}
+
+uint32_t DeferredRenderCommandStream::retain(std::string label) {
+  labels_.push_back(std::move(label));
+  return static_cast<uint32_t>(labels_.size() - 1);
+}
+
+uint32_t DeferredRenderCommandStream::retain(UniformDesc desc) {
+  uniformDescs_.push_back(std::move(desc));
+  return static_cast<uint32_t>(uniformDescs_.size() - 1);
+}
+
+void DeferredRenderCommandStream::reset() {
+  tape_.clear();
+  payloads_.clear();
+  numCommands_ = 0;
+  encodingEnded_ = false;
+  pipelineStates_.clear();
+  depthStencilStates_.clear();
+  buffers_.clear();
+  labels_.clear();
+  uniformDescs_.clear();
+}
+
+void DeferredRenderCommandStream::endEncoding() {
+  encodingEnded_ = true;
+}
+
+void DeferredRenderCommandStream::pushDebugGroupLabel(const char* label,
+                                                      const igl::Color& color) const {
+  auto* self = const_cast<DeferredRenderCommandStream*>(this);
+  auto& rec = self->push<LabelRec>(Op::PushDebugGroupLabel);
+  rec.label = self->retain(std::string(label));
+  rec.color = color;
+}
+
+void DeferredRenderCommandStream::insertDebugEventLabel(const char* label,
+                                                        const igl::Color& color) const {
+  auto* self = const_cast<DeferredRenderCommandStream*>(this);
+  auto& rec = self->push<LabelRec>(Op::InsertDebugEventLabel);
+  rec.label = self->retain(std::string(label));
+  rec.color = color;
+}
+
+void DeferredRenderCommandStream::popDebugGroupLabel() const {
+  auto* self = const_cast<DeferredRenderCommandStream*>(this);
+  self->push<IndexRec>(Op::PopDebugGroupLabel);
+}
+
+void DeferredRenderCommandStream::bindViewport(const Viewport& viewport) {
+  push<ViewportRec>(Op::BindViewport).viewport = viewport;
+}
+
+void DeferredRenderCommandStream::bindScissorRect(const ScissorRect& rect) {
+  push<ScissorRec>(Op::BindScissorRect).rect = rect;
+}
+
+void DeferredRenderCommandStream::bindRenderPipelineState(
+    const std::shared_ptr<IRenderPipelineState>& pipelineState) {
+  push<IndexRec>(Op::BindRenderPipelineState).index = retain(pipelineState);
+}
+
+void DeferredRenderCommandStream::bindDepthStencilState(
+    const std::shared_ptr<IDepthStencilState>& depthStencilState) {
+  push<IndexRec>(Op::BindDepthStencilState).index = retain(depthStencilState);
+}
+
+void DeferredRenderCommandStream::bindBuffer(int index,
+                                             uint8_t target,
+                                             const std::shared_ptr<IBuffer>& buffer,
+                                             size_t bufferOffset) {
+  auto& rec = push<BindBufferRec>(Op::BindBuffer);
+  rec.index = index;
+  rec.target = target;
+  rec.buffer = retain(buffer);
+  rec.offset = bufferOffset;
+}
+
+void DeferredRenderCommandStream::bindVertexBuffer(uint32_t index,
+                                                   const std::shared_ptr<IBuffer>& buffer,
+                                                   size_t bufferOffset) {
+  auto& rec = push<BindVertexBufferRec>(Op::BindVertexBuffer);
+  rec.index = index;
+  rec.buffer = retain(buffer);
+  rec.offset = bufferOffset;
+}
+
+void DeferredRenderCommandStream::bindBytes(size_t index,
+                                            uint8_t target,
+                                            const void* data,
+                                            size_t length) {
+  auto& rec = push<PayloadRec>(Op::BindBytes);
+  rec.index = index;
+  rec.target = target;
+  rec.payload = pushPayload(data, length);
+  rec.length = static_cast<uint32_t>(length);
+}
+
+void DeferredRenderCommandStream::bindPushConstants(const void* data, size_t length, size_t offset) {
+  auto& rec = push<PushConstantsRec>(Op::BindPushConstants);
+  rec.payload = pushPayload(data, length);
+  rec.length = length;
+  rec.offset = offset;
+}
+
+void DeferredRenderCommandStream::bindSamplerState(size_t index,
+                                                   uint8_t target,
+                                                   ISamplerState* samplerState) {
+  auto& rec = push<BindSamplerRec>(Op::BindSamplerState);
+  rec.index = index;
+  rec.target = target;
+  rec.sampler = samplerState;
+}
+
+void DeferredRenderCommandStream::bindTexture(size_t index, uint8_t target, ITexture* texture) {
+  auto& rec = push<BindTextureRec>(Op::BindTexture);
+  rec.index = index;
+  rec.target = target;
+  rec.texture = texture;
+}
+
+void DeferredRenderCommandStream::bindUniform(const UniformDesc& uniformDesc, const void* data) {
+  // same size computation the GL uniform adapter performs when consuming the call
+  const size_t length =
+      (uniformDesc.elementStride != 0 ? uniformDesc.elementStride
+                                      : sizeForUniformType(uniformDesc.type)) *
+      uniformDesc.numElements;
+
+  auto& rec = push<BindUniformRec>(Op::BindUniform);
+  rec.desc = retain(uniformDesc);
+  rec.payload = pushPayload(data, length);
+}
+
+void DeferredRenderCommandStream::draw(PrimitiveType primitiveType,
+                                       size_t vertexStart,
+                                       size_t vertexCount,
+                                       uint32_t instanceCount,
+                                       uint32_t baseInstance) {
+  auto& rec = push<DrawRec>(Op::Draw);
+  rec.primitiveType = primitiveType;
+  rec.vertexStart = vertexStart;
+  rec.vertexCount = vertexCount;
+  rec.instanceCount = instanceCount;
+  rec.baseInstance = baseInstance;
+}
+
+void DeferredRenderCommandStream::drawIndexed(PrimitiveType primitiveType,
+                                              size_t indexCount,
+                                              IndexFormat indexFormat,
+                                              IBuffer& indexBuffer,
+                                              size_t indexBufferOffset,
+                                              uint32_t instanceCount,
+                                              int32_t baseVertex,
+                                              uint32_t baseInstance) {
+  auto& rec = push<DrawIndexedRec>(Op::DrawIndexed);
+  rec.primitiveType = primitiveType;
+  rec.indexFormat = indexFormat;
+  rec.indexCount = indexCount;
+  rec.indexBuffer = &indexBuffer;
+  rec.indexBufferOffset = indexBufferOffset;
+  rec.instanceCount = instanceCount;
+  rec.baseVertex = baseVertex;
+  rec.baseInstance = baseInstance;
+}
+
+void DeferredRenderCommandStream::drawIndexedIndirect(PrimitiveType primitiveType,
+                                                      IndexFormat indexFormat,
+                                                      IBuffer& indexBuffer,
+                                                      IBuffer& indirectBuffer,
+                                                      size_t indirectBufferOffset) {
+  auto& rec = push<DrawIndexedIndirectRec>(Op::DrawIndexedIndirect);
+  rec.primitiveType = primitiveType;
+  rec.indexFormat = indexFormat;
+  rec.indexBuffer = &indexBuffer;
+  rec.indirectBuffer = &indirectBuffer;
+  rec.indirectBufferOffset = indirectBufferOffset;
+}
+
+void DeferredRenderCommandStream::multiDrawIndirect(PrimitiveType primitiveType,
+                                                    IBuffer& indirectBuffer,
+                                                    size_t indirectBufferOffset,
+                                                    uint32_t drawCount,
+                                                    uint32_t stride) {
+  auto& rec = push<MultiDrawIndirectRec>(Op::MultiDrawIndirect);
+  rec.primitiveType = primitiveType;
+  rec.indirectBuffer = &indirectBuffer;
+  rec.indirectBufferOffset = indirectBufferOffset;
+  rec.drawCount = drawCount;
+  rec.stride = stride;
+}
+
+void DeferredRenderCommandStream::multiDrawIndexedIndirect(PrimitiveType primitiveType,
+                                                           IndexFormat indexFormat,
+                                                           IBuffer& indexBuffer,
+                                                           IBuffer& indirectBuffer,
+                                                           size_t indirectBufferOffset,
+                                                           uint32_t drawCount,
+                                                           uint32_t stride) {
+  auto& rec = push<MultiDrawIndexedIndirectRec>(Op::MultiDrawIndexedIndirect);
+  rec.primitiveType = primitiveType;
+  rec.indexFormat = indexFormat;
+  rec.indexBuffer = &indexBuffer;
+  rec.indirectBuffer = &indirectBuffer;
+  rec.indirectBufferOffset = indirectBufferOffset;
+  rec.drawCount = drawCount;
+  rec.stride = stride;
+}
+
+void DeferredRenderCommandStream::multiDrawIndexedIndirectCount(PrimitiveType primitiveType,
+                                                                IndexFormat indexFormat,
+                                                                IBuffer& indexBuffer,
+                                                                IBuffer& indirectBuffer,
+                                                                size_t indirectBufferOffset,
+                                                                IBuffer& countBuffer,
+                                                                size_t countBufferOffset,
+                                                                uint32_t maxDrawCount,
+                                                                uint32_t stride) {
+  auto& rec = push<MultiDrawIndexedIndirectCountRec>(Op::MultiDrawIndexedIndirectCount);
+  rec.primitiveType = primitiveType;
+  rec.indexFormat = indexFormat;
+  rec.indexBuffer = &indexBuffer;
+  rec.indirectBuffer = &indirectBuffer;
+  rec.indirectBufferOffset = indirectBufferOffset;
+  rec.countBuffer = &countBuffer;
+  rec.countBufferOffset = countBufferOffset;
+  rec.maxDrawCount = maxDrawCount;
+  rec.stride = stride;
+}
+
+void DeferredRenderCommandStream::setStencilReferenceValue(uint32_t value) {
+  push<StencilRefRec>(Op::SetStencilReferenceValue).value = value;
+}
+
+void DeferredRenderCommandStream::setStencilReferenceValues(uint32_t frontValue,
+                                                            uint32_t backValue) {
+  auto& rec = push<StencilRefsRec>(Op::SetStencilReferenceValues);
+  rec.frontValue = frontValue;
+  rec.backValue = backValue;
+}
+
+void DeferredRenderCommandStream::setBlendColor(Color color) {
+  push<BlendColorRec>(Op::SetBlendColor).color = color;
+}
+
+void DeferredRenderCommandStream::setDepthBias(float depthBias, float slopeScale, float clamp) {
+  auto& rec = push<DepthBiasRec>(Op::SetDepthBias);
+  rec.depthBias = depthBias;
+  rec.slopeScale = slopeScale;
+  rec.clamp = clamp;
+}
+
+void DeferredRenderCommandStream::replay(IRenderCommandEncoder& encoder) const {
+  TapeReader reader(tape_);
+
+  while (!reader.done()) {
+    switch (static_cast<Op>(reader.readOp())) {
+    case Op::BindViewport:
+      encoder.bindViewport(reader.read<ViewportRec>().viewport);
+      break;
+    case Op::BindScissorRect:
+      encoder.bindScissorRect(reader.read<ScissorRec>().rect);
+      break;
+    case Op::BindRenderPipelineState:
+      encoder.bindRenderPipelineState(pipelineStates_[reader.read<IndexRec>().index]);
+      break;
+    case Op::BindDepthStencilState:
+      encoder.bindDepthStencilState(depthStencilStates_[reader.read<IndexRec>().index]);
+      break;
+    case Op::BindBuffer: {
+      const auto& rec = reader.read<BindBufferRec>();
+      encoder.bindBuffer(rec.index, rec.target, buffers_[rec.buffer], rec.offset);
+      break;
+    }
+    case Op::BindVertexBuffer: {
+      const auto& rec = reader.read<BindVertexBufferRec>();
+      encoder.bindVertexBuffer(rec.index, buffers_[rec.buffer], rec.offset);
+      break;
+    }
+    case Op::BindBytes: {
+      const auto& rec = reader.read<PayloadRec>();
+      encoder.bindBytes(rec.index, rec.target, payloads_.data() + rec.payload, rec.length);
+      break;
+    }
+    case Op::BindPushConstants: {
+      const auto& rec = reader.read<PushConstantsRec>();
+      encoder.bindPushConstants(payloads_.data() + rec.payload, rec.length, rec.offset);
+      break;
+    }
+    case Op::BindSamplerState: {
+      const auto& rec = reader.read<BindSamplerRec>();
+      encoder.bindSamplerState(rec.index, rec.target, rec.sampler);
+      break;
+    }
+    case Op::BindTexture: {
+      const auto& rec = reader.read<BindTextureRec>();
+      encoder.bindTexture(rec.index, rec.target, rec.texture);
+      break;
+    }
+    case Op::BindUniform: {
+      const auto& rec = reader.read<BindUniformRec>();
+      encoder.bindUniform(uniformDescs_[rec.desc], payloads_.data() + rec.payload);
+      break;
+    }
+    case Op::Draw: {
+      const auto& rec = reader.read<DrawRec>();
+      encoder.draw(
+          rec.primitiveType, rec.vertexStart, rec.vertexCount, rec.instanceCount, rec.baseInstance);
+      break;
+    }
+    case Op::DrawIndexed: {
+      const auto& rec = reader.read<DrawIndexedRec>();
+      encoder.drawIndexed(rec.primitiveType,
+                          rec.indexCount,
+                          rec.indexFormat,
+                          *rec.indexBuffer,
+                          rec.indexBufferOffset,
+                          rec.instanceCount,
+                          rec.baseVertex,
+                          rec.baseInstance);
+      break;
+    }
+    case Op::DrawIndexedIndirect: {
+      const auto& rec = reader.read<DrawIndexedIndirectRec>();
+      encoder.drawIndexedIndirect(rec.primitiveType,
+                                  rec.indexFormat,
+                                  *rec.indexBuffer,
+                                  *rec.indirectBuffer,
+                                  rec.indirectBufferOffset);
+      break;
+    }
+    case Op::MultiDrawIndirect: {
+      const auto& rec = reader.read<MultiDrawIndirectRec>();
+      encoder.multiDrawIndirect(rec.primitiveType,
+                                *rec.indirectBuffer,
+                                rec.indirectBufferOffset,
+                                rec.drawCount,
+                                rec.stride);
+      break;
+    }
+    case Op::MultiDrawIndexedIndirect: {
+      const auto& rec = reader.read<MultiDrawIndexedIndirectRec>();
+      encoder.multiDrawIndexedIndirect(rec.primitiveType,
+                                       rec.indexFormat,
+                                       *rec.indexBuffer,
+                                       *rec.indirectBuffer,
+                                       rec.indirectBufferOffset,
+                                       rec.drawCount,
+                                       rec.stride);
+      break;
+    }
+    case Op::MultiDrawIndexedIndirectCount: {
+      const auto& rec = reader.read<MultiDrawIndexedIndirectCountRec>();
+      encoder.multiDrawIndexedIndirectCount(rec.primitiveType,
+                                            rec.indexFormat,
+                                            *rec.indexBuffer,
+                                            *rec.indirectBuffer,
+                                            rec.indirectBufferOffset,
+                                            *rec.countBuffer,
+                                            rec.countBufferOffset,
+                                            rec.maxDrawCount,
+                                            rec.stride);
+      break;
+    }
+    case Op::SetStencilReferenceValue:
+      encoder.setStencilReferenceValue(reader.read<StencilRefRec>().value);
+      break;
+    case Op::SetStencilReferenceValues: {
+      const auto& rec = reader.read<StencilRefsRec>();
+      encoder.setStencilReferenceValues(rec.frontValue, rec.backValue);
+      break;
+    }
+    case Op::SetBlendColor:
+      encoder.setBlendColor(reader.read<BlendColorRec>().color);
+      break;
+    case Op::SetDepthBias: {
+      const auto& rec = reader.read<DepthBiasRec>();
+      encoder.setDepthBias(rec.depthBias, rec.slopeScale, rec.clamp);
+      break;
+    }
+    case Op::PushDebugGroupLabel: {
+      const auto& rec = reader.read<LabelRec>();
+      encoder.pushDebugGroupLabel(labels_[rec.label].c_str(), rec.color);
+      break;
+    }
+    case Op::InsertDebugEventLabel: {
+      const auto& rec = reader.read<LabelRec>();
+      encoder.insertDebugEventLabel(labels_[rec.label].c_str(), rec.color);
+      break;
+    }
+    case Op::PopDebugGroupLabel:
+      reader.read<IndexRec>();
+      encoder.popDebugGroupLabel();
+      break;
+    }
+  }
+}
+
+} // namespace igl
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <igl/Common.h>
+#include <igl/RenderCommandEncoder.h>
+#include <string>
+#include <vector>
+
+namespace igl {
+
+/**
+ * @brief IRenderCommandEncoder implementation that records every call into a compact command
+ * tape instead of executing it, for later replay through a real encoder.
+ *
+ * This gives backends that must encode on a single thread — OpenGL above all, where the driver
+ * accepts calls only on the context thread — a multithreaded encode path: worker threads record
+ * into their own streams (a stream is single-threaded, streams are independent), and the thread
+ * that owns the context replays them in order into a real encoder. The replay thread itself
+ * stays application-owned, since the application owns the GL context and its thread affinity.
+ *
+ * Commands are POD records appended to a contiguous arena that is reused across frames via
+ * reset(), so steady-state recording performs no allocation. Payloads passed by pointer
+ * (bindBytes, bindUniform, bindPushConstants, debug labels) are copied into the arena at record
+ * time; resources passed by shared_ptr are retained until reset(). Resources passed by raw
+ * pointer or reference (textures, samplers, index/indirect buffers) follow the same contract as
+ * the rest of the encoder API and must outlive the replay.
+ *
+ * endEncoding() marks the tape complete; it is the replay target's endEncoding() that ends the
+ * real pass, so callers replay a stream between creating and ending a real encoder.
+ */
+class DeferredRenderCommandStream final : public IRenderCommandEncoder {
+ public:
+  DeferredRenderCommandStream();
+
+  /// Replays the recorded commands, in order, into `encoder`. Must run on the thread the target
+  /// encoder may be used from. A stream can be replayed multiple times.
+  void replay(IRenderCommandEncoder& encoder) const;
+
+  /// Discards the recorded commands and releases retained resources, keeping the arena capacity
+  /// so the stream can record the next frame without allocating.
+  void reset();
+
+  /// Returns the number of recorded commands.
+  [[nodiscard]] size_t size() const noexcept {
+    return numCommands_;
+  }
+
+  // IRenderCommandEncoder
+  void endEncoding() override;
+
+  void pushDebugGroupLabel(const char* label, const igl::Color& color) const override;
+  void insertDebugEventLabel(const char* label, const igl::Color& color) const override;
+  void popDebugGroupLabel() const override;
+
+  void bindViewport(const Viewport& viewport) override;
+  void bindScissorRect(const ScissorRect& rect) override;
+
+  void bindRenderPipelineState(const std::shared_ptr<IRenderPipelineState>& pipelineState) override;
+  void bindDepthStencilState(const std::shared_ptr<IDepthStencilState>& depthStencilState) override;
+
+  void bindBuffer(int index,
+                  uint8_t target,
+                  const std::shared_ptr<IBuffer>& buffer,
+                  size_t bufferOffset) override;
+  void bindVertexBuffer(uint32_t index,
+                        const std::shared_ptr<IBuffer>& buffer,
+                        size_t bufferOffset) override;
+  void bindBytes(size_t index, uint8_t target, const void* data, size_t length) override;
+  void bindPushConstants(const void* data, size_t length, size_t offset) override;
+  void bindSamplerState(size_t index, uint8_t target, ISamplerState* samplerState) override;
+  void bindTexture(size_t index, uint8_t target, ITexture* texture) override;
+  void bindUniform(const UniformDesc& uniformDesc, const void* data) override;
+
+  void draw(PrimitiveType primitiveType,
+            size_t vertexStart,
+            size_t vertexCount,
+            uint32_t instanceCount,
+            uint32_t baseInstance) override;
+  void drawIndexed(PrimitiveType primitiveType,
+                   size_t indexCount,
+                   IndexFormat indexFormat,
+                   IBuffer& indexBuffer,
+                   size_t indexBufferOffset,
+                   uint32_t instanceCount,
+                   int32_t baseVertex,
+                   uint32_t baseInstance) override;
+  void drawIndexedIndirect(PrimitiveType primitiveType,
+                           IndexFormat indexFormat,
+                           IBuffer& indexBuffer,
+                           IBuffer& indirectBuffer,
+                           size_t indirectBufferOffset) override;
+  void multiDrawIndirect(PrimitiveType primitiveType,
+                         IBuffer& indirectBuffer,
+                         size_t indirectBufferOffset,
+                         uint32_t drawCount,
+                         uint32_t stride) override;
+  void multiDrawIndexedIndirect(PrimitiveType primitiveType,
+                                IndexFormat indexFormat,
+                                IBuffer& indexBuffer,
+                                IBuffer& indirectBuffer,
+                                size_t indirectBufferOffset,
+                                uint32_t drawCount,
+                                uint32_t stride) override;
+  void multiDrawIndexedIndirectCount(PrimitiveType primitiveType,
+                                     IndexFormat indexFormat,
+                                     IBuffer& indexBuffer,
+                                     IBuffer& indirectBuffer,
+                                     size_t indirectBufferOffset,
+                                     IBuffer& countBuffer,
+                                     size_t countBufferOffset,
+                                     uint32_t maxDrawCount,
+                                     uint32_t stride) override;
+
+  void setStencilReferenceValue(uint32_t value) override;
+  void setStencilReferenceValues(uint32_t frontValue, uint32_t backValue) override;
+  void setBlendColor(Color color) override;
+  void setDepthBias(float depthBias, float slopeScale, float clamp) override;
+
+ private:
+  enum class Op : uint8_t {
+    BindViewport,
+    BindScissorRect,
+    BindRenderPipelineState,
+    BindDepthStencilState,
+    BindBuffer,
+    BindVertexBuffer,
+    BindBytes,
+    BindPushConstants,
+    BindSamplerState,
+    BindTexture,
+    BindUniform,
+    Draw,
+    DrawIndexed,
+    DrawIndexedIndirect,
+    MultiDrawIndirect,
+    MultiDrawIndexedIndirect,
+    MultiDrawIndexedIndirectCount,
+    SetStencilReferenceValue,
+    SetStencilReferenceValues,
+    SetBlendColor,
+    SetDepthBias,
+    PushDebugGroupLabel,
+    InsertDebugEventLabel,
+    PopDebugGroupLabel,
+  };
+
+  // Appends a POD record of type T to the tape, preceded by its Op tag, and returns a reference
+  // valid until the next append
+  template<typename T>
+  T& push(Op op);
+
+  // Copies `length` bytes into the arena and returns their offset, for payload-carrying records
+  uint32_t pushPayload(const void* data, size_t length);
+
+  uint32_t retain(std::shared_ptr<IRenderPipelineState> state);
+  uint32_t retain(std::shared_ptr<IDepthStencilState> state);
+  uint32_t retain(std::shared_ptr<IBuffer> buffer);
+  uint32_t retain(std::string label);
+  uint32_t retain(UniformDesc desc);
+
+  // The tape: Op tags interleaved with naturally-aligned POD records. Payload bytes live in
+  // their own arena so replay can walk the tape with a simple cursor
+  std::vector<uint8_t> tape_;
+  std::vector<uint8_t> payloads_;
+  size_t numCommands_ = 0;
+  bool encodingEnded_ = false;
+
+  // Side tables referenced from the tape by index. shared_ptr entries keep resources alive until
+  // reset(); strings and UniformDescs are not POD and therefore live outside the tape
+  std::vector<std::shared_ptr<IRenderPipelineState>> pipelineStates_;
+  std::vector<std::shared_ptr<IDepthStencilState>> depthStencilStates_;
+  std::vector<std::shared_ptr<IBuffer>> buffers_;
+  std::vector<std::string> labels_;
+  std::vector<UniformDesc> uniformDescs_;
+};
+
+} // namespace igl
@@ -5,7 +5,9 @@
  * LICENSE file in the root directory of this source tree.
  */
 
+#include <igl/Buffer.h>
 #include <igl/Device.h>
+#include <igl/PipelineUsageRecorder.h>
 #include <igl/Shader.h>
 
 #include <algorithm>
@@ -27,6 +29,71 @@ bool IDevice::defaultVerifyScope() {
 
 void IDevice::updateSurface(void* nativeWindowType) {}
 
+void IDevice::recordPipelineUsage(const RenderPipelineDesc& desc) const noexcept {
+  if (pipelineUsageRecorder_) {
+    pipelineUsageRecorder_->record(desc);
+  }
+}
+
+std::vector<std::unique_ptr<IBuffer>> IDevice::createBuffers(const BufferDesc* descs,
+                                                             size_t count,
+                                                             Result* IGL_NULLABLE
+                                                                 outResult) const noexcept {
+  std::vector<std::unique_ptr<IBuffer>> buffers;
+  buffers.reserve(count);
+  Result batchResult;
+  for (size_t i = 0; i < count; i++) {
+    Result result;
+    buffers.push_back(createBuffer(descs[i], &result));
+    if (!result.isOk() && batchResult.isOk()) {
+      batchResult = std::move(result);
+    }
+  }
+  Result::setResult(outResult, std::move(batchResult));
+  return buffers;
+}
+
+std::vector<std::shared_ptr<ITexture>> IDevice::createTextures(const TextureDesc* descs,
+                                                               size_t count,
+                                                               Result* IGL_NULLABLE
+                                                                   outResult) const noexcept {
+  std::vector<std::shared_ptr<ITexture>> textures;
+  textures.reserve(count);
+  Result batchResult;
+  for (size_t i = 0; i < count; i++) {
+    Result result;
+    textures.push_back(createTexture(descs[i], &result));
+    if (!result.isOk() && batchResult.isOk()) {
+      batchResult = std::move(result);
+    }
+  }
+  Result::setResult(outResult, std::move(batchResult));
+  return textures;
+}
+
+Holder<BindGroupHandle> IDevice::createBindGroup(const BindGroupDesc& desc,
+                                                 Result* IGL_NULLABLE outResult) {
+  auto group = std::make_unique<BindGroupDesc>(desc);
+  std::lock_guard<std::mutex> guard(bindGroupsMutex_);
+  auto handle = bindGroupsPool_.create(std::move(group));
+  Result::setOk(outResult);
+  return {this, handle};
+}
+
+void IDevice::destroy(BindGroupHandle handle) {
+  if (!handle) {
+    return;
+  }
+  std::lock_guard<std::mutex> guard(bindGroupsMutex_);
+  bindGroupsPool_.destroy(handle);
+}
+
+const BindGroupDesc* IGL_NULLABLE IDevice::getBindGroupDesc(BindGroupHandle handle) const {
+  std::lock_guard<std::mutex> guard(bindGroupsMutex_);
+  const auto* group = bindGroupsPool_.get(handle);
+  return group != nullptr ? group->get() : nullptr;
+}
+
 TextureDesc IDevice::sanitize(const TextureDesc& desc) const {
   TextureDesc sanitized = desc;
   if (desc.width == 0 || desc.height == 0 || desc.depth == 0 || desc.numLayers == 0 ||
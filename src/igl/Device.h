@@ -7,11 +7,13 @@
 
 #pragma once
 
+#include <igl/CommandEncoder.h>
 #include <igl/Common.h>
 #include <igl/DeviceFeatures.h>
 #include <igl/IResourceTracker.h>
 #include <igl/PlatformDevice.h>
 #include <igl/Texture.h>
+#include <mutex>
 #include <utility>
 #include <vector>
 
@@ -33,6 +35,9 @@ struct VertexInputStateDesc;
 class IBuffer;
 class ICommandQueue;
 class ICommandBuffer;
+class IQueryPool;
+class IQueueEvent;
+struct QueryPoolDesc;
 class IComputePipelineState;
 class IDepthStencilState;
 class IDevice;
@@ -44,6 +49,44 @@ class IShaderModule;
 class IShaderStages;
 class ITexture;
 class IVertexInputState;
+class PipelineUsageRecorder;
+class TextureSampleFeedback;
+
+/**
+ * @brief Snapshot of GPU memory consumption, filled in by IDevice::getMemoryStatistics().
+ *
+ * Per-heap numbers come from the OS/driver where a backend can query them (VK_EXT_memory_budget on
+ * Vulkan, MTLDevice.currentAllocatedSize on Metal) and are best-effort estimates otherwise. The
+ * per-category totals count memory allocated by IGL itself and do not include driver-internal
+ * allocations. All queries are cheap enough to poll every frame, e.g. to drive resource eviction
+ * before the OS starts killing the process.
+ */
+struct DeviceMemoryStatistics {
+  struct Heap {
+    /** @brief Estimated number of bytes the process may use from this heap before allocations
+     * start failing or the OS intervenes. 0 when the backend cannot query a budget. */
+    uint64_t budgetBytes = 0;
+    /** @brief Number of bytes currently allocated from this heap by the whole process. */
+    uint64_t usageBytes = 0;
+    /** @brief True when the heap is device-local (VRAM on discrete GPUs). */
+    bool isDeviceLocal = false;
+  };
+  /** @brief Maximum number of reported heaps (matches VK_MAX_MEMORY_HEAPS). */
+  static constexpr uint32_t kMaxHeaps = 16u;
+  uint32_t heapCount = 0;
+  Heap heaps[kMaxHeaps];
+  /** @brief Total bytes allocated by IGL for buffers. */
+  uint64_t bufferBytes = 0;
+  /** @brief Total bytes allocated by IGL for textures. */
+  uint64_t textureBytes = 0;
+  /** @brief Bytes of attachment-capable textures whose framebuffer compression (e.g. delta color
+   * compression on AMD GPUs) the driver reported as disabled. Such render targets cost full
+   * bandwidth on every pass; a non-zero value usually means a texture carries a usage flag (most
+   * often speculative storage usage) that forced the driver to decompress it. Only filled in by
+   * backends that can query compression state (Vulkan with
+   * VulkanContextConfig::enableImageCompressionControl); 0 otherwise. */
+  uint64_t uncompressedAttachmentBytes = 0;
+};
 
 /**
  * @brief InDevelopmentFeature is where you'd add in your own enum for testing out
@@ -69,29 +112,65 @@ enum class InDevelopementFeatures : uint8_t {
 
 /**
  * @brief Interface to a GPU that is used to draw graphics or do parallel computation.
+ *
+ * Thread safety: the create* methods for resources (buffers, textures, sampler states and
+ * pipeline/shader objects) may be called concurrently from multiple threads, e.g. asset loader
+ * threads creating textures while the render thread keeps drawing. Everything else - creating and
+ * submitting command buffers, presenting, and encoding - must be externally synchronized and is
+ * typically confined to one render thread. Backends that cannot provide concurrent creation (the
+ * OpenGL backend is bound to a single context/thread) keep their stricter rules; see the backend
+ * device classes.
  */
 class IDevice : public ICapabilities {
  public:
   ~IDevice() override = default;
 
+  /**
+   * @brief Creates a bind group from the given set of resources and returns a trivially copyable
+   * handle for it. The default implementation stores the resources in a generation-checked slot
+   * table owned by the device; the handle keeps them alive until destroy() is called. Handles are
+   * the hot-path alternative to per-draw shared_ptr binds: copying one is two integers and
+   * resolving it never touches a refcount.
+   * @see igl::IRenderCommandEncoder::bindBindGroup
+   */
   virtual Holder<igl::BindGroupHandle> createBindGroup(const BindGroupDesc& desc,
-                                                       Result* IGL_NULLABLE outResult) {
-    (void)desc;
+                                                       Result* IGL_NULLABLE outResult);
 
-    IGL_ASSERT_NOT_IMPLEMENTED();
+  virtual void destroy(igl::BindGroupHandle handle);
 
-    Result::setResult(outResult,
-                      Result(Result::Code::Unimplemented, "Bind groups are not implemented (yet)"));
+  /**
+   * @brief Resolves a bind-group handle to its stored resources. Returns nullptr for empty
+   * handles; stale handles (the group was destroyed) assert in debug builds. The returned
+   * pointer stays valid until the group is destroyed.
+   */
+  const BindGroupDesc* IGL_NULLABLE getBindGroupDesc(BindGroupHandle handle) const;
 
-    return {};
+  /**
+   * @brief Creates a cross-queue synchronization event so work on separate command queues (e.g.
+   * async compute alongside graphics) can overlap and synchronize on the GPU. Backends without
+   * queue-event support return nullptr and set the Result accordingly; Metal implements this
+   * with MTLEvent.
+   * @see igl::ICommandBuffer::signalEvent, igl::ICommandBuffer::waitEvent
+   */
+  virtual std::shared_ptr<IQueueEvent> createQueueEvent(Result* IGL_NULLABLE outResult) {
+    Result::setResult(
+        outResult,
+        Result(Result::Code::Unimplemented, "Queue events are not implemented (yet)"));
+    return nullptr;
   }
 
-  virtual void destroy(igl::BindGroupHandle handle) {
-    if (!handle) {
-      return;
-    }
-
-    IGL_ASSERT_NOT_IMPLEMENTED();
+  /**
+   * @brief Creates a pool of GPU queries (occlusion, optionally pipeline statistics) with
+   * non-blocking result retrieval. Backends without support for the requested type return
+   * nullptr and set the Result accordingly.
+   * @see igl::IQueryPool
+   */
+  virtual std::shared_ptr<IQueryPool> createQueryPool(const QueryPoolDesc& desc,
+                                                      Result* IGL_NULLABLE outResult) {
+    (void)desc;
+    Result::setResult(
+        outResult, Result(Result::Code::Unimplemented, "Query pools are not implemented (yet)"));
+    return nullptr;
   }
 
   /**
@@ -116,6 +195,23 @@ class IDevice : public ICapabilities {
   virtual std::unique_ptr<IBuffer> createBuffer(const BufferDesc& desc,
                                                 Result* IGL_NULLABLE outResult) const noexcept = 0;
 
+  /**
+   * @brief Creates one buffer per entry of `descs`, in order. Element i of the returned vector
+   * corresponds to descs[i] and is nullptr when that buffer could not be created; `outResult`
+   * receives the first failure, or Ok when every buffer was created. The default implementation
+   * simply loops over createBuffer(); backends can override it to amortize per-call work
+   * (locking, allocation, initial-data uploads) across the whole batch.
+   * @param descs Pointer to `count` buffer descriptions.
+   * @param count Number of buffers to create.
+   * @param outResult Pointer to where the result (success, failure, etc) is written. Can be null
+   * if no reporting is desired.
+   * @return Vector of `count` buffers, aligned with `descs`.
+   */
+  virtual std::vector<std::unique_ptr<IBuffer>> createBuffers(
+      const BufferDesc* IGL_NONNULL descs,
+      size_t count,
+      Result* IGL_NULLABLE outResult) const noexcept;
+
   /**
    * @brief Creates a depth stencil state.
    * @see igl::DepthStencilStateDesc
@@ -152,6 +248,24 @@ class IDevice : public ICapabilities {
                                                   Result* IGL_NULLABLE
                                                       outResult) const noexcept = 0;
 
+  /**
+   * @brief Creates one texture per entry of `descs`, in order. Element i of the returned vector
+   * corresponds to descs[i] and is nullptr when that texture could not be created; `outResult`
+   * receives the first failure, or Ok when every texture was created. The default implementation
+   * simply loops over createTexture(); backends can override it to amortize per-call work
+   * (locking, memory allocation, initial layout transitions) across the whole batch, which
+   * matters when a scene load creates hundreds of textures at once.
+   * @param descs Pointer to `count` texture descriptions.
+   * @param count Number of textures to create.
+   * @param outResult Pointer to where the result (success, failure, etc) is written. Can be null
+   * if no reporting is desired.
+   * @return Vector of `count` textures, aligned with `descs`.
+   */
+  virtual std::vector<std::shared_ptr<ITexture>> createTextures(
+      const TextureDesc* IGL_NONNULL descs,
+      size_t count,
+      Result* IGL_NULLABLE outResult) const noexcept;
+
   /**
    * @brief Creates a vertex input state.
    * @see igl::VertexInputStateDesc
@@ -282,6 +396,18 @@ class IDevice : public ICapabilities {
    */
   virtual size_t getCurrentDrawCount() const = 0;
 
+  /**
+   * @brief Fills `outStatistics` with the current GPU memory consumption.
+   * @see igl::DeviceMemoryStatistics
+   * @param outStatistics Structure receiving per-heap budgets/usage and per-category totals.
+   * @return True when the backend could provide at least heap usage; false when no information is
+   * available (the structure is left untouched in that case).
+   */
+  virtual bool getMemoryStatistics(DeviceMemoryStatistics& outStatistics) const {
+    (void)outStatistics;
+    return false;
+  }
+
   /**
    * @brief Creates a shader library with one or more shader modules.
    * @see igl::ShaderCompileDesc
@@ -331,6 +457,45 @@ class IDevice : public ICapabilities {
     return resourceTracker_;
   }
 
+  /**
+   * @brief Installs a pipeline usage recorder on this device. Every render pipeline created
+   * afterwards reports its descriptor hash to the recorder, in first-use order.
+   * @see igl::PipelineUsageRecorder, igl::warmUpPipelines
+   * @param recorder Shared pointer to the recorder; pass nullptr to stop recording.
+   */
+  void setPipelineUsageRecorder(std::shared_ptr<PipelineUsageRecorder> recorder) noexcept {
+    pipelineUsageRecorder_ = std::move(recorder);
+  }
+
+  /**
+   * @brief Returns the pipeline usage recorder installed on this device, if any.
+   * @see igl::PipelineUsageRecorder
+   * @return Shared pointer to the recorder.
+   */
+  std::shared_ptr<PipelineUsageRecorder> getPipelineUsageRecorder() const noexcept {
+    return pipelineUsageRecorder_;
+  }
+
+  /**
+   * @brief Installs a texture sample feedback recorder on this device. Backends that support
+   * feedback report texture binds to it while encoding; pass nullptr to stop recording.
+   * Virtual so backends can forward the recorder to their encoding paths.
+   * @see igl::TextureSampleFeedback
+   * @param feedback Shared pointer to the recorder.
+   */
+  virtual void setTextureSampleFeedback(std::shared_ptr<TextureSampleFeedback> feedback) noexcept {
+    textureSampleFeedback_ = std::move(feedback);
+  }
+
+  /**
+   * @brief Returns the texture sample feedback recorder installed on this device, if any.
+   * @see igl::TextureSampleFeedback
+   * @return Shared pointer to the recorder.
+   */
+  std::shared_ptr<TextureSampleFeedback> getTextureSampleFeedback() const noexcept {
+    return textureSampleFeedback_;
+  }
+
   /**
    * @brief Returns a backend-specific color for debugging purposes
    *  - OpenGL: Yellow
@@ -378,6 +543,13 @@ class IDevice : public ICapabilities {
   virtual void beginScope();
   virtual void endScope();
   TextureDesc sanitize(const TextureDesc& desc) const;
+
+  /**
+   * @brief Reports a render pipeline descriptor to the installed usage recorder, if any.
+   * Backends call this from createRenderPipeline() before creating the pipeline.
+   */
+  void recordPipelineUsage(const RenderPipelineDesc& desc) const noexcept;
+
   IDevice() = default;
 
   uint64_t inDevelopmentFlags_ = 0;
@@ -387,6 +559,13 @@ class IDevice : public ICapabilities {
 
   int scopeDepth_ = 0;
   std::shared_ptr<IResourceTracker> resourceTracker_;
+  std::shared_ptr<PipelineUsageRecorder> pipelineUsageRecorder_;
+  std::shared_ptr<TextureSampleFeedback> textureSampleFeedback_;
+
+  // Bind groups are stored behind unique_ptr so resolved descriptors keep a stable address while
+  // other groups are created or destroyed concurrently
+  mutable std::mutex bindGroupsMutex_;
+  Pool<BindGroup, std::unique_ptr<BindGroupDesc>> bindGroupsPool_;
 
   friend struct DeviceScope;
 };
@@ -28,6 +28,7 @@ namespace igl {
  * DepthCompare               Supports setting depth compare function
  * DepthShaderRead            Supports reading depth texture from a shader
  * DrawIndexedIndirect        Supports IRenderCommandEncoder::drawIndexedIndirect
+ * DrawIndirectCount          Supports a GPU-written draw count in IRenderCommandEncoder::multiDrawIndexedIndirectCount
  * ExplicitBinding,           Supports uniforms block explicit binding in shaders
  * ExplicitBindingExt,        Supports uniforms block explicit binding in shaders via an extension
  * ExternalMemoryObjects,     Supports accessing external memory objects, including by POSIX file descriptor
@@ -59,6 +60,7 @@ namespace igl {
  * TextureHalfFloat           Supports half float texture format
  * TextureNotPot              Supports non power-of-two textures
  * TexturePartialMipChain     Supports mip chains that do not go all the way to 1x1
+ * TextureViews               Supports zero-copy reinterpreted views via ITexture::createView
  * UniformBlocks,             Supports uniform blocks
  * ValidationLayersEnabled,   Validation layers are enabled
  */
@@ -72,6 +74,7 @@ enum class DeviceFeatures {
   DepthCompare,
   DepthShaderRead,
   DrawIndexedIndirect,
+  DrawIndirectCount,
   ExplicitBinding,
   ExplicitBindingExt,
   ExternalMemoryObjects,
@@ -104,6 +107,7 @@ enum class DeviceFeatures {
   TextureHalfFloat,
   TextureNotPot,
   TexturePartialMipChain,
+  TextureViews,
   UniformBlocks,
   ValidationLayersEnabled,
 };
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <igl/DrawBatcher.h>
+
+#include <algorithm>
+#include <tuple>
+#include <unordered_map>
+
+namespace igl {
+namespace {
+
+uintptr_t firstVertexBufferKey(const DrawBatcher::BindSet& bindSet) {
+  return bindSet.vertexBuffers.empty()
+             ? 0
+             : reinterpret_cast<uintptr_t>(bindSet.vertexBuffers.front().buffer.get());
+}
+
+// Keys texture/sampler slots for elision; target bits fit in the low byte
+uint32_t slotKey(size_t index, uint8_t target) {
+  return (static_cast<uint32_t>(index) << 8) | target;
+}
+
+} // namespace
+
+void DrawBatcher::addDraw(std::shared_ptr<IRenderPipelineState> pipelineState,
+                          BindSet bindSet,
+                          Draw draw) {
+  IGL_ASSERT(pipelineState != nullptr);
+  entries_.push_back({std::move(pipelineState), std::move(bindSet), draw});
+}
+
+void DrawBatcher::flush(IRenderCommandEncoder& encoder) {
+  // Most expensive state first: draws sharing a pipeline become adjacent, then draws sharing
+  // depth-stencil state, then draws sharing their first vertex buffer. Stable so equal-state
+  // draws replay in submission order.
+  std::stable_sort(entries_.begin(), entries_.end(), [](const Entry& a, const Entry& b) {
+    return std::make_tuple(reinterpret_cast<uintptr_t>(a.pipelineState.get()),
+                           reinterpret_cast<uintptr_t>(a.bindSet.depthStencilState.get()),
+                           firstVertexBufferKey(a.bindSet)) <
+           std::make_tuple(reinterpret_cast<uintptr_t>(b.pipelineState.get()),
+                           reinterpret_cast<uintptr_t>(b.bindSet.depthStencilState.get()),
+                           firstVertexBufferKey(b.bindSet));
+  });
+
+  const IRenderPipelineState* lastPipeline = nullptr;
+  const IDepthStencilState* lastDepthStencil = nullptr;
+  struct BufferState {
+    const IBuffer* buffer = nullptr;
+    size_t offset = 0;
+  };
+  std::unordered_map<uint32_t, BufferState> lastVertexBuffers;
+  std::unordered_map<uint32_t, BufferState> lastBuffers;
+  std::unordered_map<uint32_t, const ITexture*> lastTextures;
+  std::unordered_map<uint32_t, const ISamplerState*> lastSamplers;
+
+  for (const auto& entry : entries_) {
+    if (entry.pipelineState.get() != lastPipeline) {
+      encoder.bindRenderPipelineState(entry.pipelineState);
+      lastPipeline = entry.pipelineState.get();
+    }
+    if (entry.bindSet.depthStencilState != nullptr &&
+        entry.bindSet.depthStencilState.get() != lastDepthStencil) {
+      encoder.bindDepthStencilState(entry.bindSet.depthStencilState);
+      lastDepthStencil = entry.bindSet.depthStencilState.get();
+    }
+    for (const auto& binding : entry.bindSet.vertexBuffers) {
+      auto& state = lastVertexBuffers[binding.index];
+      if (state.buffer != binding.buffer.get() || state.offset != binding.offset) {
+        encoder.bindVertexBuffer(binding.index, binding.buffer, binding.offset);
+        state = {binding.buffer.get(), binding.offset};
+      }
+    }
+    for (const auto& binding : entry.bindSet.buffers) {
+      auto& state = lastBuffers[slotKey(static_cast<size_t>(binding.index), binding.target)];
+      if (state.buffer != binding.buffer.get() || state.offset != binding.offset) {
+        encoder.bindBuffer(binding.index, binding.target, binding.buffer, binding.offset);
+        state = {binding.buffer.get(), binding.offset};
+      }
+    }
+    for (const auto& binding : entry.bindSet.textures) {
+      auto& bound = lastTextures[slotKey(binding.index, binding.target)];
+      if (bound != binding.texture) {
+        encoder.bindTexture(binding.index, binding.target, binding.texture);
+        bound = binding.texture;
+      }
+    }
+    for (const auto& binding : entry.bindSet.samplers) {
+      auto& bound = lastSamplers[slotKey(binding.index, binding.target)];
+      if (bound != binding.samplerState) {
+        encoder.bindSamplerState(binding.index, binding.target, binding.samplerState);
+        bound = binding.samplerState;
+      }
+    }
+
+    const auto& draw = entry.draw;
+    if (draw.indexBuffer != nullptr) {
+      encoder.drawIndexed(draw.primitiveType,
+                          draw.vertexCount,
+                          draw.indexFormat,
+                          *draw.indexBuffer,
+                          draw.indexBufferOffset,
+                          draw.instanceCount,
+                          draw.baseVertex,
+                          draw.baseInstance);
+    } else {
+      encoder.draw(draw.primitiveType,
+                   draw.vertexStart,
+                   draw.vertexCount,
+                   draw.instanceCount,
+                   draw.baseInstance);
+    }
+  }
+
+  entries_.clear();
+}
+
+} // namespace igl
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <igl/Common.h>
+#include <igl/RenderCommandEncoder.h>
+#include <vector>
+
+namespace igl {
+
+/**
+ * @brief Optional batching layer that records (pipeline, bind set, draw) tuples, sorts them to
+ * minimize state changes and replays them through an IRenderCommandEncoder.
+ *
+ * Draws are ordered by descending state-change cost — pipeline first, then depth-stencil state
+ * and resource binds, then vertex buffers — and redundant binds are elided during replay, so
+ * consecutive draws sharing state pay for it once. Sorting is stable: draws with identical state
+ * keep their submission order. Only order-independent passes (e.g. opaque geometry with depth
+ * testing) should go through the batcher; transparent geometry must keep its own ordering.
+ */
+class DrawBatcher {
+ public:
+  /// One vertex buffer bound via bindVertexBuffer.
+  struct VertexBufferBinding {
+    uint32_t index = 0;
+    std::shared_ptr<IBuffer> buffer;
+    size_t offset = 0;
+  };
+
+  /// One buffer bound via bindBuffer (uniform/storage data).
+  struct BufferBinding {
+    int index = 0;
+    uint8_t target = BindTarget::kAllGraphics;
+    std::shared_ptr<IBuffer> buffer;
+    size_t offset = 0;
+  };
+
+  /// One texture bound via bindTexture. The texture must stay alive until flush().
+  struct TextureBinding {
+    size_t index = 0;
+    uint8_t target = BindTarget::kFragment;
+    ITexture* texture = nullptr;
+  };
+
+  /// One sampler state bound via bindSamplerState. The sampler must stay alive until flush().
+  struct SamplerBinding {
+    size_t index = 0;
+    uint8_t target = BindTarget::kFragment;
+    ISamplerState* samplerState = nullptr;
+  };
+
+  /// Everything a recorded draw binds besides its pipeline. Empty slots are left untouched on
+  /// replay, so state bound on the encoder before flush() remains in effect for them.
+  struct BindSet {
+    std::shared_ptr<IDepthStencilState> depthStencilState;
+    std::vector<VertexBufferBinding> vertexBuffers;
+    std::vector<BufferBinding> buffers;
+    std::vector<TextureBinding> textures;
+    std::vector<SamplerBinding> samplers;
+  };
+
+  /// The draw call itself; indexed when indexBuffer is non-null. The index buffer must stay
+  /// alive until flush().
+  struct Draw {
+    PrimitiveType primitiveType = PrimitiveType::Triangle;
+    size_t vertexStart = 0;
+    /// Number of vertices for non-indexed draws, number of indices for indexed ones
+    size_t vertexCount = 0;
+    IBuffer* indexBuffer = nullptr;
+    IndexFormat indexFormat = IndexFormat::UInt16;
+    size_t indexBufferOffset = 0;
+    uint32_t instanceCount = 1;
+    int32_t baseVertex = 0;
+    uint32_t baseInstance = 0;
+  };
+
+  /// Records one draw. Nothing is encoded until flush().
+  void addDraw(std::shared_ptr<IRenderPipelineState> pipelineState, BindSet bindSet, Draw draw);
+
+  /// Sorts the recorded draws by state-change cost, encodes them with redundant binds elided and
+  /// clears the batch. The encoder's current bindings are unknown to the batcher, so the first
+  /// draw binds everything it uses.
+  void flush(IRenderCommandEncoder& encoder);
+
+  size_t size() const noexcept {
+    return entries_.size();
+  }
+
+  bool empty() const noexcept {
+    return entries_.empty();
+  }
+
+  void clear() {
+    entries_.clear();
+  }
+
+ private:
+  struct Entry {
+    std::shared_ptr<IRenderPipelineState> pipelineState;
+    BindSet bindSet;
+    Draw draw;
+  };
+
+  std::vector<Entry> entries_;
+};
+
+} // namespace igl
@@ -7,15 +7,34 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <igl/Common.h>
 
 namespace igl {
 
 /// @brief Based on
 /// https://github.com/PacktPublishing/3D-Graphics-Rendering-Cookbook/blob/master/shared/UtilsFPS.h.
-/// Convenience class to measure and print frames per second (FPS) to the console.
+/// Convenience class to measure frame statistics and print frames per second (FPS) to the
+/// console. Besides the smoothed average, recent frame times are kept in a ring buffer so
+/// percentiles and hitches — which an average hides — can be reported via getSnapshot().
 class FPSCounter {
  public:
+  /// @brief Frame statistics suitable for periodic telemetry upload. Percentiles cover the last
+  /// kFrameHistorySize frames; counters are cumulative since construction, so uploaders can diff
+  /// consecutive snapshots.
+  struct Snapshot {
+    float avgFPS = 0;
+    /// Median frame time over the recent history window, in milliseconds
+    float p50FrameTimeMs = 0;
+    float p95FrameTimeMs = 0;
+    float p99FrameTimeMs = 0;
+    /// Total frames whose time exceeded the hitch threshold
+    uint64_t hitchCount = 0;
+    /// Total frames recorded
+    uint64_t frameCount = 0;
+  };
+
   /// @brief Constructs an instance of the class
   /// @param printToConsole whether to print the FPS count to the console
   /// @param avgIntervalInSeconds how often to update the FPS counter and print the information to
@@ -29,6 +48,17 @@ class FPSCounter {
     return avgFPS_;
   }
 
+  /// @brief Frame times above this threshold count as hitches. The default of 50ms corresponds
+  /// to missing three 60Hz vsync intervals.
+  void setHitchThresholdMs(float thresholdMs) noexcept {
+    IGL_ASSERT(thresholdMs > 0);
+    hitchThresholdMs_ = thresholdMs;
+  }
+
+  uint64_t getHitchCount() const noexcept {
+    return hitchCount_;
+  }
+
   /// @brief Updates the frame count and computes the FPS  if the time passed in as a parameter is
   /// greater than the threshold set at construciton time. This function should be called when a
   /// frame has finished being submited for processing by the GPU along with the delta time between
@@ -39,6 +69,15 @@ class FPSCounter {
     frames_++;
     time_ += seconds;
 
+    const float ms = float(seconds * 1000.0);
+    frameTimesMs_[historyNext_] = ms;
+    historyNext_ = (historyNext_ + 1) % kFrameHistorySize;
+    historyCount_ = std::min(historyCount_ + 1, kFrameHistorySize);
+    totalFrames_++;
+    if (ms > hitchThresholdMs_) {
+      hitchCount_++;
+    }
+
     if (time_ >= avgIntervalInSeconds_) {
       avgFPS_ = float(frames_ / time_);
 
@@ -51,7 +90,34 @@ class FPSCounter {
     }
   }
 
+  /// @brief Returns current frame statistics. Percentiles are computed on demand from the ring
+  /// buffer with partial sorts, so calling this every few seconds for telemetry is cheap and
+  /// nothing extra is paid per frame.
+  Snapshot getSnapshot() const {
+    Snapshot snapshot;
+    snapshot.avgFPS = avgFPS_;
+    snapshot.hitchCount = hitchCount_;
+    snapshot.frameCount = totalFrames_;
+
+    if (historyCount_ > 0) {
+      std::array<float, kFrameHistorySize> sorted; // NOLINT(cppcoreguidelines-pro-type-member-init)
+      std::copy(frameTimesMs_.begin(), frameTimesMs_.begin() + historyCount_, sorted.begin());
+      snapshot.p50FrameTimeMs = percentile(sorted, 0.50f);
+      snapshot.p95FrameTimeMs = percentile(sorted, 0.95f);
+      snapshot.p99FrameTimeMs = percentile(sorted, 0.99f);
+    }
+    return snapshot;
+  }
+
  private:
+  static constexpr size_t kFrameHistorySize = 512;
+
+  float percentile(std::array<float, kFrameHistorySize>& sorted, float p) const {
+    const size_t index = std::min(size_t(p * float(historyCount_)), historyCount_ - 1);
+    std::nth_element(sorted.begin(), sorted.begin() + index, sorted.begin() + historyCount_);
+    return sorted[index];
+  }
+
   bool printToConsole_ = true;
 
   uint32_t frames_ = 0;
@@ -59,6 +125,13 @@ class FPSCounter {
 
   const float avgIntervalInSeconds_ = 1.0f;
   float avgFPS_ = 72.0f; // randomly picked high-ish initial value
+
+  std::array<float, kFrameHistorySize> frameTimesMs_{};
+  size_t historyCount_ = 0;
+  size_t historyNext_ = 0;
+  float hitchThresholdMs_ = 50.0f;
+  uint64_t hitchCount_ = 0;
+  uint64_t totalFrames_ = 0;
 };
 
 } // namespace igl
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <igl/Assert.h>
+
+namespace igl {
+
+/**
+ * @brief Fixed-capacity vector whose elements are stored inline in the object itself.
+ *
+ * Hot descriptor types (e.g. RenderPipelineDesc) use this in place of std::vector so that
+ * copying, comparing and hashing a descriptor never allocates and walks contiguous memory.
+ * Only the subset of the std::vector interface the descriptor code needs is provided, and
+ * resizing beyond Capacity asserts and clamps instead of growing.
+ */
+template<typename T, size_t Capacity>
+class InlineVector {
+ public:
+  using value_type = T;
+  using iterator = T*;
+  using const_iterator = const T*;
+
+  InlineVector() = default;
+
+  size_t size() const noexcept {
+    return size_;
+  }
+
+  constexpr size_t capacity() const noexcept {
+    return Capacity;
+  }
+
+  bool empty() const noexcept {
+    return size_ == 0;
+  }
+
+  void clear() noexcept {
+    size_ = 0;
+  }
+
+  /// Matches std::vector::resize: elements added by growing are value-initialized. newSize must
+  /// not exceed Capacity; in release builds an oversized request is clamped.
+  void resize(size_t newSize) {
+    IGL_ASSERT_MSG(newSize <= Capacity, "InlineVector resized beyond its capacity");
+    if (newSize > Capacity) {
+      newSize = Capacity;
+    }
+    for (size_t i = size_; i < newSize; ++i) {
+      data_[i] = T{};
+    }
+    size_ = newSize;
+  }
+
+  void push_back(const T& value) {
+    IGL_ASSERT_MSG(size_ < Capacity, "InlineVector grown beyond its capacity");
+    if (size_ < Capacity) {
+      data_[size_++] = value;
+    }
+  }
+
+  T& operator[](size_t index) {
+    IGL_ASSERT(index < size_);
+    return data_[index];
+  }
+
+  const T& operator[](size_t index) const {
+    IGL_ASSERT(index < size_);
+    return data_[index];
+  }
+
+  T& back() {
+    IGL_ASSERT(size_ > 0);
+    return data_[size_ - 1];
+  }
+
+  const T& back() const {
+    IGL_ASSERT(size_ > 0);
+    return data_[size_ - 1];
+  }
+
+  T* data() noexcept {
+    return data_;
+  }
+
+  const T* data() const noexcept {
+    return data_;
+  }
+
+  iterator begin() noexcept {
+    return data_;
+  }
+
+  const_iterator begin() const noexcept {
+    return data_;
+  }
+
+  iterator end() noexcept {
+    return data_ + size_;
+  }
+
+  const_iterator end() const noexcept {
+    return data_ + size_;
+  }
+
+  bool operator==(const InlineVector& other) const {
+    if (size_ != other.size_) {
+      return false;
+    }
+    for (size_t i = 0; i < size_; ++i) {
+      if (!(data_[i] == other.data_[i])) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool operator!=(const InlineVector& other) const {
+    return !(*this == other);
+  }
+
+ private:
+  T data_[Capacity]{};
+  size_t size_ = 0;
+};
+
+} // namespace igl
@@ -364,7 +364,13 @@
 #undef IGL_WITH_TRACY_GPU
 #endif
 
-#if defined(IGL_WITH_TRACY) && defined(__cplusplus)
+// A custom telemetry backend can plug into IGL's instrumentation points by defining
+// IGL_PROFILER_CUSTOM_HEADER to a header (in quotes) that provides the full IGL_PROFILER_* macro
+// set below, including the GPU zone macros and IGL_PROFILER_COUNTER. The Tracy integration is
+// then skipped and every zone and counter in IGL forwards to the custom macros instead.
+#if defined(IGL_PROFILER_CUSTOM_HEADER) && defined(__cplusplus)
+#include IGL_PROFILER_CUSTOM_HEADER
+#elif defined(IGL_WITH_TRACY) && defined(__cplusplus)
 #include "tracy/Tracy.hpp"
 // predefined 0xRGB colors for "heavy" point-of-interest operations
 #define IGL_PROFILER_COLOR_WAIT 0xff0000
@@ -416,6 +422,9 @@
 #define IGL_PROFILER_ZONE_END() }
 #define IGL_PROFILER_THREAD(name) tracy::SetThreadName(name)
 #define IGL_PROFILER_FRAME(name) FrameMarkNamed(name)
+// plots a numeric value (bytes staged, draw calls, ...) under `name`, which must be a string
+// literal or otherwise outlive the program
+#define IGL_PROFILER_COUNTER(name, value) TracyPlot(name, value)
 
 #else
 #define IGL_PROFILER_ZONE_GPU_OGL(name)
@@ -434,6 +443,7 @@
 #define IGL_PROFILER_ZONE_END() }
 #define IGL_PROFILER_THREAD(name)
 #define IGL_PROFILER_FRAME(name)
+#define IGL_PROFILER_COUNTER(name, value)
 #endif // IGL_WITH_TRACY
 
 #if !defined(IGL_ENUM_TO_STRING)
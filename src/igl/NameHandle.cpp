@@ -8,6 +8,8 @@
 #include <igl/Macros.h>
 #include <igl/NameHandle.h>
 
+#include <array>
+#include <atomic>
 #include <functional>
 #include <string>
 
@@ -92,21 +94,84 @@ uint32_t igl::iglCrc32(const char* data, size_t /*length*/) {
 
 #endif
 
-#if IGL_DEBUG
 namespace igl {
+namespace {
+
+// Append-only interned-name registry. Buckets are heads of CAS-linked chains, entries are never
+// removed and their links never change after publication, so both lookup and insertion are
+// lock-free and a handle's string reference stays valid for the lifetime of the process.
+struct NameEntry {
+  NameEntry(const char* name, size_t length, uint32_t crc32) : name(name, length), crc32(crc32) {}
+
+  const std::string name;
+  const uint32_t crc32;
+  NameEntry* next = nullptr;
+};
+
+constexpr size_t kNameRegistryBuckets = 1024; // power of two
+
+bool matches(const NameEntry& entry, const char* name, size_t length, uint32_t crc32) {
+  return entry.crc32 == crc32 && entry.name.size() == length &&
+         entry.name.compare(0, length, name, length) == 0;
+}
+
+std::atomic<NameEntry*>& bucketFor(uint32_t crc32) {
+  static std::array<std::atomic<NameEntry*>, kNameRegistryBuckets> buckets{};
+  return buckets[crc32 & (kNameRegistryBuckets - 1)];
+}
+
+} // namespace
+
+const std::string& NameHandle::emptyName() {
+  static const std::string empty;
+  return empty;
+}
+
+const std::string& NameHandle::internedName(const char* name, size_t length, uint32_t crc32) {
+  if (length == 0) {
+    return emptyName();
+  }
+
+  auto& bucket = bucketFor(crc32);
+  NameEntry* head = bucket.load(std::memory_order_acquire);
+  for (NameEntry* entry = head; entry != nullptr; entry = entry->next) {
+    if (matches(*entry, name, length, crc32)) {
+      return entry->name;
+    }
+  }
+
+  auto* newEntry = new NameEntry(name, length, crc32);
+  newEntry->next = head;
+  while (!bucket.compare_exchange_weak(
+      newEntry->next, newEntry, std::memory_order_release, std::memory_order_acquire)) {
+    // Another thread published first; check only the entries it prepended for a duplicate
+    for (NameEntry* entry = newEntry->next; entry != head; entry = entry->next) {
+      if (matches(*entry, name, length, crc32)) {
+        delete newEntry;
+        return entry->name;
+      }
+    }
+    head = newEntry->next;
+  }
+  return newEntry->name;
+}
+
+#if IGL_DEBUG
 bool NameHandle::checkIsValidCrcCompare(const NameHandle& nh) const {
+  // Interning guarantees equal names share storage, so differing pointers with equal CRCs mean a
+  // genuine collision
   bool res = nh.crc32_ == crc32_ && nh.name_ != name_;
   IGL_ASSERT_MSG(!res,
                  "NameHandle CRC check fails: name1 (%s %x) name2 (%s %x)\n",
-                 name_.c_str(),
+                 name_->c_str(),
                  crc32_,
-                 nh.name_.c_str(),
+                 nh.name_->c_str(),
                  nh.crc32_);
 
   return res;
 }
-} // namespace igl
 #endif // IGL_DEBUG
+} // namespace igl
 
 size_t std::hash<std::vector<igl::NameHandle>>::operator()(
     std::vector<igl::NameHandle> const& key) const {
@@ -90,6 +90,11 @@ uint32_t iglCrc32(const char* data, size_t length);
  * @brief Creates a mapping between a string and its equivalent CRC32 handle
  * This way when we need to check if a uniform exists or if it matches another
  * uniform, we can do an integer comparison rather than a string comparison.
+ *
+ * Name strings are interned in a global lock-free registry, so a handle stores only its CRC and
+ * a pointer to the shared string: copying and assigning handles never allocates, and the same
+ * name constructed in different places references the same storage. Interned names live for the
+ * lifetime of the process.
  */
 class NameHandle {
  public:
@@ -99,14 +104,18 @@ class NameHandle {
   NameHandle(const NameHandle& other) = default;
   NameHandle(NameHandle&& other) noexcept = default;
 
-  NameHandle(std::string name, uint32_t crc32) : crc32_(crc32), name_(std::move(name)) {}
+  NameHandle(const std::string& name, uint32_t crc32) :
+    crc32_(crc32), name_(&internedName(name.c_str(), name.length(), crc32)) {}
+
+  NameHandle(const char* name, uint32_t crc32) :
+    crc32_(crc32), name_(&internedName(name, std::char_traits<char>::length(name), crc32)) {}
 
   /**
    * @brief Returns a null terminated character array version of the name
    * @returns null terminated character array
    */
   const char* c_str() const {
-    return name_.c_str();
+    return name_->c_str();
   }
 
   /**
@@ -114,7 +123,7 @@ class NameHandle {
    * @returns Reference to the actual name string
    */
   const std::string& toString() const {
-    return name_;
+    return *name_;
   }
 
   /**
@@ -152,28 +161,25 @@ class NameHandle {
     return !(*this > other);
   }
 
-  NameHandle& operator=(const NameHandle& other) {
-    if (crc32_ == other.crc32_) {
-      return *this;
-    }
-
-    crc32_ = other.crc32_;
-    name_ = other.name_;
-    return *this;
-  }
+  NameHandle& operator=(const NameHandle& other) = default;
 
   NameHandle& operator=(NameHandle&& other) noexcept = default;
 
   operator const char*() const {
-    return name_.c_str();
+    return name_->c_str();
   }
 
  private:
 #if IGL_DEBUG
   bool checkIsValidCrcCompare(const NameHandle& nh) const;
 #endif
+  /// Returns the registry entry for the name, interning it on first use. Lock-free for both
+  /// lookup and insertion; the returned string is never deallocated.
+  static const std::string& internedName(const char* name, size_t length, uint32_t crc32);
+  static const std::string& emptyName();
+
   uint32_t crc32_ = 0;
-  std::string name_;
+  const std::string* name_ = &emptyName();
 };
 
 /**
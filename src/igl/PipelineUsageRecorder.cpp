@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <igl/PipelineUsageRecorder.h>
+
+#include <cstring>
+#include <igl/Device.h>
+
+namespace igl {
+namespace {
+
+// 'I' 'G' 'L' 'P' in memory order
+constexpr uint32_t kManifestMagic = 0x504c4749u;
+constexpr uint32_t kManifestVersion = 1u;
+
+struct ManifestHeader {
+  uint32_t magic = kManifestMagic;
+  uint32_t version = kManifestVersion;
+  uint32_t numHashes = 0;
+};
+
+} // namespace
+
+std::vector<uint8_t> PipelineUsageManifest::serialize() const {
+  ManifestHeader header;
+  header.numHashes = static_cast<uint32_t>(hashes.size());
+
+  std::vector<uint8_t> blob(sizeof(ManifestHeader) + hashes.size() * sizeof(uint64_t));
+  std::memcpy(blob.data(), &header, sizeof(header));
+  if (!hashes.empty()) {
+    std::memcpy(
+        blob.data() + sizeof(header), hashes.data(), hashes.size() * sizeof(uint64_t));
+  }
+  return blob;
+}
+
+bool PipelineUsageManifest::deserialize(const uint8_t* data,
+                                        size_t length,
+                                        PipelineUsageManifest& outManifest) {
+  outManifest.hashes.clear();
+
+  if (data == nullptr || length < sizeof(ManifestHeader)) {
+    return false;
+  }
+
+  ManifestHeader header;
+  std::memcpy(&header, data, sizeof(header));
+  if (header.magic != kManifestMagic || header.version != kManifestVersion) {
+    return false;
+  }
+  if (length < sizeof(header) + static_cast<size_t>(header.numHashes) * sizeof(uint64_t)) {
+    return false;
+  }
+
+  outManifest.hashes.resize(header.numHashes);
+  if (header.numHashes > 0) {
+    std::memcpy(outManifest.hashes.data(),
+                data + sizeof(header),
+                static_cast<size_t>(header.numHashes) * sizeof(uint64_t));
+  }
+  return true;
+}
+
+void PipelineUsageRecorder::record(const RenderPipelineDesc& desc) noexcept {
+  const uint64_t hash = std::hash<RenderPipelineDesc>()(desc);
+
+  std::lock_guard<std::mutex> guard(mutex_);
+  if (seen_.insert(hash).second) {
+    hashes_.push_back(hash);
+  }
+}
+
+PipelineUsageManifest PipelineUsageRecorder::buildManifest() const {
+  std::lock_guard<std::mutex> guard(mutex_);
+  return PipelineUsageManifest{hashes_};
+}
+
+std::vector<std::shared_ptr<IRenderPipelineState>> warmUpPipelines(
+    IDevice& device,
+    const PipelineUsageManifest& manifest,
+    const RenderPipelineDesc* candidates,
+    size_t numCandidates,
+    Result* outResult) {
+  std::vector<std::shared_ptr<IRenderPipelineState>> pipelines;
+  if (manifest.hashes.empty() || candidates == nullptr || numCandidates == 0) {
+    Result::setOk(outResult);
+    return pipelines;
+  }
+
+  const std::unordered_set<uint64_t> wanted(manifest.hashes.begin(), manifest.hashes.end());
+
+  Result result;
+  for (size_t i = 0; i < numCandidates; ++i) {
+    if (wanted.count(std::hash<RenderPipelineDesc>()(candidates[i])) == 0) {
+      continue;
+    }
+    Result createResult;
+    auto pipeline = device.createRenderPipeline(candidates[i], &createResult);
+    if (pipeline) {
+      pipelines.push_back(std::move(pipeline));
+    } else if (result.isOk()) {
+      // keep warming the remaining candidates; report the first failure
+      result = std::move(createResult);
+    }
+  }
+
+  Result::setResult(outResult, std::move(result));
+  return pipelines;
+}
+
+} // namespace igl
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <igl/RenderPipelineState.h>
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+namespace igl {
+
+class IDevice;
+
+/**
+ * @brief Compact record of the render pipelines used during a session, stored as
+ * RenderPipelineDesc hashes in first-use order.
+ *
+ * Driver pipeline caches miss whenever the OS evicts them; a manifest persisted by the
+ * application survives eviction and gives deterministic warm starts on every backend. The hashes
+ * are only meaningful to the build that produced them: RenderPipelineDesc hashing is not
+ * guaranteed stable across IGL versions, so treat a manifest that fails to load as empty rather
+ * than as an error.
+ */
+struct PipelineUsageManifest {
+  std::vector<uint64_t> hashes;
+
+  /**
+   * @brief Serializes the manifest to a compact byte blob (magic, version, hash list). The
+   * application owns persisting the blob, e.g. next to its other caches.
+   */
+  [[nodiscard]] std::vector<uint8_t> serialize() const;
+
+  /**
+   * @brief Parses a blob produced by serialize(). Returns false and leaves `outManifest` empty
+   * when the blob is truncated, has the wrong magic or comes from an incompatible version.
+   */
+  [[nodiscard]] static bool deserialize(const uint8_t* IGL_NULLABLE data,
+                                        size_t length,
+                                        PipelineUsageManifest& outManifest);
+};
+
+/**
+ * @brief Captures the stream of RenderPipelineDesc hashes passing through
+ * IDevice::createRenderPipeline().
+ *
+ * Install one with IDevice::setPipelineUsageRecorder(); every render pipeline created afterwards
+ * is recorded once, in first-use order. Thread-safe; record() is cheap enough to leave enabled
+ * in production sessions.
+ */
+class PipelineUsageRecorder {
+ public:
+  void record(const RenderPipelineDesc& desc) noexcept;
+
+  /**
+   * @brief Returns a snapshot of everything recorded so far.
+   */
+  [[nodiscard]] PipelineUsageManifest buildManifest() const;
+
+ private:
+  mutable std::mutex mutex_;
+  std::unordered_set<uint64_t> seen_;
+  // first-use order, so a truncated warm-up still compiles the pipelines needed earliest
+  std::vector<uint64_t> hashes_;
+};
+
+/**
+ * @brief Replays a manifest at startup: creates every candidate descriptor whose hash appears in
+ * `manifest`, so backends that compile in the background start warming those pipelines
+ * immediately. The caller supplies the candidate descriptors — a manifest alone cannot
+ * reconstruct them — and must keep the returned pipelines alive for the warmed state to stick.
+ * Candidates not present in the manifest are skipped; manifest entries without a matching
+ * candidate are ignored.
+ */
+std::vector<std::shared_ptr<IRenderPipelineState>> warmUpPipelines(
+    IDevice& device,
+    const PipelineUsageManifest& manifest,
+    const RenderPipelineDesc* IGL_NULLABLE candidates,
+    size_t numCandidates,
+    Result* IGL_NULLABLE outResult = nullptr);
+
+} // namespace igl
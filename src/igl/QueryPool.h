@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <igl/Common.h>
+#include <string>
+
+namespace igl {
+
+/**
+ * Type of GPU query recorded into an IQueryPool.
+ *
+ * Occlusion : Counts samples passing the depth/stencil test between begin and end. Maps to
+ * visibility result buffers on Metal, VK_QUERY_TYPE_OCCLUSION on Vulkan and
+ * GL_ANY_SAMPLES_PASSED on OpenGL (where the result is 0 or 1, not a sample count).
+ * PipelineStatistics : Backend-defined pipeline counters; optional, check the creation Result.
+ */
+enum class QueryType : uint8_t {
+  Occlusion,
+  PipelineStatistics,
+};
+
+/**
+ * Describes a pool of queries of one type.
+ */
+struct QueryPoolDesc {
+  QueryType type = QueryType::Occlusion;
+  /// Number of individual queries in the pool
+  uint32_t count = 0;
+  std::string debugName;
+};
+
+/**
+ * @brief A pool of GPU queries with non-blocking result retrieval.
+ *
+ * Queries are recorded per render pass via IRenderCommandEncoder::beginOcclusionQuery /
+ * endOcclusionQuery; occlusion pools must additionally be attached to the pass through
+ * RenderPassDesc::occlusionQueryPool, since some backends bind the result storage to the pass
+ * itself. Results become available once the GPU finishes the submitted work; getResults() never
+ * stalls, so callers typically consume the previous frame's visibility while recording the next.
+ */
+class IQueryPool {
+ public:
+  virtual ~IQueryPool() = default;
+
+  virtual QueryType getType() const = 0;
+
+  /// Number of queries in the pool
+  virtual uint32_t getCount() const = 0;
+
+  /**
+   * @brief Copies the results of queries [first, first + count) into outResults without waiting
+   * for the GPU. Returns false and leaves outResults untouched when any query in the range has
+   * been recorded but not yet resolved; queries never recorded read as 0.
+   */
+  virtual bool getResults(uint32_t first, uint32_t count, uint64_t* IGL_NONNULL outResults) = 0;
+};
+
+} // namespace igl
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <igl/RenderCommandEncoder.h>
+
+#include <igl/Device.h>
+
+namespace igl {
+
+void IRenderCommandEncoder::bindBindGroup(const IDevice& device, BindGroupHandle handle) {
+  const BindGroupDesc* desc = device.getBindGroupDesc(handle);
+  if (!IGL_VERIFY(desc != nullptr)) {
+    return;
+  }
+
+  for (uint32_t i = 0; i != IGL_TEXTURE_SAMPLERS_MAX; i++) {
+    if (desc->textures[i]) {
+      bindTexture(i, BindTarget::kAllGraphics, desc->textures[i].get());
+    }
+  }
+  for (uint32_t i = 0; i != IGL_UNIFORM_BLOCKS_BINDING_MAX; i++) {
+    // bindBuffer takes the shared_ptr by const reference, so no refcount is touched
+    if (desc->buffersUniform[i]) {
+      bindBuffer(static_cast<int>(i), BindTarget::kAllGraphics, desc->buffersUniform[i], 0);
+    }
+    if (desc->buffersStorage[i]) {
+      bindBuffer(static_cast<int>(i), BindTarget::kAllGraphics, desc->buffersStorage[i], 0);
+    }
+  }
+}
+
+void IRenderCommandEncoder::bindSamplerStates(size_t index,
+                                              uint8_t target,
+                                              ISamplerState* const* samplerStates,
+                                              size_t count) {
+  if (!IGL_VERIFY(samplerStates != nullptr)) {
+    return;
+  }
+  for (size_t i = 0; i != count; i++) {
+    if (samplerStates[i]) {
+      bindSamplerState(index + i, target, samplerStates[i]);
+    }
+  }
+}
+
+void IRenderCommandEncoder::bindTextures(size_t index,
+                                         uint8_t target,
+                                         ITexture* const* textures,
+                                         size_t count) {
+  if (!IGL_VERIFY(textures != nullptr)) {
+    return;
+  }
+  for (size_t i = 0; i != count; i++) {
+    if (textures[i]) {
+      bindTexture(index + i, target, textures[i]);
+    }
+  }
+}
+
+void IRenderCommandEncoder::beginOcclusionQuery(const std::shared_ptr<IQueryPool>& /*pool*/,
+                                                uint32_t /*index*/) {
+  IGL_ASSERT_NOT_IMPLEMENTED();
+}
+
+void IRenderCommandEncoder::endOcclusionQuery(const std::shared_ptr<IQueryPool>& /*pool*/,
+                                              uint32_t /*index*/) {
+  IGL_ASSERT_NOT_IMPLEMENTED();
+}
+
+} // namespace igl
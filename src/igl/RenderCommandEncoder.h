@@ -17,6 +17,8 @@ namespace igl {
 
 class IBuffer;
 class IDepthStencilState;
+class IDevice;
+class IQueryPool;
 class IRenderPipelineState;
 class ISamplerState;
 class ITexture;
@@ -69,9 +71,29 @@ class IRenderCommandEncoder : public ICommandEncoder {
   // For OpenGL, 'index' is the texture unit
   virtual void bindTexture(size_t index, uint8_t target, ITexture* texture) = 0;
 
+  /// Binds `count` sampler states to the consecutive slots starting at `index`. A null entry
+  /// binds nothing to its slot. The default implementation replays through bindSamplerState()
+  /// per slot; backends override it to validate once and issue a single range bind.
+  virtual void bindSamplerStates(size_t index,
+                                 uint8_t target,
+                                 ISamplerState* const* samplerStates,
+                                 size_t count);
+  /// Binds `count` textures to the consecutive slots starting at `index`; the array counterpart
+  /// of bindTexture() with the same slot semantics as bindSamplerStates(). A material's full
+  /// texture set costs one virtual call instead of one per slot.
+  virtual void bindTextures(size_t index, uint8_t target, ITexture* const* textures, size_t count);
+
   /// Binds an individual uniform. Exclusively for use when uniform blocks are not supported.
   virtual void bindUniform(const UniformDesc& uniformDesc, const void* data) = 0;
 
+  /// Binds every resource of a bind group created by IDevice::createBindGroup. The trivially
+  /// copyable handle is resolved through the device's generation-checked slot table and the
+  /// stored resources are bound by raw pointer, so per-draw binding performs no atomic refcount
+  /// operations. Textures and buffers are bound at their array slot for all graphics stages; the
+  /// default implementation replays through the individual bind calls, and backends may override
+  /// it with a native fast path.
+  virtual void bindBindGroup(const IDevice& device, BindGroupHandle handle);
+
   virtual void draw(PrimitiveType primitiveType,
                     size_t vertexStart,
                     size_t vertexCount,
@@ -103,6 +125,28 @@ class IRenderCommandEncoder : public ICommandEncoder {
                                         size_t indirectBufferOffset,
                                         uint32_t drawCount,
                                         uint32_t stride = 0) = 0;
+  /// Consumes GPU-written indirect draws: the actual draw count is read from countBuffer (a single
+  /// uint32_t at countBufferOffset, clamped to maxDrawCount). Intended for GPU-driven submission
+  /// where a compute culling pass writes the command array and the count. Backends without native
+  /// count-buffer support draw all maxDrawCount commands, so the producer must zero out the
+  /// commands of culled draws. Check DeviceFeatures::DrawIndirectCount for native support.
+  virtual void multiDrawIndexedIndirectCount(PrimitiveType primitiveType,
+                                             IndexFormat indexFormat,
+                                             IBuffer& indexBuffer,
+                                             IBuffer& indirectBuffer,
+                                             size_t indirectBufferOffset,
+                                             IBuffer& countBuffer,
+                                             size_t countBufferOffset,
+                                             uint32_t maxDrawCount,
+                                             uint32_t stride = 0) = 0;
+
+  /// Starts counting samples that pass the depth/stencil test into query `index` of the pool.
+  /// Occlusion pools must also be attached to the pass via RenderPassDesc::occlusionQueryPool.
+  /// Queries must not nest; end the active query before beginning another one.
+  virtual void beginOcclusionQuery(const std::shared_ptr<IQueryPool>& pool, uint32_t index);
+  /// Stops the occlusion query started by beginOcclusionQuery. The result becomes readable
+  /// through IQueryPool::getResults once the GPU finishes the submitted command buffer.
+  virtual void endOcclusionQuery(const std::shared_ptr<IQueryPool>& pool, uint32_t index);
 
   virtual void setStencilReferenceValue(uint32_t value) = 0;
   virtual void setStencilReferenceValues(uint32_t frontValue, uint32_t backValue) = 0;
@@ -13,6 +13,8 @@
 namespace igl {
 
 class IFramebuffer;
+class IQueryPool;
+class IShaderStages;
 class ITexture;
 
 /**
@@ -57,6 +59,23 @@ enum class MsaaDepthResolveFilter : uint8_t {
   Max,
 };
 
+/**
+ * @brief FoveationLevel is a hint for fixed-foveated rendering: how aggressively fragment shading
+ * may be reduced towards the periphery of the render target. This can be None, Low, Medium, or
+ * High.
+ *
+ * None : Full-rate shading everywhere.
+ * Low : Slight peripheral shading-rate reduction.
+ * Medium : Noticeable peripheral shading-rate reduction.
+ * High : Maximum peripheral shading-rate reduction.
+ */
+enum class FoveationLevel : uint8_t {
+  None,
+  Low,
+  Medium,
+  High,
+};
+
 /**
  * @brief RenderPassDesc provides the basis for describing a render pass and provides default
  * operations for depth and stencil.
@@ -114,6 +133,76 @@ struct RenderPassDesc {
    * @brief stencilAttachment property which is clear to 0 by default
    */
   StencilAttachmentDesc stencilAttachment;
+  /**
+   * @brief Bitmask of the views rendered by this pass when the framebuffer uses
+   * FramebufferMode::Stereo (bit N enables view N). A value of 0 selects the backend default of
+   * two views (0x3). Ignored for FramebufferMode::Mono.
+   */
+  uint32_t viewMask = 0;
+  /**
+   * @brief Optional pool backing beginOcclusionQuery/endOcclusionQuery on this pass's render
+   * command encoder. Must be set at pass creation because some backends (Metal) attach the
+   * query result storage to the pass itself.
+   */
+  std::shared_ptr<IQueryPool> occlusionQueryPool;
+  /**
+   * @brief Fixed-foveated rendering hint for this pass. Honored where the render target supports
+   * foveation (e.g. XR swapchains created with foveation enabled, fragment density maps);
+   * ignored everywhere else.
+   */
+  FoveationLevel foveationLevel = FoveationLevel::None;
+  /**
+   * @brief Renders the pass into the lower-scale origin-anchored sub-rect of the attachments:
+   * the backend clamps the default viewport and scissor to renderScale times the attachment
+   * size, so dynamic resolution only changes this value instead of reallocating render targets.
+   * Passes that later sample a scaled attachment must multiply their UVs by the same factor
+   * (see RenderPassDesc::scaledDimension() for the exact sub-rect size). Values are clamped to
+   * (0, 1]; 1 renders at full size. Encoders that bind their own viewport/scissor are
+   * unaffected.
+   */
+  float renderScale = 1.0f;
+  /**
+   * @brief Restricts the pass to this region of the attachments, e.g. for damage-region UI
+   * rendering: clears and the default scissor only touch the render area, and content outside
+   * it is preserved where the API can express that (Vulkan render areas, OpenGL scissored
+   * clears). Metal cannot restrict its load-action clears, so there only the default scissor is
+   * confined; combine with LoadAction::Load to preserve the outside content. The default
+   * viewport still covers the whole attachment, so geometry is not rescaled. A null or
+   * zero-sized rect (the default) covers the whole attachment; the rect is clamped to the
+   * attachment size. Takes precedence over renderScale when both are set.
+   */
+  ScissorRect renderArea = {};
+  /**
+   * @brief Optional custom MSAA resolve executed inside the pass, e.g. for tonemap-aware
+   * resolves where averaging raw samples is wrong. The shader stages hold a fullscreen-triangle
+   * vertex shader (3 vertices, no vertex buffers, gl_VertexIndex only) and a fragment shader
+   * that reads the multisampled color via a subpass input (`subpassInputMS` at set 0, binding 0)
+   * and writes the resolved color. Requires StoreAction::MsaaResolve on color attachment 0 and
+   * exactly one color attachment. Honored on Vulkan when render pass objects are used (the
+   * resolve runs as a second subpass, so the samples never leave tile memory on tiled GPUs);
+   * everywhere else the built-in resolve runs and this field is ignored.
+   */
+  std::shared_ptr<IShaderStages> colorResolveShaderStages;
+
+  /**
+   * @brief Whether this pass is restricted to an explicit render area (see renderArea).
+   */
+  bool hasRenderArea() const {
+    return !renderArea.isNull() && renderArea.width > 0 && renderArea.height > 0;
+  }
+
+  /**
+   * @brief The size of a render dimension after applying a render scale: at least 1, never
+   * larger than `dimension`. Backends use this for the default viewport/scissor; apps use it to
+   * derive the UV scale (scaledDimension(w, s) / w) when sampling a scaled attachment.
+   */
+  static uint32_t scaledDimension(uint32_t dimension, float renderScale) {
+    if (renderScale >= 1.0f || dimension == 0) {
+      return dimension;
+    }
+    const auto scaled = static_cast<uint32_t>(static_cast<float>(dimension) * renderScale);
+    return scaled > 1u ? (scaled < dimension ? scaled : dimension) : 1u;
+  }
 };
 
 } // namespace igl
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <igl/RenderPipelineReflection.h>
+
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+
+namespace igl {
+namespace {
+
+// an exact textual key of everything that defines a block layout; two blocks with equal keys are
+// interchangeable for binding purposes
+std::string makeLayoutKey(const BufferArgDesc& desc) {
+  std::string key = desc.name.toString();
+  key += ':' + std::to_string(desc.bufferDataSize);
+  key += ':' + std::to_string(desc.bufferIndex);
+  for (const auto& member : desc.members) {
+    key += ';' + member.name.toString();
+    key += ',' + std::to_string(static_cast<int>(member.type));
+    key += ',' + std::to_string(member.offset);
+    key += ',' + std::to_string(member.arrayLength);
+  }
+  return key;
+}
+
+} // namespace
+
+int UniformBlockLayout::findMember(const char* IGL_NONNULL memberName) const {
+  for (size_t i = 0; i < members.size(); ++i) {
+    if (strcmp(members[i].name.c_str(), memberName) == 0) {
+      return static_cast<int>(i);
+    }
+  }
+  return -1;
+}
+
+std::shared_ptr<const UniformBlockLayout> UniformBlockLayout::getOrCreate(
+    const BufferArgDesc& desc) {
+  static std::mutex cacheMutex;
+  static std::unordered_map<std::string, std::weak_ptr<const UniformBlockLayout>> cache;
+
+  std::string key = makeLayoutKey(desc);
+
+  const std::lock_guard<std::mutex> lock(cacheMutex);
+
+  auto it = cache.find(key);
+  if (it != cache.end()) {
+    if (auto layout = it->second.lock()) {
+      return layout;
+    }
+    cache.erase(it);
+  }
+
+  auto layout = std::make_shared<UniformBlockLayout>();
+  layout->name = desc.name;
+  layout->dataSize = desc.bufferDataSize;
+  layout->bufferIndex = desc.bufferIndex;
+  layout->members.reserve(desc.members.size());
+  for (const auto& member : desc.members) {
+    layout->members.push_back(Member{member.name,
+                                     member.type,
+                                     member.offset,
+                                     member.arrayLength * sizeForUniformType(member.type),
+                                     member.arrayLength});
+  }
+
+  cache.emplace(std::move(key), layout);
+  return layout;
+}
+
+} // namespace igl
@@ -13,6 +13,7 @@
 #include <igl/Texture.h>
 #include <igl/Uniform.h>
 #include <map>
+#include <memory>
 #include <vector>
 
 namespace igl {
@@ -43,6 +44,46 @@ struct BufferArgDesc {
                                          ///< each members of a buffer argument.
 };
 
+/**
+ * @brief A flat, immutable uniform block layout baked from reflection data.
+ *
+ * Reflection consumers normally resolve block members through string or NameHandle lookups on
+ * every bind. Baking the block once produces a table addressed by integer index (the member's
+ * position in `members`, matching the source BufferArgDesc::members order), so per-draw code can
+ * store the index and never touch a map again. Layouts baked from identical blocks are shared
+ * across pipelines, which also makes the layout pointer usable as a cheap block identity.
+ */
+struct UniformBlockLayout {
+  struct Member {
+    igl::NameHandle name; ///< The name of the member
+    igl::UniformType type = igl::UniformType::Invalid; ///< The type of the member
+    size_t offset = 0; ///< The offset from the beginning of the block
+    size_t size = 0; ///< Total byte size covering all array elements
+    size_t arrayLength = 1; ///< The number of elements if the member is an array
+  };
+
+  igl::NameHandle name; ///< The name of the block
+  size_t dataSize = 0; ///< The size of the block in bytes
+  int bufferIndex = -1; ///< The buffer binding index of the block
+
+  std::vector<Member> members; ///< The block's members in BufferArgDesc::members order
+
+  /**
+   * @brief Returns the index of `memberName` in `members`, or -1 when absent.
+   *
+   * Meant for setup code; per-draw code should hold on to the returned index.
+   */
+  [[nodiscard]] int findMember(const char* IGL_NONNULL memberName) const;
+
+  /**
+   * @brief Bakes a layout from reflected buffer metadata.
+   *
+   * Blocks with identical name, size, binding index and members yield the same shared instance,
+   * so pipelines reflecting the same block reuse one layout.
+   */
+  static std::shared_ptr<const UniformBlockLayout> getOrCreate(const BufferArgDesc& desc);
+};
+
 /**
  * @brief A structure that describes the texture argument to a shader.
  */
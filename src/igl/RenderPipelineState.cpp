@@ -51,6 +51,12 @@ bool RenderPipelineDesc::operator!=(const RenderPipelineDesc& other) const {
 }
 
 bool RenderPipelineDesc::operator==(const RenderPipelineDesc& other) const {
+  // single-compare fast path: two descs with valid cached hashes cannot be equal if the hashes
+  // differ; equal hashes still fall through to the full comparison
+  if (hashValid_ && other.hashValid_ && precomputedHash_ != other.precomputedHash_) {
+    return false;
+  }
+
   if (vertexInputState != other.vertexInputState) {
     return false;
   }
@@ -89,11 +95,13 @@ bool RenderPipelineDesc::operator==(const RenderPipelineDesc& other) const {
   return true;
 }
 
+namespace {
+
 /// The underlying assumption for this hash is all of the shared pointers in
 /// this structure can uniquely identify the object they are pointing to.
 /// It is the responsibility of the caller of this function to make sure
 /// that is the case.
-size_t std::hash<RenderPipelineDesc>::operator()(RenderPipelineDesc const& key) const {
+size_t computeRenderPipelineDescHash(const RenderPipelineDesc& key) {
   size_t hash = std::hash<uintptr_t>()(reinterpret_cast<uintptr_t>(key.vertexInputState.get()));
 
   hash ^= std::hash<uintptr_t>()(reinterpret_cast<uintptr_t>(key.shaderStages.get()));
@@ -121,6 +129,20 @@ size_t std::hash<RenderPipelineDesc>::operator()(RenderPipelineDesc const& key)
   return hash;
 }
 
+} // namespace
+
+void RenderPipelineDesc::precomputeHash() const {
+  precomputedHash_ = computeRenderPipelineDescHash(*this);
+  hashValid_ = true;
+}
+
+size_t std::hash<RenderPipelineDesc>::operator()(RenderPipelineDesc const& key) const {
+  if (key.hashValid_) {
+    return key.precomputedHash_;
+  }
+  return computeRenderPipelineDescHash(key);
+}
+
 size_t std::hash<RenderPipelineDesc::TargetDesc>::operator()(
     RenderPipelineDesc::TargetDesc const& key) const {
   size_t hash = std::hash<int>()(EnumToValue(key.depthAttachmentFormat));
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <igl/Common.h>
+#include <igl/InlineVector.h>
 #include <igl/NameHandle.h>
 #include <igl/RenderPipelineReflection.h>
 #include <igl/Shader.h>
@@ -15,6 +16,15 @@
 #include <unordered_map>
 #include <vector>
 
+namespace igl {
+struct RenderPipelineDesc;
+} // namespace igl
+
+namespace std {
+template<>
+struct hash<igl::RenderPipelineDesc>;
+} // namespace std
+
 namespace igl {
 
 class IShaderModule;
@@ -151,9 +161,11 @@ struct RenderPipelineDesc {
     };
 
     /*
-     * @brief Array of attachments that store color data
+     * @brief Array of attachments that store color data. Stored inline so that copying,
+     * comparing and hashing the descriptor never allocates; at most IGL_COLOR_ATTACHMENTS_MAX
+     * entries.
      */
-    std::vector<ColorAttachment> colorAttachments;
+    InlineVector<ColorAttachment, IGL_COLOR_ATTACHMENTS_MAX> colorAttachments;
     /*
      * @brief Pixel format of the attachment that stores depth data
      */
@@ -204,6 +216,29 @@ struct RenderPipelineDesc {
 
   bool operator==(const RenderPipelineDesc& other) const;
   bool operator!=(const RenderPipelineDesc& other) const;
+
+  /**
+   * @brief Precomputes and caches the descriptor's hash, making later cache probes
+   * (std::hash<RenderPipelineDesc>, used by the IGLU state pools and backend pipeline caches)
+   * return the stored value instead of re-hashing the shader stage pointers and sampler/uniform
+   * block maps. Equality checks also compare the cached hashes of both sides as a single-compare
+   * fast path for mismatches.
+   *
+   * Call once after the descriptor is fully populated. The hash is not tracked through member
+   * writes, so any mutation afterwards must be followed by another precomputeHash() (or
+   * invalidateHash()), or lookups will use a stale value. Copies inherit the cached hash.
+   */
+  void precomputeHash() const;
+
+  /** @brief Drops a previously precomputed hash; the next lookup hashes the members again */
+  void invalidateHash() const {
+    hashValid_ = false;
+  }
+
+ private:
+  friend struct std::hash<RenderPipelineDesc>;
+  mutable size_t precomputedHash_ = 0;
+  mutable bool hashValid_ = false;
 };
 
 class IRenderPipelineState {
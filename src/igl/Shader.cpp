@@ -71,6 +71,32 @@ bool ShaderModuleInfo::operator!=(const ShaderModuleInfo& other) const {
   return !operator==(other);
 }
 
+SpecializationConstant SpecializationConstant::makeBool(uint32_t id, bool value) {
+  return {id, SpecializationConstantType::Bool, value ? 1u : 0u};
+}
+
+SpecializationConstant SpecializationConstant::makeInt(uint32_t id, int32_t value) {
+  return {id, SpecializationConstantType::Int, static_cast<uint32_t>(value)};
+}
+
+SpecializationConstant SpecializationConstant::makeUInt(uint32_t id, uint32_t value) {
+  return {id, SpecializationConstantType::UInt, value};
+}
+
+SpecializationConstant SpecializationConstant::makeFloat(uint32_t id, float value) {
+  uint32_t pattern = 0;
+  memcpy(&pattern, &value, sizeof(pattern));
+  return {id, SpecializationConstantType::Float, pattern};
+}
+
+bool SpecializationConstant::operator==(const SpecializationConstant& other) const {
+  return id == other.id && type == other.type && value == other.value;
+}
+
+bool SpecializationConstant::operator!=(const SpecializationConstant& other) const {
+  return !operator==(other);
+}
+
 bool ShaderInput::isValid() const noexcept {
   if (type == ShaderInputType::String) {
     return source != nullptr && data == nullptr && length == 0;
@@ -117,7 +143,8 @@ ShaderModuleDesc ShaderModuleDesc::fromBinaryInput(const void* IGL_NONNULL data,
 }
 
 bool ShaderModuleDesc::operator==(const ShaderModuleDesc& other) const {
-  return info == other.info && input == other.input && debugName == other.debugName;
+  return info == other.info && input == other.input &&
+         specializationConstants == other.specializationConstants && debugName == other.debugName;
 }
 
 bool ShaderModuleDesc::operator!=(const ShaderModuleDesc& other) const {
@@ -255,6 +282,14 @@ size_t std::hash<igl::ShaderModuleInfo>::operator()(igl::ShaderModuleInfo const&
   return hash;
 }
 
+size_t std::hash<igl::SpecializationConstant>::operator()(
+    igl::SpecializationConstant const& key) const {
+  size_t hash = std::hash<uint32_t>()(key.id);
+  hash ^= std::hash<uint8_t>()(igl::EnumToValue(key.type));
+  hash ^= std::hash<uint32_t>()(key.value);
+  return hash;
+}
+
 size_t std::hash<igl::ShaderInput>::operator()(igl::ShaderInput const& key) const {
   static_assert(std::is_same_v<uint8_t, std::underlying_type<igl::ShaderInputType>::type>);
   size_t hash = safeCStrHash(key.source);
@@ -267,6 +302,9 @@ size_t std::hash<igl::ShaderModuleDesc>::operator()(igl::ShaderModuleDesc const&
   static_assert(std::is_same_v<uint8_t, std::underlying_type<igl::ShaderInputType>::type>);
   size_t hash = std::hash<igl::ShaderModuleInfo>()(key.info);
   hash ^= std::hash<igl::ShaderInput>()(key.input);
+  for (const auto& constant : key.specializationConstants) {
+    hash ^= std::hash<igl::SpecializationConstant>()(constant);
+  }
   hash ^= std::hash<std::string>()(key.debugName);
   return hash;
 }
@@ -51,6 +51,42 @@ struct ShaderModuleInfo {
   bool operator!=(const ShaderModuleInfo& other) const;
 };
 
+/**
+ * @brief How the 32-bit value of a SpecializationConstant is interpreted.
+ */
+enum class SpecializationConstantType : uint8_t {
+  Bool,
+  Int,
+  UInt,
+  Float,
+};
+
+/**
+ * @brief A compile-time constant baked into an already compiled shader module, so one module can
+ * service many material variants at near-zero per-variant compile cost.
+ *
+ * Maps to VkSpecializationInfo on Vulkan (the shader declares
+ * layout(constant_id = id)), MTLFunctionConstantValues on Metal (the shader declares
+ * [[function_constant(id)]]), and a preprocessor define IGL_SPEC_CONST_<id> on OpenGL, where the
+ * lack of API support means each distinct constant set still costs a recompile.
+ */
+struct SpecializationConstant {
+  /** @brief The constant's id as declared in the shader (see above). */
+  uint32_t id = 0;
+  /** @brief Interpretation of value. */
+  SpecializationConstantType type = SpecializationConstantType::UInt;
+  /** @brief The value's 32-bit pattern; use the make* helpers to populate it. */
+  uint32_t value = 0;
+
+  static SpecializationConstant makeBool(uint32_t id, bool value);
+  static SpecializationConstant makeInt(uint32_t id, int32_t value);
+  static SpecializationConstant makeUInt(uint32_t id, uint32_t value);
+  static SpecializationConstant makeFloat(uint32_t id, float value);
+
+  bool operator==(const SpecializationConstant& other) const;
+  bool operator!=(const SpecializationConstant& other) const;
+};
+
 /**
  * @brief A enumeration of shader input types.
  */
@@ -116,6 +152,12 @@ struct ShaderModuleDesc {
   ShaderModuleInfo info;
   /** @brief The input to create the shader module. */
   ShaderInput input;
+  /**
+   * @brief Compile-time constants specializing this module. Unset constants keep the default
+   * value declared in the shader.
+   * @see igl::SpecializationConstant
+   */
+  std::vector<SpecializationConstant> specializationConstants;
   /** @brief The module's debug name. */
   std::string debugName;
 
@@ -323,6 +365,11 @@ struct hash<igl::ShaderModuleInfo> {
   size_t operator()(igl::ShaderModuleInfo const& /*key*/) const;
 };
 
+template<>
+struct hash<igl::SpecializationConstant> {
+  size_t operator()(igl::SpecializationConstant const& /*key*/) const;
+};
+
 template<>
 struct hash<igl::ShaderInput> {
   size_t operator()(igl::ShaderInput const& /*key*/) const;
@@ -7,13 +7,132 @@
 
 #include <igl/ShaderCreator.h>
 
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <functional>
 #include <igl/Device.h>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
 
 namespace igl {
 namespace {
 std::unique_ptr<IShaderStages> fromLibraryDesc(const IDevice& device,
                                                const ShaderLibraryDesc& libraryDesc,
                                                Result* IGL_NULLABLE outResult);
+
+// Shared worker pool backing the *Async creator variants. Started lazily on the first async
+// compile and joined at static destruction; a couple of threads is enough since backend shader
+// compilers parallelize internally.
+class ShaderCompileWorkerPool {
+ public:
+  static ShaderCompileWorkerPool& instance() {
+    static ShaderCompileWorkerPool pool;
+    return pool;
+  }
+
+  void enqueue(std::function<void()> task) {
+    {
+      std::lock_guard<std::mutex> guard(mutex_);
+      tasks_.push_back(std::move(task));
+    }
+    condition_.notify_one();
+  }
+
+ private:
+  static constexpr size_t kNumThreads = 2;
+
+  ShaderCompileWorkerPool() {
+    threads_.reserve(kNumThreads);
+    for (size_t i = 0; i < kNumThreads; ++i) {
+      threads_.emplace_back([this] { run(); });
+    }
+  }
+
+  ~ShaderCompileWorkerPool() {
+    {
+      std::lock_guard<std::mutex> guard(mutex_);
+      stop_ = true;
+    }
+    condition_.notify_all();
+    for (auto& thread : threads_) {
+      thread.join();
+    }
+  }
+
+  void run() {
+    for (;;) {
+      std::function<void()> task;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        condition_.wait(lock, [this] { return stop_ || !tasks_.empty(); });
+        if (tasks_.empty()) {
+          return; // stop requested and drained
+        }
+        task = std::move(tasks_.front());
+        tasks_.pop_front();
+      }
+      task();
+    }
+  }
+
+  std::vector<std::thread> threads_;
+  std::deque<std::function<void()>> tasks_;
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  bool stop_ = false;
+};
+
+bool deviceCompilesOffThread(const IDevice& device) {
+  // Vulkan shader module creation and Metal library compilation are thread-safe; OpenGL shader
+  // objects must be created with the device's context current, which only the calling thread
+  // can guarantee
+  switch (device.getBackendType()) {
+  case BackendType::Metal:
+  case BackendType::Vulkan:
+    return true;
+  default:
+    return false;
+  }
+}
+
+// Interns shader source for the *Async creator variants, so compiling the same source repeatedly
+// (an übershader compiled once per specialization variant, say) shares one heap copy instead of
+// every capture cloning the full string. The pool holds weak references only; a source is freed
+// as soon as no compile that uses it is in flight.
+std::shared_ptr<const std::string> internShaderSource(const char* IGL_NONNULL source) {
+  static std::mutex poolMutex;
+  static std::unordered_map<size_t, std::weak_ptr<const std::string>> pool;
+
+  const std::string_view view(source);
+  const size_t hash = std::hash<std::string_view>()(view);
+
+  const std::lock_guard<std::mutex> guard(poolMutex);
+  const auto it = pool.find(hash);
+  if (it != pool.end()) {
+    auto interned = it->second.lock();
+    if (interned && *interned == view) {
+      return interned;
+    }
+  }
+  auto interned = std::make_shared<const std::string>(view);
+  pool[hash] = interned;
+  return interned;
+}
+
+template<typename ResultT, typename Fn>
+std::future<ResultT> dispatchCompile(const IDevice& device, Fn&& fn) {
+  auto task = std::make_shared<std::packaged_task<ResultT()>>(std::forward<Fn>(fn));
+  auto future = task->get_future();
+  if (deviceCompilesOffThread(device)) {
+    ShaderCompileWorkerPool::instance().enqueue([task] { (*task)(); });
+  } else {
+    (*task)();
+  }
+  return future;
+}
 } // namespace
 
 std::shared_ptr<IShaderModule> ShaderModuleCreator::fromStringInput(const IDevice& device,
@@ -61,6 +180,48 @@ std::shared_ptr<IShaderModule> ShaderModuleCreator::fromBinaryInput(const IDevic
   return sm;
 }
 
+std::future<ShaderModuleCreator::AsyncResult> ShaderModuleCreator::fromStringInputAsync(
+    const IDevice& device,
+    const char* IGL_NONNULL source,
+    igl::ShaderModuleInfo info,
+    std::string debugName) {
+  return dispatchCompile<AsyncResult>(
+      device,
+      [&device,
+       source = internShaderSource(source),
+       info = std::move(info),
+       debugName = std::move(debugName)]() mutable {
+        AsyncResult asyncResult;
+        asyncResult.module = fromStringInput(
+            device, source->c_str(), std::move(info), std::move(debugName), &asyncResult.result);
+        return asyncResult;
+      });
+}
+
+std::future<ShaderModuleCreator::AsyncResult> ShaderModuleCreator::fromBinaryInputAsync(
+    const IDevice& device,
+    const void* IGL_NONNULL data,
+    size_t dataLength,
+    igl::ShaderModuleInfo info,
+    std::string debugName) {
+  const auto* bytes = static_cast<const uint8_t*>(data);
+  return dispatchCompile<AsyncResult>(
+      device,
+      [&device,
+       data = std::vector<uint8_t>(bytes, bytes + dataLength),
+       info = std::move(info),
+       debugName = std::move(debugName)]() mutable {
+        AsyncResult asyncResult;
+        asyncResult.module = fromBinaryInput(device,
+                                             data.data(),
+                                             data.size(),
+                                             std::move(info),
+                                             std::move(debugName),
+                                             &asyncResult.result);
+        return asyncResult;
+      });
+}
+
 std::unique_ptr<IShaderLibrary> ShaderLibraryCreator::fromStringInput(
     const IDevice& device,
     const char* IGL_NONNULL librarySource,
@@ -256,6 +417,60 @@ std::unique_ptr<IShaderStages> ShaderStagesCreator::fromLibraryBinaryInput(
   return fromLibraryDesc(device, libraryDesc, outResult);
 }
 
+std::future<ShaderStagesCreator::AsyncResult> ShaderStagesCreator::fromModuleStringInputAsync(
+    const IDevice& device,
+    const char* IGL_NONNULL vertexSource,
+    std::string vertexEntryPoint,
+    std::string vertexDebugName,
+    const char* IGL_NONNULL fragmentSource,
+    std::string fragmentEntryPoint,
+    std::string fragmentDebugName) {
+  return dispatchCompile<AsyncResult>(
+      device,
+      [&device,
+       vertexSource = internShaderSource(vertexSource),
+       vertexEntryPoint = std::move(vertexEntryPoint),
+       vertexDebugName = std::move(vertexDebugName),
+       fragmentSource = internShaderSource(fragmentSource),
+       fragmentEntryPoint = std::move(fragmentEntryPoint),
+       fragmentDebugName = std::move(fragmentDebugName)]() mutable {
+        AsyncResult asyncResult;
+        asyncResult.stages = fromModuleStringInput(device,
+                                                   vertexSource->c_str(),
+                                                   std::move(vertexEntryPoint),
+                                                   std::move(vertexDebugName),
+                                                   fragmentSource->c_str(),
+                                                   std::move(fragmentEntryPoint),
+                                                   std::move(fragmentDebugName),
+                                                   &asyncResult.result);
+        return asyncResult;
+      });
+}
+
+std::future<ShaderStagesCreator::AsyncResult> ShaderStagesCreator::fromLibraryStringInputAsync(
+    const IDevice& device,
+    const char* IGL_NONNULL librarySource,
+    std::string vertexEntryPoint,
+    std::string fragmentEntryPoint,
+    std::string libraryDebugName) {
+  return dispatchCompile<AsyncResult>(
+      device,
+      [&device,
+       librarySource = internShaderSource(librarySource),
+       vertexEntryPoint = std::move(vertexEntryPoint),
+       fragmentEntryPoint = std::move(fragmentEntryPoint),
+       libraryDebugName = std::move(libraryDebugName)]() mutable {
+        AsyncResult asyncResult;
+        asyncResult.stages = fromLibraryStringInput(device,
+                                                    librarySource->c_str(),
+                                                    std::move(vertexEntryPoint),
+                                                    std::move(fragmentEntryPoint),
+                                                    std::move(libraryDebugName),
+                                                    &asyncResult.result);
+        return asyncResult;
+      });
+}
+
 std::unique_ptr<IShaderStages> ShaderStagesCreator::fromModuleStringInput(
     const IDevice& device,
     const char* IGL_NONNULL computeSource,
@@ -345,4 +560,95 @@ std::unique_ptr<IShaderStages> fromLibraryDesc(const IDevice& device,
       device, std::move(vertexModule), std::move(fragmentModule), result);
 }
 } // namespace
+
+void ShaderPreprocessor::registerInclude(std::string name, std::string contents) {
+  includes_[std::move(name)] = std::move(contents);
+  // previously expanded blobs may embed the old snippet contents; callers holding the returned
+  // shared_ptrs keep the old blobs alive, only the memoization is dropped
+  cache_.clear();
+}
+
+std::shared_ptr<const std::string> ShaderPreprocessor::resolve(const char* IGL_NONNULL source,
+                                                               Result* IGL_NULLABLE outResult) {
+  const auto it = cache_.find(source);
+  if (it != cache_.end()) {
+    Result::setOk(outResult);
+    return it->second;
+  }
+
+  std::string expanded;
+  expanded.reserve(strlen(source));
+  if (!expand(source, 0, expanded, outResult)) {
+    return nullptr;
+  }
+
+  auto blob = std::make_shared<const std::string>(std::move(expanded));
+  cache_.emplace(source, blob);
+  Result::setOk(outResult);
+  return blob;
+}
+
+bool ShaderPreprocessor::expand(const char* source,
+                                size_t depth,
+                                std::string& output,
+                                Result* outResult) {
+  if (depth > kMaxIncludeDepth) {
+    Result::setResult(outResult,
+                      Result::Code::ArgumentInvalid,
+                      "Shader include nesting too deep; cyclic includes?");
+    return false;
+  }
+
+  const std::string_view text(source);
+  size_t lineStart = 0;
+  while (lineStart < text.size()) {
+    size_t lineEnd = text.find('\n', lineStart);
+    if (lineEnd == std::string_view::npos) {
+      lineEnd = text.size();
+    }
+    const std::string_view line = text.substr(lineStart, lineEnd - lineStart);
+
+    // an include directive: optional whitespace, "#include", then "name" or <name>
+    std::string_view trimmed = line;
+    while (!trimmed.empty() && (trimmed.front() == ' ' || trimmed.front() == '\t')) {
+      trimmed.remove_prefix(1);
+    }
+    constexpr std::string_view kInclude = "#include";
+    if (trimmed.substr(0, kInclude.size()) == kInclude) {
+      trimmed.remove_prefix(kInclude.size());
+      while (!trimmed.empty() && (trimmed.front() == ' ' || trimmed.front() == '\t')) {
+        trimmed.remove_prefix(1);
+      }
+      const char closing = trimmed.empty() ? '\0'
+                           : trimmed.front() == '"' ? '"'
+                           : trimmed.front() == '<' ? '>'
+                                                    : '\0';
+      const size_t nameEnd = closing != '\0' ? trimmed.find(closing, 1) : std::string_view::npos;
+      if (nameEnd == std::string_view::npos) {
+        Result::setResult(
+            outResult, Result::Code::ArgumentInvalid, "Malformed shader #include directive");
+        return false;
+      }
+      const auto snippet = includes_.find(std::string(trimmed.substr(1, nameEnd - 1)));
+      if (snippet == includes_.end()) {
+        Result::setResult(outResult,
+                          Result::Code::ArgumentInvalid,
+                          "Unknown shader #include; register it with registerInclude()");
+        return false;
+      }
+      if (!expand(snippet->second.c_str(), depth + 1, output, outResult)) {
+        return false;
+      }
+      if (!output.empty() && output.back() != '\n') {
+        output += '\n';
+      }
+    } else {
+      output.append(line);
+      output += '\n';
+    }
+    lineStart = lineEnd + 1;
+  }
+  return true;
+}
+
 } // namespace igl
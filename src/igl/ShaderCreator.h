@@ -7,8 +7,11 @@
 
 #pragma once
 
+#include <future>
 #include <igl/Common.h>
 #include <igl/Shader.h>
+#include <string>
+#include <unordered_map>
 
 namespace igl {
 
@@ -50,6 +53,46 @@ class ShaderModuleCreator {
                                                         igl::ShaderModuleInfo info,
                                                         std::string debugName,
                                                         Result* IGL_NULLABLE outResult);
+
+  /**
+   * @brief Result of an asynchronous shader module build: the module, or on failure a null module
+   * with the Result describing the error.
+   */
+  struct AsyncResult {
+    std::shared_ptr<IShaderModule> module;
+    Result result;
+  };
+
+  /**
+   * @brief Asynchronous variant of fromStringInput.
+   * On Metal and Vulkan, compilation runs on a shared worker pool since both backends create
+   * shader objects thread-safely. On OpenGL, shader objects require the device's context to be
+   * current, so the module is compiled on the calling thread and the returned future is already
+   * ready. The source is copied; the device must outlive the returned future.
+   * @param device The device to construct the shader module with.
+   * @param source Null-terminated string containing shader source code.
+   * @param info Shader module metadata.
+   * @param debugName Debug name for the shader module.
+   */
+  static std::future<AsyncResult> fromStringInputAsync(const IDevice& device,
+                                                       const char* IGL_NONNULL source,
+                                                       igl::ShaderModuleInfo info,
+                                                       std::string debugName);
+
+  /**
+   * @brief Asynchronous variant of fromBinaryInput. See fromStringInputAsync for threading
+   * behavior; the binary data is copied, so the caller's buffer may be released on return.
+   * @param device The device to construct the shader module with.
+   * @param data Pre-compiled shader binary data.
+   * @param dataLength Length in bytes of the precompiled shader binary data.
+   * @param info Shader module metadata.
+   * @param debugName Debug name for the shader module.
+   */
+  static std::future<AsyncResult> fromBinaryInputAsync(const IDevice& device,
+                                                       const void* IGL_NONNULL data,
+                                                       size_t dataLength,
+                                                       igl::ShaderModuleInfo info,
+                                                       std::string debugName);
 };
 
 /**
@@ -131,6 +174,15 @@ class ShaderStagesCreator {
  public:
   ShaderStagesCreator() = delete;
 
+  /**
+   * @brief Result of an asynchronous shader stages build: the stages, or on failure null stages
+   * with the Result describing the error.
+   */
+  struct AsyncResult {
+    std::unique_ptr<IShaderStages> stages;
+    Result result;
+  };
+
   /**
    * @brief Constructs IShaderStages for a vertex and fragment shader from module source code.
    * @param device The device to construct the shader stages with.
@@ -211,6 +263,44 @@ class ShaderStagesCreator {
                                                                std::string libraryDebugName,
                                                                Result* IGL_NULLABLE outResult);
 
+  /**
+   * @brief Asynchronous variant of the render fromModuleStringInput.
+   * On Metal and Vulkan, compilation runs on a shared worker pool; on OpenGL it happens on the
+   * calling thread and the returned future is already ready, since GL shader objects require the
+   * device's context to be current. The sources are copied; the device must outlive the returned
+   * future.
+   * @param device The device to construct the shader stages with.
+   * @param vertexSource Null-terminated string containing vertex shader source code.
+   * @param vertexEntryPoint Vertex shader entry point name.
+   * @param vertexDebugName Debug name for vertex shader module.
+   * @param fragmentSource Null-terminated string containing fragment shader source code.
+   * @param fragmentEntryPoint Fragment shader entry point name.
+   * @param fragmentDebugName Debug name for fragment shader module.
+   */
+  static std::future<AsyncResult> fromModuleStringInputAsync(
+      const IDevice& device,
+      const char* IGL_NONNULL vertexSource,
+      std::string vertexEntryPoint,
+      std::string vertexDebugName,
+      const char* IGL_NONNULL fragmentSource,
+      std::string fragmentEntryPoint,
+      std::string fragmentDebugName);
+
+  /**
+   * @brief Asynchronous variant of fromLibraryStringInput. See fromModuleStringInputAsync for
+   * threading behavior.
+   * @param device The device to construct the shader stages with.
+   * @param librarySource Null-terminated string containing shader source code.
+   * @param vertexEntryPoint Vertex shader entry point name.
+   * @param fragmentEntryPoint Fragment shader entry point name.
+   * @param libraryDebugName Optional debug name for the library.
+   */
+  static std::future<AsyncResult> fromLibraryStringInputAsync(const IDevice& device,
+                                                              const char* IGL_NONNULL librarySource,
+                                                              std::string vertexEntryPoint,
+                                                              std::string fragmentEntryPoint,
+                                                              std::string libraryDebugName);
+
   /**
    * @brief Constructs IShaderStages for a compute shader from module source code.
    * @param device The device to construct the shader stages with.
@@ -266,4 +356,52 @@ class ShaderStagesCreator {
       Result* IGL_NULLABLE outResult);
 };
 
+/**
+ * @brief Expands `#include "name"` / `#include <name>` directives in shader source against a
+ * registry of named snippets, with content-addressed caching of the expanded blobs.
+ *
+ * Apps that share a large common preamble across many shaders register it once as a snippet and
+ * include it from each module. resolve() expands a given source exactly once: a repeated call
+ * with the same source returns the same immutable blob, so the preamble is concatenated (and the
+ * combined string allocated) once per unique module instead of once per compile. The returned
+ * blobs are shared_ptrs; callers may keep them alive across resolve() calls and pass
+ * `blob->c_str()` to the ShaderModuleCreator / ShaderStagesCreator string-input entry points.
+ *
+ * Includes may nest up to a fixed depth; an unknown include name or a cycle fails the resolve
+ * with an error Result. Registering a snippet invalidates the cache, since previously expanded
+ * blobs may embed the old contents. Not thread-safe; use one instance per loading thread or
+ * guard it externally.
+ */
+class ShaderPreprocessor {
+ public:
+  /**
+   * @brief Registers (or replaces) the snippet that `#include "name"` expands to. Invalidates
+   * previously cached expansions.
+   * @param name Include name as written between the quotes or angle brackets.
+   * @param contents Snippet source; included verbatim, so it should end with a newline.
+   */
+  void registerInclude(std::string name, std::string contents);
+
+  /**
+   * @brief Expands all include directives in source and returns the cached immutable blob.
+   * Sources without include directives are returned as (cached) verbatim copies.
+   * @param source Null-terminated shader source code.
+   * @param outResult Optional param to receive success or error information.
+   * @returns the expanded source, or nullptr on unknown includes or too-deep nesting.
+   */
+  std::shared_ptr<const std::string> resolve(const char* IGL_NONNULL source,
+                                             Result* IGL_NULLABLE outResult = nullptr);
+
+ private:
+  // includes may include other snippets; deeper nesting than this is treated as a cycle
+  static constexpr size_t kMaxIncludeDepth = 16;
+
+  bool expand(const char* source, size_t depth, std::string& output, Result* outResult);
+
+  std::unordered_map<std::string, std::string> includes_;
+  // expanded blobs keyed by the verbatim input source; exact-match keys make the cache
+  // collision-free and hashing the key once is far cheaper than re-expanding the preamble
+  std::unordered_map<std::string, std::shared_ptr<const std::string>> cache_;
+};
+
 } // namespace igl
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <igl/ShardedResourceTracker.h>
+
+#include <algorithm>
+
+namespace igl {
+
+ShardedResourceTracker::Shard& ShardedResourceTracker::shardForThisThread() noexcept {
+  // Each thread takes the next shard slot the first time it tracks anything, so up to kShardCount
+  // concurrent threads never touch each other's shard. The counter is process-wide: the slot
+  // identifies the thread, not the tracker, so multiple trackers stay consistent.
+  static std::atomic<size_t> nextThreadSlot{0};
+  static thread_local size_t threadSlot = nextThreadSlot.fetch_add(1, std::memory_order_relaxed);
+  return shards_[threadSlot % kShardCount];
+}
+
+void ShardedResourceTracker::record(ResourceKind kind,
+                                    const void* resource,
+                                    bool created) noexcept {
+  auto& shard = shardForThisThread();
+  const uint64_t sequence = nextSequence_.fetch_add(1, std::memory_order_relaxed);
+
+  std::lock_guard<std::mutex> guard(shard.mutex);
+  ResourceEvent event;
+  event.sequence = sequence;
+  event.resource = resource;
+  event.kind = kind;
+  event.created = created;
+  if (!shard.tagStack.empty()) {
+    event.tag = shard.tagStack.back();
+  }
+  shard.events.push_back(std::move(event));
+  liveCounts_[static_cast<size_t>(kind)].fetch_add(created ? 1 : -1, std::memory_order_relaxed);
+}
+
+void ShardedResourceTracker::didCreate(const ITexture* texture) noexcept {
+  record(ResourceKind::Texture, texture, true);
+}
+
+void ShardedResourceTracker::willDelete(const ITexture* texture) noexcept {
+  record(ResourceKind::Texture, texture, false);
+}
+
+void ShardedResourceTracker::didCreate(const IBuffer* buffer) noexcept {
+  record(ResourceKind::Buffer, buffer, true);
+}
+
+void ShardedResourceTracker::willDelete(const IBuffer* buffer) noexcept {
+  record(ResourceKind::Buffer, buffer, false);
+}
+
+void ShardedResourceTracker::didCreate(const IFramebuffer* framebuffer) noexcept {
+  record(ResourceKind::Framebuffer, framebuffer, true);
+}
+
+void ShardedResourceTracker::willDelete(const IFramebuffer* framebuffer) noexcept {
+  record(ResourceKind::Framebuffer, framebuffer, false);
+}
+
+void ShardedResourceTracker::didCreate(const ISamplerState* samplerState) noexcept {
+  record(ResourceKind::SamplerState, samplerState, true);
+}
+
+void ShardedResourceTracker::willDelete(const ISamplerState* samplerState) noexcept {
+  record(ResourceKind::SamplerState, samplerState, false);
+}
+
+void ShardedResourceTracker::didCreate(const IShaderLibrary* shaderLibrary) noexcept {
+  record(ResourceKind::ShaderLibrary, shaderLibrary, true);
+}
+
+void ShardedResourceTracker::willDelete(const IShaderLibrary* shaderLibrary) noexcept {
+  record(ResourceKind::ShaderLibrary, shaderLibrary, false);
+}
+
+void ShardedResourceTracker::didCreate(const IShaderModule* shaderModule) noexcept {
+  record(ResourceKind::ShaderModule, shaderModule, true);
+}
+
+void ShardedResourceTracker::willDelete(const IShaderModule* shaderModule) noexcept {
+  record(ResourceKind::ShaderModule, shaderModule, false);
+}
+
+void ShardedResourceTracker::didCreate(const IShaderStages* shaderStages) noexcept {
+  record(ResourceKind::ShaderStages, shaderStages, true);
+}
+
+void ShardedResourceTracker::willDelete(const IShaderStages* shaderStages) noexcept {
+  record(ResourceKind::ShaderStages, shaderStages, false);
+}
+
+void ShardedResourceTracker::pushTag(const char* tag) noexcept {
+  auto& shard = shardForThisThread();
+  std::lock_guard<std::mutex> guard(shard.mutex);
+  shard.tagStack.emplace_back(tag != nullptr ? tag : "");
+}
+
+void ShardedResourceTracker::popTag() noexcept {
+  auto& shard = shardForThisThread();
+  std::lock_guard<std::mutex> guard(shard.mutex);
+  if (IGL_VERIFY(!shard.tagStack.empty())) {
+    shard.tagStack.pop_back();
+  }
+}
+
+std::vector<ShardedResourceTracker::ResourceEvent> ShardedResourceTracker::drainEvents() noexcept {
+  std::vector<ResourceEvent> merged;
+  for (auto& shard : shards_) {
+    std::vector<ResourceEvent> events;
+    {
+      // Swap the buffer out so the shard lock is held only for the pointer exchange, not for
+      // the merge
+      std::lock_guard<std::mutex> guard(shard.mutex);
+      events.swap(shard.events);
+    }
+    merged.insert(merged.end(),
+                  std::make_move_iterator(events.begin()),
+                  std::make_move_iterator(events.end()));
+  }
+  std::sort(merged.begin(), merged.end(), [](const ResourceEvent& a, const ResourceEvent& b) {
+    return a.sequence < b.sequence;
+  });
+  return merged;
+}
+
+size_t ShardedResourceTracker::liveCount(ResourceKind kind) const noexcept {
+  const int64_t count = liveCounts_[static_cast<size_t>(kind)].load(std::memory_order_relaxed);
+  return count > 0 ? static_cast<size_t>(count) : 0;
+}
+
+} // namespace igl
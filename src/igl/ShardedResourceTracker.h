@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <igl/IResourceTracker.h>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace igl {
+
+/**
+ * @brief Built-in IResourceTracker implementation for multithreaded resource churn.
+ *
+ * Tracking calls append events to per-thread shards instead of funneling through one mutex: each
+ * thread is assigned its own shard on first use (round-robin), so in steady state a tracking call
+ * only takes an uncontended per-shard lock and loader threads never serialize against each other.
+ * Events are merged lazily: nothing is combined until the client drains, at which point the shard
+ * buffers are swapped out in batch and stitched back into creation order via a global sequence
+ * counter. Tag stacks are kept per shard, matching the thread that pushed them.
+ */
+class ShardedResourceTracker final : public IResourceTracker {
+ public:
+  /// What kind of resource an event refers to.
+  enum class ResourceKind : uint8_t {
+    Texture = 0,
+    Buffer,
+    Framebuffer,
+    SamplerState,
+    ShaderLibrary,
+    ShaderModule,
+    ShaderStages,
+  };
+  static constexpr size_t kResourceKindCount = 7;
+
+  /// One recorded create/delete. The resource pointer is an identity only; by the time an event
+  /// is drained the resource may already have been destroyed, so it must not be dereferenced.
+  struct ResourceEvent {
+    uint64_t sequence = 0;
+    const void* resource = nullptr;
+    ResourceKind kind = ResourceKind::Texture;
+    bool created = false;
+    std::string tag;
+  };
+
+  ShardedResourceTracker() noexcept = default;
+  ~ShardedResourceTracker() override = default;
+
+  void didCreate(const ITexture* texture) noexcept override;
+  void willDelete(const ITexture* texture) noexcept override;
+  void didCreate(const IBuffer* buffer) noexcept override;
+  void willDelete(const IBuffer* buffer) noexcept override;
+  void didCreate(const IFramebuffer* framebuffer) noexcept override;
+  void willDelete(const IFramebuffer* framebuffer) noexcept override;
+  void didCreate(const ISamplerState* samplerState) noexcept override;
+  void willDelete(const ISamplerState* samplerState) noexcept override;
+  void didCreate(const IShaderLibrary* shaderLibrary) noexcept override;
+  void willDelete(const IShaderLibrary* shaderLibrary) noexcept override;
+  void didCreate(const IShaderModule* shaderModule) noexcept override;
+  void willDelete(const IShaderModule* shaderModule) noexcept override;
+  void didCreate(const IShaderStages* shaderStages) noexcept override;
+  void willDelete(const IShaderStages* shaderStages) noexcept override;
+
+  void pushTag(const char* tag) noexcept override;
+  void popTag() noexcept override;
+
+  /**
+   * @brief Removes all buffered events and returns them merged into creation order.
+   * Safe to call from any thread while other threads keep tracking; events recorded concurrently
+   * with the drain land in the next one.
+   */
+  std::vector<ResourceEvent> drainEvents() noexcept;
+
+  /**
+   * @brief Number of resources of the given kind that were created but not yet deleted.
+   * Maintained with atomic counters, so reading it never blocks tracking calls.
+   */
+  size_t liveCount(ResourceKind kind) const noexcept;
+
+ private:
+  // One shard per loader thread up to kShardCount; threads beyond that share round-robin
+  static constexpr size_t kShardCount = 16;
+
+  struct Shard {
+    std::mutex mutex;
+    std::vector<ResourceEvent> events;
+    std::vector<std::string> tagStack;
+  };
+
+  Shard& shardForThisThread() noexcept;
+  void record(ResourceKind kind, const void* resource, bool created) noexcept;
+
+  std::array<Shard, kShardCount> shards_;
+  std::atomic<uint64_t> nextSequence_{0};
+  std::array<std::atomic<int64_t>, kResourceKindCount> liveCounts_{};
+};
+
+} // namespace igl
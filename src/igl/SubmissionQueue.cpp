@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <igl/SubmissionQueue.h>
+
+#include <algorithm>
+#include <igl/CommandBuffer.h>
+#include <vector>
+
+namespace igl {
+
+SubmissionQueue::~SubmissionQueue() {
+  // deposits that were never flushed are dropped, not submitted: destruction is not a safe point
+  // to talk to the queue (the owner may be tearing down the device)
+  Node* node = head_.exchange(nullptr, std::memory_order_acquire);
+  while (node != nullptr) {
+    Node* next = node->next;
+    delete node;
+    node = next;
+  }
+}
+
+void SubmissionQueue::enqueue(std::shared_ptr<ICommandBuffer> commandBuffer,
+                              uint64_t orderingKey) {
+  if (!IGL_VERIFY(commandBuffer)) {
+    return;
+  }
+
+  Node* node = new Node;
+  node->commandBuffer = std::move(commandBuffer);
+  node->orderingKey = orderingKey;
+  node->sequence = nextSequence_.fetch_add(1, std::memory_order_relaxed);
+  node->next = head_.load(std::memory_order_relaxed);
+  while (!head_.compare_exchange_weak(
+      node->next, node, std::memory_order_release, std::memory_order_relaxed)) {
+  }
+}
+
+SubmitHandle SubmissionQueue::flush(bool endOfFrame) {
+  Node* node = head_.exchange(nullptr, std::memory_order_acquire);
+  if (node == nullptr) {
+    return SubmitHandle{};
+  }
+
+  std::vector<Node*> nodes;
+  while (node != nullptr) {
+    nodes.push_back(node);
+    node = node->next;
+  }
+
+  std::sort(nodes.begin(), nodes.end(), [](const Node* a, const Node* b) {
+    return a->orderingKey != b->orderingKey ? a->orderingKey < b->orderingKey
+                                            : a->sequence < b->sequence;
+  });
+
+  std::vector<const ICommandBuffer*> commandBuffers;
+  commandBuffers.reserve(nodes.size());
+  for (const Node* n : nodes) {
+    commandBuffers.push_back(n->commandBuffer.get());
+  }
+
+  const SubmitHandle handle =
+      commandQueue_.submitBatch(commandBuffers.data(), commandBuffers.size(), endOfFrame);
+
+  // release the command buffers only after the batch has been handed to the queue
+  for (Node* n : nodes) {
+    delete n;
+  }
+
+  return handle;
+}
+
+} // namespace igl
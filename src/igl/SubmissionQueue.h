@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <igl/CommandQueue.h>
+#include <memory>
+
+namespace igl {
+
+/**
+ * @brief Lock-free multi-producer handoff between the threads that encode command buffers and
+ * the single thread that owns submission.
+ *
+ * ICommandQueue::submit() is not required to be thread-safe (the Vulkan implementation takes
+ * context locks), so engines that encode on worker threads and submit on a dedicated thread need
+ * a serialization point. Instead of guarding submit() with a mutex that every worker contends
+ * on, workers deposit finished command buffers here with enqueue() — a single compare-and-swap,
+ * wait-free except under contention on the same queue — and the submitting thread drains
+ * everything in one flush(), which hands the batch to ICommandQueue::submitBatch().
+ *
+ * Ordering: flush() submits buffers in ascending `orderingKey` order; buffers with the same key
+ * are submitted in the order their enqueue() calls completed. Producers that must order their
+ * work relative to other threads encode the dependency into the key (e.g. frame number * 1000 +
+ * pass index) instead of synchronizing externally.
+ *
+ * Threading contract: enqueue() may be called from any number of threads concurrently with each
+ * other and with flush(); flush() must only be called from one thread at a time — the thread
+ * that is allowed to use the underlying ICommandQueue. Each enqueue() makes one small node
+ * allocation, freed by the matching flush().
+ */
+class SubmissionQueue final {
+ public:
+  explicit SubmissionQueue(ICommandQueue& commandQueue) : commandQueue_(commandQueue) {}
+  ~SubmissionQueue();
+
+  SubmissionQueue(const SubmissionQueue&) = delete;
+  SubmissionQueue& operator=(const SubmissionQueue&) = delete;
+
+  /// Deposits a finished command buffer for submission; callable from any thread. The command
+  /// buffer is retained until it has been submitted by flush().
+  void enqueue(std::shared_ptr<ICommandBuffer> commandBuffer, uint64_t orderingKey);
+
+  /// Submits all deposited command buffers in ordering-key order with one submitBatch() call.
+  /// Must be called from the submitting thread only. Returns the handle of the batch, or 0 when
+  /// nothing was enqueued.
+  SubmitHandle flush(bool endOfFrame = false);
+
+  /// Returns true when no command buffer is waiting for submission. Like flush(), only
+  /// meaningful on the submitting thread: producers can race new deposits at any time.
+  [[nodiscard]] bool empty() const noexcept {
+    return head_.load(std::memory_order_acquire) == nullptr;
+  }
+
+ private:
+  struct Node {
+    std::shared_ptr<ICommandBuffer> commandBuffer;
+    uint64_t orderingKey = 0;
+    // global enqueue order; breaks ties between equal keys since the intrusive stack below
+    // yields nodes newest-first
+    uint64_t sequence = 0;
+    Node* next = nullptr;
+  };
+
+  ICommandQueue& commandQueue_;
+  // Treiber stack: producers push with a CAS loop, flush() takes the whole list with one
+  // exchange. The consumer never pops single nodes, so there is no ABA problem
+  std::atomic<Node*> head_{nullptr};
+  std::atomic<uint64_t> nextSequence_{0};
+};
+
+} // namespace igl
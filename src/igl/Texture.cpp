@@ -7,9 +7,12 @@
 
 #include <igl/Texture.h>
 
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <future>
 #include <igl/IGLSafeC.h>
+#include <thread>
 #include <utility>
 
 size_t std::hash<igl::TextureFormat>::operator()(igl::TextureFormat const& key) const {
@@ -18,6 +21,20 @@ size_t std::hash<igl::TextureFormat>::operator()(igl::TextureFormat const& key)
 
 namespace igl {
 
+namespace {
+
+// Returned by backends whose uploads complete synchronously (OpenGL, Metal) and by the default
+// uploadAsync() implementation, which falls back to the blocking upload() path.
+class CompletedUploadToken final : public ITextureUploadToken {
+ public:
+  [[nodiscard]] bool isCompleted() const final {
+    return true;
+  }
+  void wait() final {}
+};
+
+} // namespace
+
 TextureRangeDesc TextureRangeDesc::new1D(size_t x,
                                          size_t width,
                                          size_t mipLevel,
@@ -405,10 +422,11 @@ size_t TextureFormatProperties::getBytesPerLayer(TextureRangeDesc range,
 
 size_t TextureFormatProperties::getBytesPerRange(TextureRangeDesc range,
                                                  size_t bytesPerRow) const noexcept {
-  IGL_ASSERT(range.x % blockWidth == 0);
-  IGL_ASSERT(range.y % blockHeight == 0);
-  IGL_ASSERT(range.z % blockDepth == 0);
-  IGL_ASSERT(bytesPerRow == 0 || bytesPerRow == getBytesPerRow(range) || range.numMipLevels == 1);
+  IGL_ASSERT_HOT(range.x % blockWidth == 0);
+  IGL_ASSERT_HOT(range.y % blockHeight == 0);
+  IGL_ASSERT_HOT(range.z % blockDepth == 0);
+  IGL_ASSERT_HOT(bytesPerRow == 0 || bytesPerRow == getBytesPerRow(range) ||
+                 range.numMipLevels == 1);
 
   size_t bytes = 0;
   for (size_t i = 0; i < range.numMipLevels; ++i) {
@@ -439,26 +457,27 @@ size_t TextureFormatProperties::getSubRangeByteOffset(const TextureRangeDesc& ra
                                                       const TextureRangeDesc& subRange,
                                                       size_t bytesPerRow) const noexcept {
   // Ensure subRange's layer, face and mipLevel range is a subset of range's.
-  IGL_ASSERT(subRange.layer >= range.layer &&
-             (subRange.layer + subRange.numLayers) <= (range.layer + range.numLayers));
-  IGL_ASSERT(subRange.face >= range.face &&
-             (subRange.face + subRange.numFaces) <= (range.face + range.numFaces));
-  IGL_ASSERT(subRange.mipLevel >= range.mipLevel &&
-             (subRange.mipLevel + subRange.numMipLevels) <= (range.mipLevel + range.numMipLevels));
+  IGL_ASSERT_HOT(subRange.layer >= range.layer &&
+                 (subRange.layer + subRange.numLayers) <= (range.layer + range.numLayers));
+  IGL_ASSERT_HOT(subRange.face >= range.face &&
+                 (subRange.face + subRange.numFaces) <= (range.face + range.numFaces));
+  IGL_ASSERT_HOT(subRange.mipLevel >= range.mipLevel &&
+                 (subRange.mipLevel + subRange.numMipLevels) <=
+                     (range.mipLevel + range.numMipLevels));
 
   // Ensure subRange's dimensions are equal to the full dimensions of range's at subRange's first
   // mip level.
-  IGL_ASSERT(subRange.x == range.atMipLevel(subRange.mipLevel).x &&
-             subRange.width == range.atMipLevel(subRange.mipLevel).width);
-  IGL_ASSERT(subRange.y == range.atMipLevel(subRange.mipLevel).y &&
-             subRange.height == range.atMipLevel(subRange.mipLevel).height);
-  IGL_ASSERT(subRange.z == range.atMipLevel(subRange.mipLevel).z &&
-             subRange.depth == range.atMipLevel(subRange.mipLevel).depth);
+  IGL_ASSERT_HOT(subRange.x == range.atMipLevel(subRange.mipLevel).x &&
+                 subRange.width == range.atMipLevel(subRange.mipLevel).width);
+  IGL_ASSERT_HOT(subRange.y == range.atMipLevel(subRange.mipLevel).y &&
+                 subRange.height == range.atMipLevel(subRange.mipLevel).height);
+  IGL_ASSERT_HOT(subRange.z == range.atMipLevel(subRange.mipLevel).z &&
+                 subRange.depth == range.atMipLevel(subRange.mipLevel).depth);
 
   // Ensure bytes per row is either 0 OR subrange covers only the base mip level of range.
-  IGL_ASSERT(bytesPerRow == 0 ||
-             (subRange.mipLevel == range.mipLevel && subRange.numMipLevels == 1) ||
-             bytesPerRow == getBytesPerRow(subRange));
+  IGL_ASSERT_HOT(bytesPerRow == 0 ||
+                 (subRange.mipLevel == range.mipLevel && subRange.numMipLevels == 1) ||
+                 bytesPerRow == getBytesPerRow(subRange));
 
   size_t offset = 0;
   auto workingRange = range;
@@ -645,25 +664,67 @@ void ITexture::repackData(const TextureFormatProperties& properties,
     const auto repackedDataIncrement = repackedBytesPerRow == 0 ? rangeBytesPerRow
                                                                 : repackedBytesPerRow;
     const auto totalNumLayers = mipRange.numLayers * mipRange.numFaces * mipRange.depth;
-    for (size_t layer = 0; layer < totalNumLayers; ++layer) {
-      uint8_t* repackedDataPtr = repackedData;
-      const std::ptrdiff_t increment = flipVertical ? -repackedDataIncrement
-                                                    : repackedDataIncrement;
-      // Start at the end
-      if (flipVertical) {
-        repackedDataPtr += repackedDataIncrement * (mipRange.height - 1);
+    if (!flipVertical && originalDataIncrement == rangeBytesPerRow &&
+        repackedDataIncrement == rangeBytesPerRow) {
+      // Source and destination rows are tightly packed and in the same order, so the whole mip
+      // level is one contiguous block; copy it in one shot instead of row by row.
+      const auto mipLevelBytes = rangeBytesPerRow * mipRange.height * totalNumLayers;
+      checked_memcpy_robust(repackedData, mipLevelBytes, originalData, mipLevelBytes, mipLevelBytes);
+      repackedData += mipLevelBytes;
+      originalData += mipLevelBytes;
+      continue;
+    }
+    // Each slice (cube face, array layer or 3D depth slice) reads and writes a disjoint block, so
+    // slices can be repacked independently
+    const auto repackSlices = [=](size_t firstSlice, size_t numSlices) {
+      const uint8_t* src = originalData + firstSlice * originalDataIncrement * mipRange.height;
+      uint8_t* dst = repackedData + firstSlice * repackedDataIncrement * mipRange.height;
+      for (size_t layer = 0; layer < numSlices; ++layer) {
+        uint8_t* repackedDataPtr = dst;
+        const std::ptrdiff_t increment = flipVertical ? -repackedDataIncrement
+                                                      : repackedDataIncrement;
+        // Start at the end
+        if (flipVertical) {
+          repackedDataPtr += repackedDataIncrement * (mipRange.height - 1);
+        }
+        for (size_t y = 0; y < mipRange.height; ++y) {
+          checked_memcpy_robust(repackedDataPtr,
+                                repackedDataIncrement,
+                                src,
+                                originalDataIncrement,
+                                rangeBytesPerRow);
+          repackedDataPtr += increment;
+          src += originalDataIncrement;
+        }
+        dst += repackedDataIncrement * mipRange.height;
+      }
+    };
+
+    // Spread large multi-slice repacks (environment probes, texture arrays) across threads; small
+    // ones stay on the calling thread to avoid the thread launch overhead
+    constexpr size_t kMinBytesPerRepackThread = 1u << 20;
+    const size_t mipLevelBytes = repackedDataIncrement * mipRange.height * totalNumLayers;
+    const size_t hwThreads = std::max<size_t>(1, std::thread::hardware_concurrency());
+    const size_t numThreads = std::min(
+        {static_cast<size_t>(totalNumLayers),
+         std::max<size_t>(1, mipLevelBytes / kMinBytesPerRepackThread),
+         hwThreads});
+    if (numThreads > 1) {
+      std::vector<std::future<void>> tasks;
+      tasks.reserve(numThreads);
+      const size_t slicesPerThread = (totalNumLayers + numThreads - 1) / numThreads;
+      for (size_t firstSlice = 0; firstSlice < totalNumLayers; firstSlice += slicesPerThread) {
+        const size_t numSlices = std::min<size_t>(slicesPerThread, totalNumLayers - firstSlice);
+        tasks.push_back(std::async(std::launch::async, repackSlices, firstSlice, numSlices));
       }
-      for (size_t y = 0; y < mipRange.height; ++y) {
-        checked_memcpy_robust(repackedDataPtr,
-                              repackedDataIncrement,
-                              originalData,
-                              originalDataIncrement,
-                              rangeBytesPerRow);
-        repackedDataPtr += increment;
-        originalData += originalDataIncrement;
+      for (auto& task : tasks) {
+        task.wait();
       }
-      repackedData += repackedDataIncrement * mipRange.height;
+    } else {
+      repackSlices(0, totalNumLayers);
     }
+    originalData += originalDataIncrement * mipRange.height * totalNumLayers;
+    repackedData += repackedDataIncrement * mipRange.height * totalNumLayers;
   }
 }
 
@@ -683,41 +744,52 @@ Result ITexture::upload(const TextureRangeDesc& range,
   }
 
   const auto type = getType();
-  const auto result = validateRange(range);
-  if (!result.isOk()) {
-    return result;
-  }
 
-  if (IGL_UNEXPECTED(type != TextureType::TwoD && type != TextureType::TwoDArray &&
-                     type != TextureType::Cube && type != TextureType::ThreeD)) {
-    return Result{Result::Code::InvalidOperation, "Unknown texture type"};
-  }
-  if (IGL_UNEXPECTED(range.face > 0 && type != TextureType::Cube)) {
-    return Result(Result::Code::Unsupported, "face must be 0.");
-  }
+  // Texture dimensions, type and usage are immutable after creation, so a repeat upload with the
+  // same range and bytesPerRow as the previous one is known to be valid and skips re-validation
+  if (!uploadPlan_.valid || uploadPlan_.bytesPerRow != bytesPerRow ||
+      !(uploadPlan_.range == range)) {
+    const auto result = validateRange(range);
+    if (!result.isOk()) {
+      return result;
+    }
 
-  const auto formatBytesPerRow = properties_.getBytesPerRow(range);
-  if (bytesPerRow > 0) {
-    if (IGL_UNEXPECTED(bytesPerRow < formatBytesPerRow)) {
-      return Result(Result::Code::ArgumentInvalid, "bytesPerRow too small.");
+    if (IGL_UNEXPECTED(type != TextureType::TwoD && type != TextureType::TwoDArray &&
+                       type != TextureType::Cube && type != TextureType::ThreeD)) {
+      return Result{Result::Code::InvalidOperation, "Unknown texture type"};
     }
-    if (IGL_UNEXPECTED(range.numMipLevels > 1 && bytesPerRow != formatBytesPerRow)) {
-      return Result(Result::Code::ArgumentInvalid,
-                    "bytesPerRow MUST be 0 when uploading multiple mip levels.");
+    if (IGL_UNEXPECTED(range.face > 0 && type != TextureType::Cube)) {
+      return Result(Result::Code::Unsupported, "face must be 0.");
     }
-  }
 
-  const bool isSampledOrStorage = (getUsage() & (TextureDesc::TextureUsageBits::Sampled |
-                                                 TextureDesc::TextureUsageBits::Storage)) != 0;
-  if (!IGL_VERIFY(isSampledOrStorage)) {
-    return Result(Result::Code::Unsupported,
-                  "Texture must support either sampled or storage usage.");
+    const auto formatBytesPerRow = properties_.getBytesPerRow(range);
+    if (bytesPerRow > 0) {
+      if (IGL_UNEXPECTED(bytesPerRow < formatBytesPerRow)) {
+        return Result(Result::Code::ArgumentInvalid, "bytesPerRow too small.");
+      }
+      if (IGL_UNEXPECTED(range.numMipLevels > 1 && bytesPerRow != formatBytesPerRow)) {
+        return Result(Result::Code::ArgumentInvalid,
+                      "bytesPerRow MUST be 0 when uploading multiple mip levels.");
+      }
+    }
+
+    const bool isSampledOrStorage = (getUsage() & (TextureDesc::TextureUsageBits::Sampled |
+                                                   TextureDesc::TextureUsageBits::Storage)) != 0;
+    if (!IGL_VERIFY(isSampledOrStorage)) {
+      return Result(Result::Code::Unsupported,
+                    "Texture must support either sampled or storage usage.");
+    }
+
+    uploadPlan_.range = range;
+    uploadPlan_.bytesPerRow = bytesPerRow;
+    uploadPlan_.needsRepack = needsRepacking(range, bytesPerRow);
+    uploadPlan_.valid = true;
   }
 
   std::unique_ptr<uint8_t[]> repackedData = nullptr;
 
   // Repack data if necessary for upload
-  if (data != nullptr && needsRepacking(range, bytesPerRow)) {
+  if (data != nullptr && uploadPlan_.needsRepack) {
     repackedData = std::make_unique<uint8_t[]>(properties_.getBytesPerRange(range));
     ITexture::repackData(
         properties_, range, static_cast<const uint8_t*>(data), bytesPerRow, repackedData.get(), 0);
@@ -728,4 +800,30 @@ Result ITexture::upload(const TextureRangeDesc& range,
   return uploadInternal(type, range, data, bytesPerRow);
 }
 
+std::shared_ptr<ITextureUploadToken> ITexture::uploadAsync(
+    const TextureUploadDesc* IGL_NONNULL uploads,
+    size_t count,
+    Result* IGL_NULLABLE outResult) const {
+  // Default implementation: uploads are performed through the synchronous upload() path, so the
+  // data is visible by the time we return and an already-completed token suffices.
+  Result result;
+  for (size_t i = 0; i < count; ++i) {
+    const auto uploadResult = upload(uploads[i].range, uploads[i].data, uploads[i].bytesPerRow);
+    if (!uploadResult.isOk() && result.isOk()) {
+      result = uploadResult;
+    }
+  }
+  Result::setResult(outResult, result);
+  if (!result.isOk()) {
+    return nullptr;
+  }
+  return std::make_shared<CompletedUploadToken>();
+}
+
+std::shared_ptr<ITexture> ITexture::createView(const TextureViewDesc& /*desc*/,
+                                               Result* IGL_NULLABLE outResult) {
+  Result::setResult(outResult, Result::Code::Unimplemented, "Texture views are not supported.");
+  return nullptr;
+}
+
 } // namespace igl
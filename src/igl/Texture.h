@@ -444,11 +444,21 @@ struct TextureDesc {
    *  Sampled - Can be used as read-only texture in vertex/fragment shaders
    *  Storage - Can be used as read/write storage texture in vertex/fragment/compute shaders
    *  Attachment - Can be bound for render target
+   *  Sparse - No memory is committed at creation; the application binds memory for tile regions
+   *           on demand (sparse/virtual textures). Currently implemented by the Vulkan backend
+   *           only, where residency is managed through igl::vulkan::Texture
+   *  Shareable - Memory is allocated as an external memory object that can be exported to and
+   *              imported by other devices or processes, so multi-GPU setups share one copy of
+   *              the asset. Currently implemented by the Vulkan backend only; see
+   *              igl::vulkan::PlatformDevice for the export/import entry points. Requires
+   *              DeviceFeatures::ExternalMemoryObjects
    */
   enum TextureUsageBits : uint8_t {
     Sampled = 1 << 0,
     Storage = 1 << 1,
     Attachment = 1 << 2,
+    Sparse = 1 << 3,
+    Shareable = 1 << 4,
   };
 
   using TextureUsage = uint8_t;
@@ -632,6 +642,62 @@ struct TextureDesc {
   static uint32_t calcNumMipLevels(size_t width, size_t height, size_t depth = 1);
 };
 
+/**
+ * @brief Describes one range of a batched asynchronous upload.
+ * @see ITexture::uploadAsync
+ */
+struct TextureUploadDesc {
+  /** @brief The offset & dimensions of this range; same semantics as ITexture::upload. */
+  TextureRangeDesc range;
+  /** @brief The pointer to the data. May be nullptr to force initialization without data. */
+  const void* IGL_NULLABLE data = nullptr;
+  /** @brief Number of bytes per row. If 0, it will be autocalculated assuming no padding. */
+  size_t bytesPerRow = 0;
+};
+
+/**
+ * @brief Completion token for an asynchronous texture upload.
+ *
+ * Poll isCompleted() to find out when the uploaded data is visible to the GPU (e.g. to swap a
+ * streamed texture's mip bias) without stalling; wait() blocks and is intended for shutdown
+ * paths. Tokens must not outlive the IDevice that created the texture.
+ */
+class ITextureUploadToken {
+ public:
+  virtual ~ITextureUploadToken() = default;
+
+  /** @brief Returns true once the GPU can see the uploaded data. Never blocks. */
+  [[nodiscard]] virtual bool isCompleted() const = 0;
+
+  /** @brief Blocks until the upload has completed. */
+  virtual void wait() = 0;
+};
+
+/**
+ * @brief Describes a view of an existing texture created by ITexture::createView.
+ *
+ * Views reinterpret the parent's storage without duplicating memory: a different (compatible)
+ * format such as the sRGB or linear variant, a sub-range of mip levels, or a sub-range of array
+ * layers. Fields left at their defaults inherit from the parent.
+ */
+struct TextureViewDesc {
+  /** @brief The view's format. Invalid keeps the parent's format. Backends do not validate
+   * compatibility beyond what the underlying API enforces; stick to variants of the same texel
+   * size, e.g. RGBA_SRGB over RGBA_UNorm8. */
+  TextureFormat format = TextureFormat::Invalid;
+  /** @brief The first mip level visible through the view. */
+  uint32_t mipLevel = 0;
+  /** @brief Number of mip levels in the view; 0 means all levels starting at mipLevel. */
+  uint32_t numMipLevels = 0;
+  /** @brief The first array layer visible through the view. */
+  uint32_t layer = 0;
+  /** @brief Number of array layers in the view; 0 means all layers starting at layer. A
+   * single-layer view of an array texture becomes a TwoD texture. */
+  uint32_t numLayers = 0;
+  /** @brief Identifier used for debugging. */
+  std::string debugName;
+};
+
 /**
  * @brief Interface class for all textures.
  * This should only be used for the purpose of getting information about the texture using the
@@ -677,6 +743,40 @@ class ITexture : public ITrackedResource<ITexture> {
                 const void* IGL_NULLABLE data,
                 size_t bytesPerRow = 0) const;
 
+  /**
+   * @brief Uploads a batch of ranges in order and returns a completion token signaled once the
+   * data is visible to the GPU.
+   *
+   * Unlike upload(), whose completion semantics are backend-specific, the returned token is
+   * portable: backends with synchronous uploads (OpenGL, Metal) return an already-completed
+   * token, while Vulkan tracks the staging submission covering the batch.
+   *
+   * @param uploads   Pointer to count upload descriptors, processed in order.
+   * @param count     Number of upload descriptors.
+   * @param outResult The result of the batched upload; the first failure wins.
+   * @return Completion token. nullptr only when the upload failed outright.
+   */
+  [[nodiscard]] virtual std::shared_ptr<ITextureUploadToken> uploadAsync(
+      const TextureUploadDesc* IGL_NONNULL uploads,
+      size_t count,
+      Result* IGL_NULLABLE outResult = nullptr) const;
+
+  /**
+   * @brief Creates a view that reinterprets this texture's storage without copying it.
+   *
+   * The view is a full ITexture usable as an attachment and for sampled bindings; it keeps the
+   * parent's storage alive for its own lifetime and writes through either object are visible
+   * through the other. Check DeviceFeatures::TextureViews before relying on views; the default
+   * implementation returns Unimplemented.
+   *
+   * @param desc      Describes the reinterpretation; see TextureViewDesc.
+   * @param outResult The result of the operation.
+   * @return The view, or nullptr on failure.
+   */
+  [[nodiscard]] virtual std::shared_ptr<ITexture> createView(
+      const TextureViewDesc& desc,
+      Result* IGL_NULLABLE outResult = nullptr);
+
   // Texture Accessor Methods
   /**
    * @brief Returns the aspect ratio (width / height) of the texture.
@@ -907,6 +1007,22 @@ class ITexture : public ITrackedResource<ITexture> {
   }
 
   const TextureFormatProperties properties_;
+
+ private:
+  /**
+   * @brief Memoized result of the parameter validation performed by upload().
+   *
+   * Workloads such as UI atlases re-upload the same sub-rect shape hundreds of times per frame;
+   * repeat uploads with identical range and bytesPerRow skip re-validation and whether the data
+   * needs repacking, and dispatch straight to the data path.
+   */
+  struct UploadPlan {
+    TextureRangeDesc range;
+    size_t bytesPerRow = 0;
+    bool needsRepack = false;
+    bool valid = false;
+  };
+  mutable UploadPlan uploadPlan_;
 };
 
 /**
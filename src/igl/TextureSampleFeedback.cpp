@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <igl/TextureSampleFeedback.h>
+
+#include <algorithm>
+
+namespace igl {
+
+uint32_t TextureSampleFeedback::registerTexture(const ITexture* texture) {
+  if (!IGL_VERIFY(texture)) {
+    return kInvalidSlot;
+  }
+
+  std::lock_guard<std::mutex> guard(mutex_);
+
+  const auto it = slots_.find(texture);
+  if (it != slots_.end()) {
+    return it->second;
+  }
+
+  uint32_t slot;
+  if (!freeSlots_.empty()) {
+    slot = freeSlots_.back();
+    freeSlots_.pop_back();
+  } else {
+    slot = static_cast<uint32_t>(slots_.size());
+    const size_t numWords = (slot / 64) + 1;
+    if (current_.size() < numWords) {
+      current_.resize(numWords, 0);
+      last_.resize(numWords, 0);
+    }
+  }
+  slots_[texture] = slot;
+  return slot;
+}
+
+void TextureSampleFeedback::unregisterTexture(const ITexture* texture) {
+  std::lock_guard<std::mutex> guard(mutex_);
+
+  const auto it = slots_.find(texture);
+  if (it == slots_.end()) {
+    return;
+  }
+  const uint32_t slot = it->second;
+  slots_.erase(it);
+  freeSlots_.push_back(slot);
+  // clear stale bits so a texture reusing the slot does not inherit them
+  current_[slot / 64] &= ~(1ull << (slot % 64));
+  last_[slot / 64] &= ~(1ull << (slot % 64));
+}
+
+uint32_t TextureSampleFeedback::slotOf(const ITexture* texture) const {
+  std::lock_guard<std::mutex> guard(mutex_);
+
+  const auto it = slots_.find(texture);
+  return it != slots_.end() ? it->second : kInvalidSlot;
+}
+
+void TextureSampleFeedback::recordSample(const ITexture* texture) {
+  if (texture == nullptr) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> guard(mutex_);
+
+  const auto it = slots_.find(texture);
+  if (it == slots_.end()) {
+    return;
+  }
+  current_[it->second / 64] |= 1ull << (it->second % 64);
+}
+
+void TextureSampleFeedback::endFrame() {
+  std::lock_guard<std::mutex> guard(mutex_);
+
+  last_ = current_;
+  std::fill(current_.begin(), current_.end(), 0);
+}
+
+std::vector<uint64_t> TextureSampleFeedback::sampledLastFrame() const {
+  std::lock_guard<std::mutex> guard(mutex_);
+
+  return last_;
+}
+
+bool TextureSampleFeedback::wasSampledLastFrame(const ITexture* texture) const {
+  std::lock_guard<std::mutex> guard(mutex_);
+
+  const auto it = slots_.find(texture);
+  if (it == slots_.end()) {
+    return false;
+  }
+  return (last_[it->second / 64] & (1ull << (it->second % 64))) != 0;
+}
+
+} // namespace igl
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <igl/Common.h>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace igl {
+
+class ITexture;
+
+/**
+ * @brief Records which textures were actually bound for sampling each frame, so a texture
+ * streamer can evict mips of textures nothing sampled instead of guessing from camera distance.
+ *
+ * The streamer registers the textures it manages; each gets a stable slot index. Backends report
+ * texture binds to the recorder as commands are encoded (currently the Vulkan backend; install
+ * via IDevice::setTextureSampleFeedback()). At a frame boundary the streamer calls endFrame()
+ * and reads sampledLastFrame() — one bit per slot, set when the texture was bound for sampling
+ * during the finished frame. Binds of unregistered textures are ignored.
+ *
+ * Feedback is bind-granular: a bound texture counts as sampled whether or not a draw actually
+ * fetched from it, and per-mip information is not available (none of the backends expose
+ * hardware sampler feedback). That is conservative in the safe direction — a set bit may be a
+ * false positive, a clear bit never is.
+ *
+ * Thread-safe: binds are recorded from encoding threads while the streamer registers textures
+ * and flips frames elsewhere. The per-bind cost is one mutex acquisition and one hash lookup;
+ * keep registration limited to the streamed set.
+ */
+class TextureSampleFeedback {
+ public:
+  static constexpr uint32_t kInvalidSlot = 0xFFFFFFFF;
+
+  /**
+   * @brief Registers a texture for feedback and returns its slot index. Registering an already
+   * registered texture returns its existing slot. Slots of unregistered textures are reused.
+   */
+  uint32_t registerTexture(const ITexture* IGL_NONNULL texture);
+
+  /**
+   * @brief Stops tracking a texture; call before the texture is destroyed, since the recorder
+   * does not keep it alive.
+   */
+  void unregisterTexture(const ITexture* IGL_NONNULL texture);
+
+  /**
+   * @brief Returns the slot assigned to a registered texture, or kInvalidSlot.
+   */
+  [[nodiscard]] uint32_t slotOf(const ITexture* IGL_NONNULL texture) const;
+
+  /**
+   * @brief Marks a texture as sampled in the current frame; called by backends at bind time.
+   * Unregistered textures are ignored.
+   */
+  void recordSample(const ITexture* IGL_NULLABLE texture);
+
+  /**
+   * @brief Ends the current frame: the bits accumulated since the previous endFrame() become
+   * sampledLastFrame() and the current-frame bits are cleared.
+   */
+  void endFrame();
+
+  /**
+   * @brief Per-slot bitset of the last finished frame; bit (slot % 64) of word (slot / 64) is
+   * set when the slot's texture was bound for sampling. The returned copy is stable while
+   * encoding continues.
+   */
+  [[nodiscard]] std::vector<uint64_t> sampledLastFrame() const;
+
+  /**
+   * @brief Returns true when the texture was bound for sampling during the last finished frame.
+   * Unregistered textures report false.
+   */
+  [[nodiscard]] bool wasSampledLastFrame(const ITexture* IGL_NONNULL texture) const;
+
+ private:
+  mutable std::mutex mutex_;
+  std::unordered_map<const ITexture*, uint32_t> slots_;
+  std::vector<uint32_t> freeSlots_;
+  // one bit per slot; current_ accumulates the frame being encoded, last_ is the finished frame
+  std::vector<uint64_t> current_;
+  std::vector<uint64_t> last_;
+};
+
+} // namespace igl
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <igl/TransientResourcePool.h>
+
+#include <igl/Device.h>
+
+namespace igl {
+
+namespace {
+
+// Pooling matches on every property that affects the allocation; debug names only label
+// individual passes and would defeat reuse if compared.
+bool isCompatible(const TextureDesc& a, const TextureDesc& b) {
+  return a.type == b.type && a.format == b.format && a.width == b.width && a.height == b.height &&
+         a.depth == b.depth && a.numLayers == b.numLayers && a.numSamples == b.numSamples &&
+         a.usage == b.usage && a.numMipLevels == b.numMipLevels && a.storage == b.storage;
+}
+
+bool isCompatible(const BufferDesc& a, const BufferDesc& b) {
+  return a.length == b.length && a.storage == b.storage && a.hint == b.hint && a.type == b.type &&
+         a.placement == b.placement;
+}
+
+} // namespace
+
+TransientResourcePool::TransientResourcePool(IDevice& device, uint32_t framesUntilEviction) :
+  device_(device), framesUntilEviction_(framesUntilEviction) {
+  IGL_ASSERT(framesUntilEviction > 0);
+}
+
+std::shared_ptr<ITexture> TransientResourcePool::acquireTexture(const TextureDesc& desc,
+                                                                Result* IGL_NULLABLE outResult) {
+  for (auto& entry : textures_) {
+    // use_count() == 1 means every external reference has been dropped; passes execute in
+    // submission order, so the resource can be handed out again within the same frame
+    if (entry.texture.use_count() == 1 && isCompatible(entry.desc, desc)) {
+      entry.lastUsedFrame = frameIndex_;
+      Result::setOk(outResult);
+      return entry.texture;
+    }
+  }
+
+  auto texture = device_.createTexture(desc, outResult);
+  if (!texture) {
+    return nullptr;
+  }
+  textures_.push_back({desc, texture, frameIndex_});
+  return texture;
+}
+
+std::shared_ptr<IBuffer> TransientResourcePool::acquireBuffer(const BufferDesc& desc,
+                                                              Result* IGL_NULLABLE outResult) {
+  if (IGL_UNEXPECTED(desc.data != nullptr)) {
+    Result::setResult(outResult,
+                      Result::Code::ArgumentInvalid,
+                      "Transient buffers cannot carry creation-time data");
+    return nullptr;
+  }
+
+  for (auto& entry : buffers_) {
+    if (entry.buffer.use_count() == 1 && isCompatible(entry.desc, desc)) {
+      entry.lastUsedFrame = frameIndex_;
+      Result::setOk(outResult);
+      return entry.buffer;
+    }
+  }
+
+  auto buffer = device_.createBuffer(desc, outResult);
+  if (!buffer) {
+    return nullptr;
+  }
+  buffers_.push_back({desc, std::move(buffer), frameIndex_});
+  return buffers_.back().buffer;
+}
+
+void TransientResourcePool::endFrame() {
+  frameIndex_++;
+
+  const auto isStale = [this](uint64_t lastUsedFrame, long useCount) {
+    return useCount == 1 && frameIndex_ - lastUsedFrame >= framesUntilEviction_;
+  };
+
+  for (size_t i = 0; i < textures_.size();) {
+    if (isStale(textures_[i].lastUsedFrame, textures_[i].texture.use_count())) {
+      textures_[i] = std::move(textures_.back());
+      textures_.pop_back();
+    } else {
+      i++;
+    }
+  }
+  for (size_t i = 0; i < buffers_.size();) {
+    if (isStale(buffers_[i].lastUsedFrame, buffers_[i].buffer.use_count())) {
+      buffers_[i] = std::move(buffers_.back());
+      buffers_.pop_back();
+    } else {
+      i++;
+    }
+  }
+}
+
+void TransientResourcePool::purge() {
+  for (size_t i = 0; i < textures_.size();) {
+    if (textures_[i].texture.use_count() == 1) {
+      textures_[i] = std::move(textures_.back());
+      textures_.pop_back();
+    } else {
+      i++;
+    }
+  }
+  for (size_t i = 0; i < buffers_.size();) {
+    if (buffers_[i].buffer.use_count() == 1) {
+      buffers_[i] = std::move(buffers_.back());
+      buffers_.pop_back();
+    } else {
+      i++;
+    }
+  }
+}
+
+} // namespace igl
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <igl/Buffer.h>
+#include <igl/Common.h>
+#include <igl/Texture.h>
+
+#include <memory>
+#include <vector>
+
+namespace igl {
+
+class IDevice;
+
+/// @brief Recycles short-lived render targets and scratch buffers across passes and frames.
+///
+/// Post-processing chains typically create their intermediate attachments once and keep them
+/// resident forever, while creating them per frame through IDevice::createTexture() pays a full
+/// allocation every time. This pool sits in between: acquire a resource matching a desc for the
+/// current frame, drop the returned shared_ptr when the pass that consumes it has been encoded,
+/// and call endFrame() once per frame. Released resources are handed out again to later passes in
+/// the same frame — command buffers execute in submission order, so reusing an attachment between
+/// non-overlapping passes is safe without extra synchronization — and resources that go unused
+/// for a few consecutive frames are destroyed. True memory aliasing of overlapping lifetimes
+/// (VMA aliasing, MTLHeap placement) is a backend-level follow-up; plain reuse already collapses
+/// one allocation per pass into one per concurrently-live desc.
+///
+/// The pool is not thread-safe; use it from the thread that records the frame.
+class TransientResourcePool {
+ public:
+  /// @brief Constructs a pool on top of `device`, which must outlive the pool.
+  /// @param framesUntilEviction resources unused for this many consecutive frames are destroyed.
+  /// Should cover the swapchain depth so resources are not destroyed while the GPU reads them.
+  explicit TransientResourcePool(IDevice& device, uint32_t framesUntilEviction = 3);
+
+  TransientResourcePool(const TransientResourcePool&) = delete;
+  TransientResourcePool& operator=(const TransientResourcePool&) = delete;
+
+  /// @brief Returns a texture matching `desc`, reusing a pooled one when available and creating
+  /// it through the device otherwise. Hold the returned pointer only as long as the pass needs
+  /// it; once every external reference is gone the texture becomes available to later acquires.
+  /// Contents are undefined — transient targets are expected to be fully written before being
+  /// read.
+  std::shared_ptr<ITexture> acquireTexture(const TextureDesc& desc,
+                                           Result* IGL_NULLABLE outResult = nullptr);
+
+  /// @brief Returns a buffer matching `desc`, with the same reuse semantics as acquireTexture().
+  /// `desc.data` must be nullptr: transient buffers are recycled, so creation-time upload would
+  /// only reach the first frame.
+  std::shared_ptr<IBuffer> acquireBuffer(const BufferDesc& desc,
+                                         Result* IGL_NULLABLE outResult = nullptr);
+
+  /// @brief Marks the end of the frame: released resources become reusable by the next frame and
+  /// resources unused for `framesUntilEviction` frames are destroyed. Call once per frame, after
+  /// the frame's command buffers have been submitted.
+  void endFrame();
+
+  /// @brief Destroys every pooled resource that is not externally referenced. Useful on memory
+  /// pressure or when tearing down a rendering path.
+  void purge();
+
+  /// @brief Returns the number of textures currently held by the pool, both in use and idle.
+  [[nodiscard]] size_t getTextureCount() const noexcept {
+    return textures_.size();
+  }
+
+  /// @brief Returns the number of buffers currently held by the pool, both in use and idle.
+  [[nodiscard]] size_t getBufferCount() const noexcept {
+    return buffers_.size();
+  }
+
+ private:
+  struct TextureEntry {
+    TextureDesc desc;
+    std::shared_ptr<ITexture> texture;
+    uint64_t lastUsedFrame = 0;
+  };
+
+  struct BufferEntry {
+    BufferDesc desc;
+    std::shared_ptr<IBuffer> buffer;
+    uint64_t lastUsedFrame = 0;
+  };
+
+  IDevice& device_;
+  const uint32_t framesUntilEviction_;
+  uint64_t frameIndex_ = 0;
+
+  std::vector<TextureEntry> textures_;
+  std::vector<BufferEntry> buffers_;
+};
+
+} // namespace igl
@@ -0,0 +1,317 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <igl/VertexPulling.h>
+
+#include <sstream>
+
+namespace igl {
+namespace {
+
+// how the components of a format are packed and what they decode to
+enum class ComponentType {
+  Float32, // one word per component, bit-cast
+  Float16, // two components per word, unpackHalf2x16
+  SInt32,
+  UInt32,
+  SInt8,
+  UInt8,
+  SInt16,
+  UInt16,
+  SNorm8,
+  UNorm8,
+  SNorm16,
+  UNorm16,
+  Int2_10_10_10, // one word, decoded as signed-normalized vec4
+};
+
+struct FormatTraits {
+  ComponentType type;
+  uint32_t numComponents;
+};
+
+FormatTraits formatTraits(VertexAttributeFormat format) {
+  switch (format) {
+  case VertexAttributeFormat::Float1:
+  case VertexAttributeFormat::Float2:
+  case VertexAttributeFormat::Float3:
+  case VertexAttributeFormat::Float4:
+    return {ComponentType::Float32,
+            1 + static_cast<uint32_t>(format) -
+                static_cast<uint32_t>(VertexAttributeFormat::Float1)};
+  case VertexAttributeFormat::Byte1:
+  case VertexAttributeFormat::Byte2:
+  case VertexAttributeFormat::Byte3:
+  case VertexAttributeFormat::Byte4:
+    return {ComponentType::SInt8,
+            1 + static_cast<uint32_t>(format) -
+                static_cast<uint32_t>(VertexAttributeFormat::Byte1)};
+  case VertexAttributeFormat::UByte1:
+  case VertexAttributeFormat::UByte2:
+  case VertexAttributeFormat::UByte3:
+  case VertexAttributeFormat::UByte4:
+    return {ComponentType::UInt8,
+            1 + static_cast<uint32_t>(format) -
+                static_cast<uint32_t>(VertexAttributeFormat::UByte1)};
+  case VertexAttributeFormat::Short1:
+  case VertexAttributeFormat::Short2:
+  case VertexAttributeFormat::Short3:
+  case VertexAttributeFormat::Short4:
+    return {ComponentType::SInt16,
+            1 + static_cast<uint32_t>(format) -
+                static_cast<uint32_t>(VertexAttributeFormat::Short1)};
+  case VertexAttributeFormat::UShort1:
+  case VertexAttributeFormat::UShort2:
+  case VertexAttributeFormat::UShort3:
+  case VertexAttributeFormat::UShort4:
+    return {ComponentType::UInt16,
+            1 + static_cast<uint32_t>(format) -
+                static_cast<uint32_t>(VertexAttributeFormat::UShort1)};
+  case VertexAttributeFormat::Byte1Norm:
+  case VertexAttributeFormat::Byte2Norm:
+  case VertexAttributeFormat::Byte3Norm:
+  case VertexAttributeFormat::Byte4Norm:
+    return {ComponentType::SNorm8,
+            1 + static_cast<uint32_t>(format) -
+                static_cast<uint32_t>(VertexAttributeFormat::Byte1Norm)};
+  case VertexAttributeFormat::UByte1Norm:
+  case VertexAttributeFormat::UByte2Norm:
+  case VertexAttributeFormat::UByte3Norm:
+  case VertexAttributeFormat::UByte4Norm:
+    return {ComponentType::UNorm8,
+            1 + static_cast<uint32_t>(format) -
+                static_cast<uint32_t>(VertexAttributeFormat::UByte1Norm)};
+  case VertexAttributeFormat::Short1Norm:
+  case VertexAttributeFormat::Short2Norm:
+  case VertexAttributeFormat::Short3Norm:
+  case VertexAttributeFormat::Short4Norm:
+    return {ComponentType::SNorm16,
+            1 + static_cast<uint32_t>(format) -
+                static_cast<uint32_t>(VertexAttributeFormat::Short1Norm)};
+  case VertexAttributeFormat::UShort1Norm:
+  case VertexAttributeFormat::UShort2Norm:
+  case VertexAttributeFormat::UShort3Norm:
+  case VertexAttributeFormat::UShort4Norm:
+    return {ComponentType::UNorm16,
+            1 + static_cast<uint32_t>(format) -
+                static_cast<uint32_t>(VertexAttributeFormat::UShort1Norm)};
+  case VertexAttributeFormat::Int1:
+  case VertexAttributeFormat::Int2:
+  case VertexAttributeFormat::Int3:
+  case VertexAttributeFormat::Int4:
+    return {ComponentType::SInt32,
+            1 + static_cast<uint32_t>(format) -
+                static_cast<uint32_t>(VertexAttributeFormat::Int1)};
+  case VertexAttributeFormat::UInt1:
+  case VertexAttributeFormat::UInt2:
+  case VertexAttributeFormat::UInt3:
+  case VertexAttributeFormat::UInt4:
+    return {ComponentType::UInt32,
+            1 + static_cast<uint32_t>(format) -
+                static_cast<uint32_t>(VertexAttributeFormat::UInt1)};
+  case VertexAttributeFormat::HalfFloat1:
+  case VertexAttributeFormat::HalfFloat2:
+  case VertexAttributeFormat::HalfFloat3:
+  case VertexAttributeFormat::HalfFloat4:
+    return {ComponentType::Float16,
+            1 + static_cast<uint32_t>(format) -
+                static_cast<uint32_t>(VertexAttributeFormat::HalfFloat1)};
+  case VertexAttributeFormat::Int_2_10_10_10_REV:
+    return {ComponentType::Int2_10_10_10, 4};
+  }
+  IGL_UNREACHABLE_RETURN(FormatTraits({ComponentType::Float32, 1}));
+}
+
+const char* glslTypeName(ComponentType type, uint32_t numComponents) {
+  const bool isSignedInt = type == ComponentType::SInt32 || type == ComponentType::SInt8 ||
+                           type == ComponentType::SInt16;
+  const bool isUnsignedInt = type == ComponentType::UInt32 || type == ComponentType::UInt8 ||
+                             type == ComponentType::UInt16;
+  static const char* kFloatTypes[] = {"float", "vec2", "vec3", "vec4"};
+  static const char* kSIntTypes[] = {"int", "ivec2", "ivec3", "ivec4"};
+  static const char* kUIntTypes[] = {"uint", "uvec2", "uvec3", "uvec4"};
+  if (isSignedInt) {
+    return kSIntTypes[numComponents - 1];
+  }
+  if (isUnsignedInt) {
+    return kUIntTypes[numComponents - 1];
+  }
+  return kFloatTypes[numComponents - 1];
+}
+
+// GLSL expression decoding component `component` of an attribute whose first word is `base`.
+// `buffer` is the name of the storage buffer instance the attribute lives in.
+std::string componentExpr(ComponentType type,
+                          uint32_t component,
+                          const std::string& buffer) {
+  // word holding the component and the component's bit offset inside it
+  uint32_t word = component;
+  uint32_t bitOffset = 0;
+  switch (type) {
+  case ComponentType::Float16:
+  case ComponentType::SInt16:
+  case ComponentType::UInt16:
+  case ComponentType::SNorm16:
+  case ComponentType::UNorm16:
+    word = component / 2;
+    bitOffset = (component % 2) * 16;
+    break;
+  case ComponentType::SInt8:
+  case ComponentType::UInt8:
+  case ComponentType::SNorm8:
+  case ComponentType::UNorm8:
+    word = component / 4;
+    bitOffset = (component % 4) * 8;
+    break;
+  case ComponentType::Int2_10_10_10:
+    word = 0;
+    bitOffset = component * 10; // component 3 lands on the 2 top bits
+    break;
+  default:
+    break;
+  }
+
+  std::ostringstream os;
+  const std::string w = buffer + ".words[base + " + std::to_string(word) + "u]";
+  switch (type) {
+  case ComponentType::Float32:
+    os << "uintBitsToFloat(" << w << ")";
+    break;
+  case ComponentType::Float16:
+    os << "unpackHalf2x16(" << w << ")" << (bitOffset == 0 ? ".x" : ".y");
+    break;
+  case ComponentType::SInt32:
+    os << "int(" << w << ")";
+    break;
+  case ComponentType::UInt32:
+    os << w;
+    break;
+  case ComponentType::SInt8:
+    os << "bitfieldExtract(int(" << w << "), " << bitOffset << ", 8)";
+    break;
+  case ComponentType::UInt8:
+    os << "bitfieldExtract(" << w << ", " << bitOffset << ", 8)";
+    break;
+  case ComponentType::SInt16:
+    os << "bitfieldExtract(int(" << w << "), " << bitOffset << ", 16)";
+    break;
+  case ComponentType::UInt16:
+    os << "bitfieldExtract(" << w << ", " << bitOffset << ", 16)";
+    break;
+  case ComponentType::SNorm8:
+    os << "max(float(bitfieldExtract(int(" << w << "), " << bitOffset << ", 8)) / 127.0, -1.0)";
+    break;
+  case ComponentType::UNorm8:
+    os << "(float(bitfieldExtract(" << w << ", " << bitOffset << ", 8)) / 255.0)";
+    break;
+  case ComponentType::SNorm16:
+    os << "max(float(bitfieldExtract(int(" << w << "), " << bitOffset
+       << ", 16)) / 32767.0, -1.0)";
+    break;
+  case ComponentType::UNorm16:
+    os << "(float(bitfieldExtract(" << w << ", " << bitOffset << ", 16)) / 65535.0)";
+    break;
+  case ComponentType::Int2_10_10_10:
+    if (component < 3) {
+      os << "max(float(bitfieldExtract(int(" << w << "), " << bitOffset
+         << ", 10)) / 511.0, -1.0)";
+    } else {
+      os << "float(bitfieldExtract(int(" << w << "), 30, 2))";
+    }
+    break;
+  }
+  return os.str();
+}
+
+// index of the element the fetch reads, honoring the binding's sample function
+std::string elementIndexExpr(const VertexInputBinding& binding) {
+  switch (binding.sampleFunction) {
+  case VertexSampleFunction::PerVertex:
+    return "vertexIndex";
+  case VertexSampleFunction::Instance:
+    return binding.sampleRate > 1
+               ? "(instanceIndex / " + std::to_string(binding.sampleRate) + "u)"
+               : "instanceIndex";
+  case VertexSampleFunction::Constant:
+    return "0u";
+  }
+  IGL_UNREACHABLE_RETURN(std::string("vertexIndex"));
+}
+
+} // namespace
+
+std::string generateVertexPullingPreamble(const VertexInputStateDesc& desc,
+                                          uint32_t descriptorSet,
+                                          uint32_t baseBinding,
+                                          Result* outResult) {
+  // validate before emitting anything: a partially generated preamble is useless
+  bool bufferUsed[IGL_VERTEX_BUFFER_MAX] = {};
+  for (size_t i = 0; i != desc.numAttributes; i++) {
+    const VertexAttribute& attribute = desc.attributes[i];
+    if (!IGL_VERIFY(attribute.bufferIndex < desc.numInputBindings)) {
+      Result::setResult(outResult,
+                        Result::Code::ArgumentInvalid,
+                        "Vertex attribute references an undeclared input binding");
+      return {};
+    }
+    if (attribute.offset % 4 != 0 || desc.inputBindings[attribute.bufferIndex].stride % 4 != 0) {
+      Result::setResult(outResult,
+                        Result::Code::Unsupported,
+                        "Vertex pulling requires 4-byte aligned attribute offsets and strides");
+      return {};
+    }
+    bufferUsed[attribute.bufferIndex] = true;
+  }
+
+  std::ostringstream os;
+  os << "// Generated by igl::generateVertexPullingPreamble(); do not edit.\n";
+
+  for (size_t i = 0; i != desc.numInputBindings; i++) {
+    if (!bufferUsed[i]) {
+      continue;
+    }
+    os << "layout(std430, set = " << descriptorSet << ", binding = " << (baseBinding + i)
+       << ") readonly buffer IGLVertexBuffer" << i << " {\n"
+       << "  uint words[];\n"
+       << "} iglVertexBuffer" << i << ";\n";
+  }
+
+  for (size_t i = 0; i != desc.numAttributes; i++) {
+    const VertexAttribute& attribute = desc.attributes[i];
+    const VertexInputBinding& binding = desc.inputBindings[attribute.bufferIndex];
+    const FormatTraits traits = formatTraits(attribute.format);
+    const std::string bufferName = "iglVertexBuffer" + std::to_string(attribute.bufferIndex);
+
+    std::string name = attribute.name;
+    if (name.empty()) {
+      name = "attr" +
+             std::to_string(attribute.location >= 0 ? static_cast<size_t>(attribute.location) : i);
+    }
+
+    os << "\n"
+       << glslTypeName(traits.type, traits.numComponents) << " iglFetch_" << name
+       << "(uint vertexIndex, uint instanceIndex) {\n"
+       << "  uint base = " << elementIndexExpr(binding) << " * " << (binding.stride / 4)
+       << "u + " << (attribute.offset / 4) << "u;\n"
+       << "  return ";
+    if (traits.numComponents == 1) {
+      os << componentExpr(traits.type, 0, bufferName);
+    } else {
+      os << glslTypeName(traits.type, traits.numComponents) << "(";
+      for (uint32_t c = 0; c != traits.numComponents; c++) {
+        os << (c ? ",\n                " : "") << componentExpr(traits.type, c, bufferName);
+      }
+      os << ")";
+    }
+    os << ";\n}\n";
+  }
+
+  Result::setOk(outResult);
+  return os.str();
+}
+
+} // namespace igl
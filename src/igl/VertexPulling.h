@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <igl/Common.h>
+#include <igl/VertexInputState.h>
+#include <string>
+
+namespace igl {
+
+/**
+ * @brief Generates a GLSL preamble that reads vertex attributes from storage buffers ("vertex
+ * pulling") instead of fixed-function vertex input.
+ *
+ * Every unique VertexInputStateDesc multiplies the number of render pipelines an app has to
+ * compile and cache. A vertex shader that pulls its attributes itself has no fixed-function
+ * vertex input at all: the same pipeline (built with `RenderPipelineDesc::vertexInputState ==
+ * nullptr`) serves every vertex layout, collapsing the layout dimension of the pipeline
+ * permutation space.
+ *
+ * The generated preamble declares one read-only std430 storage buffer per input binding used by
+ * the description, at `set = descriptorSet, binding = baseBinding + bufferIndex`, and one fetch
+ * function per attribute:
+ *
+ *   <type> iglFetch_<name>(uint vertexIndex, uint instanceIndex);
+ *
+ * where `<name>` is the attribute's name when set, otherwise `attr<location>` (or `attr<index>`
+ * when no location is assigned either). `<type>` is float/vecN for float, half and normalized
+ * formats, int/ivecN for signed integer formats and uint/uvecN for unsigned ones. Per-instance
+ * bindings apply their sampleRate divisor to instanceIndex; Constant bindings always read
+ * element 0. Callers bind the vertex data as storage buffers at the declared slots and invoke
+ * the fetch functions with gl_VertexIndex / gl_InstanceIndex.
+ *
+ * The buffers are declared as uint arrays and read word-by-word, so attribute offsets and
+ * binding strides must be 4-byte aligned; descriptions that are not fail the generation.
+ *
+ * @param desc The vertex layout to generate fetch code for.
+ * @param descriptorSet Descriptor set index the storage buffers are declared in.
+ * @param baseBinding Binding index of buffer 0; binding i is declared at baseBinding + i.
+ * @param outResult Optional param to receive success or error information.
+ * @returns the GLSL preamble, or an empty string when the description cannot be expressed.
+ */
+std::string generateVertexPullingPreamble(const VertexInputStateDesc& desc,
+                                          uint32_t descriptorSet,
+                                          uint32_t baseBinding,
+                                          Result* IGL_NULLABLE outResult = nullptr);
+
+} // namespace igl
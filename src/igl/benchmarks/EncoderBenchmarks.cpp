@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "util/BenchmarkHelpers.h"
+
+#include <benchmark/benchmark.h>
+#include <igl/NameHandle.h>
+#include <igl/tests/data/ShaderData.h>
+#include <igl/tests/data/VertexIndexData.h>
+
+namespace igl {
+namespace benchmarks {
+
+namespace {
+
+constexpr uint32_t kOffscreenTexSize = 64;
+
+// Shared setup for the encoder benchmarks: offscreen framebuffer, simple textured-quad pipeline
+// and the buffers it draws from. Built once and reused across iterations so the loop measures
+// encoding, not resource creation.
+struct RenderState {
+  std::shared_ptr<IDevice> device;
+  std::shared_ptr<ICommandQueue> commandQueue;
+  std::shared_ptr<IFramebuffer> framebuffer;
+  std::shared_ptr<IRenderPipelineState> pipelineState;
+  std::shared_ptr<IBuffer> vb, uv, ib;
+  std::shared_ptr<ITexture> inputTexture;
+  std::shared_ptr<ISamplerState> samplerState;
+  RenderPassDesc renderPass;
+
+  bool valid = false;
+
+  RenderState() {
+    device = util::createBenchmarkDevice();
+    if (!device) {
+      return;
+    }
+    commandQueue = util::createCommandQueue(*device);
+    if (!commandQueue) {
+      return;
+    }
+
+    const TextureDesc texDesc = TextureDesc::new2D(TextureFormat::RGBA_UNorm8,
+                                                   kOffscreenTexSize,
+                                                   kOffscreenTexSize,
+                                                   TextureDesc::TextureUsageBits::Sampled |
+                                                       TextureDesc::TextureUsageBits::Attachment);
+    auto offscreenTexture = device->createTexture(texDesc, nullptr);
+    if (!offscreenTexture) {
+      return;
+    }
+
+    FramebufferDesc framebufferDesc;
+    framebufferDesc.colorAttachments[0].texture = offscreenTexture;
+    framebuffer = device->createFramebuffer(framebufferDesc, nullptr);
+
+    renderPass.colorAttachments.resize(1);
+    renderPass.colorAttachments[0].loadAction = LoadAction::Clear;
+    renderPass.colorAttachments[0].storeAction = StoreAction::Store;
+    renderPass.colorAttachments[0].clearColor = {0.0, 0.0, 0.0, 1.0};
+
+    auto shaderStages = util::createSimpleShaderStages(device);
+    if (!shaderStages) {
+      return;
+    }
+
+    VertexInputStateDesc inputDesc;
+    inputDesc.attributes[0].format = VertexAttributeFormat::Float4;
+    inputDesc.attributes[0].offset = 0;
+    inputDesc.attributes[0].bufferIndex = tests::data::shader::simplePosIndex;
+    inputDesc.attributes[0].name = tests::data::shader::simplePos;
+    inputDesc.attributes[0].location = 0;
+    inputDesc.inputBindings[0].stride = sizeof(float) * 4;
+    inputDesc.attributes[1].format = VertexAttributeFormat::Float2;
+    inputDesc.attributes[1].offset = 0;
+    inputDesc.attributes[1].bufferIndex = tests::data::shader::simpleUvIndex;
+    inputDesc.attributes[1].name = tests::data::shader::simpleUv;
+    inputDesc.attributes[1].location = 1;
+    inputDesc.inputBindings[1].stride = sizeof(float) * 2;
+    inputDesc.numAttributes = inputDesc.numInputBindings = 2;
+
+    auto vertexInputState = device->createVertexInputState(inputDesc, nullptr);
+
+    BufferDesc bufDesc;
+    bufDesc.type = BufferDesc::BufferTypeBits::Index;
+    bufDesc.data = tests::data::vertex_index::QUAD_IND;
+    bufDesc.length = sizeof(tests::data::vertex_index::QUAD_IND);
+    ib = device->createBuffer(bufDesc, nullptr);
+
+    bufDesc.type = BufferDesc::BufferTypeBits::Vertex;
+    bufDesc.data = tests::data::vertex_index::QUAD_VERT;
+    bufDesc.length = sizeof(tests::data::vertex_index::QUAD_VERT);
+    vb = device->createBuffer(bufDesc, nullptr);
+
+    bufDesc.type = BufferDesc::BufferTypeBits::Vertex;
+    bufDesc.data = tests::data::vertex_index::QUAD_UV;
+    bufDesc.length = sizeof(tests::data::vertex_index::QUAD_UV);
+    uv = device->createBuffer(bufDesc, nullptr);
+
+    const TextureDesc inputDescTex = TextureDesc::new2D(TextureFormat::RGBA_UNorm8,
+                                                        kOffscreenTexSize,
+                                                        kOffscreenTexSize,
+                                                        TextureDesc::TextureUsageBits::Sampled);
+    inputTexture = device->createTexture(inputDescTex, nullptr);
+
+    const SamplerStateDesc samplerDesc;
+    samplerState = device->createSamplerState(samplerDesc, nullptr);
+
+    RenderPipelineDesc pipelineDesc;
+    pipelineDesc.vertexInputState = vertexInputState;
+    pipelineDesc.shaderStages = std::move(shaderStages);
+    pipelineDesc.targetDesc.colorAttachments.resize(1);
+    pipelineDesc.targetDesc.colorAttachments[0].textureFormat = offscreenTexture->getFormat();
+    pipelineDesc.fragmentUnitSamplerMap[0] = IGL_NAMEHANDLE(tests::data::shader::simpleSampler);
+    pipelineDesc.cullMode = CullMode::Disabled;
+    pipelineState = device->createRenderPipeline(pipelineDesc, nullptr);
+
+    valid = framebuffer && pipelineState && vb && uv && ib && inputTexture && samplerState;
+  }
+
+  static RenderState& instance() {
+    static RenderState state;
+    return state;
+  }
+};
+
+//
+// BM_RenderCommandEncoder_Draws
+//
+// Measures indexed-draw encode + submit throughput: each iteration records one command buffer
+// with state.range(0) draws and submits it without waiting. Reported items are draws/sec.
+//
+void BM_RenderCommandEncoder_Draws(benchmark::State& state) {
+  auto& rs = RenderState::instance();
+  if (!rs.valid) {
+    state.SkipWithError("No benchmark device available");
+    return;
+  }
+
+  const auto drawsPerBuffer = static_cast<size_t>(state.range(0));
+  std::shared_ptr<ICommandBuffer> lastCommandBuffer;
+  for (auto _ : state) {
+    const CommandBufferDesc cbDesc;
+    auto commandBuffer = rs.commandQueue->createCommandBuffer(cbDesc, nullptr);
+    auto encoder = commandBuffer->createRenderCommandEncoder(rs.renderPass, rs.framebuffer);
+    encoder->bindVertexBuffer(tests::data::shader::simplePosIndex, rs.vb);
+    encoder->bindVertexBuffer(tests::data::shader::simpleUvIndex, rs.uv);
+    encoder->bindRenderPipelineState(rs.pipelineState);
+    encoder->bindTexture(0, BindTarget::kFragment, rs.inputTexture.get());
+    encoder->bindSamplerState(0, BindTarget::kFragment, rs.samplerState.get());
+    for (size_t i = 0; i < drawsPerBuffer; ++i) {
+      encoder->drawIndexed(PrimitiveType::Triangle, 6, IndexFormat::UInt16, *rs.ib, 0);
+    }
+    encoder->endEncoding();
+    rs.commandQueue->submit(*commandBuffer);
+    lastCommandBuffer = std::move(commandBuffer);
+  }
+  if (lastCommandBuffer) {
+    lastCommandBuffer->waitUntilCompleted();
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * drawsPerBuffer);
+}
+BENCHMARK(BM_RenderCommandEncoder_Draws)->Arg(1)->Arg(64)->Arg(1024);
+
+} // namespace
+
+} // namespace benchmarks
+} // namespace igl
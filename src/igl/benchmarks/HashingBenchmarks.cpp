@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <igl/NameHandle.h>
+#include <igl/RenderPipelineState.h>
+#include <string>
+#include <vector>
+
+namespace igl {
+namespace benchmarks {
+
+namespace {
+
+//
+// BM_GenNameHandle
+//
+// Measures runtime NameHandle generation (the crc32 of the string), the path taken when names are
+// not known at compile time and IGL_NAMEHANDLE cannot be used.
+//
+void BM_GenNameHandle(benchmark::State& state) {
+  const std::vector<std::string> names = {
+      "inputImage", "perFrameUniforms", "modelViewProjectionMatrix", "u"};
+  size_t n = 0;
+  for (auto _ : state) {
+    auto handle = genNameHandle(names[n++ & 3]);
+    benchmark::DoNotOptimize(handle);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_GenNameHandle);
+
+//
+// BM_NameHandleHash
+//
+// Measures std::hash over pre-generated NameHandles, the hot path when handles key unordered
+// containers such as the uniform Collection.
+//
+void BM_NameHandleHash(benchmark::State& state) {
+  const NameHandle handle = genNameHandle("modelViewProjectionMatrix");
+  const std::hash<NameHandle> hasher;
+  for (auto _ : state) {
+    auto hash = hasher(handle);
+    benchmark::DoNotOptimize(hash);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_NameHandleHash);
+
+//
+// BM_RenderPipelineDescHash
+//
+// Measures std::hash over a representative RenderPipelineDesc, the key computation every
+// pipeline-state cache (e.g. IGLU's RenderPipelineStatePool) pays per lookup.
+//
+void BM_RenderPipelineDescHash(benchmark::State& state) {
+  RenderPipelineDesc desc;
+  desc.targetDesc.colorAttachments.resize(1);
+  desc.targetDesc.colorAttachments[0].textureFormat = TextureFormat::RGBA_UNorm8;
+  desc.targetDesc.depthAttachmentFormat = TextureFormat::Z_UNorm24;
+  desc.cullMode = CullMode::Back;
+  desc.fragmentUnitSamplerMap[0] = genNameHandle("inputImage");
+  desc.uniformBlockBindingMap[0] = std::make_pair(genNameHandle("perFrameUniforms"),
+                                                  genNameHandle("modelViewProjectionMatrix"));
+
+  const std::hash<RenderPipelineDesc> hasher;
+  for (auto _ : state) {
+    auto hash = hasher(desc);
+    benchmark::DoNotOptimize(hash);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_RenderPipelineDescHash);
+
+} // namespace
+
+} // namespace benchmarks
+} // namespace igl
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "util/BenchmarkHelpers.h"
+
+#include <benchmark/benchmark.h>
+#include <igl/NameHandle.h>
+#include <igl/tests/data/ShaderData.h>
+
+namespace igl {
+namespace benchmarks {
+
+namespace {
+
+//
+// BM_RenderPipelineCreation
+//
+// Measures render pipeline state creation latency. Shader stages and the vertex input state are
+// created once up front; each iteration pays for one createRenderPipeline call, which is where
+// backends compile/link the pipeline.
+//
+void BM_RenderPipelineCreation(benchmark::State& state) {
+  auto device = util::createBenchmarkDevice();
+  if (!device) {
+    state.SkipWithError("No benchmark device available");
+    return;
+  }
+
+  auto shaderStages = util::createSimpleShaderStages(device);
+  if (!shaderStages) {
+    state.SkipWithError("Shader stage creation failed");
+    return;
+  }
+
+  VertexInputStateDesc inputDesc;
+  inputDesc.attributes[0].format = VertexAttributeFormat::Float4;
+  inputDesc.attributes[0].offset = 0;
+  inputDesc.attributes[0].bufferIndex = tests::data::shader::simplePosIndex;
+  inputDesc.attributes[0].name = tests::data::shader::simplePos;
+  inputDesc.attributes[0].location = 0;
+  inputDesc.inputBindings[0].stride = sizeof(float) * 4;
+  inputDesc.attributes[1].format = VertexAttributeFormat::Float2;
+  inputDesc.attributes[1].offset = 0;
+  inputDesc.attributes[1].bufferIndex = tests::data::shader::simpleUvIndex;
+  inputDesc.attributes[1].name = tests::data::shader::simpleUv;
+  inputDesc.attributes[1].location = 1;
+  inputDesc.inputBindings[1].stride = sizeof(float) * 2;
+  inputDesc.numAttributes = inputDesc.numInputBindings = 2;
+  auto vertexInputState = device->createVertexInputState(inputDesc, nullptr);
+
+  RenderPipelineDesc pipelineDesc;
+  pipelineDesc.vertexInputState = std::move(vertexInputState);
+  pipelineDesc.shaderStages = std::move(shaderStages);
+  pipelineDesc.targetDesc.colorAttachments.resize(1);
+  pipelineDesc.targetDesc.colorAttachments[0].textureFormat = TextureFormat::RGBA_UNorm8;
+  pipelineDesc.fragmentUnitSamplerMap[0] = IGL_NAMEHANDLE(tests::data::shader::simpleSampler);
+  pipelineDesc.cullMode = CullMode::Disabled;
+
+  for (auto _ : state) {
+    auto pipelineState = device->createRenderPipeline(pipelineDesc, nullptr);
+    benchmark::DoNotOptimize(pipelineState);
+  }
+}
+BENCHMARK(BM_RenderPipelineCreation);
+
+//
+// BM_DepthStencilStateCreation
+//
+// Measures depth stencil state creation latency, the lighter sibling of pipeline creation that
+// some callers still create per frame.
+//
+void BM_DepthStencilStateCreation(benchmark::State& state) {
+  auto device = util::createBenchmarkDevice();
+  if (!device) {
+    state.SkipWithError("No benchmark device available");
+    return;
+  }
+
+  DepthStencilStateDesc desc;
+  desc.isDepthWriteEnabled = true;
+  desc.compareFunction = CompareFunction::Less;
+
+  for (auto _ : state) {
+    auto depthStencilState = device->createDepthStencilState(desc, nullptr);
+    benchmark::DoNotOptimize(depthStencilState);
+  }
+}
+BENCHMARK(BM_DepthStencilStateCreation);
+
+} // namespace
+
+} // namespace benchmarks
+} // namespace igl
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "BenchmarkHelpers.h"
+
+#include <igl/ShaderCreator.h>
+#include <igl/tests/data/ShaderData.h>
+#include <igl/tests/util/device/TestDevice.h>
+#include <string>
+
+#if IGL_BACKEND_OPENGL
+#include <igl/opengl/Device.h>
+#endif
+
+namespace igl {
+namespace benchmarks {
+namespace util {
+
+std::shared_ptr<IDevice> createBenchmarkDevice() {
+#if defined(IGL_BACKEND_TYPE)
+  const std::string backend(IGL_BACKEND_TYPE);
+
+  if (backend == "ogl") {
+#ifdef IGL_UNIT_TESTS_GLES_VERSION
+    const std::string backendApi(IGL_UNIT_TESTS_GLES_VERSION);
+#else
+    const std::string backendApi("2.0");
+#endif
+    return tests::util::device::createTestDevice(BackendType::OpenGL, backendApi);
+  } else if (backend == "metal") {
+    return tests::util::device::createTestDevice(BackendType::Metal);
+  } else if (backend == "vulkan") {
+    return tests::util::device::createTestDevice(BackendType::Vulkan);
+  }
+#endif
+  return nullptr;
+}
+
+std::shared_ptr<ICommandQueue> createCommandQueue(IDevice& device) {
+  const CommandQueueDesc desc = {CommandQueueType::Graphics};
+  return device.createCommandQueue(desc, nullptr);
+}
+
+std::unique_ptr<IShaderStages> createSimpleShaderStages(const std::shared_ptr<IDevice>& device) {
+  const auto backend = device->getBackendType();
+
+  if (backend == BackendType::OpenGL) {
+#if IGL_BACKEND_OPENGL
+    auto* context = &static_cast<opengl::Device&>(*device).getContext();
+    const bool isGles3 =
+        (opengl::DeviceFeatureSet::usesOpenGLES() &&
+         context->deviceFeatures().getGLVersion() >= igl::opengl::GLVersion::v3_0_ES);
+#else
+    const bool isGles3 = false;
+#endif // IGL_BACKEND_OPENGL
+    const auto* vertexShader = isGles3 ? tests::data::shader::OGL_SIMPLE_VERT_SHADER_ES3
+                                       : tests::data::shader::OGL_SIMPLE_VERT_SHADER;
+    const auto* fragmentShader = isGles3 ? tests::data::shader::OGL_SIMPLE_FRAG_SHADER_ES3
+                                         : tests::data::shader::OGL_SIMPLE_FRAG_SHADER;
+    return ShaderStagesCreator::fromModuleStringInput(*device,
+                                                      vertexShader,
+                                                      tests::data::shader::shaderFunc,
+                                                      "",
+                                                      fragmentShader,
+                                                      tests::data::shader::shaderFunc,
+                                                      "",
+                                                      nullptr);
+  } else if (backend == BackendType::Metal) {
+    return ShaderStagesCreator::fromLibraryStringInput(*device,
+                                                       tests::data::shader::MTL_SIMPLE_SHADER,
+                                                       tests::data::shader::simpleVertFunc,
+                                                       tests::data::shader::simpleFragFunc,
+                                                       "",
+                                                       nullptr);
+  } else if (backend == BackendType::Vulkan) {
+    return ShaderStagesCreator::fromModuleStringInput(
+        *device,
+        tests::data::shader::VULKAN_SIMPLE_VERT_SHADER,
+        tests::data::shader::shaderFunc,
+        "",
+        tests::data::shader::VULKAN_SIMPLE_FRAG_SHADER,
+        tests::data::shader::shaderFunc,
+        "",
+        nullptr);
+  }
+  return nullptr;
+}
+
+} // namespace util
+} // namespace benchmarks
+} // namespace igl
@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <igl/IGL.h>
+#include <memory>
+
+namespace igl {
+namespace benchmarks {
+namespace util {
+
+// Creates an offscreen IGL device for benchmarking. The backend is selected by the
+// IGL_BACKEND_TYPE compiler flag, matching the unit tests. Returns nullptr when no device is
+// available in the current environment; benchmarks should skip in that case rather than fail.
+std::shared_ptr<IDevice> createBenchmarkDevice();
+
+// Creates a graphics command queue on the given device. Returns nullptr on failure.
+std::shared_ptr<ICommandQueue> createCommandQueue(IDevice& device);
+
+// Creates the simple textured-quad shader stages the unit tests render with, for the device's
+// backend. Returns nullptr on failure.
+std::unique_ptr<IShaderStages> createSimpleShaderStages(const std::shared_ptr<IDevice>& device);
+
+} // namespace util
+} // namespace benchmarks
+} // namespace igl
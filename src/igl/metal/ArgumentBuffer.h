@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#import <Metal/Metal.h>
+#include <igl/Buffer.h>
+#include <igl/SamplerState.h>
+#include <igl/Shader.h>
+#include <igl/Texture.h>
+#include <unordered_map>
+
+namespace igl::metal {
+
+class Device;
+
+/// Packs a set of material resources into an MTLArgumentBuffer so a draw binds them all with a
+/// single buffer bind instead of one setTexture/setBuffer call per resource. Encode the
+/// resources once when the material changes, then bind each pass through
+/// RenderCommandEncoder::bindArgumentBuffer(), which also batches the useResource/useHeap
+/// residency declarations the GPU needs before it can access resources indirectly.
+class ArgumentBuffer final {
+ public:
+  /// Creates an argument buffer laid out for the [[buffer(bufferIndex)]] argument of the given
+  /// shader function.
+  static std::unique_ptr<ArgumentBuffer> create(Device& device,
+                                                IShaderModule& shaderModule,
+                                                size_t bufferIndex,
+                                                Result* outResult);
+
+  /// index is the [[id(n)]] slot inside the argument struct; setting a slot again replaces its
+  /// previous resource.
+  void setBuffer(size_t index, IBuffer& buffer, size_t offset);
+  void setTexture(size_t index, ITexture& texture);
+  void setSamplerState(size_t index, ISamplerState& samplerState);
+
+  IGL_INLINE id<MTLBuffer> get() const {
+    return buffer_;
+  }
+
+ private:
+  friend class RenderCommandEncoder;
+
+  ArgumentBuffer(id<MTLArgumentEncoder> encoder, id<MTLBuffer> buffer);
+
+  void trackResource(size_t index, id<MTLResource> resource);
+
+  id<MTLArgumentEncoder> encoder_;
+  id<MTLBuffer> buffer_;
+  // Resources referenced through the argument buffer, keyed by [[id(n)]] slot. They are accessed
+  // indirectly, so every pass must declare them resident; resources suballocated from an MTLHeap
+  // are declared through their heap instead, one call per heap.
+  std::unordered_map<size_t, id<MTLResource>> resources_;
+};
+
+} // namespace igl::metal
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <igl/metal/ArgumentBuffer.h>
+
+#include <igl/metal/Buffer.h>
+#include <igl/metal/Device.h>
+#include <igl/metal/SamplerState.h>
+#include <igl/metal/Shader.h>
+#include <igl/metal/Texture.h>
+
+namespace igl::metal {
+
+ArgumentBuffer::ArgumentBuffer(id<MTLArgumentEncoder> encoder, id<MTLBuffer> buffer) :
+  encoder_(encoder), buffer_(buffer) {
+  [encoder_ setArgumentBuffer:buffer_ offset:0];
+}
+
+std::unique_ptr<ArgumentBuffer> ArgumentBuffer::create(Device& device,
+                                                       IShaderModule& shaderModule,
+                                                       size_t bufferIndex,
+                                                       Result* outResult) {
+  id<MTLFunction> function = static_cast<ShaderModule&>(shaderModule).get();
+  if (!IGL_VERIFY(function != nil)) {
+    Result::setResult(outResult, Result::Code::ArgumentNull, "Shader module has no function");
+    return nullptr;
+  }
+
+  id<MTLArgumentEncoder> encoder = [function newArgumentEncoderWithBufferIndex:bufferIndex];
+  if (encoder == nil) {
+    Result::setResult(outResult,
+                      Result::Code::ArgumentInvalid,
+                      "Shader function has no argument buffer at the given buffer index");
+    return nullptr;
+  }
+
+  id<MTLBuffer> buffer = [device.get() newBufferWithLength:encoder.encodedLength
+                                                   options:MTLResourceStorageModeShared];
+  if (buffer == nil) {
+    Result::setResult(outResult, Result::Code::RuntimeError, "Failed to create argument buffer");
+    return nullptr;
+  }
+
+  Result::setOk(outResult);
+  return std::unique_ptr<ArgumentBuffer>(new ArgumentBuffer(encoder, buffer));
+}
+
+void ArgumentBuffer::setBuffer(size_t index, IBuffer& buffer, size_t offset) {
+  id<MTLBuffer> metalBuffer = static_cast<Buffer&>(buffer).get();
+  [encoder_ setBuffer:metalBuffer offset:offset atIndex:index];
+  trackResource(index, metalBuffer);
+}
+
+void ArgumentBuffer::setTexture(size_t index, ITexture& texture) {
+  id<MTLTexture> metalTexture = static_cast<Texture&>(texture).get();
+  [encoder_ setTexture:metalTexture atIndex:index];
+  trackResource(index, metalTexture);
+}
+
+void ArgumentBuffer::setSamplerState(size_t index, ISamplerState& samplerState) {
+  // Samplers are not MTLResources and need no residency tracking
+  [encoder_ setSamplerState:static_cast<SamplerState&>(samplerState).get() atIndex:index];
+}
+
+void ArgumentBuffer::trackResource(size_t index, id<MTLResource> resource) {
+  resources_[index] = resource;
+}
+
+} // namespace igl::metal
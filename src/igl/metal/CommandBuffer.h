@@ -13,10 +13,14 @@
 namespace igl {
 namespace metal {
 
+class GpuCounterSampler;
+class ParallelRenderCommandEncoder;
+
 class CommandBuffer final : public ICommandBuffer,
                             public std::enable_shared_from_this<CommandBuffer> {
  public:
-  explicit CommandBuffer(id<MTLCommandBuffer> value);
+  explicit CommandBuffer(id<MTLCommandBuffer> value,
+                         GpuCounterSampler* counterSampler = nullptr);
   ~CommandBuffer() override = default;
 
   std::unique_ptr<IComputeCommandEncoder> createComputeCommandEncoder() override;
@@ -27,12 +31,24 @@ class CommandBuffer final : public ICommandBuffer,
       const Dependencies& dependencies,
       Result* outResult) override;
 
+  /// Metal-specific: encodes the pass through an MTLParallelRenderCommandEncoder, which hands
+  /// out per-thread sub-encoders so draw calls can be recorded from multiple cores. See
+  /// ParallelRenderCommandEncoder.
+  std::unique_ptr<ParallelRenderCommandEncoder> createParallelRenderCommandEncoder(
+      const RenderPassDesc& renderPass,
+      const std::shared_ptr<IFramebuffer>& framebuffer,
+      Result* outResult);
+
   void present(std::shared_ptr<ITexture> surface) const override;
 
   void pushDebugGroupLabel(const char* label, const igl::Color& color) const override;
 
   void popDebugGroupLabel() const override;
 
+  void waitEvent(const std::shared_ptr<IQueueEvent>& event, uint64_t value) override;
+
+  void signalEvent(const std::shared_ptr<IQueueEvent>& event, uint64_t value) override;
+
   void waitUntilScheduled() override;
 
   void waitUntilCompleted() override;
@@ -41,8 +57,24 @@ class CommandBuffer final : public ICommandBuffer,
     return value_;
   }
 
+  // Non-null when the device has GPU counter sampling enabled; render passes encoded through
+  // this command buffer are then sampled at stage boundaries
+  IGL_INLINE GpuCounterSampler* getCounterSampler() const {
+    return counterSampler_;
+  }
+
  private:
+  friend class CommandQueue;
+
+  // Prepares this instance for reuse from the CommandQueue command buffer pool: MTLCommandBuffer
+  // objects are single-use, so recycling swaps in a freshly created one and clears the counters
+  void reset(id<MTLCommandBuffer> value) {
+    value_ = value;
+    mutableStatistics() = {};
+  }
+
   id<MTLCommandBuffer> value_;
+  GpuCounterSampler* counterSampler_ = nullptr;
 };
 
 } // namespace metal
@@ -11,16 +11,19 @@
 
 #import <Metal/Metal.h>
 #include <igl/metal/ComputeCommandEncoder.h>
+#include <igl/metal/ParallelRenderCommandEncoder.h>
+#include <igl/metal/QueueEvent.h>
 #include <igl/metal/RenderCommandEncoder.h>
 #include <igl/metal/Texture.h>
 
 namespace igl {
 namespace metal {
 
-CommandBuffer::CommandBuffer(id<MTLCommandBuffer> value) : value_(value) {}
+CommandBuffer::CommandBuffer(id<MTLCommandBuffer> value, GpuCounterSampler* counterSampler) :
+  value_(value), counterSampler_(counterSampler) {}
 
 std::unique_ptr<IComputeCommandEncoder> CommandBuffer::createComputeCommandEncoder() {
-  return std::make_unique<ComputeCommandEncoder>(value_);
+  return std::make_unique<ComputeCommandEncoder>(shared_from_this(), value_);
 }
 
 std::unique_ptr<IRenderCommandEncoder> CommandBuffer::createRenderCommandEncoder(
@@ -31,6 +34,14 @@ std::unique_ptr<IRenderCommandEncoder> CommandBuffer::createRenderCommandEncoder
   return RenderCommandEncoder::create(shared_from_this(), renderPass, framebuffer, outResult);
 }
 
+std::unique_ptr<ParallelRenderCommandEncoder> CommandBuffer::createParallelRenderCommandEncoder(
+    const RenderPassDesc& renderPass,
+    const std::shared_ptr<IFramebuffer>& framebuffer,
+    Result* outResult) {
+  return ParallelRenderCommandEncoder::create(
+      shared_from_this(), renderPass, framebuffer, outResult);
+}
+
 void CommandBuffer::present(std::shared_ptr<ITexture> surface) const {
   IGL_ASSERT(surface);
   if (!surface) {
@@ -51,6 +62,24 @@ void CommandBuffer::popDebugGroupLabel() const {
   [value_ popDebugGroup];
 }
 
+void CommandBuffer::waitEvent(const std::shared_ptr<IQueueEvent>& event, uint64_t value) {
+  if (!IGL_VERIFY(event != nullptr)) {
+    return;
+  }
+  if (@available(macOS 10.14, iOS 12.0, *)) {
+    [value_ encodeWaitForEvent:static_cast<QueueEvent&>(*event).get() value:value];
+  }
+}
+
+void CommandBuffer::signalEvent(const std::shared_ptr<IQueueEvent>& event, uint64_t value) {
+  if (!IGL_VERIFY(event != nullptr)) {
+    return;
+  }
+  if (@available(macOS 10.14, iOS 12.0, *)) {
+    [value_ encodeSignalEvent:static_cast<QueueEvent&>(*event).get() value:value];
+  }
+}
+
 void CommandBuffer::waitUntilScheduled() {
   [value_ waitUntilScheduled];
 }
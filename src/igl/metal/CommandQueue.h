@@ -11,17 +11,23 @@
 #include <igl/CommandQueue.h>
 #include <igl/metal/Device.h>
 
+#include <memory>
+#include <vector>
+
 namespace igl {
 namespace metal {
 
 class BufferSynchronizationManager;
+class CommandBuffer;
 class DeviceStatistics;
+class GpuCounterSampler;
 
 class CommandQueue final : public ICommandQueue {
  public:
   CommandQueue(id<MTLCommandQueue> value,
                std::shared_ptr<BufferSynchronizationManager> syncManager,
-               DeviceStatistics& deviceStatistics) noexcept;
+               DeviceStatistics& deviceStatistics,
+               GpuCounterSampler* counterSampler = nullptr) noexcept;
   std::shared_ptr<ICommandBuffer> createCommandBuffer(const CommandBufferDesc& desc,
                                                       Result* outResult) override;
   SubmitHandle submit(const igl::ICommandBuffer& commandBuffer, bool endOfFrame = false) override;
@@ -37,6 +43,15 @@ class CommandQueue final : public ICommandQueue {
   id<MTLCommandQueue> value_;
   std::shared_ptr<BufferSynchronizationManager> bufferSyncManager_;
   DeviceStatistics& deviceStatistics_;
+  GpuCounterSampler* counterSampler_ = nullptr;
+
+  // Upper bound on pooled CommandBuffer wrappers; buffers created beyond it are handed out
+  // unpooled
+  static constexpr size_t kMaxPooledCommandBuffers = 8;
+
+  // Recycled CommandBuffer wrappers; an entry is available for reuse when the pool holds the
+  // only remaining reference (the underlying MTLCommandBuffer is replaced on reuse)
+  std::vector<std::shared_ptr<CommandBuffer>> commandBufferPool_;
 };
 
 } // namespace metal
@@ -28,8 +28,12 @@ namespace metal {
 
 CommandQueue::CommandQueue(id<MTLCommandQueue> value,
                            std::shared_ptr<BufferSynchronizationManager> syncManager,
-                           DeviceStatistics& deviceStatistics) noexcept :
-  value_(value), bufferSyncManager_(std::move(syncManager)), deviceStatistics_(deviceStatistics) {
+                           DeviceStatistics& deviceStatistics,
+                           GpuCounterSampler* counterSampler) noexcept :
+  value_(value),
+  bufferSyncManager_(std::move(syncManager)),
+  deviceStatistics_(deviceStatistics),
+  counterSampler_(counterSampler) {
   if constexpr (kIGLMetalNumberCommandBuffersToCapture > 0 &&
                 kIGLMetalBeginCommandBufferToCapture == 0) {
     startCapture(value_);
@@ -39,7 +43,21 @@ CommandQueue::CommandQueue(id<MTLCommandQueue> value,
 std::shared_ptr<ICommandBuffer> CommandQueue::createCommandBuffer(const CommandBufferDesc& /*desc*/,
                                                                   Result* outResult) {
   id<MTLCommandBuffer> metalObject = [value_ commandBuffer];
-  auto resource = std::make_shared<CommandBuffer>(metalObject);
+
+  // recycle a pooled wrapper that the client has released (only the pool holds a reference);
+  // MTLCommandBuffer objects are single-use, so only the igl wrapper is reused
+  for (const std::shared_ptr<CommandBuffer>& pooled : commandBufferPool_) {
+    if (pooled.use_count() == 1) {
+      pooled->reset(metalObject);
+      Result::setOk(outResult);
+      return pooled;
+    }
+  }
+
+  auto resource = std::make_shared<CommandBuffer>(metalObject, counterSampler_);
+  if (commandBufferPool_.size() < kMaxPooledCommandBuffers) {
+    commandBufferPool_.push_back(resource);
+  }
   Result::setOk(outResult);
   return resource;
 }
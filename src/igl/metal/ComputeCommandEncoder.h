@@ -16,7 +16,8 @@ class Buffer;
 
 class ComputeCommandEncoder final : public IComputeCommandEncoder {
  public:
-  explicit ComputeCommandEncoder(id<MTLCommandBuffer> buffer);
+  ComputeCommandEncoder(std::shared_ptr<ICommandBuffer> commandBuffer,
+                        id<MTLCommandBuffer> buffer);
   ~ComputeCommandEncoder() override = default;
 
   void endEncoding() override;
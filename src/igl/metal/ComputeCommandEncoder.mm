@@ -10,6 +10,7 @@
 #import <Foundation/Foundation.h>
 
 #import <Metal/Metal.h>
+#include <igl/CommandBuffer.h>
 #include <igl/metal/Buffer.h>
 #include <igl/metal/ComputePipelineState.h>
 #include <igl/metal/Framebuffer.h>
@@ -19,7 +20,9 @@
 namespace igl {
 namespace metal {
 
-ComputeCommandEncoder::ComputeCommandEncoder(id<MTLCommandBuffer> buffer) {
+ComputeCommandEncoder::ComputeCommandEncoder(std::shared_ptr<ICommandBuffer> commandBuffer,
+                                             id<MTLCommandBuffer> buffer) :
+  IComputeCommandEncoder(std::move(commandBuffer)) {
   id<MTLComputeCommandEncoder> computeEncoder = [buffer computeCommandEncoder];
   encoder_ = computeEncoder;
 }
@@ -54,6 +57,7 @@ void ComputeCommandEncoder::bindComputePipelineState(
   if (pipelineState) {
     auto& iglPipelineState = static_cast<ComputePipelineState&>(*pipelineState);
     [encoder_ setComputePipelineState:iglPipelineState.get()];
+    getCommandBuffer().mutableStatistics().pipelineBindCount++;
   }
 }
 
@@ -70,6 +74,7 @@ void ComputeCommandEncoder::dispatchThreadGroups(const Dimensions& threadgroupCo
   tgs.height = threadgroupSize.height;
   tgs.depth = threadgroupSize.depth;
   [encoder_ dispatchThreadgroups:tgc threadsPerThreadgroup:tgs];
+  getCommandBuffer().mutableStatistics().dispatchCount++;
 }
 
 void ComputeCommandEncoder::bindUniform(const UniformDesc& /*uniformDesc*/, const void* /*data*/) {
@@ -84,6 +89,7 @@ void ComputeCommandEncoder::bindTexture(size_t index, ITexture* texture) {
   if (texture) {
     auto& iglTexture = static_cast<Texture&>(*texture);
     [encoder_ setTexture:iglTexture.get() atIndex:index];
+    getCommandBuffer().mutableStatistics().textureBindCount++;
   }
 }
 
@@ -94,6 +100,7 @@ void ComputeCommandEncoder::bindBuffer(size_t index,
   if (buffer) {
     auto& iglBuffer = static_cast<Buffer&>(*buffer);
     [encoder_ setBuffer:iglBuffer.get() offset:offset atIndex:index];
+    getCommandBuffer().mutableStatistics().bufferBindCount++;
   }
 }
 
@@ -106,6 +113,7 @@ void ComputeCommandEncoder::bindBytes(size_t index, const void* data, size_t len
           length);
     }
     [encoder_ setBytes:data length:length atIndex:index];
+    getCommandBuffer().mutableStatistics().bufferBindCount++;
   }
 }
 
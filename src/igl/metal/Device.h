@@ -17,18 +17,38 @@ namespace igl {
 namespace metal {
 
 class BufferSynchronizationManager;
+class GpuCounterSampler;
+class ResourceHeapPool;
 
-class Device : public IDevice {
+class Device final : public IDevice {
   friend class HWDevice;
 
  public:
-  explicit Device(id<MTLDevice> device);
+  // Max number of Metal drawables in the resource pool managed by Core Animation is 3, so triple
+  // buffering is the most an application can usefully run.
+  // https://developer.apple.com/documentation/quartzcore/cametallayer/2938720-maximumdrawablecount?language=objc
+  static constexpr size_t kDefaultMaxInFlightBuffers = 3;
+
+  /// maxInFlightBuffers sets how many frames the CPU may record ahead of the GPU: lower values
+  /// trade throughput for latency (e.g. 2 for latency-sensitive XR rendering), and 3 is the most
+  /// Core Animation's drawable pool supports.
+  explicit Device(id<MTLDevice> device, size_t maxInFlightBuffers = kDefaultMaxInFlightBuffers);
   ~Device() override;
 
   // Command Queue
   std::shared_ptr<ICommandQueue> createCommandQueue(const CommandQueueDesc& desc,
                                                     Result* outResult) override;
 
+  /// Creates an MTLEvent-backed cross-queue synchronization event. Each createCommandQueue call
+  /// returns a distinct MTLCommandQueue, so async compute runs by submitting to a second queue
+  /// and ordering against graphics with signalEvent/waitEvent. Requires macOS 10.14 / iOS 12.
+  std::shared_ptr<IQueueEvent> createQueueEvent(Result* IGL_NULLABLE outResult) override;
+
+  /// Occlusion pools are backed by a shared-storage visibility result buffer; pipeline
+  /// statistics queries are not exposed by Metal and return Unsupported.
+  std::shared_ptr<IQueryPool> createQueryPool(const QueryPoolDesc& desc,
+                                              Result* IGL_NULLABLE outResult) override;
+
   // Resources
   std::unique_ptr<IBuffer> createBuffer(const BufferDesc& desc,
                                         Result* outResult) const noexcept override;
@@ -41,12 +61,29 @@ class Device : public IDevice {
   std::shared_ptr<IVertexInputState> createVertexInputState(const VertexInputStateDesc& desc,
                                                             Result* outResult) const override;
 
+  /// Enables suballocating buffers and textures from pooled MTLHeaps instead of creating each as
+  /// a standalone MTLResource, which makes per-frame allocation cheaper and lets freed resources
+  /// share memory. Requests a heap cannot serve silently fall back to standalone allocations.
+  /// Not synchronized with resource creation: call before resources are created.
+  void setUseResourceHeaps(bool enabled);
+
   // Pipelines
   std::shared_ptr<IComputePipelineState> createComputePipeline(const ComputePipelineDesc& desc,
                                                                Result* outResult) const override;
   std::shared_ptr<IRenderPipelineState> createRenderPipeline(const RenderPipelineDesc& desc,
                                                              Result* outResult) const override;
 
+  /// Enables MTLBinaryArchive-backed pipeline caching. The file at the given path is deserialized
+  /// when present and consulted as a lookup archive by every render pipeline created afterwards,
+  /// so relaunches reuse the GPU binaries compiled on earlier runs instead of recompiling. Newly
+  /// compiled pipelines are harvested into the archive; call serializePipelineBinaryArchive() to
+  /// persist them. Returns Result::Code::Unsupported before macOS 11 / iOS 14.
+  Result setPipelineBinaryArchivePath(const std::string& path);
+
+  /// Writes the harvested pipeline archive back to the path passed to
+  /// setPipelineBinaryArchivePath(), typically once the startup pipelines have been created.
+  Result serializePipelineBinaryArchive();
+
   // Shaders
   std::unique_ptr<IShaderLibrary> createShaderLibrary(const ShaderLibraryDesc& desc,
                                                       Result* outResult) const override;
@@ -71,9 +108,23 @@ class Device : public IDevice {
   TextureFormatCapabilities getTextureFormatCapabilities(TextureFormat format) const override;
   ShaderVersion getShaderVersion() const override;
 
+  /// Enables stage-boundary GPU timestamp sampling for every render pass encoded through
+  /// command queues created afterwards; see GpuCounterSampler. Fails with Unsupported when the
+  /// device cannot sample the timestamp counter set.
+  Result enableGpuCounterSampling();
+  GpuCounterSampler* getGpuCounterSampler() const noexcept;
+
+  /// Index of the in-flight frame currently being recorded, in [0, getMaxInFlightBuffers()).
+  /// Ring allocators (e.g. ManagedUniformBuffer pools) use this to pick the sub-buffer that is
+  /// safe to write this frame.
+  size_t getCurrentInFlightBufferIndex() const noexcept;
+  size_t getMaxInFlightBuffers() const noexcept;
+
   // Device Statistics
   size_t getCurrentDrawCount() const override;
 
+  bool getMemoryStatistics(DeviceMemoryStatistics& outStatistics) const override;
+
   BackendType getBackendType() const override {
     return BackendType::Metal;
   }
@@ -94,7 +145,13 @@ class Device : public IDevice {
   id<MTLDevice> device_;
   PlatformDevice platformDevice_;
 
+  // Lookup/harvest archive for pipeline caching; nil until setPipelineBinaryArchivePath()
+  API_AVAILABLE(macos(11.0), ios(14.0)) id<MTLBinaryArchive> pipelineBinaryArchive_ = nil;
+  NSURL* pipelineBinaryArchiveURL_ = nil;
+
   DeviceFeatureSet deviceFeatureSet_;
+  std::unique_ptr<ResourceHeapPool> resourceHeapPool_;
+  std::unique_ptr<GpuCounterSampler> gpuCounterSampler_;
   std::shared_ptr<BufferSynchronizationManager> bufferSyncManager_;
   DeviceStatistics deviceStatistics_;
 };
@@ -14,8 +14,12 @@
 #include <igl/metal/ComputePipelineState.h>
 #include <igl/metal/DepthStencilState.h>
 #include <igl/metal/Framebuffer.h>
+#include <igl/metal/GpuCounterSampler.h>
 #include <igl/metal/PlatformDevice.h>
+#include <igl/metal/QueryPool.h>
+#include <igl/metal/QueueEvent.h>
 #include <igl/metal/RenderPipelineState.h>
+#include <igl/metal/ResourceHeapPool.h>
 #include <igl/metal/Result.h>
 #include <igl/metal/SamplerState.h>
 #include <igl/metal/Shader.h>
@@ -27,27 +31,183 @@
 namespace igl {
 namespace metal {
 
-// https://developer.apple.com/documentation/quartzcore/cametallayer/2938720-maximumdrawablecount?language=objc
-// Max number of Metal drawables in the resource pool managed by Core Animation is 3.
-#define IGL_METAL_MAX_IN_FLIGHT_BUFFERS 3
+namespace {
+
+// Metal runs on unified memory, so every host-visible placement maps to shared storage (which is
+// already device-local), and DeviceLocal maps to the private heap
+ResourceStorage resolveBufferStorage(const BufferDesc& desc) {
+  switch (desc.placement) {
+  case MemoryPlacement::Default:
+    return desc.storage;
+  case MemoryPlacement::DeviceLocal:
+    return ResourceStorage::Private;
+  case MemoryPlacement::HostUpload:
+  case MemoryPlacement::Readback:
+  case MemoryPlacement::DeviceLocalHostVisible:
+    return ResourceStorage::Shared;
+  }
+  return desc.storage;
+}
+
+id<MTLLibrary> newMetalLibrary(id<MTLDevice> device, const ShaderInput& input, Result* outResult) {
+  id<MTLLibrary> metalLibrary = nil;
+  NSError* error = nil;
+  if (input.type == ShaderInputType::Binary) {
+    if (input.length == 0 || input.data == nullptr) {
+      Result::setResult(outResult, Result::Code::ArgumentNull);
+      return nil;
+    }
+    // With null queue and destructor, dispatch_data_create() function stores a pointer to the data
+    // buffer and leaves the responsibility of releasing the buffer to the client
+    auto data = dispatch_data_create(input.data,
+                                     input.length,
+                                     nullptr /* dispatch_queue_t queue */,
+                                     nullptr /* dispatch_block_t
+                      destructor */
+    );
 
-Device::Device(id<MTLDevice> device) :
+    metalLibrary = [device newLibraryWithData:data error:&error];
+  } else {
+    if (!input.source || !strlen(input.source)) {
+      Result::setResult(outResult, Result::Code::ArgumentNull);
+      return nil;
+    }
+    MTLCompileOptions* compileOpts = [MTLCompileOptions new];
+    compileOpts.fastMathEnabled = input.options.fastMathEnabled;
+
+    NSString* shaderSource = [NSString stringWithUTF8String:input.source];
+    metalLibrary = [device newLibraryWithSource:shaderSource options:compileOpts error:&error];
+  }
+
+  if (!metalLibrary) {
+    IGL_ASSERT_MSG(!error, "%s\n", [error.localizedDescription UTF8String]);
+    setResultFrom(outResult, error);
+    return nil;
+  }
+  if (error) {
+    // Compilation successful but with warnings
+    IGL_LOG_INFO("%s\n", [error.localizedDescription UTF8String]);
+  }
+  Result::setOk(outResult);
+  return metalLibrary;
+}
+
+MTLFunctionConstantValues* toMTLFunctionConstantValues(
+    const std::vector<SpecializationConstant>& constants) {
+  MTLFunctionConstantValues* values = [MTLFunctionConstantValues new];
+  for (const auto& constant : constants) {
+    switch (constant.type) {
+    case SpecializationConstantType::Bool: {
+      const bool value = constant.value != 0;
+      [values setConstantValue:&value type:MTLDataTypeBool atIndex:constant.id];
+      break;
+    }
+    case SpecializationConstantType::Int:
+      [values setConstantValue:&constant.value type:MTLDataTypeInt atIndex:constant.id];
+      break;
+    case SpecializationConstantType::UInt:
+      [values setConstantValue:&constant.value type:MTLDataTypeUInt atIndex:constant.id];
+      break;
+    case SpecializationConstantType::Float:
+      [values setConstantValue:&constant.value type:MTLDataTypeFloat atIndex:constant.id];
+      break;
+    }
+  }
+  return values;
+}
+
+} // namespace
+
+Device::Device(id<MTLDevice> device, size_t maxInFlightBuffers) :
   device_(device), platformDevice_(*this), deviceFeatureSet_(device) {
-  bufferSyncManager_ =
-      std::make_shared<BufferSynchronizationManager>(IGL_METAL_MAX_IN_FLIGHT_BUFFERS);
+  IGL_ASSERT_MSG(maxInFlightBuffers > 0 && maxInFlightBuffers <= kDefaultMaxInFlightBuffers,
+                 "maxInFlightBuffers must be in [1, %zu]",
+                 kDefaultMaxInFlightBuffers);
+  bufferSyncManager_ = std::make_shared<BufferSynchronizationManager>(maxInFlightBuffers);
 }
 
 Device::~Device() = default;
 
+Result Device::enableGpuCounterSampling() {
+  if (gpuCounterSampler_ != nullptr) {
+    return Result();
+  }
+  Result result;
+  gpuCounterSampler_ = GpuCounterSampler::create(device_, &result);
+  return result;
+}
+
+GpuCounterSampler* Device::getGpuCounterSampler() const noexcept {
+  return gpuCounterSampler_.get();
+}
+
+size_t Device::getCurrentInFlightBufferIndex() const noexcept {
+  return bufferSyncManager_->getCurrentInFlightBufferIndex();
+}
+
+size_t Device::getMaxInFlightBuffers() const noexcept {
+  return bufferSyncManager_->getMaxInflightBuffers();
+}
+
+void Device::setUseResourceHeaps(bool enabled) {
+  if (enabled && resourceHeapPool_ == nullptr) {
+    resourceHeapPool_ = std::make_unique<ResourceHeapPool>(device_);
+  } else if (!enabled) {
+    resourceHeapPool_.reset();
+  }
+}
+
 std::shared_ptr<ICommandQueue> Device::createCommandQueue(const CommandQueueDesc& /*desc*/,
                                                           Result* outResult) {
   id<MTLCommandQueue> metalObject = [device_ newCommandQueue];
-  auto resource =
-      std::make_shared<CommandQueue>(metalObject, bufferSyncManager_, deviceStatistics_);
+  auto resource = std::make_shared<CommandQueue>(
+      metalObject, bufferSyncManager_, deviceStatistics_, gpuCounterSampler_.get());
   Result::setOk(outResult);
   return resource;
 }
 
+std::shared_ptr<IQueueEvent> Device::createQueueEvent(Result* outResult) {
+  if (@available(macOS 10.14, iOS 12.0, *)) {
+    id<MTLEvent> event = [device_ newEvent];
+    if (event == nil) {
+      Result::setResult(outResult, Result::Code::RuntimeError, "Unable to create MTLEvent");
+      return nullptr;
+    }
+    Result::setOk(outResult);
+    return std::make_shared<QueueEvent>(event);
+  }
+  Result::setResult(
+      outResult, Result::Code::Unsupported, "MTLEvent requires macOS 10.14 / iOS 12.0");
+  return nullptr;
+}
+
+std::shared_ptr<IQueryPool> Device::createQueryPool(const QueryPoolDesc& desc,
+                                                    Result* outResult) {
+  if (desc.type != QueryType::Occlusion) {
+    Result::setResult(outResult,
+                      Result::Code::Unsupported,
+                      "Metal does not expose pipeline statistics queries");
+    return nullptr;
+  }
+  if (!IGL_VERIFY(desc.count > 0)) {
+    Result::setResult(outResult, Result::Code::ArgumentInvalid, "Query pool count must be > 0");
+    return nullptr;
+  }
+  id<MTLBuffer> visibilityBuffer = [device_ newBufferWithLength:desc.count * sizeof(uint64_t)
+                                                        options:MTLResourceStorageModeShared];
+  if (visibilityBuffer == nil) {
+    Result::setResult(outResult, Result::Code::RuntimeError, "Unable to create visibility buffer");
+    return nullptr;
+  }
+  // newBufferWithLength: does not guarantee zeroed contents; queries never recorded read as 0
+  memset([visibilityBuffer contents], 0, desc.count * sizeof(uint64_t));
+  if (!desc.debugName.empty()) {
+    visibilityBuffer.label = [NSString stringWithUTF8String:desc.debugName.c_str()] ?: @"";
+  }
+  Result::setOk(outResult);
+  return std::make_shared<QueryPool>(desc, visibilityBuffer);
+}
+
 namespace {
 id<MTLBuffer> createMetalBuffer(id<MTLDevice> device,
                                 const BufferDesc& desc,
@@ -70,10 +230,21 @@ std::unique_ptr<IBuffer> Device::createBuffer(const BufferDesc& desc,
   if (desc.hint & BufferDesc::BufferAPIHintBits::NoCopy) {
     return createBufferNoCopy(desc, outResult);
   }
-  MTLStorageMode storage = toMTLStorageMode(desc.storage);
+  MTLStorageMode storage = toMTLStorageMode(resolveBufferStorage(desc));
   MTLResourceOptions options = MTLResourceOptionCPUCacheModeDefault | storage;
 
-  id<MTLBuffer> metalObject = createMetalBuffer(device_, desc, options);
+  id<MTLBuffer> metalObject = nil;
+  // Private heap buffers cannot be initialized with data without a blit, so those keep the
+  // standalone newBufferWithBytes path
+  if (resourceHeapPool_ && (desc.data == nullptr || storage == MTLStorageModeShared)) {
+    metalObject = resourceHeapPool_->newBuffer(desc.length, options);
+    if (metalObject != nil && desc.data != nullptr) {
+      memcpy(metalObject.contents, desc.data, desc.length);
+    }
+  }
+  if (metalObject == nil) {
+    metalObject = createMetalBuffer(device_, desc, options);
+  }
   std::unique_ptr<IBuffer> resource = std::make_unique<Buffer>(
       std::move(metalObject), options, desc.hint, 0 /* No accepted hints */, desc.type);
   if (getResourceTracker()) {
@@ -85,7 +256,7 @@ std::unique_ptr<IBuffer> Device::createBuffer(const BufferDesc& desc,
 
 std::unique_ptr<IBuffer> Device::createRingBuffer(const BufferDesc& desc,
                                                   Result* outResult) const noexcept {
-  MTLStorageMode storage = toMTLStorageMode(desc.storage);
+  MTLStorageMode storage = toMTLStorageMode(resolveBufferStorage(desc));
   MTLResourceOptions options = MTLResourceOptionCPUCacheModeDefault | storage;
 
   // Create a ring of buffers
@@ -106,7 +277,7 @@ std::unique_ptr<IBuffer> Device::createRingBuffer(const BufferDesc& desc,
 
 std::unique_ptr<IBuffer> Device::createBufferNoCopy(const BufferDesc& desc,
                                                     Result* outResult) const {
-  MTLStorageMode storage = toMTLStorageMode(desc.storage);
+  MTLStorageMode storage = toMTLStorageMode(resolveBufferStorage(desc));
 
   typedef void (^Deallocator)(void* pointer, NSUInteger length);
   Deallocator deallocator = nil;
@@ -185,7 +356,10 @@ std::shared_ptr<ITexture> Device::createTexture(const TextureDesc& desc,
   metalDesc.resourceOptions =
       MTLResourceCPUCacheModeDefaultCache | toMTLResourceStorageMode(sanitized.storage);
 
-  id<MTLTexture> metalObject = [device_ newTextureWithDescriptor:metalDesc];
+  id<MTLTexture> metalObject = resourceHeapPool_ ? resourceHeapPool_->newTexture(metalDesc) : nil;
+  if (metalObject == nil) {
+    metalObject = [device_ newTextureWithDescriptor:metalDesc];
+  }
   if (!metalObject) {
     Result::setResult(outResult, Result::Code::RuntimeError, "Failed to create Metal texture");
     IGL_ASSERT_MSG(0, outResult->message.c_str());
@@ -357,6 +531,8 @@ std::shared_ptr<igl::IComputePipelineState> Device::createComputePipeline(
 std::shared_ptr<igl::IRenderPipelineState> Device::createRenderPipeline(
     const RenderPipelineDesc& desc,
     Result* outResult) const {
+  recordPipelineUsage(desc);
+
   // TODO
   //  Size drawableSize = IGLNativeDrawableSize(layer_);
   //  graphicsDesc.viewportState.viewportCount = 1;
@@ -430,6 +606,21 @@ std::shared_ptr<igl::IRenderPipelineState> Device::createRenderPipeline(
   metalDesc.stencilAttachmentPixelFormat =
       Texture::textureFormatToMTLPixelFormat(desc.targetDesc.stencilAttachmentFormat);
 
+  // RenderPipelineDesc carries no stereo signal, so allow any pipeline to be used with the
+  // amplified encoders created for FramebufferMode::Stereo framebuffers
+  if (@available(macOS 10.15.4, iOS 13.0, *)) {
+    if ([device_ supportsVertexAmplificationCount:2]) {
+      metalDesc.maxVertexAmplificationCount = 2;
+    }
+  }
+
+  if (@available(macOS 11.0, iOS 14.0, *)) {
+    if (pipelineBinaryArchive_ != nil) {
+      // Consult the archive first; pipelines missing from it fall back to a full compile
+      metalDesc.binaryArchives = @[ pipelineBinaryArchive_ ];
+    }
+  }
+
   MTLRenderPipelineReflection* reflection = nil;
 
   // Create reflection for use later in binding, etc.
@@ -445,53 +636,82 @@ std::shared_ptr<igl::IRenderPipelineState> Device::createRenderPipeline(
     return nullptr;
   }
 
+  if (@available(macOS 11.0, iOS 14.0, *)) {
+    if (pipelineBinaryArchive_ != nil) {
+      // Harvest the compiled pipeline so serializePipelineBinaryArchive() can persist it for the
+      // next launch. Adding a pipeline already present in the archive is a cheap no-op.
+      NSError* archiveError = nil;
+      if (![pipelineBinaryArchive_ addRenderPipelineFunctionsWithDescriptor:metalDesc
+                                                                      error:&archiveError]) {
+        IGL_LOG_ERROR("Failed to add pipeline to binary archive: %s\n",
+                      [archiveError.localizedDescription UTF8String]);
+      }
+    }
+  }
+
   return std::make_shared<RenderPipelineState>(metalObject, reflection, desc);
 }
 
+Result Device::setPipelineBinaryArchivePath(const std::string& path) {
+  if (@available(macOS 11.0, iOS 14.0, *)) {
+    NSURL* url = [NSURL fileURLWithPath:@(path.c_str())];
+    MTLBinaryArchiveDescriptor* archiveDesc = [MTLBinaryArchiveDescriptor new];
+    if ([[NSFileManager defaultManager] fileExistsAtPath:url.path]) {
+      archiveDesc.url = url;
+    }
+    NSError* error = nil;
+    id<MTLBinaryArchive> archive = [device_ newBinaryArchiveWithDescriptor:archiveDesc
+                                                                     error:&error];
+    if (archive == nil && archiveDesc.url != nil) {
+      // A stale or corrupt archive must never break pipeline creation; start over with an
+      // empty one and let this run repopulate it.
+      archiveDesc.url = nil;
+      archive = [device_ newBinaryArchiveWithDescriptor:archiveDesc error:&error];
+    }
+    if (archive == nil) {
+      if (error != nil) {
+        Result result;
+        setResultFrom(&result, error);
+        return result;
+      }
+      return Result(Result::Code::RuntimeError, "Unable to create MTLBinaryArchive");
+    }
+    pipelineBinaryArchive_ = archive;
+    pipelineBinaryArchiveURL_ = url;
+    return Result();
+  }
+  return Result(Result::Code::Unsupported, "MTLBinaryArchive requires macOS 11 / iOS 14");
+}
+
+Result Device::serializePipelineBinaryArchive() {
+  if (@available(macOS 11.0, iOS 14.0, *)) {
+    if (pipelineBinaryArchive_ == nil) {
+      return Result(Result::Code::InvalidOperation, "No pipeline binary archive configured");
+    }
+    NSError* error = nil;
+    if (![pipelineBinaryArchive_ serializeToURL:pipelineBinaryArchiveURL_ error:&error]) {
+      if (error != nil) {
+        Result result;
+        setResultFrom(&result, error);
+        return result;
+      }
+      return Result(Result::Code::RuntimeError, "Unable to serialize pipeline binary archive");
+    }
+    return Result();
+  }
+  return Result(Result::Code::Unsupported, "MTLBinaryArchive requires macOS 11 / iOS 14");
+}
+
 std::unique_ptr<IShaderLibrary> Device::createShaderLibrary(const ShaderLibraryDesc& desc,
                                                             Result* outResult) const {
   if (IGL_UNEXPECTED(desc.moduleInfo.empty())) {
     Result::setResult(outResult, Result::Code::ArgumentInvalid);
     return nullptr;
   }
-  id<MTLLibrary> metalLibrary = nil;
-  NSError* error = nil;
-  if (desc.input.type == ShaderInputType::Binary) {
-    if (desc.input.length == 0 || desc.input.data == nullptr) {
-      Result::setResult(outResult, Result::Code::ArgumentNull);
-      return nullptr;
-    }
-    // With null queue and destructor, dispatch_data_create() function stores a pointer to the data
-    // buffer and leaves the responsibility of releasing the buffer to the client
-    auto data = dispatch_data_create(desc.input.data,
-                                     desc.input.length,
-                                     nullptr /* dispatch_queue_t queue */,
-                                     nullptr /* dispatch_block_t
-                      destructor */
-    );
-
-    metalLibrary = [device_ newLibraryWithData:data error:&error];
-  } else {
-    if (!desc.input.source || !strlen(desc.input.source)) {
-      Result::setResult(outResult, Result::Code::ArgumentNull);
-      return nullptr;
-    }
-    MTLCompileOptions* compileOpts = [MTLCompileOptions new];
-    compileOpts.fastMathEnabled = desc.input.options.fastMathEnabled;
-
-    NSString* shaderSource = [NSString stringWithUTF8String:desc.input.source];
-    metalLibrary = [device_ newLibraryWithSource:shaderSource options:compileOpts error:&error];
-  }
-
+  id<MTLLibrary> metalLibrary = newMetalLibrary(device_, desc.input, outResult);
   if (!metalLibrary) {
-    IGL_ASSERT_MSG(!error, "%s\n", [error.localizedDescription UTF8String]);
-    setResultFrom(outResult, error);
     return nullptr;
   }
-  if (error) {
-    // Compilation successful but with warnings
-    IGL_LOG_INFO("%s\n", [error.localizedDescription UTF8String]);
-  }
   std::vector<std::shared_ptr<IShaderModule>> modules;
   modules.reserve(desc.moduleInfo.size());
   for (const auto& info : desc.moduleInfo) {
@@ -526,6 +746,36 @@ std::unique_ptr<IShaderLibrary> Device::createShaderLibrary(const ShaderLibraryD
 
 std::shared_ptr<IShaderModule> Device::createShaderModule(const ShaderModuleDesc& desc,
                                                           Result* outResult) const {
+  // Specialized modules fold the constants in at function creation, so one compiled library
+  // services many variants without recompiling the source
+  if (!desc.specializationConstants.empty()) {
+    id<MTLLibrary> metalLibrary = newMetalLibrary(device_, desc.input, outResult);
+    if (!metalLibrary) {
+      return nullptr;
+    }
+    NSString* shaderEntrypoint = [NSString stringWithUTF8String:desc.info.entryPoint.c_str()];
+    if (!shaderEntrypoint) {
+      Result::setResult(outResult, Result::Code::RuntimeError);
+      return nullptr;
+    }
+    NSError* error = nil;
+    auto metalFunction =
+        [metalLibrary newFunctionWithName:shaderEntrypoint
+                           constantValues:toMTLFunctionConstantValues(desc.specializationConstants)
+                                    error:&error];
+    if (!metalFunction) {
+      IGL_ASSERT_MSG(!error, "%s\n", [error.localizedDescription UTF8String]);
+      setResultFrom(outResult, error);
+      return nullptr;
+    }
+    auto module = std::make_shared<metal::ShaderModule>(desc.info, metalFunction);
+    if (auto resourceTracker = getResourceTracker()) {
+      module->initResourceTracker(resourceTracker);
+    }
+    Result::setOk(outResult);
+    return module;
+  }
+
   auto libraryDesc =
       desc.input.type == ShaderInputType::String
           ? ShaderLibraryDesc::fromStringInput(desc.input.source, {desc.info}, desc.debugName)
@@ -631,6 +881,18 @@ size_t Device::getCurrentDrawCount() const {
   return deviceStatistics_.getDrawCount();
 }
 
+bool Device::getMemoryStatistics(DeviceMemoryStatistics& outStatistics) const {
+  outStatistics = {};
+  outStatistics.heapCount = 1;
+  // Metal does not expose per-heap numbers; report the device-wide allocation size as one heap
+  outStatistics.heaps[0].usageBytes = device_.currentAllocatedSize;
+  outStatistics.heaps[0].isDeviceLocal = true;
+#if IGL_PLATFORM_MACOS || IGL_PLATFORM_MACCATALYST
+  outStatistics.heaps[0].budgetBytes = device_.recommendedMaxWorkingSetSize;
+#endif
+  return true;
+}
+
 MTLStorageMode Device::toMTLStorageMode(ResourceStorage storage) {
   switch (storage) {
   case ResourceStorage::Private:
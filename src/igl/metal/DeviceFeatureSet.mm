@@ -113,6 +113,11 @@ DeviceFeatureSet::DeviceFeatureSet(id<MTLDevice> device) {
     // this API became available as of iOS 14 and macOS 11
     supports32BitFloatFiltering_ = device.supports32BitFloatFiltering;
   }
+
+  if (@available(macOS 10.15.4, iOS 13.0, *)) {
+    // single-pass stereo uses vertex amplification with two views
+    supportsVertexAmplification_ = [device supportsVertexAmplificationCount:2];
+  }
 }
 
 bool DeviceFeatureSet::hasFeature(DeviceFeatures feature) const {
@@ -140,7 +145,10 @@ bool DeviceFeatureSet::hasFeature(DeviceFeatures feature) const {
   case DeviceFeatures::Texture3D:
   case DeviceFeatures::SRGB:
   case DeviceFeatures::DrawIndexedIndirect:
+  case DeviceFeatures::TextureViews:
     return true;
+  case DeviceFeatures::DrawIndirectCount:
+    return false;
   // on Metal and Vulkan, the framebuffer pixel format dictates sRGB control.
   case DeviceFeatures::SRGBWriteControl:
     return false;
@@ -171,7 +179,7 @@ bool DeviceFeatureSet::hasFeature(DeviceFeatures feature) const {
   case DeviceFeatures::BufferDeviceAddress:
     return false;
   case DeviceFeatures::Multiview:
-    return false;
+    return supportsVertexAmplification_;
   case DeviceFeatures::BindUniform:
     return false;
   case DeviceFeatures::TexturePartialMipChain:
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#import <Metal/Metal.h>
+#include <array>
+#include <igl/Common.h>
+#include <mutex>
+
+namespace igl::metal {
+
+/// Samples GPU timestamps at render stage boundaries through MTLCounterSampleBuffers. Every
+/// render pass encoded after Device::enableGpuCounterSampling() is sampled automatically and
+/// identified by a monotonically increasing pass index. Samples resolve asynchronously from
+/// command-buffer completion handlers, so queries never stall the CPU on the GPU; a query for a
+/// pass the GPU has not finished simply reports no data yet. The sampler must outlive every
+/// command buffer it sampled, which holds as long as the device outlives its queues.
+class GpuCounterSampler final {
+ public:
+  /// Stage-boundary timestamps for one render pass, in the GPU timebase reported by
+  /// [MTLDevice sampleTimestamps:gpuTimestamp:].
+  struct PassTiming {
+    uint64_t passIndex = 0;
+    uint64_t vertexStart = 0;
+    uint64_t vertexEnd = 0;
+    uint64_t fragmentStart = 0;
+    uint64_t fragmentEnd = 0;
+  };
+
+  /// Returns nullptr when the device cannot sample the timestamp counter set at stage
+  /// boundaries (requires macOS 11 / iOS 14 and hardware support).
+  static std::unique_ptr<GpuCounterSampler> create(id<MTLDevice> device, Result* outResult);
+
+  /// True when the device exposes the named common counter set, e.g. MTLCommonCounterSetTimestamp
+  /// or MTLCommonCounterSetStatistic for bandwidth/occupancy counters.
+  static bool isCounterSetSupported(id<MTLDevice> device, NSString* counterSetName);
+
+  /// Attaches stage-boundary sampling to the pass and schedules asynchronous resolution for when
+  /// commandBuffer completes. Returns the pass index to query later; when every ring slot is
+  /// still in flight the pass goes unsampled and 0 is returned.
+  uint64_t samplePass(MTLRenderPassDescriptor* passDesc, id<MTLCommandBuffer> commandBuffer);
+
+  /// Fills outTiming for the given pass and returns true; returns false while the GPU has not
+  /// finished the pass, or once its ring slot has been recycled. Never stalls.
+  bool getPassTiming(uint64_t passIndex, PassTiming& outTiming) const;
+
+  /// Most recently resolved pass timing; false when nothing has resolved yet.
+  bool getLatestPassTiming(PassTiming& outTiming) const;
+
+ private:
+  explicit GpuCounterSampler(id<MTLDevice> device);
+
+  API_AVAILABLE(macos(11.0), ios(14.0)) void resolveSlot(uint32_t slotIndex);
+
+  static constexpr uint32_t kNumSlots = 8;
+
+  struct Slot {
+    API_AVAILABLE(macos(11.0), ios(14.0)) id<MTLCounterSampleBuffer> sampleBuffer = nil;
+    bool inFlight = false;
+    bool resolved = false;
+    PassTiming timing;
+  };
+
+  id<MTLDevice> device_;
+  std::array<Slot, kNumSlots> slots_;
+  uint64_t nextPassIndex_ = 1;
+  uint64_t latestResolvedPass_ = 0;
+  mutable std::mutex mutex_;
+};
+
+} // namespace igl::metal
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <igl/metal/GpuCounterSampler.h>
+
+#include <igl/metal/Result.h>
+
+namespace igl::metal {
+namespace {
+
+// vertex start/end, fragment start/end
+constexpr uint32_t kSamplesPerPass = 4;
+
+API_AVAILABLE(macos(11.0), ios(14.0))
+id<MTLCounterSet> counterSetWithName(id<MTLDevice> device, NSString* counterSetName) {
+  for (id<MTLCounterSet> counterSet in device.counterSets) {
+    if ([counterSet.name isEqualToString:counterSetName]) {
+      return counterSet;
+    }
+  }
+  return nil;
+}
+
+} // namespace
+
+GpuCounterSampler::GpuCounterSampler(id<MTLDevice> device) : device_(device) {}
+
+bool GpuCounterSampler::isCounterSetSupported(id<MTLDevice> device, NSString* counterSetName) {
+  if (@available(macOS 11.0, iOS 14.0, *)) {
+    return counterSetWithName(device, counterSetName) != nil;
+  }
+  return false;
+}
+
+std::unique_ptr<GpuCounterSampler> GpuCounterSampler::create(id<MTLDevice> device,
+                                                             Result* outResult) {
+  if (@available(macOS 11.0, iOS 14.0, *)) {
+    if (![device supportsCounterSampling:MTLCounterSamplingPointAtStageBoundary]) {
+      Result::setResult(outResult,
+                        Result::Code::Unsupported,
+                        "Device cannot sample counters at render stage boundaries");
+      return nullptr;
+    }
+    id<MTLCounterSet> timestampSet = counterSetWithName(device, MTLCommonCounterSetTimestamp);
+    if (timestampSet == nil) {
+      Result::setResult(
+          outResult, Result::Code::Unsupported, "Device has no timestamp counter set");
+      return nullptr;
+    }
+
+    std::unique_ptr<GpuCounterSampler> sampler(new GpuCounterSampler(device));
+    MTLCounterSampleBufferDescriptor* bufferDesc = [MTLCounterSampleBufferDescriptor new];
+    bufferDesc.counterSet = timestampSet;
+    bufferDesc.sampleCount = kSamplesPerPass;
+    bufferDesc.storageMode = MTLStorageModeShared;
+    for (auto& slot : sampler->slots_) {
+      NSError* error = nil;
+      slot.sampleBuffer = [device newCounterSampleBufferWithDescriptor:bufferDesc error:&error];
+      if (slot.sampleBuffer == nil) {
+        setResultFrom(outResult, error);
+        return nullptr;
+      }
+    }
+    Result::setOk(outResult);
+    return sampler;
+  }
+  Result::setResult(
+      outResult, Result::Code::Unsupported, "GPU counter sampling requires macOS 11 / iOS 14");
+  return nullptr;
+}
+
+uint64_t GpuCounterSampler::samplePass(MTLRenderPassDescriptor* passDesc,
+                                       id<MTLCommandBuffer> commandBuffer) {
+  if (@available(macOS 11.0, iOS 14.0, *)) {
+    uint32_t slotIndex = kNumSlots;
+    {
+      const std::lock_guard<std::mutex> lock(mutex_);
+      for (uint32_t i = 0; i < kNumSlots; ++i) {
+        if (!slots_[i].inFlight) {
+          slotIndex = i;
+          break;
+        }
+      }
+      if (slotIndex == kNumSlots) {
+        // every slot still waits on the GPU; skip this pass rather than stall
+        return 0;
+      }
+      auto& slot = slots_[slotIndex];
+      slot.inFlight = true;
+      slot.resolved = false;
+      slot.timing = {};
+      slot.timing.passIndex = nextPassIndex_++;
+    }
+
+    MTLRenderPassSampleBufferAttachmentDescriptor* attachment = passDesc.sampleBufferAttachments[0];
+    attachment.sampleBuffer = slots_[slotIndex].sampleBuffer;
+    attachment.startOfVertexSampleIndex = 0;
+    attachment.endOfVertexSampleIndex = 1;
+    attachment.startOfFragmentSampleIndex = 2;
+    attachment.endOfFragmentSampleIndex = 3;
+
+    [commandBuffer addCompletedHandler:^(id<MTLCommandBuffer> /*completed*/) {
+      resolveSlot(slotIndex);
+    }];
+    return slots_[slotIndex].timing.passIndex;
+  }
+  return 0;
+}
+
+void GpuCounterSampler::resolveSlot(uint32_t slotIndex) {
+  auto& slot = slots_[slotIndex];
+  NSData* data = [slot.sampleBuffer resolveCounterRange:NSMakeRange(0, kSamplesPerPass)];
+
+  const std::lock_guard<std::mutex> lock(mutex_);
+  if (data.length >= sizeof(MTLCounterResultTimestamp) * kSamplesPerPass) {
+    const auto* samples = static_cast<const MTLCounterResultTimestamp*>(data.bytes);
+    slot.timing.vertexStart = samples[0].timestamp;
+    slot.timing.vertexEnd = samples[1].timestamp;
+    slot.timing.fragmentStart = samples[2].timestamp;
+    slot.timing.fragmentEnd = samples[3].timestamp;
+    slot.resolved = true;
+    if (slot.timing.passIndex > latestResolvedPass_) {
+      latestResolvedPass_ = slot.timing.passIndex;
+    }
+  }
+  slot.inFlight = false;
+}
+
+bool GpuCounterSampler::getPassTiming(uint64_t passIndex, PassTiming& outTiming) const {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  for (const auto& slot : slots_) {
+    if (slot.resolved && slot.timing.passIndex == passIndex) {
+      outTiming = slot.timing;
+      return true;
+    }
+  }
+  return false;
+}
+
+bool GpuCounterSampler::getLatestPassTiming(PassTiming& outTiming) const {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  if (latestResolvedPass_ == 0) {
+    return false;
+  }
+  for (const auto& slot : slots_) {
+    if (slot.resolved && slot.timing.passIndex == latestResolvedPass_) {
+      outTiming = slot.timing;
+      return true;
+    }
+  }
+  return false;
+}
+
+} // namespace igl::metal
@@ -32,8 +32,12 @@ class HWDevice {
   std::unique_ptr<IDevice> createWithSystemDefaultDevice(Result* outResult);
 
 #ifdef __OBJC__
-  /// Create a device with a given existing MTLDevice.
-  std::unique_ptr<Device> createWithMTLDevice(id<MTLDevice> device, Result* outResult);
+  /// Create a device with a given existing MTLDevice. maxInFlightBuffers sets how many frames
+  /// the CPU may record ahead of the GPU; see Device::kDefaultMaxInFlightBuffers.
+  std::unique_ptr<Device> createWithMTLDevice(
+      id<MTLDevice> device,
+      Result* outResult,
+      size_t maxInFlightBuffers = Device::kDefaultMaxInFlightBuffers);
 #endif
 };
 
@@ -147,16 +147,17 @@ std::unique_ptr<IDevice> HWDevice::createWithSystemDefaultDevice(Result* outResu
 }
 
 std::unique_ptr<metal::Device> HWDevice::createWithMTLDevice(id<MTLDevice> device,
-                                                             Result* outResult) {
+                                                             Result* outResult,
+                                                             size_t maxInFlightBuffers) {
   if (!device) {
     Result::setResult(outResult, Result::Code::Unsupported, "Metal is not supported!");
     return nullptr;
   }
 
 #if IGL_PLATFORM_MACOS
-  auto iglDevice = std::make_unique<macos::Device>(device);
+  auto iglDevice = std::make_unique<macos::Device>(device, maxInFlightBuffers);
 #else
-  auto iglDevice = std::make_unique<ios::Device>(device);
+  auto iglDevice = std::make_unique<ios::Device>(device, maxInFlightBuffers);
 #endif
 
   Result::setOk(outResult);
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <Metal/Metal.h>
+#include <igl/RenderCommandEncoder.h>
+#include <igl/RenderPass.h>
+#include <igl/metal/CommandBuffer.h>
+
+namespace igl::metal {
+
+/// Encodes one render pass from multiple threads through an MTLParallelRenderCommandEncoder.
+/// Created via CommandBuffer::createParallelRenderCommandEncoder(); each worker thread records
+/// its share of the pass into its own sub-encoder obtained from createSubEncoder(), using the
+/// regular IRenderCommandEncoder interface. Sub-encoders execute on the GPU in creation order,
+/// and every sub-encoder must end before endEncoding() is called here.
+class ParallelRenderCommandEncoder final {
+ public:
+  static std::unique_ptr<ParallelRenderCommandEncoder> create(
+      const std::shared_ptr<CommandBuffer>& commandBuffer,
+      const RenderPassDesc& renderPass,
+      const std::shared_ptr<IFramebuffer>& framebuffer,
+      Result* outResult);
+
+  ~ParallelRenderCommandEncoder() = default;
+
+  /// Returns a sub-encoder for one thread's share of the pass. Creation itself is not thread
+  /// safe: create all sub-encoders on one thread, then hand them out to workers.
+  std::unique_ptr<IRenderCommandEncoder> createSubEncoder();
+
+  /// Ends the pass. All sub-encoders must have called endEncoding() before this.
+  void endEncoding();
+
+ private:
+  ParallelRenderCommandEncoder(std::shared_ptr<CommandBuffer> commandBuffer,
+                               id<MTLParallelRenderCommandEncoder> encoder,
+                               bool useVertexAmplification);
+
+  std::shared_ptr<CommandBuffer> commandBuffer_;
+  id<MTLParallelRenderCommandEncoder> encoder_ = nil;
+  bool useVertexAmplification_ = false;
+};
+
+} // namespace igl::metal
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <igl/metal/ParallelRenderCommandEncoder.h>
+
+#include <igl/metal/RenderCommandEncoder.h>
+
+namespace igl::metal {
+
+ParallelRenderCommandEncoder::ParallelRenderCommandEncoder(
+    std::shared_ptr<CommandBuffer> commandBuffer,
+    id<MTLParallelRenderCommandEncoder> encoder,
+    bool useVertexAmplification) :
+  commandBuffer_(std::move(commandBuffer)),
+  encoder_(encoder),
+  useVertexAmplification_(useVertexAmplification) {}
+
+std::unique_ptr<ParallelRenderCommandEncoder> ParallelRenderCommandEncoder::create(
+    const std::shared_ptr<CommandBuffer>& commandBuffer,
+    const RenderPassDesc& renderPass,
+    const std::shared_ptr<IFramebuffer>& framebuffer,
+    Result* outResult) {
+  bool useVertexAmplification = false;
+  MTLRenderPassDescriptor* metalRenderPassDesc = RenderCommandEncoder::buildRenderPassDescriptor(
+      commandBuffer, renderPass, framebuffer, &useVertexAmplification, outResult);
+  if (metalRenderPassDesc == nil) {
+    return nullptr;
+  }
+
+  id<MTLParallelRenderCommandEncoder> encoder =
+      [commandBuffer->get() parallelRenderCommandEncoderWithDescriptor:metalRenderPassDesc];
+  if (!IGL_VERIFY(encoder != nil)) {
+    Result::setResult(
+        outResult, Result::Code::RuntimeError, "Failed to create parallel render command encoder");
+    return nullptr;
+  }
+
+  return std::unique_ptr<ParallelRenderCommandEncoder>(
+      new ParallelRenderCommandEncoder(commandBuffer, encoder, useVertexAmplification));
+}
+
+std::unique_ptr<IRenderCommandEncoder> ParallelRenderCommandEncoder::createSubEncoder() {
+  IGL_ASSERT_MSG(encoder_ != nil, "Sub-encoders cannot be created after endEncoding()");
+  id<MTLRenderCommandEncoder> subEncoder = [encoder_ renderCommandEncoder];
+  if (!IGL_VERIFY(subEncoder != nil)) {
+    return nullptr;
+  }
+  if (useVertexAmplification_) {
+    RenderCommandEncoder::setStereoViewMappings(subEncoder);
+  }
+  return std::unique_ptr<IRenderCommandEncoder>(
+      new RenderCommandEncoder(commandBuffer_, subEncoder));
+}
+
+void ParallelRenderCommandEncoder::endEncoding() {
+  [encoder_ endEncoding];
+  encoder_ = nil;
+}
+
+} // namespace igl::metal
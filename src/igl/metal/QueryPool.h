@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <Metal/Metal.h>
+#include <atomic>
+#include <igl/QueryPool.h>
+
+namespace igl {
+namespace metal {
+
+/// Occlusion queries are backed by a shared-storage visibility result buffer (one uint64_t per
+/// query). The buffer is attached to a render pass through RenderPassDesc::occlusionQueryPool and
+/// individual queries are selected with setVisibilityResultMode:offset:. Results are published by
+/// the command buffer's completion handler, so getResults() stays non-blocking.
+class QueryPool final : public IQueryPool {
+ public:
+  QueryPool(const QueryPoolDesc& desc, id<MTLBuffer> visibilityBuffer);
+  ~QueryPool() override = default;
+
+  QueryType getType() const override {
+    return desc_.type;
+  }
+
+  uint32_t getCount() const override {
+    return desc_.count;
+  }
+
+  bool getResults(uint32_t first, uint32_t count, uint64_t* IGL_NONNULL outResults) override;
+
+  IGL_INLINE id<MTLBuffer> get() const {
+    return visibilityBuffer_;
+  }
+
+  /// Called when a render pass using this pool is encoded; results are unresolved until the
+  /// matching markResolved() arrives from the command buffer's completion handler.
+  void markInFlight();
+  void markResolved();
+
+ private:
+  QueryPoolDesc desc_;
+  id<MTLBuffer> visibilityBuffer_;
+  std::atomic<uint32_t> passesInFlight_{0};
+};
+
+} // namespace metal
+} // namespace igl
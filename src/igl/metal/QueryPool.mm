@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <igl/metal/QueryPool.h>
+
+#include <cstring>
+
+namespace igl {
+namespace metal {
+
+QueryPool::QueryPool(const QueryPoolDesc& desc, id<MTLBuffer> visibilityBuffer) :
+  desc_(desc), visibilityBuffer_(visibilityBuffer) {}
+
+bool QueryPool::getResults(uint32_t first, uint32_t count, uint64_t* outResults) {
+  if (!IGL_VERIFY(first + count <= desc_.count)) {
+    return false;
+  }
+  if (passesInFlight_.load(std::memory_order_acquire) != 0) {
+    return false;
+  }
+  const auto* results = static_cast<const uint64_t*>([visibilityBuffer_ contents]);
+  memcpy(outResults, results + first, count * sizeof(uint64_t));
+  return true;
+}
+
+void QueryPool::markInFlight() {
+  passesInFlight_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void QueryPool::markResolved() {
+  passesInFlight_.fetch_sub(1, std::memory_order_release);
+}
+
+} // namespace metal
+} // namespace igl
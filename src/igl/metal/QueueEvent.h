@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#import <Metal/Metal.h>
+#include <igl/CommandQueue.h>
+
+namespace igl {
+namespace metal {
+
+/// Wraps an MTLEvent for cross-queue synchronization. Created via Device::createQueueEvent;
+/// signal and wait points are encoded through CommandBuffer::signalEvent / waitEvent. MTLEvent
+/// carries the monotonically increasing 64-bit timeline value IQueueEvent describes, and one
+/// event may be signalled and awaited on any number of MTLCommandQueues of the same device.
+class QueueEvent final : public IQueueEvent {
+ public:
+  explicit QueueEvent(id<MTLEvent> event) API_AVAILABLE(macos(10.14), ios(12.0)) :
+    event_(event) {}
+  ~QueueEvent() override = default;
+
+  IGL_INLINE id<MTLEvent> get() const API_AVAILABLE(macos(10.14), ios(12.0)) {
+    return event_;
+  }
+
+ private:
+  API_AVAILABLE(macos(10.14), ios(12.0)) id<MTLEvent> event_ = nil;
+};
+
+} // namespace metal
+} // namespace igl
@@ -16,6 +16,7 @@
 
 namespace igl {
 namespace metal {
+class ArgumentBuffer;
 class Buffer;
 
 class RenderCommandEncoder final : public IRenderCommandEncoder {
@@ -47,10 +48,19 @@ class RenderCommandEncoder final : public IRenderCommandEncoder {
   void bindVertexBuffer(uint32_t index,
                         const std::shared_ptr<IBuffer>& buffer,
                         size_t bufferOffset) override;
+  /// Metal-specific: binds an argument buffer's backing MTLBuffer at the given buffer index and
+  /// declares the resources it references resident for this pass, batching the useResource and
+  /// useHeap calls. See ArgumentBuffer.
+  void bindArgumentBuffer(int index, uint8_t bindTarget, const ArgumentBuffer& argumentBuffer);
   void bindBytes(size_t index, uint8_t bindTarget, const void* data, size_t length) override;
   void bindPushConstants(const void* data, size_t length, size_t offset) override;
   void bindSamplerState(size_t index, uint8_t target, ISamplerState* samplerState) override;
+  void bindSamplerStates(size_t index,
+                         uint8_t target,
+                         ISamplerState* const* samplerStates,
+                         size_t count) override;
   void bindTexture(size_t index, uint8_t target, ITexture* texture) override;
+  void bindTextures(size_t index, uint8_t target, ITexture* const* textures, size_t count) override;
   void bindUniform(const UniformDesc& uniformDesc, const void* data) override;
 
   void draw(PrimitiveType primitiveType,
@@ -83,6 +93,18 @@ class RenderCommandEncoder final : public IRenderCommandEncoder {
                                 size_t indirectBufferOffset,
                                 uint32_t drawCount,
                                 uint32_t stride) override;
+  void multiDrawIndexedIndirectCount(PrimitiveType primitiveType,
+                                     IndexFormat indexFormat,
+                                     IBuffer& indexBuffer,
+                                     IBuffer& indirectBuffer,
+                                     size_t indirectBufferOffset,
+                                     IBuffer& countBuffer,
+                                     size_t countBufferOffset,
+                                     uint32_t maxDrawCount,
+                                     uint32_t stride) override;
+
+  void beginOcclusionQuery(const std::shared_ptr<IQueryPool>& pool, uint32_t index) override;
+  void endOcclusionQuery(const std::shared_ptr<IQueryPool>& pool, uint32_t index) override;
 
   void setStencilReferenceValue(uint32_t value) override;
   void setStencilReferenceValues(uint32_t frontValue, uint32_t backValue) override;
@@ -96,12 +118,30 @@ class RenderCommandEncoder final : public IRenderCommandEncoder {
   static MTLClearColor convertClearColor(Color value);
 
  private:
+  friend class ParallelRenderCommandEncoder;
+
   explicit RenderCommandEncoder(const std::shared_ptr<CommandBuffer>& commandBuffer);
+  // Wraps a sub-encoder handed out by an MTLParallelRenderCommandEncoder
+  RenderCommandEncoder(const std::shared_ptr<CommandBuffer>& commandBuffer,
+                       id<MTLRenderCommandEncoder> encoder);
   void initialize(const std::shared_ptr<CommandBuffer>& commandBuffer,
                   const RenderPassDesc& renderPass,
                   const std::shared_ptr<IFramebuffer>& framebuffer,
                   Result* outResult);
 
+  /// Builds the MTLRenderPassDescriptor shared by the serial and parallel encoding paths.
+  /// Returns nil when the framebuffer is missing; outUseVertexAmplification is set when the pass
+  /// renders a stereo framebuffer through vertex amplification.
+  static MTLRenderPassDescriptor* buildRenderPassDescriptor(
+      const std::shared_ptr<CommandBuffer>& commandBuffer,
+      const RenderPassDesc& renderPass,
+      const std::shared_ptr<IFramebuffer>& framebuffer,
+      bool* outUseVertexAmplification,
+      Result* outResult);
+
+  // Routes amplified draws to the two layers of a stereo framebuffer's attachment arrays
+  static void setStereoViewMappings(id<MTLRenderCommandEncoder> encoder);
+
   void bindCullMode(const CullMode& cullMode);
   void bindFrontFacingWinding(const WindingMode& frontFaceWinding);
   void bindPolygonFillMode(const PolygonFillMode& polygonFillMode);
@@ -9,27 +9,38 @@
 
 #import <Foundation/Foundation.h>
 #import <Metal/Metal.h>
+#include <algorithm>
 #include <igl/RenderPass.h>
+#include <igl/metal/ArgumentBuffer.h>
 #include <igl/metal/Buffer.h>
 #include <igl/metal/DepthStencilState.h>
 #include <igl/metal/Framebuffer.h>
+#include <igl/metal/GpuCounterSampler.h>
+#include <igl/metal/QueryPool.h>
 #include <igl/metal/RenderPipelineState.h>
 #include <igl/metal/SamplerState.h>
 #include <igl/metal/Texture.h>
+#include <vector>
 
 namespace igl {
 namespace metal {
 RenderCommandEncoder::RenderCommandEncoder(const std::shared_ptr<CommandBuffer>& commandBuffer) :
   IRenderCommandEncoder::IRenderCommandEncoder(commandBuffer) {}
 
-void RenderCommandEncoder::initialize(const std::shared_ptr<CommandBuffer>& commandBuffer,
-                                      const RenderPassDesc& renderPass,
-                                      const std::shared_ptr<IFramebuffer>& framebuffer,
-                                      Result* outResult) {
+RenderCommandEncoder::RenderCommandEncoder(const std::shared_ptr<CommandBuffer>& commandBuffer,
+                                           id<MTLRenderCommandEncoder> encoder) :
+  IRenderCommandEncoder::IRenderCommandEncoder(commandBuffer), encoder_(encoder) {}
+
+MTLRenderPassDescriptor* RenderCommandEncoder::buildRenderPassDescriptor(
+    const std::shared_ptr<CommandBuffer>& commandBuffer,
+    const RenderPassDesc& renderPass,
+    const std::shared_ptr<IFramebuffer>& framebuffer,
+    bool* outUseVertexAmplification,
+    Result* outResult) {
   Result::setOk(outResult);
   if (!IGL_VERIFY(framebuffer)) {
     Result::setResult(outResult, Result::Code::ArgumentNull);
-    return;
+    return nil;
   }
   MTLRenderPassDescriptor* metalRenderPassDesc = [MTLRenderPassDescriptor renderPassDescriptor];
   const FramebufferDesc& desc = static_cast<const Framebuffer&>(*framebuffer).get();
@@ -114,7 +125,114 @@ void RenderCommandEncoder::initialize(const std::shared_ptr<CommandBuffer>& comm
     }
   }
 
+  // Single-pass stereo: amplified draws are routed to the two layers of the attachment array
+  bool useVertexAmplification = false;
+  if (desc.mode == FramebufferMode::Stereo) {
+    if (@available(macOS 10.15.4, iOS 13.0, *)) {
+      useVertexAmplification = [commandBuffer->get().device supportsVertexAmplificationCount:2];
+      if (useVertexAmplification) {
+        metalRenderPassDesc.renderTargetArrayLength = 2;
+      }
+    }
+    IGL_ASSERT_MSG(useVertexAmplification,
+                   "FramebufferMode::Stereo requires vertex amplification support.");
+  }
+  *outUseVertexAmplification = useVertexAmplification;
+
+  // GPU profiling: sample stage-boundary timestamps for this pass when the device has counter
+  // sampling enabled
+  if (auto* counterSampler = commandBuffer->getCounterSampler()) {
+    counterSampler->samplePass(metalRenderPassDesc, commandBuffer->get());
+  }
+
+  // Occlusion queries: bind the pool's visibility result buffer to the pass and publish the
+  // results from the command buffer's completion handler
+  if (renderPass.occlusionQueryPool) {
+    auto pool = std::static_pointer_cast<QueryPool>(renderPass.occlusionQueryPool);
+    metalRenderPassDesc.visibilityResultBuffer = pool->get();
+    pool->markInFlight();
+    [commandBuffer->get() addCompletedHandler:^(id<MTLCommandBuffer>) {
+      pool->markResolved();
+    }];
+  }
+
+  return metalRenderPassDesc;
+}
+
+void RenderCommandEncoder::setStereoViewMappings(id<MTLRenderCommandEncoder> encoder) {
+  if (@available(macOS 10.15.4, iOS 13.0, *)) {
+    // one amplified draw per view; view 1 renders into layer 1 of each attachment
+    MTLVertexAmplificationViewMapping viewMappings[2];
+    viewMappings[0].viewportArrayIndexOffset = 0;
+    viewMappings[0].renderTargetArrayIndexOffset = 0;
+    viewMappings[1].viewportArrayIndexOffset = 0;
+    viewMappings[1].renderTargetArrayIndexOffset = 1;
+    [encoder setVertexAmplificationCount:2 viewMappings:viewMappings];
+  }
+}
+
+void RenderCommandEncoder::initialize(const std::shared_ptr<CommandBuffer>& commandBuffer,
+                                      const RenderPassDesc& renderPass,
+                                      const std::shared_ptr<IFramebuffer>& framebuffer,
+                                      Result* outResult) {
+  bool useVertexAmplification = false;
+  MTLRenderPassDescriptor* metalRenderPassDesc = buildRenderPassDescriptor(
+      commandBuffer, renderPass, framebuffer, &useVertexAmplification, outResult);
+  if (metalRenderPassDesc == nil) {
+    return;
+  }
+
   encoder_ = [commandBuffer->get() renderCommandEncoderWithDescriptor:metalRenderPassDesc];
+
+  if (useVertexAmplification) {
+    setStereoViewMappings(encoder_);
+  }
+
+  // partial pass for damage-region rendering: Metal cannot restrict its load-action clears, so
+  // only the default scissor is confined to the render area (use LoadAction::Load to preserve
+  // the content outside it); the rect is clamped because Metal rejects out-of-bounds scissors
+  if (renderPass.hasRenderArea()) {
+    auto attachment = framebuffer->getColorAttachment(0);
+    if (!attachment) {
+      attachment = framebuffer->getDepthAttachment();
+    }
+    if (IGL_VERIFY(attachment)) {
+      const uint32_t mipLevel = renderPass.colorAttachments.empty()
+                                    ? renderPass.depthAttachment.mipLevel
+                                    : renderPass.colorAttachments[0].mipLevel;
+      const auto dimensions = attachment->getDimensions();
+      const uint32_t width = std::max((uint32_t)(dimensions.width >> mipLevel), 1u);
+      const uint32_t height = std::max((uint32_t)(dimensions.height >> mipLevel), 1u);
+      const uint32_t x = std::min(renderPass.renderArea.x, width);
+      const uint32_t y = std::min(renderPass.renderArea.y, height);
+      bindScissorRect({x,
+                       y,
+                       std::min(renderPass.renderArea.width, width - x),
+                       std::min(renderPass.renderArea.height, height - y)});
+    }
+    return;
+  }
+
+  // dynamic resolution: Metal defaults the viewport to the full attachment size, so confine
+  // rendering to the scaled sub-rect explicitly (clears already ran at full size)
+  if (renderPass.renderScale < 1.0f) {
+    auto attachment = framebuffer->getColorAttachment(0);
+    if (!attachment) {
+      attachment = framebuffer->getDepthAttachment();
+    }
+    if (IGL_VERIFY(attachment)) {
+      const uint32_t mipLevel = renderPass.colorAttachments.empty()
+                                    ? renderPass.depthAttachment.mipLevel
+                                    : renderPass.colorAttachments[0].mipLevel;
+      const auto dimensions = attachment->getDimensions();
+      const uint32_t width = RenderPassDesc::scaledDimension(
+          std::max((uint32_t)(dimensions.width >> mipLevel), 1u), renderPass.renderScale);
+      const uint32_t height = RenderPassDesc::scaledDimension(
+          std::max((uint32_t)(dimensions.height >> mipLevel), 1u), renderPass.renderScale);
+      bindViewport({0.0f, 0.0f, (float)width, (float)height, 0.0f, +1.0f});
+      bindScissorRect({0, 0, width, height});
+    }
+  }
 }
 
 std::unique_ptr<RenderCommandEncoder> RenderCommandEncoder::create(
@@ -219,6 +337,8 @@ void RenderCommandEncoder::bindRenderPipelineState(
   bindCullMode(metalPipelineState.getCullMode());
   bindFrontFacingWinding(metalPipelineState.getWindingMode());
   bindPolygonFillMode(metalPipelineState.getPolygonFillMode());
+
+  getCommandBuffer().mutableStatistics().pipelineBindCount++;
 }
 
 void RenderCommandEncoder::bindDepthStencilState(
@@ -238,6 +358,26 @@ void RenderCommandEncoder::setDepthBias(float depthBias, float slopeScale, float
   [encoder_ setDepthBias:depthBias slopeScale:slopeScale clamp:clamp];
 }
 
+void RenderCommandEncoder::beginOcclusionQuery(const std::shared_ptr<IQueryPool>& pool,
+                                               uint32_t index) {
+  IGL_ASSERT(encoder_);
+  if (!IGL_VERIFY(pool != nullptr && index < pool->getCount())) {
+    return;
+  }
+  [encoder_ setVisibilityResultMode:MTLVisibilityResultModeCounting
+                             offset:index * sizeof(uint64_t)];
+}
+
+void RenderCommandEncoder::endOcclusionQuery(const std::shared_ptr<IQueryPool>& pool,
+                                             uint32_t index) {
+  IGL_ASSERT(encoder_);
+  if (!IGL_VERIFY(pool != nullptr && index < pool->getCount())) {
+    return;
+  }
+  [encoder_ setVisibilityResultMode:MTLVisibilityResultModeDisabled
+                             offset:index * sizeof(uint64_t)];
+}
+
 void RenderCommandEncoder::setStencilReferenceValue(uint32_t value) {
   IGL_ASSERT(encoder_);
   [encoder_ setStencilReferenceValue:value];
@@ -265,6 +405,47 @@ void RenderCommandEncoder::bindBuffer(int index,
     if ((bindTarget & BindTarget::kFragment) != 0) {
       [encoder_ setFragmentBuffer:metalBuffer.get() offset:offset atIndex:index];
     }
+    getCommandBuffer().mutableStatistics().bufferBindCount++;
+  }
+}
+
+void RenderCommandEncoder::bindArgumentBuffer(int index,
+                                              uint8_t bindTarget,
+                                              const ArgumentBuffer& argumentBuffer) {
+  IGL_ASSERT(encoder_);
+  IGL_ASSERT_MSG(bindTarget == BindTarget::kVertex || bindTarget == BindTarget::kFragment ||
+                     bindTarget == BindTarget::kAllGraphics,
+                 "Bind target is not valid: %d",
+                 bindTarget);
+
+  // Resources referenced through an argument buffer are accessed indirectly, so they must be
+  // declared resident every pass. Batch standalone resources into one useResources call and
+  // declare heap-suballocated ones through their heap, one call per distinct heap.
+  std::vector<__unsafe_unretained id<MTLResource>> standalone;
+  std::vector<__unsafe_unretained id<MTLHeap>> heaps;
+  standalone.reserve(argumentBuffer.resources_.size());
+  for (const auto& entry : argumentBuffer.resources_) {
+    id<MTLHeap> heap = entry.second.heap;
+    if (heap != nil) {
+      if (std::find(heaps.begin(), heaps.end(), heap) == heaps.end()) {
+        heaps.push_back(heap);
+      }
+    } else {
+      standalone.push_back(entry.second);
+    }
+  }
+  if (!standalone.empty()) {
+    [encoder_ useResources:standalone.data() count:standalone.size() usage:MTLResourceUsageRead];
+  }
+  for (id<MTLHeap> heap : heaps) {
+    [encoder_ useHeap:heap];
+  }
+
+  if ((bindTarget & BindTarget::kVertex) != 0) {
+    [encoder_ setVertexBuffer:argumentBuffer.get() offset:0 atIndex:index];
+  }
+  if ((bindTarget & BindTarget::kFragment) != 0) {
+    [encoder_ setFragmentBuffer:argumentBuffer.get() offset:0 atIndex:index];
   }
 }
 
@@ -275,6 +456,7 @@ void RenderCommandEncoder::bindVertexBuffer(uint32_t index,
   if (buffer) {
     auto& metalBuffer = static_cast<Buffer&>(*buffer);
     [encoder_ setVertexBuffer:metalBuffer.get() offset:bufferOffset atIndex:index];
+    getCommandBuffer().mutableStatistics().bufferBindCount++;
   }
 }
 
@@ -299,6 +481,7 @@ void RenderCommandEncoder::bindBytes(size_t index,
     if ((bindTarget & BindTarget::kFragment) != 0) {
       [encoder_ setFragmentBytes:data length:length atIndex:index];
     }
+    getCommandBuffer().mutableStatistics().bufferBindCount++;
   }
 }
 
@@ -324,6 +507,38 @@ void RenderCommandEncoder::bindTexture(size_t index, uint8_t bindTarget, ITextur
   if ((bindTarget & BindTarget::kFragment) != 0) {
     [encoder_ setFragmentTexture:metalTexture atIndex:index];
   }
+
+  getCommandBuffer().mutableStatistics().textureBindCount++;
+}
+
+void RenderCommandEncoder::bindTextures(size_t index,
+                                        uint8_t bindTarget,
+                                        ITexture* const* textures,
+                                        size_t count) {
+  IGL_ASSERT(encoder_);
+  IGL_ASSERT_MSG(bindTarget == BindTarget::kVertex || bindTarget == BindTarget::kFragment ||
+                     bindTarget == BindTarget::kAllGraphics,
+                 "Bind target is not valid: %d",
+                 bindTarget);
+  if (!IGL_VERIFY(textures != nullptr) || count == 0) {
+    return;
+  }
+
+  std::vector<id<MTLTexture>> metalTextures(count);
+  for (size_t i = 0; i != count; i++) {
+    auto* iglTexture = static_cast<Texture*>(textures[i]);
+    metalTextures[i] = iglTexture ? iglTexture->get() : nil;
+  }
+
+  const NSRange range = NSMakeRange(index, count);
+  if ((bindTarget & BindTarget::kVertex) != 0) {
+    [encoder_ setVertexTextures:metalTextures.data() withRange:range];
+  }
+  if ((bindTarget & BindTarget::kFragment) != 0) {
+    [encoder_ setFragmentTextures:metalTextures.data() withRange:range];
+  }
+
+  getCommandBuffer().mutableStatistics().textureBindCount += static_cast<uint32_t>(count);
 }
 
 void RenderCommandEncoder::bindUniform(const UniformDesc& /*uniformDesc*/, const void* /*data*/) {
@@ -349,6 +564,38 @@ void RenderCommandEncoder::bindSamplerState(size_t index,
   if ((bindTarget & BindTarget::kFragment) != 0) {
     [encoder_ setFragmentSamplerState:metalSamplerState->get() atIndex:index];
   }
+
+  getCommandBuffer().mutableStatistics().textureBindCount++;
+}
+
+void RenderCommandEncoder::bindSamplerStates(size_t index,
+                                             uint8_t bindTarget,
+                                             ISamplerState* const* samplerStates,
+                                             size_t count) {
+  IGL_ASSERT(encoder_);
+  IGL_ASSERT_MSG(bindTarget == BindTarget::kVertex || bindTarget == BindTarget::kFragment ||
+                     bindTarget == BindTarget::kAllGraphics,
+                 "Bind target is not valid: %d",
+                 bindTarget);
+  if (!IGL_VERIFY(samplerStates != nullptr) || count == 0) {
+    return;
+  }
+
+  std::vector<id<MTLSamplerState>> metalSamplerStates(count);
+  for (size_t i = 0; i != count; i++) {
+    auto* metalSamplerState = static_cast<SamplerState*>(samplerStates[i]);
+    metalSamplerStates[i] = metalSamplerState ? metalSamplerState->get() : nil;
+  }
+
+  const NSRange range = NSMakeRange(index, count);
+  if ((bindTarget & BindTarget::kVertex) != 0) {
+    [encoder_ setVertexSamplerStates:metalSamplerStates.data() withRange:range];
+  }
+  if ((bindTarget & BindTarget::kFragment) != 0) {
+    [encoder_ setFragmentSamplerStates:metalSamplerStates.data() withRange:range];
+  }
+
+  getCommandBuffer().mutableStatistics().textureBindCount += static_cast<uint32_t>(count);
 }
 
 void RenderCommandEncoder::draw(PrimitiveType primitiveType,
@@ -357,6 +604,10 @@ void RenderCommandEncoder::draw(PrimitiveType primitiveType,
                                 uint32_t instanceCount,
                                 uint32_t baseInstance) {
   getCommandBuffer().incrementCurrentDrawCount();
+  auto& stats = getCommandBuffer().mutableStatistics();
+  stats.instanceCount += instanceCount;
+  stats.estimatedPrimitiveCount += estimatedPrimitiveCount(primitiveType, vertexCount) *
+                                   instanceCount;
   IGL_ASSERT(encoder_);
   MTLPrimitiveType metalPrimitive = convertPrimitiveType(primitiveType);
 #if IGL_PLATFORM_IOS
@@ -383,6 +634,10 @@ void RenderCommandEncoder::drawIndexed(PrimitiveType primitiveType,
                                        int32_t baseVertex,
                                        uint32_t baseInstance) {
   getCommandBuffer().incrementCurrentDrawCount();
+  auto& stats = getCommandBuffer().mutableStatistics();
+  stats.instanceCount += instanceCount;
+  stats.estimatedPrimitiveCount += estimatedPrimitiveCount(primitiveType, indexCount) *
+                                   instanceCount;
   IGL_ASSERT(encoder_);
   auto& buffer = (Buffer&)(indexBuffer);
   MTLPrimitiveType metalPrimitive = convertPrimitiveType(primitiveType);
@@ -479,6 +734,26 @@ void RenderCommandEncoder::multiDrawIndexedIndirect(PrimitiveType primitiveType,
   }
 }
 
+void RenderCommandEncoder::multiDrawIndexedIndirectCount(PrimitiveType primitiveType,
+                                                         IndexFormat indexFormat,
+                                                         IBuffer& indexBuffer,
+                                                         IBuffer& indirectBuffer,
+                                                         size_t indirectBufferOffset,
+                                                         IBuffer& /*countBuffer*/,
+                                                         size_t /*countBufferOffset*/,
+                                                         uint32_t maxDrawCount,
+                                                         uint32_t stride) {
+  // Metal cannot read the draw count from a buffer without an MTLIndirectCommandBuffer; draw every
+  // command slot and rely on the producer zeroing out the commands of culled draws
+  multiDrawIndexedIndirect(primitiveType,
+                           indexFormat,
+                           indexBuffer,
+                           indirectBuffer,
+                           indirectBufferOffset,
+                           maxDrawCount,
+                           stride);
+}
+
 MTLPrimitiveType RenderCommandEncoder::convertPrimitiveType(PrimitiveType value) {
   switch (value) {
   case PrimitiveType::Point:
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#import <Metal/Metal.h>
+#include <mutex>
+#include <vector>
+
+namespace igl::metal {
+
+/// Pools MTLHeaps per storage mode and suballocates buffers and textures from them. Allocating
+/// from a heap is a cheap offset bump instead of a kernel round trip, which matters when
+/// resources are created and destroyed every frame, and memory released back to a heap is reused
+/// by subsequent allocations, so short-lived render targets share physical pages instead of each
+/// holding their own.
+///
+/// Heaps are created with tracked hazard mode, so suballocated resources keep the same implicit
+/// synchronization behavior as standalone allocations. Requests a heap cannot serve — oversized
+/// resources, storage modes heaps do not support, or OS versions without tracked heaps — return
+/// nil and the caller falls back to a standalone allocation.
+class ResourceHeapPool {
+ public:
+  explicit ResourceHeapPool(id<MTLDevice> device);
+
+  /// Returns a buffer suballocated from a pooled heap, or nil when the request cannot be served
+  /// from a heap.
+  id<MTLBuffer> newBuffer(NSUInteger length, MTLResourceOptions options);
+
+  /// Returns a texture suballocated from a pooled heap, or nil when the request cannot be served
+  /// from a heap.
+  id<MTLTexture> newTexture(MTLTextureDescriptor* descriptor);
+
+ private:
+  API_AVAILABLE(macos(10.15), ios(13.0))
+  id<MTLHeap> heapForAllocation(MTLSizeAndAlign sizeAndAlign, MTLStorageMode storageMode);
+
+  static bool isPoolableStorageMode(MTLStorageMode storageMode);
+
+  id<MTLDevice> device_;
+  struct Pool {
+    MTLStorageMode storageMode;
+    std::vector<id<MTLHeap>> heaps;
+  };
+  std::vector<Pool> pools_;
+  std::mutex mutex_;
+};
+
+} // namespace igl::metal
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <igl/metal/ResourceHeapPool.h>
+
+namespace igl::metal {
+namespace {
+
+// Heaps grow in fixed chunks; anything larger than a chunk is allocated standalone so one
+// oversized resource never pins a mostly-empty heap.
+constexpr NSUInteger kHeapChunkBytes = 32 * 1024 * 1024;
+
+} // namespace
+
+ResourceHeapPool::ResourceHeapPool(id<MTLDevice> device) : device_(device) {}
+
+bool ResourceHeapPool::isPoolableStorageMode(MTLStorageMode storageMode) {
+  // Managed resources need per-resource didModifyRange tracking and memoryless textures carry no
+  // backing memory to pool; both stay standalone.
+  return storageMode == MTLStorageModePrivate || storageMode == MTLStorageModeShared;
+}
+
+id<MTLBuffer> ResourceHeapPool::newBuffer(NSUInteger length, MTLResourceOptions options) {
+  if (@available(macOS 10.15, iOS 13.0, *)) {
+    const auto storageMode =
+        static_cast<MTLStorageMode>((options & MTLResourceStorageModeMask) >>
+                                    MTLResourceStorageModeShift);
+    if (!isPoolableStorageMode(storageMode)) {
+      return nil;
+    }
+    const MTLSizeAndAlign sizeAndAlign = [device_ heapBufferSizeAndAlignWithLength:length
+                                                                           options:options];
+    if (sizeAndAlign.size > kHeapChunkBytes) {
+      return nil;
+    }
+    const std::lock_guard<std::mutex> lock(mutex_);
+    id<MTLHeap> heap = heapForAllocation(sizeAndAlign, storageMode);
+    return heap != nil ? [heap newBufferWithLength:length options:options] : nil;
+  }
+  return nil;
+}
+
+id<MTLTexture> ResourceHeapPool::newTexture(MTLTextureDescriptor* descriptor) {
+  if (@available(macOS 10.15, iOS 13.0, *)) {
+    if (!isPoolableStorageMode(descriptor.storageMode)) {
+      return nil;
+    }
+    const MTLSizeAndAlign sizeAndAlign = [device_
+        heapTextureSizeAndAlignWithDescriptor:descriptor];
+    if (sizeAndAlign.size > kHeapChunkBytes) {
+      return nil;
+    }
+    const std::lock_guard<std::mutex> lock(mutex_);
+    id<MTLHeap> heap = heapForAllocation(sizeAndAlign, descriptor.storageMode);
+    return heap != nil ? [heap newTextureWithDescriptor:descriptor] : nil;
+  }
+  return nil;
+}
+
+id<MTLHeap> ResourceHeapPool::heapForAllocation(MTLSizeAndAlign sizeAndAlign,
+                                               MTLStorageMode storageMode) {
+  Pool* pool = nullptr;
+  for (auto& candidate : pools_) {
+    if (candidate.storageMode == storageMode) {
+      pool = &candidate;
+      break;
+    }
+  }
+  if (pool == nullptr) {
+    pools_.push_back({storageMode, {}});
+    pool = &pools_.back();
+  }
+
+  for (auto& heap : pool->heaps) {
+    if ([heap maxAvailableSizeWithAlignment:sizeAndAlign.align] >= sizeAndAlign.size) {
+      return heap;
+    }
+  }
+
+  MTLHeapDescriptor* heapDesc = [MTLHeapDescriptor new];
+  heapDesc.size = kHeapChunkBytes;
+  heapDesc.storageMode = storageMode;
+  heapDesc.type = MTLHeapTypeAutomatic;
+  // Heaps default to untracked hazards; keep Metal's implicit synchronization so suballocated
+  // resources behave exactly like standalone ones.
+  heapDesc.hazardTrackingMode = MTLHazardTrackingModeTracked;
+  id<MTLHeap> heap = [device_ newHeapWithDescriptor:heapDesc];
+  if (heap == nil) {
+    return nil;
+  }
+  pool->heaps.push_back(heap);
+  return heap;
+}
+
+} // namespace igl::metal
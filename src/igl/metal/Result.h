@@ -17,8 +17,9 @@ IGL_INLINE void setResultFrom(Result* outResult, const NSError* error) {
   if (outResult != nullptr) {
     if (error != nil) {
       outResult->code = Result::Code::RuntimeError;
+      // UTF8String is autoreleased storage, so copy it into an owning message
       const char* message = [error.localizedDescription UTF8String];
-      outResult->message = (message ? message : "");
+      outResult->message = std::string(message ? message : "");
     } else {
       outResult->code = Result::Code::Ok;
       outResult->message = "";
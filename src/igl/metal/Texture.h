@@ -44,6 +44,11 @@ class Texture final : public ITexture {
   bool isRequiredGenerateMipmap() const override;
   uint64_t getTextureId() const override;
 
+  /// Creates a zero-copy view through MTLTexture newTextureView. Format-changing views require
+  /// the parent to have been created with MTLTextureUsagePixelFormatView.
+  [[nodiscard]] std::shared_ptr<ITexture> createView(const TextureViewDesc& desc,
+                                                     Result* IGL_NULLABLE outResult) override;
+
   IGL_INLINE id<MTLTexture> _Nullable get() const {
     return (drawable_) ? drawable_.texture : value_;
   }
@@ -167,6 +167,60 @@ size_t Texture::toMetalBytesPerRow(size_t bytesPerRow) const {
   }
 }
 
+std::shared_ptr<ITexture> Texture::createView(const TextureViewDesc& desc,
+                                              Result* IGL_NULLABLE outResult) {
+  id<MTLTexture> texture = get();
+  if (!IGL_VERIFY(texture)) {
+    Result::setResult(
+        outResult, Result::Code::InvalidOperation, "The texture has not been created");
+    return nullptr;
+  }
+
+  const auto parentMipLevels = static_cast<uint32_t>([texture mipmapLevelCount]);
+  const auto parentSlices = [texture textureType] == MTLTextureTypeCube
+                                ? 6u
+                                : static_cast<uint32_t>([texture arrayLength]);
+  const uint32_t numMipLevels =
+      desc.numMipLevels == 0 ? parentMipLevels - desc.mipLevel : desc.numMipLevels;
+  const uint32_t numLayers = desc.numLayers == 0 ? parentSlices - desc.layer : desc.numLayers;
+  if (desc.mipLevel >= parentMipLevels || desc.mipLevel + numMipLevels > parentMipLevels ||
+      desc.layer >= parentSlices || desc.layer + numLayers > parentSlices) {
+    Result::setResult(outResult,
+                      Result::Code::ArgumentOutOfRange,
+                      "The view range is outside the parent texture");
+    return nullptr;
+  }
+
+  const MTLPixelFormat pixelFormat = desc.format == TextureFormat::Invalid
+                                         ? [texture pixelFormat]
+                                         : textureFormatToMTLPixelFormat(desc.format);
+
+  // a single-slice view of an array or cube texture becomes a plain 2D texture
+  MTLTextureType type = [texture textureType];
+  if ((type == MTLTextureType2DArray || type == MTLTextureTypeCube) && numLayers == 1) {
+    type = MTLTextureType2D;
+  }
+
+  id<MTLTexture> view =
+      [texture newTextureViewWithPixelFormat:pixelFormat
+                                 textureType:type
+                                      levels:NSMakeRange(desc.mipLevel, numMipLevels)
+                                      slices:NSMakeRange(desc.layer, numLayers)];
+  if (!view) {
+    Result::setResult(outResult,
+                      Result::Code::InvalidOperation,
+                      "Cannot create the MTLTexture view; format-changing views require the "
+                      "parent to allow MTLTextureUsagePixelFormatView");
+    return nullptr;
+  }
+  if (!desc.debugName.empty()) {
+    view.label = [NSString stringWithUTF8String:desc.debugName.c_str()];
+  }
+
+  Result::setOk(outResult);
+  return std::make_shared<Texture>(view, capabilities_);
+}
+
 Dimensions Texture::getDimensions() const {
   auto texture = get();
   return Dimensions{[texture width], [texture height], [texture depth]};
@@ -16,7 +16,7 @@ namespace ios {
 
 class Device final : public ::igl::metal::Device {
  public:
-  explicit Device(id<MTLDevice> device);
+  explicit Device(id<MTLDevice> device, size_t maxInFlightBuffers = kDefaultMaxInFlightBuffers);
   ~Device() override = default;
 
   std::shared_ptr<IFramebuffer> createFramebuffer(const FramebufferDesc& desc,
@@ -13,7 +13,8 @@ namespace igl {
 namespace metal {
 namespace macos {
 
-Device::Device(id<MTLDevice> device) : metal::Device(device) {}
+Device::Device(id<MTLDevice> device, size_t maxInFlightBuffers) :
+  metal::Device(device, maxInFlightBuffers) {}
 
 std::shared_ptr<IFramebuffer> Device::createFramebuffer(const FramebufferDesc& desc,
                                                         Result* outResult) {
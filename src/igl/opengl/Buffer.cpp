@@ -7,6 +7,8 @@
 
 #include <igl/opengl/Buffer.h>
 
+#include <cstring>
+
 #include <igl/CommandBuffer.h>
 #include <igl/Device.h>
 #include <igl/opengl/Errors.h>
@@ -28,7 +30,9 @@ ArrayBuffer::ArrayBuffer(IContext& context,
 }
 
 ArrayBuffer::~ArrayBuffer() {
-  if (iD_ != 0) {
+  if (!ringIds_.empty()) {
+    destroyRing();
+  } else if (iD_ != 0) {
     getContext().deleteBuffers(1, &iD_);
     getContext().unbindBuffer(target_);
     iD_ = 0;
@@ -60,13 +64,31 @@ void ArrayBuffer::initialize(const BufferDesc& desc, Result* outResult) {
     break;
   }
 
+  // explicit memory placement overrides the ResourceStorage-derived usage hint; GL has no direct
+  // heap control, so the placement only steers the driver's usage heuristic
+  switch (desc.placement) {
+  case MemoryPlacement::Default:
+    break;
+  case MemoryPlacement::DeviceLocal:
+    usage = GL_STATIC_DRAW;
+    isDynamic_ = false;
+    break;
+  case MemoryPlacement::HostUpload:
+  case MemoryPlacement::DeviceLocalHostVisible:
+    usage = GL_DYNAMIC_DRAW;
+    isDynamic_ = true;
+    break;
+  case MemoryPlacement::Readback:
+    usage = GL_DYNAMIC_READ;
+    isDynamic_ = true;
+    break;
+  }
+
   if (!isDynamic_ && desc.data == nullptr) {
     Result::setResult(outResult, Result::Code::ArgumentNull, "data is null");
     return;
   }
 
-  getContext().genBuffers(1, &iD_);
-
   if (desc.type & BufferDesc::BufferTypeBits::Storage) {
     if (getContext().deviceFeatures().hasFeature(DeviceFeatures::Compute)) {
       target_ = GL_SHADER_STORAGE_BUFFER;
@@ -85,6 +107,18 @@ void ArrayBuffer::initialize(const BufferDesc& desc, Result* outResult) {
 
   size_ = desc.length;
 
+  // a persistently mapped ring writes frequently updated data through coherent pointers instead
+  // of glBufferSubData, so the driver never has to stall on (or ghost) in-flight frames. Fall
+  // through to the plain mutable allocation when the ring cannot be created.
+  if ((desc.hint & BufferDesc::BufferAPIHintBits::Ring) && isDynamic_ &&
+      getContext().deviceFeatures().hasInternalFeature(InternalFeatures::BufferStorage) &&
+      getContext().deviceFeatures().hasInternalFeature(InternalFeatures::Sync)) {
+    if (initializeRing(desc, outResult)) {
+      return;
+    }
+  }
+
+  getContext().genBuffers(1, &iD_);
   getContext().bindBuffer(target_, iD_);
   getContext().bufferData(target_, size_, desc.data, usage);
 
@@ -113,6 +147,123 @@ void ArrayBuffer::initialize(const BufferDesc& desc, Result* outResult) {
   Result::setOk(outResult);
 }
 
+// create one immutable, persistently mapped buffer per ring segment. Every segment starts with
+// the same contents so partial uploads can carry the untouched regions forward. Returns false
+// (with any partially created segments destroyed) when the driver rejects the storage or the
+// mapping, so initialize() can fall back to the regular mutable allocation
+bool ArrayBuffer::initializeRing(const BufferDesc& desc, Result* outResult) {
+  // GL_MAP_READ_BIT lets partial uploads copy forward from the previous segment
+  const GLbitfield accessFlags =
+      GL_MAP_READ_BIT | GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+  const GLbitfield storageFlags = accessFlags | GL_DYNAMIC_STORAGE_BIT;
+
+  ringIds_.resize(kRingSegmentCount, 0);
+  ringPtrs_.resize(kRingSegmentCount, nullptr);
+  ringFences_.resize(kRingSegmentCount, nullptr);
+
+  getContext().genBuffers(static_cast<GLsizei>(kRingSegmentCount), ringIds_.data());
+
+  for (size_t i = 0; i < kRingSegmentCount; ++i) {
+    getContext().bindBuffer(target_, ringIds_[i]);
+    getContext().bufferStorage(target_, size_, desc.data, storageFlags);
+
+    GLint bufferSize = 0;
+    getContext().getBufferParameteriv(target_, GL_BUFFER_SIZE, &bufferSize);
+
+    // mapped at offset 0, so the persistent pointer carries the GL MIN_MAP_BUFFER_ALIGNMENT
+    // guarantee (at least 64 bytes, matching IBuffer::kMapAlignment) for SIMD writers
+    void* ptr = bufferSize == size_
+                    ? getContext().mapBufferRange(target_, 0, size_, accessFlags)
+                    : nullptr;
+    if (ptr == nullptr) {
+      getContext().bindBuffer(target_, 0);
+      destroyRing();
+      return false;
+    }
+    ringPtrs_[i] = static_cast<uint8_t*>(ptr);
+
+    if (!desc.debugName.empty() &&
+        getContext().deviceFeatures().hasInternalFeature(InternalFeatures::DebugLabel)) {
+      GLenum identifier = getContext().deviceFeatures().hasInternalRequirement(
+                              InternalRequirement::DebugLabelExtEnumsReq)
+                              ? GL_BUFFER_OBJECT_EXT
+                              : GL_BUFFER;
+      getContext().objectLabel(
+          identifier, ringIds_[i], desc.debugName.size(), desc.debugName.c_str());
+    }
+  }
+
+  getContext().bindBuffer(target_, 0);
+
+  ringIndex_ = 0;
+  iD_ = ringIds_[0];
+  acceptedApiHints_ |= BufferDesc::BufferAPIHintBits::Ring;
+
+  Result::setOk(outResult);
+  return true;
+}
+
+void ArrayBuffer::destroyRing() {
+  for (GLsync& fence : ringFences_) {
+    if (fence != nullptr) {
+      getContext().deleteSync(fence);
+      fence = nullptr;
+    }
+  }
+  // deleting the buffers also releases their persistent mappings
+  getContext().deleteBuffers(static_cast<GLsizei>(ringIds_.size()), ringIds_.data());
+  getContext().unbindBuffer(target_);
+  ringIds_.clear();
+  ringPtrs_.clear();
+  ringFences_.clear();
+  ringIndex_ = 0;
+  iD_ = 0;
+}
+
+Result ArrayBuffer::uploadRing(const void* data, const BufferRange& range) {
+  if (range.size + range.offset > size_) {
+    return Result(Result::Code::ArgumentOutOfRange,
+                  "upload() size + offset must be <= buffer size");
+  }
+
+  // guard the segment being left behind: everything submitted up to now may still read from it
+  const size_t previous = ringIndex_;
+  if (ringFences_[previous] != nullptr) {
+    getContext().deleteSync(ringFences_[previous]);
+  }
+  ringFences_[previous] = getContext().fenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+  ringIndex_ = (ringIndex_ + 1) % ringIds_.size();
+  iD_ = ringIds_[ringIndex_];
+
+  if (ringFences_[ringIndex_] != nullptr) {
+    // the GPU may still be reading this segment from the frame it was last used in
+    constexpr uint64_t kFenceTimeoutNs = 1000000000ull; // 1 second
+    IGL_MAYBE_UNUSED const GLenum status = getContext().clientWaitSync(
+        ringFences_[ringIndex_], GL_SYNC_FLUSH_COMMANDS_BIT, kFenceTimeoutNs);
+    IGL_ASSERT_MSG(status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED,
+                   "Timed out waiting for a ring buffer segment");
+    getContext().deleteSync(ringFences_[ringIndex_]);
+    ringFences_[ringIndex_] = nullptr;
+  }
+
+  // a partial update carries the untouched regions forward from the last written segment
+  uint8_t* dst = ringPtrs_[ringIndex_];
+  const uint8_t* src = ringPtrs_[previous];
+  if (range.offset > 0) {
+    memcpy(dst, src, range.offset);
+  }
+  const size_t end = range.offset + range.size;
+  if (end < size_) {
+    memcpy(dst + end, src + end, size_ - end);
+  }
+  if (data != nullptr) {
+    memcpy(dst + range.offset, data, range.size);
+  }
+
+  return Result();
+}
+
 // upload data to the buffer at the given offset with the given size
 Result ArrayBuffer::upload(const void* data, const BufferRange& range) {
   // static buffers can only upload data once during creation
@@ -120,6 +271,17 @@ Result ArrayBuffer::upload(const void* data, const BufferRange& range) {
     return Result(Result::Code::InvalidOperation, "Can't upload to static buffers");
   }
 
+  if (!ringIds_.empty()) {
+    return uploadRing(data, range);
+  }
+
+  // Small per-frame updates are dominated by the bind/unbind around them; update the buffer by
+  // name when direct state access is available
+  if (getContext().deviceFeatures().hasInternalFeature(InternalFeatures::DirectStateAccess)) {
+    getContext().namedBufferSubData(iD_, range.offset, range.size, data);
+    return Result();
+  }
+
   getContext().bindBuffer(target_, iD_);
 
   getContext().bufferSubData(target_, range.offset, range.size, data);
@@ -136,6 +298,13 @@ void* ArrayBuffer::map(const BufferRange& range, Result* outResult) {
     return nullptr;
   }
 
+  if (!ringIds_.empty()) {
+    // the ring is persistently mapped; hand out the current segment directly. upload() remains
+    // the synchronized write path
+    Result::setOk(outResult);
+    return ringPtrs_[ringIndex_] + range.offset;
+  }
+
   bind();
 
   void* srcData = nullptr;
@@ -151,6 +320,10 @@ void* ArrayBuffer::map(const BufferRange& range, Result* outResult) {
 }
 
 void ArrayBuffer::unmap() {
+  if (!ringIds_.empty()) {
+    // persistent mappings stay mapped for the lifetime of the buffer
+    return;
+  }
   bind();
   getContext().unmapBuffer(target_);
 }
@@ -59,7 +59,7 @@ class ArrayBuffer : public Buffer {
   void unmap() override;
 
   BufferDesc::BufferAPIHint acceptedApiHints() const noexcept override {
-    return 0;
+    return acceptedApiHints_;
   }
 
   ResourceStorage storage() const noexcept override {
@@ -100,9 +100,27 @@ class ArrayBuffer : public Buffer {
   GLenum target_;
 
  private:
+  // BufferAPIHintBits::Ring: creates one persistently mapped, immutable segment per in-flight
+  // frame and rotates them on upload(), guarding each segment with a fence instead of relying on
+  // the driver to synchronize (or ghost) a single mutable buffer
+  bool initializeRing(const BufferDesc& desc, Result* outResult);
+  Result uploadRing(const void* data, const BufferRange& range);
+  void destroyRing();
+
   size_t size_;
 
   bool isDynamic_;
+
+  BufferDesc::BufferAPIHint acceptedApiHints_ = 0;
+
+  // ring segment GL ids, persistent pointers and guard fences; empty when not in ring mode.
+  // iD_ always refers to the segment currently exposed through getId()/bind()
+  std::vector<GLuint> ringIds_;
+  std::vector<uint8_t*> ringPtrs_;
+  std::vector<GLsync> ringFences_;
+  size_t ringIndex_ = 0;
+
+  static constexpr size_t kRingSegmentCount = 3;
 };
 
 class UniformBlockBuffer : public ArrayBuffer {
@@ -121,7 +139,7 @@ class UniformBlockBuffer : public ArrayBuffer {
   void bindRange(size_t index, size_t offset, Result* outResult);
 
   BufferDesc::BufferAPIHint acceptedApiHints() const noexcept override {
-    return BufferDesc::BufferAPIHintBits::UniformBlock;
+    return BufferDesc::BufferAPIHintBits::UniformBlock | ArrayBuffer::acceptedApiHints();
   }
 };
 
@@ -29,7 +29,9 @@ std::unique_ptr<IRenderCommandEncoder> CommandBuffer::createRenderCommandEncoder
 }
 
 std::unique_ptr<IComputeCommandEncoder> CommandBuffer::createComputeCommandEncoder() {
-  return std::make_unique<ComputeCommandEncoder>(shared_from_this()->getContext());
+  auto commandBuffer = shared_from_this();
+  auto& context = commandBuffer->getContext();
+  return std::make_unique<ComputeCommandEncoder>(std::move(commandBuffer), context);
 }
 
 void CommandBuffer::present(std::shared_ptr<ITexture> surface) const {
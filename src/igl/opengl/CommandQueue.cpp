@@ -18,6 +18,9 @@ namespace igl {
 namespace opengl {
 
 void CommandQueue::setInitialContext(std::shared_ptr<IContext> context) {
+  if (context != context_) {
+    commandBufferPool_.clear();
+  }
   context_ = std::move(context);
 }
 
@@ -31,7 +34,21 @@ std::shared_ptr<ICommandBuffer> CommandQueue::createCommandBuffer(const CommandB
     return nullptr;
   }
 
+  // recycle a pooled wrapper that the client has released (only the pool holds a reference), so
+  // a steady-state frame loop performs no heap allocations for command buffers
+  for (const std::shared_ptr<CommandBuffer>& pooled : commandBufferPool_) {
+    if (pooled.use_count() == 1) {
+      pooled->mutableStatistics() = {};
+      activeCommandBuffers_++;
+      Result::setOk(outResult);
+      return pooled;
+    }
+  }
+
   auto commandBuffer = std::make_shared<CommandBuffer>(context_);
+  if (commandBufferPool_.size() < kMaxPooledCommandBuffers) {
+    commandBufferPool_.push_back(commandBuffer);
+  }
   activeCommandBuffers_++;
   Result::setOk(outResult);
 
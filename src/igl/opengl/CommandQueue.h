@@ -9,8 +9,12 @@
 
 #include <igl/CommandQueue.h>
 
+#include <memory>
+#include <vector>
+
 namespace igl {
 namespace opengl {
+class CommandBuffer;
 class IContext;
 class Device;
 
@@ -25,6 +29,14 @@ class CommandQueue final : public ICommandQueue {
  private:
   std::shared_ptr<IContext> context_;
   uint32_t activeCommandBuffers_ = 0;
+
+  // Upper bound on pooled CommandBuffer wrappers; buffers created beyond it are handed out
+  // unpooled
+  static constexpr size_t kMaxPooledCommandBuffers = 8;
+
+  // Recycled CommandBuffer wrappers; an entry is available for reuse when the pool holds the
+  // only remaining reference. Cleared when the context changes
+  std::vector<std::shared_ptr<CommandBuffer>> commandBufferPool_;
 };
 
 } // namespace opengl
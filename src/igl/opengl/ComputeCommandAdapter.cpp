@@ -123,7 +123,7 @@ void ComputeCommandAdapter::willDispatch() {
   }
 
   // Bind uniforms to be used for compute
-  uniformAdapter_.bindToPipeline(getContext());
+  uniformAdapter_.bindToPipeline(getContext(), pipelineState);
 
   for (size_t index = 0; index < textureStates_.size(); index++) {
     if (!IS_DIRTY(textureStatesDirty_, index)) {
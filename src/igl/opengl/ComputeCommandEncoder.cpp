@@ -9,6 +9,7 @@
 
 #include <algorithm>
 #include <array>
+#include <igl/CommandBuffer.h>
 #include <igl/opengl/Buffer.h>
 #include <igl/opengl/ComputeCommandAdapter.h>
 #include <igl/opengl/Device.h>
@@ -25,7 +26,9 @@ namespace opengl {
 ///----------------------------------------------------------------------------
 /// MARK: - ComputeCommandEncoder
 
-ComputeCommandEncoder::ComputeCommandEncoder(IContext& context) : WithContext(context) {
+ComputeCommandEncoder::ComputeCommandEncoder(std::shared_ptr<ICommandBuffer> commandBuffer,
+                                             IContext& context) :
+  IComputeCommandEncoder(std::move(commandBuffer)), WithContext(context) {
   auto& oglContext = getContext();
 
   auto& pool = oglContext.getComputeAdapterPool();
@@ -50,6 +53,7 @@ void ComputeCommandEncoder::bindComputePipelineState(
     const std::shared_ptr<IComputePipelineState>& pipelineState) {
   if (IGL_VERIFY(adapter_)) {
     adapter_->setPipelineState(pipelineState);
+    getCommandBuffer().mutableStatistics().pipelineBindCount++;
   }
 }
 
@@ -58,6 +62,7 @@ void ComputeCommandEncoder::dispatchThreadGroups(const Dimensions& threadgroupCo
                                                  const Dependencies& /*dependencies*/) {
   if (IGL_VERIFY(adapter_)) {
     adapter_->dispatchThreadGroups(threadgroupCount, threadgroupSize);
+    getCommandBuffer().mutableStatistics().dispatchCount++;
   }
 }
 
@@ -112,6 +117,7 @@ void ComputeCommandEncoder::bindUniform(const UniformDesc& uniformDesc, const vo
 void ComputeCommandEncoder::bindTexture(size_t index, ITexture* texture) {
   if (IGL_VERIFY(adapter_)) {
     adapter_->setTexture(texture, index);
+    getCommandBuffer().mutableStatistics().textureBindCount++;
   }
 }
 
@@ -121,6 +127,7 @@ void ComputeCommandEncoder::bindBuffer(size_t index,
   if (IGL_VERIFY(adapter_) && buffer) {
     auto glBuffer = std::static_pointer_cast<Buffer>(buffer);
     adapter_->setBuffer(glBuffer, offset, static_cast<int>(index));
+    getCommandBuffer().mutableStatistics().bufferBindCount++;
   }
 }
 
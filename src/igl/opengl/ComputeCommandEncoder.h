@@ -27,7 +27,7 @@ class ComputeCommandAdapter;
 
 class ComputeCommandEncoder final : public IComputeCommandEncoder, public WithContext {
  public:
-  explicit ComputeCommandEncoder(IContext& context);
+  ComputeCommandEncoder(std::shared_ptr<ICommandBuffer> commandBuffer, IContext& context);
   ~ComputeCommandEncoder() override;
   void bindComputePipelineState(
       const std::shared_ptr<IComputePipelineState>& pipelineState) override;
@@ -19,6 +19,26 @@ DepthStencilState::DepthStencilState(IContext& context) : WithContext(context) {
 Result DepthStencilState::create(const DepthStencilStateDesc& desc) {
   desc_ = desc;
 
+  // resolve all enum translation now; bind() just replays the stored values
+  gl_.depthFunc = convertCompareFunction(desc_.compareFunction);
+  // https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glDepthFunc.xhtml
+  // In order to unconditionally write to the depth buffer, the depth test should
+  // be enabled and set to GL_ALWAYS
+  gl_.depthTestEnabled =
+      desc_.isDepthWriteEnabled || desc_.compareFunction != CompareFunction::AlwaysPass;
+  gl_.stencilTestEnabled = desc_.frontFaceStencil != igl::StencilStateDesc() ||
+                           desc_.backFaceStencil != igl::StencilStateDesc();
+  gl_.frontCompareFunc = convertCompareFunction(desc_.frontFaceStencil.stencilCompareFunction);
+  gl_.backCompareFunc = convertCompareFunction(desc_.backFaceStencil.stencilCompareFunction);
+  gl_.frontStencilFailOp = convertStencilOperation(desc_.frontFaceStencil.stencilFailureOperation);
+  gl_.frontDepthFailOp = convertStencilOperation(desc_.frontFaceStencil.depthFailureOperation);
+  gl_.frontDepthStencilPassOp =
+      convertStencilOperation(desc_.frontFaceStencil.depthStencilPassOperation);
+  gl_.backStencilFailOp = convertStencilOperation(desc_.backFaceStencil.stencilFailureOperation);
+  gl_.backDepthFailOp = convertStencilOperation(desc_.backFaceStencil.depthFailureOperation);
+  gl_.backDepthStencilPassOp =
+      convertStencilOperation(desc_.backFaceStencil.depthStencilPassOperation);
+
   return Result();
 }
 
@@ -76,39 +96,29 @@ GLenum DepthStencilState::convertStencilOperation(igl::StencilOperation value) {
 }
 
 void DepthStencilState::bind() {
+  // all enum translation happened in create(); this only replays the resolved values
   getContext().depthMask(desc_.isDepthWriteEnabled);
 
-  // https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glDepthFunc.xhtml
-  // In order to unconditionally write to the depth buffer, the depth test should
-  // be enabled and set to GL_ALWAYS
-  if (desc_.isDepthWriteEnabled || desc_.compareFunction != CompareFunction::AlwaysPass) {
+  if (gl_.depthTestEnabled) {
     getContext().enable(GL_DEPTH_TEST);
   } else {
     getContext().disable(GL_DEPTH_TEST);
   }
-  getContext().depthFunc(convertCompareFunction(desc_.compareFunction));
+  getContext().depthFunc(gl_.depthFunc);
 
-  if (desc_.frontFaceStencil != igl::StencilStateDesc() ||
-      desc_.backFaceStencil != igl::StencilStateDesc()) {
+  if (gl_.stencilTestEnabled) {
     getContext().enable(GL_STENCIL_TEST);
 
-    GLuint mask{0xff};
-    GLenum frontCompareFunc = convertCompareFunction(desc_.frontFaceStencil.stencilCompareFunction);
-    GLenum backCompareFunc = convertCompareFunction(desc_.backFaceStencil.stencilCompareFunction);
+    const GLuint mask{0xff};
     getContext().stencilFuncSeparate(
-        GL_FRONT, frontCompareFunc, desc_.frontFaceStencil.readMask, mask);
+        GL_FRONT, gl_.frontCompareFunc, desc_.frontFaceStencil.readMask, mask);
     getContext().stencilFuncSeparate(
-        GL_BACK, backCompareFunc, desc_.backFaceStencil.readMask, mask);
-
-    GLenum sfail = convertStencilOperation(desc_.backFaceStencil.stencilFailureOperation);
-    GLenum dpfail = convertStencilOperation(desc_.backFaceStencil.depthFailureOperation);
-    GLenum dppass = convertStencilOperation(desc_.backFaceStencil.depthStencilPassOperation);
-    getContext().stencilOpSeparate(GL_BACK, sfail, dpfail, dppass);
+        GL_BACK, gl_.backCompareFunc, desc_.backFaceStencil.readMask, mask);
 
-    sfail = convertStencilOperation(desc_.frontFaceStencil.stencilFailureOperation);
-    dpfail = convertStencilOperation(desc_.frontFaceStencil.depthFailureOperation);
-    dppass = convertStencilOperation(desc_.frontFaceStencil.depthStencilPassOperation);
-    getContext().stencilOpSeparate(GL_FRONT, sfail, dpfail, dppass);
+    getContext().stencilOpSeparate(
+        GL_BACK, gl_.backStencilFailOp, gl_.backDepthFailOp, gl_.backDepthStencilPassOp);
+    getContext().stencilOpSeparate(
+        GL_FRONT, gl_.frontStencilFailOp, gl_.frontDepthFailOp, gl_.frontDepthStencilPassOp);
 
     getContext().stencilMaskSeparate(GL_BACK, desc_.backFaceStencil.writeMask);
     getContext().stencilMaskSeparate(GL_FRONT, desc_.frontFaceStencil.writeMask);
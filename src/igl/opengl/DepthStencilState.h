@@ -36,6 +36,24 @@ class DepthStencilState final : public WithContext, public IDepthStencilState {
 
  private:
   DepthStencilStateDesc desc_;
+
+  // GL enums resolved once at create() so bind() issues ready-to-submit values instead of
+  // translating the desc on every bind. The stencil read/write masks stay in desc_ because
+  // setStencilReferenceValue() can change them after creation and they need no translation.
+  struct ResolvedState {
+    GLenum depthFunc = GL_LESS;
+    bool depthTestEnabled = true;
+    bool stencilTestEnabled = false;
+    GLenum frontCompareFunc = GL_ALWAYS;
+    GLenum backCompareFunc = GL_ALWAYS;
+    GLenum frontStencilFailOp = GL_KEEP;
+    GLenum frontDepthFailOp = GL_KEEP;
+    GLenum frontDepthStencilPassOp = GL_KEEP;
+    GLenum backStencilFailOp = GL_KEEP;
+    GLenum backDepthFailOp = GL_KEEP;
+    GLenum backDepthStencilPassOp = GL_KEEP;
+  };
+  ResolvedState gl_;
 };
 
 } // namespace opengl
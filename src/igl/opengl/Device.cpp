@@ -222,6 +222,7 @@ std::shared_ptr<IVertexInputState> Device::createVertexInputState(const VertexIn
 // Pipelines
 std::shared_ptr<IRenderPipelineState> Device::createRenderPipeline(const RenderPipelineDesc& desc,
                                                                    Result* outResult) const {
+  recordPipelineUsage(desc);
   Result res;
   auto resource = std::make_shared<RenderPipelineState>(getContext(), desc, &res);
   return verifyResult(resource, res, outResult);
@@ -297,6 +298,10 @@ void Device::beginScope() {
   IGL_ASSERT(context_);
   context_->setCurrent();
 
+  // external rendering may have changed GL state since the last scope; drop the shadowed state
+  // so redundant-call elimination never elides against stale values
+  context_->invalidateCachedState();
+
   // UnbindPolicy is fixed for duration of this scope
   cachedUnbindPolicy_ = getContext().getUnbindPolicy();
 }
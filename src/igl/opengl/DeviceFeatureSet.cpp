@@ -11,6 +11,7 @@
 #include <igl/opengl/GLIncludes.h>
 #include <igl/opengl/IContext.h>
 #include <igl/opengl/Texture.h>
+#include <sstream>
 
 namespace igl::opengl {
 namespace {
@@ -102,12 +103,130 @@ DeviceFeatureSet::DeviceFeatureSet(IContext& glContext) : glContext_(glContext)
 
 void DeviceFeatureSet::initializeVersion(GLVersion version) {
   version_ = version;
+  invalidateCapabilityCaches();
 }
 
 void DeviceFeatureSet::initializeExtensions(std::string extensions,
                                             std::unordered_set<std::string> supportedExtensions) {
   extensions_ = std::move(extensions);
   supportedExtensions_ = std::move(supportedExtensions);
+  invalidateCapabilityCaches();
+  precomputeCapabilities();
+}
+
+void DeviceFeatureSet::invalidateCapabilityCaches() {
+  extensionCache_ = 0;
+  extensionCacheInitialized_ = 0;
+  featureCache_ = 0;
+  featureCacheInitialized_ = 0;
+  internalFeatureCache_ = 0;
+  internalFeatureCacheInitialized_ = 0;
+  textureFeatureCache_ = 0;
+  textureFeatureCacheInitialized_ = 0;
+  textureCapabilityCache_.clear();
+}
+
+void DeviceFeatureSet::precomputeCapabilities() {
+  // Populate every capability cache up front so hot-path queries (texture creation, render
+  // command setup) are a single cached bit test instead of hitting version comparisons and
+  // extension string searches on first use. The loops run through the last enumerator of each
+  // enum; any value added after it just falls back to the lazy path in the accessors.
+  for (uint64_t i = 0; i <= static_cast<uint64_t>(Extensions::VertexAttribDivisor); ++i) {
+    hasExtension(static_cast<Extensions>(i));
+  }
+  for (uint64_t i = 0; i <= static_cast<uint64_t>(DeviceFeatures::ValidationLayersEnabled); ++i) {
+    hasFeature(static_cast<DeviceFeatures>(i));
+  }
+  for (uint32_t i = 0; i <= static_cast<uint32_t>(InternalFeatures::VertexAttribDivisor); ++i) {
+    hasInternalFeature(static_cast<InternalFeatures>(i));
+  }
+  for (uint64_t i = 0; i <= static_cast<uint64_t>(TextureFeatures::TextureTypeUInt8888Rev); ++i) {
+    hasTextureFeature(static_cast<TextureFeatures>(i));
+  }
+}
+
+namespace {
+// bump whenever the serialized layout or the meaning of any capability cache bit changes (e.g.
+// when an enumerator is added in the middle of Extensions/DeviceFeatures/InternalFeatures/
+// TextureFeatures); stale blobs are rejected and re-probed
+constexpr int kCapabilityCacheSchemaVersion = 2;
+} // namespace
+
+std::string DeviceFeatureSet::serializeCapabilities() const {
+  std::ostringstream out;
+  out << "IGLCapabilityCache " << kCapabilityCacheSchemaVersion << '\n';
+  out << static_cast<int>(version_) << '\n';
+  out << extensionCache_ << ' ' << extensionCacheInitialized_ << ' ' << featureCache_ << ' '
+      << featureCacheInitialized_ << ' ' << internalFeatureCache_ << ' '
+      << internalFeatureCacheInitialized_ << ' ' << textureFeatureCache_ << ' '
+      << textureFeatureCacheInitialized_ << '\n';
+  out << extensions_ << '\n';
+  out << supportedExtensions_.size() << '\n';
+  for (const auto& extension : supportedExtensions_) {
+    out << extension << '\n';
+  }
+  return out.str();
+}
+
+bool DeviceFeatureSet::restoreCapabilities(const std::string& data) {
+  std::istringstream in(data);
+
+  std::string magic;
+  int schemaVersion = 0;
+  int version = 0;
+  if (!(in >> magic >> schemaVersion >> version) || magic != "IGLCapabilityCache" ||
+      schemaVersion != kCapabilityCacheSchemaVersion ||
+      version != static_cast<int>(version_)) {
+    return false;
+  }
+
+  uint64_t extensionCache = 0;
+  uint64_t extensionCacheInitialized = 0;
+  uint64_t featureCache = 0;
+  uint64_t featureCacheInitialized = 0;
+  uint32_t internalFeatureCache = 0;
+  uint32_t internalFeatureCacheInitialized = 0;
+  uint64_t textureFeatureCache = 0;
+  uint64_t textureFeatureCacheInitialized = 0;
+  if (!(in >> extensionCache >> extensionCacheInitialized >> featureCache >>
+        featureCacheInitialized >> internalFeatureCache >> internalFeatureCacheInitialized >>
+        textureFeatureCache >> textureFeatureCacheInitialized)) {
+    return false;
+  }
+  in.ignore(); // the newline after the cache words
+
+  std::string extensions;
+  if (!std::getline(in, extensions)) {
+    return false;
+  }
+
+  size_t numExtensions = 0;
+  if (!(in >> numExtensions)) {
+    return false;
+  }
+  in.ignore();
+  std::unordered_set<std::string> supportedExtensions;
+  supportedExtensions.reserve(numExtensions);
+  for (size_t i = 0; i < numExtensions; ++i) {
+    std::string extension;
+    if (!std::getline(in, extension) || extension.empty()) {
+      return false;
+    }
+    supportedExtensions.insert(std::move(extension));
+  }
+
+  extensions_ = std::move(extensions);
+  supportedExtensions_ = std::move(supportedExtensions);
+  textureCapabilityCache_.clear();
+  extensionCache_ = extensionCache;
+  extensionCacheInitialized_ = extensionCacheInitialized;
+  featureCache_ = featureCache;
+  featureCacheInitialized_ = featureCacheInitialized;
+  internalFeatureCache_ = internalFeatureCache;
+  internalFeatureCacheInitialized_ = internalFeatureCacheInitialized;
+  textureFeatureCache_ = textureFeatureCache;
+  textureFeatureCacheInitialized_ = textureFeatureCacheInitialized;
+  return true;
 }
 
 GLVersion DeviceFeatureSet::getGLVersion() const noexcept {
@@ -134,6 +253,8 @@ bool DeviceFeatureSet::isExtensionSupported(Extensions extension) const {
     return hasDesktopExtension(*this, "GL_ARB_bindless_texture");
   case Extensions::BindlessTextureNv:
     return hasDesktopOrESExtension(*this, "GL_NV_bindless_texture");
+  case Extensions::BufferStorage:
+    return hasESExtension(*this, "GL_EXT_buffer_storage");
   case Extensions::Debug:
     return hasDesktopOrESExtension(*this, "GL_KHR_debug");
   case Extensions::DebugLabel:
@@ -162,12 +283,19 @@ bool DeviceFeatureSet::isExtensionSupported(Extensions extension) const {
     return hasESExtension(*this, "GL_OES_mapbuffer");
   case Extensions::MapBufferRange:
     return hasESExtension(*this, "GL_EXT_map_buffer_range");
+  case Extensions::MultiDraw:
+    // WEBGL_multi_draw surfaces as GL_ANGLE_multi_draw through Emscripten
+    return hasDesktopOrESExtension(*this, "GL_ANGLE_multi_draw");
+  case Extensions::MultiDrawIndirect:
+    return hasESExtension(*this, "GL_EXT_multi_draw_indirect");
   case Extensions::MultiSampleApple:
     return hasESExtension(*this, "GL_APPLE_framebuffer_multisample");
   case Extensions::MultiSampleExt:
     return hasESExtension(*this, "GL_EXT_multisampled_render_to_texture");
   case Extensions::MultiSampleImg:
     return hasESExtension(*this, "GL_IMG_multisampled_render_to_texture");
+  case Extensions::ParallelShaderCompile:
+    return hasDesktopOrESExtension(*this, "GL_KHR_parallel_shader_compile");
   case Extensions::RequiredInternalFormat:
     return hasESExtension(*this, "GL_OES_required_internalformat");
   case Extensions::ShaderImageLoadStore:
@@ -371,6 +499,14 @@ bool DeviceFeatureSet::isFeatureSupported(DeviceFeatures feature) const {
     return hasDesktopOrESVersionOrExtension(
         *this, GLVersion::v4_0, GLVersion::v3_1_ES, "GL_ARB_draw_indirect");
 
+  case DeviceFeatures::DrawIndirectCount:
+    return false;
+
+  // glTextureView requires immutable storage (glTexStorage*), which the GL backend does not
+  // guarantee for its textures
+  case DeviceFeatures::TextureViews:
+    return false;
+
   case DeviceFeatures::ValidationLayersEnabled:
     return false;
   }
@@ -380,6 +516,10 @@ bool DeviceFeatureSet::isFeatureSupported(DeviceFeatures feature) const {
 
 bool DeviceFeatureSet::isInternalFeatureSupported(InternalFeatures feature) const {
   switch (feature) {
+  case InternalFeatures::BufferStorage:
+    return hasDesktopVersionOrExtension(*this, GLVersion::v4_4, "GL_ARB_buffer_storage") ||
+           hasExtension(Extensions::BufferStorage);
+
   case InternalFeatures::ClearDepthf:
     return hasDesktopOrESVersion(*this, GLVersion::v4_1, GLVersion::v2_0_ES);
 
@@ -395,6 +535,9 @@ bool DeviceFeatureSet::isInternalFeatureSupported(InternalFeatures feature) cons
     return hasDesktopOrESVersion(*this, GLVersion::v4_3, GLVersion::v3_2_ES) ||
            hasExtension(Extensions::Debug);
 
+  case InternalFeatures::DirectStateAccess:
+    return hasDesktopVersionOrExtension(*this, GLVersion::v4_5, "GL_ARB_direct_state_access");
+
   case InternalFeatures::FramebufferBlit:
     // TODO: Add support for GL_ANGLE_framebuffer_blit
     return hasDesktopOrESVersionOrExtension(
@@ -405,6 +548,10 @@ bool DeviceFeatureSet::isInternalFeatureSupported(InternalFeatures feature) cons
     return hasDesktopOrESVersion(*this, GLVersion::v3_0, GLVersion::v2_0_ES) ||
            hasExtension(Extensions::FramebufferObject);
 
+  case InternalFeatures::GetProgramBinary:
+    return hasDesktopOrESVersion(*this, GLVersion::v4_1, GLVersion::v3_0_ES) ||
+           hasDesktopExtension(*this, "GL_ARB_get_program_binary");
+
   case InternalFeatures::GetStringi:
     return hasDesktopOrESVersion(*this, GLVersion::v3_0, GLVersion::v3_0_ES);
 
@@ -416,6 +563,18 @@ bool DeviceFeatureSet::isInternalFeatureSupported(InternalFeatures feature) cons
   case InternalFeatures::MapBuffer:
     return hasDesktopVersion(*this, GLVersion::v2_0) || hasExtension(Extensions::MapBuffer);
 
+  case InternalFeatures::MultiDraw:
+    // glMultiDrawArrays/glMultiDrawElements are core since desktop GL 1.4; on ES they only come
+    // from GL_ANGLE_multi_draw
+    return hasDesktopVersion(*this, GLVersion::v2_0) || hasExtension(Extensions::MultiDraw);
+
+  case InternalFeatures::MultiDrawIndirect:
+    return hasDesktopVersionOrExtension(*this, GLVersion::v4_3, "GL_ARB_multi_draw_indirect") ||
+           hasExtension(Extensions::MultiDrawIndirect);
+
+  case InternalFeatures::ParallelShaderCompile:
+    return hasExtension(Extensions::ParallelShaderCompile);
+
   case InternalFeatures::PixelBufferObject:
     return hasDesktopOrESVersionOrExtension(*this,
                                             GLVersion::v2_1,
@@ -876,6 +1035,10 @@ bool DeviceFeatureSet::hasInternalRequirement(InternalRequirement requirement) c
   case InternalRequirement::ColorTexImageRgb5A1Unsized:
     return usesOpenGLES() && !hasESVersion(*this, GLVersion::v3_0_ES);
 
+  case InternalRequirement::BufferStorageExtReq:
+    // OpenGL ES only exposes glBufferStorage through GL_EXT_buffer_storage
+    return usesOpenGLES();
+
   case InternalRequirement::ColorTexImageRgb10A2Unsized:
     return !hasTextureFeature(TextureFeatures::ColorRenderbufferRgb10A2) &&
            hasExtension(Extensions::TextureType2_10_10_10_Rev);
@@ -928,6 +1091,10 @@ bool DeviceFeatureSet::hasInternalRequirement(InternalRequirement requirement) c
     // OpenGL ES 2 does not include MapBufferRange
     return usesOpenGLES() && !hasESVersion(*this, GLVersion::v3_0_ES);
 
+  case InternalRequirement::MultiDrawIndirectExtReq:
+    // OpenGL ES only exposes multi-draw indirect through GL_EXT_multi_draw_indirect
+    return usesOpenGLES();
+
   case InternalRequirement::MultiSampleExtReq:
     // OpenGL ES has various extensions before 3.0 that are required, and
     // GL_IMG_multisampled_render_to_texture uses different enum values than later standard
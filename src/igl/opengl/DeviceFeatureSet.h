@@ -23,6 +23,7 @@ enum class Extensions {
   AppleRgb422,                // GL_APPLE_rgb_422 is supported
   BindlessTextureArb,         // GL_ARB_bindless_texture is supported
   BindlessTextureNv,          // GL_NV_bindless_texture is supported
+  BufferStorage,              // GL_EXT_buffer_storage is supported
   Debug,                      // GL_KHR_debug is supported
   DebugLabel,                 // GL_EXT_debug_label is supported
   DebugMarker,                // GL_EXT_debug_marker is supported
@@ -37,9 +38,12 @@ enum class Extensions {
   InvalidateSubdata,          // GL_ARB_invalidate_subdata is supported
   MapBuffer,                  // GL_OES_mapbuffer is supported
   MapBufferRange,             // GL_EXT_map_buffer_range is supported
+  MultiDraw,                  // GL_ANGLE_multi_draw (WEBGL_multi_draw) is supported
+  MultiDrawIndirect,          // GL_EXT_multi_draw_indirect is supported
   MultiSampleApple,           // GL_APPLE_framebuffer_multisample is supported
   MultiSampleExt,             // GL_EXT_multisampled_render_to_texture is supported
   MultiSampleImg,             // GL_IMG_multisampled_render_to_texture is supported
+  ParallelShaderCompile,      // GL_KHR_parallel_shader_compile is supported
   RequiredInternalFormat,     // GL_OES_required_internalformat is supported
   ShaderImageLoadStore,       // GL_EXT_shader_image_load_store is supported
   Srgb,                       // GL_EXT_sRGB is supported
@@ -62,15 +66,21 @@ enum class Extensions {
 
 // clang-format off
 enum class InternalFeatures {
+  BufferStorage,             // glBufferStorage (immutable buffer storage) is supported
   ClearDepthf,               // glClearDepthf is supported
   DebugLabel,                // Debug labels on objects are supported
   DebugMessage,              // Debug messages and group markers are supported
   DebugMessageCallback,      // Debug message callbacks are supported
+  DirectStateAccess,         // Named (bindless-edit) resource updates are supported
   FramebufferBlit,           // BlitFramebuffer is supported
   FramebufferObject,         // Framebuffer objects are supported
+  GetProgramBinary,          // glGetProgramBinary/glProgramBinary are supported
   GetStringi,                // GetStringi is supported
   InvalidateFramebuffer,     // glInvalidateFramebuffer is supported
   MapBuffer,                 // glMapBuffer is supported
+  MultiDraw,                 // glMultiDrawArrays/glMultiDrawElements are supported
+  MultiDrawIndirect,         // glMultiDrawArraysIndirect/glMultiDrawElementsIndirect are supported
+  ParallelShaderCompile,     // The driver compiles and links shaders on background threads
   PixelBufferObject,         // PBOs are available
   PolygonFillMode,           // glPolygonFillMode is supported
   ProgramInterfaceQuery,     // Querying info about shader program interfaces is supported
@@ -152,6 +162,7 @@ enum class TextureFeatures {
 // clang-format on
 
 enum class InternalRequirement {
+  BufferStorageExtReq,
   ColorTexImageRgb10A2Unsized,
   ColorTexImageRgb5A1Unsized,
   ColorTexImageRgba4Unsized,
@@ -167,6 +178,7 @@ enum class InternalRequirement {
   InvalidateFramebufferExtReq,
   MapBufferExtReq,
   MapBufferRangeExtReq,
+  MultiDrawIndirectExtReq,
   MultiSampleExtReq,
   ShaderImageLoadStoreExtReq,
   SyncExtReq,
@@ -189,6 +201,17 @@ class DeviceFeatureSet final {
   void initializeExtensions(std::string extensions,
                             std::unordered_set<std::string> supportedExtensions);
 
+  /// @brief Serializes the probed extension state and the precomputed capability caches into a
+  /// text blob that restoreCapabilities() can load on a later launch, so feature-set
+  /// construction becomes a file read instead of per-extension GL queries. Call after
+  /// initializeExtensions(). See IContext::setCapabilityCacheFilePath()
+  std::string serializeCapabilities() const;
+  /// @brief Restores state written by serializeCapabilities(). Returns false (leaving this
+  /// feature set untouched) when the blob is malformed, has a different schema version, or was
+  /// recorded for a GL version other than the one passed to initializeVersion(); callers must
+  /// then probe extensions as usual
+  bool restoreCapabilities(const std::string& data);
+
   // @fb-only
   [[nodiscard]] GLVersion getGLVersion() const noexcept;
   [[nodiscard]] ShaderVersion getShaderVersion() const;
@@ -212,6 +235,8 @@ class DeviceFeatureSet final {
   uint32_t getMaxComputeUniforms() const;
 
  private:
+  void invalidateCapabilityCaches();
+  void precomputeCapabilities();
   ICapabilities::TextureFormatCapabilities getCompressedTextureCapabilities() const;
   bool isExtensionSupported(Extensions extension) const;
   bool isFeatureSupported(DeviceFeatures feature) const;
@@ -8,6 +8,7 @@
 #include <igl/opengl/Framebuffer.h>
 
 #include <cstdlib>
+#include <cstring>
 #include <igl/RenderPass.h>
 #include <igl/opengl/CommandBuffer.h>
 #include <igl/opengl/Device.h>
@@ -202,6 +203,59 @@ void Framebuffer::copyBytesColorAttachment(ICommandQueue& /* unused */,
                                            void* pixelBytes,
                                            const TextureRangeDesc& range,
                                            size_t bytesPerRow) const {
+  readColorAttachment(index, range, bytesPerRow, pixelBytes);
+}
+
+std::unique_ptr<FramebufferReadback> Framebuffer::copyBytesColorAttachmentAsync(
+    size_t index,
+    const TextureRangeDesc& range,
+    size_t bytesPerRow,
+    Result* outResult) const {
+  const auto& deviceFeatures = getContext().deviceFeatures();
+  if (!deviceFeatures.hasInternalFeature(InternalFeatures::PixelBufferObject) ||
+      !deviceFeatures.hasInternalFeature(InternalFeatures::Sync) ||
+      !deviceFeatures.hasFeature(DeviceFeatures::MapBufferRange)) {
+    Result::setResult(outResult,
+                      Result::Code::Unsupported,
+                      "Async readback requires pixel buffer objects and sync objects");
+    return nullptr;
+  }
+  auto itexture = getColorAttachment(index);
+  if (index != 0 || itexture == nullptr) {
+    Result::setResult(
+        outResult, Result::Code::ArgumentInvalid, "No readable color attachment at index");
+    return nullptr;
+  }
+
+  if (bytesPerRow == 0) {
+    bytesPerRow = itexture->getProperties().getBytesPerRow(range);
+  }
+  const size_t size = bytesPerRow * range.height;
+
+  GLuint bufferId = 0;
+  getContext().genBuffers(1, &bufferId);
+  getContext().bindBuffer(GL_PIXEL_PACK_BUFFER, bufferId);
+  getContext().bufferData(
+      GL_PIXEL_PACK_BUFFER, static_cast<GLsizeiptr>(size), nullptr, GL_STREAM_READ);
+
+  // with a pack buffer bound, glReadPixels writes into the buffer at offset 0 and returns
+  // without waiting for the GPU
+  readColorAttachment(index, range, bytesPerRow, nullptr);
+
+  GLsync fence = getContext().fenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+  getContext().bindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+  // make sure the fence reaches the GPU so isReady() polling can observe it signal
+  getContext().flush();
+
+  Result::setOk(outResult);
+  return std::unique_ptr<FramebufferReadback>(
+      new FramebufferReadback(getContext(), bufferId, fence, size));
+}
+
+void Framebuffer::readColorAttachment(size_t index,
+                                      const TextureRangeDesc& range,
+                                      size_t bytesPerRow,
+                                      void* IGL_NULLABLE pixelBytes) const {
   // Only support attachment 0 because that's what glReadPixels supports
   if (index != 0) {
     IGL_ASSERT_MSG(0, "Invalid index: %d", index);
@@ -324,6 +378,57 @@ void Framebuffer::copyBytesColorAttachment(ICommandQueue& /* unused */,
   IGL_ASSERT_MSG(error.isOk(), error.message.c_str());
 }
 
+FramebufferReadback::FramebufferReadback(IContext& context,
+                                         GLuint bufferId,
+                                         GLsync fence,
+                                         size_t size) :
+  context_(context), bufferId_(bufferId), fence_(fence), size_(size) {}
+
+FramebufferReadback::~FramebufferReadback() {
+  if (fence_ != nullptr) {
+    context_.deleteSync(fence_);
+  }
+  if (bufferId_ != 0) {
+    context_.deleteBuffers(1, &bufferId_);
+  }
+}
+
+bool FramebufferReadback::isReady() const {
+  if (fence_ == nullptr) {
+    return true;
+  }
+  GLint status = GL_UNSIGNALED;
+  context_.getSynciv(fence_, GL_SYNC_STATUS, 1, nullptr, &status);
+  return status == GL_SIGNALED;
+}
+
+Result FramebufferReadback::getBytes(void* pixelBytes, size_t capacity) {
+  if (capacity < size_) {
+    return Result{Result::Code::ArgumentOutOfRange, "capacity must be at least getSize() bytes"};
+  }
+  if (fence_ != nullptr) {
+    constexpr uint64_t kFenceTimeoutNs = 1000000000ull; // 1 second
+    IGL_MAYBE_UNUSED const GLenum status =
+        context_.clientWaitSync(fence_, GL_SYNC_FLUSH_COMMANDS_BIT, kFenceTimeoutNs);
+    IGL_ASSERT_MSG(status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED,
+                   "Timed out waiting for a framebuffer readback");
+    context_.deleteSync(fence_);
+    fence_ = nullptr;
+  }
+
+  context_.bindBuffer(GL_PIXEL_PACK_BUFFER, bufferId_);
+  const void* readbackData = context_.mapBufferRange(
+      GL_PIXEL_PACK_BUFFER, 0, static_cast<GLsizeiptr>(size_), GL_MAP_READ_BIT);
+  if (readbackData == nullptr) {
+    context_.bindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    return Result{Result::Code::InvalidOperation, "Failed to map the readback buffer"};
+  }
+  memcpy(pixelBytes, readbackData, size_);
+  context_.unmapBuffer(GL_PIXEL_PACK_BUFFER);
+  context_.bindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+  return Result{};
+}
+
 void Framebuffer::copyBytesDepthAttachment(ICommandQueue& /* unused */,
                                            void* /*pixelBytes*/,
                                            const TextureRangeDesc& /*range*/,
@@ -356,7 +461,7 @@ void Framebuffer::copyTextureColorAttachment(ICommandQueue& /*cmdQueue*/,
   dest.bind();
 
   getContext().copyTexSubImage2D(GL_TEXTURE_2D,
-                                 0,
+                                 static_cast<GLint>(range.mipLevel),
                                  0,
                                  0,
                                  static_cast<GLint>(range.x),
@@ -695,6 +800,32 @@ void CustomFramebuffer::bind(const RenderPassDesc& renderPass) const {
                       toAttachmentParams(renderPassAttachment, renderTarget_.mode));
     }
   }
+  // On tiled GPUs an attachment whose load action is DontCare must be invalidated before the
+  // pass, otherwise the driver loads the previous contents into tile memory for nothing. Clear
+  // already implies this, so only DontCare needs the explicit hint.
+  if (getContext().deviceFeatures().hasInternalFeature(InternalFeatures::InvalidateFramebuffer)) {
+    GLenum attachments[IGL_COLOR_ATTACHMENTS_MAX + 2];
+    GLsizei numAttachments = 0;
+    for (size_t i = 0; i != IGL_COLOR_ATTACHMENTS_MAX; i++) {
+      if (renderTarget_.colorAttachments[i].texture != nullptr &&
+          i < renderPass_.colorAttachments.size() &&
+          renderPass_.colorAttachments[i].loadAction == LoadAction::DontCare) {
+        attachments[numAttachments++] = static_cast<GLenum>(GL_COLOR_ATTACHMENT0 + i);
+      }
+    }
+    if (renderTarget_.depthAttachment.texture != nullptr &&
+        renderPass_.depthAttachment.loadAction == LoadAction::DontCare) {
+      attachments[numAttachments++] = GL_DEPTH_ATTACHMENT;
+    }
+    if (renderTarget_.stencilAttachment.texture != nullptr &&
+        renderPass_.stencilAttachment.loadAction == LoadAction::DontCare) {
+      attachments[numAttachments++] = GL_STENCIL_ATTACHMENT;
+    }
+    if (numAttachments > 0) {
+      getContext().invalidateFramebuffer(GL_FRAMEBUFFER, numAttachments, attachments);
+    }
+  }
+
   // clear the buffers if we're not loading previous contents
   GLbitfield clearMask = 0;
   const auto& colorAttachment0 = renderTarget_.colorAttachments[0];
@@ -723,19 +854,33 @@ void CustomFramebuffer::bind(const RenderPassDesc& renderPass) const {
   }
 
   if (clearMask != 0) {
+    // scissor the clear to the render area so content outside the damaged region is preserved;
+    // RenderCommandAdapter::initialize() re-applies the same scissor for the draws that follow
+    if (renderPass_.hasRenderArea()) {
+      getContext().setEnabled(true, GL_SCISSOR_TEST);
+      getContext().scissor(static_cast<GLint>(renderPass_.renderArea.x),
+                           static_cast<GLint>(renderPass_.renderArea.y),
+                           static_cast<GLsizei>(renderPass_.renderArea.width),
+                           static_cast<GLsizei>(renderPass_.renderArea.height));
+    } else {
+      // a scissor left over from an earlier partial pass must not restrict a full clear
+      getContext().setEnabled(false, GL_SCISSOR_TEST);
+    }
     getContext().clear(clearMask);
   }
 }
 
 void CustomFramebuffer::unbind() const {
-  // discard the depthStencil if we don't need to store its contents
-  GLenum attachments[3];
+  // discard attachments we don't need to store, so tiled GPUs skip the tile writeback
+  GLenum attachments[IGL_COLOR_ATTACHMENTS_MAX + 2];
   GLsizei numAttachments = 0;
-  const auto& colorAttachment0 = renderTarget_.colorAttachments[0];
 
-  if (colorAttachment0.texture != nullptr &&
-      renderPass_.colorAttachments[0].storeAction != StoreAction::Store) {
-    attachments[numAttachments++] = GL_COLOR_ATTACHMENT0;
+  for (size_t i = 0; i != IGL_COLOR_ATTACHMENTS_MAX; i++) {
+    if (renderTarget_.colorAttachments[i].texture != nullptr &&
+        i < renderPass_.colorAttachments.size() &&
+        renderPass_.colorAttachments[i].storeAction != StoreAction::Store) {
+      attachments[numAttachments++] = static_cast<GLenum>(GL_COLOR_ATTACHMENT0 + i);
+    }
   }
   if (renderTarget_.depthAttachment.texture != nullptr) {
     if (renderPass_.depthAttachment.storeAction != StoreAction::Store) {
@@ -833,32 +978,88 @@ void CurrentFramebuffer::bind(const RenderPassDesc& renderPass) const {
   }
 #endif
 
+  // Cache renderPass for unbind
+  renderPass_ = renderPass;
+
+  // DontCare attachments are invalidated instead of cleared: on tiled GPUs this skips both the
+  // clear and the tile load of the previous contents. Only the default framebuffer (ID 0) may
+  // be invalidated with the GL_COLOR/GL_DEPTH/GL_STENCIL enums.
+  const bool canInvalidate =
+      frameBufferID_ == 0 &&
+      getContext().deviceFeatures().hasInternalFeature(InternalFeatures::InvalidateFramebuffer);
+  GLenum invalidateAttachments[3];
+  GLsizei numInvalidateAttachments = 0;
+
   // clear the buffers if we're not loading previous contents
   GLbitfield clearMask = 0;
-  if (renderPass.colorAttachments[0].loadAction != LoadAction::Load) {
+  if (renderPass.colorAttachments[0].loadAction == LoadAction::Clear) {
     clearMask |= GL_COLOR_BUFFER_BIT;
     auto clearColor = renderPass.colorAttachments[0].clearColor;
     getContext().colorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
     getContext().clearColor(clearColor.r, clearColor.g, clearColor.b, clearColor.a);
+  } else if (renderPass.colorAttachments[0].loadAction == LoadAction::DontCare) {
+    invalidateAttachments[numInvalidateAttachments++] = GL_COLOR;
   }
-  if (renderPass.depthAttachment.loadAction != LoadAction::Load) {
+  if (renderPass.depthAttachment.loadAction == LoadAction::Clear) {
     clearMask |= GL_DEPTH_BUFFER_BIT;
     getContext().depthMask(GL_TRUE);
     getContext().clearDepthf(renderPass.depthAttachment.clearDepth);
+  } else if (renderPass.depthAttachment.loadAction == LoadAction::DontCare) {
+    invalidateAttachments[numInvalidateAttachments++] = GL_DEPTH;
   }
-  if (renderPass.stencilAttachment.loadAction != LoadAction::Load) {
+  if (renderPass.stencilAttachment.loadAction == LoadAction::Clear) {
     clearMask |= GL_STENCIL_BUFFER_BIT;
     getContext().stencilMask(0xFF);
     getContext().clearStencil(renderPass.stencilAttachment.clearStencil);
+  } else if (renderPass.stencilAttachment.loadAction == LoadAction::DontCare) {
+    invalidateAttachments[numInvalidateAttachments++] = GL_STENCIL;
   }
 
+  if (canInvalidate && numInvalidateAttachments > 0) {
+    getContext().invalidateFramebuffer(
+        GL_FRAMEBUFFER, numInvalidateAttachments, invalidateAttachments);
+  }
   if (clearMask != 0) {
+    // scissor the clear to the render area so content outside the damaged region is preserved;
+    // RenderCommandAdapter::initialize() re-applies the same scissor for the draws that follow
+    if (renderPass.hasRenderArea()) {
+      getContext().setEnabled(true, GL_SCISSOR_TEST);
+      getContext().scissor(static_cast<GLint>(renderPass.renderArea.x),
+                           static_cast<GLint>(renderPass.renderArea.y),
+                           static_cast<GLsizei>(renderPass.renderArea.width),
+                           static_cast<GLsizei>(renderPass.renderArea.height));
+    } else {
+      // a scissor left over from an earlier partial pass must not restrict a full clear
+      getContext().setEnabled(false, GL_SCISSOR_TEST);
+    }
     getContext().clear(clearMask);
   }
 }
 
 void CurrentFramebuffer::unbind() const {
-  // no-op
+  // Discard default-framebuffer attachments we don't need to store. Depth and stencil default to
+  // StoreAction::DontCare, so on EGL this drops the tile writeback of buffers the swap never
+  // reads; color defaults to Store and survives for eglSwapBuffers.
+  if (frameBufferID_ != 0 ||
+      !getContext().deviceFeatures().hasInternalFeature(InternalFeatures::InvalidateFramebuffer)) {
+    return;
+  }
+
+  GLenum attachments[3];
+  GLsizei numAttachments = 0;
+  if (!renderPass_.colorAttachments.empty() &&
+      renderPass_.colorAttachments[0].storeAction != StoreAction::Store) {
+    attachments[numAttachments++] = GL_COLOR;
+  }
+  if (renderPass_.depthAttachment.storeAction != StoreAction::Store) {
+    attachments[numAttachments++] = GL_DEPTH;
+  }
+  if (renderPass_.stencilAttachment.storeAction != StoreAction::Store) {
+    attachments[numAttachments++] = GL_STENCIL;
+  }
+  if (numAttachments > 0) {
+    getContext().invalidateFramebuffer(GL_FRAMEBUFFER, numAttachments, attachments);
+  }
 }
 
 FramebufferMode CurrentFramebuffer::getMode() const {
@@ -33,6 +33,40 @@ class FramebufferBindingGuard {
   GLuint currentDrawFramebuffer_;
 };
 
+///--------------------------------------
+/// MARK: - FramebufferReadback
+
+/// An in-flight non-blocking readback started through Framebuffer::copyBytesColorAttachmentAsync().
+/// The GPU writes the pixels into a pixel pack buffer asynchronously; isReady() polls the fence
+/// without blocking and getBytes() copies the pixels out once they are available.
+class FramebufferReadback {
+ public:
+  ~FramebufferReadback();
+  FramebufferReadback(const FramebufferReadback&) = delete;
+  FramebufferReadback& operator=(const FramebufferReadback&) = delete;
+
+  /// Returns true once the GPU has finished writing the pixels, without blocking
+  [[nodiscard]] bool isReady() const;
+
+  /// Copies the pixels into pixelBytes, waiting for the GPU to finish when necessary.
+  /// capacity must be at least getSize() bytes.
+  Result getBytes(void* pixelBytes, size_t capacity);
+
+  /// Returns the size of the readback in bytes
+  [[nodiscard]] size_t getSize() const {
+    return size_;
+  }
+
+ private:
+  friend class Framebuffer;
+  FramebufferReadback(IContext& context, GLuint bufferId, GLsync fence, size_t size);
+
+  IContext& context_;
+  GLuint bufferId_ = 0;
+  GLsync fence_ = nullptr;
+  size_t size_ = 0;
+};
+
 // Framebuffer encapsulates an immutable render target (attachments) and per-render pass state.
 class Framebuffer : public WithContext, public IFramebuffer {
  public:
@@ -59,6 +93,15 @@ class Framebuffer : public WithContext, public IFramebuffer {
                                   const TextureRangeDesc& range,
                                   size_t bytesPerRow = 0) const override;
 
+  /// Starts a non-blocking readback of color attachment 0: glReadPixels targets a pixel pack
+  /// buffer and a fence tracks completion, so the calling thread never waits on the GPU.
+  /// Returns nullptr when pixel pack buffers or sync objects are unavailable; callers should
+  /// then fall back to copyBytesColorAttachment().
+  std::unique_ptr<FramebufferReadback> copyBytesColorAttachmentAsync(size_t index,
+                                                                     const TextureRangeDesc& range,
+                                                                     size_t bytesPerRow,
+                                                                     Result* outResult) const;
+
   void copyTextureColorAttachment(ICommandQueue& cmdQueue,
                                   size_t index,
                                   std::shared_ptr<ITexture> destTexture,
@@ -98,6 +141,14 @@ class Framebuffer : public WithContext, public IFramebuffer {
   mutable CachedState stencilCachedState_;
 
   std::shared_ptr<Framebuffer> resolveFramebuffer = nullptr;
+
+ private:
+  // issues the glReadPixels for color attachment 0; with a pixel pack buffer bound, a null
+  // pixelBytes pointer targets offset 0 of that buffer instead of client memory
+  void readColorAttachment(size_t index,
+                           const TextureRangeDesc& range,
+                           size_t bytesPerRow,
+                           void* IGL_NULLABLE pixelBytes) const;
 };
 
 // CustomFramebuffer enables caller-defined attachments
@@ -179,6 +230,8 @@ class CurrentFramebuffer final : public Framebuffer {
  private:
   Viewport viewport_;
   std::shared_ptr<ITexture> colorAttachment_;
+  // Cached by bind() so unbind() can invalidate attachments per store-action
+  mutable RenderPassDesc renderPass_;
 };
 
 } // namespace opengl
@@ -58,7 +58,10 @@
 #define CAN_LOAD false
 #endif // IGL_EGL || IGL_WGL
 
-#if IGL_WGL || IGL_PLATFORM_APPLE
+// IGL_OPENGL_STATIC_DISPATCH builds link the GL library statically and call its exported entry
+// points directly; every function whose prototype is available then compiles to a plain call
+// instead of a load through a lazily initialized function pointer
+#if IGL_WGL || IGL_PLATFORM_APPLE || IGL_OPENGL_STATIC_DISPATCH
 #define CAN_CALL 1
 #define CAN_CALL_OPENGL_ES IGL_OPENGL_ES
 #define CAN_CALL_OPENGL IGL_OPENGL
@@ -66,7 +69,7 @@
 #define CAN_CALL 0
 #define CAN_CALL_OPENGL_ES 0
 #define CAN_CALL_OPENGL 0
-#endif // IGL_WGL || IGL_PLATFORM_APPLE
+#endif // IGL_WGL || IGL_PLATFORM_APPLE || IGL_OPENGL_STATIC_DISPATCH
 
 // Special defines for functionality that is always available in OpenGL or OpenGL ES
 // Always available means supported from OpenGL 2.0 or OpenGL ES 2.0.
@@ -125,6 +128,57 @@
       canCall, 0, funcName, funcType, returnOnError, __VA_ARGS__)
 #endif
 
+// The busiest dynamically loaded entry points - the per-draw binds and draws - share one 64-byte
+// table ordered roughly by call frequency, instead of each reading its own function-local static
+// from a different cache line. At 100k+ GL calls per frame the dispatch loads themselves are hot,
+// and keeping them on a single line keeps it resident. Unused when every entry point is called
+// directly (see CAN_CALL above).
+namespace {
+struct alignas(64) GLHotDispatchTable {
+  PFNIGLBINDVERTEXARRAYPROC bindVertexArray = nullptr;
+  PFNIGLBINDBUFFERBASEPROC bindBufferBase = nullptr;
+  PFNIGLBINDBUFFERRANGEPROC bindBufferRange = nullptr;
+  PFNIGLDRAWELEMENTSINSTANCEDPROC drawElementsInstanced = nullptr;
+  PFNIGLDRAWARRAYSINSTANCEDPROC drawArraysInstanced = nullptr;
+  PFNIGLVERTEXATTRIBDIVISORPROC vertexAttribDivisor = nullptr;
+  PFNIGLBINDFRAMEBUFFERPROC bindFramebuffer = nullptr;
+  PFNIGLINVALIDATEFRAMEBUFFERPROC invalidateFramebuffer = nullptr;
+};
+[[maybe_unused]] GLHotDispatchTable iglHotDispatch;
+} // namespace
+
+#define GLEXTENSION_LOAD_AND_CALL_HOT(member, funcName, funcType, ...) \
+  if (iglHotDispatch.member == nullptr) {                              \
+    iglHotDispatch.member = (funcType)IGL_GET_PROC_ADDRESS(#funcName); \
+  }                                                                    \
+  if (iglHotDispatch.member != nullptr) {                              \
+    iglHotDispatch.member(__VA_ARGS__);                                \
+  } else {                                                             \
+    IGL_ASSERT_MSG(0, "Extension function " #funcName " not found");   \
+  }
+
+// Same expansion scheme as GLEXTENSION_METHOD_BODY, with the function pointer kept in
+// GLHotDispatchTable instead of a function-local static
+#define GLEXTENSION_HOT_1_1(member, funcName, funcType, ...) \
+  GLEXTENSION_DIRECT_CALL(funcName, funcType, __VA_ARGS__)
+#define GLEXTENSION_HOT_1_0(member, funcName, funcType, ...) \
+  GLEXTENSION_DIRECT_CALL(funcName, funcType, __VA_ARGS__)
+#define GLEXTENSION_HOT_0_1(member, funcName, funcType, ...) \
+  GLEXTENSION_LOAD_AND_CALL_HOT(member, funcName, funcType, __VA_ARGS__)
+#define GLEXTENSION_HOT_0_0(member, funcName, funcType, ...) \
+  GLEXTENSION_UNAVAILABLE(funcName, funcType, __VA_ARGS__)
+
+#define GLEXTENSION_METHOD_BODY_HOT_EXPAND(canCall, canLoad, member, funcName, funcType, ...) \
+  GLEXTENSION_HOT_##canCall##_##canLoad(member, funcName, funcType, __VA_ARGS__)
+
+#if CAN_LOAD
+#define GLEXTENSION_METHOD_BODY_HOT(canCall, member, funcName, funcType, ...) \
+  GLEXTENSION_METHOD_BODY_HOT_EXPAND(canCall, 1, member, funcName, funcType, __VA_ARGS__)
+#else
+#define GLEXTENSION_METHOD_BODY_HOT(canCall, member, funcName, funcType, ...) \
+  GLEXTENSION_METHOD_BODY_HOT_EXPAND(canCall, 0, member, funcName, funcType, __VA_ARGS__)
+#endif
+
 IGL_EXTERN_BEGIN
 
 ///--------------------------------------
@@ -180,6 +234,13 @@ IGL_EXTERN_BEGIN
 #else
 #define CAN_CALL_glVertexAttribDivisor 0
 #endif
+#if defined(GL_VERSION_3_1) || defined(GL_ES_VERSION_3_0)
+#define CAN_CALL_glDrawArraysInstanced CAN_CALL
+#define CAN_CALL_glDrawElementsInstanced CAN_CALL
+#else
+#define CAN_CALL_glDrawArraysInstanced 0
+#define CAN_CALL_glDrawElementsInstanced 0
+#endif
 
 void iglDebugMessageCallback(PFNIGLDEBUGPROC callback, const void* userParam) {
   GLEXTENSION_METHOD_BODY(CAN_CALL_glDebugMessageCallback,
@@ -376,12 +437,79 @@ void iglUnmapBuffer(GLenum target) {
   GLEXTENSION_METHOD_BODY(CAN_CALL_glUnmapBuffer, glUnmapBuffer, PFNIGLUNMAPBUFFERPROC, target);
 }
 
+void iglDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) {
+  GLEXTENSION_METHOD_BODY_HOT(CAN_CALL_glDrawArraysInstanced,
+                              drawArraysInstanced,
+                              glDrawArraysInstanced,
+                              PFNIGLDRAWARRAYSINSTANCEDPROC,
+                              mode,
+                              first,
+                              count,
+                              instancecount);
+}
+
+void iglDrawElementsInstanced(GLenum mode,
+                              GLsizei count,
+                              GLenum type,
+                              const GLvoid* indices,
+                              GLsizei instancecount) {
+  GLEXTENSION_METHOD_BODY_HOT(CAN_CALL_glDrawElementsInstanced,
+                              drawElementsInstanced,
+                              glDrawElementsInstanced,
+                              PFNIGLDRAWELEMENTSINSTANCEDPROC,
+                              mode,
+                              count,
+                              type,
+                              indices,
+                              instancecount);
+}
+
 void iglVertexAttribDivisor(GLuint index, GLuint divisor) {
-  GLEXTENSION_METHOD_BODY(CAN_CALL_glVertexAttribDivisor,
-                          glVertexAttribDivisor,
-                          PFNIGLVERTEXATTRIBDIVISORPROC,
-                          index,
-                          divisor);
+  GLEXTENSION_METHOD_BODY_HOT(CAN_CALL_glVertexAttribDivisor,
+                              vertexAttribDivisor,
+                              glVertexAttribDivisor,
+                              PFNIGLVERTEXATTRIBDIVISORPROC,
+                              index,
+                              divisor);
+}
+
+///--------------------------------------
+/// MARK: - GL_ANGLE_multi_draw
+
+#if defined(GL_ANGLE_multi_draw)
+#define CAN_CALL_glMultiDrawArraysANGLE CAN_CALL_OPENGL_ES
+#define CAN_CALL_glMultiDrawElementsANGLE CAN_CALL_OPENGL_ES
+#else
+#define CAN_CALL_glMultiDrawArraysANGLE 0
+#define CAN_CALL_glMultiDrawElementsANGLE 0
+#endif
+
+void iglMultiDrawArraysANGLE(GLenum mode,
+                             const GLint* firsts,
+                             const GLsizei* counts,
+                             GLsizei drawcount) {
+  GLEXTENSION_METHOD_BODY(CAN_CALL_glMultiDrawArraysANGLE,
+                          glMultiDrawArraysANGLE,
+                          PFNIGLMULTIDRAWARRAYSPROC,
+                          mode,
+                          firsts,
+                          counts,
+                          drawcount);
+}
+
+void iglMultiDrawElementsANGLE(GLenum mode,
+                               const GLsizei* counts,
+                               GLenum type,
+                               const GLvoid* const* offsets,
+                               GLsizei drawcount) {
+  GLEXTENSION_METHOD_BODY(CAN_CALL_glMultiDrawElementsANGLE,
+                          glMultiDrawElementsANGLE,
+                          PFNIGLMULTIDRAWELEMENTSPROC,
+                          mode,
+                          counts,
+                          type,
+                          offsets,
+                          drawcount);
 }
 
 ///--------------------------------------
@@ -412,15 +540,27 @@ void iglRenderbufferStorageMultisampleAPPLE(GLenum target,
 /// MARK: - GL_APPLE_sync
 
 #if defined(GL_APPLE_sync)
+#define CAN_CALL_glClientWaitSyncAPPLE CAN_CALL_OPENGL_ES
 #define CAN_CALL_glDeleteSyncAPPLE CAN_CALL_OPENGL_ES
 #define CAN_CALL_glFenceSyncAPPLE CAN_CALL_OPENGL_ES
 #define CAN_CALL_glGetSyncivAPPLE CAN_CALL_OPENGL_ES
 #else
+#define CAN_CALL_glClientWaitSyncAPPLE 0
 #define CAN_CALL_glDeleteSyncAPPLE 0
 #define CAN_CALL_glFenceSyncAPPLE 0
 #define CAN_CALL_glGetSyncivAPPLE 0
 #endif
 
+GLenum iglClientWaitSyncAPPLE(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+  GLEXTENSION_METHOD_BODY_WITH_RETURN(CAN_CALL_glClientWaitSyncAPPLE,
+                                      glClientWaitSyncAPPLE,
+                                      PFNIGLCLIENTWAITSYNCPROC,
+                                      GL_WAIT_FAILED,
+                                      sync,
+                                      flags,
+                                      timeout);
+}
+
 void iglDeleteSyncAPPLE(GLsync sync) {
   GLEXTENSION_METHOD_BODY(
       CAN_CALL_glDeleteSyncAPPLE, glDeleteSyncAPPLE, PFNIGLDELETESYNCPROC, sync);
@@ -477,6 +617,25 @@ void iglMakeTextureHandleNonResidentARB(GLuint64 handle) {
                           handle);
 }
 
+///--------------------------------------
+/// MARK: - GL_ARB_buffer_storage
+
+#if defined(GL_VERSION_4_4) || defined(GL_ARB_buffer_storage)
+#define CAN_CALL_glBufferStorage CAN_CALL_OPENGL
+#else
+#define CAN_CALL_glBufferStorage 0
+#endif
+
+void iglBufferStorage(GLenum target, GLsizeiptr size, const void* data, GLbitfield flags) {
+  GLEXTENSION_METHOD_BODY(CAN_CALL_glBufferStorage,
+                          glBufferStorage,
+                          PFNIGLBUFFERSTORAGEPROC,
+                          target,
+                          size,
+                          data,
+                          flags);
+}
+
 ///--------------------------------------
 /// MARK: - GL_ARB_compute_shader
 
@@ -495,15 +654,44 @@ void iglDispatchCompute(GLuint num_groups_x, GLuint num_groups_y, GLuint num_gro
                           num_groups_z);
 }
 
+///--------------------------------------
+/// MARK: - GL_ARB_direct_state_access
+
+#if defined(GL_VERSION_4_5) || defined(GL_ARB_direct_state_access)
+#define CAN_CALL_glNamedBufferSubData CAN_CALL_OPENGL
+#else
+#define CAN_CALL_glNamedBufferSubData 0
+#endif
+
+void iglNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, const GLvoid* data) {
+  GLEXTENSION_METHOD_BODY(CAN_CALL_glNamedBufferSubData,
+                          glNamedBufferSubData,
+                          PFNIGLNAMEDBUFFERSUBDATAPROC,
+                          buffer,
+                          offset,
+                          size,
+                          data);
+}
+
 ///--------------------------------------
 /// MARK: - GL_ARB_draw_indirect
 
 #if defined(GL_VERSION_4_0) || defined(GL_ES_VERSION_3_1) || defined(GL_ARB_draw_indirect)
+#define CAN_CALL_glDrawArraysIndirect CAN_CALL
 #define CAN_CALL_glDrawElementsIndirect CAN_CALL
 #else
+#define CAN_CALL_glDrawArraysIndirect 0
 #define CAN_CALL_glDrawElementsIndirect 0
 #endif
 
+void iglDrawArraysIndirect(GLenum mode, const GLvoid* indirect) {
+  GLEXTENSION_METHOD_BODY(CAN_CALL_glDrawArraysIndirect,
+                          glDrawArraysIndirect,
+                          PFNIGLDRAWARRAYSINDIRECTPROC,
+                          mode,
+                          indirect);
+}
+
 void iglDrawElementsIndirect(GLenum mode, GLenum type, const GLvoid* indirect) {
   GLEXTENSION_METHOD_BODY(CAN_CALL_glDrawElementsIndirect,
                           glDrawElementsIndirect,
@@ -575,11 +763,12 @@ void iglClearDepthf(GLfloat depth) {
 #endif
 
 void iglBindFramebuffer(GLenum target, GLuint framebuffer) {
-  GLEXTENSION_METHOD_BODY(CAN_CALL_glBindFramebuffer,
-                          glBindFramebuffer,
-                          PFNIGLBINDFRAMEBUFFERPROC,
-                          target,
-                          framebuffer);
+  GLEXTENSION_METHOD_BODY_HOT(CAN_CALL_glBindFramebuffer,
+                              bindFramebuffer,
+                              glBindFramebuffer,
+                              PFNIGLBINDFRAMEBUFFERPROC,
+                              target,
+                              framebuffer);
 }
 
 void iglBindRenderbuffer(GLenum target, GLuint renderbuffer) {
@@ -760,6 +949,53 @@ void iglRenderbufferStorageMultisample(GLenum target,
                           height)
 }
 
+///--------------------------------------
+/// MARK: - GL_ARB_get_program_binary
+
+#if defined(GL_VERSION_4_1) || defined(GL_ES_VERSION_3_0) || defined(GL_ARB_get_program_binary)
+#define CAN_CALL_glGetProgramBinary CAN_CALL
+#define CAN_CALL_glProgramBinary CAN_CALL
+#define CAN_CALL_glProgramParameteri CAN_CALL
+#else
+#define CAN_CALL_glGetProgramBinary 0
+#define CAN_CALL_glProgramBinary 0
+#define CAN_CALL_glProgramParameteri 0
+#endif
+
+void iglGetProgramBinary(GLuint program,
+                         GLsizei bufSize,
+                         GLsizei* length,
+                         GLenum* binaryFormat,
+                         void* binary) {
+  GLEXTENSION_METHOD_BODY(CAN_CALL_glGetProgramBinary,
+                          glGetProgramBinary,
+                          PFNIGLGETPROGRAMBINARYPROC,
+                          program,
+                          bufSize,
+                          length,
+                          binaryFormat,
+                          binary);
+}
+
+void iglProgramBinary(GLuint program, GLenum binaryFormat, const void* binary, GLsizei length) {
+  GLEXTENSION_METHOD_BODY(CAN_CALL_glProgramBinary,
+                          glProgramBinary,
+                          PFNIGLPROGRAMBINARYPROC,
+                          program,
+                          binaryFormat,
+                          binary,
+                          length);
+}
+
+void iglProgramParameteri(GLuint program, GLenum pname, GLint value) {
+  GLEXTENSION_METHOD_BODY(CAN_CALL_glProgramParameteri,
+                          glProgramParameteri,
+                          PFNIGLPROGRAMPARAMETERIPROC,
+                          program,
+                          pname,
+                          value);
+}
+
 ///--------------------------------------
 /// MARK: - GL_ARB_invalidate_subdata
 
@@ -770,12 +1006,13 @@ void iglRenderbufferStorageMultisample(GLenum target,
 #endif
 
 void iglInvalidateFramebuffer(GLenum target, GLsizei numAttachments, const GLenum* attachments) {
-  GLEXTENSION_METHOD_BODY(CAN_CALL_glInvalidateFramebuffer,
-                          glInvalidateFramebuffer,
-                          PFNIGLINVALIDATEFRAMEBUFFERPROC,
-                          target,
-                          numAttachments,
-                          attachments);
+  GLEXTENSION_METHOD_BODY_HOT(CAN_CALL_glInvalidateFramebuffer,
+                              invalidateFramebuffer,
+                              glInvalidateFramebuffer,
+                              PFNIGLINVALIDATEFRAMEBUFFERPROC,
+                              target,
+                              numAttachments,
+                              attachments);
 }
 
 ///--------------------------------------
@@ -798,6 +1035,45 @@ void* iglMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbit
                                       access);
 }
 
+///--------------------------------------
+/// MARK: - GL_ARB_multi_draw_indirect
+
+#if defined(GL_VERSION_4_3) || defined(GL_ARB_multi_draw_indirect)
+#define CAN_CALL_glMultiDrawArraysIndirect CAN_CALL_OPENGL
+#define CAN_CALL_glMultiDrawElementsIndirect CAN_CALL_OPENGL
+#else
+#define CAN_CALL_glMultiDrawArraysIndirect 0
+#define CAN_CALL_glMultiDrawElementsIndirect 0
+#endif
+
+void iglMultiDrawArraysIndirect(GLenum mode,
+                                const GLvoid* indirect,
+                                GLsizei drawcount,
+                                GLsizei stride) {
+  GLEXTENSION_METHOD_BODY(CAN_CALL_glMultiDrawArraysIndirect,
+                          glMultiDrawArraysIndirect,
+                          PFNIGLMULTIDRAWARRAYSINDIRECTPROC,
+                          mode,
+                          indirect,
+                          drawcount,
+                          stride);
+}
+
+void iglMultiDrawElementsIndirect(GLenum mode,
+                                  GLenum type,
+                                  const GLvoid* indirect,
+                                  GLsizei drawcount,
+                                  GLsizei stride) {
+  GLEXTENSION_METHOD_BODY(CAN_CALL_glMultiDrawElementsIndirect,
+                          glMultiDrawElementsIndirect,
+                          PFNIGLMULTIDRAWELEMENTSINDIRECTPROC,
+                          mode,
+                          type,
+                          indirect,
+                          drawcount,
+                          stride);
+}
+
 ///--------------------------------------
 /// MARK: - GL_ARB_program_interface_query
 
@@ -913,15 +1189,27 @@ void iglMemoryBarrier(GLbitfield barriers) {
 /// MARK: - GL_ARB_sync
 
 #if defined(GL_VERSION_3_2) || defined(GL_ES_VERSION_3_0) || defined(GL_ARB_sync)
+#define CAN_CALL_glClientWaitSync CAN_CALL
 #define CAN_CALL_glDeleteSync CAN_CALL
 #define CAN_CALL_glFenceSync CAN_CALL
 #define CAN_CALL_glGetSynciv CAN_CALL
 #else
+#define CAN_CALL_glClientWaitSync 0
 #define CAN_CALL_glDeleteSync 0
 #define CAN_CALL_glFenceSync 0
 #define CAN_CALL_glGetSynciv 0
 #endif
 
+GLenum iglClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+  GLEXTENSION_METHOD_BODY_WITH_RETURN(CAN_CALL_glClientWaitSync,
+                                      glClientWaitSync,
+                                      PFNIGLCLIENTWAITSYNCPROC,
+                                      GL_WAIT_FAILED,
+                                      sync,
+                                      flags,
+                                      timeout);
+}
+
 void iglDeleteSync(GLsync sync) {
   GLEXTENSION_METHOD_BODY(CAN_CALL_glDeleteSync, glDeleteSync, PFNIGLDELETESYNCPROC, sync);
 }
@@ -1017,8 +1305,13 @@ void iglTexStorage3D(GLenum target,
 #endif
 
 void iglBindBufferBase(GLenum target, GLuint index, GLuint buffer) {
-  GLEXTENSION_METHOD_BODY(
-      CAN_CALL_glBindBufferBase, glBindBufferBase, PFNIGLBINDBUFFERBASEPROC, target, index, buffer);
+  GLEXTENSION_METHOD_BODY_HOT(CAN_CALL_glBindBufferBase,
+                              bindBufferBase,
+                              glBindBufferBase,
+                              PFNIGLBINDBUFFERBASEPROC,
+                              target,
+                              index,
+                              buffer);
 }
 
 void iglBindBufferRange(GLenum target,
@@ -1026,14 +1319,15 @@ void iglBindBufferRange(GLenum target,
                         GLuint buffer,
                         GLintptr offset,
                         GLsizeiptr size) {
-  GLEXTENSION_METHOD_BODY(CAN_CALL_glBindBufferRange,
-                          glBindBufferRange,
-                          PFNIGLBINDBUFFERRANGEPROC,
-                          target,
-                          index,
-                          buffer,
-                          offset,
-                          size);
+  GLEXTENSION_METHOD_BODY_HOT(CAN_CALL_glBindBufferRange,
+                              bindBufferRange,
+                              glBindBufferRange,
+                              PFNIGLBINDBUFFERRANGEPROC,
+                              target,
+                              index,
+                              buffer,
+                              offset,
+                              size);
 }
 
 void iglGetActiveUniformsiv(GLuint program,
@@ -1108,8 +1402,11 @@ void iglUniformBlockBinding(GLuint pid, GLuint uniformBlockIndex, GLuint uniform
 #endif
 
 void iglBindVertexArray(GLuint vao) {
-  GLEXTENSION_METHOD_BODY(
-      CAN_CALL_glBindVertexArray, glBindVertexArray, PFNIGLBINDVERTEXARRAYPROC, vao);
+  GLEXTENSION_METHOD_BODY_HOT(CAN_CALL_glBindVertexArray,
+                              bindVertexArray,
+                              glBindVertexArray,
+                              PFNIGLBINDVERTEXARRAYPROC,
+                              vao);
 }
 
 void iglDeleteVertexArrays(GLsizei n, const GLuint* vertexArrays) {
@@ -1125,6 +1422,25 @@ void iglGenVertexArrays(GLsizei n, GLuint* vertexArrays) {
       CAN_CALL_glGenVertexArrays, glGenVertexArrays, PFNIGLGENVERTEXARRAYSPROC, n, vertexArrays);
 }
 
+///--------------------------------------
+/// MARK: - GL_EXT_buffer_storage
+
+#if defined(GL_EXT_buffer_storage)
+#define CAN_CALL_glBufferStorageEXT CAN_CALL_OPENGL_ES
+#else
+#define CAN_CALL_glBufferStorageEXT 0
+#endif
+
+void iglBufferStorageEXT(GLenum target, GLsizeiptr size, const void* data, GLbitfield flags) {
+  GLEXTENSION_METHOD_BODY(CAN_CALL_glBufferStorageEXT,
+                          glBufferStorageEXT,
+                          PFNIGLBUFFERSTORAGEPROC,
+                          target,
+                          size,
+                          data,
+                          flags);
+}
+
 ///--------------------------------------
 /// MARK: - GL_EXT_debug_label
 
@@ -1362,6 +1678,84 @@ void iglImportMemoryFdEXT(GLuint memory, GLuint64 size, GLenum handleType, GLint
                           fd);
 }
 
+///--------------------------------------
+/// MARK: - GL_EXT_multi_draw_arrays
+
+#if defined(GL_VERSION_1_4) || defined(GL_EXT_multi_draw_arrays)
+#define CAN_CALL_glMultiDrawArrays CAN_CALL_OPENGL
+#define CAN_CALL_glMultiDrawElements CAN_CALL_OPENGL
+#else
+#define CAN_CALL_glMultiDrawArrays 0
+#define CAN_CALL_glMultiDrawElements 0
+#endif
+
+void iglMultiDrawArrays(GLenum mode,
+                        const GLint* firsts,
+                        const GLsizei* counts,
+                        GLsizei drawcount) {
+  GLEXTENSION_METHOD_BODY(CAN_CALL_glMultiDrawArrays,
+                          glMultiDrawArrays,
+                          PFNIGLMULTIDRAWARRAYSPROC,
+                          mode,
+                          firsts,
+                          counts,
+                          drawcount);
+}
+
+void iglMultiDrawElements(GLenum mode,
+                          const GLsizei* counts,
+                          GLenum type,
+                          const GLvoid* const* offsets,
+                          GLsizei drawcount) {
+  GLEXTENSION_METHOD_BODY(CAN_CALL_glMultiDrawElements,
+                          glMultiDrawElements,
+                          PFNIGLMULTIDRAWELEMENTSPROC,
+                          mode,
+                          counts,
+                          type,
+                          offsets,
+                          drawcount);
+}
+
+///--------------------------------------
+/// MARK: - GL_EXT_multi_draw_indirect
+
+#if defined(GL_EXT_multi_draw_indirect)
+#define CAN_CALL_glMultiDrawArraysIndirectEXT CAN_CALL_OPENGL_ES
+#define CAN_CALL_glMultiDrawElementsIndirectEXT CAN_CALL_OPENGL_ES
+#else
+#define CAN_CALL_glMultiDrawArraysIndirectEXT 0
+#define CAN_CALL_glMultiDrawElementsIndirectEXT 0
+#endif
+
+void iglMultiDrawArraysIndirectEXT(GLenum mode,
+                                   const GLvoid* indirect,
+                                   GLsizei drawcount,
+                                   GLsizei stride) {
+  GLEXTENSION_METHOD_BODY(CAN_CALL_glMultiDrawArraysIndirectEXT,
+                          glMultiDrawArraysIndirectEXT,
+                          PFNIGLMULTIDRAWARRAYSINDIRECTPROC,
+                          mode,
+                          indirect,
+                          drawcount,
+                          stride);
+}
+
+void iglMultiDrawElementsIndirectEXT(GLenum mode,
+                                     GLenum type,
+                                     const GLvoid* indirect,
+                                     GLsizei drawcount,
+                                     GLsizei stride) {
+  GLEXTENSION_METHOD_BODY(CAN_CALL_glMultiDrawElementsIndirectEXT,
+                          glMultiDrawElementsIndirectEXT,
+                          PFNIGLMULTIDRAWELEMENTSINDIRECTPROC,
+                          mode,
+                          type,
+                          indirect,
+                          drawcount,
+                          stride);
+}
+
 ///--------------------------------------
 /// MARK: - GL_EXT_multisampled_render_to_texture
 
@@ -1647,6 +2041,22 @@ void iglPushDebugGroupKHR(GLenum source, GLuint id, GLsizei length, const GLchar
                           message);
 }
 
+///--------------------------------------
+/// MARK: - GL_KHR_parallel_shader_compile
+
+#if defined(GL_KHR_parallel_shader_compile)
+#define CAN_CALL_glMaxShaderCompilerThreadsKHR CAN_CALL
+#else
+#define CAN_CALL_glMaxShaderCompilerThreadsKHR 0
+#endif
+
+void iglMaxShaderCompilerThreadsKHR(GLuint count) {
+  GLEXTENSION_METHOD_BODY(CAN_CALL_glMaxShaderCompilerThreadsKHR,
+                          glMaxShaderCompilerThreadsKHR,
+                          PFNIGLMAXSHADERCOMPILERTHREADSKHRPROC,
+                          count);
+}
+
 ///--------------------------------------
 /// MARK: - GL_NV_bindless_texture
 
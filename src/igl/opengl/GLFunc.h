@@ -54,9 +54,14 @@ using PFNIGLBLITFRAMEBUFFERPROC = void (*)(GLint srcX0,
                                            GLint dstY1,
                                            GLbitfield mask,
                                            GLenum filter);
+using PFNIGLBUFFERSTORAGEPROC = void (*)(GLenum target,
+                                         GLsizeiptr size,
+                                         const void* data,
+                                         GLbitfield flags);
 using PFNIGLCHECKFRAMEBUFFERSTATUSPROC = GLenum (*)(GLenum target);
 using PFNIGLCLEARDEPTHPROC = void (*)(GLdouble depth);
 using PFNIGLCLEARDEPTHFPROC = void (*)(GLfloat depth);
+using PFNIGLCLIENTWAITSYNCPROC = GLenum (*)(GLsync sync, GLbitfield flags, GLuint64 timeout);
 using PFNIGLCOMPRESSEDTEXIMAGE3DPROC = void (*)(GLenum target,
                                                 GLint level,
                                                 GLenum internalformat,
@@ -103,8 +108,18 @@ using PFNIGLDISCARDFRAMEBUFFERPROC = void (*)(GLenum target,
 using PFNIGLDISPATCHCOMPUTEPROC = void (*)(GLuint num_groups_x,
                                            GLuint num_groups_y,
                                            GLuint num_groups_z);
+using PFNIGLDRAWARRAYSINDIRECTPROC = void (*)(GLenum mode, const GLvoid* indirect);
+using PFNIGLDRAWARRAYSINSTANCEDPROC = void (*)(GLenum mode,
+                                               GLint first,
+                                               GLsizei count,
+                                               GLsizei instancecount);
 using PFNIGLDRAWBUFFERSPROC = void (*)(GLsizei, const GLenum*);
 using PFNIGLDRAWELEMENTSINDIRECTPROC = void (*)(GLenum mode, GLenum type, const GLvoid* indirect);
+using PFNIGLDRAWELEMENTSINSTANCEDPROC = void (*)(GLenum mode,
+                                                 GLsizei count,
+                                                 GLenum type,
+                                                 const GLvoid* indices,
+                                                 GLsizei instancecount);
 using PFNIGLFENCESYNCPROC = GLsync (*)(GLenum condition, GLbitfield flags);
 using PFNIGLFRAMEBUFFERRENDERBUFFERPROC = void (*)(GLenum target,
                                                    GLenum attachment,
@@ -185,6 +200,8 @@ using PFNIGLGETPROGRAMRESOURCENAMEPROC = void (*)(GLuint program,
                                                   GLsizei* length,
                                                   char* name);
 using PFNIGLGETRENDERBUFFERPARAMETERIVPROC = void (*)(GLenum target, GLenum pname, GLint* params);
+using PFNIGLGETPROGRAMBINARYPROC =
+    void (*)(GLuint program, GLsizei bufSize, GLsizei* length, GLenum* binaryFormat, void* binary);
 using PFNIGLGETSTRINGIPROC = const GLubyte* (*)(GLenum name, GLuint index);
 using PFNIGLGETSYNCIVPROC =
     void (*)(GLsync sync, GLenum pname, GLsizei bufSize, GLsizei* length, GLint* values);
@@ -207,13 +224,41 @@ using PFNIGLMAPBUFFERRANGEPROC = void* (*)(GLenum target,
                                            GLintptr offset,
                                            GLsizeiptr length,
                                            GLbitfield access);
+using PFNIGLMAXSHADERCOMPILERTHREADSKHRPROC = void (*)(GLuint count);
 using PFNIGLMEMORYBARRIERPROC = void (*)(GLbitfield barriers);
+using PFNIGLMULTIDRAWARRAYSPROC = void (*)(GLenum mode,
+                                           const GLint* firsts,
+                                           const GLsizei* counts,
+                                           GLsizei drawcount);
+using PFNIGLMULTIDRAWELEMENTSPROC = void (*)(GLenum mode,
+                                             const GLsizei* counts,
+                                             GLenum type,
+                                             const GLvoid* const* offsets,
+                                             GLsizei drawcount);
+using PFNIGLMULTIDRAWARRAYSINDIRECTPROC = void (*)(GLenum mode,
+                                                   const GLvoid* indirect,
+                                                   GLsizei drawcount,
+                                                   GLsizei stride);
+using PFNIGLMULTIDRAWELEMENTSINDIRECTPROC = void (*)(GLenum mode,
+                                                     GLenum type,
+                                                     const GLvoid* indirect,
+                                                     GLsizei drawcount,
+                                                     GLsizei stride);
+using PFNIGLNAMEDBUFFERSUBDATAPROC = void (*)(GLuint buffer,
+                                              GLintptr offset,
+                                              GLsizeiptr size,
+                                              const GLvoid* data);
 using PFNIGLOBJECTLABELPROC = void (*)(GLenum identifier,
                                        GLuint name,
                                        GLsizei length,
                                        const char* label);
 using PFNIGLPOPDEBUGGROUPPROC = void (*)();
 using PFNIGLPOPGROUPMARKERPROC = void (*)();
+using PFNIGLPROGRAMBINARYPROC = void (*)(GLuint program,
+                                         GLenum binaryFormat,
+                                         const void* binary,
+                                         GLsizei length);
+using PFNIGLPROGRAMPARAMETERIPROC = void (*)(GLuint program, GLenum pname, GLint value);
 using PFNIGLPUSHDEBUGGROUPPROC = void (*)(GLenum source,
                                           GLuint id,
                                           GLsizei length,
@@ -312,7 +357,13 @@ void iglDebugMessageInsert(GLenum source,
                            GLenum severity,
                            GLsizei length,
                            const GLchar* buf);
+void iglDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount);
 void iglDrawBuffers(GLsizei n, const GLenum* bufs);
+void iglDrawElementsInstanced(GLenum mode,
+                              GLsizei count,
+                              GLenum type,
+                              const GLvoid* indices,
+                              GLsizei instancecount);
 GLuint iglGetDebugMessageLog(GLuint count,
                              GLsizei bufSize,
                              GLenum* sources,
@@ -350,6 +401,19 @@ void iglTexSubImage3D(GLenum target,
 void iglUnmapBuffer(GLenum target);
 void iglVertexAttribDivisor(GLuint index, GLuint divisor);
 
+///--------------------------------------
+/// MARK: - GL_ANGLE_multi_draw
+
+void iglMultiDrawArraysANGLE(GLenum mode,
+                             const GLint* firsts,
+                             const GLsizei* counts,
+                             GLsizei drawcount);
+void iglMultiDrawElementsANGLE(GLenum mode,
+                               const GLsizei* counts,
+                               GLenum type,
+                               const GLvoid* const* offsets,
+                               GLsizei drawcount);
+
 ///--------------------------------------
 /// MARK: - GL_APPLE_framebuffer_multisample
 
@@ -361,6 +425,7 @@ void iglRenderbufferStorageMultisampleAPPLE(GLenum target,
 ///--------------------------------------
 /// MARK: - GL_APPLE_sync
 
+GLenum iglClientWaitSyncAPPLE(GLsync sync, GLbitfield flags, GLuint64 timeout);
 void iglDeleteSyncAPPLE(GLsync sync);
 GLsync iglFenceSyncAPPLE(GLenum condition, GLbitfield flags);
 void iglGetSyncivAPPLE(GLsync sync, GLenum pname, GLsizei bufSize, GLsizei* length, GLint* values);
@@ -372,14 +437,25 @@ GLuint64 iglGetTextureHandleARB(GLuint texture);
 void iglMakeTextureHandleResidentARB(GLuint64 handle);
 void iglMakeTextureHandleNonResidentARB(GLuint64 handle);
 
+///--------------------------------------
+/// MARK: - GL_ARB_buffer_storage
+
+void iglBufferStorage(GLenum target, GLsizeiptr size, const void* data, GLbitfield flags);
+
 ///--------------------------------------
 /// MARK: - GL_ARB_compute_shader
 
 void iglDispatchCompute(GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z);
 
+///--------------------------------------
+/// MARK: - GL_ARB_direct_state_access
+
+void iglNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, const GLvoid* data);
+
 ///--------------------------------------
 /// MARK: - GL_ARB_draw_indirect
 
+void iglDrawArraysIndirect(GLenum mode, const GLvoid* indirect);
 void iglDrawElementsIndirect(GLenum mode, GLenum type, const GLvoid* indirect);
 
 ///--------------------------------------
@@ -436,6 +512,17 @@ void iglRenderbufferStorageMultisample(GLenum target,
                                        GLsizei width,
                                        GLsizei height);
 
+///--------------------------------------
+/// MARK: - GL_ARB_get_program_binary
+
+void iglGetProgramBinary(GLuint program,
+                         GLsizei bufSize,
+                         GLsizei* length,
+                         GLenum* binaryFormat,
+                         void* binary);
+void iglProgramBinary(GLuint program, GLenum binaryFormat, const void* binary, GLsizei length);
+void iglProgramParameteri(GLuint program, GLenum pname, GLint value);
+
 ///--------------------------------------
 /// MARK: - GL_ARB_invalidate_subdata
 
@@ -446,6 +533,19 @@ void iglInvalidateFramebuffer(GLenum target, GLsizei numAttachments, const GLenu
 
 void* iglMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access);
 
+///--------------------------------------
+/// MARK: - GL_ARB_multi_draw_indirect
+
+void iglMultiDrawArraysIndirect(GLenum mode,
+                                const GLvoid* indirect,
+                                GLsizei drawcount,
+                                GLsizei stride);
+void iglMultiDrawElementsIndirect(GLenum mode,
+                                  GLenum type,
+                                  const GLvoid* indirect,
+                                  GLsizei drawcount,
+                                  GLsizei stride);
+
 ///--------------------------------------
 /// MARK: - GL_ARB_program_interface_query
 
@@ -481,6 +581,7 @@ void iglMemoryBarrier(GLbitfield barriers);
 ///--------------------------------------
 /// MARK: - GL_ARB_sync
 
+GLenum iglClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout);
 void iglDeleteSync(GLsync sync);
 GLsync iglFenceSync(GLenum condition, GLbitfield flags);
 void iglGetSynciv(GLsync sync, GLenum pname, GLsizei bufSize, GLsizei* length, GLint* values);
@@ -531,6 +632,11 @@ void iglBindVertexArray(GLuint vao);
 void iglDeleteVertexArrays(GLsizei n, const GLuint* vertexArrays);
 void iglGenVertexArrays(GLsizei n, GLuint* vertexArrays);
 
+///--------------------------------------
+/// MARK: - GL_EXT_buffer_storage
+
+void iglBufferStorageEXT(GLenum target, GLsizeiptr size, const void* data, GLbitfield flags);
+
 ///--------------------------------------
 /// MARK: - GL_EXT_debug_label
 
@@ -606,6 +712,32 @@ void iglTexStorageMem3DEXT(GLenum target,
 
 void iglImportMemoryFdEXT(GLuint memory, GLuint64 size, GLenum handleType, GLint fd);
 
+///--------------------------------------
+/// MARK: - GL_EXT_multi_draw_arrays
+
+void iglMultiDrawArrays(GLenum mode,
+                        const GLint* firsts,
+                        const GLsizei* counts,
+                        GLsizei drawcount);
+void iglMultiDrawElements(GLenum mode,
+                          const GLsizei* counts,
+                          GLenum type,
+                          const GLvoid* const* offsets,
+                          GLsizei drawcount);
+
+///--------------------------------------
+/// MARK: - GL_EXT_multi_draw_indirect
+
+void iglMultiDrawArraysIndirectEXT(GLenum mode,
+                                   const GLvoid* indirect,
+                                   GLsizei drawcount,
+                                   GLsizei stride);
+void iglMultiDrawElementsIndirectEXT(GLenum mode,
+                                     GLenum type,
+                                     const GLvoid* indirect,
+                                     GLsizei drawcount,
+                                     GLsizei stride);
+
 ///--------------------------------------
 /// MARK: - GL_EXT_multisampled_render_to_texture
 
@@ -686,6 +818,11 @@ void iglObjectLabelKHR(GLenum identifier, GLuint name, GLsizei length, const cha
 void iglPopDebugGroupKHR();
 void iglPushDebugGroupKHR(GLenum source, GLuint id, GLsizei length, const GLchar* message);
 
+///--------------------------------------
+/// MARK: - GL_KHR_parallel_shader_compile
+
+void iglMaxShaderCompilerThreadsKHR(GLuint count);
+
 ///--------------------------------------
 /// MARK: - GL_NV_bindless_texture
 
@@ -79,6 +79,10 @@
     #include <GLES3/gl3.h>
     #include <GLES2/gl2ext.h>
   #else
+    #if IGL_OPENGL_STATIC_DISPATCH
+      // expose prototypes so GL entry points can be called (and linked) directly
+      #define GL_GLEXT_PROTOTYPES
+    #endif
     #include <GL/gl.h>
     #include <GL/glcorearb.h>
   #endif
@@ -103,6 +107,9 @@
 #ifndef GL_ALPHA8
 #define GL_ALPHA8 0x803C
 #endif
+#ifndef GL_ALREADY_SIGNALED
+#define GL_ALREADY_SIGNALED 0x911a
+#endif
 #ifndef GL_BLUE
 #define GL_BLUE 0x1905
 #endif
@@ -130,12 +137,24 @@
 #ifndef GL_BUFFER_UPDATE_BARRIER_BIT
 #define GL_BUFFER_UPDATE_BARRIER_BIT 0x200
 #endif
+#ifndef GL_CLIP_DISTANCE0
+#define GL_CLIP_DISTANCE0 0x3000
+#endif
+#ifndef GL_COLOR
+#define GL_COLOR 0x1800
+#endif
 #ifndef GL_COLOR_ATTACHMENT1
 #define GL_COLOR_ATTACHMENT1 0x8ce1
 #endif
+#ifndef GL_CONDITION_SATISFIED
+#define GL_CONDITION_SATISFIED 0x911c
+#endif
 #ifndef GL_COMPARE_REF_TO_TEXTURE
 #define GL_COMPARE_REF_TO_TEXTURE 0x884e
 #endif
+#ifndef GL_COMPLETION_STATUS_KHR
+#define GL_COMPLETION_STATUS_KHR 0x91b1
+#endif
 #ifndef GL_COMPRESSED_R11_EAC
 #define GL_COMPRESSED_R11_EAC 0x9270
 #endif
@@ -373,6 +392,9 @@
 #ifndef GL_DYNAMIC_READ
 #define GL_DYNAMIC_READ 0x88e9
 #endif
+#ifndef GL_DYNAMIC_STORAGE_BIT
+#define GL_DYNAMIC_STORAGE_BIT 0x100
+#endif
 #ifndef GL_ELEMENT_ARRAY_BARRIER_BIT
 #define GL_ELEMENT_ARRAY_BARRIER_BIT 0x2
 #endif
@@ -490,9 +512,21 @@
 #ifndef GL_LUMINANCE8_ALPHA8
 #define GL_LUMINANCE8_ALPHA8 0x8045
 #endif
+#ifndef GL_MAP_COHERENT_BIT
+#define GL_MAP_COHERENT_BIT 0x80
+#endif
+#ifndef GL_MAP_INVALIDATE_BUFFER_BIT
+#define GL_MAP_INVALIDATE_BUFFER_BIT 0x8
+#endif
+#ifndef GL_MAP_PERSISTENT_BIT
+#define GL_MAP_PERSISTENT_BIT 0x40
+#endif
 #ifndef GL_MAP_READ_BIT
 #define GL_MAP_READ_BIT 0x1
 #endif
+#ifndef GL_MAP_WRITE_BIT
+#define GL_MAP_WRITE_BIT 0x2
+#endif
 #ifndef GL_MAX
 #define GL_MAX 0x8008
 #endif
@@ -514,6 +548,9 @@
 #ifndef GL_MAX_SAMPLES_IMG
 #define GL_MAX_SAMPLES_IMG 0x9135
 #endif
+#ifndef GL_MAX_SHADER_COMPILER_THREADS_KHR
+#define GL_MAX_SHADER_COMPILER_THREADS_KHR 0x91b0
+#endif
 #ifndef GL_MAX_SHADER_STORAGE_BLOCK_SIZE
 #define GL_MAX_SHADER_STORAGE_BLOCK_SIZE 0x90de
 #endif
@@ -532,6 +569,9 @@
 #ifndef GL_NUM_EXTENSIONS
 #define GL_NUM_EXTENSIONS 0x821d
 #endif
+#ifndef GL_NUM_PROGRAM_BINARY_FORMATS
+#define GL_NUM_PROGRAM_BINARY_FORMATS 0x87fe
+#endif
 #ifndef GL_PIXEL_PACK_BUFFER
 #define GL_PIXEL_PACK_BUFFER 0x88eb
 #endif
@@ -541,6 +581,12 @@
 #ifndef GL_PROGRAM
 #define GL_PROGRAM 0x82e2
 #endif
+#ifndef GL_PROGRAM_BINARY_LENGTH
+#define GL_PROGRAM_BINARY_LENGTH 0x8741
+#endif
+#ifndef GL_PROGRAM_BINARY_RETRIEVABLE_HINT
+#define GL_PROGRAM_BINARY_RETRIEVABLE_HINT 0x8257
+#endif
 #ifndef GL_PROGRAM_OBJECT_EXT
 #define GL_PROGRAM_OBJECT_EXT 0x8B40
 #endif
@@ -700,6 +746,9 @@
 #ifndef GL_STREAM_READ
 #define GL_STREAM_READ 0x88e1
 #endif
+#ifndef GL_SYNC_FLUSH_COMMANDS_BIT
+#define GL_SYNC_FLUSH_COMMANDS_BIT 0x1
+#endif
 #ifndef GL_SYNC_GPU_COMMANDS_COMPLETE
 #define GL_SYNC_GPU_COMMANDS_COMPLETE 0x9117
 #endif
@@ -772,6 +821,9 @@
 #ifndef GL_TEXTURE_WRAP_R
 #define GL_TEXTURE_WRAP_R 0x8072
 #endif
+#ifndef GL_TIMEOUT_EXPIRED
+#define GL_TIMEOUT_EXPIRED 0x911b
+#endif
 #ifndef GL_TRANSFORM_FEEDBACK_BUFFER
 #define GL_TRANSFORM_FEEDBACK_BUFFER 0x8c8e
 #endif
@@ -796,6 +848,9 @@
 #ifndef GL_UNPACK_ROW_LENGTH
 #define GL_UNPACK_ROW_LENGTH 0x0cf2
 #endif
+#ifndef GL_UNSIGNALED
+#define GL_UNSIGNALED 0x9118
+#endif
 #ifndef GL_UNSIGNED_INT_10F_11F_11F_REV
 #define GL_UNSIGNED_INT_10F_11F_11F_REV 0x8c3b
 #endif
@@ -832,3 +887,6 @@
 #ifndef GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT
 #define GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT 0x1
 #endif
+#ifndef GL_WAIT_FAILED
+#define GL_WAIT_FAILED 0x911d
+#endif
@@ -8,6 +8,7 @@
 #include <igl/DeviceFeatures.h>
 #include <igl/opengl/IContext.h>
 
+#include <cstdio>
 #include <cstring>
 #include <igl/Assert.h>
 #include <igl/opengl/Errors.h>
@@ -769,6 +770,11 @@ bool IContext::shouldQueueAPI() const {
 }
 
 void IContext::activeTexture(GLenum texture) {
+  if (stateShadow_.activeTextureValid && stateShadow_.activeTexture == texture) {
+    return;
+  }
+  stateShadow_.activeTexture = texture;
+  stateShadow_.activeTextureValid = true;
   GLCALL(ActiveTexture)(texture);
   APILOG("glActiveTexture(%s)\n", GL_ENUM_TO_STRING(texture));
   GLCHECK_ERRORS();
@@ -787,12 +793,23 @@ void IContext::bindAttribLocation(GLuint program, GLuint index, const GLchar* na
 }
 
 void IContext::bindBuffer(GLenum target, GLuint buffer) {
+  // the element array binding is part of the bound VAO, not the context, so it cannot be
+  // shadowed here: switching VAOs changes it behind our back
+  if (target != GL_ELEMENT_ARRAY_BUFFER) {
+    const auto it = stateShadow_.boundBuffers.find(target);
+    if (it != stateShadow_.boundBuffers.end() && it->second == buffer) {
+      return;
+    }
+    stateShadow_.boundBuffers[target] = buffer;
+  }
   GLCALL(BindBuffer)(target, buffer);
   APILOG("glBindBuffer(%s, %u)\n", GL_ENUM_TO_STRING(target), buffer);
   GLCHECK_ERRORS();
 }
 
 void IContext::bindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+  // also binds to the generic binding point; the indexed bindings themselves are not shadowed
+  stateShadow_.boundBuffers[target] = buffer;
   IGLCALL(BindBufferBase)(target, index, buffer);
   APILOG("glBindBufferBase(%s, %u, %u)\n", GL_ENUM_TO_STRING(target), index, buffer);
   GLCHECK_ERRORS();
@@ -803,6 +820,8 @@ void IContext::bindBufferRange(GLenum target,
                                GLuint buffer,
                                GLintptr offset,
                                GLsizeiptr size) {
+  // also binds to the generic binding point; the indexed bindings themselves are not shadowed
+  stateShadow_.boundBuffers[target] = buffer;
   IGLCALL(BindBufferRange)(target, index, buffer, offset, size);
   APILOG("glBindBufferRange(%s, %u, %u)\n", GL_ENUM_TO_STRING(target), index, buffer);
   GLCHECK_ERRORS();
@@ -821,6 +840,19 @@ void IContext::bindRenderbuffer(GLenum target, GLuint renderbuffer) {
 }
 
 void IContext::bindTexture(GLenum target, GLuint texture) {
+  // attribute the binding to the shadowed active texture unit; when the active unit is unknown
+  // (or out of shadowing range) the call is forwarded without being recorded
+  const size_t unit = stateShadow_.activeTextureValid
+                          ? static_cast<size_t>(stateShadow_.activeTexture - GL_TEXTURE0)
+                          : StateShadow::kTextureUnits;
+  if (unit < StateShadow::kTextureUnits) {
+    auto& bound = stateShadow_.boundTextures[unit];
+    const auto it = bound.find(target);
+    if (it != bound.end() && it->second == texture) {
+      return;
+    }
+    bound[target] = texture;
+  }
   GLCALL(BindTexture)(target, texture);
   APILOG("glBindTexture(%s, %u)\n", GL_ENUM_TO_STRING(target), texture);
   GLCHECK_ERRORS();
@@ -878,12 +910,26 @@ void IContext::blendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alph
 }
 
 void IContext::blendEquation(GLenum mode) {
+  if (stateShadow_.blendEquationValid && stateShadow_.blendEquationRGB == mode &&
+      stateShadow_.blendEquationAlpha == mode) {
+    return;
+  }
+  stateShadow_.blendEquationRGB = mode;
+  stateShadow_.blendEquationAlpha = mode;
+  stateShadow_.blendEquationValid = true;
   GLCALL(BlendEquation)(mode);
   APILOG("glBlendEquation(%s)\n", GL_ENUM_TO_STRING(mode));
   GLCHECK_ERRORS();
 }
 
 void IContext::blendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) {
+  if (stateShadow_.blendEquationValid && stateShadow_.blendEquationRGB == modeRGB &&
+      stateShadow_.blendEquationAlpha == modeAlpha) {
+    return;
+  }
+  stateShadow_.blendEquationRGB = modeRGB;
+  stateShadow_.blendEquationAlpha = modeAlpha;
+  stateShadow_.blendEquationValid = true;
   GLCALL(BlendEquationSeparate)(modeRGB, modeAlpha);
   APILOG("glBlendEquationSeparate(%s, %s)\n",
          GL_ENUM_TO_STRING(modeRGB),
@@ -892,12 +938,32 @@ void IContext::blendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) {
 }
 
 void IContext::blendFunc(GLenum sfactor, GLenum dfactor) {
+  if (stateShadow_.blendFuncValid && stateShadow_.blendSrcRGB == sfactor &&
+      stateShadow_.blendDstRGB == dfactor && stateShadow_.blendSrcAlpha == sfactor &&
+      stateShadow_.blendDstAlpha == dfactor) {
+    return;
+  }
+  stateShadow_.blendSrcRGB = sfactor;
+  stateShadow_.blendDstRGB = dfactor;
+  stateShadow_.blendSrcAlpha = sfactor;
+  stateShadow_.blendDstAlpha = dfactor;
+  stateShadow_.blendFuncValid = true;
   GLCALL(BlendFunc)(sfactor, dfactor);
   APILOG("glBlendFunc(%s, %s)\n", GL_ENUM_TO_STRING(sfactor), GL_ENUM_TO_STRING(dfactor));
   GLCHECK_ERRORS();
 }
 
 void IContext::blendFuncSeparate(GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha) {
+  if (stateShadow_.blendFuncValid && stateShadow_.blendSrcRGB == srcRGB &&
+      stateShadow_.blendDstRGB == dstRGB && stateShadow_.blendSrcAlpha == srcAlpha &&
+      stateShadow_.blendDstAlpha == dstAlpha) {
+    return;
+  }
+  stateShadow_.blendSrcRGB = srcRGB;
+  stateShadow_.blendDstRGB = dstRGB;
+  stateShadow_.blendSrcAlpha = srcAlpha;
+  stateShadow_.blendDstAlpha = dstAlpha;
+  stateShadow_.blendFuncValid = true;
   GLCALL(BlendFuncSeparate)(srcRGB, dstRGB, srcAlpha, dstAlpha);
   APILOG("glBlendFuncSeparate(%s, %s, %s, %s)\n",
          GL_ENUM_TO_STRING(srcRGB),
@@ -953,6 +1019,23 @@ void IContext::bufferData(GLenum target, GLsizeiptr size, const GLvoid* data, GL
   GLCHECK_ERRORS();
 }
 
+void IContext::bufferStorage(GLenum target, GLsizeiptr size, const GLvoid* data, GLbitfield flags) {
+  if (bufferStorageProc_ == nullptr) {
+    if (deviceFeatureSet_.hasInternalRequirement(InternalRequirement::BufferStorageExtReq)) {
+      if (deviceFeatureSet_.hasExtension(Extensions::BufferStorage)) {
+        bufferStorageProc_ = iglBufferStorageEXT;
+      }
+    } else if (deviceFeatureSet_.hasInternalFeature(InternalFeatures::BufferStorage)) {
+      bufferStorageProc_ = iglBufferStorage;
+    }
+    IGL_ASSERT_MSG(bufferStorageProc_, "No supported function for glBufferStorage\n");
+  }
+
+  GLCALL_PROC(bufferStorageProc_, target, size, data, flags);
+  APILOG("glBufferStorage(%s, %zu, %p, 0x%x)\n", GL_ENUM_TO_STRING(target), size, data, flags);
+  GLCHECK_ERRORS();
+}
+
 void IContext::bufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const GLvoid* data) {
   GLCALL(BufferSubData)(target, offset, size, data);
   APILOG("glBufferSubData(%s, %zu, %zu, %p)\n", GL_ENUM_TO_STRING(target), offset, size, data);
@@ -1004,7 +1087,38 @@ void IContext::clearStencil(GLint s) {
   GLCHECK_ERRORS();
 }
 
+GLenum IContext::clientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+  if (clientWaitSyncProc_ == nullptr) {
+    if (deviceFeatureSet_.hasInternalRequirement(InternalRequirement::SyncExtReq)) {
+      if (deviceFeatureSet_.hasExtension(Extensions::Sync)) {
+        clientWaitSyncProc_ = iglClientWaitSyncAPPLE;
+      }
+    } else if (deviceFeatureSet_.hasInternalFeature(InternalFeatures::Sync)) {
+      clientWaitSyncProc_ = iglClientWaitSync;
+    }
+    IGL_ASSERT_MSG(clientWaitSyncProc_, "No supported function for glClientWaitSync\n");
+  }
+
+  GLenum ret;
+
+  GLCALL_PROC_WITH_RETURN(ret, clientWaitSyncProc_, GL_WAIT_FAILED, sync, flags, timeout);
+  APILOG("glClientWaitSync(%p, %u, %llu) = %s\n", sync, flags, timeout, GL_ENUM_TO_STRING(ret));
+  GLCHECK_ERRORS();
+
+  return ret;
+}
+
 void IContext::colorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) {
+  if (stateShadow_.colorMaskValid && stateShadow_.colorMask[0] == red &&
+      stateShadow_.colorMask[1] == green && stateShadow_.colorMask[2] == blue &&
+      stateShadow_.colorMask[3] == alpha) {
+    return;
+  }
+  stateShadow_.colorMask[0] = red;
+  stateShadow_.colorMask[1] = green;
+  stateShadow_.colorMask[2] = blue;
+  stateShadow_.colorMask[3] = alpha;
+  stateShadow_.colorMaskValid = true;
   GLCALL(ColorMask)(red, green, blue, alpha);
   APILOG("glColorMask(%s, %s, %s, %s)\n",
          GL_BOOL_TO_STRING(red),
@@ -1276,6 +1390,11 @@ GLuint IContext::createShader(GLenum shaderType) {
 }
 
 void IContext::cullFace(GLint mode) {
+  if (stateShadow_.cullFaceValid && stateShadow_.cullFace == mode) {
+    return;
+  }
+  stateShadow_.cullFace = mode;
+  stateShadow_.cullFaceValid = true;
   GLCALL(CullFace)(mode);
   APILOG("glCullFace(%s)\n", GL_ENUM_TO_STRING(mode));
   GLCHECK_ERRORS();
@@ -1338,6 +1457,14 @@ void IContext::deleteBuffers(GLsizei n, const GLuint* buffers) {
     if (shouldQueueAPI()) {
       deletionQueues_.queueDeleteBuffers(n, buffers);
     } else {
+      // deleting a bound buffer reverts the generic binding to zero
+      for (auto& binding : stateShadow_.boundBuffers) {
+        for (GLsizei i = 0; i < n; ++i) {
+          if (binding.second == buffers[i] && buffers[i] != 0) {
+            binding.second = 0;
+          }
+        }
+      }
       GLCALL(DeleteBuffers)(n, buffers);
       APILOG("glDeleteBuffers(%u, %p)\n", n, buffers);
       GLCHECK_ERRORS();
@@ -1376,6 +1503,10 @@ void IContext::deleteProgram(GLuint program) {
     if (shouldQueueAPI()) {
       deletionQueues_.queueDeleteProgram(program);
     } else {
+      // the program name may be recycled once it is no longer current; stop eliding against it
+      if (stateShadow_.programValid && stateShadow_.program == program) {
+        stateShadow_.programValid = false;
+      }
       GLCALL(DeleteProgram)(program);
       APILOG("glDeleteProgram(%u)\n", program);
       GLCHECK_ERRORS();
@@ -1451,6 +1582,16 @@ void IContext::deleteTextures(const std::vector<GLuint>& textures) {
     if (shouldQueueAPI()) {
       deletionQueues_.queueDeleteTextures(textures);
     } else {
+      // deleting a bound texture reverts the bindings of every unit it is bound to back to zero
+      for (auto& bound : stateShadow_.boundTextures) {
+        for (auto& binding : bound) {
+          for (const GLuint texture : textures) {
+            if (binding.second == texture && texture != 0) {
+              binding.second = 0;
+            }
+          }
+        }
+      }
       GLCALL(DeleteTextures)(static_cast<GLsizei>(textures.size()), textures.data());
       APILOG("glDeleteTextures(%u, %p)\n", textures.size(), textures.data());
       GLCHECK_ERRORS();
@@ -1459,12 +1600,22 @@ void IContext::deleteTextures(const std::vector<GLuint>& textures) {
 }
 
 void IContext::depthFunc(GLenum func) {
+  if (stateShadow_.depthFuncValid && stateShadow_.depthFunc == func) {
+    return;
+  }
+  stateShadow_.depthFunc = func;
+  stateShadow_.depthFuncValid = true;
   GLCALL(DepthFunc)(func);
   APILOG("glDepthFunc(%s)\n", GL_ENUM_TO_STRING(func));
   GLCHECK_ERRORS();
 }
 
 void IContext::depthMask(GLboolean flag) {
+  if (stateShadow_.depthMaskValid && stateShadow_.depthMask == flag) {
+    return;
+  }
+  stateShadow_.depthMask = flag;
+  stateShadow_.depthMaskValid = true;
   GLCALL(DepthMask)(flag);
   APILOG("glDepthMask(%s)\n", GL_BOOL_TO_STRING(flag));
   GLCHECK_ERRORS();
@@ -1483,6 +1634,11 @@ void IContext::detachShader(GLuint program, GLuint shader) {
 }
 
 void IContext::disable(GLenum cap) {
+  const auto it = stateShadow_.capabilities.find(cap);
+  if (it != stateShadow_.capabilities.end() && !it->second) {
+    return;
+  }
+  stateShadow_.capabilities[cap] = false;
   GLCALL(Disable)(cap);
   APILOG("glDisable(%s)\n", GL_ENUM_TO_STRING(cap));
   GLCHECK_ERRORS();
@@ -1505,6 +1661,32 @@ void IContext::drawArrays(GLenum mode, GLint first, GLsizei count) {
   APILOG_DEC_DRAW_COUNT();
 }
 
+void IContext::drawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) {
+  drawCallCount_++;
+
+  IGL_PROFILER_ZONE_GPU_COLOR_OGL("drawArraysInstanced()", IGL_PROFILER_COLOR_DRAW);
+
+  IGLCALL(DrawArraysInstanced)(mode, first, count, instancecount);
+  APILOG("glDrawArraysInstanced(%s, %d, %u, %u)\n",
+         GL_ENUM_TO_STRING(mode),
+         first,
+         count,
+         instancecount);
+  GLCHECK_ERRORS();
+  APILOG_DEC_DRAW_COUNT();
+}
+
+void IContext::drawArraysIndirect(GLenum mode, const GLvoid* indirect) {
+  drawCallCount_++;
+
+  IGL_PROFILER_ZONE_GPU_COLOR_OGL("drawArraysIndirect()", IGL_PROFILER_COLOR_DRAW);
+
+  IGLCALL(DrawArraysIndirect)(mode, indirect);
+  APILOG("glDrawArraysIndirect(%s, %p)\n", GL_ENUM_TO_STRING(mode), indirect);
+  GLCHECK_ERRORS();
+  APILOG_DEC_DRAW_COUNT();
+}
+
 void IContext::drawBuffers(GLsizei n, GLenum* buffers) {
   if (drawBuffersProc_ == nullptr) {
     if (deviceFeatureSet_.hasFeature(DeviceFeatures::MultipleRenderTargets)) {
@@ -1541,6 +1723,26 @@ void IContext::drawElements(GLenum mode, GLsizei count, GLenum type, const GLvoi
   APILOG_DEC_DRAW_COUNT();
 }
 
+void IContext::drawElementsInstanced(GLenum mode,
+                                     GLsizei count,
+                                     GLenum type,
+                                     const GLvoid* indices,
+                                     GLsizei instancecount) {
+  drawCallCount_++;
+
+  IGL_PROFILER_ZONE_GPU_COLOR_OGL("drawElementsInstanced()", IGL_PROFILER_COLOR_DRAW);
+
+  IGLCALL(DrawElementsInstanced)(mode, count, type, indices, instancecount);
+  APILOG("glDrawElementsInstanced(%s, %u, %s, %p, %u)\n",
+         GL_ENUM_TO_STRING(mode),
+         count,
+         GL_ENUM_TO_STRING(type),
+         indices,
+         instancecount);
+  GLCHECK_ERRORS();
+  APILOG_DEC_DRAW_COUNT();
+}
+
 void IContext::drawElementsIndirect(GLenum mode, GLenum type, const GLvoid* indirect) {
   drawCallCount_++;
 
@@ -1556,6 +1758,11 @@ void IContext::drawElementsIndirect(GLenum mode, GLenum type, const GLvoid* indi
 }
 
 void IContext::enable(GLenum cap) {
+  const auto it = stateShadow_.capabilities.find(cap);
+  if (it != stateShadow_.capabilities.end() && it->second) {
+    return;
+  }
+  stateShadow_.capabilities[cap] = true;
   GLCALL(Enable)(cap);
   APILOG("glEnable(%s)\n", GL_ENUM_TO_STRING(cap));
   GLCHECK_ERRORS();
@@ -1701,6 +1908,11 @@ void IContext::framebufferTextureLayer(GLenum target,
 }
 
 void IContext::frontFace(GLenum mode) {
+  if (stateShadow_.frontFaceValid && stateShadow_.frontFace == mode) {
+    return;
+  }
+  stateShadow_.frontFace = mode;
+  stateShadow_.frontFaceValid = true;
   GLCALL(FrontFace)(mode);
   APILOG("glFrontFace(%s)\n", GL_ENUM_TO_STRING(mode));
   GLCHECK_ERRORS();
@@ -1990,6 +2202,24 @@ void IContext::getIntegerv(GLenum pname, GLint* params) const {
   GLCHECK_ERRORS();
 }
 
+void IContext::getProgramBinary(GLuint program,
+                                GLsizei bufSize,
+                                GLsizei* length,
+                                GLenum* binaryFormat,
+                                void* binary) {
+  if (getProgramBinaryProc_ == nullptr) {
+    if (deviceFeatureSet_.hasInternalFeature(InternalFeatures::GetProgramBinary)) {
+      getProgramBinaryProc_ = iglGetProgramBinary;
+    }
+    IGL_ASSERT_MSG(getProgramBinaryProc_, "No supported function for glGetProgramBinary\n");
+  }
+
+  GLCALL_PROC(getProgramBinaryProc_, program, bufSize, length, binaryFormat, binary);
+  APILOG(
+      "glGetProgramBinary(%u, %u, %p, %p, %p)\n", program, bufSize, length, binaryFormat, binary);
+  GLCHECK_ERRORS();
+}
+
 void IContext::getProgramiv(GLuint program, GLenum pname, GLint* params) const {
   GLCALL(GetProgramiv)(program, pname, params);
   APILOG("glGetProgramiv(%u, %s, %p) = %d\n",
@@ -2512,6 +2742,35 @@ void IContext::pushDebugGroup(GLenum source, GLuint id, GLsizei length, const GL
   }
 }
 
+void IContext::programBinary(GLuint program,
+                             GLenum binaryFormat,
+                             const void* binary,
+                             GLsizei length) {
+  if (programBinaryProc_ == nullptr) {
+    if (deviceFeatureSet_.hasInternalFeature(InternalFeatures::GetProgramBinary)) {
+      programBinaryProc_ = iglProgramBinary;
+    }
+    IGL_ASSERT_MSG(programBinaryProc_, "No supported function for glProgramBinary\n");
+  }
+
+  GLCALL_PROC(programBinaryProc_, program, binaryFormat, binary, length);
+  APILOG("glProgramBinary(%u, 0x%x, %p, %u)\n", program, binaryFormat, binary, length);
+  GLCHECK_ERRORS();
+}
+
+void IContext::programParameteri(GLuint program, GLenum pname, GLint value) {
+  if (programParameteriProc_ == nullptr) {
+    if (deviceFeatureSet_.hasInternalFeature(InternalFeatures::GetProgramBinary)) {
+      programParameteriProc_ = iglProgramParameteri;
+    }
+    IGL_ASSERT_MSG(programParameteriProc_, "No supported function for glProgramParameteri\n");
+  }
+
+  GLCALL_PROC(programParameteriProc_, program, pname, value);
+  APILOG("glProgramParameteri(%u, %s, %d)\n", program, GL_ENUM_TO_STRING(pname), value);
+  GLCHECK_ERRORS();
+}
+
 void IContext::popDebugGroup() {
   if (popDebugGroupProc_ == nullptr) {
     if (deviceFeatureSet_.hasInternalFeature(InternalFeatures::DebugMessage)) {
@@ -3316,6 +3575,11 @@ void IContext::unmapBuffer(GLenum target) {
 }
 
 void IContext::useProgram(GLuint program) {
+  if (stateShadow_.programValid && stateShadow_.program == program) {
+    return;
+  }
+  stateShadow_.program = program;
+  stateShadow_.programValid = true;
   GLCALL(UseProgram)(program);
   APILOG("glUseProgram(%u)\n", program);
   GLCHECK_ERRORS();
@@ -3451,6 +3715,19 @@ void IContext::dispatchCompute(GLuint num_groups_x, GLuint num_groups_y, GLuint
   GLCHECK_ERRORS();
 }
 
+void IContext::maxShaderCompilerThreads(GLuint count) {
+  if (maxShaderCompilerThreadsProc_ == nullptr) {
+    if (deviceFeatureSet_.hasInternalFeature(InternalFeatures::ParallelShaderCompile)) {
+      maxShaderCompilerThreadsProc_ = iglMaxShaderCompilerThreadsKHR;
+    }
+    IGL_ASSERT_MSG(maxShaderCompilerThreadsProc_,
+                   "No supported function for glMaxShaderCompilerThreadsKHR\n");
+  }
+  GLCALL_PROC(maxShaderCompilerThreadsProc_, count);
+  APILOG("glMaxShaderCompilerThreadsKHR(%u)\n", count);
+  GLCHECK_ERRORS();
+}
+
 void IContext::memoryBarrier(GLbitfield barriers) {
   if (memoryBarrierProc_ == nullptr) {
     if (deviceFeatureSet_.hasInternalRequirement(InternalRequirement::ShaderImageLoadStoreExtReq)) {
@@ -3467,6 +3744,135 @@ void IContext::memoryBarrier(GLbitfield barriers) {
   GLCHECK_ERRORS();
 }
 
+void IContext::multiDrawArrays(GLenum mode,
+                               const GLint* firsts,
+                               const GLsizei* counts,
+                               GLsizei drawcount) {
+  if (multiDrawArraysProc_ == nullptr) {
+    if (deviceFeatureSet_.hasExtension(Extensions::MultiDraw)) {
+      multiDrawArraysProc_ = iglMultiDrawArraysANGLE;
+    } else if (deviceFeatureSet_.hasInternalFeature(InternalFeatures::MultiDraw)) {
+      multiDrawArraysProc_ = iglMultiDrawArrays;
+    }
+    IGL_ASSERT_MSG(multiDrawArraysProc_, "No supported function for glMultiDrawArrays\n");
+  }
+  drawCallCount_ += static_cast<unsigned int>(drawcount);
+
+  IGL_PROFILER_ZONE_GPU_COLOR_OGL("multiDrawArrays()", IGL_PROFILER_COLOR_DRAW);
+
+  GLCALL_PROC(multiDrawArraysProc_, mode, firsts, counts, drawcount);
+  APILOG("glMultiDrawArrays(%s, %p, %p, %u)\n",
+         GL_ENUM_TO_STRING(mode),
+         firsts,
+         counts,
+         drawcount);
+  GLCHECK_ERRORS();
+  APILOG_DEC_DRAW_COUNT();
+}
+
+void IContext::multiDrawElements(GLenum mode,
+                                 const GLsizei* counts,
+                                 GLenum type,
+                                 const GLvoid* const* offsets,
+                                 GLsizei drawcount) {
+  if (multiDrawElementsProc_ == nullptr) {
+    if (deviceFeatureSet_.hasExtension(Extensions::MultiDraw)) {
+      multiDrawElementsProc_ = iglMultiDrawElementsANGLE;
+    } else if (deviceFeatureSet_.hasInternalFeature(InternalFeatures::MultiDraw)) {
+      multiDrawElementsProc_ = iglMultiDrawElements;
+    }
+    IGL_ASSERT_MSG(multiDrawElementsProc_, "No supported function for glMultiDrawElements\n");
+  }
+  drawCallCount_ += static_cast<unsigned int>(drawcount);
+
+  IGL_PROFILER_ZONE_GPU_COLOR_OGL("multiDrawElements()", IGL_PROFILER_COLOR_DRAW);
+
+  GLCALL_PROC(multiDrawElementsProc_, mode, counts, type, offsets, drawcount);
+  APILOG("glMultiDrawElements(%s, %p, %s, %p, %u)\n",
+         GL_ENUM_TO_STRING(mode),
+         counts,
+         GL_ENUM_TO_STRING(type),
+         offsets,
+         drawcount);
+  GLCHECK_ERRORS();
+  APILOG_DEC_DRAW_COUNT();
+}
+
+void IContext::multiDrawArraysIndirect(GLenum mode,
+                                       const GLvoid* indirect,
+                                       GLsizei drawcount,
+                                       GLsizei stride) {
+  if (multiDrawArraysIndirectProc_ == nullptr) {
+    if (deviceFeatureSet_.hasInternalRequirement(InternalRequirement::MultiDrawIndirectExtReq)) {
+      if (deviceFeatureSet_.hasExtension(Extensions::MultiDrawIndirect)) {
+        multiDrawArraysIndirectProc_ = iglMultiDrawArraysIndirectEXT;
+      }
+    } else if (deviceFeatureSet_.hasInternalFeature(InternalFeatures::MultiDrawIndirect)) {
+      multiDrawArraysIndirectProc_ = iglMultiDrawArraysIndirect;
+    }
+    IGL_ASSERT_MSG(multiDrawArraysIndirectProc_,
+                   "No supported function for glMultiDrawArraysIndirect\n");
+  }
+  drawCallCount_ += static_cast<unsigned int>(drawcount);
+
+  IGL_PROFILER_ZONE_GPU_COLOR_OGL("multiDrawArraysIndirect()", IGL_PROFILER_COLOR_DRAW);
+
+  GLCALL_PROC(multiDrawArraysIndirectProc_, mode, indirect, drawcount, stride);
+  APILOG("glMultiDrawArraysIndirect(%s, %p, %u, %u)\n",
+         GL_ENUM_TO_STRING(mode),
+         indirect,
+         drawcount,
+         stride);
+  GLCHECK_ERRORS();
+  APILOG_DEC_DRAW_COUNT();
+}
+
+void IContext::multiDrawElementsIndirect(GLenum mode,
+                                         GLenum type,
+                                         const GLvoid* indirect,
+                                         GLsizei drawcount,
+                                         GLsizei stride) {
+  if (multiDrawElementsIndirectProc_ == nullptr) {
+    if (deviceFeatureSet_.hasInternalRequirement(InternalRequirement::MultiDrawIndirectExtReq)) {
+      if (deviceFeatureSet_.hasExtension(Extensions::MultiDrawIndirect)) {
+        multiDrawElementsIndirectProc_ = iglMultiDrawElementsIndirectEXT;
+      }
+    } else if (deviceFeatureSet_.hasInternalFeature(InternalFeatures::MultiDrawIndirect)) {
+      multiDrawElementsIndirectProc_ = iglMultiDrawElementsIndirect;
+    }
+    IGL_ASSERT_MSG(multiDrawElementsIndirectProc_,
+                   "No supported function for glMultiDrawElementsIndirect\n");
+  }
+  drawCallCount_ += static_cast<unsigned int>(drawcount);
+
+  IGL_PROFILER_ZONE_GPU_COLOR_OGL("multiDrawElementsIndirect()", IGL_PROFILER_COLOR_DRAW);
+
+  GLCALL_PROC(multiDrawElementsIndirectProc_, mode, type, indirect, drawcount, stride);
+  APILOG("glMultiDrawElementsIndirect(%s, %s, %p, %u, %u)\n",
+         GL_ENUM_TO_STRING(mode),
+         GL_ENUM_TO_STRING(type),
+         indirect,
+         drawcount,
+         stride);
+  GLCHECK_ERRORS();
+  APILOG_DEC_DRAW_COUNT();
+}
+
+void IContext::namedBufferSubData(GLuint buffer,
+                                  GLintptr offset,
+                                  GLsizeiptr size,
+                                  const GLvoid* data) {
+  if (namedBufferSubDataProc_ == nullptr) {
+    if (deviceFeatureSet_.hasInternalFeature(InternalFeatures::DirectStateAccess)) {
+      namedBufferSubDataProc_ = iglNamedBufferSubData;
+    }
+    IGL_ASSERT_MSG(namedBufferSubDataProc_, "No supported function for glNamedBufferSubData\n");
+  }
+  GLCALL_PROC(namedBufferSubDataProc_, buffer, offset, size, data);
+  APILOG("glNamedBufferSubData(%u, %ld, %ld, %p)\n", buffer, offset, size, data);
+  GLCHECK_ERRORS();
+}
+
 void IContext::vertexAttribPointer(GLuint indx,
                                    GLint size,
                                    GLenum type,
@@ -3542,6 +3948,67 @@ GLenum IContext::checkForErrors(IGL_MAYBE_UNUSED const char* callerName,
 
 // This function has no effect in release mode because the current thinking
 // is there will be no need to call glGetError() after each GL call
+void IContext::invalidateCachedState() {
+  stateShadow_ = StateShadow{};
+}
+
+void IContext::saveContextState(StateShadow& outState) const {
+  outState = stateShadow_;
+}
+
+void IContext::restoreContextState(const StateShadow& state) {
+  // every group is re-applied through its shadowed setter, so a group whose current shadowed
+  // value already matches the snapshot costs only the comparison and no driver call
+  for (const auto& [cap, enabled] : state.capabilities) {
+    if (enabled) {
+      enable(cap);
+    } else {
+      disable(cap);
+    }
+  }
+  for (const auto& [target, buffer] : state.boundBuffers) {
+    bindBuffer(target, buffer);
+  }
+  for (size_t unit = 0; unit < StateShadow::kTextureUnits; ++unit) {
+    if (state.boundTextures[unit].empty()) {
+      continue;
+    }
+    activeTexture(static_cast<GLenum>(GL_TEXTURE0 + unit));
+    for (const auto& [target, texture] : state.boundTextures[unit]) {
+      bindTexture(target, texture);
+    }
+  }
+  // restore the active unit last so it does not depend on the texture loop order
+  if (state.activeTextureValid) {
+    activeTexture(state.activeTexture);
+  }
+  if (state.programValid) {
+    useProgram(state.program);
+  }
+  if (state.blendFuncValid) {
+    blendFuncSeparate(
+        state.blendSrcRGB, state.blendDstRGB, state.blendSrcAlpha, state.blendDstAlpha);
+  }
+  if (state.blendEquationValid) {
+    blendEquationSeparate(state.blendEquationRGB, state.blendEquationAlpha);
+  }
+  if (state.depthFuncValid) {
+    depthFunc(state.depthFunc);
+  }
+  if (state.depthMaskValid) {
+    depthMask(state.depthMask);
+  }
+  if (state.colorMaskValid) {
+    colorMask(state.colorMask[0], state.colorMask[1], state.colorMask[2], state.colorMask[3]);
+  }
+  if (state.cullFaceValid) {
+    cullFace(state.cullFace);
+  }
+  if (state.frontFaceValid) {
+    frontFace(state.frontFace);
+  }
+}
+
 void IContext::enableAutomaticErrorCheck(bool enable) {
 #if IGL_DEBUG
   alwaysCheckError_ = enable;
@@ -3608,54 +4075,85 @@ void IContext::initialize(Result* result) {
   }
   deviceFeatureSet_.initializeVersion(glVersion);
 
-  std::string extensions;
-  std::unordered_set<std::string> supportedExtensions;
-  if (!deviceFeatureSet_.hasInternalFeature(InternalFeatures::GetStringi)) {
-    const GLubyte* extensionStr = getString(GL_EXTENSIONS);
-
-    // If setCurrent() fails, then extensions may be nullptr.
-    if (extensionStr) {
-      extensions = std::string((char*)extensionStr);
+  // on-disk capability cache: the driver identity strings are a couple of glGetString() calls,
+  // much cheaper than the per-extension probing below, and change exactly when the cached
+  // capabilities could (device or driver update)
+  std::string deviceKey;
+  bool restoredCapabilities = false;
+  if (!capabilityCacheFilePath_.empty()) {
+    const char* vendor = (char*)getString(GL_VENDOR);
+    const char* renderer = (char*)getString(GL_RENDERER);
+    deviceKey = std::string(version != nullptr ? version : "(null)") + '\n' +
+                (vendor != nullptr ? vendor : "(null)") + '\n' +
+                (renderer != nullptr ? renderer : "(null)") + '\n';
+    const std::string blob = loadCapabilityCacheFile(deviceKey);
+    restoredCapabilities = !blob.empty() && deviceFeatureSet_.restoreCapabilities(blob);
+#if IGL_DEBUG || defined(IGL_FORCE_ENABLE_LOGS)
+    if (restoredCapabilities) {
+      IGL_LOG_INFO("GL capabilities restored from cache: %s\n", capabilityCacheFilePath_.c_str());
     }
-  } else {
-    GLint n = 0;
-    getIntegerv(GL_NUM_EXTENSIONS, &n);
-    if (IGL_VERIFY(n >= 0)) {
-      for (GLuint i = 0; i < static_cast<GLuint>(n); i++) {
-        auto ext = reinterpret_cast<const char*>(getStringi(GL_EXTENSIONS, i));
-        if (ext) {
-          supportedExtensions.insert(ext);
+#endif
+  }
+
+  if (!restoredCapabilities) {
+    std::string extensions;
+    std::unordered_set<std::string> supportedExtensions;
+    if (!deviceFeatureSet_.hasInternalFeature(InternalFeatures::GetStringi)) {
+      const GLubyte* extensionStr = getString(GL_EXTENSIONS);
+
+      // If setCurrent() fails, then extensions may be nullptr.
+      if (extensionStr) {
+        extensions = std::string((char*)extensionStr);
+      }
+    } else {
+      GLint n = 0;
+      getIntegerv(GL_NUM_EXTENSIONS, &n);
+      if (IGL_VERIFY(n >= 0)) {
+        for (GLuint i = 0; i < static_cast<GLuint>(n); i++) {
+          auto ext = reinterpret_cast<const char*>(getStringi(GL_EXTENSIONS, i));
+          if (ext) {
+            supportedExtensions.insert(ext);
+          }
         }
       }
     }
-  }
 
 #if IGL_DEBUG || defined(IGL_FORCE_ENABLE_LOGS)
-  IGL_LOG_INFO("GL Context Initialized: %p\n", this);
-  IGL_LOG_INFO("GL Version: %s\n", version);
-  const char* vendor = (char*)getString(GL_VENDOR);
-  IGL_LOG_INFO("GL Vendor: %s\n", (vendor != nullptr) ? vendor : "(null)");
-  const char* renderer = (char*)getString(GL_RENDERER);
-  IGL_LOG_INFO("GL Renderer: %s\n", (renderer != nullptr) ? renderer : "(null)");
-  if (!extensions.empty() || supportedExtensions.empty()) {
-    IGL_LOG_INFO("GL Extensions: %s\n", extensions.c_str());
-  } else {
-    std::vector<std::string> sortedExtensions(supportedExtensions.begin(),
-                                              supportedExtensions.end());
-    std::sort(sortedExtensions.begin(), sortedExtensions.end());
-    IGL_LOG_INFO("GL Extensions:\n");
-    for (const auto& extension : sortedExtensions) {
-      IGL_LOG_INFO("- %s\n", extension.c_str());
+    IGL_LOG_INFO("GL Context Initialized: %p\n", this);
+    IGL_LOG_INFO("GL Version: %s\n", version);
+    const char* vendor = (char*)getString(GL_VENDOR);
+    IGL_LOG_INFO("GL Vendor: %s\n", (vendor != nullptr) ? vendor : "(null)");
+    const char* renderer = (char*)getString(GL_RENDERER);
+    IGL_LOG_INFO("GL Renderer: %s\n", (renderer != nullptr) ? renderer : "(null)");
+    if (!extensions.empty() || supportedExtensions.empty()) {
+      IGL_LOG_INFO("GL Extensions: %s\n", extensions.c_str());
+    } else {
+      std::vector<std::string> sortedExtensions(supportedExtensions.begin(),
+                                                supportedExtensions.end());
+      std::sort(sortedExtensions.begin(), sortedExtensions.end());
+      IGL_LOG_INFO("GL Extensions:\n");
+      for (const auto& extension : sortedExtensions) {
+        IGL_LOG_INFO("- %s\n", extension.c_str());
+      }
     }
-  }
 #endif
 
-  deviceFeatureSet_.initializeExtensions(std::move(extensions), std::move(supportedExtensions));
+    deviceFeatureSet_.initializeExtensions(std::move(extensions), std::move(supportedExtensions));
+
+    if (!deviceKey.empty()) {
+      saveCapabilityCacheFile(deviceKey, deviceFeatureSet_.serializeCapabilities());
+    }
+  }
 
   if (deviceFeatureSet_.hasInternalFeature(InternalFeatures::SeamlessCubeMap)) {
     enable(GL_TEXTURE_CUBE_MAP_SEAMLESS);
   }
 
+  if (deviceFeatureSet_.hasInternalFeature(InternalFeatures::ParallelShaderCompile)) {
+    // let the driver pick its worker thread count for background shader compilation
+    maxShaderCompilerThreads(0xffffffffu);
+  }
+
 #if IGL_DEBUG || defined(IGL_API_LOG)
   if (deviceFeatureSet_.hasInternalFeature(InternalFeatures::DebugMessageCallback)) {
     enable(GL_DEBUG_OUTPUT);
@@ -3672,6 +4170,53 @@ void IContext::initialize(Result* result) {
 #endif
 }
 
+std::string IContext::capabilityCacheFilePath_; // NOLINT(cert-err58-cpp)
+
+void IContext::setCapabilityCacheFilePath(std::string path) {
+  capabilityCacheFilePath_ = std::move(path);
+}
+
+std::string IContext::loadCapabilityCacheFile(const std::string& deviceKey) const {
+  std::FILE* file = std::fopen(capabilityCacheFilePath_.c_str(), "rb");
+  if (!file) {
+    return {};
+  }
+
+  std::string data;
+  char buffer[4096];
+  size_t bytesRead = 0;
+  while ((bytesRead = std::fread(buffer, 1, sizeof(buffer), file)) > 0) {
+    data.append(buffer, bytesRead);
+  }
+  std::fclose(file);
+
+  if (data.compare(0, deviceKey.size(), deviceKey) != 0) {
+    // recorded for a different device or driver version; the caller re-probes and overwrites it
+    return {};
+  }
+
+  return data.substr(deviceKey.size());
+}
+
+void IContext::saveCapabilityCacheFile(const std::string& deviceKey,
+                                       const std::string& blob) const {
+  std::FILE* file = std::fopen(capabilityCacheFilePath_.c_str(), "wb");
+  if (!file) {
+    IGL_LOG_ERROR("Cannot write capability cache file: %s\n", capabilityCacheFilePath_.c_str());
+    return;
+  }
+
+  bool ok = std::fwrite(deviceKey.data(), 1, deviceKey.size(), file) == deviceKey.size();
+  ok = std::fwrite(blob.data(), 1, blob.size(), file) == blob.size() && ok;
+  std::fclose(file);
+
+  if (!ok) {
+    IGL_LOG_ERROR("Failed to write capability cache file: %s\n",
+                  capabilityCacheFilePath_.c_str());
+    std::remove(capabilityCacheFilePath_.c_str());
+  }
+}
+
 const DeviceFeatureSet& IContext::deviceFeatures() const {
   return deviceFeatureSet_;
 }
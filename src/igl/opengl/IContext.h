@@ -39,6 +39,12 @@ enum class RenderingAPI { GLES2, GLES3, GL };
 /// Individual types that implement this class are the ones that provide implementation
 /// for a concrete OpenGL API implementation.
 ///
+/// Thread safety: a context is thread-confined - every GL call must come from the thread the
+/// context is current on. The one cross-thread operation that is safe is releasing a resource:
+/// deletes issued while the context is not current are parked in the synchronized deletion
+/// queues and drained from the context thread. Distinct contexts may be driven from distinct
+/// threads concurrently.
+///
 class IContext {
  public:
   virtual void setCurrent() = 0;
@@ -97,12 +103,14 @@ class IContext {
                        GLbitfield mask,
                        GLenum filter);
   void bufferData(GLenum target, GLsizeiptr size, const GLvoid* data, GLenum usage);
+  void bufferStorage(GLenum target, GLsizeiptr size, const GLvoid* data, GLbitfield flags);
   void bufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const GLvoid* data);
   virtual GLenum checkFramebufferStatus(GLenum target);
   void clear(GLbitfield mask);
   void clearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha);
   void clearDepthf(GLfloat depth);
   void clearStencil(GLint s);
+  GLenum clientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout);
   void colorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha);
   void compileShader(GLuint shader);
   void compressedTexImage1D(GLenum target,
@@ -199,9 +207,16 @@ class IContext {
   virtual void disable(GLenum cap);
   void disableVertexAttribArray(GLuint index);
   void drawArrays(GLenum mode, GLint first, GLsizei count);
+  void drawArraysIndirect(GLenum mode, const GLvoid* indirect);
+  void drawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount);
   void drawBuffers(GLsizei n, GLenum* buffers);
   void drawElements(GLenum mode, GLsizei count, GLenum type, const GLvoid* indices);
   void drawElementsIndirect(GLenum mode, GLenum type, const GLvoid* indirect);
+  void drawElementsInstanced(GLenum mode,
+                             GLsizei count,
+                             GLenum type,
+                             const GLvoid* indices,
+                             GLsizei instancecount);
   virtual void enable(GLenum cap);
   void enableVertexAttribArray(GLuint index);
   GLsync fenceSync(GLenum condition, GLbitfield flags);
@@ -280,6 +295,11 @@ class IContext {
                                            GLenum pname,
                                            GLint* params) const;
   void getIntegerv(GLenum pname, GLint* params) const;
+  void getProgramBinary(GLuint program,
+                        GLsizei bufSize,
+                        GLsizei* length,
+                        GLenum* binaryFormat,
+                        void* binary);
   void getProgramiv(GLuint program, GLenum pname, GLint* params) const;
   void getProgramInterfaceiv(GLuint program,
                              GLenum programInterface,
@@ -338,6 +358,8 @@ class IContext {
   void pixelStorei(GLenum pname, GLint param);
   void polygonOffset(GLfloat factor, GLfloat units);
   void popDebugGroup();
+  void programBinary(GLuint program, GLenum binaryFormat, const void* binary, GLsizei length);
+  void programParameteri(GLuint program, GLenum pname, GLint value);
   void pushDebugGroup(GLenum source, GLuint id, GLsizei length, const GLchar* message);
   void readPixels(GLint x,
                   GLint y,
@@ -509,7 +531,27 @@ class IContext {
   void viewport(GLint x, GLint y, GLsizei width, GLsizei height);
 
   void dispatchCompute(GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z);
+  void maxShaderCompilerThreads(GLuint count);
   void memoryBarrier(GLbitfield barriers);
+  void multiDrawArrays(GLenum mode,
+                       const GLint* firsts,
+                       const GLsizei* counts,
+                       GLsizei drawcount);
+  void multiDrawElements(GLenum mode,
+                         const GLsizei* counts,
+                         GLenum type,
+                         const GLvoid* const* offsets,
+                         GLsizei drawcount);
+  void multiDrawArraysIndirect(GLenum mode,
+                               const GLvoid* indirect,
+                               GLsizei drawcount,
+                               GLsizei stride);
+  void multiDrawElementsIndirect(GLenum mode,
+                                 GLenum type,
+                                 const GLvoid* indirect,
+                                 GLsizei drawcount,
+                                 GLsizei stride);
+  void namedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, const GLvoid* data);
   GLuint64 getTextureHandle(GLuint texture);
   void makeTextureHandleResident(GLuint64 handle);
   void makeTextureHandleNonResident(GLuint64 handle);
@@ -581,6 +623,62 @@ class IContext {
    */
   void enableAutomaticErrorCheck(bool enable);
 
+  /** Forgets all client-side shadowed GL state so that subsequent state setters reach the driver
+   * unconditionally. Hot state setters (texture/buffer bindings, program, blend/depth state,
+   * capabilities) drop calls that would not change the shadowed state; the shadow only sees state
+   * set through IContext, so this must be called whenever the underlying GL state may have been
+   * modified externally. Device::beginScope() does this automatically.
+   */
+  void invalidateCachedState();
+
+  /// Client-side shadow of hot GL state used to eliminate redundant driver calls. All "valid"
+  /// flags start out false so the first call after construction or invalidateCachedState() is
+  /// always forwarded to the driver. Also serves as the value type for
+  /// saveContextState()/restoreContextState().
+  struct StateShadow {
+    static constexpr size_t kTextureUnits = IGL_TEXTURE_SAMPLERS_MAX;
+    GLenum activeTexture = GL_TEXTURE0;
+    bool activeTextureValid = false;
+    // per-unit, per-target texture bindings; units beyond kTextureUnits are not shadowed
+    std::unordered_map<GLenum, GLuint> boundTextures[kTextureUnits];
+    std::unordered_map<GLenum, GLuint> boundBuffers;
+    std::unordered_map<GLenum, bool> capabilities;
+    GLuint program = 0;
+    bool programValid = false;
+    GLenum blendSrcRGB = GL_ONE;
+    GLenum blendDstRGB = GL_ZERO;
+    GLenum blendSrcAlpha = GL_ONE;
+    GLenum blendDstAlpha = GL_ZERO;
+    bool blendFuncValid = false;
+    GLenum blendEquationRGB = GL_FUNC_ADD;
+    GLenum blendEquationAlpha = GL_FUNC_ADD;
+    bool blendEquationValid = false;
+    GLenum depthFunc = GL_LESS;
+    bool depthFuncValid = false;
+    GLboolean depthMask = GL_TRUE;
+    bool depthMaskValid = false;
+    GLboolean colorMask[4] = {GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE};
+    bool colorMaskValid = false;
+    GLint cullFace = GL_BACK;
+    bool cullFaceValid = false;
+    GLenum frontFace = GL_CCW;
+    bool frontFaceValid = false;
+  };
+
+  /** Copies the currently shadowed GL state into `outState` without any driver calls. Intended
+   * for interop handoff: snapshot IGL's state before handing the context to a host renderer that
+   * issues its own GL calls, then restoreContextState() on the way back instead of conservatively
+   * resetting everything.
+   */
+  void saveContextState(StateShadow& outState) const;
+
+  /** Re-applies a previously saved snapshot through the shadowed state setters, so only the state
+   * groups that differ from the current shadow reach the driver. When the host renderer may have
+   * changed GL state behind IGL's back, call invalidateCachedState() first; every group that was
+   * valid in the snapshot is then re-applied unconditionally.
+   */
+  void restoreContextState(const StateShadow& state);
+
   // Manages an adapter pool as recreating this every frame causes unwanted memory allocations.
   // @fb-only
   // @fb-only
@@ -596,6 +694,15 @@ class IContext {
   GLenum checkForErrors(const char* callerName, size_t lineNum) const;
   Result getLastError() const;
 
+  /// @brief Enables the on-disk device capability cache: initialize() writes the probed GL
+  /// version/extension capabilities of the current device to `path` on the first launch and
+  /// restores them from there on later launches, validated against the GL_VERSION/GL_VENDOR/
+  /// GL_RENDERER strings, so feature-set construction becomes a file read instead of
+  /// per-extension driver queries. Set once at startup before any context is created; an empty
+  /// path (the default) disables the cache. The file is rewritten whenever the driver identity
+  /// changes (e.g. after a driver update)
+  static void setCapabilityCacheFilePath(std::string path);
+
  protected:
   static std::unordered_map<void*, IContext*>& getExistingContexts();
   static void registerContext(void* glContext, IContext* context);
@@ -604,6 +711,13 @@ class IContext {
   void willDestroy(void* glContext);
 
  private:
+  /// @brief Returns the capability blob cached for `deviceKey`, or an empty string when the
+  /// cache file is missing, unreadable, or was recorded for a different device/driver
+  std::string loadCapabilityCacheFile(const std::string& deviceKey) const;
+  void saveCapabilityCacheFile(const std::string& deviceKey, const std::string& blob) const;
+
+  StateShadow stateShadow_;
+
   bool alwaysCheckError_ = false; // TRUE to check error after each OGL call
   mutable GLenum lastError_ = GL_NO_ERROR;
   mutable unsigned int callCounter_ = 0;
@@ -619,7 +733,9 @@ class IContext {
   PFNIGLBINDIMAGETEXTUREPROC bindImageTexturerProc_ = nullptr;
   PFNIGLBINDVERTEXARRAYPROC bindVertexArrayProc_ = nullptr;
   PFNIGLBLITFRAMEBUFFERPROC blitFramebufferProc_ = nullptr;
+  PFNIGLBUFFERSTORAGEPROC bufferStorageProc_ = nullptr;
   PFNIGLCLEARDEPTHFPROC clearDepthfProc_ = nullptr;
+  PFNIGLCLIENTWAITSYNCPROC clientWaitSyncProc_ = nullptr;
   PFNIGLCOMPRESSEDTEXIMAGE3DPROC compressedTexImage3DProc_ = nullptr;
   PFNIGLCOMPRESSEDTEXSUBIMAGE3DPROC compressedTexSubImage3DProc_ = nullptr;
   PFNIGLDEBUGMESSAGECALLBACKPROC debugMessageCallbackProc_ = nullptr;
@@ -632,15 +748,24 @@ class IContext {
   PFNIGLINVALIDATEFRAMEBUFFERPROC invalidateFramebufferProc_ = nullptr;
   PFNIGLGENVERTEXARRAYSPROC genVertexArraysProc_ = nullptr;
   mutable PFNIGLGETDEBUGMESSAGELOGPROC getDebugMessageLogProc_ = nullptr;
+  PFNIGLGETPROGRAMBINARYPROC getProgramBinaryProc_ = nullptr;
   mutable PFNIGLGETSYNCIVPROC getSyncivProc_ = nullptr;
   PFNIGLGETTEXTUREHANDLEPROC getTextureHandleProc_ = nullptr;
   PFNIGLMAKETEXTUREHANDLERESIDENTPROC makeTextureHandleResidentProc_ = nullptr;
   PFNIGLMAKETEXTUREHANDLENONRESIDENTPROC makeTextureHandleNonResidentProc_ = nullptr;
   PFNIGLMAPBUFFERPROC mapBufferProc_ = nullptr;
   PFNIGLMAPBUFFERRANGEPROC mapBufferRangeProc_ = nullptr;
+  PFNIGLMAXSHADERCOMPILERTHREADSKHRPROC maxShaderCompilerThreadsProc_ = nullptr;
   PFNIGLMEMORYBARRIERPROC memoryBarrierProc_ = nullptr;
+  PFNIGLMULTIDRAWARRAYSPROC multiDrawArraysProc_ = nullptr;
+  PFNIGLMULTIDRAWELEMENTSPROC multiDrawElementsProc_ = nullptr;
+  PFNIGLMULTIDRAWARRAYSINDIRECTPROC multiDrawArraysIndirectProc_ = nullptr;
+  PFNIGLMULTIDRAWELEMENTSINDIRECTPROC multiDrawElementsIndirectProc_ = nullptr;
+  PFNIGLNAMEDBUFFERSUBDATAPROC namedBufferSubDataProc_ = nullptr;
   PFNIGLOBJECTLABELPROC objectLabelProc_ = nullptr;
   PFNIGLPOPDEBUGGROUPPROC popDebugGroupProc_ = nullptr;
+  PFNIGLPROGRAMBINARYPROC programBinaryProc_ = nullptr;
+  PFNIGLPROGRAMPARAMETERIPROC programParameteriProc_ = nullptr;
   PFNIGLPUSHDEBUGGROUPPROC pushDebugGroupProc_ = nullptr;
   PFNIGLRENDERBUFFERSTORAGEMULTISAMPLEPROC renderbufferStorageMultisampleProc_ = nullptr;
   PFNIGLTEXIMAGE3DPROC texImage3DProc_ = nullptr;
@@ -713,6 +838,9 @@ class IContext {
   GLint maxDebugStackSize_ = -1;
   GLint debugStackSize_ = 0;
 
+  // process-wide on-disk capability cache location; see setCapabilityCacheFilePath()
+  static std::string capabilityCacheFilePath_;
+
   static constexpr uint64_t kNotAZombie = 0xdeadc0def3315badLL;
   uint64_t zombieGuard_ = kNotAZombie;
 };
@@ -30,3 +30,10 @@
 #else
 #define IGL_WGL 0
 #endif
+
+// Set by the build (see the IGL_OPENGL_STATIC_DISPATCH CMake option) on platforms where the GL
+// library is linked statically and exports its core entry points, so GL functions can be called
+// directly instead of through dynamically loaded function pointers.
+#if !defined(IGL_OPENGL_STATIC_DISPATCH)
+#define IGL_OPENGL_STATIC_DISPATCH 0
+#endif
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <igl/opengl/ProgramBinaryCache.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <string_view>
+#include <vector>
+
+#include <igl/opengl/IContext.h>
+
+namespace igl {
+namespace opengl {
+namespace {
+
+std::string& mutableCacheDirectory() {
+  static std::string sDirectory;
+  return sDirectory;
+}
+
+void hashCombine(size_t& hash, size_t value) {
+  hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+}
+
+} // namespace
+
+void ProgramBinaryCache::setCacheDirectory(std::string directory) {
+  mutableCacheDirectory() = std::move(directory);
+}
+
+const std::string& ProgramBinaryCache::cacheDirectory() {
+  return mutableCacheDirectory();
+}
+
+bool ProgramBinaryCache::isEnabled() {
+  return !mutableCacheDirectory().empty();
+}
+
+bool ProgramBinaryCache::isSupported(IContext& context) {
+  if (!context.deviceFeatures().hasInternalFeature(InternalFeatures::GetProgramBinary)) {
+    return false;
+  }
+  // drivers may expose the entry points but no binary format
+  GLint numFormats = 0;
+  context.getIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &numFormats);
+  return numFormats > 0;
+}
+
+std::string ProgramBinaryCache::entryPath(IContext& context, size_t sourceHash) {
+  // a device or driver update changes these strings, so its stale binaries are simply never
+  // looked up again and the programs relink from source
+  size_t hash = sourceHash;
+  for (const GLenum name : {GL_VENDOR, GL_RENDERER, GL_VERSION}) {
+    const auto* str = reinterpret_cast<const char*>(context.getString(name));
+    if (str != nullptr) {
+      hashCombine(hash, std::hash<std::string_view>()(std::string_view(str, strlen(str))));
+    }
+  }
+  return cacheDirectory() + "/program_" + std::to_string(hash) + ".bin";
+}
+
+GLuint ProgramBinaryCache::loadProgram(IContext& context, size_t sourceHash) {
+  const std::string path = entryPath(context, sourceHash);
+  std::ifstream file(path, std::ios::in | std::ios::binary | std::ios::ate);
+  if (!file.is_open()) {
+    return 0;
+  }
+
+  const std::streamoff fileSize = file.tellg();
+  GLenum binaryFormat = 0;
+  if (fileSize <= static_cast<std::streamoff>(sizeof(binaryFormat))) {
+    file.close();
+    std::remove(path.c_str());
+    return 0;
+  }
+
+  std::vector<char> binary(static_cast<size_t>(fileSize) - sizeof(binaryFormat));
+  file.seekg(0, std::ios::beg);
+  file.read(reinterpret_cast<char*>(&binaryFormat), sizeof(binaryFormat));
+  file.read(binary.data(), static_cast<std::streamsize>(binary.size()));
+  const bool readOk = file.good();
+  file.close();
+  if (!readOk) {
+    std::remove(path.c_str());
+    return 0;
+  }
+
+  GLuint programID = context.createProgram();
+  if (programID == 0) {
+    return 0;
+  }
+
+  context.programBinary(
+      programID, binaryFormat, binary.data(), static_cast<GLsizei>(binary.size()));
+
+  // the driver reports a rejected binary through the link status rather than a GL error
+  GLint status = GL_FALSE;
+  context.getProgramiv(programID, GL_LINK_STATUS, &status);
+  if (status == GL_FALSE) {
+    context.deleteProgram(programID);
+    std::remove(path.c_str());
+    return 0;
+  }
+
+  return programID;
+}
+
+void ProgramBinaryCache::storeProgram(IContext& context, size_t sourceHash, GLuint programID) {
+  GLint binaryLength = 0;
+  context.getProgramiv(programID, GL_PROGRAM_BINARY_LENGTH, &binaryLength);
+  if (binaryLength <= 0) {
+    return;
+  }
+
+  std::vector<char> binary(binaryLength);
+  GLenum binaryFormat = 0;
+  GLsizei written = 0;
+  context.getProgramBinary(programID, binaryLength, &written, &binaryFormat, binary.data());
+  if (written <= 0) {
+    return;
+  }
+
+  const std::string path = entryPath(context, sourceHash);
+  std::ofstream file(path, std::ios::out | std::ios::binary | std::ios::trunc);
+  if (!file.is_open()) {
+    return;
+  }
+  file.write(reinterpret_cast<const char*>(&binaryFormat), sizeof(binaryFormat));
+  file.write(binary.data(), written);
+}
+
+} // namespace opengl
+} // namespace igl
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <string>
+
+#include <igl/opengl/GLIncludes.h>
+
+namespace igl {
+namespace opengl {
+
+class IContext;
+
+/// On-disk cache of linked GL program binaries (glGetProgramBinary / glProgramBinary) that lets
+/// subsequent startups skip shader compilation and linking entirely.
+///
+/// The cache is disabled until the application provides a writable directory through
+/// setCacheDirectory(), typically once before device creation. Entries are keyed by the shader
+/// source hash combined with GL_VENDOR, GL_RENDERER and GL_VERSION, so binaries produced by a
+/// different device or driver version are never even looked up; a binary the driver still rejects
+/// is deleted and the program is relinked from source.
+class ProgramBinaryCache {
+ public:
+  /// Enables the cache. The directory must exist and be writable; an empty string disables the
+  /// cache again. Not synchronized: call before programs are created on any thread.
+  static void setCacheDirectory(std::string directory);
+  static const std::string& cacheDirectory();
+
+  /// Returns true when a cache directory has been set
+  static bool isEnabled();
+
+  /// Returns true when the context can retrieve and load program binaries
+  static bool isSupported(IContext& context);
+
+  /// Returns a program linked from a cached binary, or 0 when no usable entry exists
+  static GLuint loadProgram(IContext& context, size_t sourceHash);
+
+  /// Stores the binary of a freshly linked program, replacing any previous entry
+  static void storeProgram(IContext& context, size_t sourceHash, GLuint programID);
+
+ private:
+  static std::string entryPath(IContext& context, size_t sourceHash);
+};
+
+} // namespace opengl
+} // namespace igl
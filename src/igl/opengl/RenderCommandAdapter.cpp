@@ -9,6 +9,7 @@
 #include <igl/opengl/RenderCommandAdapter.h>
 
 #include <algorithm>
+#include <igl/RenderPass.h>
 #include <igl/opengl/Buffer.h>
 #include <igl/opengl/CommandBuffer.h>
 #include <igl/opengl/DepthStencilState.h>
@@ -39,6 +40,11 @@ RenderCommandAdapter::RenderCommandAdapter(IContext& context) :
     activeVAO_ = std::make_shared<VertexArrayObject>(getContext());
     activeVAO_->create();
   }
+#if IGL_PLATFORM_EMSCRIPTEN
+  // every GL call crosses the JS boundary at roughly 10x native cost, so state-compatible draws
+  // are collapsed into WEBGL_multi_draw calls when the extension is available
+  useDrawBatching_ = context.deviceFeatures().hasInternalFeature(InternalFeatures::MultiDraw);
+#endif
 }
 
 std::unique_ptr<RenderCommandAdapter> RenderCommandAdapter::create(
@@ -68,16 +74,38 @@ void RenderCommandAdapter::initialize(const RenderPassDesc& renderPass,
 
   auto viewport = openglFramebuffer.getViewport();
   IGL_ASSERT(!(viewport.width < 0.f) && !(viewport.height < 0.f));
+  if (renderPass.hasRenderArea()) {
+    // Partial pass for damage-region rendering: the clears were already scissored in bind()
+    // above; keep the same scissor for the draws. The viewport stays at full size because the
+    // render area is a damage rect, not a rescaled target.
+    setScissorRect(renderPass.renderArea);
+  } else if (renderPass.renderScale < 1.0f) {
+    // Dynamic resolution: confine rendering to the scaled sub-rect of the oversized attachments.
+    // Clears already ran at full size in bind() above, matching the other backends.
+    viewport.width = (float)RenderPassDesc::scaledDimension((uint32_t)viewport.width,
+                                                            renderPass.renderScale);
+    viewport.height = (float)RenderPassDesc::scaledDimension((uint32_t)viewport.height,
+                                                             renderPass.renderScale);
+    setScissorRect({(uint32_t)viewport.x,
+                    (uint32_t)viewport.y,
+                    (uint32_t)viewport.width,
+                    (uint32_t)viewport.height});
+  } else {
+    // a scissor left over from an earlier partial or scaled pass must not restrict this one
+    setScissorRect({});
+  }
   setViewport(viewport);
   Result::setOk(outResult);
 }
 
 void RenderCommandAdapter::setViewport(const Viewport& viewport) {
+  flushDrawBatch();
   getContext().viewport(
       (GLint)viewport.x, (GLint)viewport.y, (GLint)viewport.width, (GLint)viewport.height);
 }
 
 void RenderCommandAdapter::setScissorRect(const ScissorRect& rect) {
+  flushDrawBatch();
   bool scissorEnabled = !rect.isNull();
   getContext().setEnabled(scissorEnabled, GL_SCISSOR_TEST);
   if (scissorEnabled) {
@@ -87,11 +115,13 @@ void RenderCommandAdapter::setScissorRect(const ScissorRect& rect) {
 
 void RenderCommandAdapter::setDepthStencilState(
     const std::shared_ptr<IDepthStencilState>& newValue) {
+  flushDrawBatch();
   depthStencilState_ = newValue;
   setDirty(StateMask::DEPTH_STENCIL);
 }
 
 void RenderCommandAdapter::setStencilReferenceValue(uint32_t value, Result* outResult) {
+  flushDrawBatch();
   if (!IGL_VERIFY(depthStencilState_)) {
     Result::setResult(outResult, Result::Code::InvalidOperation, "depth stencil state is null");
     return;
@@ -105,6 +135,7 @@ void RenderCommandAdapter::setStencilReferenceValue(uint32_t value, Result* outR
 void RenderCommandAdapter::setStencilReferenceValues(uint32_t frontValue,
                                                      uint32_t backValue,
                                                      Result* outResult) {
+  flushDrawBatch();
   if (!IGL_VERIFY(depthStencilState_)) {
     Result::setResult(outResult, Result::Code::InvalidOperation, "depth stencil state is null");
     return;
@@ -116,15 +147,18 @@ void RenderCommandAdapter::setStencilReferenceValues(uint32_t frontValue,
 }
 
 void RenderCommandAdapter::setBlendColor(Color color) {
+  flushDrawBatch();
   getContext().blendColor(color.r, color.g, color.b, color.a);
 }
 
 void RenderCommandAdapter::setDepthBias(float depthBias, float slopeScale) {
+  flushDrawBatch();
   getContext().setEnabled(true, GL_POLYGON_OFFSET_FILL);
   getContext().polygonOffset(slopeScale, depthBias);
 }
 
 void RenderCommandAdapter::clearVertexBuffers() {
+  flushDrawBatch();
   vertexBuffersDirty_.reset();
 }
 
@@ -132,6 +166,7 @@ void RenderCommandAdapter::setVertexBuffer(std::shared_ptr<Buffer> buffer,
                                            size_t offset,
                                            int index,
                                            Result* outResult) {
+  flushDrawBatch();
   IGL_ASSERT_MSG(index >= 0, "Invalid index passed to setVertexBuffer");
   IGL_ASSERT_MSG(index < IGL_VERTEX_BUFFER_MAX,
                  "Buffer index is beyond max, may want to increase limit");
@@ -145,12 +180,14 @@ void RenderCommandAdapter::setVertexBuffer(std::shared_ptr<Buffer> buffer,
 }
 
 void RenderCommandAdapter::clearUniformBuffers() {
+  flushDrawBatch();
   uniformAdapter_.clearUniformBuffers();
 }
 
 void RenderCommandAdapter::setUniform(const UniformDesc& uniformDesc,
                                       const void* data,
                                       Result* outResult) {
+  flushDrawBatch();
   uniformAdapter_.setUniform(uniformDesc, data, outResult);
 }
 
@@ -158,15 +195,18 @@ void RenderCommandAdapter::setUniformBuffer(const std::shared_ptr<Buffer>& buffe
                                             size_t offset,
                                             int index,
                                             Result* outResult) {
+  flushDrawBatch();
   uniformAdapter_.setUniformBuffer(buffer, offset, index, outResult);
 }
 
 void RenderCommandAdapter::clearVertexTexture() {
+  flushDrawBatch();
   vertexTextureStates_ = TextureStates();
   vertexTextureStatesDirty_.reset();
 }
 
 void RenderCommandAdapter::setVertexTexture(ITexture* texture, size_t index, Result* outResult) {
+  flushDrawBatch();
   if (!IGL_VERIFY(index < IGL_TEXTURE_SAMPLERS_MAX)) {
     Result::setResult(outResult, Result::Code::ArgumentInvalid);
     return;
@@ -179,6 +219,7 @@ void RenderCommandAdapter::setVertexTexture(ITexture* texture, size_t index, Res
 void RenderCommandAdapter::setVertexSamplerState(ISamplerState* samplerState,
                                                  size_t index,
                                                  Result* outResult) {
+  flushDrawBatch();
   if (!IGL_VERIFY(index < IGL_TEXTURE_SAMPLERS_MAX)) {
     Result::setResult(outResult, Result::Code::ArgumentInvalid);
     return;
@@ -189,11 +230,13 @@ void RenderCommandAdapter::setVertexSamplerState(ISamplerState* samplerState,
 }
 
 void RenderCommandAdapter::clearFragmentTexture() {
+  flushDrawBatch();
   fragmentTextureStates_ = TextureStates();
   fragmentTextureStatesDirty_.reset();
 }
 
 void RenderCommandAdapter::setFragmentTexture(ITexture* texture, size_t index, Result* outResult) {
+  flushDrawBatch();
   if (!IGL_VERIFY(index < IGL_TEXTURE_SAMPLERS_MAX)) {
     Result::setResult(outResult, Result::Code::ArgumentInvalid);
     return;
@@ -206,6 +249,7 @@ void RenderCommandAdapter::setFragmentTexture(ITexture* texture, size_t index, R
 void RenderCommandAdapter::setFragmentSamplerState(ISamplerState* samplerState,
                                                    size_t index,
                                                    Result* outResult) {
+  flushDrawBatch();
   if (!IGL_VERIFY(index < IGL_TEXTURE_SAMPLERS_MAX)) {
     Result::setResult(outResult, Result::Code::ArgumentInvalid);
     return;
@@ -238,7 +282,11 @@ void RenderCommandAdapter::clearDependentResources(
     // We do need to clear vertex attributes, when pipelinestate is modified.
     // If we don't, subsequent draw calls might try to read from these locations
     // and crashes might happen.
-    unbindVertexAttributes();
+    // With VAOs, attribute state is isolated per cached (pipeline, buffer set) VAO and the next
+    // draw switches VAOs instead; disabling the arrays here would corrupt the cached VAO.
+    if (!useVAO_) {
+      unbindVertexAttributes();
+    }
 
     // Don't reuse previously set vertex buffers.
     clearVertexBuffers();
@@ -248,6 +296,7 @@ void RenderCommandAdapter::clearDependentResources(
 
 void RenderCommandAdapter::setPipelineState(const std::shared_ptr<IRenderPipelineState>& newValue,
                                             Result* outResult) {
+  flushDrawBatch();
   Result::setOk(outResult);
   if (pipelineState_) {
     clearDependentResources(newValue, outResult); // Only clear if pipeline state was previously set
@@ -257,6 +306,25 @@ void RenderCommandAdapter::setPipelineState(const std::shared_ptr<IRenderPipelin
 }
 
 void RenderCommandAdapter::drawArrays(GLenum mode, GLint first, GLsizei count) {
+  if (useDrawBatching_) {
+    // no state was touched since the previous draw, or the batch would have been flushed:
+    // compatible draws extend the pending multi-draw instead of crossing the JS boundary
+    if (drawBatch_.active && !drawBatch_.indexed && drawBatch_.mode == mode) {
+      drawBatch_.firsts.push_back(first);
+      drawBatch_.counts.push_back(count);
+      didDraw();
+      return;
+    }
+    flushDrawBatch();
+    willDraw();
+    drawBatch_.active = true;
+    drawBatch_.indexed = false;
+    drawBatch_.mode = mode;
+    drawBatch_.firsts.push_back(first);
+    drawBatch_.counts.push_back(count);
+    didDraw();
+    return;
+  }
   willDraw();
   getContext().drawArrays(toMockWireframeMode(mode), first, count);
   didDraw();
@@ -267,17 +335,66 @@ void RenderCommandAdapter::drawElements(GLenum mode,
                                         GLenum indexType,
                                         Buffer& indexBuffer,
                                         const GLvoid* indexOffset) {
+  if (useDrawBatching_) {
+    auto& arrayBuffer = static_cast<ArrayBuffer&>(indexBuffer);
+    if (drawBatch_.active && drawBatch_.indexed && drawBatch_.mode == mode &&
+        drawBatch_.indexType == indexType && drawBatch_.indexBuffer == &indexBuffer &&
+        drawBatch_.indexBufferId == arrayBuffer.getId()) {
+      drawBatch_.counts.push_back(indexCount);
+      drawBatch_.indexOffsets.push_back(indexOffset);
+      didDraw();
+      return;
+    }
+    flushDrawBatch();
+    willDraw();
+    bindBufferWithShaderStorageBufferOverride(indexBuffer, GL_ELEMENT_ARRAY_BUFFER);
+    drawBatch_.active = true;
+    drawBatch_.indexed = true;
+    drawBatch_.mode = mode;
+    drawBatch_.indexType = indexType;
+    drawBatch_.indexBuffer = &indexBuffer;
+    drawBatch_.indexBufferId = arrayBuffer.getId();
+    drawBatch_.counts.push_back(indexCount);
+    drawBatch_.indexOffsets.push_back(indexOffset);
+    didDraw();
+    return;
+  }
   willDraw();
   bindBufferWithShaderStorageBufferOverride(indexBuffer, GL_ELEMENT_ARRAY_BUFFER);
   getContext().drawElements(toMockWireframeMode(mode), indexCount, indexType, indexOffset);
   didDraw();
 }
 
+void RenderCommandAdapter::drawArraysInstanced(GLenum mode,
+                                               GLint first,
+                                               GLsizei count,
+                                               GLsizei instanceCount) {
+  flushDrawBatch();
+  willDraw();
+  getContext().drawArraysInstanced(toMockWireframeMode(mode), first, count, instanceCount);
+  didDraw();
+}
+
+void RenderCommandAdapter::drawElementsInstanced(GLenum mode,
+                                                 GLsizei indexCount,
+                                                 GLenum indexType,
+                                                 Buffer& indexBuffer,
+                                                 const GLvoid* indexOffset,
+                                                 GLsizei instanceCount) {
+  flushDrawBatch();
+  willDraw();
+  bindBufferWithShaderStorageBufferOverride(indexBuffer, GL_ELEMENT_ARRAY_BUFFER);
+  getContext().drawElementsInstanced(
+      toMockWireframeMode(mode), indexCount, indexType, indexOffset, instanceCount);
+  didDraw();
+}
+
 void RenderCommandAdapter::drawElementsIndirect(GLenum mode,
                                                 GLenum indexType,
                                                 Buffer& indexBuffer,
                                                 Buffer& indirectBuffer,
                                                 const GLvoid* indirectBufferOffset) {
+  flushDrawBatch();
   willDraw();
   bindBufferWithShaderStorageBufferOverride(indexBuffer, GL_ELEMENT_ARRAY_BUFFER);
   if (getContext().deviceFeatures().hasFeature(DeviceFeatures::DrawIndexedIndirect)) {
@@ -289,11 +406,82 @@ void RenderCommandAdapter::drawElementsIndirect(GLenum mode,
   didDraw();
 }
 
+void RenderCommandAdapter::multiDrawArraysIndirect(GLenum mode,
+                                                   Buffer& indirectBuffer,
+                                                   const GLvoid* indirectBufferOffset,
+                                                   GLsizei drawCount,
+                                                   GLsizei stride) {
+  flushDrawBatch();
+  willDraw();
+  if (getContext().deviceFeatures().hasInternalFeature(InternalFeatures::MultiDrawIndirect)) {
+    bindBufferWithShaderStorageBufferOverride(indirectBuffer, GL_DRAW_INDIRECT_BUFFER);
+    getContext().multiDrawArraysIndirect(
+        toMockWireframeMode(mode), indirectBufferOffset, drawCount, stride);
+  } else if (getContext().deviceFeatures().hasFeature(DeviceFeatures::DrawIndexedIndirect)) {
+    // no multi-draw entry point: issue one indirect draw per command, which still keeps the
+    // draw parameters on the GPU
+    bindBufferWithShaderStorageBufferOverride(indirectBuffer, GL_DRAW_INDIRECT_BUFFER);
+    const GLsizei commandStride = stride != 0 ? stride : static_cast<GLsizei>(4 * sizeof(uint32_t));
+    auto offset = reinterpret_cast<uintptr_t>(indirectBufferOffset);
+    for (GLsizei i = 0; i < drawCount; ++i) {
+      getContext().drawArraysIndirect(toMockWireframeMode(mode),
+                                      reinterpret_cast<const GLvoid*>(offset));
+      offset += static_cast<uintptr_t>(commandStride);
+    }
+  } else {
+    IGL_ASSERT_NOT_IMPLEMENTED();
+  }
+  didDraw();
+}
+
+void RenderCommandAdapter::multiDrawElementsIndirect(GLenum mode,
+                                                     GLenum indexType,
+                                                     Buffer& indexBuffer,
+                                                     Buffer& indirectBuffer,
+                                                     const GLvoid* indirectBufferOffset,
+                                                     GLsizei drawCount,
+                                                     GLsizei stride) {
+  flushDrawBatch();
+  willDraw();
+  bindBufferWithShaderStorageBufferOverride(indexBuffer, GL_ELEMENT_ARRAY_BUFFER);
+  if (getContext().deviceFeatures().hasInternalFeature(InternalFeatures::MultiDrawIndirect)) {
+    bindBufferWithShaderStorageBufferOverride(indirectBuffer, GL_DRAW_INDIRECT_BUFFER);
+    getContext().multiDrawElementsIndirect(
+        toMockWireframeMode(mode), indexType, indirectBufferOffset, drawCount, stride);
+  } else if (getContext().deviceFeatures().hasFeature(DeviceFeatures::DrawIndexedIndirect)) {
+    // no multi-draw entry point: issue one indirect draw per command, which still keeps the
+    // draw parameters on the GPU
+    bindBufferWithShaderStorageBufferOverride(indirectBuffer, GL_DRAW_INDIRECT_BUFFER);
+    const GLsizei commandStride = stride != 0 ? stride : static_cast<GLsizei>(5 * sizeof(uint32_t));
+    auto offset = reinterpret_cast<uintptr_t>(indirectBufferOffset);
+    for (GLsizei i = 0; i < drawCount; ++i) {
+      getContext().drawElementsIndirect(
+          toMockWireframeMode(mode), indexType, reinterpret_cast<const GLvoid*>(offset));
+      offset += static_cast<uintptr_t>(commandStride);
+    }
+  } else {
+    IGL_ASSERT_NOT_IMPLEMENTED();
+  }
+  didDraw();
+}
+
 void RenderCommandAdapter::endEncoding() {
+  // the pending multi-draw must go out while the pipeline state it was recorded under is bound
+  flushDrawBatch();
+
   // Some minimal cleanup needs to occur in order. Otherwise, OpenGL can end in a bad state
   // with complex rendering.
   if (pipelineState_) {
-    unbindVertexAttributes();
+    if (useVAO_) {
+      // attribute state lives in the cached VAOs: unbinding the VAO both hides it from external
+      // rendering and keeps the cached attribute bindings intact for reuse
+      if (activeVAO_) {
+        activeVAO_->unbind();
+        activeVAO_ = nullptr;
+      }
+    } else {
+      unbindVertexAttributes();
+    }
   }
 
   pipelineState_ = nullptr;
@@ -310,12 +498,61 @@ void RenderCommandAdapter::endEncoding() {
   dirtyStateBits_ = EnumToValue(StateMask::NONE);
 }
 
+void RenderCommandAdapter::bindCachedVertexArrayObject() {
+  VaoCacheKey key;
+  key.pipelineState = pipelineState_.get();
+  for (size_t i = 0; i < IGL_VERTEX_BUFFER_MAX; ++i) {
+    auto* arrayBuffer = static_cast<ArrayBuffer*>(vertexBuffers_[i].resource.get());
+    key.buffers[i] = arrayBuffer;
+    key.bufferIds[i] = arrayBuffer ? arrayBuffer->getId() : 0;
+    key.offsets[i] = arrayBuffer ? vertexBuffers_[i].offset : 0;
+  }
+
+  const auto it = vaoCache_.find(key);
+  if (it != vaoCache_.end()) {
+    if (activeVAO_ != it->second.vao) {
+      it->second.vao->bind();
+      activeVAO_ = it->second.vao;
+    }
+    // the cached VAO already captures every attribute binding of this combination
+    vertexBuffersDirty_.reset();
+    return;
+  }
+
+  if (vaoCache_.size() >= kMaxCachedVertexArrayObjects) {
+    vaoCache_.clear();
+  }
+
+  auto vao = std::make_shared<VertexArrayObject>(getContext());
+  vao->create();
+  vao->bind();
+  activeVAO_ = vao;
+
+  // a fresh VAO starts empty: specify the attributes of every bound vertex buffer into it
+  for (size_t i = 0; i < IGL_VERTEX_BUFFER_MAX; ++i) {
+    if (vertexBuffers_[i].resource) {
+      SET_DIRTY(vertexBuffersDirty_, i);
+    }
+  }
+
+  VaoCacheEntry entry;
+  entry.vao = std::move(vao);
+  entry.pipelineState = pipelineState_;
+  for (size_t i = 0; i < IGL_VERTEX_BUFFER_MAX; ++i) {
+    entry.buffers[i] = vertexBuffers_[i].resource;
+  }
+  vaoCache_.emplace(key, std::move(entry));
+}
+
 void RenderCommandAdapter::willDraw() {
   Result ret;
   auto pipelineState = static_cast<RenderPipelineState*>(pipelineState_.get());
 
   // Vertex Buffers must be bound before pipelineState->bind()
   if (pipelineState) {
+    if (useVAO_ && (vertexBuffersDirty_.any() || isDirty(StateMask::PIPELINE))) {
+      bindCachedVertexArrayObject();
+    }
     for (size_t bufferIndex = 0; bufferIndex < IGL_VERTEX_BUFFER_MAX; ++bufferIndex) {
       if (IS_DIRTY(vertexBuffersDirty_, bufferIndex)) {
         auto& bufferState = vertexBuffers_[bufferIndex];
@@ -356,7 +593,7 @@ void RenderCommandAdapter::willDraw() {
   static size_t kFragmentTextureStatesSize = fragmentTextureStates_.size();
   if (pipelineState) {
     // Bind uniforms to be used for render
-    uniformAdapter_.bindToPipeline(getContext());
+    uniformAdapter_.bindToPipeline(getContext(), pipelineState);
     for (size_t index = 0; index < kVertexTextureStatesSize; index++) {
       if (!IS_DIRTY(vertexTextureStatesDirty_, index)) {
         continue;
@@ -435,6 +672,40 @@ void RenderCommandAdapter::didDraw() {
   // Placeholder stub in case we want to add something later
 }
 
+void RenderCommandAdapter::flushDrawBatch() {
+  if (!drawBatch_.active) {
+    return;
+  }
+  const GLenum mode = toMockWireframeMode(drawBatch_.mode);
+  const auto drawCount = static_cast<GLsizei>(drawBatch_.counts.size());
+  if (drawBatch_.indexed) {
+    if (drawCount == 1) {
+      // a lone draw does not need the multi-draw entry point
+      getContext().drawElements(
+          mode, drawBatch_.counts[0], drawBatch_.indexType, drawBatch_.indexOffsets[0]);
+    } else {
+      getContext().multiDrawElements(mode,
+                                     drawBatch_.counts.data(),
+                                     drawBatch_.indexType,
+                                     drawBatch_.indexOffsets.data(),
+                                     drawCount);
+    }
+  } else {
+    if (drawCount == 1) {
+      getContext().drawArrays(mode, drawBatch_.firsts[0], drawBatch_.counts[0]);
+    } else {
+      getContext().multiDrawArrays(
+          mode, drawBatch_.firsts.data(), drawBatch_.counts.data(), drawCount);
+    }
+  }
+  drawBatch_.active = false;
+  drawBatch_.indexBuffer = nullptr;
+  drawBatch_.indexBufferId = 0;
+  drawBatch_.firsts.clear();
+  drawBatch_.counts.clear();
+  drawBatch_.indexOffsets.clear();
+}
+
 void RenderCommandAdapter::unbindVertexAttributes() {
   auto pipelineState = static_cast<RenderPipelineState*>(pipelineState_.get());
   if (pipelineState) {
@@ -443,6 +714,7 @@ void RenderCommandAdapter::unbindVertexAttributes() {
 }
 
 void RenderCommandAdapter::unbindResources() {
+  flushDrawBatch();
   unbindTextures(getContext(), fragmentTextureStates_, fragmentTextureStatesDirty_);
   unbindTextures(getContext(), vertexTextureStates_, vertexTextureStatesDirty_);
 
@@ -459,7 +731,10 @@ void RenderCommandAdapter::unbindResources() {
 
   auto pipelineState = static_cast<RenderPipelineState*>(pipelineState_.get());
   if (pipelineState) {
-    unbindVertexAttributes();
+    // with VAOs the attribute state is owned by the cached VAO and must stay intact for reuse
+    if (!useVAO_) {
+      unbindVertexAttributes();
+    }
     pipelineState->unbind();
     setDirty(StateMask::PIPELINE);
   }
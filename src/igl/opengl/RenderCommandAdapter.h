@@ -10,6 +10,9 @@
 #include <array>
 #include <bitset>
 #include <functional>
+#include <unordered_map>
+#include <vector>
+
 #include <igl/Buffer.h>
 #include <igl/Common.h>
 #include <igl/opengl/GLIncludes.h>
@@ -43,6 +46,56 @@ class RenderCommandAdapter final : public WithContext {
   using TextureState = std::pair<ITexture*, ISamplerState*>;
   using TextureStates = std::array<TextureState, IGL_TEXTURE_SAMPLERS_MAX>;
 
+  /// Key of the VAO cache: attribute locations are resolved per pipeline, so the same vertex
+  /// layout used by two pipelines gets two entries. The cached entry keeps the pipeline and
+  /// buffers alive so the raw pointers in the key cannot be recycled while they are referenced.
+  /// The GL buffer ids are part of the key because a ring buffer cycles through several GL
+  /// buffers behind one igl::opengl::Buffer; each segment gets its own cached VAO.
+  struct VaoCacheKey {
+    const IRenderPipelineState* pipelineState = nullptr;
+    std::array<const Buffer*, IGL_VERTEX_BUFFER_MAX> buffers{};
+    std::array<GLuint, IGL_VERTEX_BUFFER_MAX> bufferIds{};
+    std::array<size_t, IGL_VERTEX_BUFFER_MAX> offsets{};
+    bool operator==(const VaoCacheKey& other) const {
+      return pipelineState == other.pipelineState && buffers == other.buffers &&
+             bufferIds == other.bufferIds && offsets == other.offsets;
+    }
+  };
+  struct VaoCacheKeyHash {
+    size_t operator()(const VaoCacheKey& key) const {
+      size_t hash = std::hash<const void*>()(key.pipelineState);
+      for (size_t i = 0; i < IGL_VERTEX_BUFFER_MAX; ++i) {
+        hash ^= std::hash<const void*>()(key.buffers[i]) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        hash ^= key.bufferIds[i] + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        hash ^= key.offsets[i] + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+      }
+      return hash;
+    }
+  };
+  struct VaoCacheEntry {
+    std::shared_ptr<VertexArrayObject> vao;
+    std::shared_ptr<IRenderPipelineState> pipelineState;
+    std::array<std::shared_ptr<Buffer>, IGL_VERTEX_BUFFER_MAX> buffers;
+  };
+
+  /// Pending multi-draw: consecutive drawArrays()/drawElements() calls with no state change in
+  /// between accumulate here and are issued as a single glMultiDrawArrays/glMultiDrawElements
+  /// call. Only enabled on Emscripten, where every GL call crosses the JS boundary and
+  /// WEBGL_multi_draw turns N boundary crossings into one
+  struct DrawBatch {
+    bool active = false;
+    bool indexed = false;
+    GLenum mode = 0;
+    GLenum indexType = 0;
+    // identity of the bound index buffer (compared, never dereferenced); the GL binding itself
+    // was issued when the batch was started
+    const Buffer* indexBuffer = nullptr;
+    GLuint indexBufferId = 0;
+    std::vector<GLint> firsts;
+    std::vector<GLsizei> counts;
+    std::vector<const GLvoid*> indexOffsets;
+  };
+
  public:
   static std::unique_ptr<RenderCommandAdapter> create(
       IContext& context,
@@ -91,19 +144,44 @@ class RenderCommandAdapter final : public WithContext {
                         Result* outResult = nullptr);
 
   void drawArrays(GLenum mode, GLint first, GLsizei count);
+  void drawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instanceCount);
   void drawElements(GLenum mode,
                     GLsizei indexCount,
                     GLenum indexType,
                     Buffer& indexBuffer,
                     const GLvoid* indexOffset);
+  void drawElementsInstanced(GLenum mode,
+                             GLsizei indexCount,
+                             GLenum indexType,
+                             Buffer& indexBuffer,
+                             const GLvoid* indexOffset,
+                             GLsizei instanceCount);
   void drawElementsIndirect(GLenum mode,
                             GLenum indexType,
                             Buffer& indexBuffer,
                             Buffer& indirectBuffer,
                             const GLvoid* indirectBufferOffset);
+  void multiDrawArraysIndirect(GLenum mode,
+                               Buffer& indirectBuffer,
+                               const GLvoid* indirectBufferOffset,
+                               GLsizei drawCount,
+                               GLsizei stride);
+  void multiDrawElementsIndirect(GLenum mode,
+                                 GLenum indexType,
+                                 Buffer& indexBuffer,
+                                 Buffer& indirectBuffer,
+                                 const GLvoid* indirectBufferOffset,
+                                 GLsizei drawCount,
+                                 GLsizei stride);
 
   void endEncoding();
 
+  /// Issues the pending draw batch (if any) with the GL state it was started under. Every state
+  /// mutation and every non-batchable draw flushes before touching GL, so the deferred draws
+  /// never observe later state; callers that bypass the adapter (e.g. debug markers) must flush
+  /// explicitly. No-op unless draw batching is active
+  void flushDrawBatch();
+
   void initialize(const RenderPassDesc& renderPass,
                   const std::shared_ptr<IFramebuffer>& framebuffer,
                   Result* outResult);
@@ -116,6 +194,12 @@ class RenderCommandAdapter final : public WithContext {
   void willDraw();
   void didDraw();
   void unbindVertexAttributes();
+
+  /// Binds the VAO cached for the current (pipeline, vertex buffer set) combination, creating it
+  /// on a miss. On a hit all attribute state is already captured in the VAO, so the pending
+  /// vertex buffer dirty bits are dropped; on a miss every bound buffer is marked dirty so
+  /// willDraw() specifies the attributes into the fresh VAO
+  void bindCachedVertexArrayObject();
   void unbindResources();
 
   void bindBufferWithShaderStorageBufferOverride(Buffer& buffer,
@@ -152,9 +236,15 @@ class RenderCommandAdapter final : public WithContext {
   std::shared_ptr<IRenderPipelineState> pipelineState_;
   std::shared_ptr<IDepthStencilState> depthStencilState_;
   std::shared_ptr<VertexArrayObject> activeVAO_ = nullptr;
+  // recurring (pipeline, vertex buffer set) combinations bind one cached VAO instead of
+  // re-specifying every attribute; cleared wholesale when it grows past its cap
+  std::unordered_map<VaoCacheKey, VaoCacheEntry, VaoCacheKeyHash> vaoCache_;
+  static constexpr size_t kMaxCachedVertexArrayObjects = 64;
 
   UnbindPolicy cachedUnbindPolicy_;
   bool useVAO_ = false;
+  DrawBatch drawBatch_;
+  bool useDrawBatching_ = false;
 };
 } // namespace opengl
 } // namespace igl
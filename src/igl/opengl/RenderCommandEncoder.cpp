@@ -80,14 +80,39 @@ void RenderCommandEncoder::beginEncoding(const RenderPassDesc& renderPass,
   }
   framebuffer_ = std::static_pointer_cast<igl::opengl::Framebuffer>(framebuffer);
   resolveFramebuffer_ = framebuffer_->getResolveFramebuffer();
+
+  // Instanced-stereo fallback: when the pass requests multiple views but the device has no
+  // GL_OVR_multiview2 support, every draw is instanced once per view. The app's vertex shader
+  // selects the eye from gl_InstanceID and clips to its half of a double-wide render target
+  // with gl_ClipDistance, so XR sessions keep one view-mask code path on older GL targets.
+  stereoInstancedViews_ = 1;
+  if (renderPass.viewMask != 0 &&
+      !getContext().deviceFeatures().hasFeature(DeviceFeatures::Multiview)) {
+    uint32_t numViews = 0;
+    for (uint32_t mask = renderPass.viewMask; mask != 0; mask >>= 1u) {
+      numViews += mask & 1u;
+    }
+    stereoInstancedViews_ = numViews > 1 ? numViews : 1;
+    if (stereoInstancedViews_ > 1) {
+      context.enable(GL_CLIP_DISTANCE0);
+    }
+  }
   Result::setOk(outResult);
 }
 
 void RenderCommandEncoder::endEncoding() {
   if (IGL_VERIFY(adapter_)) {
+    // pending batched draws must land before the caller state below is restored
+    adapter_->flushDrawBatch();
+
     // Restore caller state
     getContext().setEnabled(scissorEnabled_, GL_SCISSOR_TEST);
 
+    if (stereoInstancedViews_ > 1) {
+      getContext().disable(GL_CLIP_DISTANCE0);
+      stereoInstancedViews_ = 1;
+    }
+
     // Disable depthBias
     getContext().setEnabled(false, GL_POLYGON_OFFSET_FILL);
     adapter_->setDepthBias(0.0f, 0.0f);
@@ -159,6 +184,8 @@ void RenderCommandEncoder::pushDebugGroupLabel(const char* label,
   IGL_ASSERT(adapter_);
   IGL_ASSERT(label != nullptr && *label);
   if (getContext().deviceFeatures().hasInternalFeature(InternalFeatures::DebugMessage)) {
+    // keep the marker ordered relative to any batched draws
+    adapter_->flushDrawBatch();
     std::string_view labelSV(label);
     getContext().pushDebugGroup(GL_DEBUG_SOURCE_APPLICATION, 0, labelSV.length(), labelSV.data());
   } else {
@@ -172,6 +199,7 @@ void RenderCommandEncoder::insertDebugEventLabel(const char* label,
   IGL_ASSERT(adapter_);
   IGL_ASSERT(label != nullptr && *label);
   if (getContext().deviceFeatures().hasInternalFeature(InternalFeatures::DebugMessage)) {
+    adapter_->flushDrawBatch();
     std::string_view labelSV(label);
     getContext().debugMessageInsert(GL_DEBUG_SOURCE_APPLICATION,
                                     GL_DEBUG_TYPE_MARKER,
@@ -188,6 +216,7 @@ void RenderCommandEncoder::insertDebugEventLabel(const char* label,
 void RenderCommandEncoder::popDebugGroupLabel() const {
   IGL_ASSERT(adapter_);
   if (getContext().deviceFeatures().hasInternalFeature(InternalFeatures::DebugMessage)) {
+    adapter_->flushDrawBatch();
     getContext().popDebugGroup();
   } else {
     IGL_LOG_ERROR_ONCE("RenderCommandEncoder::popDebugGroupLabel not supported in this context!\n");
@@ -209,6 +238,7 @@ void RenderCommandEncoder::bindScissorRect(const ScissorRect& rect) {
 void RenderCommandEncoder::bindRenderPipelineState(
     const std::shared_ptr<IRenderPipelineState>& pipelineState) {
   if (IGL_VERIFY(adapter_)) {
+    getCommandBuffer().mutableStatistics().pipelineBindCount++;
     adapter_->setPipelineState(pipelineState);
   }
 }
@@ -237,6 +267,7 @@ void RenderCommandEncoder::bindBuffer(int index,
   IGL_ASSERT_MSG(index >= 0, "Invalid index passed to bindBuffer: %d", index);
   // bindTarget (which can be BindTarget::kVertex or kFragment) is unused in OGL backend
   if (IGL_VERIFY(adapter_) && buffer) {
+    getCommandBuffer().mutableStatistics().bufferBindCount++;
     auto glBuffer = std::static_pointer_cast<Buffer>(buffer);
     auto bufferType = glBuffer->getType();
 
@@ -254,6 +285,7 @@ void RenderCommandEncoder::bindVertexBuffer(uint32_t index,
                                             const std::shared_ptr<IBuffer>& buffer,
                                             size_t bufferOffset) {
   if (IGL_VERIFY(adapter_) && buffer) {
+    getCommandBuffer().mutableStatistics().bufferBindCount++;
     auto glBuffer = std::static_pointer_cast<Buffer>(buffer);
 
     IGL_ASSERT(glBuffer->getType() == Buffer::Type::Attribute);
@@ -279,6 +311,7 @@ void RenderCommandEncoder::bindSamplerState(size_t index,
                                             uint8_t bindTarget,
                                             ISamplerState* samplerState) {
   if (IGL_VERIFY(adapter_)) {
+    getCommandBuffer().mutableStatistics().textureBindCount++;
     if ((bindTarget & BindTarget::kVertex) != 0) {
       adapter_->setVertexSamplerState(samplerState, index);
     }
@@ -290,6 +323,7 @@ void RenderCommandEncoder::bindSamplerState(size_t index,
 
 void RenderCommandEncoder::bindTexture(size_t index, uint8_t bindTarget, ITexture* texture) {
   if (IGL_VERIFY(adapter_)) {
+    getCommandBuffer().mutableStatistics().textureBindCount++;
     if ((bindTarget & BindTarget::kVertex) != 0) {
       adapter_->setVertexTexture(texture, index);
     }
@@ -338,16 +372,24 @@ void RenderCommandEncoder::draw(PrimitiveType primitiveType,
                                 size_t vertexCount,
                                 uint32_t instanceCount,
                                 uint32_t baseInstance) {
-  (void)instanceCount;
   (void)baseInstance;
 
-  IGL_ASSERT_MSG(instanceCount == 1, "Instancing is not implemented");
-  IGL_ASSERT_MSG(baseInstance == 0, "Instancing is not implemented");
+  IGL_ASSERT_MSG(baseInstance == 0, "baseInstance is not implemented");
 
   if (IGL_VERIFY(adapter_)) {
     getCommandBuffer().incrementCurrentDrawCount();
     auto mode = toGlPrimitive(primitiveType);
-    adapter_->drawArrays(mode, (GLsizei)vertexStart, (GLsizei)vertexCount);
+    const uint32_t instances = (instanceCount > 1u ? instanceCount : 1u) * stereoInstancedViews_;
+    auto& stats = getCommandBuffer().mutableStatistics();
+    stats.instanceCount += instances;
+    stats.estimatedPrimitiveCount +=
+        estimatedPrimitiveCount(primitiveType, vertexCount) * instances;
+    if (instances > 1) {
+      adapter_->drawArraysInstanced(
+          mode, (GLsizei)vertexStart, (GLsizei)vertexCount, (GLsizei)instances);
+    } else {
+      adapter_->drawArrays(mode, (GLsizei)vertexStart, (GLsizei)vertexCount);
+    }
   }
 }
 
@@ -359,20 +401,28 @@ void RenderCommandEncoder::drawIndexed(PrimitiveType primitiveType,
                                        uint32_t instanceCount,
                                        int32_t baseVertex,
                                        uint32_t baseInstance) {
-  (void)instanceCount;
   (void)baseVertex;
   (void)baseInstance;
 
-  IGL_ASSERT_MSG(instanceCount == 1, "Instancing is not implemented");
   IGL_ASSERT_MSG(baseVertex == 0, "baseVertex is not implemented");
-  IGL_ASSERT_MSG(baseInstance == 0, "Instancing is not implemented");
+  IGL_ASSERT_MSG(baseInstance == 0, "baseInstance is not implemented");
 
   if (IGL_VERIFY(adapter_)) {
     getCommandBuffer().incrementCurrentDrawCount();
     auto mode = toGlPrimitive(primitiveType);
     auto type = toGlType(indexFormat);
     auto offset = reinterpret_cast<void*>(indexBufferOffset);
-    adapter_->drawElements(mode, (GLsizei)indexCount, type, (Buffer&)indexBuffer, offset);
+    const uint32_t instances = (instanceCount > 1u ? instanceCount : 1u) * stereoInstancedViews_;
+    auto& stats = getCommandBuffer().mutableStatistics();
+    stats.instanceCount += instances;
+    stats.estimatedPrimitiveCount +=
+        estimatedPrimitiveCount(primitiveType, indexCount) * instances;
+    if (instances > 1) {
+      adapter_->drawElementsInstanced(
+          mode, (GLsizei)indexCount, type, (Buffer&)indexBuffer, offset, (GLsizei)instances);
+    } else {
+      adapter_->drawElements(mode, (GLsizei)indexCount, type, (Buffer&)indexBuffer, offset);
+    }
   }
 }
 
@@ -391,21 +441,54 @@ void RenderCommandEncoder::drawIndexedIndirect(PrimitiveType primitiveType,
   }
 }
 
-void RenderCommandEncoder::multiDrawIndirect(PrimitiveType /*primitiveType*/,
-                                             IBuffer& /*indirectBuffer*/,
-                                             size_t /*indirectBufferOffset*/,
-                                             uint32_t /*drawCount*/,
-                                             uint32_t /*stride*/) {
-  IGL_ASSERT_NOT_IMPLEMENTED();
+void RenderCommandEncoder::multiDrawIndirect(PrimitiveType primitiveType,
+                                             IBuffer& indirectBuffer,
+                                             size_t indirectBufferOffset,
+                                             uint32_t drawCount,
+                                             uint32_t stride) {
+  if (IGL_VERIFY(adapter_)) {
+    getCommandBuffer().incrementCurrentDrawCount();
+    auto mode = toGlPrimitive(primitiveType);
+    auto indirectBufferOffsetPtr = reinterpret_cast<void*>(indirectBufferOffset);
+    adapter_->multiDrawArraysIndirect(mode,
+                                      (Buffer&)indirectBuffer,
+                                      indirectBufferOffsetPtr,
+                                      (GLsizei)drawCount,
+                                      (GLsizei)stride);
+  }
+}
+
+void RenderCommandEncoder::multiDrawIndexedIndirect(PrimitiveType primitiveType,
+                                                    IndexFormat indexFormat,
+                                                    IBuffer& indexBuffer,
+                                                    IBuffer& indirectBuffer,
+                                                    size_t indirectBufferOffset,
+                                                    uint32_t drawCount,
+                                                    uint32_t stride) {
+  if (IGL_VERIFY(adapter_)) {
+    getCommandBuffer().incrementCurrentDrawCount();
+    auto mode = toGlPrimitive(primitiveType);
+    auto type = toGlType(indexFormat);
+    auto indirectBufferOffsetPtr = reinterpret_cast<void*>(indirectBufferOffset);
+    adapter_->multiDrawElementsIndirect(mode,
+                                        type,
+                                        (Buffer&)indexBuffer,
+                                        (Buffer&)indirectBuffer,
+                                        indirectBufferOffsetPtr,
+                                        (GLsizei)drawCount,
+                                        (GLsizei)stride);
+  }
 }
 
-void RenderCommandEncoder::multiDrawIndexedIndirect(PrimitiveType /*primitiveType*/,
-                                                    IndexFormat /*indexFormat*/,
-                                                    IBuffer& /*indexBuffer*/,
-                                                    IBuffer& /*indirectBuffer*/,
-                                                    size_t /*indirectBufferOffset*/,
-                                                    uint32_t /*drawCount*/,
-                                                    uint32_t /*stride*/) {
+void RenderCommandEncoder::multiDrawIndexedIndirectCount(PrimitiveType /*primitiveType*/,
+                                                         IndexFormat /*indexFormat*/,
+                                                         IBuffer& /*indexBuffer*/,
+                                                         IBuffer& /*indirectBuffer*/,
+                                                         size_t /*indirectBufferOffset*/,
+                                                         IBuffer& /*countBuffer*/,
+                                                         size_t /*countBufferOffset*/,
+                                                         uint32_t /*maxDrawCount*/,
+                                                         uint32_t /*stride*/) {
   IGL_ASSERT_NOT_IMPLEMENTED();
 }
 
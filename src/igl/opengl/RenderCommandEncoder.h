@@ -101,6 +101,15 @@ class RenderCommandEncoder final : public IRenderCommandEncoder, public WithCont
                                 size_t indirectBufferOffset,
                                 uint32_t drawCount,
                                 uint32_t stride) override;
+  void multiDrawIndexedIndirectCount(PrimitiveType primitiveType,
+                                     IndexFormat indexFormat,
+                                     IBuffer& indexBuffer,
+                                     IBuffer& indirectBuffer,
+                                     size_t indirectBufferOffset,
+                                     IBuffer& countBuffer,
+                                     size_t countBufferOffset,
+                                     uint32_t maxDrawCount,
+                                     uint32_t stride) override;
 
   void setStencilReferenceValue(uint32_t value) override;
   void setStencilReferenceValues(uint32_t frontValue, uint32_t backValue) override;
@@ -110,6 +119,9 @@ class RenderCommandEncoder final : public IRenderCommandEncoder, public WithCont
  private:
   std::unique_ptr<RenderCommandAdapter> adapter_;
   bool scissorEnabled_ = false;
+  // > 1 when the instanced-stereo fallback is active for this pass: draws are instanced once per
+  // requested view and the shader selects the eye from gl_InstanceID (see beginEncoding)
+  uint32_t stereoInstancedViews_ = 1;
   std::shared_ptr<igl::opengl::Framebuffer> resolveFramebuffer_;
   std::shared_ptr<igl::opengl::Framebuffer> framebuffer_;
 };
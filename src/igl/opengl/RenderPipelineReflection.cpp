@@ -7,6 +7,7 @@
 
 #include "RenderPipelineReflection.h"
 
+#include <algorithm>
 #include <cstring>
 #include <igl/opengl/GLIncludes.h>
 
@@ -261,33 +262,53 @@ void RenderPipelineReflection::generateShaderStorageBufferObjectDictionary(ICont
   }
 }
 
-int RenderPipelineReflection::getIndexByName(const NameHandle& name) const {
-  // Search through list of uniforms
-  const auto uniformEntry = uniformDictionary_.find(name);
+void RenderPipelineReflection::rebuildIndexTable() const {
+  indexTable_.clear();
+  indexTable_.reserve(uniformDictionary_.size() + uniformBlocksDictionary_.size() +
+                      attributeDictionary_.size() + shaderStorageBufferObjectDictionary_.size());
 
-  if (uniformEntry != uniformDictionary_.end()) {
-    return uniformEntry->second.location;
+  // Insertion order encodes the precedence the dictionaries used to be probed in; the stable
+  // sort below keeps the first (highest-precedence) entry in front for duplicate names
+  for (const auto& entry : uniformDictionary_) {
+    indexTable_.push_back({entry.first.getCrc32(), entry.second.location});
   }
-
-  // search through the list of uniform blocks
-  const auto uniformBlockEntry = uniformBlocksDictionary_.find(name);
-  if (uniformBlockEntry != uniformBlocksDictionary_.end()) {
-    return uniformBlockEntry->second.bindingIndex;
+  for (const auto& entry : uniformBlocksDictionary_) {
+    indexTable_.push_back({entry.first.getCrc32(), entry.second.bindingIndex});
   }
-
-  // Search through list of attributes
-  auto attribEntry = attributeDictionary_.find(name.toString());
-  if (attribEntry != attributeDictionary_.end()) {
-    return attribEntry->second;
+  for (const auto& entry : attributeDictionary_) {
+    indexTable_.push_back({iglCrc32(entry.first.c_str(), entry.first.length()), entry.second});
+  }
+  for (const auto& entry : shaderStorageBufferObjectDictionary_) {
+    indexTable_.push_back({entry.first.getCrc32(), entry.second});
   }
 
-  // Search through list of SSBOs
-  auto ssboEntry = shaderStorageBufferObjectDictionary_.find(name);
-  if (ssboEntry != shaderStorageBufferObjectDictionary_.end()) {
-    return ssboEntry->second;
+  std::stable_sort(
+      indexTable_.begin(),
+      indexTable_.end(),
+      [](const IndexTableEntry& a, const IndexTableEntry& b) { return a.crc32 < b.crc32; });
+  indexTable_.erase(std::unique(indexTable_.begin(),
+                                indexTable_.end(),
+                                [](const IndexTableEntry& a, const IndexTableEntry& b) {
+                                  return a.crc32 == b.crc32;
+                                }),
+                    indexTable_.end());
+
+  indexTableDirty_ = false;
+}
+
+int RenderPipelineReflection::getIndexByName(const NameHandle& name) const {
+  if (indexTableDirty_) {
+    rebuildIndexTable();
   }
 
-  return -1;
+  const uint32_t crc = name.getCrc32();
+  const auto it = std::lower_bound(
+      indexTable_.begin(),
+      indexTable_.end(),
+      crc,
+      [](const IndexTableEntry& entry, uint32_t key) { return entry.crc32 < key; });
+
+  return (it != indexTable_.end() && it->crc32 == crc) ? it->location : -1;
 }
 
 void RenderPipelineReflection::cacheDescriptors() {
@@ -54,6 +54,9 @@ class RenderPipelineReflection final : public IRenderPipelineReflection {
   }
 
   std::unordered_map<NameHandle, UniformBlockDesc>& getUniformBlocksDictionary() {
+    // callers may change block binding indices through this accessor, invalidating the flat
+    // lookup table
+    indexTableDirty_ = true;
     return uniformBlocksDictionary_;
   }
 
@@ -69,11 +72,28 @@ class RenderPipelineReflection final : public IRenderPipelineReflection {
   ~RenderPipelineReflection() override;
 
  private:
+  // One row of the flat lookup table behind getIndexByName(). NameHandle already carries a
+  // 4-byte CRC32, so lookups reduce to a binary search over contiguous integer keys
+  struct IndexTableEntry {
+    uint32_t crc32;
+    int location;
+  };
+
+  // Builds indexTable_ from the four dictionaries below, with the same precedence the
+  // dictionaries used to be probed in (uniforms, uniform blocks, attributes, SSBOs)
+  void rebuildIndexTable() const;
+
   std::unordered_map<NameHandle, UniformDesc> uniformDictionary_;
   std::unordered_map<NameHandle, UniformBlockDesc> uniformBlocksDictionary_;
   std::unordered_map<std::string, int> attributeDictionary_;
   std::unordered_map<NameHandle, int> shaderStorageBufferObjectDictionary_;
 
+  // getIndexByName() runs per uniform per draw, so it binary-searches this sorted flat table
+  // instead of probing up to four unordered_maps. Rebuilt lazily because block binding indices
+  // can be patched after reflection through getUniformBlocksDictionary()
+  mutable std::vector<IndexTableEntry> indexTable_;
+  mutable bool indexTableDirty_ = true;
+
   void generateUniformDictionary(IContext& context, GLuint pid);
   void generateUniformBlocksDictionary(IContext& context, GLuint pid);
   void generateShaderStorageBufferObjectDictionary(IContext& context, GLuint pid);
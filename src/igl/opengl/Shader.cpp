@@ -9,10 +9,13 @@
 
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <igl/opengl/CommandBuffer.h>
 #include <igl/opengl/Device.h>
 #include <igl/opengl/Errors.h>
+#include <igl/opengl/ProgramBinaryCache.h>
 #include <string>
+#include <string_view>
 
 #if IGL_SHADER_DUMP
 #include <filesystem>
@@ -21,6 +24,58 @@
 
 namespace igl {
 namespace opengl {
+namespace {
+
+void hashCombine(size_t& hash, size_t value) {
+  hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+}
+
+// GL has no specialization constants, so bake the values in as IGL_SPEC_CONST_<id> preprocessor
+// defines. Each distinct constant set still costs a recompile, but shaders stay portable across
+// backends.
+std::string injectSpecializationDefines(const char* source,
+                                        const std::vector<SpecializationConstant>& constants) {
+  std::string defines;
+  for (const auto& constant : constants) {
+    defines += "#define IGL_SPEC_CONST_" + std::to_string(constant.id) + " ";
+    switch (constant.type) {
+    case SpecializationConstantType::Bool:
+      defines += (constant.value != 0) ? "true" : "false";
+      break;
+    case SpecializationConstantType::Int:
+      defines += std::to_string(static_cast<int32_t>(constant.value));
+      break;
+    case SpecializationConstantType::UInt:
+      defines += std::to_string(constant.value) + "u";
+      break;
+    case SpecializationConstantType::Float: {
+      float value = 0.0f;
+      memcpy(&value, &constant.value, sizeof(value));
+      defines += std::to_string(value);
+      break;
+    }
+    }
+    defines += "\n";
+  }
+
+  const std::string_view src(source);
+  // #version must stay the first directive; insert right after its line when present
+  size_t insertPos = 0;
+  const size_t versionPos = src.find("#version");
+  if (versionPos != std::string_view::npos) {
+    insertPos = src.find('\n', versionPos);
+    insertPos = (insertPos == std::string_view::npos) ? src.size() : insertPos + 1;
+  }
+  // build the result in one pass instead of copying the source and shifting its tail on insert
+  std::string patched;
+  patched.reserve(src.size() + defines.size());
+  patched.append(src.substr(0, insertPos));
+  patched.append(defines);
+  patched.append(src.substr(insertPos));
+  return patched;
+}
+
+} // namespace
 
 ShaderStages::ShaderStages(const ShaderStagesDesc& desc, IContext& context) :
   IShaderStages(desc), WithContext(context), programID_(0) {}
@@ -58,6 +113,36 @@ void ShaderStages::createRenderProgram(Result* result) {
     return;
   }
 
+  // collect any deferred parallel compiles so failures are attributed to the right stage
+  auto compileResult = vertexShader.ensureCompiled();
+  if (!compileResult.isOk()) {
+    Result::setResult(result, std::move(compileResult));
+    return;
+  }
+  compileResult = fragmentShader.ensureCompiled();
+  if (!compileResult.isOk()) {
+    Result::setResult(result, std::move(compileResult));
+    return;
+  }
+
+  const bool useBinaryCache =
+      ProgramBinaryCache::isEnabled() && ProgramBinaryCache::isSupported(getContext());
+  size_t sourceHash = 0;
+  if (useBinaryCache) {
+    sourceHash = vertexShader.getHash();
+    hashCombine(sourceHash, fragmentShader.getHash());
+    const GLuint cachedProgramID = ProgramBinaryCache::loadProgram(getContext(), sourceHash);
+    if (cachedProgramID != 0) {
+      // skip compiling and linking entirely; the cached binary is the linked program
+      if (programID_ != 0) {
+        getContext().deleteProgram(programID_);
+      }
+      programID_ = cachedProgramID;
+      Result::setResult(result, Result::Code::Ok);
+      return;
+    }
+  }
+
   // always create a new temp program ID
   // we'll set or update this object's program ID after the linking succeeds
   // otherwise we won't modify this program, so we can still use it
@@ -70,6 +155,10 @@ void ShaderStages::createRenderProgram(Result* result) {
   // attach the shaders and link them
   getContext().attachShader(programID, vertexShaderID);
   getContext().attachShader(programID, fragmentShaderID);
+  if (useBinaryCache) {
+    // ask the driver to keep a retrievable binary around for storing below
+    getContext().programParameteri(programID, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+  }
   getContext().linkProgram(programID);
 
   // detach the shaders now that they've been linked
@@ -97,6 +186,10 @@ void ShaderStages::createRenderProgram(Result* result) {
     return;
   }
 
+  if (useBinaryCache) {
+    ProgramBinaryCache::storeProgram(getContext(), sourceHash, programID);
+  }
+
   // now that the program successfully linked, set the program
   if (programID_ != 0) {
     getContext().deleteProgram(programID_);
@@ -123,6 +216,27 @@ void ShaderStages::createComputeProgram(Result* result) {
     return;
   }
 
+  auto compileResult = shader.ensureCompiled();
+  if (!compileResult.isOk()) {
+    Result::setResult(result, std::move(compileResult));
+    return;
+  }
+
+  const bool useBinaryCache =
+      ProgramBinaryCache::isEnabled() && ProgramBinaryCache::isSupported(getContext());
+  const size_t sourceHash = shader.getHash();
+  if (useBinaryCache) {
+    const GLuint cachedProgramID = ProgramBinaryCache::loadProgram(getContext(), sourceHash);
+    if (cachedProgramID != 0) {
+      if (programID_ != 0) {
+        getContext().deleteProgram(programID_);
+      }
+      programID_ = cachedProgramID;
+      Result::setResult(result, Result::Code::Ok);
+      return;
+    }
+  }
+
   // always create a new temp program ID
   // we'll set or update this object's program ID after the linking succeeds
   // otherwise we won't modify this program, so we can still use it
@@ -134,6 +248,9 @@ void ShaderStages::createComputeProgram(Result* result) {
 
   // attach the shaders and link them
   getContext().attachShader(programID, shaderID);
+  if (useBinaryCache) {
+    getContext().programParameteri(programID, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+  }
   getContext().linkProgram(programID);
 
   // detach the shaders now that they've been linked
@@ -151,6 +268,10 @@ void ShaderStages::createComputeProgram(Result* result) {
     return;
   }
 
+  if (useBinaryCache) {
+    ProgramBinaryCache::storeProgram(getContext(), sourceHash, programID);
+  }
+
   // now that the program successfully linked, set the program
   if (programID_ != 0) {
     getContext().deleteProgram(programID_);
@@ -256,7 +377,13 @@ Result ShaderModule::create(const ShaderModuleDesc& desc) {
   }
 
   // compile the shader
-  const GLchar* src = (GLchar*)desc.input.source;
+  std::string specializedSource;
+  if (!desc.specializationConstants.empty()) {
+    specializedSource = injectSpecializationDefines(desc.input.source,
+                                                    desc.specializationConstants);
+  }
+  const GLchar* src = specializedSource.empty() ? (GLchar*)desc.input.source
+                                                : specializedSource.c_str();
 
 #if IGL_SHADER_DUMP
   auto hash = std::hash<const GLchar*>()(src);
@@ -289,6 +416,20 @@ Result ShaderModule::create(const ShaderModuleDesc& desc) {
   getContext().shaderSource(shaderID, 1, &src, nullptr);
   getContext().compileShader(shaderID);
 
+  if (getContext().deviceFeatures().hasInternalFeature(InternalFeatures::ParallelShaderCompile)) {
+    // The driver compiles on its own threads and only blocks at the first status query. Defer
+    // that query to ensureCompiled() so back-to-back module creation overlaps compilation
+    if (shaderID_ != 0) {
+      getContext().deleteShader(shaderID_);
+    }
+    shaderID_ = shaderID;
+    compilePending_ = true;
+    // hash the source as compiled (including injected specialization defines) so distinct
+    // variants of one source never collide in the program cache
+    hash_ = std::hash<std::string_view>()(std::string_view(src, strlen(src)));
+    return Result();
+  }
+
   // see if the compilation succeeded
   GLint status;
   getContext().getShaderiv(shaderID, GL_COMPILE_STATUS, &status);
@@ -321,8 +462,33 @@ Result ShaderModule::create(const ShaderModuleDesc& desc) {
   }
   shaderID_ = shaderID;
 
-  hash_ =
-      std::hash<std::string_view>()(std::string_view(desc.input.source, strlen(desc.input.source)));
+  hash_ = std::hash<std::string_view>()(std::string_view(src, strlen(src)));
+
+  return Result();
+}
+
+Result ShaderModule::ensureCompiled() const {
+  if (!compilePending_) {
+    return Result();
+  }
+  compilePending_ = false;
+
+  // blocks until the driver's background compile for this shader has finished
+  GLint status;
+  getContext().getShaderiv(shaderID_, GL_COMPILE_STATUS, &status);
+  if (status == GL_FALSE) {
+    GLsizei logSize = 0;
+    getContext().getShaderiv(shaderID_, GL_INFO_LOG_LENGTH, &logSize);
+
+    std::vector<GLchar> log(logSize);
+    getContext().getShaderInfoLog(shaderID_, logSize, nullptr, log.data());
+
+    const std::string errorLog(log.begin(), log.end());
+    IGL_LOG_ERROR("failed to compile %s shader:\n%s\n",
+                  (shaderType_ == GL_VERTEX_SHADER ? "vertex" : "fragment"),
+                  errorLog.c_str());
+    return Result(Result::Code::ArgumentInvalid, errorLog);
+  }
 
   return Result();
 }
@@ -39,6 +39,11 @@ class ShaderModule : public WithContext, public IShaderModule {
     return hash_;
   }
 
+  /// Blocks until a deferred compile has finished and returns its status. With
+  /// GL_KHR_parallel_shader_compile the driver compiles on background threads; create() skips the
+  /// blocking status query and the first program that links this module collects it here.
+  Result ensureCompiled() const;
+
   ShaderModule(IContext& context, ShaderModuleInfo info);
 
  private:
@@ -50,6 +55,9 @@ class ShaderModule : public WithContext, public IShaderModule {
 
   // Hash of the shader source
   size_t hash_ = 0;
+
+  // True while a parallel compile has been issued but its status not yet queried
+  mutable bool compilePending_ = false;
 };
 
 class ShaderStages final : public IShaderStages, public WithContext {
@@ -8,6 +8,7 @@
 #include <igl/opengl/TextureBuffer.h>
 
 #include <array>
+#include <cstring>
 #include <igl/opengl/Errors.h>
 #include <utility>
 
@@ -42,6 +43,14 @@ void swapTextureChannelsForFormat(igl::opengl::IContext& context,
 } // namespace
 
 TextureBuffer::~TextureBuffer() {
+  if (!uploadPboIds_.empty()) {
+    for (auto* fence : uploadPboFences_) {
+      if (fence != nullptr) {
+        getContext().deleteSync(fence);
+      }
+    }
+    getContext().deleteBuffers(static_cast<GLsizei>(uploadPboIds_.size()), uploadPboIds_.data());
+  }
   GLuint textureID = getId();
   if (textureID != 0) {
     if (textureHandle_ != 0) {
@@ -98,10 +107,26 @@ Result TextureBuffer::createTexture(const TextureDesc& desc) {
     return Result(Result::Code::Unsupported, "Unsupported texture target");
   }
 
-  // If usage doesn't include Storage, ensure usage includes sampled for correct format selection
-  const auto usageForFormat = (desc.usage & TextureDesc::TextureUsageBits::Storage) == 0
-                                  ? desc.usage | TextureDesc::TextureUsageBits::Sampled
-                                  : desc.usage;
+  if (desc.usage & TextureDesc::TextureUsageBits::Storage) {
+    if (!getContext().deviceFeatures().hasInternalFeature(InternalFeatures::TexStorage)) {
+      return Result(Result::Code::Unsupported, "Texture Storage not supported");
+    }
+    useTexStorage_ = true;
+  } else {
+    // Immutable storage cannot be re-specified, so drivers validate completeness once at
+    // creation instead of on every bind. Texture sizes are fixed in TextureDesc, so opt into
+    // glTexStorage whenever the device and format support it, even without the Storage usage bit
+    useTexStorage_ =
+        desc.type != TextureType::ExternalImage &&
+        contains(getContext().deviceFeatures().getTextureFormatCapabilities(desc.format),
+                 ICapabilities::TextureFormatCapabilityBits::Storage);
+  }
+
+  // Format selection must match the allocation path: glTexStorage requires sized internal
+  // formats. If usage doesn't include Storage, ensure usage includes sampled for correct format
+  // selection
+  const auto usageForFormat = useTexStorage_ ? desc.usage | TextureDesc::TextureUsageBits::Storage
+                                             : desc.usage | TextureDesc::TextureUsageBits::Sampled;
   if (!toFormatDescGL(desc.format, usageForFormat, formatDescGL_)) {
     // can't create a texture with the given format
     return Result(Result::Code::ArgumentInvalid, "Invalid texture format");
@@ -111,12 +136,6 @@ Result TextureBuffer::createTexture(const TextureDesc& desc) {
     return Result(Result::Code::ArgumentInvalid, "Invalid texture type");
   }
 
-  if (desc.usage & TextureDesc::TextureUsageBits::Storage) {
-    if (!getContext().deviceFeatures().hasInternalFeature(InternalFeatures::TexStorage)) {
-      return Result(Result::Code::Unsupported, "Texture Storage not supported");
-    }
-  }
-
   glInternalFormat_ = formatDescGL_.internalFormat;
 
   // create the GL texture ID
@@ -430,12 +449,92 @@ Result TextureBuffer::uploadInternal(TextureType /*type*/,
   }
   getContext().bindTexture(target, getId());
 
-  auto result = uploadInternal(target, range, data, bytesPerRow);
+  // Prefer staging through a pixel unpack buffer so the driver can copy from GPU-visible memory
+  // asynchronously instead of stalling the calling thread on large client-memory reads
+  auto result = canUploadViaPbo(range, bytesPerRow)
+                    ? uploadViaPbo(target, range, data, bytesPerRow)
+                    : uploadInternal(target, range, data, bytesPerRow);
 
   getContext().bindTexture(getTarget(), 0);
   return result;
 }
 
+bool TextureBuffer::canUploadViaPbo(const TextureRangeDesc& range, size_t bytesPerRow) const {
+  if (type_ != TextureType::TwoD || getProperties().isCompressed()) {
+    return false;
+  }
+  if (range.numMipLevels != 1 || range.numFaces != 1 || range.numLayers != 1) {
+    return false;
+  }
+  // the staging copy is the exact texel payload; rows with extra padding keep the direct path
+  if (bytesPerRow != 0 && bytesPerRow != getProperties().getBytesPerRow(range)) {
+    return false;
+  }
+  const auto& deviceFeatures = getContext().deviceFeatures();
+  return deviceFeatures.hasInternalFeature(InternalFeatures::PixelBufferObject) &&
+         deviceFeatures.hasInternalFeature(InternalFeatures::Sync) &&
+         deviceFeatures.hasFeature(DeviceFeatures::MapBufferRange);
+}
+
+Result TextureBuffer::uploadViaPbo(GLenum target,
+                                   const TextureRangeDesc& range,
+                                   const void* IGL_NONNULL data,
+                                   size_t bytesPerRow) const {
+  const auto uploadSize = getProperties().getBytesPerRange(range);
+  if (uploadPboIds_.empty()) {
+    uploadPboIds_.resize(kUploadPboCount, 0);
+    uploadPboFences_.resize(kUploadPboCount, nullptr);
+    uploadPboSizes_.resize(kUploadPboCount, 0);
+    getContext().genBuffers(static_cast<GLsizei>(kUploadPboCount), uploadPboIds_.data());
+  }
+
+  // recycle the least recently used buffer once the GPU has consumed its previous upload
+  auto*& fence = uploadPboFences_[uploadPboIndex_];
+  if (fence != nullptr) {
+    constexpr uint64_t kFenceTimeoutNs = 1000000000ull; // 1 second
+    IGL_MAYBE_UNUSED const GLenum status =
+        getContext().clientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, kFenceTimeoutNs);
+    IGL_ASSERT_MSG(status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED,
+                   "Timed out waiting for a texture upload buffer");
+    getContext().deleteSync(fence);
+    fence = nullptr;
+  }
+
+  getContext().bindBuffer(GL_PIXEL_UNPACK_BUFFER, uploadPboIds_[uploadPboIndex_]);
+  if (uploadSize > uploadPboSizes_[uploadPboIndex_]) {
+    getContext().bufferData(
+        GL_PIXEL_UNPACK_BUFFER, static_cast<GLsizeiptr>(uploadSize), nullptr, GL_STREAM_DRAW);
+    uploadPboSizes_[uploadPboIndex_] = uploadSize;
+  }
+
+  void* stagingData = getContext().mapBufferRange(GL_PIXEL_UNPACK_BUFFER,
+                                                  0,
+                                                  static_cast<GLsizeiptr>(uploadSize),
+                                                  GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+  if (stagingData == nullptr) {
+    // fall back to the synchronous client-memory path
+    getContext().bindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    return uploadInternal(target, range, data, bytesPerRow);
+  }
+  memcpy(stagingData, data, uploadSize);
+  getContext().unmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+
+  // the staging copy is tightly packed
+  if (getContext().deviceFeatures().hasInternalFeature(InternalFeatures::UnpackRowLength)) {
+    getContext().pixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+  }
+  getContext().pixelStorei(GL_UNPACK_ALIGNMENT, this->getAlignment(0, range.mipLevel));
+
+  const auto texImage = isValidForTexImage(range) && !supportsTexStorage();
+  // with an unpack buffer bound, a null data pointer sources texels from offset 0 of the buffer
+  auto result = upload2D(target, range, texImage, nullptr);
+
+  fence = getContext().fenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+  getContext().bindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+  uploadPboIndex_ = (uploadPboIndex_ + 1) % kUploadPboCount;
+  return result;
+}
+
 Result TextureBuffer::uploadInternal(GLenum target,
                                      const TextureRangeDesc& range,
                                      const void* IGL_NULLABLE data,
@@ -503,9 +602,9 @@ bool TextureBuffer::canInitialize() const {
 }
 
 bool TextureBuffer::supportsTexStorage() const {
-  return (getUsage() & TextureDesc::TextureUsageBits::Storage) != 0 &&
-         contains(getContext().deviceFeatures().getTextureFormatCapabilities(getFormat()),
-                  ICapabilities::TextureFormatCapabilityBits::Storage);
+  // Decided once in createTexture(); uploads must match the allocation path since immutable
+  // storage only accepts texSubImage-style re-specification
+  return useTexStorage_;
 }
 
 } // namespace opengl
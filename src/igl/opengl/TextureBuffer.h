@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include <igl/opengl/TextureBufferBase.h>
 
 namespace igl {
@@ -59,7 +61,26 @@ class TextureBuffer : public TextureBufferBase {
   Result createTexture(const TextureDesc& desc);
   bool canInitialize() const;
   bool supportsTexStorage() const;
+  /// Returns true when an upload can be staged through a pixel unpack buffer instead of being
+  /// read synchronously from client memory.
+  [[nodiscard]] bool canUploadViaPbo(const TextureRangeDesc& range, size_t bytesPerRow) const;
+  /// Copies the texels into a fenced pixel unpack buffer and sources the texture update from it,
+  /// so glTexSubImage2D returns without waiting on the client memory copy.
+  Result uploadViaPbo(GLenum target,
+                      const TextureRangeDesc& range,
+                      const void* IGL_NONNULL data,
+                      size_t bytesPerRow) const;
   mutable uint64_t textureHandle_ = 0;
+  // whether the texture was allocated with immutable storage (glTexStorage2D/3D); decided once in
+  // createTexture so format selection and uploads agree on the allocation path
+  bool useTexStorage_ = false;
+  // small ring of pixel unpack buffers recycled across uploads; a fence per buffer defers reuse
+  // until the GPU has consumed its previous upload
+  mutable std::vector<GLuint> uploadPboIds_;
+  mutable std::vector<GLsync> uploadPboFences_;
+  mutable std::vector<size_t> uploadPboSizes_;
+  mutable size_t uploadPboIndex_ = 0;
+  static constexpr size_t kUploadPboCount = 3;
 };
 
 } // namespace opengl
@@ -5,6 +5,7 @@
  * LICENSE file in the root directory of this source tree.
  */
 
+#include <cstring>
 #include <igl/opengl/Buffer.h>
 #include <igl/opengl/UniformAdapter.h>
 #include <igl/opengl/UniformBuffer.h>
@@ -28,6 +29,7 @@ UniformAdapter::UniformAdapter(const IContext& context, PipelineType type) : pip
   }
 
   uniformBuffersDirtyMask_ = 0;
+  shadowSlots_.resize(maxUniforms_);
 #if IGL_DEBUG
   uniformsDirty_.resize(maxUniforms_);
 #endif
@@ -123,7 +125,14 @@ void UniformAdapter::setUniform(const UniformDesc& uniformDesc,
 #endif // IGL_DEBUG
 
   IGL_ASSERT(uniforms_.size() < maxUniforms_);
-  uniforms_.emplace_back(uniformDesc, dataOffset);
+  // append a POD record; steady state performs no allocation since the vector keeps its capacity
+  // and no string is copied
+  uniforms_.push_back(UniformState{uniformDesc.location,
+                                   uniformDesc.type,
+                                   uniformDesc.numElements,
+                                   uniformDesc.offset,
+                                   uniformDesc.elementStride,
+                                   dataOffset});
   Result::setOk(outResult);
 }
 
@@ -136,7 +145,7 @@ void UniformAdapter::setUniformBuffer(const std::shared_ptr<IBuffer>& buffer,
                  "Uniform buffer index is beyond max");
   IGL_ASSERT_MSG(buffer, "invalid buffer passed to setUniformBuffer");
   if (bindingIndex >= 0 && bindingIndex < IGL_UNIFORM_BLOCKS_BINDING_MAX && buffer) {
-    uniformBufferBindingMap_[bindingIndex] = {buffer, offset};
+    uniformBufferBindings_[bindingIndex] = {buffer, offset};
     uniformBuffersDirtyMask_ |= 1 << bindingIndex;
     Result::setOk(outResult);
   } else {
@@ -144,25 +153,52 @@ void UniformAdapter::setUniformBuffer(const std::shared_ptr<IBuffer>& buffer,
   }
 }
 
-void UniformAdapter::bindToPipeline(IContext& context) {
+void UniformAdapter::bindToPipeline(IContext& context, const void* pipelineStateKey) {
+  if (pipelineStateKey != lastPipelineStateKey_) {
+    // the shadowed values belong to another program and say nothing about this one. Bumping the
+    // generation invalidates every slot at once; the arena bytes are reclaimed wholesale
+    shadowGeneration_++;
+    shadowData_.clear();
+    lastPipelineStateKey_ = pipelineStateKey;
+  }
+
   // bind uniforms
   for (const auto& uniform : uniforms_) {
-    const auto& uniformDesc = uniform.desc;
-    IGL_ASSERT(uniformDesc.location >= 0);
+    IGL_ASSERT(uniform.location >= 0);
     IGL_ASSERT_MSG(uniformData_.data(), "Uniform data must be non-null");
     auto start = uniformData_.data() + uniform.dataOffset;
-    if (uniformDesc.numElements > 1 || uniformDesc.type == UniformType::Mat3x3) {
-      IGL_ASSERT_MSG(uniformDesc.elementStride > 0,
+    if (pipelineStateKey != nullptr) {
+      std::ptrdiff_t length = uniform.elementStride != 0 ? uniform.elementStride
+                                                         : igl::sizeForUniformType(uniform.type);
+      length *= uniform.numElements;
+      ShadowSlot& slot = shadowSlots_[uniform.location];
+      const bool slotValid =
+          slot.generation == shadowGeneration_ && slot.length == static_cast<uint32_t>(length);
+      if (slotValid && memcmp(shadowData_.data() + slot.offset, start, length) == 0) {
+        // unchanged since the last upload to this program; skip the GL call
+        continue;
+      }
+      if (slotValid) {
+        memcpy(shadowData_.data() + slot.offset, start, length);
+      } else {
+        slot = {shadowGeneration_,
+                static_cast<uint32_t>(shadowData_.size()),
+                static_cast<uint32_t>(length)};
+        shadowData_.insert(shadowData_.end(), start, start + length);
+      }
+    }
+    if (uniform.numElements > 1 || uniform.type == UniformType::Mat3x3) {
+      IGL_ASSERT_MSG(uniform.elementStride > 0,
                      "stride has to be larger than 0 for uniform at offset %zu",
-                     uniformDesc.offset);
+                     uniform.offset);
       UniformBuffer::bindUniformArray(context,
-                                      uniformDesc.location,
-                                      uniformDesc.type,
+                                      uniform.location,
+                                      uniform.type,
                                       start,
-                                      uniformDesc.numElements,
-                                      uniformDesc.elementStride);
+                                      uniform.numElements,
+                                      uniform.elementStride);
     } else {
-      UniformBuffer::bindUniform(context, uniformDesc.location, uniformDesc.type, start, 1);
+      UniformBuffer::bindUniform(context, uniform.location, uniform.type, start, 1);
     }
   }
   uniforms_.clear();
@@ -173,7 +209,7 @@ void UniformAdapter::bindToPipeline(IContext& context) {
   // bind uniform block buffers
   for (size_t bindingIndex = 0; bindingIndex < IGL_UNIFORM_BLOCKS_BINDING_MAX; ++bindingIndex) {
     if (uniformBuffersDirtyMask_ & (1 << bindingIndex)) {
-      auto uniformBinding = uniformBufferBindingMap_.at(bindingIndex);
+      const auto& uniformBinding = uniformBufferBindings_[bindingIndex];
       auto* bufferState = static_cast<UniformBlockBuffer*>(uniformBinding.first.get());
       IGL_ASSERT(bufferState);
       if (uniformBinding.second) {
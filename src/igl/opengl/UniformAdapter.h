@@ -11,7 +11,7 @@
 #include <igl/Uniform.h>
 
 #include <array>
-#include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace igl {
@@ -39,14 +39,21 @@ class UniformAdapter {
     return maxUniforms_;
   }
 
-  void bindToPipeline(IContext& context);
+  // Issues the queued uniforms for the pipeline identified by pipelineStateKey. Values that are
+  // unchanged since the last upload to the same pipeline are skipped; passing nullptr disables
+  // the redundancy check.
+  void bindToPipeline(IContext& context, const void* pipelineStateKey);
 
  private:
+  // POD record of one queued uniform. Only the fields the GL upload needs are mirrored from the
+  // UniformDesc; copying the desc itself would heap-allocate for its name string on every call,
+  // and the name is never needed at replay time.
   struct UniformState {
-    UniformState() = default;
-    UniformState(UniformDesc d, std::ptrdiff_t o) : desc(std::move(d)), dataOffset(o) {}
-
-    UniformDesc desc;
+    int location = -1;
+    UniformType type = UniformType::Invalid;
+    size_t numElements = 1;
+    size_t offset = 0;
+    size_t elementStride = 0;
     std::ptrdiff_t dataOffset = 0;
   };
 
@@ -54,12 +61,29 @@ class UniformAdapter {
   std::vector<uint8_t> uniformData_;
   uint32_t maxUniforms_ = 1024;
 
-  // map for uniform binding indices to the buffers
-  std::unordered_map<int, std::pair<std::shared_ptr<IBuffer>, size_t>> uniformBufferBindingMap_;
+  // uniform binding index -> (buffer, offset); entries are only read while their bit in
+  // uniformBuffersDirtyMask_ is set
+  std::array<std::pair<std::shared_ptr<IBuffer>, size_t>, IGL_UNIFORM_BLOCKS_BINDING_MAX>
+      uniformBufferBindings_;
   uint32_t uniformBuffersDirtyMask_ = 0;
   static_assert(sizeof(uniformBuffersDirtyMask_) * 8 >= IGL_UNIFORM_BLOCKS_BINDING_MAX,
                 "uniformBuffersDirtyMask size is not enough to fit the flags");
 
+  // Shadow copy of the last values uploaded per uniform location, valid for the pipeline
+  // identified by lastPipelineStateKey_. Uploads whose bytes match the shadow are skipped.
+  // Slots index into the shadowData_ arena and are invalidated wholesale by bumping the
+  // generation, so a pipeline switch performs no per-slot work and steady state allocates
+  // nothing per call.
+  struct ShadowSlot {
+    uint32_t generation = 0;
+    uint32_t offset = 0;
+    uint32_t length = 0;
+  };
+  std::vector<ShadowSlot> shadowSlots_;
+  std::vector<uint8_t> shadowData_;
+  uint32_t shadowGeneration_ = 1;
+  const void* lastPipelineStateKey_ = nullptr;
+
   // Store a copy of uniform data when setUniform is used to avoid the client from managing the
   // memory
   std::ptrdiff_t usedUniformDataBytes_ = 0;
@@ -14,6 +14,7 @@
 #include <igl/opengl/RenderCommandAdapter.h>
 
 #include <cassert>
+#include <cstring>
 #include <igl/Macros.h>
 #include <igl/opengl/Errors.h>
 #include <igl/opengl/GLIncludes.h>
@@ -22,6 +23,17 @@
 
 #define CHECK_EGL_ERRORS() error_checking::checkForEGLErrors(__FILE__, __FUNCTION__, __LINE__)
 
+// Not all EGL headers ship the extension attributes requested through ContextConfig
+#ifndef EGL_CONTEXT_PRIORITY_LEVEL_IMG
+#define EGL_CONTEXT_PRIORITY_LEVEL_IMG 0x3100
+#endif
+#ifndef EGL_CONTEXT_PRIORITY_HIGH_IMG
+#define EGL_CONTEXT_PRIORITY_HIGH_IMG 0x3101
+#endif
+#ifndef EGL_MUTABLE_RENDER_BUFFER_BIT_KHR
+#define EGL_MUTABLE_RENDER_BUFFER_BIT_KHR 0x1000
+#endif
+
 namespace error_checking {
 
 #define CASE_ERROR_CODE_IMPL(egl_error_code) \
@@ -109,9 +121,39 @@ EGLint contextAttribs[] = {
     EGL_NONE // Terminator
 };
 
+bool hasEGLExtension(EGLDisplay display, const char* name) {
+  const char* extensions = eglQueryString(display, EGL_EXTENSIONS);
+  return extensions != nullptr && strstr(extensions, name) != nullptr;
+}
+
+std::vector<EGLint> buildConfigAttribs(EGLDisplay display, const ContextConfig& contextConfig) {
+  std::vector<EGLint> result(std::begin(attribs), std::end(attribs));
+  if (contextConfig.mutableRenderBuffer &&
+      hasEGLExtension(display, "EGL_KHR_mutable_render_buffer")) {
+    for (size_t i = 0; i + 1 < result.size(); i += 2) {
+      if (result[i] == EGL_SURFACE_TYPE) {
+        result[i + 1] |= EGL_MUTABLE_RENDER_BUFFER_BIT_KHR;
+      }
+    }
+  }
+  return result;
+}
+
+std::vector<EGLint> buildContextAttribs(EGLDisplay display, const ContextConfig& contextConfig) {
+  std::vector<EGLint> result(std::begin(contextAttribs), std::end(contextAttribs));
+  result.pop_back(); // drop the terminator while appending
+  if (contextConfig.highPriorityContext && hasEGLExtension(display, "EGL_IMG_context_priority")) {
+    result.emplace_back(EGL_CONTEXT_PRIORITY_LEVEL_IMG);
+    result.emplace_back(EGL_CONTEXT_PRIORITY_HIGH_IMG);
+  }
+  result.emplace_back(EGL_NONE);
+  return result;
+}
+
 std::pair<EGLDisplay, EGLContext> newEGLContext(EGLDisplay display,
                                                 EGLContext shareContext,
-                                                EGLConfig* config) {
+                                                EGLConfig* config,
+                                                const ContextConfig& contextConfig) {
   if (display == EGL_NO_DISPLAY || !eglInitialize(display, nullptr, nullptr)) {
     CHECK_EGL_ERRORS();
     // TODO: Handle error
@@ -124,12 +166,14 @@ std::pair<EGLDisplay, EGLContext> newEGLContext(EGLDisplay display,
   }
 
   EGLint numConfigs;
-  if (!eglChooseConfig(display, attribs, config, 1, &numConfigs)) {
+  const auto configAttribs = buildConfigAttribs(display, contextConfig);
+  if (!eglChooseConfig(display, configAttribs.data(), config, 1, &numConfigs)) {
     CHECK_EGL_ERRORS();
   }
 
-  auto res =
-      std::make_pair(display, eglCreateContext(display, *config, shareContext, contextAttribs));
+  const auto newContextAttribs = buildContextAttribs(display, contextConfig);
+  auto res = std::make_pair(
+      display, eglCreateContext(display, *config, shareContext, newContextAttribs.data()));
   CHECK_EGL_ERRORS();
   return res;
 }
@@ -179,16 +223,17 @@ EGLConfig chooseConfig(EGLDisplay display) {
   return context;
 }
 
-Context::Context(RenderingAPI api, EGLNativeWindowType window) :
-  Context(api, EGL_NO_CONTEXT, nullptr, false, window, {0, 0}) {}
+Context::Context(RenderingAPI api, EGLNativeWindowType window, ContextConfig contextConfig) :
+  Context(api, EGL_NO_CONTEXT, nullptr, false, window, {0, 0}, contextConfig) {}
 
-Context::Context(RenderingAPI api, size_t width, size_t height) :
+Context::Context(RenderingAPI api, size_t width, size_t height, ContextConfig contextConfig) :
   Context(api,
           EGL_NO_CONTEXT,
           nullptr,
           true,
           IGL_EGL_NULL_WINDOW,
-          {static_cast<EGLint>(width), static_cast<EGLint>(height)}) {}
+          {static_cast<EGLint>(width), static_cast<EGLint>(height)},
+          contextConfig) {}
 
 Context::Context(const Context& sharedContext) :
   Context(sharedContext.api_,
@@ -196,16 +241,19 @@ Context::Context(const Context& sharedContext) :
           sharedContext.sharegroup_,
           true,
           IGL_EGL_NULL_WINDOW,
-          sharedContext.getDrawSurfaceDimensions(nullptr)) {}
+          sharedContext.getDrawSurfaceDimensions(nullptr),
+          {}) {}
 
 Context::Context(RenderingAPI api,
                  EGLContext shareContext,
                  std::shared_ptr<std::vector<EGLContext>> sharegroup,
                  bool offscreen,
                  EGLNativeWindowType window,
-                 std::pair<EGLint, EGLint> dimensions) {
+                 std::pair<EGLint, EGLint> dimensions,
+                 ContextConfig contextConfig) {
   EGLConfig config{nullptr};
-  auto contextDisplay = newEGLContext(getDefaultEGLDisplay(), shareContext, &config);
+  auto contextDisplay =
+      newEGLContext(getDefaultEGLDisplay(), shareContext, &config, contextConfig);
   IGL_ASSERT_MSG(contextDisplay.second != EGL_NO_CONTEXT, "newEGLContext failed");
 
   contextOwned_ = true;
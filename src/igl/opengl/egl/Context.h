@@ -22,6 +22,17 @@ class ITexture;
 namespace opengl {
 namespace egl {
 
+/// Optional EGL features requested at context creation. Each feature is best-effort: when the
+/// display does not advertise the backing extension the default attributes are used instead.
+struct ContextConfig {
+  /// Requests EGL_CONTEXT_PRIORITY_HIGH_IMG (EGL_IMG_context_priority) so the GPU scheduler
+  /// favors this context's work; intended for latency-critical layers.
+  bool highPriorityContext = false;
+  /// Requests a config whose surfaces support EGL_KHR_mutable_render_buffer, allowing
+  /// single-buffered (direct-to-front) rendering to be toggled on the swapchain surface.
+  bool mutableRenderBuffer = false;
+};
+
 class Context final : public IContext {
  public:
   /// Creates a shared context, with matching format based on an existing context.
@@ -36,9 +47,9 @@ class Context final : public IContext {
 
   /// Create a new context for default display. This constructor makes the assumption that the EGL
   /// surfaces to be associated with this context are already present and set to current.
-  Context(RenderingAPI api, EGLNativeWindowType window);
+  Context(RenderingAPI api, EGLNativeWindowType window, ContextConfig contextConfig = {});
   /// Create a new offscreen context.
-  Context(RenderingAPI api, size_t width, size_t height);
+  Context(RenderingAPI api, size_t width, size_t height, ContextConfig contextConfig = {});
   /// Create a new context applicable for a specific display/context/read surface/draw surface.
   Context(EGLDisplay display,
           EGLContext context,
@@ -82,7 +93,8 @@ class Context final : public IContext {
           std::shared_ptr<std::vector<EGLContext>> sharegroup,
           bool offscreen,
           EGLNativeWindowType window,
-          std::pair<EGLint, EGLint> dimensions);
+          std::pair<EGLint, EGLint> dimensions,
+          ContextConfig contextConfig);
 
   bool contextOwned_ = false;
   FOLLY_PUSH_WARNING
@@ -22,6 +22,14 @@ std::unique_ptr<IContext> HWDevice::createContext(RenderingAPI api,
   return std::make_unique<Context>(api, nativeWindow);
 }
 
+std::unique_ptr<IContext> HWDevice::createContext(RenderingAPI api,
+                                                  EGLNativeWindowType nativeWindow,
+                                                  ContextConfig contextConfig,
+                                                  Result* outResult) const {
+  Result::setOk(outResult);
+  return std::make_unique<Context>(api, nativeWindow, contextConfig);
+}
+
 std::unique_ptr<IContext> HWDevice::createOffscreenContext(RenderingAPI api,
                                                            size_t width,
                                                            size_t height,
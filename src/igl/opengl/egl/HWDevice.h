@@ -8,6 +8,7 @@
 #pragma once
 
 #include <igl/opengl/HWDevice.h>
+#include <igl/opengl/egl/Context.h>
 
 namespace igl {
 namespace opengl {
@@ -22,6 +23,15 @@ class HWDevice final : public ::igl::opengl::HWDevice {
                                           EGLNativeWindowType nativeWindow,
                                           Result* outResult) const override;
 
+  /**
+   * @brief Creates a context with additional EGL features (context priority, mutable render
+   * buffer) requested best-effort through ContextConfig.
+   */
+  std::unique_ptr<IContext> createContext(RenderingAPI api,
+                                          EGLNativeWindowType nativeWindow,
+                                          ContextConfig contextConfig,
+                                          Result* outResult) const;
+
   /**
    * @brief Creates an offscreen context suitable for unit testing.
    */
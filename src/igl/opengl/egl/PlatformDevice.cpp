@@ -11,6 +11,7 @@
 #include <igl/opengl/egl/Device.h>
 #include <igl/opengl/egl/PlatformDevice.h>
 #if IGL_PLATFORM_ANDROID && __ANDROID_MIN_SDK_VERSION__ >= 26
+#include <android/hardware_buffer.h>
 #include <igl/opengl/egl/android/NativeHWBuffer.h>
 #endif
 #include <sstream>
@@ -172,6 +173,38 @@ std::shared_ptr<ITexture> PlatformDevice::createTextureWithSharedMemory(const Te
 
   return texture;
 }
+
+std::shared_ptr<ITexture> PlatformDevice::createTextureFromHardwareBuffer(AHardwareBuffer* buffer,
+                                                                          int acquireFenceFd,
+                                                                          Result* outResult) {
+  auto context = static_cast<Context*>(getSharedContext().get());
+  if (context == nullptr) {
+    Result::setResult(outResult, Result::Code::InvalidOperation, "No EGL context found!");
+    return nullptr;
+  }
+
+  AHardwareBuffer_Desc hwbDesc = {};
+  AHardwareBuffer_describe(buffer, &hwbDesc);
+  const auto format = android::NativeHWTextureBuffer::hwBufferFormatToTextureFormat(hwbDesc.format);
+  if (format == TextureFormat::Invalid) {
+    Result::setResult(
+        outResult, Result::Code::ArgumentInvalid, "Unsupported AHardwareBuffer format");
+    return nullptr;
+  }
+
+  auto texture = std::make_shared<android::NativeHWTextureBuffer>(getContext(), format);
+  const Result subResult = texture->createWithHWBuffer(buffer, acquireFenceFd);
+  Result::setResult(outResult, subResult.code, subResult.message);
+  if (!subResult.isOk()) {
+    return nullptr;
+  }
+
+  if (auto resourceTracker = owner_.getResourceTracker()) {
+    texture->initResourceTracker(resourceTracker);
+  }
+
+  return texture;
+}
 #endif
 
 void PlatformDevice::updateSurfaces(EGLSurface readSurface,
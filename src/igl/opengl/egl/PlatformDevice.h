@@ -46,6 +46,13 @@ class PlatformDevice : public opengl::PlatformDevice {
   std::shared_ptr<ITexture> createTextureWithSharedMemory(const TextureDesc& desc,
                                                           Result* outResult);
 
+  /// Wraps an externally produced AHardwareBuffer (camera or video frame) as a sampleable
+  /// texture without copying it. When acquireFenceFd is >= 0 the GPU waits for the producer's
+  /// fence before reading; ownership of the fd passes to EGL.
+  std::shared_ptr<ITexture> createTextureFromHardwareBuffer(struct AHardwareBuffer* buffer,
+                                                            int acquireFenceFd,
+                                                            Result* outResult);
+
 #endif
 
   /// This function must be called every time the currently bound EGL read and/or draw surfaces
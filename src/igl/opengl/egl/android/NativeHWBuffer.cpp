@@ -162,65 +162,125 @@ Result NativeHWTextureBuffer::createHWBuffer(const TextureDesc& desc,
       return Result{Result::Code::RuntimeError, "AHardwareBuffer allocation failed"};
     }
 
-    EGLClientBuffer clientBuffer = eglGetNativeClientBufferANDROID(hwBuffer_);
-    EGLint attribs[] = {EGL_IMAGE_PRESERVED_KHR, EGL_TRUE, EGL_NONE, EGL_NONE, EGL_NONE};
+    return attachHWBuffer();
+  }
+  return Result{Result::Code::RuntimeError,
+                "Could not create hardware texture, texture desc is not valid"};
+}
 
-    EGLDisplay display = ((egl::Context*)&getContext())->getDisplay();
-    // eglCreateImageKHR will add a ref to the AHardwareBuffer
-    EGLImageKHR eglImage = eglCreateImageKHR(
-        display, EGL_NO_CONTEXT, EGL_NATIVE_BUFFER_ANDROID, clientBuffer, attribs);
-    APILOG("eglCreateImageKHR(%p, %x, %x, %p, {%d, %d, %d, %d, %d})\n",
-           display,
-           EGL_NO_CONTEXT,
-           EGL_NATIVE_BUFFER_ANDROID,
-           clientBuffer,
-           attribs[0],
-           attribs[1],
-           attribs[2],
-           attribs[3],
-           attribs[4]);
-
-    if (EGL_NO_IMAGE_KHR == eglImage) {
-      return Result{Result::Code::RuntimeError, "Could not create EGL image, err"};
-    }
-    getContext().checkForErrors(__FUNCTION__, __LINE__);
+Result NativeHWTextureBuffer::createWithHWBuffer(AHardwareBuffer* IGL_NONNULL buffer,
+                                                 int acquireFenceFd) {
+  if (getTextureId() != 0) {
+    return Result{Result::Code::RuntimeError, "NativeHWTextureBuffer alreayd created"};
+  }
+  if (buffer == nullptr) {
+    return Result{Result::Code::ArgumentNull, "AHardwareBuffer is null"};
+  }
 
-    IGL_REPORT_ERROR(getContext().isCurrentContext() || getContext().isCurrentSharegroup());
+  AHardwareBuffer_Desc hwbDesc = {};
+  AHardwareBuffer_describe(buffer, &hwbDesc);
+  if (hwbDesc.layers != 1 || hwBufferFormatToTextureFormat(hwbDesc.format) != getFormat()) {
+    return Result{Result::Code::ArgumentInvalid,
+                  "AHardwareBuffer layout does not match the texture format"};
+  }
 
-    GLuint tid = 0;
-    getContext().genTextures(1, &tid);
-    if (!tid) {
-      eglDestroyImageKHR(display, eglImage);
-      return Result{Result::Code::RuntimeError,
-                    "NativeHWTextureBuffer failes to generate GL texture ID"};
-    }
+  TextureDesc desc = {};
+  desc.width = hwbDesc.width;
+  desc.height = hwbDesc.height;
+  desc.depth = 1;
+  desc.numLayers = 1;
+  desc.numSamples = 1;
+  desc.usage = TextureDesc::TextureUsageBits::Sampled;
+  desc.numMipLevels = 1;
+  desc.type = TextureType::TwoD;
+  desc.format = getFormat();
+  desc.storage = ResourceStorage::Shared;
+  auto result = Super::create(desc, false);
+  if (!result.isOk()) {
+    return result;
+  }
+
+  // the texture owns a reference for its lifetime; the producer can release its own
+  AHardwareBuffer_acquire(buffer);
+  hwBuffer_ = buffer;
 
-    setTextureBufferProperties(tid, GL_TEXTURE_2D);
-    getContext().bindTexture(getTarget(), getId());
+  result = attachHWBuffer();
+  if (!result.isOk()) {
+    return result;
+  }
 
-    if (getContext().checkForErrors(__FUNCTION__, __LINE__) != GL_NO_ERROR) {
-      getContext().deleteTextures({getId()});
-      eglDestroyImageKHR(display, eglImage);
-      return Result{Result::Code::RuntimeError,
-                    "NativeHWTextureBuffer GL error during bindTexture"};
+  if (acquireFenceFd >= 0) {
+    // insert a server-side wait so the GPU does not sample the image before the producer's
+    // fence signals; eglCreateSyncKHR takes ownership of the fd
+    EGLDisplay display = ((egl::Context*)&getContext())->getDisplay();
+    const EGLint syncAttribs[] = {EGL_SYNC_NATIVE_FENCE_FD_ANDROID, acquireFenceFd, EGL_NONE};
+    EGLSyncKHR sync = eglCreateSyncKHR(display, EGL_SYNC_NATIVE_FENCE_ANDROID, syncAttribs);
+    if (sync != EGL_NO_SYNC_KHR) {
+      eglWaitSyncKHR(display, sync, 0);
+      eglDestroySyncKHR(display, sync);
+    } else {
+      IGL_REPORT_ERROR_MSG(false, "Failed to import the acquire fence for an AHardwareBuffer");
     }
+  }
+
+  return Result{};
+}
 
-    glEGLImageTargetTexture2DOES(getTarget(), static_cast<GLeglImageOES>(eglImage));
-    APILOG("glEGLImageTargetTexture2DOES(%u, %#x)\n",
-           GL_TEXTURE_2D,
-           static_cast<GLeglImageOES>(eglImage));
+Result NativeHWTextureBuffer::attachHWBuffer() {
+  EGLClientBuffer clientBuffer = eglGetNativeClientBufferANDROID(hwBuffer_);
+  EGLint attribs[] = {EGL_IMAGE_PRESERVED_KHR, EGL_TRUE, EGL_NONE, EGL_NONE, EGL_NONE};
+
+  EGLDisplay display = ((egl::Context*)&getContext())->getDisplay();
+  // eglCreateImageKHR will add a ref to the AHardwareBuffer
+  EGLImageKHR eglImage =
+      eglCreateImageKHR(display, EGL_NO_CONTEXT, EGL_NATIVE_BUFFER_ANDROID, clientBuffer, attribs);
+  APILOG("eglCreateImageKHR(%p, %x, %x, %p, {%d, %d, %d, %d, %d})\n",
+         display,
+         EGL_NO_CONTEXT,
+         EGL_NATIVE_BUFFER_ANDROID,
+         clientBuffer,
+         attribs[0],
+         attribs[1],
+         attribs[2],
+         attribs[3],
+         attribs[4]);
+
+  if (EGL_NO_IMAGE_KHR == eglImage) {
+    return Result{Result::Code::RuntimeError, "Could not create EGL image, err"};
+  }
+  getContext().checkForErrors(__FUNCTION__, __LINE__);
 
-    getContext().checkForErrors(__FUNCTION__, __LINE__);
+  IGL_REPORT_ERROR(getContext().isCurrentContext() || getContext().isCurrentSharegroup());
 
-    std::shared_ptr<AHardwareBufferContext> hwBufferCtx =
-        std::make_shared<AHardwareBufferContext>();
-    hwBufferCtx->display = display;
-    hwBufferCtx->elgImage = eglImage;
-    hwBufferHelper_ = std::static_pointer_cast<AHardwareBufferHelper>(hwBufferCtx);
-    return Result{};
+  GLuint tid = 0;
+  getContext().genTextures(1, &tid);
+  if (!tid) {
+    eglDestroyImageKHR(display, eglImage);
+    return Result{Result::Code::RuntimeError,
+                  "NativeHWTextureBuffer failes to generate GL texture ID"};
   }
-  return Result{Result::Code::RuntimeError,
-                "Could not create hardware texture, texture desc is not valid"};
+
+  setTextureBufferProperties(tid, GL_TEXTURE_2D);
+  getContext().bindTexture(getTarget(), getId());
+
+  if (getContext().checkForErrors(__FUNCTION__, __LINE__) != GL_NO_ERROR) {
+    getContext().deleteTextures({getId()});
+    eglDestroyImageKHR(display, eglImage);
+    return Result{Result::Code::RuntimeError, "NativeHWTextureBuffer GL error during bindTexture"};
+  }
+
+  glEGLImageTargetTexture2DOES(getTarget(), static_cast<GLeglImageOES>(eglImage));
+  APILOG("glEGLImageTargetTexture2DOES(%u, %#x)\n",
+         GL_TEXTURE_2D,
+         static_cast<GLeglImageOES>(eglImage));
+
+  getContext().checkForErrors(__FUNCTION__, __LINE__);
+
+  std::shared_ptr<AHardwareBufferContext> hwBufferCtx = std::make_shared<AHardwareBufferContext>();
+  hwBufferCtx->display = display;
+  hwBufferCtx->elgImage = eglImage;
+  hwBufferHelper_ = std::static_pointer_cast<AHardwareBufferHelper>(hwBufferCtx);
+  return Result{};
 }
 
 void NativeHWTextureBuffer::bind() {
@@ -308,6 +368,43 @@ bool NativeHWTextureBuffer::isValidFormat(TextureFormat format) {
   return toNativeHWFormat(format) > 0;
 }
 
+TextureFormat NativeHWTextureBuffer::hwBufferFormatToTextureFormat(uint32_t nativeFormat) {
+  switch (nativeFormat) {
+  case AHARDWAREBUFFER_FORMAT_R8G8B8_UNORM:
+    return TextureFormat::RGBX_UNorm8;
+
+  case AHARDWAREBUFFER_FORMAT_R8G8B8A8_UNORM:
+    return TextureFormat::RGBA_UNorm8;
+
+  case AHARDWAREBUFFER_FORMAT_R5G6B5_UNORM:
+    return TextureFormat::B5G6R5_UNorm;
+
+  case AHARDWAREBUFFER_FORMAT_R16G16B16A16_FLOAT:
+    return TextureFormat::RGBA_F16;
+
+  case AHARDWAREBUFFER_FORMAT_R10G10B10A2_UNORM:
+    return TextureFormat::RGB10_A2_UNorm_Rev;
+
+  case AHARDWAREBUFFER_FORMAT_D16_UNORM:
+    return TextureFormat::Z_UNorm16;
+
+  case AHARDWAREBUFFER_FORMAT_D24_UNORM:
+    return TextureFormat::Z_UNorm24;
+
+  case AHARDWAREBUFFER_FORMAT_D32_FLOAT:
+    return TextureFormat::Z_UNorm32;
+
+  case AHARDWAREBUFFER_FORMAT_D24_UNORM_S8_UINT:
+    return TextureFormat::S8_UInt_Z24_UNorm;
+
+  case AHARDWAREBUFFER_FORMAT_S8_UINT:
+    return TextureFormat::S_UInt8;
+
+  default:
+    return TextureFormat::Invalid;
+  }
+}
+
 } // namespace igl::opengl::egl::android
 
 #endif
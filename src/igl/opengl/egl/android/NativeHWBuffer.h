@@ -32,6 +32,11 @@ class NativeHWTextureBuffer : public TextureBufferBase {
   // Texture overrides
   Result create(const TextureDesc& desc, bool hasStorageAlready) override;
   Result createHWBuffer(const TextureDesc& desc, bool hasStorageAlready, bool surfaceComposite);
+  /// Wraps an externally produced AHardwareBuffer (e.g. a camera or video frame) without copying
+  /// its contents. The buffer is acquired for the lifetime of the texture. When acquireFenceFd is
+  /// >= 0 the GPU waits for the producer's fence before reading the image; ownership of the fd
+  /// passes to EGL.
+  Result createWithHWBuffer(AHardwareBuffer* IGL_NONNULL buffer, int acquireFenceFd = -1);
   void bind() override;
   void bindImage(size_t unit) override;
   Result lockHWBuffer(std::byte* IGL_NULLABLE* IGL_NONNULL dst, RangeDesc& outRange) const;
@@ -42,7 +47,14 @@ class NativeHWTextureBuffer : public TextureBufferBase {
 
   static bool isValidFormat(TextureFormat format);
 
+  /// Maps an AHardwareBuffer pixel format to the matching TextureFormat, or
+  /// TextureFormat::Invalid when the format cannot be sampled through this wrapper.
+  static TextureFormat hwBufferFormatToTextureFormat(uint32_t nativeFormat);
+
  private:
+  /// Creates the EGLImage for hwBuffer_ and binds it to a freshly generated GL texture.
+  Result attachHWBuffer();
+
   Result uploadInternal(TextureType type,
                         const TextureRangeDesc& range,
                         const void* IGL_NULLABLE data,
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <igl/IGL.h>
+
+namespace igl {
+namespace tests {
+
+namespace {
+
+int reportedErrorCount = 0;
+
+#if IGL_REPORT_ERROR_ENABLED
+void countingErrorHandler(const char* /*file*/,
+                          const char* /*func*/,
+                          int /*line*/,
+                          const char* /*category*/,
+                          const char* /*format*/,
+                          ...) {
+  reportedErrorCount++;
+}
+#endif // IGL_REPORT_ERROR_ENABLED
+
+} // namespace
+
+//
+// AssertTest
+//
+// Tests for the tiered validation contracts in Assert.h. The expectations are tier-aware: the
+// build's IGL_VALIDATION_LEVEL decides whether the hot-path contracts check, and whether sampled
+// validation checks every call, once per sample period, or never.
+//
+class AssertTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    setDebugBreakEnabled(false);
+
+    reportedErrorCount = 0;
+#if IGL_REPORT_ERROR_ENABLED
+    savedHandler_ = IGLReportErrorGetHandler();
+    IGLReportErrorSetHandler(countingErrorHandler);
+#endif // IGL_REPORT_ERROR_ENABLED
+  }
+
+  void TearDown() override {
+#if IGL_REPORT_ERROR_ENABLED
+    IGLReportErrorSetHandler(savedHandler_);
+#endif // IGL_REPORT_ERROR_ENABLED
+  }
+
+#if IGL_REPORT_ERROR_ENABLED
+  IGLReportErrorFunc savedHandler_ = nullptr;
+#endif // IGL_REPORT_ERROR_ENABLED
+};
+
+//
+// VerifyHotPassesThrough
+//
+// At the full tier IGL_VERIFY_HOT behaves like IGL_VERIFY; below it the check folds to `true`
+// so the failure branch at the call site is compiled out.
+//
+TEST_F(AssertTest, VerifyHotPassesThrough) {
+  ASSERT_TRUE(IGL_VERIFY_HOT(true));
+#if IGL_VALIDATION_LEVEL >= 2
+  ASSERT_FALSE(IGL_VERIFY_HOT(false));
+#else
+  ASSERT_TRUE(IGL_VERIFY_HOT(false));
+#endif // IGL_VALIDATION_LEVEL >= 2
+}
+
+//
+// AssertHotDoesNotEvaluateBelowFullTier
+//
+// Hot-path contracts must be side-effect free because the condition is not evaluated at all
+// below the full tier.
+//
+TEST_F(AssertTest, AssertHotDoesNotEvaluateBelowFullTier) {
+  int evaluations = 0;
+  IGL_ASSERT_HOT([&evaluations] {
+    evaluations++;
+    return true;
+  }());
+#if IGL_VALIDATION_LEVEL >= 2
+  ASSERT_EQ(evaluations, 1);
+#else
+  ASSERT_EQ(evaluations, 0);
+#endif // IGL_VALIDATION_LEVEL >= 2
+}
+
+//
+// SampledValidationNeverReportsSuccess
+//
+// A passing condition never reaches the report handler, whatever the tier.
+//
+TEST_F(AssertTest, SampledValidationNeverReportsSuccess) {
+  for (int i = 0; i < IGL_VALIDATION_SAMPLE_PERIOD * 2; ++i) {
+    IGL_ASSERT_SAMPLED(true, "should never be reported");
+  }
+  ASSERT_EQ(reportedErrorCount, 0);
+}
+
+//
+// SampledValidationReportsMisuse
+//
+// A failing condition reaches the report handler on every call at the full tier and once per
+// IGL_VALIDATION_SAMPLE_PERIOD calls at the boundary tier, so production telemetry still sees
+// hot-path misuse.
+//
+TEST_F(AssertTest, SampledValidationReportsMisuse) {
+#if !IGL_REPORT_ERROR_ENABLED
+  GTEST_SKIP() << "IGL_REPORT_ERROR is compiled out in this build";
+#else
+  // the full tier checks (and logs) every call, so keep the loop short there
+  constexpr int kNumCalls = IGL_VALIDATION_LEVEL >= 2 ? 4 : IGL_VALIDATION_SAMPLE_PERIOD * 2;
+  for (int i = 0; i < kNumCalls; ++i) {
+    IGL_ASSERT_SAMPLED(false, "sampled misuse %d", i);
+  }
+#if IGL_VALIDATION_LEVEL >= 2
+  ASSERT_EQ(reportedErrorCount, kNumCalls);
+#elif IGL_VALIDATION_LEVEL == 1
+  // the first call of each sample period window reports
+  ASSERT_EQ(reportedErrorCount, 2);
+#else
+  ASSERT_EQ(reportedErrorCount, 0);
+#endif // IGL_VALIDATION_LEVEL >= 2
+#endif // !IGL_REPORT_ERROR_ENABLED
+}
+
+} // namespace tests
+} // namespace igl
@@ -54,5 +54,25 @@ TEST_F(CommandBufferTest, pushPopDebugGroupLabel) {
   cmdBuf_->popDebugGroupLabel();
 }
 
+//
+// Check that released command buffers are recycled by the queue (wrapper pooling), so the
+// steady-state frame loop performs no heap allocations for command buffers, and that recycled
+// instances come back with cleared statistics.
+//
+TEST_F(CommandBufferTest, recyclesReleasedCommandBuffers) {
+  cmdBuf_->incrementCurrentDrawCount();
+  cmdQueue_->submit(*cmdBuf_);
+
+  ICommandBuffer* const first = cmdBuf_.get();
+  cmdBuf_ = nullptr; // return the wrapper to the queue's pool
+
+  igl::Result result;
+  auto recycled = cmdQueue_->createCommandBuffer(CommandBufferDesc(), &result);
+  ASSERT_EQ(result.code, Result::Code::Ok);
+  ASSERT_TRUE(recycled != nullptr);
+  ASSERT_EQ(recycled.get(), first);
+  ASSERT_EQ(recycled->getCurrentDrawCount(), 0u);
+}
+
 } // namespace tests
 } // namespace igl
@@ -176,6 +176,46 @@ TEST_F(DeviceTest, LastDrawStat) {
   ASSERT_EQ(drawCount, 1);
 }
 
+//
+// Command Buffer Statistics
+//
+// Check that the encoders accumulate usage counters into the command buffer and that the
+// primitive estimation helper is correct.
+//
+TEST_F(DeviceTest, CommandBufferStatistics) {
+  ASSERT_EQ(estimatedPrimitiveCount(PrimitiveType::Point, 5), 5);
+  ASSERT_EQ(estimatedPrimitiveCount(PrimitiveType::Line, 6), 3);
+  ASSERT_EQ(estimatedPrimitiveCount(PrimitiveType::LineStrip, 6), 5);
+  ASSERT_EQ(estimatedPrimitiveCount(PrimitiveType::LineStrip, 0), 0);
+  ASSERT_EQ(estimatedPrimitiveCount(PrimitiveType::Triangle, 6), 2);
+  ASSERT_EQ(estimatedPrimitiveCount(PrimitiveType::TriangleStrip, 6), 4);
+  ASSERT_EQ(estimatedPrimitiveCount(PrimitiveType::TriangleStrip, 1), 0);
+
+  Result ret;
+  std::shared_ptr<IRenderPipelineState> pipelineState;
+
+  cmdBuf_ = cmdQueue_->createCommandBuffer(cbDesc_, &ret);
+  ASSERT_TRUE(ret.isOk());
+  ASSERT_TRUE(cmdBuf_ != nullptr);
+
+  pipelineState = iglDev_->createRenderPipeline(renderPipelineDesc_, &ret);
+  ASSERT_TRUE(ret.isOk());
+  ASSERT_TRUE(pipelineState != nullptr);
+
+  renderPass_.colorAttachments[0].clearColor = {0, 0, 0, 0};
+
+  auto cmds = cmdBuf_->createRenderCommandEncoder(renderPass_, framebuffer_);
+  cmds->bindRenderPipelineState(pipelineState);
+  cmds->drawIndexed(PrimitiveType::Triangle, 0, IndexFormat::UInt16, *ib_, 0); // draw 0 indices
+  cmds->endEncoding();
+  cmdQueue_->submit(*cmdBuf_);
+
+  const CommandBufferStatistics& stats = cmdBuf_->getStatistics();
+  ASSERT_EQ(stats.pipelineBindCount, 1);
+  ASSERT_EQ(stats.dispatchCount, 0);
+  ASSERT_EQ(stats.estimatedPrimitiveCount, 0); // the dummy draw had no indices
+}
+
 //
 // In Development Feature API Test
 //
@@ -191,6 +231,44 @@ TEST_F(DeviceTest, InDevelopmentFeature) {
   ASSERT_TRUE(iglDev_->testDevelopmentFlags(igl::InDevelopementFeatures::DummyFeatureExample) == 0);
 }
 
+//
+// Bulk Resource Creation
+//
+// Verify that createBuffers()/createTextures() create one resource per desc,
+// keep the results aligned with the input array, and report success.
+//
+TEST_F(DeviceTest, BulkCreateBuffersAndTextures) {
+  Result ret;
+
+  const float kVertexData[4] = {0.0f, 1.0f, 2.0f, 3.0f};
+  const uint16_t kIndexData[4] = {0, 1, 2, 3};
+  const BufferDesc bufferDescs[] = {
+      BufferDesc(BufferDesc::BufferTypeBits::Vertex, kVertexData, sizeof(kVertexData)),
+      BufferDesc(BufferDesc::BufferTypeBits::Index, kIndexData, sizeof(kIndexData)),
+  };
+
+  const auto buffers = iglDev_->createBuffers(bufferDescs, 2, &ret);
+  ASSERT_EQ(ret.code, Result::Code::Ok);
+  ASSERT_EQ(buffers.size(), 2u);
+  for (const auto& buffer : buffers) {
+    ASSERT_TRUE(buffer != nullptr);
+  }
+
+  const TextureDesc textureDescs[] = {
+      TextureDesc::new2D(
+          TextureFormat::RGBA_UNorm8, 4, 4, TextureDesc::TextureUsageBits::Sampled),
+      TextureDesc::new2D(
+          TextureFormat::RGBA_UNorm8, 2, 2, TextureDesc::TextureUsageBits::Sampled),
+  };
+
+  const auto textures = iglDev_->createTextures(textureDescs, 2, &ret);
+  ASSERT_EQ(ret.code, Result::Code::Ok);
+  ASSERT_EQ(textures.size(), 2u);
+  for (const auto& texture : textures) {
+    ASSERT_TRUE(texture != nullptr);
+  }
+}
+
 //
 // Get Backend Type
 //
@@ -288,5 +288,40 @@ TEST_F(DeviceFeatureSetTest, getTextureFormatCapabilities) {
   EXPECT_TRUE(contains(capability, ICapabilities::TextureFormatCapabilityBits::Sampled));
 }
 
+//
+// capabilityCacheRoundtrip
+//
+// A feature set restored from a serialized capability blob must answer every DeviceFeatures
+// query the same way as the probed one, and a blob recorded for a different GL version must be
+// rejected. This backs the on-disk capability cache (IContext::setCapabilityCacheFilePath()).
+//
+TEST_F(DeviceFeatureSetTest, capabilityCacheRoundtrip) {
+  if (iglDev_->getBackendType() != igl::BackendType::OpenGL) {
+    GTEST_SKIP() << "The capability cache is OpenGL-only";
+  }
+#if IGL_BACKEND_OPENGL
+  auto& context = iglDev_->getPlatformDevice<igl::opengl::PlatformDevice>()->getContext();
+  const auto& deviceFeatures = context.deviceFeatures();
+
+  const std::string blob = deviceFeatures.serializeCapabilities();
+  ASSERT_FALSE(blob.empty());
+
+  igl::opengl::DeviceFeatureSet restored(context);
+  restored.initializeVersion(deviceFeatures.getGLVersion());
+  ASSERT_TRUE(restored.restoreCapabilities(blob));
+
+  for (uint64_t i = 0; i <= static_cast<uint64_t>(DeviceFeatures::ValidationLayersEnabled); ++i) {
+    const auto feature = static_cast<DeviceFeatures>(i);
+    EXPECT_EQ(restored.hasFeature(feature), deviceFeatures.hasFeature(feature));
+  }
+
+  igl::opengl::DeviceFeatureSet differentVersion(context);
+  differentVersion.initializeVersion(igl::opengl::GLVersion::NotAvailable);
+  EXPECT_FALSE(differentVersion.restoreCapabilities(blob));
+
+  EXPECT_FALSE(restored.restoreCapabilities("IGLCapabilityCache 0 garbage"));
+#endif // IGL_BACKEND_OPENGL
+}
+
 } // namespace tests
 } // namespace igl
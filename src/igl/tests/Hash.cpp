@@ -86,6 +86,40 @@ TEST_F(HashTest, GraphicsPipeline1) {
   descTwo.shaderStages = descOne.shaderStages;
 }
 
+//
+// GraphicsPipelinePrecomputedHash
+//
+// A precomputed hash matches the on-the-fly hash, survives copies, goes stale
+// on mutation until invalidated, and feeds the equality fast path.
+//
+TEST_F(HashTest, GraphicsPipelinePrecomputedHash) {
+  RenderPipelineDesc desc;
+  desc.cullMode = igl::CullMode::Front;
+  desc.fragmentUnitSamplerMap[0] = IGL_NAMEHANDLE("inputImage");
+
+  const size_t onTheFly = std::hash<RenderPipelineDesc>()(desc);
+  desc.precomputeHash();
+  ASSERT_EQ(std::hash<RenderPipelineDesc>()(desc), onTheFly);
+
+  // copies inherit the cached hash
+  const RenderPipelineDesc copy = desc;
+  ASSERT_EQ(std::hash<RenderPipelineDesc>()(copy), onTheFly);
+  ASSERT_TRUE(desc == copy);
+
+  // the cached hash is not tracked through member writes...
+  desc.cullMode = igl::CullMode::Back;
+  ASSERT_EQ(std::hash<RenderPipelineDesc>()(desc), onTheFly);
+
+  // ...until it is invalidated or recomputed
+  desc.invalidateHash();
+  ASSERT_NE(std::hash<RenderPipelineDesc>()(desc), onTheFly);
+  desc.precomputeHash();
+  ASSERT_NE(std::hash<RenderPipelineDesc>()(desc), onTheFly);
+
+  // two descs with differing cached hashes compare unequal via the fast path
+  ASSERT_FALSE(desc == copy);
+}
+
 //
 // RenderPipelineDesc2
 //
@@ -104,9 +138,9 @@ TEST_F(HashTest, GraphicsPipeline2) {
     return;
   }
 
-  // 56 is the size without unitSamplerMaps, colorAttachments, and debugName as those fields may
-  // vary between compilers and machines
-  size_t expectedSize = 56 + 2 * sizeof(std::unordered_map<size_t, std::string>) +
+  // 72 is the size without unitSamplerMaps, colorAttachments, and debugName as those fields may
+  // vary between compilers and machines; it includes the 16 bytes of the cached hash fields
+  size_t expectedSize = 72 + 2 * sizeof(std::unordered_map<size_t, std::string>) +
                         sizeof(std::unordered_map<size_t, igl::NameHandle>) +
                         sizeof(std::vector<RenderPipelineDesc::TargetDesc::ColorAttachment>) +
                         sizeof(igl::NameHandle);
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <igl/PipelineUsageRecorder.h>
+
+namespace igl {
+namespace tests {
+
+//
+// PipelineUsageRecorderTest
+//
+// Covers the device-independent pieces: recording/dedup, manifest serialization and the
+// rejection paths of deserialize(). Replay through a device is exercised by the backends.
+//
+class PipelineUsageRecorderTest : public ::testing::Test {};
+
+// Recording the same descriptor twice must produce a single manifest entry, and distinct
+// descriptors must keep their first-use order
+TEST_F(PipelineUsageRecorderTest, RecordDeduplicatesAndKeepsOrder) {
+  PipelineUsageRecorder recorder;
+
+  RenderPipelineDesc descA;
+  descA.sampleCount = 1;
+  RenderPipelineDesc descB;
+  descB.sampleCount = 4;
+
+  recorder.record(descA);
+  recorder.record(descB);
+  recorder.record(descA);
+
+  const auto manifest = recorder.buildManifest();
+  ASSERT_EQ(manifest.hashes.size(), 2);
+  ASSERT_EQ(manifest.hashes[0], std::hash<RenderPipelineDesc>()(descA));
+  ASSERT_EQ(manifest.hashes[1], std::hash<RenderPipelineDesc>()(descB));
+}
+
+TEST_F(PipelineUsageRecorderTest, SerializeRoundTrip) {
+  PipelineUsageManifest manifest;
+  manifest.hashes = {1u, 0xffffffffffffffffull, 42u};
+
+  const auto blob = manifest.serialize();
+
+  PipelineUsageManifest restored;
+  ASSERT_TRUE(PipelineUsageManifest::deserialize(blob.data(), blob.size(), restored));
+  ASSERT_EQ(restored.hashes, manifest.hashes);
+}
+
+TEST_F(PipelineUsageRecorderTest, SerializeRoundTripEmpty) {
+  const PipelineUsageManifest manifest;
+  const auto blob = manifest.serialize();
+
+  PipelineUsageManifest restored;
+  restored.hashes = {123u}; // must be cleared by deserialize()
+  ASSERT_TRUE(PipelineUsageManifest::deserialize(blob.data(), blob.size(), restored));
+  ASSERT_TRUE(restored.hashes.empty());
+}
+
+TEST_F(PipelineUsageRecorderTest, DeserializeRejectsBadInput) {
+  PipelineUsageManifest manifest;
+  manifest.hashes = {7u};
+  auto blob = manifest.serialize();
+
+  PipelineUsageManifest restored;
+  // nullptr / empty
+  ASSERT_FALSE(PipelineUsageManifest::deserialize(nullptr, blob.size(), restored));
+  ASSERT_FALSE(PipelineUsageManifest::deserialize(blob.data(), 0, restored));
+  // truncated hash list
+  ASSERT_FALSE(PipelineUsageManifest::deserialize(blob.data(), blob.size() - 1, restored));
+  // corrupted magic
+  blob[0] ^= 0xffu;
+  ASSERT_FALSE(PipelineUsageManifest::deserialize(blob.data(), blob.size(), restored));
+}
+
+} // namespace tests
+} // namespace igl
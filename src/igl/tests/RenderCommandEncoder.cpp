@@ -431,6 +431,44 @@ TEST_F(RenderCommandEncoderTest, shouldDrawATriangle) {
   verifyFrameBuffer(expectedPixels);
 }
 
+TEST_F(RenderCommandEncoderTest, shouldDrawWithArrayBinds) {
+  initializeBuffers(
+      // clang-format off
+      {
+        -1.0f - quarterPixel, -1.0f,                0.0f, 1.0f,
+         1.0f,                -1.0f,                0.0f, 1.0f,
+         1.0f,                 1.0f + quarterPixel, 0.0f, 1.0f,
+      },
+      {
+        0.0f, 0.0f,
+        1.0f, 0.0f,
+        1.0f, 1.0f,
+      } // clang-format on
+  );
+
+  // Rebind the fragment texture and sampler through the array entry points; the draw must look
+  // identical to shouldDrawATriangle
+  encodeAndSubmit([this](const std::unique_ptr<igl::IRenderCommandEncoder>& encoder) {
+    ITexture* textures[] = {texture_.get()};
+    ISamplerState* samplerStates[] = {samp_.get()};
+    encoder->bindTextures(textureUnit_, BindTarget::kFragment, textures, 1);
+    encoder->bindSamplerStates(textureUnit_, BindTarget::kFragment, samplerStates, 1);
+    encoder->draw(PrimitiveType::Triangle, 0, 3);
+  });
+
+  auto grayColor = data::texture::TEX_RGBA_GRAY_4x4[0];
+  // clang-format off
+  std::vector<uint32_t> expectedPixels {
+    backgroundColorHex, backgroundColorHex, backgroundColorHex, grayColor,
+    backgroundColorHex, backgroundColorHex, grayColor,          grayColor,
+    backgroundColorHex, grayColor,          grayColor,          grayColor,
+    grayColor,          grayColor,          grayColor,          grayColor,
+  };
+  // clang-format on
+
+  verifyFrameBuffer(expectedPixels);
+}
+
 TEST_F(RenderCommandEncoderTest, shouldDrawTriangleStrip) {
   initializeBuffers(
       // clang-format off
@@ -495,5 +533,105 @@ TEST_F(RenderCommandEncoderTest, shouldNotDraw) {
   });
 }
 
+//
+// renderScaleConfinesDefaultViewport
+//
+// With RenderPassDesc::renderScale = 0.5 a full-screen draw must only touch the origin-anchored
+// half-size sub-rect of the attachment; the rest keeps the clear color. The encoder must use the
+// backend's default (scaled) viewport, so this test does not bind its own.
+//
+TEST_F(RenderCommandEncoderTest, renderScaleConfinesDefaultViewport) {
+  initializeBuffers(
+      // clang-format off
+      {
+        -1.0f,  1.0f, 0.0f, 1.0f,
+        -1.0f, -1.0f, 0.0f, 1.0f,
+         1.0f,  1.0f, 0.0f, 1.0f,
+         1.0f, -1.0f, 0.0f, 1.0f,
+      },
+      {
+        0.0, 1.0,
+        0.0, 0.0,
+        1.0, 1.0,
+        1.0, 0.0,
+      } // clang-format on
+  );
+
+  renderPass_.renderScale = 0.5f;
+
+  Result ret;
+  auto cmdBuffer = cmdQueue_->createCommandBuffer({}, &ret);
+  ASSERT_TRUE(ret.isOk());
+  ASSERT_TRUE(cmdBuffer != nullptr);
+
+  auto encoder = cmdBuffer->createRenderCommandEncoder(renderPass_, framebuffer_);
+  encoder->bindTexture(textureUnit_, BindTarget::kFragment, texture_.get());
+  encoder->bindSamplerState(textureUnit_, BindTarget::kFragment, samp_.get());
+  encoder->bindVertexBuffer(data::shader::simplePosIndex, vb_);
+  encoder->bindVertexBuffer(data::shader::simpleUvIndex, uv_);
+  encoder->bindRenderPipelineState(renderPipelineState_);
+  encoder->bindDepthStencilState(depthStencilState_);
+  encoder->draw(PrimitiveType::TriangleStrip, 0, 4);
+  encoder->endEncoding();
+
+  cmdQueue_->submit(*cmdBuffer);
+  cmdBuffer->waitUntilCompleted();
+
+  auto grayColor = data::texture::TEX_RGBA_GRAY_4x4[0];
+  // clang-format off
+  std::vector<uint32_t> expectedPixels {
+    backgroundColorHex, backgroundColorHex, backgroundColorHex, backgroundColorHex,
+    backgroundColorHex, backgroundColorHex, backgroundColorHex, backgroundColorHex,
+    grayColor,          grayColor,          backgroundColorHex, backgroundColorHex,
+    grayColor,          grayColor,          backgroundColorHex, backgroundColorHex,
+  };
+  // clang-format on
+
+  verifyFrameBuffer(expectedPixels);
+}
+
+//
+// renderAreaRestrictsClears
+//
+// A pass with RenderPassDesc::renderArea set must only clear the render area and preserve the
+// attachment content outside of it (damage-region rendering).
+//
+TEST_F(RenderCommandEncoderTest, renderAreaRestrictsClears) {
+  Result ret;
+
+  // first pass: clear the whole attachment to the background color
+  auto cmdBuffer = cmdQueue_->createCommandBuffer({}, &ret);
+  ASSERT_TRUE(ret.isOk());
+  ASSERT_TRUE(cmdBuffer != nullptr);
+  auto encoder = cmdBuffer->createRenderCommandEncoder(renderPass_, framebuffer_);
+  encoder->endEncoding();
+  cmdQueue_->submit(*cmdBuffer);
+  cmdBuffer->waitUntilCompleted();
+
+  // second pass: clear to white, restricted to a 2x2 render area
+  renderPass_.renderArea = {1, 1, 2, 2};
+  renderPass_.colorAttachments[0].clearColor = {1.0f, 1.0f, 1.0f, 1.0f};
+
+  cmdBuffer = cmdQueue_->createCommandBuffer({}, &ret);
+  ASSERT_TRUE(ret.isOk());
+  ASSERT_TRUE(cmdBuffer != nullptr);
+  encoder = cmdBuffer->createRenderCommandEncoder(renderPass_, framebuffer_);
+  encoder->endEncoding();
+  cmdQueue_->submit(*cmdBuffer);
+  cmdBuffer->waitUntilCompleted();
+
+  const uint32_t whiteColor = 0xFFFFFFFF;
+  // clang-format off
+  std::vector<uint32_t> expectedPixels {
+    backgroundColorHex, backgroundColorHex, backgroundColorHex, backgroundColorHex,
+    backgroundColorHex, whiteColor,         whiteColor,         backgroundColorHex,
+    backgroundColorHex, whiteColor,         whiteColor,         backgroundColorHex,
+    backgroundColorHex, backgroundColorHex, backgroundColorHex, backgroundColorHex,
+  };
+  // clang-format on
+
+  verifyFrameBuffer(expectedPixels);
+}
+
 } // namespace tests
 } // namespace igl
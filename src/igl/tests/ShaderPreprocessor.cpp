@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <igl/ShaderCreator.h>
+#include <string>
+
+namespace igl {
+namespace tests {
+
+//
+// ShaderPreprocessorTest
+//
+// Exercises include expansion and content-addressed caching in igl::ShaderPreprocessor. The
+// preprocessor is device-independent, so no backend is needed.
+//
+class ShaderPreprocessorTest : public ::testing::Test {
+ public:
+  ShaderPreprocessorTest() = default;
+  ~ShaderPreprocessorTest() override = default;
+
+  void SetUp() override {}
+  void TearDown() override {}
+
+  ShaderPreprocessor preprocessor_;
+};
+
+//
+// Expands registered includes (both quote and angle-bracket forms), including nested ones, and
+// leaves other lines untouched.
+//
+TEST_F(ShaderPreprocessorTest, ExpandsIncludes) {
+  preprocessor_.registerInclude("constants.glsl", "const float kPi = 3.14159265;\n");
+  preprocessor_.registerInclude("common.glsl",
+                                "#include \"constants.glsl\"\n"
+                                "float square(float x) { return x * x; }\n");
+
+  Result ret;
+  const auto blob = preprocessor_.resolve(
+      "#include <common.glsl>\n"
+      "void main() {}\n",
+      &ret);
+  ASSERT_TRUE(ret.isOk());
+  ASSERT_TRUE(blob != nullptr);
+  ASSERT_EQ(*blob,
+            "const float kPi = 3.14159265;\n"
+            "float square(float x) { return x * x; }\n"
+            "void main() {}\n");
+}
+
+//
+// Resolving the same source twice returns the same shared blob; registering a snippet drops the
+// memoization so the next resolve picks up the new contents.
+//
+TEST_F(ShaderPreprocessorTest, CachesByContent) {
+  preprocessor_.registerInclude("common.glsl", "float a;\n");
+
+  const char* source = "#include \"common.glsl\"\nvoid main() {}\n";
+
+  Result ret;
+  const auto first = preprocessor_.resolve(source, &ret);
+  ASSERT_TRUE(ret.isOk());
+  const auto second = preprocessor_.resolve(source, &ret);
+  ASSERT_TRUE(ret.isOk());
+  ASSERT_EQ(first.get(), second.get());
+
+  preprocessor_.registerInclude("common.glsl", "float b;\n");
+  const auto third = preprocessor_.resolve(source, &ret);
+  ASSERT_TRUE(ret.isOk());
+  ASSERT_NE(first.get(), third.get());
+  ASSERT_EQ(*third, "float b;\nvoid main() {}\n");
+  // the old blob stays valid for callers still holding it
+  ASSERT_EQ(*first, "float a;\nvoid main() {}\n");
+}
+
+//
+// Unknown includes, malformed directives and include cycles fail with ArgumentInvalid.
+//
+TEST_F(ShaderPreprocessorTest, ReportsErrors) {
+  Result ret;
+  ASSERT_TRUE(preprocessor_.resolve("#include \"missing.glsl\"\n", &ret) == nullptr);
+  ASSERT_EQ(ret.code, Result::Code::ArgumentInvalid);
+
+  ASSERT_TRUE(preprocessor_.resolve("#include oops\n", &ret) == nullptr);
+  ASSERT_EQ(ret.code, Result::Code::ArgumentInvalid);
+
+  preprocessor_.registerInclude("a.glsl", "#include \"b.glsl\"\n");
+  preprocessor_.registerInclude("b.glsl", "#include \"a.glsl\"\n");
+  ASSERT_TRUE(preprocessor_.resolve("#include \"a.glsl\"\n", &ret) == nullptr);
+  ASSERT_EQ(ret.code, Result::Code::ArgumentInvalid);
+}
+
+} // namespace tests
+} // namespace igl
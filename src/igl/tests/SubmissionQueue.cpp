@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "util/Common.h"
+#include <igl/CommandBuffer.h>
+#include <igl/SubmissionQueue.h>
+
+#include <thread>
+#include <vector>
+
+namespace igl {
+namespace tests {
+
+namespace {
+
+// Minimal ICommandBuffer that only exists to be handed through the queue; the fake queue below
+// records the order in which buffers arrive.
+class FakeCommandBuffer final : public ICommandBuffer {
+ public:
+  std::unique_ptr<IRenderCommandEncoder> createRenderCommandEncoder(
+      const RenderPassDesc& /*renderPass*/,
+      std::shared_ptr<IFramebuffer> /*framebuffer*/,
+      const Dependencies& /*dependencies*/,
+      Result* /*outResult*/) override {
+    return nullptr;
+  }
+  std::unique_ptr<IComputeCommandEncoder> createComputeCommandEncoder() override {
+    return nullptr;
+  }
+  void present(std::shared_ptr<ITexture> /*surface*/) const override {}
+  void waitUntilScheduled() override {}
+  void waitUntilCompleted() override {}
+  void pushDebugGroupLabel(const char* /*label*/, const igl::Color& /*color*/) const override {}
+  void popDebugGroupLabel() const override {}
+};
+
+// Records every submitted command buffer; submission order is what the tests verify.
+class RecordingCommandQueue final : public ICommandQueue {
+ public:
+  std::shared_ptr<ICommandBuffer> createCommandBuffer(const CommandBufferDesc& /*desc*/,
+                                                      Result* /*outResult*/) override {
+    return std::make_shared<FakeCommandBuffer>();
+  }
+  SubmitHandle submit(const ICommandBuffer& commandBuffer, bool /*endOfFrame*/) override {
+    submitted.push_back(&commandBuffer);
+    return static_cast<SubmitHandle>(submitted.size());
+  }
+
+  std::vector<const ICommandBuffer*> submitted;
+};
+
+} // namespace
+
+//
+// SubmissionQueueTest
+//
+// Exercises the lock-free encode-to-submit handoff: deposits from multiple threads must come out
+// of flush() as one batch, ordered by ordering key.
+//
+class SubmissionQueueTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    setDebugBreakEnabled(false);
+  }
+
+  RecordingCommandQueue queue_;
+};
+
+//
+// ordersByKey
+//
+// Buffers enqueued with out-of-order keys are submitted in ascending key order by one flush.
+//
+TEST_F(SubmissionQueueTest, ordersByKey) {
+  SubmissionQueue submissionQueue(queue_);
+
+  auto cb0 = queue_.createCommandBuffer({}, nullptr);
+  auto cb1 = queue_.createCommandBuffer({}, nullptr);
+  auto cb2 = queue_.createCommandBuffer({}, nullptr);
+
+  submissionQueue.enqueue(cb2, 2);
+  submissionQueue.enqueue(cb0, 0);
+  submissionQueue.enqueue(cb1, 1);
+  ASSERT_FALSE(submissionQueue.empty());
+
+  const SubmitHandle handle = submissionQueue.flush();
+  EXPECT_NE(handle, SubmitHandle{});
+  ASSERT_EQ(queue_.submitted.size(), 3u);
+  EXPECT_EQ(queue_.submitted[0], cb0.get());
+  EXPECT_EQ(queue_.submitted[1], cb1.get());
+  EXPECT_EQ(queue_.submitted[2], cb2.get());
+
+  // drained: a second flush has nothing to submit
+  EXPECT_TRUE(submissionQueue.empty());
+  EXPECT_EQ(submissionQueue.flush(), SubmitHandle{});
+  EXPECT_EQ(queue_.submitted.size(), 3u);
+}
+
+//
+// multiThreadedProducers
+//
+// Several worker threads deposit concurrently; every buffer is submitted exactly once and keys
+// still come out ascending.
+//
+TEST_F(SubmissionQueueTest, multiThreadedProducers) {
+  constexpr size_t kNumThreads = 4;
+  constexpr size_t kBuffersPerThread = 64;
+
+  SubmissionQueue submissionQueue(queue_);
+
+  std::vector<std::shared_ptr<ICommandBuffer>> buffers(kNumThreads * kBuffersPerThread);
+  for (auto& buffer : buffers) {
+    buffer = queue_.createCommandBuffer({}, nullptr);
+  }
+
+  std::vector<std::thread> threads;
+  threads.reserve(kNumThreads);
+  for (size_t t = 0; t < kNumThreads; ++t) {
+    threads.emplace_back([&, t]() {
+      for (size_t i = 0; i < kBuffersPerThread; ++i) {
+        const size_t index = t * kBuffersPerThread + i;
+        submissionQueue.enqueue(buffers[index], index);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  submissionQueue.flush();
+
+  ASSERT_EQ(queue_.submitted.size(), buffers.size());
+  for (size_t i = 0; i < buffers.size(); ++i) {
+    EXPECT_EQ(queue_.submitted[i], buffers[i].get());
+  }
+}
+
+} // namespace tests
+} // namespace igl
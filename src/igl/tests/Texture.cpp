@@ -730,4 +730,48 @@ TEST_F(TextureTest, ValidateRange3D) {
   EXPECT_FALSE(ret.isOk());
 }
 
+//
+// Texture View
+//
+// This test validates ITexture::createView: a single-mip view of a mipmapped texture reports the
+// mip's dimensions and level count without duplicating the storage. Skipped on backends without
+// DeviceFeatures::TextureViews, where createView must report Unimplemented.
+//
+TEST_F(TextureTest, CreateView) {
+  Result ret;
+  TextureDesc texDesc = TextureDesc::new2D(TextureFormat::RGBA_UNorm8,
+                                           8,
+                                           8,
+                                           TextureDesc::TextureUsageBits::Sampled |
+                                               TextureDesc::TextureUsageBits::Attachment);
+  texDesc.numMipLevels = 3;
+  auto tex = iglDev_->createTexture(texDesc, &ret);
+  ASSERT_EQ(ret.code, Result::Code::Ok);
+  ASSERT_TRUE(tex != nullptr);
+
+  TextureViewDesc viewDesc;
+  viewDesc.mipLevel = 1;
+  viewDesc.numMipLevels = 1;
+  auto view = tex->createView(viewDesc, &ret);
+
+  if (!iglDev_->hasFeature(DeviceFeatures::TextureViews)) {
+    EXPECT_EQ(ret.code, Result::Code::Unimplemented);
+    EXPECT_TRUE(view == nullptr);
+    GTEST_SKIP() << "Texture views not supported. Skipping.";
+  }
+
+  ASSERT_EQ(ret.code, Result::Code::Ok);
+  ASSERT_TRUE(view != nullptr);
+  EXPECT_EQ(view->getFormat(), tex->getFormat());
+  EXPECT_EQ(view->getDimensions().width, 4u);
+  EXPECT_EQ(view->getDimensions().height, 4u);
+  EXPECT_EQ(view->getNumMipLevels(), 1u);
+
+  // out-of-range views must fail cleanly
+  TextureViewDesc badDesc;
+  badDesc.mipLevel = 3;
+  EXPECT_TRUE(tex->createView(badDesc, &ret) == nullptr);
+  EXPECT_EQ(ret.code, Result::Code::ArgumentOutOfRange);
+}
+
 } // namespace igl::tests
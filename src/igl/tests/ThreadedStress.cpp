@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "util/Common.h"
+#include "util/TestDevice.h"
+
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+// Threaded stress tests for the concurrency IGL actually supports. The functional suites all run
+// single-threaded, so races on the parallel paths regress silently; these tests hammer the
+// documented-safe paths from several threads so they surface here - ideally under TSAN
+// (configure with -DIGL_SANITIZE_THREADS=ON) - instead of on device.
+//
+// Thread-safety contract exercised here:
+//   IDevice / ICommandQueue - thread-confined: all calls must come from the thread the device's
+//                             context is current on. Distinct devices may be driven from distinct
+//                             threads concurrently; whatever process-global state the backends
+//                             share underneath must tolerate that.
+//   resource release        - safe from any thread: the OpenGL backend queues GL deletes through
+//                             IContext's synchronized deletion queues when the releasing thread
+//                             does not own the context, and the Vulkan backend defers destruction
+//                             to deferred tasks drained on the context thread.
+//   igl::SubmissionQueue    - safe for concurrent enqueue(); covered in SubmissionQueue.cpp.
+//
+
+namespace igl {
+namespace tests {
+
+namespace {
+
+// Worker count shared by all stress tests. The default keeps CI fast; export
+// IGL_TEST_STRESS_THREADS to run wider locally when chasing a race.
+size_t stressThreadCount() {
+  if (const char* env = std::getenv("IGL_TEST_STRESS_THREADS")) {
+    const int parsed = std::atoi(env);
+    if (parsed > 0) {
+      return static_cast<size_t>(parsed);
+    }
+  }
+  return 4;
+}
+
+constexpr size_t kIterationsPerThread = 32;
+constexpr size_t kStressTexDimension = 4;
+
+} // namespace
+
+class ThreadedStressTest : public ::testing::Test {
+ public:
+  ThreadedStressTest() = default;
+  ~ThreadedStressTest() override = default;
+
+  void SetUp() override {
+    setDebugBreakEnabled(false);
+
+    util::createDeviceAndQueue(iglDev_, cmdQueue_);
+  }
+
+  void TearDown() override {}
+
+  std::shared_ptr<IDevice> iglDev_;
+  std::shared_ptr<ICommandQueue> cmdQueue_;
+};
+
+//
+// perThreadDeviceResourceChurn
+//
+// Every worker owns a private device (its context is created, and so made current, on the worker
+// itself) and loops creating, uploading into, and dropping buffers and textures. Per-device use
+// stays thread-confined; what this stresses is the state the backends share between devices -
+// allocators, capability probing, deletion queues - which must hold up when several contexts
+// churn resources at once.
+//
+TEST_F(ThreadedStressTest, perThreadDeviceResourceChurn) {
+  const size_t numThreads = stressThreadCount();
+
+  // plain arrays of integers rather than vector<bool>: each slot is written by exactly one thread
+  std::vector<uint8_t> deviceCreated(numThreads, 0);
+  std::vector<size_t> iterationsCompleted(numThreads, 0);
+
+  std::vector<std::thread> threads;
+  threads.reserve(numThreads);
+  for (size_t t = 0; t < numThreads; ++t) {
+    threads.emplace_back([&, t]() {
+      auto device = util::createTestDevice();
+      if (device == nullptr) {
+        return;
+      }
+      deviceCreated[t] = 1;
+
+      for (size_t i = 0; i < kIterationsPerThread; ++i) {
+        Result ret;
+
+        const std::vector<float> bufferData(64, static_cast<float>(i));
+        const BufferDesc bufferDesc = BufferDesc(BufferDesc::BufferTypeBits::Vertex,
+                                                 bufferData.data(),
+                                                 bufferData.size() * sizeof(float));
+        const std::shared_ptr<IBuffer> buffer = device->createBuffer(bufferDesc, &ret);
+        if (!ret.isOk() || buffer == nullptr) {
+          return;
+        }
+
+        const TextureDesc texDesc = TextureDesc::new2D(TextureFormat::RGBA_UNorm8,
+                                                       kStressTexDimension,
+                                                       kStressTexDimension,
+                                                       TextureDesc::TextureUsageBits::Sampled);
+        const std::shared_ptr<ITexture> texture = device->createTexture(texDesc, &ret);
+        if (!ret.isOk() || texture == nullptr) {
+          return;
+        }
+
+        const std::vector<uint32_t> pixels(kStressTexDimension * kStressTexDimension,
+                                           static_cast<uint32_t>(i));
+        const auto rangeDesc =
+            TextureRangeDesc::new2D(0, 0, kStressTexDimension, kStressTexDimension);
+        if (!texture->upload(rangeDesc, pixels.data()).isOk()) {
+          return;
+        }
+
+        iterationsCompleted[t] = i + 1;
+        // buffer and texture die here, so creation and destruction interleave across workers
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (size_t t = 0; t < numThreads; ++t) {
+    EXPECT_EQ(deviceCreated[t], 1) << "thread " << t << " could not create a device";
+    EXPECT_EQ(iterationsCompleted[t], kIterationsPerThread) << "thread " << t;
+  }
+}
+
+//
+// perThreadDeviceSubmit
+//
+// Every worker owns a private device and command queue and loops creating and submitting command
+// buffers. Like the churn test, per-device use is thread-confined; this covers the create/submit
+// half of the frame loop running on several threads at once.
+//
+TEST_F(ThreadedStressTest, perThreadDeviceSubmit) {
+  const size_t numThreads = stressThreadCount();
+
+  std::vector<size_t> submitsCompleted(numThreads, 0);
+
+  std::vector<std::thread> threads;
+  threads.reserve(numThreads);
+  for (size_t t = 0; t < numThreads; ++t) {
+    threads.emplace_back([&, t]() {
+      auto device = util::createTestDevice();
+      if (device == nullptr) {
+        return;
+      }
+
+      Result ret;
+      const CommandQueueDesc cqDesc = {CommandQueueType::Graphics};
+      auto queue = device->createCommandQueue(cqDesc, &ret);
+      if (!ret.isOk() || queue == nullptr) {
+        return;
+      }
+
+      for (size_t i = 0; i < kIterationsPerThread; ++i) {
+        auto cmdBuf = queue->createCommandBuffer(CommandBufferDesc(), &ret);
+        if (!ret.isOk() || cmdBuf == nullptr) {
+          return;
+        }
+        queue->submit(*cmdBuf);
+        submitsCompleted[t] = i + 1;
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (size_t t = 0; t < numThreads; ++t) {
+    EXPECT_EQ(submitsCompleted[t], kIterationsPerThread) << "thread " << t;
+  }
+}
+
+//
+// crossThreadRelease
+//
+// Resources created on the fixture device (context thread) are released concurrently from worker
+// threads that never touch the context. This is the one documented-safe cross-thread operation on
+// a single device: backends must queue the GPU-side deletes back to the context thread rather
+// than issue them in place.
+//
+TEST_F(ThreadedStressTest, crossThreadRelease) {
+  const size_t numThreads = stressThreadCount();
+  const size_t totalResources = numThreads * kIterationsPerThread;
+
+  Result ret;
+
+  std::vector<std::shared_ptr<IBuffer>> buffers(totalResources);
+  std::vector<std::shared_ptr<ITexture>> textures(totalResources);
+  for (size_t i = 0; i < totalResources; ++i) {
+    const std::vector<float> bufferData(16, static_cast<float>(i));
+    const BufferDesc bufferDesc = BufferDesc(
+        BufferDesc::BufferTypeBits::Vertex, bufferData.data(), bufferData.size() * sizeof(float));
+    buffers[i] = iglDev_->createBuffer(bufferDesc, &ret);
+    ASSERT_EQ(ret.code, Result::Code::Ok);
+    ASSERT_TRUE(buffers[i] != nullptr);
+
+    const TextureDesc texDesc = TextureDesc::new2D(TextureFormat::RGBA_UNorm8,
+                                                   kStressTexDimension,
+                                                   kStressTexDimension,
+                                                   TextureDesc::TextureUsageBits::Sampled);
+    textures[i] = iglDev_->createTexture(texDesc, &ret);
+    ASSERT_EQ(ret.code, Result::Code::Ok);
+    ASSERT_TRUE(textures[i] != nullptr);
+  }
+
+  std::vector<std::thread> threads;
+  threads.reserve(numThreads);
+  for (size_t t = 0; t < numThreads; ++t) {
+    threads.emplace_back([&, t]() {
+      for (size_t i = 0; i < kIterationsPerThread; ++i) {
+        const size_t index = t * kIterationsPerThread + i;
+        buffers[index] = nullptr;
+        textures[index] = nullptr;
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  // back on the context thread: create and submit once more so the deletes queued by the workers
+  // get drained, with the error hooks still armed to catch anything they broke
+  auto cmdBuf = cmdQueue_->createCommandBuffer(CommandBufferDesc(), &ret);
+  ASSERT_EQ(ret.code, Result::Code::Ok);
+  ASSERT_TRUE(cmdBuf != nullptr);
+  cmdQueue_->submit(*cmdBuf);
+
+  const std::vector<float> bufferData(16, 0.0f);
+  const BufferDesc bufferDesc = BufferDesc(
+      BufferDesc::BufferTypeBits::Vertex, bufferData.data(), bufferData.size() * sizeof(float));
+  const auto survivor = iglDev_->createBuffer(bufferDesc, &ret);
+  ASSERT_EQ(ret.code, Result::Code::Ok);
+  ASSERT_TRUE(survivor != nullptr);
+}
+
+} // namespace tests
+} // namespace igl
@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "util/Common.h"
+#include "util/TestDevice.h"
+
+#include <igl/TransientResourcePool.h>
+
+namespace igl {
+namespace tests {
+
+//
+// TransientResourcePoolTest
+//
+// Test fixture for all the tests in this file. Takes care of common
+// initialization and allocating of common resources.
+//
+class TransientResourcePoolTest : public ::testing::Test {
+ public:
+  TransientResourcePoolTest() = default;
+  ~TransientResourcePoolTest() override = default;
+
+  void SetUp() override {
+    // Turn off debug break so unit tests can run
+    igl::setDebugBreakEnabled(false);
+
+    util::createDeviceAndQueue(iglDev_, cmdQueue_);
+  }
+
+  void TearDown() override {}
+
+ public:
+  std::shared_ptr<IDevice> iglDev_;
+  std::shared_ptr<ICommandQueue> cmdQueue_;
+
+  TextureDesc textureDesc_ = TextureDesc::new2D(TextureFormat::RGBA_UNorm8,
+                                                16,
+                                                16,
+                                                TextureDesc::TextureUsageBits::Sampled |
+                                                    TextureDesc::TextureUsageBits::Attachment);
+};
+
+//
+// TextureReusedAfterRelease
+//
+// A texture released by one pass should be handed out again to the next
+// acquire with a matching desc instead of being created anew.
+//
+TEST_F(TransientResourcePoolTest, TextureReusedAfterRelease) {
+  TransientResourcePool pool(*iglDev_);
+  Result ret;
+
+  auto texture = pool.acquireTexture(textureDesc_, &ret);
+  ASSERT_EQ(ret.code, Result::Code::Ok);
+  ASSERT_TRUE(texture != nullptr);
+  ASSERT_EQ(pool.getTextureCount(), 1);
+
+  ITexture* raw = texture.get();
+  texture = nullptr; // the pass is done with the target
+
+  auto reused = pool.acquireTexture(textureDesc_, &ret);
+  ASSERT_EQ(ret.code, Result::Code::Ok);
+  ASSERT_EQ(reused.get(), raw);
+  ASSERT_EQ(pool.getTextureCount(), 1);
+}
+
+//
+// TextureNotReusedWhileHeld
+//
+// A texture still referenced by a pass must not be handed out again.
+//
+TEST_F(TransientResourcePoolTest, TextureNotReusedWhileHeld) {
+  TransientResourcePool pool(*iglDev_);
+  Result ret;
+
+  auto held = pool.acquireTexture(textureDesc_, &ret);
+  ASSERT_TRUE(held != nullptr);
+
+  auto second = pool.acquireTexture(textureDesc_, &ret);
+  ASSERT_EQ(ret.code, Result::Code::Ok);
+  ASSERT_TRUE(second != nullptr);
+  ASSERT_NE(second.get(), held.get());
+  ASSERT_EQ(pool.getTextureCount(), 2);
+}
+
+//
+// MismatchedDescNotReused
+//
+// Descs differing in allocation-relevant properties must not alias.
+//
+TEST_F(TransientResourcePoolTest, MismatchedDescNotReused) {
+  TransientResourcePool pool(*iglDev_);
+  Result ret;
+
+  auto texture = pool.acquireTexture(textureDesc_, &ret);
+  ASSERT_TRUE(texture != nullptr);
+  ITexture* raw = texture.get();
+  texture = nullptr;
+
+  TextureDesc biggerDesc = textureDesc_;
+  biggerDesc.width = 32;
+
+  auto bigger = pool.acquireTexture(biggerDesc, &ret);
+  ASSERT_EQ(ret.code, Result::Code::Ok);
+  ASSERT_TRUE(bigger != nullptr);
+  ASSERT_NE(bigger.get(), raw);
+  ASSERT_EQ(pool.getTextureCount(), 2);
+}
+
+//
+// UnusedResourcesEvicted
+//
+// Resources that go unused for framesUntilEviction frames are destroyed
+// at endFrame(); resources used every frame stay pooled.
+//
+TEST_F(TransientResourcePoolTest, UnusedResourcesEvicted) {
+  TransientResourcePool pool(*iglDev_, 2);
+  Result ret;
+
+  auto texture = pool.acquireTexture(textureDesc_, &ret);
+  ASSERT_TRUE(texture != nullptr);
+  texture = nullptr;
+
+  pool.endFrame();
+  ASSERT_EQ(pool.getTextureCount(), 1);
+  pool.endFrame();
+  ASSERT_EQ(pool.getTextureCount(), 0);
+}
+
+//
+// BufferWithDataRejected
+//
+// Transient buffers are recycled, so creation-time data is rejected.
+//
+TEST_F(TransientResourcePoolTest, BufferWithDataRejected) {
+  TransientResourcePool pool(*iglDev_);
+  Result ret;
+
+  const float data[] = {1.0f};
+  const BufferDesc bufferDesc(BufferDesc::BufferTypeBits::Vertex, data, sizeof(data));
+
+  auto buffer = pool.acquireBuffer(bufferDesc, &ret);
+  ASSERT_EQ(ret.code, Result::Code::ArgumentInvalid);
+  ASSERT_TRUE(buffer == nullptr);
+}
+
+//
+// BufferReusedAfterRelease
+//
+// Released buffers are recycled just like textures.
+//
+TEST_F(TransientResourcePoolTest, BufferReusedAfterRelease) {
+  TransientResourcePool pool(*iglDev_);
+  Result ret;
+
+  const BufferDesc bufferDesc(
+      BufferDesc::BufferTypeBits::Uniform, nullptr, 256, ResourceStorage::Shared);
+
+  auto buffer = pool.acquireBuffer(bufferDesc, &ret);
+  ASSERT_EQ(ret.code, Result::Code::Ok);
+  ASSERT_TRUE(buffer != nullptr);
+
+  IBuffer* raw = buffer.get();
+  buffer = nullptr;
+
+  auto reused = pool.acquireBuffer(bufferDesc, &ret);
+  ASSERT_EQ(ret.code, Result::Code::Ok);
+  ASSERT_EQ(reused.get(), raw);
+  ASSERT_EQ(pool.getBufferCount(), 1);
+}
+
+//
+// PurgeDropsIdleResources
+//
+// purge() destroys idle resources but leaves held ones alone.
+//
+TEST_F(TransientResourcePoolTest, PurgeDropsIdleResources) {
+  TransientResourcePool pool(*iglDev_);
+  Result ret;
+
+  auto held = pool.acquireTexture(textureDesc_, &ret);
+  ASSERT_TRUE(held != nullptr);
+
+  auto released = pool.acquireTexture(textureDesc_, &ret);
+  ASSERT_TRUE(released != nullptr);
+  released = nullptr;
+
+  pool.purge();
+  ASSERT_EQ(pool.getTextureCount(), 1);
+}
+
+} // namespace tests
+} // namespace igl
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "util/Common.h"
+#include <igl/VertexPulling.h>
+
+namespace igl {
+namespace tests {
+
+//
+// VertexPullingTest
+//
+// Validates the generated GLSL fetch preamble: buffer declarations, fetch function signatures and
+// rejection of layouts the generator cannot express.
+//
+class VertexPullingTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    setDebugBreakEnabled(false);
+  }
+};
+
+//
+// GeneratesBuffersAndFetchFunctions
+//
+// A two-attribute interleaved layout produces one storage buffer declaration and one fetch
+// function per attribute, typed after the attribute format.
+//
+TEST_F(VertexPullingTest, GeneratesBuffersAndFetchFunctions) {
+  VertexInputStateDesc desc;
+  desc.numAttributes = 2;
+  desc.attributes[0] = VertexAttribute(0, VertexAttributeFormat::Float3, 0, "position", 0);
+  desc.attributes[1] = VertexAttribute(0, VertexAttributeFormat::UByte4Norm, 12, "color", 1);
+  desc.numInputBindings = 1;
+  desc.inputBindings[0].stride = 16;
+
+  Result result;
+  const std::string preamble = generateVertexPullingPreamble(desc, 1, 0, &result);
+  ASSERT_TRUE(result.isOk());
+
+  EXPECT_NE(preamble.find("layout(std430, set = 1, binding = 0) readonly buffer IGLVertexBuffer0"),
+            std::string::npos);
+  EXPECT_NE(preamble.find("vec3 iglFetch_position(uint vertexIndex, uint instanceIndex)"),
+            std::string::npos);
+  EXPECT_NE(preamble.find("vec4 iglFetch_color(uint vertexIndex, uint instanceIndex)"),
+            std::string::npos);
+  // interleaved stride of 16 bytes is 4 words; the color attribute starts 3 words in
+  EXPECT_NE(preamble.find("vertexIndex * 4u + 3u"), std::string::npos);
+}
+
+//
+// InstanceRateAndUnnamedAttributes
+//
+// Per-instance bindings divide instanceIndex by the sample rate, and attributes without a name
+// fall back to their location.
+//
+TEST_F(VertexPullingTest, InstanceRateAndUnnamedAttributes) {
+  VertexInputStateDesc desc;
+  desc.numAttributes = 1;
+  desc.attributes[0] = VertexAttribute(0, VertexAttributeFormat::UInt2, 0, "", 5);
+  desc.numInputBindings = 1;
+  desc.inputBindings[0].stride = 8;
+  desc.inputBindings[0].sampleFunction = VertexSampleFunction::Instance;
+  desc.inputBindings[0].sampleRate = 4;
+
+  const std::string preamble = generateVertexPullingPreamble(desc, 0, 2);
+
+  EXPECT_NE(preamble.find("binding = 2"), std::string::npos);
+  EXPECT_NE(preamble.find("uvec2 iglFetch_attr5(uint vertexIndex, uint instanceIndex)"),
+            std::string::npos);
+  EXPECT_NE(preamble.find("(instanceIndex / 4u) * 2u + 0u"), std::string::npos);
+}
+
+//
+// RejectsUnalignedLayouts
+//
+// Word-granular reads cannot express offsets or strides that are not 4-byte aligned.
+//
+TEST_F(VertexPullingTest, RejectsUnalignedLayouts) {
+  VertexInputStateDesc desc;
+  desc.numAttributes = 1;
+  desc.attributes[0] = VertexAttribute(0, VertexAttributeFormat::UByte2, 2, "uv", 0);
+  desc.numInputBindings = 1;
+  desc.inputBindings[0].stride = 8;
+
+  Result result;
+  EXPECT_TRUE(generateVertexPullingPreamble(desc, 0, 0, &result).empty());
+  EXPECT_EQ(result.code, Result::Code::Unsupported);
+
+  // attributes must reference a declared binding
+  desc.attributes[0] = VertexAttribute(3, VertexAttributeFormat::Float2, 0, "uv", 0);
+  EXPECT_TRUE(generateVertexPullingPreamble(desc, 0, 0, &result).empty());
+  EXPECT_EQ(result.code, Result::Code::ArgumentInvalid);
+}
+
+} // namespace tests
+} // namespace igl
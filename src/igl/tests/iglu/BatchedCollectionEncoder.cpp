@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <IGLU/uniform/BatchedCollectionEncoder.h>
+#include <IGLU/uniform/Collection.h>
+#include <IGLU/uniform/Descriptor.h>
+#include <glm/glm.hpp>
+#include <gtest/gtest.h>
+#include <igl/IGL.h>
+
+namespace iglu {
+namespace tests {
+
+//
+// BatchedCollectionEncoderTest
+//
+// CPU-side tests for the batched uniform layout. The device encoding path is
+// exercised by the render sessions; here we verify the contiguous layout that
+// drives the single buffer write.
+//
+class BatchedCollectionEncoderTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    igl::setDebugBreakEnabled(false);
+  }
+};
+
+//
+// Layout
+//
+// Descriptors are laid out back to back with every offset aligned.
+//
+TEST_F(BatchedCollectionEncoderTest, Layout) {
+  uniform::Collection c;
+  const auto floatName = igl::genNameHandle("floatUniform");
+  const auto vec4Name = igl::genNameHandle("vec4Uniform");
+  const auto mat4Name = igl::genNameHandle("mat4Uniform");
+  c.set(floatName, 1.0f);
+  c.set(vec4Name, glm::vec4(2.0f));
+  c.set(mat4Name, glm::mat4(3.0f));
+
+  constexpr size_t kAlignment = 16;
+  const auto layout = uniform::BatchLayout::create(c, c.names(), kAlignment);
+
+  ASSERT_EQ(layout.entries.size(), 3u);
+  size_t expectedOffset = 0;
+  for (const auto& entry : layout.entries) {
+    ASSERT_EQ(entry.offset % kAlignment, 0u);
+    ASSERT_GE(entry.offset, expectedOffset);
+    expectedOffset = entry.offset + entry.numBytes;
+  }
+  ASSERT_EQ(layout.numBytes, expectedOffset);
+
+  // float (4b) at 0, vec4 (16b) aligned to 16, mat4 (64b) right after.
+  ASSERT_EQ(layout.entries[0].numBytes, sizeof(float));
+  ASSERT_EQ(layout.entries[1].offset, 16u);
+  ASSERT_EQ(layout.entries[2].offset, 32u);
+  ASSERT_EQ(layout.numBytes, 32u + sizeof(glm::mat4));
+}
+
+//
+// EmptyLayout
+//
+// An empty name list produces an empty layout rather than an allocation.
+//
+TEST_F(BatchedCollectionEncoderTest, EmptyLayout) {
+  uniform::Collection c;
+  const auto layout = uniform::BatchLayout::create(c, {}, 16);
+  ASSERT_TRUE(layout.entries.empty());
+  ASSERT_EQ(layout.numBytes, 0u);
+}
+
+} // namespace tests
+} // namespace iglu
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "../util/Common.h"
+
+#include <IGLU/device_group/DeviceGroup.h>
+#include <gtest/gtest.h>
+#include <igl/IGL.h>
+
+namespace igl {
+namespace tests {
+
+//
+// DeviceGroupTest
+//
+// Tests for the iglu::device_group::DeviceGroup multi-device coordinator. The test environment
+// only has one physical device, so the group is built from the same device listed twice - the
+// affinity logic only cares about the number of slots, not what is behind them.
+//
+class DeviceGroupTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    setDebugBreakEnabled(false);
+
+    util::createDeviceAndQueue(iglDev_, cmdQueue_);
+    ASSERT_TRUE(iglDev_ != nullptr);
+
+    group_ = std::make_unique<iglu::device_group::DeviceGroup>(
+        std::vector<std::shared_ptr<IDevice>>{iglDev_, iglDev_});
+  }
+
+  std::shared_ptr<IDevice> iglDev_;
+  std::shared_ptr<ICommandQueue> cmdQueue_;
+  std::unique_ptr<iglu::device_group::DeviceGroup> group_;
+};
+
+//
+// RoundRobin
+//
+// getNextDeviceIndex() cycles through all slots of the group.
+//
+TEST_F(DeviceGroupTest, RoundRobin) {
+  ASSERT_EQ(group_->getDeviceCount(), 2u);
+  const size_t first = group_->getNextDeviceIndex();
+  const size_t second = group_->getNextDeviceIndex();
+  const size_t third = group_->getNextDeviceIndex();
+  ASSERT_NE(first, second);
+  ASSERT_EQ(first, third);
+}
+
+//
+// AffinityKeysAreStable
+//
+// The same affinity key always maps to the same device, and every result is a valid index.
+//
+TEST_F(DeviceGroupTest, AffinityKeysAreStable) {
+  for (uint64_t key = 0; key < 64; key++) {
+    const size_t index = group_->getDeviceIndexForKey(key);
+    ASSERT_LT(index, group_->getDeviceCount());
+    ASSERT_EQ(index, group_->getDeviceIndexForKey(key));
+  }
+}
+
+//
+// ShareTextureRequiresShareableUsage
+//
+// Sharing a texture that was not created with TextureUsageBits::Shareable fails cleanly instead
+// of aliasing memory that cannot be exported.
+//
+TEST_F(DeviceGroupTest, ShareTextureRequiresShareableUsage) {
+  Result ret;
+  const TextureDesc desc = TextureDesc::new2D(
+      TextureFormat::RGBA_UNorm8, 8, 8, TextureDesc::TextureUsageBits::Sampled);
+  std::shared_ptr<ITexture> texture = iglDev_->createTexture(desc, &ret);
+  ASSERT_TRUE(ret.isOk());
+  ASSERT_TRUE(texture != nullptr);
+
+  std::shared_ptr<ITexture> shared = group_->shareTexture(0, texture, 1, &ret);
+  ASSERT_FALSE(ret.isOk());
+  ASSERT_TRUE(shared == nullptr);
+}
+
+//
+// ShareTextureValidatesArguments
+//
+// Out-of-range device indices and null textures are rejected.
+//
+TEST_F(DeviceGroupTest, ShareTextureValidatesArguments) {
+  Result ret;
+  std::shared_ptr<ITexture> shared = group_->shareTexture(0, nullptr, 1, &ret);
+  ASSERT_EQ(ret.code, Result::Code::ArgumentInvalid);
+  ASSERT_TRUE(shared == nullptr);
+
+  const TextureDesc desc = TextureDesc::new2D(
+      TextureFormat::RGBA_UNorm8, 8, 8, TextureDesc::TextureUsageBits::Sampled);
+  std::shared_ptr<ITexture> texture = iglDev_->createTexture(desc, &ret);
+  ASSERT_TRUE(ret.isOk());
+
+  shared = group_->shareTexture(2, texture, 0, &ret);
+  ASSERT_EQ(ret.code, Result::Code::ArgumentInvalid);
+  ASSERT_TRUE(shared == nullptr);
+}
+
+} // namespace tests
+} // namespace igl
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <IGLU/gpu_load/GpuLoadMonitor.h>
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace igl {
+namespace tests {
+
+namespace {
+
+// One frame with a single zone spanning [0, durationNanoseconds]
+std::vector<GpuTimestampZone> frameWithDuration(uint64_t durationNanoseconds) {
+  return {{"frame", 0, durationNanoseconds}};
+}
+
+} // namespace
+
+//
+// GpuLoadMonitorTest
+//
+// Exercises the EMA folding and hysteresis logic of iglu::gpu_load::GpuLoadMonitor by feeding
+// frame samples directly through addFrameSample(), which needs no GPU.
+//
+class GpuLoadMonitorTest : public ::testing::Test {
+ public:
+  GpuLoadMonitorTest() = default;
+  ~GpuLoadMonitorTest() override = default;
+
+  void SetUp() override {
+    desc_.frameBudgetNanoseconds = 10'000'000; // 10 ms
+    desc_.smoothingFactor = 0.5;
+    desc_.highWatermark = 0.9;
+    desc_.lowWatermark = 0.5;
+    desc_.hysteresisFrames = 3;
+  }
+
+  void TearDown() override {}
+
+  iglu::gpu_load::GpuLoadMonitorDesc desc_;
+};
+
+//
+// Averages and headroom
+//
+// Verifies that the first sample seeds the averages directly, later samples are folded with the
+// configured smoothing factor, and headroom is budget minus the smoothed frame time (clamped to
+// zero when over budget).
+//
+TEST_F(GpuLoadMonitorTest, AveragesAndHeadroom) {
+  iglu::gpu_load::GpuLoadMonitor monitor(desc_);
+
+  ASSERT_EQ(monitor.frameGpuTimeNanoseconds(), 0u);
+  ASSERT_EQ(monitor.headroomNanoseconds(), desc_.frameBudgetNanoseconds);
+
+  monitor.addFrameSample(frameWithDuration(6'000'000));
+  ASSERT_EQ(monitor.frameGpuTimeNanoseconds(), 6'000'000u);
+  ASSERT_EQ(monitor.headroomNanoseconds(), 4'000'000u);
+
+  // 6 ms folded with an 8 ms sample at alpha 0.5 -> 7 ms
+  monitor.addFrameSample(frameWithDuration(8'000'000));
+  ASSERT_EQ(monitor.frameGpuTimeNanoseconds(), 7'000'000u);
+  ASSERT_EQ(monitor.headroomNanoseconds(), 3'000'000u);
+
+  monitor.addFrameSample(frameWithDuration(25'000'000));
+  ASSERT_EQ(monitor.headroomNanoseconds(), 0u);
+}
+
+//
+// Per-pass averages
+//
+// Multiple zones with the same name within one frame are summed before folding, the frame time is
+// the overall span (nested zones are not double-counted), and unknown names report zero.
+//
+TEST_F(GpuLoadMonitorTest, PerPassAverages) {
+  iglu::gpu_load::GpuLoadMonitor monitor(desc_);
+
+  const std::vector<GpuTimestampZone> zones = {
+      {"shadows", 0, 2'000'000},
+      {"shadows", 2'000'000, 3'000'000},
+      {"scene", 3'000'000, 8'000'000},
+      {"scene.opaque", 3'000'000, 7'000'000}, // nested inside "scene"
+  };
+  monitor.addFrameSample(zones);
+
+  ASSERT_EQ(monitor.passGpuTimeNanoseconds("shadows"), 3'000'000u);
+  ASSERT_EQ(monitor.passGpuTimeNanoseconds("scene"), 5'000'000u);
+  ASSERT_EQ(monitor.passGpuTimeNanoseconds("scene.opaque"), 4'000'000u);
+  ASSERT_EQ(monitor.passGpuTimeNanoseconds("bloom"), 0u);
+  ASSERT_EQ(monitor.frameGpuTimeNanoseconds(), 8'000'000u);
+}
+
+//
+// Hysteresis
+//
+// The load level changes (and the callback fires) only after hysteresisFrames consecutive frames
+// classify the same way; an isolated spike is ignored.
+//
+TEST_F(GpuLoadMonitorTest, HysteresisFiltersSpikes) {
+  iglu::gpu_load::GpuLoadMonitor monitor(desc_);
+
+  size_t callbackCount = 0;
+  iglu::gpu_load::LoadLevel lastLevel = iglu::gpu_load::LoadLevel::Nominal;
+  monitor.setLoadLevelCallback([&](iglu::gpu_load::LoadLevel level) {
+    callbackCount++;
+    lastLevel = level;
+  });
+
+  // Nominal band is [5 ms, 9 ms]; start there
+  monitor.addFrameSample(frameWithDuration(7'000'000));
+  ASSERT_EQ(monitor.loadLevel(), iglu::gpu_load::LoadLevel::Nominal);
+
+  // A single over-budget spike followed by nominal frames must not change the level
+  monitor.addFrameSample(frameWithDuration(20'000'000));
+  monitor.addFrameSample(frameWithDuration(7'000'000));
+  monitor.addFrameSample(frameWithDuration(7'000'000));
+  ASSERT_EQ(monitor.loadLevel(), iglu::gpu_load::LoadLevel::Nominal);
+  ASSERT_EQ(callbackCount, 0u);
+
+  // Three consecutive over-budget frames flip the level exactly once
+  monitor.addFrameSample(frameWithDuration(20'000'000));
+  monitor.addFrameSample(frameWithDuration(20'000'000));
+  ASSERT_EQ(monitor.loadLevel(), iglu::gpu_load::LoadLevel::Nominal);
+  monitor.addFrameSample(frameWithDuration(20'000'000));
+  ASSERT_EQ(monitor.loadLevel(), iglu::gpu_load::LoadLevel::OverBudget);
+  ASSERT_EQ(callbackCount, 1u);
+  ASSERT_EQ(lastLevel, iglu::gpu_load::LoadLevel::OverBudget);
+
+  // And back down to UnderBudget after three light frames
+  monitor.addFrameSample(frameWithDuration(1'000'000));
+  monitor.addFrameSample(frameWithDuration(1'000'000));
+  monitor.addFrameSample(frameWithDuration(1'000'000));
+  ASSERT_EQ(monitor.loadLevel(), iglu::gpu_load::LoadLevel::UnderBudget);
+  ASSERT_EQ(callbackCount, 2u);
+  ASSERT_EQ(lastLevel, iglu::gpu_load::LoadLevel::UnderBudget);
+}
+
+} // namespace tests
+} // namespace igl
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <IGLU/simple_renderer/MaterialParameterBlock.h>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <igl/IGL.h>
+
+namespace igl {
+namespace tests {
+
+namespace {
+
+// Reflection stub exposing one uniform block; baking only reads allUniformBuffers(), so no
+// device or compiled shader is needed.
+class StubReflection final : public IRenderPipelineReflection {
+ public:
+  const std::vector<BufferArgDesc>& allUniformBuffers() const override {
+    return bufferArguments_;
+  }
+  const std::vector<SamplerArgDesc>& allSamplers() const override {
+    return samplerArguments_;
+  }
+  const std::vector<TextureArgDesc>& allTextures() const override {
+    return textureArguments_;
+  }
+
+  std::vector<BufferArgDesc> bufferArguments_;
+  std::vector<SamplerArgDesc> samplerArguments_;
+  std::vector<TextureArgDesc> textureArguments_;
+};
+
+StubReflection makeReflection() {
+  BufferArgDesc block;
+  block.name = igl::genNameHandle("MaterialParams");
+  block.bufferDataSize = 32; // float4 color + float roughness (+ padding)
+  block.bufferIndex = 2;
+  block.shaderStage = ShaderStage::Fragment;
+  block.members = {
+      {igl::genNameHandle("color"), UniformType::Float4, 0, 1},
+      {igl::genNameHandle("roughness"), UniformType::Float, 16, 1},
+  };
+
+  StubReflection reflection;
+  reflection.bufferArguments_.push_back(std::move(block));
+  return reflection;
+}
+
+} // namespace
+
+//
+// MaterialParameterBlockTest
+//
+// Exercises baking a POD parameter block from reflection and writing members through
+// precomputed indices.
+//
+
+TEST(MaterialParameterBlockTest, BakesLayoutAndWritesMembers) {
+  const StubReflection reflection = makeReflection();
+
+  Result result;
+  auto block = iglu::material::MaterialParameterBlock::create(
+      reflection, igl::genNameHandle("MaterialParams"), &result);
+  ASSERT_TRUE(result.isOk());
+  ASSERT_NE(block, nullptr);
+
+  EXPECT_EQ(block->size(), 32u);
+  EXPECT_EQ(block->layout().bufferIndex, 2);
+
+  const int colorIndex = block->memberIndex("color");
+  const int roughnessIndex = block->memberIndex("roughness");
+  ASSERT_GE(colorIndex, 0);
+  ASSERT_GE(roughnessIndex, 0);
+  EXPECT_EQ(block->memberIndex("missing"), -1);
+
+  const float color[4] = {1.0f, 0.5f, 0.25f, 1.0f};
+  const float roughness = 0.75f;
+  block->setMemberBytes(colorIndex, color, sizeof(color));
+  block->setMemberBytes(roughnessIndex, &roughness, sizeof(roughness));
+
+  // the snapshot is laid out exactly like the GPU block
+  const auto* snapshot = static_cast<const uint8_t*>(block->data());
+  EXPECT_EQ(std::memcmp(snapshot, color, sizeof(color)), 0);
+  EXPECT_EQ(std::memcmp(snapshot + 16, &roughness, sizeof(roughness)), 0);
+}
+
+TEST(MaterialParameterBlockTest, FailsOnUnknownBlock) {
+  const StubReflection reflection = makeReflection();
+
+  Result result;
+  auto block = iglu::material::MaterialParameterBlock::create(
+      reflection, igl::genNameHandle("NoSuchBlock"), &result);
+  EXPECT_EQ(block, nullptr);
+  EXPECT_FALSE(result.isOk());
+}
+
+} // namespace tests
+} // namespace igl
@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "../util/Common.h"
+
+#include <IGLU/render_graph/RenderGraph.h>
+#include <gtest/gtest.h>
+#include <igl/IGL.h>
+#include <string>
+#include <vector>
+
+namespace igl {
+namespace tests {
+
+constexpr uint32_t kGraphTexWidth = 4;
+constexpr uint32_t kGraphTexHeight = 4;
+
+//
+// RenderGraphTest
+//
+// Test fixture for all the tests in this file. Takes care of common
+// initialization and allocating of common resources.
+//
+class RenderGraphTest : public ::testing::Test {
+ public:
+  RenderGraphTest() = default;
+  ~RenderGraphTest() override = default;
+
+  void SetUp() override {
+    setDebugBreakEnabled(false);
+
+    util::createDeviceAndQueue(iglDev_, cmdQueue_);
+    ASSERT_TRUE(iglDev_ != nullptr);
+    ASSERT_TRUE(cmdQueue_ != nullptr);
+  }
+
+  void TearDown() override {}
+
+  // A transient texture desc all the tests share
+  TextureDesc transientDesc() {
+    return TextureDesc::new2D(TextureFormat::RGBA_UNorm8,
+                              kGraphTexWidth,
+                              kGraphTexHeight,
+                              TextureDesc::TextureUsageBits::Sampled |
+                                  TextureDesc::TextureUsageBits::Attachment);
+  }
+
+  std::shared_ptr<IDevice> iglDev_;
+  std::shared_ptr<ICommandQueue> cmdQueue_;
+};
+
+//
+// ordersPassesByDependencies
+//
+// A consumer added before its producer still encodes after it: execution order follows the
+// declared read/write sets, not the order addPass() was called in.
+//
+TEST_F(RenderGraphTest, ordersPassesByDependencies) {
+  iglu::render_graph::RenderGraph graph(*iglDev_);
+
+  const auto intermediate = graph.declareTexture(transientDesc());
+  std::vector<std::string> encoded;
+
+  // the consumer is recorded first
+  graph.addPass({"consume",
+                 {intermediate},
+                 {},
+                 true, // observable without writing anything the graph tracks
+                 [&encoded](iglu::render_graph::PassResources& resources, ICommandBuffer&) {
+                   (void)resources;
+                   encoded.push_back("consume");
+                 }});
+  graph.addPass({"produce",
+                 {},
+                 {intermediate},
+                 false,
+                 [&encoded, intermediate](iglu::render_graph::PassResources& resources,
+                                          ICommandBuffer&) {
+                   EXPECT_TRUE(resources.texture(intermediate) != nullptr);
+                   encoded.push_back("produce");
+                 }});
+
+  Result ret;
+  const auto cmdBuffer = graph.execute(*cmdQueue_, &ret);
+  ASSERT_EQ(ret.code, Result::Code::Ok);
+  ASSERT_TRUE(cmdBuffer != nullptr);
+
+  ASSERT_EQ(encoded.size(), 2u);
+  EXPECT_EQ(encoded[0], "produce");
+  EXPECT_EQ(encoded[1], "consume");
+  EXPECT_EQ(graph.getLastCulledPassCount(), 0u);
+}
+
+//
+// cullsUnobservedPasses
+//
+// A pass whose writes nobody reads, with no side effects, never encodes; its transitive
+// producers are culled along with it.
+//
+TEST_F(RenderGraphTest, cullsUnobservedPasses) {
+  iglu::render_graph::RenderGraph graph(*iglDev_);
+
+  const auto used = graph.declareTexture(transientDesc());
+  const auto unused = graph.declareTexture(transientDesc());
+  std::vector<std::string> encoded;
+
+  const auto recordName = [&encoded](const char* name) {
+    return [&encoded, name](iglu::render_graph::PassResources&, ICommandBuffer&) {
+      encoded.push_back(name);
+    };
+  };
+
+  graph.addPass({"deadProducer", {}, {unused}, false, recordName("deadProducer")});
+  graph.addPass({"deadConsumer", {unused}, {}, false, recordName("deadConsumer")});
+  graph.addPass({"producer", {}, {used}, false, recordName("producer")});
+  graph.addPass({"present", {used}, {}, true, recordName("present")});
+
+  Result ret;
+  const auto cmdBuffer = graph.execute(*cmdQueue_, &ret);
+  ASSERT_EQ(ret.code, Result::Code::Ok);
+  ASSERT_TRUE(cmdBuffer != nullptr);
+
+  ASSERT_EQ(encoded.size(), 2u);
+  EXPECT_EQ(encoded[0], "producer");
+  EXPECT_EQ(encoded[1], "present");
+  EXPECT_EQ(graph.getLastCulledPassCount(), 2u);
+}
+
+//
+// writesToImportedTexturesAreObservable
+//
+// Writing an imported texture keeps a pass alive without hasSideEffects, since the outside
+// world owns the target.
+//
+TEST_F(RenderGraphTest, writesToImportedTexturesAreObservable) {
+  iglu::render_graph::RenderGraph graph(*iglDev_);
+
+  Result ret;
+  const auto backbuffer = iglDev_->createTexture(transientDesc(), &ret);
+  ASSERT_EQ(ret.code, Result::Code::Ok);
+  ASSERT_TRUE(backbuffer != nullptr);
+
+  const auto imported = graph.importTexture(backbuffer);
+  bool encoded = false;
+
+  graph.addPass({"blit",
+                 {},
+                 {imported},
+                 false,
+                 [&encoded, imported, &backbuffer](iglu::render_graph::PassResources& resources,
+                                                   ICommandBuffer&) {
+                   // imported handles resolve to the imported texture itself
+                   EXPECT_EQ(resources.texture(imported).get(), backbuffer.get());
+                   encoded = true;
+                 }});
+
+  const auto cmdBuffer = graph.execute(*cmdQueue_, &ret);
+  ASSERT_EQ(ret.code, Result::Code::Ok);
+  ASSERT_TRUE(cmdBuffer != nullptr);
+  EXPECT_TRUE(encoded);
+  EXPECT_EQ(graph.getLastCulledPassCount(), 0u);
+}
+
+//
+// transientTexturesWithDisjointLifetimesShareAllocations
+//
+// Two transient textures whose pass spans do not overlap come out of the same pool entry, so
+// the frame allocates one texture, not two.
+//
+TEST_F(RenderGraphTest, transientTexturesWithDisjointLifetimesShareAllocations) {
+  iglu::render_graph::RenderGraph graph(*iglDev_);
+
+  const auto first = graph.declareTexture(transientDesc());
+  const auto second = graph.declareTexture(transientDesc());
+
+  const auto encodeNothing = [](iglu::render_graph::PassResources&, ICommandBuffer&) {};
+
+  // first is produced and consumed before second is ever touched
+  graph.addPass({"produceFirst", {}, {first}, false, encodeNothing});
+  graph.addPass({"consumeFirst", {first}, {}, true, encodeNothing});
+  graph.addPass({"produceSecond", {}, {second}, false, encodeNothing});
+  graph.addPass({"consumeSecond", {second}, {}, true, encodeNothing});
+
+  Result ret;
+  const auto cmdBuffer = graph.execute(*cmdQueue_, &ret);
+  ASSERT_EQ(ret.code, Result::Code::Ok);
+  ASSERT_TRUE(cmdBuffer != nullptr);
+
+  EXPECT_EQ(graph.getTransientPool().getTextureCount(), 1u);
+}
+
+//
+// emptyGraphSubmitsNothing
+//
+// An execute() with no recorded passes is a no-op that reports Ok.
+//
+TEST_F(RenderGraphTest, emptyGraphSubmitsNothing) {
+  iglu::render_graph::RenderGraph graph(*iglDev_);
+
+  Result ret;
+  const auto cmdBuffer = graph.execute(*cmdQueue_, &ret);
+  EXPECT_EQ(ret.code, Result::Code::Ok);
+  EXPECT_TRUE(cmdBuffer == nullptr);
+}
+
+} // namespace tests
+} // namespace igl
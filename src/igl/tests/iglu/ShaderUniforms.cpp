@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "../util/Common.h"
+
+#include <IGLU/simple_renderer/ShaderUniforms.h>
+#include <gtest/gtest.h>
+#include <igl/IGL.h>
+
+namespace igl {
+namespace tests {
+
+namespace {
+
+// Reflection stub exposing one uniform block; ShaderUniforms only reads the reflection lists,
+// so no compiled shader is needed.
+class StubReflection final : public IRenderPipelineReflection {
+ public:
+  const std::vector<BufferArgDesc>& allUniformBuffers() const override {
+    return bufferArguments_;
+  }
+  const std::vector<SamplerArgDesc>& allSamplers() const override {
+    return samplerArguments_;
+  }
+  const std::vector<TextureArgDesc>& allTextures() const override {
+    return textureArguments_;
+  }
+
+  std::vector<BufferArgDesc> bufferArguments_;
+  std::vector<SamplerArgDesc> samplerArguments_;
+  std::vector<TextureArgDesc> textureArguments_;
+};
+
+StubReflection makeReflection() {
+  BufferArgDesc block;
+  block.name = igl::genNameHandle("LightParams");
+  block.bufferDataSize = 32; // float4 color + float intensity (+ padding)
+  block.bufferIndex = 1;
+  block.isUniformBlock = true;
+  block.shaderStage = ShaderStage::Fragment;
+  block.members = {
+      {igl::genNameHandle("color"), UniformType::Float4, 0, 1},
+      {igl::genNameHandle("intensity"), UniformType::Float, 16, 1},
+  };
+
+  StubReflection reflection;
+  reflection.bufferArguments_.push_back(std::move(block));
+  return reflection;
+}
+
+} // namespace
+
+//
+// ShaderUniformsTest
+//
+// Exercises the compiled-binding slot API against a reflection stub.
+//
+class ShaderUniformsTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    setDebugBreakEnabled(false);
+
+    util::createDeviceAndQueue(iglDev_, cmdQueue_);
+    ASSERT_TRUE(iglDev_ != nullptr);
+    ASSERT_TRUE(cmdQueue_ != nullptr);
+  }
+
+  std::shared_ptr<IDevice> iglDev_;
+  std::shared_ptr<ICommandQueue> cmdQueue_;
+};
+
+TEST_F(ShaderUniformsTest, BlockMemberSlotLookupIsCached) {
+  const StubReflection reflection = makeReflection();
+  iglu::material::ShaderUniforms uniforms(*iglDev_, reflection);
+
+  // the block type and instance share a name so the lookup resolves on every backend
+  const auto blockName = igl::genNameHandle("LightParams");
+
+  const auto colorSlot = uniforms.getUniformSlot(blockName, blockName, igl::genNameHandle("color"));
+  ASSERT_NE(colorSlot, iglu::material::ShaderUniforms::kInvalidSlot);
+
+  // a repeated lookup returns the cached slot instead of appending to the slot table
+  EXPECT_EQ(uniforms.getUniformSlot(blockName, blockName, igl::genNameHandle("color")), colorSlot);
+
+  // slots are sequential table indices, so the next unique member resolving to colorSlot + 1
+  // proves the repeated lookup above did not grow the table
+  const auto intensitySlot =
+      uniforms.getUniformSlot(blockName, blockName, igl::genNameHandle("intensity"));
+  EXPECT_EQ(intensitySlot, colorSlot + 1);
+}
+
+TEST_F(ShaderUniformsTest, MissingBlockMemberIsCachedAsInvalid) {
+  const StubReflection reflection = makeReflection();
+  iglu::material::ShaderUniforms uniforms(*iglDev_, reflection);
+
+  const auto blockName = igl::genNameHandle("LightParams");
+  const auto missing = igl::genNameHandle("missing");
+
+  // the not-found result is memoized too; both calls fail without touching the slot table
+  EXPECT_EQ(uniforms.getUniformSlot(blockName, blockName, missing),
+            iglu::material::ShaderUniforms::kInvalidSlot);
+  EXPECT_EQ(uniforms.getUniformSlot(blockName, blockName, missing),
+            iglu::material::ShaderUniforms::kInvalidSlot);
+
+  const auto colorSlot = uniforms.getUniformSlot(blockName, blockName, igl::genNameHandle("color"));
+  EXPECT_EQ(colorSlot, 0);
+}
+
+} // namespace tests
+} // namespace igl
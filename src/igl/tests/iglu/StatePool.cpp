@@ -204,5 +204,51 @@ TEST_F(StatePoolTest, renderPipelineDescCachingLRU1) {
   renderPipelineDesc3_.cullMode = renderPipelineDesc1_.cullMode; // restore change
 }
 
+//
+// renderPipelineDescStats Test
+//
+// Tests the pool's hit/miss/size statistics and LRU eviction accounting
+//
+TEST_F(StatePoolTest, renderPipelineDescStats) {
+  Result ret;
+  iglu::state_pool::RenderPipelineStatePool pool;
+
+  auto stats = pool.getStats();
+  ASSERT_EQ(stats.hits, 0);
+  ASSERT_EQ(stats.misses, 0);
+  ASSERT_EQ(stats.size, 0);
+
+  // First lookup misses and populates the cache, second one hits
+  auto ps1 = pool.getOrCreate(*iglDev_, renderPipelineDesc1_, &ret);
+  ASSERT_EQ(ret.code, Result::Code::Ok);
+  ASSERT_TRUE(ps1 != nullptr);
+  auto ps2 = pool.getOrCreate(*iglDev_, renderPipelineDesc1_, &ret);
+  ASSERT_TRUE(ps1 == ps2);
+
+  stats = pool.getStats();
+  ASSERT_EQ(stats.hits, 1);
+  ASSERT_EQ(stats.misses, 1);
+  ASSERT_EQ(stats.size, 1);
+
+  // A different descriptor misses and grows the cache
+  renderPipelineDesc2_.cullMode = igl::CullMode::Front;
+  auto ps3 = pool.getOrCreate(*iglDev_, renderPipelineDesc2_, &ret);
+  ASSERT_EQ(ret.code, Result::Code::Ok);
+  ASSERT_TRUE(ps3 != nullptr);
+  ASSERT_TRUE(ps3 != ps1);
+
+  stats = pool.getStats();
+  ASSERT_EQ(stats.hits, 1);
+  ASSERT_EQ(stats.misses, 2);
+  ASSERT_EQ(stats.size, 2);
+
+  // Shrinking the cache evicts down to the new capacity
+  pool.setCacheSize(1);
+  stats = pool.getStats();
+  ASSERT_EQ(stats.size, 1);
+
+  renderPipelineDesc2_.cullMode = renderPipelineDesc1_.cullMode; // restore change
+}
+
 } // namespace tests
 } // namespace igl
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "../util/Common.h"
+
+#include <IGLU/texture_atlas/TextureAtlas.h>
+#include <gtest/gtest.h>
+
+namespace igl {
+namespace tests {
+
+//
+// TextureAtlasTest
+//
+// Tests for the IGLU shelf packer and the atlas/array builders.
+//
+class TextureAtlasTest : public ::testing::Test {
+ public:
+  TextureAtlasTest() = default;
+  ~TextureAtlasTest() override = default;
+
+  void SetUp() override {
+    setDebugBreakEnabled(false);
+
+    util::createDeviceAndQueue(iglDev_, cmdQueue_);
+    ASSERT_TRUE(iglDev_ != nullptr);
+    ASSERT_TRUE(cmdQueue_ != nullptr);
+  }
+
+  void TearDown() override {}
+
+  std::shared_ptr<IDevice> iglDev_;
+  std::shared_ptr<ICommandQueue> cmdQueue_;
+};
+
+//
+// ShelfPacker
+//
+// Rectangles of the same height share a shelf, a taller rectangle opens a new
+// shelf below, and insertion fails once the page is exhausted.
+//
+TEST_F(TextureAtlasTest, ShelfPacker) {
+  iglu::textureatlas::ShelfPacker packer(64, 64);
+
+  iglu::textureatlas::ShelfPacker::Rect first;
+  iglu::textureatlas::ShelfPacker::Rect second;
+  ASSERT_TRUE(packer.insert(16, 16, first));
+  ASSERT_TRUE(packer.insert(16, 16, second));
+  ASSERT_EQ(first.y, second.y); // same shelf
+  ASSERT_EQ(second.x, first.x + 16);
+
+  iglu::textureatlas::ShelfPacker::Rect tall;
+  ASSERT_TRUE(packer.insert(16, 32, tall));
+  ASSERT_EQ(tall.y, 16u); // new shelf below the first one
+
+  // too large in either dimension fails immediately
+  iglu::textureatlas::ShelfPacker::Rect huge;
+  ASSERT_FALSE(packer.insert(128, 16, huge));
+  ASSERT_FALSE(packer.insert(16, 128, huge));
+
+  // fill the remaining space; at some point the page must report full
+  iglu::textureatlas::ShelfPacker::Rect rect;
+  size_t inserted = 0;
+  while (packer.insert(16, 16, rect) && inserted < 64) {
+    inserted++;
+  }
+  ASSERT_LT(inserted, 64u);
+  ASSERT_FALSE(packer.insert(16, 16, rect));
+
+  packer.reset();
+  ASSERT_TRUE(packer.insert(16, 16, rect));
+  ASSERT_EQ(rect.x, 0u);
+  ASSERT_EQ(rect.y, 0u);
+}
+
+//
+// AtlasInsertUpdateFlush
+//
+// Inserts two images, flushes them in one batch and verifies slot rectangles
+// and UVs; then updates one slot and flushes again.
+//
+TEST_F(TextureAtlasTest, AtlasInsertUpdateFlush) {
+  Result ret;
+  iglu::textureatlas::TextureAtlas::Desc desc;
+  desc.width = 64;
+  desc.height = 64;
+  desc.padding = 0;
+  auto atlas = iglu::textureatlas::TextureAtlas::create(*iglDev_, desc, &ret);
+  ASSERT_TRUE(ret.isOk()) << ret.message.c_str();
+  ASSERT_TRUE(atlas != nullptr);
+  ASSERT_TRUE(atlas->texture() != nullptr);
+
+  const std::vector<uint32_t> pixels(16 * 16, 0xFFC0FFEE);
+  const auto slotA = atlas->insert(pixels.data(), 16, 16);
+  const auto slotB = atlas->insert(pixels.data(), 16, 16);
+  ASSERT_NE(slotA, iglu::textureatlas::kInvalidSlot);
+  ASSERT_NE(slotB, iglu::textureatlas::kInvalidSlot);
+  ASSERT_NE(slotA, slotB);
+
+  const auto rectA = atlas->rect(slotA);
+  ASSERT_EQ(rectA.width, 16u);
+  ASSERT_EQ(rectA.height, 16u);
+
+  const auto uv = atlas->uvRect(slotA);
+  ASSERT_FLOAT_EQ(uv.u1 - uv.u0, 16.0f / 64.0f);
+  ASSERT_FLOAT_EQ(uv.v1 - uv.v0, 16.0f / 64.0f);
+
+  auto token = atlas->flush(&ret);
+  ASSERT_TRUE(ret.isOk()) << ret.message.c_str();
+  ASSERT_TRUE(token != nullptr);
+  token->wait();
+  ASSERT_TRUE(token->isCompleted());
+
+  // incremental update of one slot only
+  const std::vector<uint32_t> newPixels(16 * 16, 0xFF00FF00);
+  ASSERT_TRUE(atlas->update(slotB, newPixels.data()).isOk());
+  ASSERT_FALSE(atlas->update(12345, newPixels.data()).isOk());
+  token = atlas->flush(&ret);
+  ASSERT_TRUE(ret.isOk()) << ret.message.c_str();
+  ASSERT_TRUE(token != nullptr);
+
+  // flushing with nothing staged returns a valid token too
+  token = atlas->flush(&ret);
+  ASSERT_TRUE(ret.isOk()) << ret.message.c_str();
+  ASSERT_TRUE(token != nullptr);
+}
+
+//
+// ArrayBuilder
+//
+// Layers are handed out in order, update re-stages one layer, and insertion
+// fails once all layers are taken.
+//
+TEST_F(TextureAtlasTest, ArrayBuilder) {
+  Result ret;
+  iglu::textureatlas::TextureArrayBuilder::Desc desc;
+  desc.width = 8;
+  desc.height = 8;
+  desc.numLayers = 2;
+  auto builder = iglu::textureatlas::TextureArrayBuilder::create(*iglDev_, desc, &ret);
+  ASSERT_TRUE(ret.isOk()) << ret.message.c_str();
+  ASSERT_TRUE(builder != nullptr);
+
+  const std::vector<uint32_t> pixels(8 * 8, 0xFFFFFFFF);
+  ASSERT_EQ(builder->insert(pixels.data()), 0u);
+  ASSERT_EQ(builder->insert(pixels.data()), 1u);
+  ASSERT_EQ(builder->insert(pixels.data()), iglu::textureatlas::kInvalidSlot);
+
+  ASSERT_TRUE(builder->update(0, pixels.data()).isOk());
+  ASSERT_FALSE(builder->update(2, pixels.data()).isOk());
+
+  auto token = builder->flush(&ret);
+  ASSERT_TRUE(ret.isOk()) << ret.message.c_str();
+  ASSERT_TRUE(token != nullptr);
+  token->wait();
+}
+
+} // namespace tests
+} // namespace igl
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <IGLU/simple_renderer/VertexDataOptimizer.h>
+#include <gtest/gtest.h>
+#include <igl/IGL.h>
+#include <vector>
+
+namespace igl {
+namespace tests {
+
+namespace {
+
+// Interleaved position (Float3) + normal (Float3) + uv (Float2) vertex, the
+// layout VertexDataOptimizer is primarily aimed at.
+struct TestVertex {
+  float position[3];
+  float normal[3];
+  float uv[2];
+};
+
+VertexInputStateDesc testInputStateDesc() {
+  VertexInputStateDesc desc;
+  desc.numAttributes = 3;
+  desc.attributes[0] = VertexAttribute(
+      0, VertexAttributeFormat::Float3, offsetof(TestVertex, position), "position", 0);
+  desc.attributes[1] =
+      VertexAttribute(0, VertexAttributeFormat::Float3, offsetof(TestVertex, normal), "normal", 1);
+  desc.attributes[2] =
+      VertexAttribute(0, VertexAttributeFormat::Float2, offsetof(TestVertex, uv), "uv", 2);
+  desc.numInputBindings = 1;
+  desc.inputBindings[0].stride = sizeof(TestVertex);
+  return desc;
+}
+
+// A unit quad in the XY plane: two triangles sharing an edge.
+const std::vector<TestVertex> kQuadVertices = {
+    {{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 1.0f}, {0.0f, 0.0f}},
+    {{1.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 1.0f}, {1.0f, 0.0f}},
+    {{1.0f, 1.0f, 0.0f}, {0.0f, 0.0f, 1.0f}, {1.0f, 1.0f}},
+    {{0.0f, 1.0f, 0.0f}, {0.0f, 0.0f, 1.0f}, {0.0f, 1.0f}},
+};
+const std::vector<uint32_t> kQuadIndices = {0, 1, 2, 2, 3, 0};
+
+} // namespace
+
+//
+// VertexDataOptimizerTest
+//
+// Pure CPU tests for iglu::vertexdata::optimizeVertexData(). No device is
+// needed; the pass only rewrites buffers and the input state descriptor.
+//
+class VertexDataOptimizerTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    setDebugBreakEnabled(false);
+  }
+};
+
+//
+// ReorderOnly
+//
+// Runs the reordering stages without quantization and verifies the mesh comes
+// back the same size with the original vertex layout and valid indices.
+//
+TEST_F(VertexDataOptimizerTest, ReorderOnly) {
+  const auto inputDesc = testInputStateDesc();
+
+  iglu::vertexdata::VertexOptimizationOptions options;
+  iglu::vertexdata::OptimizedVertexData optimized;
+  Result ret;
+  ASSERT_TRUE(iglu::vertexdata::optimizeVertexData(inputDesc,
+                                                   kQuadVertices.data(),
+                                                   kQuadVertices.size(),
+                                                   kQuadIndices.data(),
+                                                   kQuadIndices.size(),
+                                                   options,
+                                                   optimized,
+                                                   &ret));
+  ASSERT_TRUE(ret.isOk());
+
+  // Every vertex is referenced, so none may be dropped and the layout is untouched.
+  ASSERT_EQ(optimized.vertexCount, kQuadVertices.size());
+  ASSERT_EQ(optimized.inputStateDesc.inputBindings[0].stride, sizeof(TestVertex));
+  ASSERT_EQ(optimized.vertexData.size(), kQuadVertices.size() * sizeof(TestVertex));
+  ASSERT_EQ(optimized.indexData.size(), kQuadIndices.size());
+  for (const uint32_t index : optimized.indexData) {
+    ASSERT_LT(index, optimized.vertexCount);
+  }
+}
+
+//
+// Quantization
+//
+// Quantizes normals to 10-10-10-2 and UVs to half floats and verifies the
+// rewritten descriptor: new formats, tightly repacked offsets and stride.
+//
+TEST_F(VertexDataOptimizerTest, Quantization) {
+  const auto inputDesc = testInputStateDesc();
+
+  iglu::vertexdata::VertexOptimizationOptions options;
+  options.normalAttributeIndex = 1;
+  options.uvAttributeIndex = 2;
+
+  iglu::vertexdata::OptimizedVertexData optimized;
+  Result ret;
+  ASSERT_TRUE(iglu::vertexdata::optimizeVertexData(inputDesc,
+                                                   kQuadVertices.data(),
+                                                   kQuadVertices.size(),
+                                                   kQuadIndices.data(),
+                                                   kQuadIndices.size(),
+                                                   options,
+                                                   optimized,
+                                                   &ret));
+  ASSERT_TRUE(ret.isOk());
+
+  // 12 bytes of position followed by a packed normal and a half-float UV pair.
+  ASSERT_EQ(optimized.inputStateDesc.attributes[0].format, VertexAttributeFormat::Float3);
+  ASSERT_EQ(optimized.inputStateDesc.attributes[0].offset, 0u);
+  ASSERT_EQ(optimized.inputStateDesc.attributes[1].format,
+            VertexAttributeFormat::Int_2_10_10_10_REV);
+  ASSERT_EQ(optimized.inputStateDesc.attributes[1].offset, 12u);
+  ASSERT_EQ(optimized.inputStateDesc.attributes[2].format, VertexAttributeFormat::HalfFloat2);
+  ASSERT_EQ(optimized.inputStateDesc.attributes[2].offset, 16u);
+  ASSERT_EQ(optimized.inputStateDesc.inputBindings[0].stride, 20u);
+
+  ASSERT_EQ(optimized.vertexCount, kQuadVertices.size());
+  ASSERT_EQ(optimized.vertexData.size(), optimized.vertexCount * 20u);
+}
+
+//
+// InvalidInput
+//
+// Multiple buffer bindings and non-triangle index counts are rejected.
+//
+TEST_F(VertexDataOptimizerTest, InvalidInput) {
+  auto inputDesc = testInputStateDesc();
+  inputDesc.numInputBindings = 2;
+
+  iglu::vertexdata::VertexOptimizationOptions options;
+  iglu::vertexdata::OptimizedVertexData optimized;
+  Result ret;
+  ASSERT_FALSE(iglu::vertexdata::optimizeVertexData(inputDesc,
+                                                    kQuadVertices.data(),
+                                                    kQuadVertices.size(),
+                                                    kQuadIndices.data(),
+                                                    kQuadIndices.size(),
+                                                    options,
+                                                    optimized,
+                                                    &ret));
+  ASSERT_EQ(ret.code, Result::Code::ArgumentInvalid);
+
+  inputDesc = testInputStateDesc();
+  ASSERT_FALSE(iglu::vertexdata::optimizeVertexData(inputDesc,
+                                                    kQuadVertices.data(),
+                                                    kQuadVertices.size(),
+                                                    kQuadIndices.data(),
+                                                    4, // not a multiple of 3
+                                                    options,
+                                                    optimized,
+                                                    &ret));
+  ASSERT_EQ(ret.code, Result::Code::ArgumentInvalid);
+}
+
+} // namespace tests
+} // namespace igl
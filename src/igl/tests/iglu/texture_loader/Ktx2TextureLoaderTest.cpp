@@ -38,6 +38,7 @@ void put(std::vector<uint8_t>& buffer, uint32_t offset, T data) {
 
 constexpr uint32_t kHeaderSize = 80u;
 constexpr uint32_t kOffsetVkFormat = 12u;
+constexpr uint32_t kOffsetSupercompressionScheme = 44u;
 constexpr uint32_t kOffsetTypeSize = 16u;
 constexpr uint32_t kOffsetWidth = 20u;
 constexpr uint32_t kOffsetHeight = 24u;
@@ -152,6 +153,29 @@ void putDfd(std::vector<uint8_t>& buffer, uint32_t vkFormat, uint32_t numMipLeve
   put(buffer, dfdMetadataffset + 40u, sampleUpper);
 }
 
+// Bytes a raw-block Zstd frame adds around its payload:
+// 4 (magic) + 1 (frame header descriptor) + 2 (frame content size) + 3 (block header)
+constexpr uint32_t kZstdFrameOverhead = 10u;
+
+// Writes a valid Zstd frame holding 'contentSize' uncompressed bytes as a single raw block. The
+// payload bytes are whatever is already in the buffer (zeroes). Supports contentSize in
+// [256, 65791], which is enough to wrap one mip level's worth of data in the tests below.
+void putZstdRawFrame(std::vector<uint8_t>& buffer, uint32_t offset, uint32_t contentSize) {
+  if (contentSize < 256u || contentSize > 65791u) {
+    throw std::runtime_error("Unsupported Zstd frame content size");
+  }
+
+  put(buffer, offset, 0xFD2FB528u); // magic
+  // Single_Segment_Flag plus a 2-byte Frame_Content_Size field (stored value is size - 256)
+  put(buffer, offset + 4u, static_cast<uint8_t>(0x60u));
+  put(buffer, offset + 5u, static_cast<uint16_t>(contentSize - 256u));
+  // Block header: Last_Block = 1, Block_Type = 0 (raw), Block_Size = contentSize
+  const uint32_t blockHeader = (contentSize << 3u) | 1u;
+  put(buffer, offset + 7u, static_cast<uint8_t>(blockHeader & 0xFFu));
+  put(buffer, offset + 8u, static_cast<uint8_t>((blockHeader >> 8u) & 0xFFu));
+  put(buffer, offset + 9u, static_cast<uint8_t>((blockHeader >> 16u) & 0xFFu));
+}
+
 void putMipLevel(std::vector<uint8_t>& buffer, uint32_t mipLevel, uint32_t imageSize) {
   const auto* header = reinterpret_cast<const iglu::textureloader::ktx2::Header*>(buffer.data());
   const auto format =
@@ -453,6 +477,60 @@ TEST_F(Ktx2TextureLoaderTest, InvalidHeaderWithExcessiveMipLevels_Fails) {
   EXPECT_FALSE(ret.isOk());
 }
 
+TEST_F(Ktx2TextureLoaderTest, ZstdSupercompressedLevelData_Succeeds) {
+  const uint32_t width = 64u;
+  const uint32_t height = 32u;
+  const uint32_t numMipLevels = 1u;
+  const uint32_t bytesOfKeyValueData = 0u;
+  const uint32_t imageSize = 512u;
+  const uint32_t vkFormat = 1000054004u; /* VK_FORMAT_PVRTC1_2BPP_SRGB_BLOCK_IMG */
+  const uint32_t totalHeaderSize = getTotalHeaderSize(numMipLevels, bytesOfKeyValueData);
+  const uint32_t compressedSize = kZstdFrameOverhead + imageSize;
+
+  auto buffer = getBuffer(totalHeaderSize + compressedSize);
+  populateMinimalValidFile(
+      buffer, vkFormat, width, height, numMipLevels, bytesOfKeyValueData, imageSize);
+
+  // Rewrite the file as Zstd-supercompressed: levels are tightly packed and the level's
+  // byteLength is the compressed length while uncompressedByteLength stays the texel size.
+  put(buffer, kOffsetSupercompressionScheme, 2u /* KTX_SS_ZSTD */);
+  put(buffer, kHeaderSize + 8u, static_cast<uint64_t>(compressedSize));
+  putZstdRawFrame(buffer, totalHeaderSize, imageSize);
+
+  Result ret;
+  auto reader = *iglu::textureloader::DataReader::tryCreate(
+      buffer.data(), static_cast<uint32_t>(buffer.size()), nullptr);
+  auto loader = factory_.tryCreate(reader, &ret);
+  EXPECT_NE(loader, nullptr);
+  EXPECT_TRUE(ret.isOk()) << ret.message;
+}
+
+TEST_F(Ktx2TextureLoaderTest, ZstdSupercompressedTruncatedLevelData_Fails) {
+  const uint32_t width = 64u;
+  const uint32_t height = 32u;
+  const uint32_t numMipLevels = 1u;
+  const uint32_t bytesOfKeyValueData = 0u;
+  const uint32_t imageSize = 512u;
+  const uint32_t vkFormat = 1000054004u; /* VK_FORMAT_PVRTC1_2BPP_SRGB_BLOCK_IMG */
+  const uint32_t totalHeaderSize = getTotalHeaderSize(numMipLevels, bytesOfKeyValueData);
+  const uint32_t compressedSize = kZstdFrameOverhead + imageSize;
+
+  // One byte short of the declared compressed level length
+  auto buffer = getBuffer(totalHeaderSize + compressedSize - 1u);
+  populateMinimalValidFile(
+      buffer, vkFormat, width, height, numMipLevels, bytesOfKeyValueData, imageSize);
+
+  put(buffer, kOffsetSupercompressionScheme, 2u /* KTX_SS_ZSTD */);
+  put(buffer, kHeaderSize + 8u, static_cast<uint64_t>(compressedSize));
+
+  Result ret;
+  auto reader = *iglu::textureloader::DataReader::tryCreate(
+      buffer.data(), static_cast<uint32_t>(buffer.size()), nullptr);
+  auto loader = factory_.tryCreate(reader, &ret);
+  EXPECT_EQ(loader, nullptr);
+  EXPECT_FALSE(ret.isOk());
+}
+
 TEST_F(Ktx2TextureLoaderTest, InvalidHeaderWithExcessiveKeyValueData_Fails) {
   const uint32_t width = 64u;
   const uint32_t height = 32u;
@@ -373,5 +373,44 @@ TEST_F(ContextOGLTest, BasicSharedContexts) {
   ASSERT_FALSE(unsharedContext->isTexture(glTextureId));
 }
 
+/// Snapshotting the shadowed state and restoring it after external changes (simulated here with
+/// invalidateCachedState() plus direct state changes) should bring the driver state back.
+TEST_F(ContextOGLTest, SaveRestoreContextState) {
+  context_->enable(GL_CULL_FACE);
+  context_->cullFace(GL_FRONT);
+  context_->depthMask(GL_FALSE);
+  context_->blendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ZERO);
+
+  opengl::IContext::StateShadow snapshot;
+  context_->saveContextState(snapshot);
+
+  // a "host renderer" changes state behind IGL's back
+  context_->invalidateCachedState();
+  context_->disable(GL_CULL_FACE);
+  context_->cullFace(GL_BACK);
+  context_->depthMask(GL_TRUE);
+  context_->blendFuncSeparate(GL_ONE, GL_ZERO, GL_ONE, GL_ZERO);
+
+  context_->invalidateCachedState();
+  context_->restoreContextState(snapshot);
+
+  GLboolean boolValue = GL_TRUE;
+  context_->getBooleanv(GL_DEPTH_WRITEMASK, &boolValue);
+  ASSERT_EQ(boolValue, GL_FALSE);
+
+  GLint intValue = 0;
+  context_->getIntegerv(GL_CULL_FACE_MODE, &intValue);
+  ASSERT_EQ(intValue, GL_FRONT);
+
+  intValue = 0;
+  context_->getIntegerv(GL_BLEND_SRC_RGB, &intValue);
+  ASSERT_EQ(intValue, GL_SRC_ALPHA);
+  intValue = 0;
+  context_->getIntegerv(GL_BLEND_DST_RGB, &intValue);
+  ASSERT_EQ(intValue, GL_ONE_MINUS_SRC_ALPHA);
+
+  ASSERT_TRUE(context_->isEnabled(GL_CULL_FACE));
+}
+
 } // namespace tests
 } // namespace igl
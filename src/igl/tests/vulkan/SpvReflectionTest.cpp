@@ -934,6 +934,9 @@ TEST(SpvReflectionTest, UniformBufferTest) {
   ASSERT_EQ(spvModuleInfo.uniformBuffers.size(), 2);
   EXPECT_EQ(spvModuleInfo.uniformBuffers[0].bindingLocation, 0);
   EXPECT_EQ(spvModuleInfo.uniformBuffers[1].bindingLocation, 3);
+  // both blocks hold a single float
+  EXPECT_EQ(spvModuleInfo.uniformBuffers[0].size, 4u);
+  EXPECT_EQ(spvModuleInfo.uniformBuffers[1].size, 4u);
   EXPECT_EQ(spvModuleInfo.storageBuffers.size(), 0);
 }
 
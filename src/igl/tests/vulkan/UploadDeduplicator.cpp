@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <cstring>
+#include <gtest/gtest.h>
+#include <igl/vulkan/UploadDeduplicator.h>
+
+namespace igl::tests {
+
+using igl::vulkan::UploadDeduplicator;
+
+TEST(UploadDeduplicatorTest, HashIsStableAndContentSensitive) {
+  const uint8_t bytesA[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+  uint8_t bytesB[sizeof(bytesA)];
+  memcpy(bytesB, bytesA, sizeof(bytesA));
+
+  // same bytes hash the same, regardless of the memory they live in
+  ASSERT_EQ(UploadDeduplicator::hashBytes(bytesA, sizeof(bytesA)),
+            UploadDeduplicator::hashBytes(bytesB, sizeof(bytesB)));
+
+  // a single flipped byte (in the word-wide head and in the byte-wise tail) changes the hash
+  bytesB[0] ^= 0xff;
+  ASSERT_NE(UploadDeduplicator::hashBytes(bytesA, sizeof(bytesA)),
+            UploadDeduplicator::hashBytes(bytesB, sizeof(bytesB)));
+  bytesB[0] = bytesA[0];
+  bytesB[sizeof(bytesB) - 1] ^= 0xff;
+  ASSERT_NE(UploadDeduplicator::hashBytes(bytesA, sizeof(bytesA)),
+            UploadDeduplicator::hashBytes(bytesB, sizeof(bytesB)));
+
+  // the length is mixed in, so a prefix does not collide with the full range
+  ASSERT_NE(UploadDeduplicator::hashBytes(bytesA, sizeof(bytesA)),
+            UploadDeduplicator::hashBytes(bytesA, sizeof(bytesA) - 1));
+}
+
+TEST(UploadDeduplicatorTest, RepeatedUploadIsDuplicate) {
+  UploadDeduplicator dedup;
+  const auto range = TextureRangeDesc::new2D(0, 0, 16, 16);
+  const uint64_t hash = 0x1234;
+
+  // first sighting records, repeats match
+  ASSERT_FALSE(dedup.isDuplicate(range, 0, hash));
+  ASSERT_TRUE(dedup.isDuplicate(range, 0, hash));
+  ASSERT_TRUE(dedup.isDuplicate(range, 0, hash));
+
+  // same range with different content or row pitch is not a duplicate
+  ASSERT_FALSE(dedup.isDuplicate(range, 0, hash + 1));
+  ASSERT_FALSE(dedup.isDuplicate(range, 64, hash));
+}
+
+TEST(UploadDeduplicatorTest, DisjointRangesAreRememberedIndependently) {
+  UploadDeduplicator dedup;
+  const auto left = TextureRangeDesc::new2D(0, 0, 8, 8);
+  const auto right = TextureRangeDesc::new2D(8, 0, 8, 8);
+
+  ASSERT_FALSE(dedup.isDuplicate(left, 0, 0x1));
+  ASSERT_FALSE(dedup.isDuplicate(right, 0, 0x2));
+
+  // alternating uploads into disjoint regions keep both memo entries alive
+  ASSERT_TRUE(dedup.isDuplicate(left, 0, 0x1));
+  ASSERT_TRUE(dedup.isDuplicate(right, 0, 0x2));
+}
+
+TEST(UploadDeduplicatorTest, OverlappingUploadEvictsStaleEntries) {
+  UploadDeduplicator dedup;
+  const auto full = TextureRangeDesc::new2D(0, 0, 16, 16);
+  const auto corner = TextureRangeDesc::new2D(0, 0, 4, 4);
+
+  ASSERT_FALSE(dedup.isDuplicate(full, 0, 0x1));
+
+  // a partial overwrite invalidates the remembered full range: re-uploading the old full-range
+  // bytes afterwards must not be skipped, the texture contents have changed
+  ASSERT_FALSE(dedup.isDuplicate(corner, 0, 0x2));
+  ASSERT_FALSE(dedup.isDuplicate(full, 0, 0x1));
+
+  // different mip levels never overlap
+  const auto mip1 = TextureRangeDesc::new2D(0, 0, 8, 8, 1);
+  ASSERT_FALSE(dedup.isDuplicate(mip1, 0, 0x3));
+  ASSERT_TRUE(dedup.isDuplicate(full, 0, 0x1));
+}
+
+TEST(UploadDeduplicatorTest, BufferRangesUseByteOffsets) {
+  UploadDeduplicator dedup;
+
+  ASSERT_FALSE(dedup.isDuplicate(uint64_t(0), 256, 0x1));
+  ASSERT_FALSE(dedup.isDuplicate(uint64_t(256), 256, 0x2));
+  ASSERT_TRUE(dedup.isDuplicate(uint64_t(0), 256, 0x1));
+
+  // an overlapping write straddling both ranges evicts them
+  ASSERT_FALSE(dedup.isDuplicate(uint64_t(128), 256, 0x3));
+  ASSERT_FALSE(dedup.isDuplicate(uint64_t(0), 256, 0x1));
+  ASSERT_FALSE(dedup.isDuplicate(uint64_t(256), 256, 0x2));
+}
+
+TEST(UploadDeduplicatorTest, InvalidateForgetsEverything) {
+  UploadDeduplicator dedup;
+  const auto range = TextureRangeDesc::new2D(0, 0, 16, 16);
+
+  ASSERT_FALSE(dedup.isDuplicate(range, 0, 0x1));
+  ASSERT_TRUE(dedup.isDuplicate(range, 0, 0x1));
+
+  dedup.invalidate();
+  ASSERT_FALSE(dedup.isDuplicate(range, 0, 0x1));
+}
+
+} // namespace igl::tests
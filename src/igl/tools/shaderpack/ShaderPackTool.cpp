@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// Offline shader packer: compiles a manifest of GLSL shaders to SPIR-V at build time and writes
+// them into a pack file that igl::vulkan::VulkanShaderPack maps at runtime (see
+// VulkanContextConfig::shaderPackFilePath). Shipping packs instead of sources lets applications
+// build the Vulkan backend with IGL_VULKAN_NO_RUNTIME_SHADER_COMPILER and drop glslang from the
+// binary entirely.
+//
+// Usage: igl_shader_pack <manifest> <output.pack>
+//
+// The manifest lists one shader per line as `<stage> <path>` with stage one of vert, frag or
+// comp; blank lines and lines starting with '#' are ignored. Sources must carry their own
+// `#version` header - the runtime only skips its header patching (and so produces matching
+// hashes) for such sources.
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <igl/vulkan/VulkanHelpers.h>
+#include <igl/vulkan/VulkanShaderModule.h>
+#include <igl/vulkan/VulkanShaderPack.h>
+
+namespace {
+
+bool parseStage(const std::string& token, VkShaderStageFlagBits& outStage) {
+  if (token == "vert") {
+    outStage = VK_SHADER_STAGE_VERTEX_BIT;
+  } else if (token == "frag") {
+    outStage = VK_SHADER_STAGE_FRAGMENT_BIT;
+  } else if (token == "comp") {
+    outStage = VK_SHADER_STAGE_COMPUTE_BIT;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+bool readTextFile(const std::string& path, std::string& outText) {
+  std::ifstream file(path, std::ios::in | std::ios::binary);
+  if (!file) {
+    return false;
+  }
+  std::ostringstream contents;
+  contents << file.rdbuf();
+  outText = contents.str();
+  return true;
+}
+
+struct PackedShader {
+  uint64_t hash = 0;
+  std::vector<uint32_t> spirv;
+  std::string path;
+};
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+  if (argc != 3) {
+    fprintf(stderr, "Usage: %s <manifest> <output.pack>\n", argv[0]);
+    return 1;
+  }
+
+  std::ifstream manifest(argv[1]);
+  if (!manifest) {
+    fprintf(stderr, "Cannot open manifest: %s\n", argv[1]);
+    return 1;
+  }
+
+  glslang_initialize_process();
+
+  // compileShader() never touches the function table or the device - only the glslang front end
+  // runs here, so no Vulkan instance is needed
+  const VulkanFunctionTable vf = {};
+
+  glslang_resource_t glslangResource;
+  ivkGlslangResource(&glslangResource, nullptr);
+
+  std::vector<PackedShader> shaders;
+  std::string line;
+  uint32_t lineNumber = 0;
+  while (std::getline(manifest, line)) {
+    lineNumber++;
+    std::istringstream tokens(line);
+    std::string stageToken;
+    std::string path;
+    if (!(tokens >> stageToken) || stageToken[0] == '#') {
+      continue;
+    }
+    VkShaderStageFlagBits stage = VK_SHADER_STAGE_FLAG_BITS_MAX_ENUM;
+    if (!parseStage(stageToken, stage) || !(tokens >> path)) {
+      fprintf(stderr, "%s:%u: expected `<vert|frag|comp> <path>`\n", argv[1], lineNumber);
+      glslang_finalize_process();
+      return 1;
+    }
+
+    std::string source;
+    if (!readTextFile(path, source)) {
+      fprintf(stderr, "%s:%u: cannot read shader: %s\n", argv[1], lineNumber, path.c_str());
+      glslang_finalize_process();
+      return 1;
+    }
+    if (source.find("#version") == std::string::npos) {
+      fprintf(stderr,
+              "%s:%u: %s has no #version header; the runtime would patch (and re-hash) it\n",
+              argv[1],
+              lineNumber,
+              path.c_str());
+      glslang_finalize_process();
+      return 1;
+    }
+
+    PackedShader shader;
+    shader.path = path;
+    shader.hash = igl::vulkan::VulkanShaderPack::hashShaderSource(source.c_str(), stage);
+    const igl::Result result = igl::vulkan::compileShader(
+        vf, VK_NULL_HANDLE, stage, source.c_str(), shader.spirv, &glslangResource);
+    if (!result.isOk() || shader.spirv.empty()) {
+      fprintf(stderr, "%s:%u: failed to compile %s\n", argv[1], lineNumber, path.c_str());
+      glslang_finalize_process();
+      return 1;
+    }
+    shaders.push_back(std::move(shader));
+  }
+
+  glslang_finalize_process();
+
+  if (shaders.empty()) {
+    fprintf(stderr, "%s: manifest lists no shaders\n", argv[1]);
+    return 1;
+  }
+
+  // the runtime binary-searches the directory, so entries are sorted by hash
+  std::sort(shaders.begin(), shaders.end(), [](const PackedShader& a, const PackedShader& b) {
+    return a.hash < b.hash;
+  });
+  for (size_t i = 1; i < shaders.size(); i++) {
+    if (shaders[i - 1].hash == shaders[i].hash) {
+      fprintf(stderr,
+              "Hash collision between %s and %s\n",
+              shaders[i - 1].path.c_str(),
+              shaders[i].path.c_str());
+      return 1;
+    }
+  }
+
+  const char magic[8] = {'I', 'G', 'L', 'S', 'P', 'K', '0', '1'};
+  std::vector<igl::vulkan::VulkanShaderPackEntry> entries(shaders.size());
+  uint64_t offset = sizeof(magic) + sizeof(uint64_t) +
+                    shaders.size() * sizeof(igl::vulkan::VulkanShaderPackEntry);
+  for (size_t i = 0; i < shaders.size(); i++) {
+    entries[i].hash = shaders[i].hash;
+    entries[i].offset = offset;
+    entries[i].sizeInBytes = shaders[i].spirv.size() * sizeof(uint32_t);
+    offset += entries[i].sizeInBytes;
+  }
+
+  std::ofstream out(argv[2], std::ios::out | std::ios::binary);
+  if (!out) {
+    fprintf(stderr, "Cannot write output: %s\n", argv[2]);
+    return 1;
+  }
+  const uint64_t count = shaders.size();
+  out.write(magic, sizeof(magic));
+  out.write(reinterpret_cast<const char*>(&count), sizeof(count));
+  out.write(reinterpret_cast<const char*>(entries.data()),
+            static_cast<std::streamsize>(entries.size() * sizeof(entries[0])));
+  for (const PackedShader& shader : shaders) {
+    out.write(reinterpret_cast<const char*>(shader.spirv.data()),
+              static_cast<std::streamsize>(shader.spirv.size() * sizeof(uint32_t)));
+  }
+  if (!out) {
+    fprintf(stderr, "Write failed: %s\n", argv[2]);
+    return 1;
+  }
+
+  printf("Packed %zu shaders (%llu bytes) into %s\n",
+         shaders.size(),
+         static_cast<unsigned long long>(offset),
+         argv[2]);
+  return 0;
+}
@@ -23,13 +23,62 @@ namespace igl {
 
 namespace vulkan {
 
+namespace {
+
+/// @brief Buffers up to this size are placed into the context's VulkanBufferPools instead of
+/// getting their own VkBuffer
+constexpr size_t kMaxSuballocatedBufferSize = 4096;
+
+/// @brief Staged uploads up to this size are coalesced per buffer and flushed at submission
+/// instead of becoming one staging region and one vkCmdCopyBuffer() each
+constexpr size_t kMaxCoalescedUploadSize = 4096;
+
+} // namespace
+
 Buffer::Buffer(const igl::vulkan::Device& device) : device_(device) {}
 
+Buffer::~Buffer() {
+  device_.getVulkanContext().unregisterPendingBufferUpload(this);
+  if (!suballocation_.valid()) {
+    return;
+  }
+  const VulkanContext& ctx = device_.getVulkanContext();
+  VulkanBufferPool* pool = (desc_.type & BufferDesc::BufferTypeBits::Uniform)
+                               ? ctx.uniformBufferPool_.get()
+                               : ctx.storageBufferPool_.get();
+  // Defer returning the block to the pool until the GPU is done with any work that may still be
+  // reading from it
+  ctx.deferredTask(std::packaged_task<void()>(
+      [pool, suballocation = suballocation_]() { pool->free(suballocation); }));
+}
+
 Result Buffer::create(const BufferDesc& desc) {
   desc_ = desc;
 
   const VulkanContext& ctx = device_.getVulkanContext();
 
+  // Explicit memory placement overrides the ResourceStorage-derived behavior. Keep desc_.storage
+  // in sync so the staging and map() decisions below match the actual memory type.
+  if (desc_.placement != MemoryPlacement::Default) {
+    if (desc_.placement == MemoryPlacement::DeviceLocal && !ctx.useStagingForBuffers_) {
+      desc_.placement = MemoryPlacement::HostUpload; // no upload path without staging
+    }
+    desc_.storage = (desc_.placement == MemoryPlacement::DeviceLocal) ? ResourceStorage::Private
+                                                                      : ResourceStorage::Shared;
+  }
+
+  // Calibrated placement: when the device probe found direct writes into CPU-visible VRAM to be
+  // at least as fast as the staging path, per-frame streamed (ring) buffers that would otherwise
+  // be device-local default into BAR memory, so their uploads skip the staging ring entirely.
+  // Explicit placements always win
+  if (desc_.placement == MemoryPlacement::Default &&
+      (desc_.hint & BufferDesc::BufferAPIHintBits::Ring) != 0 &&
+      desc_.storage == ResourceStorage::Private &&
+      ctx.uploadCalibration_.preferDirectHostVisibleWrites()) {
+    desc_.placement = MemoryPlacement::DeviceLocalHostVisible;
+    desc_.storage = ResourceStorage::Shared;
+  }
+
   if (!ctx.useStagingForBuffers_ && (desc_.storage == ResourceStorage::Private)) {
     desc_.storage = ResourceStorage::Shared;
   }
@@ -67,7 +116,11 @@ Result Buffer::create(const BufferDesc& desc) {
     usageFlags |= VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | optionalBDA;
   }
 
-  const VkMemoryPropertyFlags memFlags = resourceStorageToVkMemoryPropertyFlags(desc_.storage);
+  const VkMemoryPropertyFlags memFlags = (desc_.placement != MemoryPlacement::Default)
+                                             ? memoryPlacementToVkMemoryPropertyFlags(
+                                                   desc_.placement)
+                                             : resourceStorageToVkMemoryPropertyFlags(
+                                                   desc_.storage);
 
   // Store the flag that determines if this buffer contains sub-allocations (i.e. is a ring-buffer)
   isRingBuffer_ = ((desc_.hint & BufferDesc::BufferAPIHintBits::Ring) != 0);
@@ -79,6 +132,26 @@ Result Buffer::create(const BufferDesc& desc) {
     localData_ = std::make_unique<uint8_t[]>(desc_.length);
   }
 
+  // Small host-visible uniform/storage buffers can be suballocated out of a shared page instead of
+  // creating a dedicated VkBuffer per buffer. Only buffers with exactly one type bit are eligible,
+  // since the pool pages are created with usage flags for that one type.
+  // Buffers with an explicit placement are excluded, since the pool pages live in plain
+  // host-visible memory
+  if (ctx.config_.enableBufferSuballocation && !isRingBuffer_ &&
+      desc_.placement == MemoryPlacement::Default &&
+      desc_.storage != ResourceStorage::Private && desc_.length <= kMaxSuballocatedBufferSize &&
+      (desc_.type == BufferDesc::BufferTypeBits::Uniform ||
+       desc_.type == BufferDesc::BufferTypeBits::Storage)) {
+    VulkanBufferPool* pool = (desc_.type == BufferDesc::BufferTypeBits::Uniform)
+                                 ? ctx.uniformBufferPool_.get()
+                                 : ctx.storageBufferPool_.get();
+    suballocation_ = pool->allocate(desc_.length);
+    if (suballocation_.valid()) {
+      return Result();
+    }
+    // fall through to a dedicated VulkanBuffer when the pool could not create a page
+  }
+
   buffers_ = std::make_unique<std::unique_ptr<VulkanBuffer>[]>(bufferCount_);
   bufferPatches_ = std::make_unique<BufferRange[]>(bufferCount_);
   Result result;
@@ -93,6 +166,8 @@ Result Buffer::create(const BufferDesc& desc) {
 }
 
 const std::unique_ptr<VulkanBuffer>& Buffer::currentVulkanBuffer() const {
+  IGL_ASSERT_MSG(!isSuballocated(),
+                 "Suballocated buffers do not own a VulkanBuffer; use getVkBuffer() instead");
   IGL_ASSERT_MSG(buffers_, "There are no sub-allocations available for this buffer");
   return buffers_[isRingBuffer_ ? device_.getVulkanContext().syncManager_->currentIndex() : 0u];
 }
@@ -143,9 +218,21 @@ igl::Result Buffer::upload(const void* data, const BufferRange& range) {
     return igl::Result(Result::Code::ArgumentOutOfRange, "Out of range");
   }
 
+  const VulkanContext& ctx = device_.getVulkanContext();
+
+  // Identical bytes re-uploaded into the same range are dropped before they reach the staging
+  // device. Ring buffers rotate through backing buffers and storage buffers can be written by the
+  // GPU, so neither can trust a CPU-side memo of its contents
+  if (ctx.config_.enableUploadDeduplication && !isRingBuffer_ &&
+      (desc_.type & BufferDesc::BufferTypeBits::Storage) == 0) {
+    if (uploadDedup_.isDuplicate(
+            range.offset, range.size, UploadDeduplicator::hashBytes(data, range.size))) {
+      return igl::Result();
+    }
+  }
+
   // To handle an upload to a ring-buffer, we update the local copy first and upload the entire
   // local data to the device below
-  const VulkanContext& ctx = device_.getVulkanContext();
   if (isRingBuffer_) {
     // update local data copy
     checked_memcpy(localData_.get() + range.offset, range.size, (void*)data, range.size);
@@ -168,13 +255,86 @@ igl::Result Buffer::upload(const void* data, const BufferRange& range) {
                                       currentUpdateRange.offset,
                                       currentUpdateRange.size,
                                       localData_.get() + currentUpdateRange.offset);
+  } else if (isSuballocated()) {
+    // the pool pages are host-visible and kept mapped, so write into them directly
+    suballocation_.buffer->bufferSubData(suballocation_.offset + range.offset, range.size, data);
+  } else if (range.size <= kMaxCoalescedUploadSize) {
+    // Small staged uploads are coalesced: copy the data into a CPU shadow of the buffer and merge
+    // the range into the pending list, then flush the merged ranges as a minimal set of staging
+    // copies right before submission. Thousands of tiny per-frame updates into the same buffer
+    // become a handful of vkCmdCopyBuffer() regions instead of one staging region each
+    bool registerForFlush = false;
+    {
+      const std::lock_guard<std::mutex> lock(pendingUploadsMutex_);
+      if (!shadowData_) {
+        shadowData_ = std::make_unique<uint8_t[]>(desc_.length);
+      }
+      checked_memcpy(shadowData_.get() + range.offset, range.size, (void*)data, range.size);
+      registerForFlush = pendingUploads_.empty();
+      addPendingUpload(range);
+    }
+    if (registerForFlush) {
+      ctx.registerPendingBufferUpload(this);
+    }
   } else {
+    // flush older coalesced writes first so they cannot overwrite this one at submission time
+    {
+      const std::lock_guard<std::mutex> lock(pendingUploadsMutex_);
+      if (!pendingUploads_.empty()) {
+        for (const BufferRange& pending : pendingUploads_) {
+          ctx.stagingDevice_->bufferSubData(*currentVulkanBuffer(),
+                                            pending.offset,
+                                            pending.size,
+                                            shadowData_.get() + pending.offset);
+        }
+        pendingUploads_.clear();
+      }
+    }
     // use staging to upload data to device-local buffers
     ctx.stagingDevice_->bufferSubData(*currentVulkanBuffer(), range.offset, range.size, data);
   }
   return igl::Result();
 }
 
+void Buffer::addPendingUpload(const BufferRange& range) {
+  // insert the range keeping the list sorted by offset
+  auto it = pendingUploads_.begin();
+  while (it != pendingUploads_.end() && it->offset < range.offset) {
+    ++it;
+  }
+  it = pendingUploads_.insert(it, range);
+
+  // merge with the following ranges
+  auto next = it + 1;
+  while (next != pendingUploads_.end() && it->offset + it->size >= next->offset) {
+    const size_t end = std::max(it->offset + it->size, next->offset + next->size);
+    it->size = end - it->offset;
+    next = pendingUploads_.erase(next);
+    it = next - 1;
+  }
+  // merge with the previous range
+  if (it != pendingUploads_.begin()) {
+    const auto prev = it - 1;
+    if (prev->offset + prev->size >= it->offset) {
+      const size_t end = std::max(prev->offset + prev->size, it->offset + it->size);
+      prev->size = end - prev->offset;
+      pendingUploads_.erase(it);
+    }
+  }
+}
+
+void Buffer::flushPendingUploads() {
+  IGL_PROFILER_FUNCTION();
+
+  const VulkanContext& ctx = device_.getVulkanContext();
+  const std::lock_guard<std::mutex> lock(pendingUploadsMutex_);
+  for (const BufferRange& range : pendingUploads_) {
+    ctx.stagingDevice_->bufferSubData(
+        *currentVulkanBuffer(), range.offset, range.size, shadowData_.get() + range.offset);
+  }
+  pendingUploads_.clear();
+}
+
 size_t Buffer::getSizeInBytes() const {
   return desc_.length;
 }
@@ -183,14 +343,24 @@ uint64_t Buffer::gpuAddress(size_t offset) const {
   IGL_ASSERT_MSG((offset & 7) == 0,
                  "Buffer offset must be 8 bytes aligned as per GLSL_EXT_buffer_reference spec.");
 
+  if (isSuballocated()) {
+    return (uint64_t)suballocation_.buffer->getVkDeviceAddress() + suballocation_.offset + offset;
+  }
+
   return (uint64_t)currentVulkanBuffer()->getVkDeviceAddress() + offset;
 }
 
 VkBuffer Buffer::getVkBuffer() const {
+  if (isSuballocated()) {
+    return suballocation_.buffer->getVkBuffer();
+  }
   return currentVulkanBuffer()->getVkBuffer();
 }
 
 VkBufferUsageFlags Buffer::getBufferUsageFlags() const {
+  if (isSuballocated()) {
+    return suballocation_.buffer->getBufferUsageFlags();
+  }
   return currentVulkanBuffer()->getBufferUsageFlags();
 }
 
@@ -214,11 +384,21 @@ void* Buffer::map(const BufferRange& range, igl::Result* outResult) {
 
   mappedRange_ = range;
 
+  // writes through the mapped pointer bypass upload(), so the dedup memo can no longer vouch for
+  // the buffer contents
+  uploadDedup_.invalidate();
+
   Result::setOk(outResult);
 
+  if (isSuballocated()) {
+    // the pool pages are host-visible and kept mapped
+    return suballocation_.buffer->getMappedPtr() + suballocation_.offset + range.offset;
+  }
+
   const auto& buffer = currentVulkanBuffer();
   if (!buffer->isMapped()) {
     // handle DEVICE_LOCAL buffers
+    flushPendingUploads(); // so the download below observes any coalesced writes
     tmpBuffer_.resize(range.size);
     const VulkanContext& ctx = device_.getVulkanContext();
     ctx.stagingDevice_->getBufferSubData(*buffer, range.offset, range.size, tmpBuffer_.data());
@@ -232,6 +412,15 @@ void Buffer::unmap() {
   IGL_ASSERT_MSG(!isRingBuffer_, "Buffer::unmap() operation not supported for ring buffer");
   IGL_ASSERT_MSG(mappedRange_.size, "Called Buffer::unmap() without Buffer::map()");
 
+  if (isSuballocated()) {
+    if (!suballocation_.buffer->isCoherentMemory()) {
+      suballocation_.buffer->flushMappedMemory(suballocation_.offset + mappedRange_.offset,
+                                               mappedRange_.size);
+    }
+    mappedRange_.size = 0;
+    return;
+  }
+
   const auto& buffer = currentVulkanBuffer();
   const BufferRange range(tmpBuffer_.size(), mappedRange_.offset);
   if (!buffer->isMapped()) {
@@ -9,6 +9,11 @@
 
 #include <igl/Buffer.h>
 #include <igl/vulkan/Common.h>
+#include <igl/vulkan/UploadDeduplicator.h>
+#include <igl/vulkan/VulkanBufferPool.h>
+
+#include <mutex>
+#include <vector>
 
 namespace igl {
 namespace vulkan {
@@ -25,7 +30,7 @@ class Buffer final : public igl::IBuffer {
 
  public:
   explicit Buffer(const igl::vulkan::Device& device);
-  ~Buffer() override = default;
+  ~Buffer() override;
 
   Result upload(const void* data, const BufferRange& range) override;
 
@@ -47,16 +52,33 @@ class Buffer final : public igl::IBuffer {
   VkBuffer getVkBuffer() const;
   [[nodiscard]] VkBufferUsageFlags getBufferUsageFlags() const;
 
+  /// @brief Returns true when this buffer lives inside a shared page of one of the context's
+  /// VulkanBufferPools instead of owning its own VulkanBuffer
+  [[nodiscard]] bool isSuballocated() const {
+    return suballocation_.valid();
+  }
+
+  /// @brief Returns the offset of this buffer within the VkBuffer returned by getVkBuffer(). Zero
+  /// unless the buffer is suballocated
+  [[nodiscard]] VkDeviceSize getVkBufferOffset() const {
+    return suballocation_.offset;
+  }
+
   /// @brief Returns the current active VulkanBuffer object managed by this class. Since this class
   /// may be used as a Ring Buffer, the active buffer is the buffer currently being accessed.
   [[nodiscard]] const std::unique_ptr<VulkanBuffer>& currentVulkanBuffer() const;
 
+  /// @brief Issues one staging copy per pending coalesced upload range and clears the pending
+  /// list. Called by VulkanContext right before command buffer submission; @see upload()
+  void flushPendingUploads();
+
  private:
   const igl::vulkan::Device& device_;
   BufferDesc desc_;
   bool isRingBuffer_ = false;
   uint32_t previousBufferIndex_ = UINT32_MAX;
   std::unique_ptr<std::unique_ptr<VulkanBuffer>[]> buffers_;
+  VulkanBufferPool::Suballocation suballocation_;
   std::unique_ptr<uint8_t[]> localData_;
   std::unique_ptr<BufferRange[]> bufferPatches_;
   uint32_t bufferCount_ = 0;
@@ -69,10 +91,30 @@ class Buffer final : public igl::IBuffer {
   void extendUpdateRange(uint32_t ringBufferIndex, const BufferRange& range);
   void resetUpdateRange(uint32_t ringBufferIndex, const BufferRange& range);
 
+  // Merges `range` into pendingUploads_, keeping the list sorted by offset and coalescing
+  // overlapping and adjacent ranges. Must be called with pendingUploadsMutex_ held
+  void addPendingUpload(const BufferRange& range);
+
   // Used for map/unmap API for DEVICE_LOCAL buffers
   std::vector<uint8_t> tmpBuffer_;
   BufferRange mappedRange_ = {};
   BufferDesc::BufferAPIHint requestedApiHints_ = 0;
+
+  // Frame-scoped coalescing of small staged uploads: upload() copies the data into a CPU shadow
+  // of the buffer and merges the range into pendingUploads_ instead of starting one staging copy
+  // per call. The merged ranges are flushed as a minimal set of copies right before command
+  // buffer submission (see VulkanContext::flushPendingBufferUploads()). The shadow is allocated
+  // lazily on the first coalesced upload
+  std::unique_ptr<uint8_t[]> shadowData_;
+  // Pending upload ranges, sorted by offset, mutually disjoint and non-adjacent
+  std::vector<BufferRange> pendingUploads_;
+  // Guards shadowData_ and pendingUploads_ so loader threads can upload while the render thread
+  // flushes at submission
+  std::mutex pendingUploadsMutex_;
+
+  // content-hash memo for VulkanContextConfig::enableUploadDeduplication; only consulted for
+  // buffers the GPU cannot write to (no Storage usage) and invalidated by map(), @see upload()
+  UploadDeduplicator uploadDedup_;
 };
 
 } // namespace vulkan
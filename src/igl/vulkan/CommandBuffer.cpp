@@ -13,6 +13,7 @@
 #include <igl/vulkan/Framebuffer.h>
 #include <igl/vulkan/RenderCommandEncoder.h>
 #include <igl/vulkan/Texture.h>
+#include <igl/vulkan/VulkanBarrierBatcher.h>
 #include <igl/vulkan/VulkanContext.h>
 #include <igl/vulkan/VulkanImage.h>
 #include <igl/vulkan/VulkanImageView.h>
@@ -21,65 +22,513 @@
 namespace igl {
 namespace vulkan {
 
+namespace {
+
+// The maximum number of timestamp queries per command buffer (each GPU timing zone uses two)
+constexpr uint32_t kMaxTimestampQueries = 64;
+
+// Unions `extra` into `deps`; returns false when the fixed-size arrays cannot hold the union
+bool mergeDependencies(igl::Dependencies& deps, const igl::Dependencies& extra) {
+  for (igl::ITexture* tex : extra.textures) {
+    if (!tex) {
+      continue;
+    }
+    uint32_t i = 0;
+    while (i < igl::Dependencies::IGL_MAX_TEXTURE_DEPENDENCIES && deps.textures[i] &&
+           deps.textures[i] != tex) {
+      i++;
+    }
+    if (i == igl::Dependencies::IGL_MAX_TEXTURE_DEPENDENCIES) {
+      return false;
+    }
+    deps.textures[i] = tex;
+  }
+  for (igl::IBuffer* buf : extra.buffers) {
+    if (!buf) {
+      continue;
+    }
+    uint32_t i = 0;
+    while (i < igl::Dependencies::IGL_MAX_BUFFER_DEPENDENCIES && deps.buffers[i] &&
+           deps.buffers[i] != buf) {
+      i++;
+    }
+    if (i == igl::Dependencies::IGL_MAX_BUFFER_DEPENDENCIES) {
+      return false;
+    }
+    deps.buffers[i] = buf;
+  }
+  return true;
+}
+
+} // namespace
+
 CommandBuffer::CommandBuffer(VulkanContext& ctx, CommandBufferDesc desc) :
-  ctx_(ctx), wrapper_(ctx_.immediate_->acquire()), desc_(std::move(desc)) {
-  IGL_ASSERT(wrapper_.cmdBuf_ != VK_NULL_HANDLE);
+  ctx_(ctx), wrapper_(&ctx_.immediate_->acquire(desc.reusable)), desc_(std::move(desc)) {
+  IGL_ASSERT(wrapper_->cmdBuf_ != VK_NULL_HANDLE);
+}
+
+void CommandBuffer::reset(CommandBufferDesc desc) {
+  wrapper_ = &ctx_.immediate_->acquire(desc.reusable);
+  IGL_ASSERT(wrapper_->cmdBuf_ != VK_NULL_HANDLE);
+
+  desc_ = std::move(desc);
+  isFromSwapchain_ = false;
+  framebuffer_ = nullptr;
+  presentedSurface_ = nullptr;
+  lastSubmitHandle_ = {};
+  // a deferred pass end of an abandoned (never submitted) recording dies with the recording
+  deferredPassEnd_ = {};
+  hasDeferredPassEnd_ = false;
+
+  // keep timestampQueryPool_ alive across uses; the queries are reset on the first
+  // pushGpuTimestampZone() of each use
+  timestampZones_.clear();
+  timestampZoneStack_.clear();
+  timestampQueryCount_ = 0;
+
+  mutableStatistics() = {};
+}
+
+CommandBuffer::~CommandBuffer() {
+  if (desc_.reusable && wrapper_ != nullptr) {
+    // purge() skips reusable command buffers, so the wrapper has to be returned by hand; this
+    // waits for the last submission of the recording to complete
+    ctx_.immediate_->releaseReusable(*wrapper_);
+  }
+
+  if (timestampQueryPool_ != VK_NULL_HANDLE) {
+    // the GPU may still be writing timestamps into the pool - destroy it once it is done
+    ctx_.deferredTask(std::packaged_task<void()>(
+        [vf = &ctx_.vf_, device = ctx_.getVkDevice(), pool = timestampQueryPool_]() {
+          vf->vkDestroyQueryPool(device, pool, nullptr);
+        }));
+  }
+}
+
+bool CommandBuffer::pushGpuTimestampZone(const char* name) {
+  // end any render pass kept open for merging: vkCmdResetQueryPool() below is illegal inside a
+  // render pass, and the zone should not start before the pass-end commands
+  flushDeferredRenderPassEnd();
+
+  const VkPhysicalDeviceLimits& limits = ctx_.getVkPhysicalDeviceProperties().limits;
+  if (!limits.timestampComputeAndGraphics || limits.timestampPeriod == 0.0f) {
+    return false;
+  }
+  if (!IGL_VERIFY(timestampQueryCount_ + 2 <= kMaxTimestampQueries)) {
+    // too many zones in one command buffer
+    return false;
+  }
+
+  if (timestampQueryPool_ == VK_NULL_HANDLE) {
+    const VkQueryPoolCreateInfo ci = {
+        .sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,
+        .queryType = VK_QUERY_TYPE_TIMESTAMP,
+        .queryCount = kMaxTimestampQueries,
+    };
+    VK_ASSERT(ctx_.vf_.vkCreateQueryPool(ctx_.getVkDevice(), &ci, nullptr, &timestampQueryPool_));
+    if (timestampQueryPool_ == VK_NULL_HANDLE) {
+      return false;
+    }
+  }
+
+  if (timestampQueryCount_ == 0) {
+    // vkCmdResetQueryPool() must be recorded outside of a render pass, which is guaranteed here
+    // since zones cannot be opened while an encoder is active. This is done on the first zone of
+    // every use because the pool survives command buffer recycling (see reset())
+    ctx_.vf_.vkCmdResetQueryPool(wrapper_->cmdBuf_, timestampQueryPool_, 0, kMaxTimestampQueries);
+  }
+
+  TimestampZone zone;
+  zone.name = name;
+  zone.beginQuery = timestampQueryCount_++;
+  // both timestamps are taken at the bottom of the pipe so that (end - begin) covers the full
+  // execution of the commands recorded inside the zone
+  ctx_.vf_.vkCmdWriteTimestamp(
+      wrapper_->cmdBuf_, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, timestampQueryPool_, zone.beginQuery);
+
+  timestampZoneStack_.push_back(static_cast<uint32_t>(timestampZones_.size()));
+  timestampZones_.push_back(std::move(zone));
+
+  return true;
+}
+
+void CommandBuffer::popGpuTimestampZone() {
+  // make the zone cover the deferred pass-end commands of the pass it timed (if any)
+  flushDeferredRenderPassEnd();
+
+  if (!IGL_VERIFY(!timestampZoneStack_.empty())) {
+    IGL_ASSERT_MSG(false, "popGpuTimestampZone() called without a matching pushGpuTimestampZone()");
+    return;
+  }
+
+  TimestampZone& zone = timestampZones_[timestampZoneStack_.back()];
+  timestampZoneStack_.pop_back();
+
+  zone.endQuery = timestampQueryCount_++;
+  ctx_.vf_.vkCmdWriteTimestamp(
+      wrapper_->cmdBuf_, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, timestampQueryPool_, zone.endQuery);
+}
+
+bool CommandBuffer::getGpuTimestampZones(std::vector<GpuTimestampZone>& outZones) const {
+  if (timestampQueryPool_ == VK_NULL_HANDLE || timestampZones_.empty()) {
+    return false;
+  }
+  IGL_ASSERT_MSG(timestampZoneStack_.empty(), "Not all GPU timing zones have been popped");
+
+  // each query returns a pair: {timestamp, availability}
+  std::vector<uint64_t> results(static_cast<size_t>(timestampQueryCount_) * 2);
+  const VkResult vkResult = ctx_.vf_.vkGetQueryPoolResults(ctx_.getVkDevice(),
+                                                           timestampQueryPool_,
+                                                           0,
+                                                           timestampQueryCount_,
+                                                           results.size() * sizeof(uint64_t),
+                                                           results.data(),
+                                                           2 * sizeof(uint64_t),
+                                                           VK_QUERY_RESULT_64_BIT |
+                                                               VK_QUERY_RESULT_WITH_AVAILABILITY_BIT);
+  if (vkResult == VK_NOT_READY) {
+    return false;
+  }
+  VK_ASSERT(vkResult);
+
+  for (uint32_t i = 0; i != timestampQueryCount_; i++) {
+    if (results[2 * i + 1] == 0) {
+      // this timestamp has not been written by the GPU yet
+      return false;
+    }
+  }
+
+  // convert from timestamp ticks to nanoseconds
+  const double period = ctx_.getVkPhysicalDeviceProperties().limits.timestampPeriod;
+
+  outZones.clear();
+  outZones.reserve(timestampZones_.size());
+  for (const TimestampZone& zone : timestampZones_) {
+    outZones.push_back({zone.name,
+                        static_cast<uint64_t>(results[2 * zone.beginQuery] * period),
+                        static_cast<uint64_t>(results[2 * zone.endQuery] * period)});
+  }
+
+  return true;
 }
 
 std::unique_ptr<IComputeCommandEncoder> CommandBuffer::createComputeCommandEncoder() {
+  // a render pass kept open for merging cannot span a compute pass - end it first
+  flushDeferredRenderPassEnd();
+
+  if (ctx_.config_.enableGpuCrashBreadcrumbs) {
+    ctx_.writeGpuBreadcrumb(wrapper_->cmdBuf_, "compute pass begin");
+  }
   return std::make_unique<ComputeCommandEncoder>(shared_from_this(), ctx_);
 }
 
-std::unique_ptr<IRenderCommandEncoder> CommandBuffer::createRenderCommandEncoder(
-    const RenderPassDesc& renderPass,
-    std::shared_ptr<IFramebuffer> framebuffer,
-    const Dependencies& dependencies,
-    Result* outResult) {
+void CommandBuffer::transitionForRenderPass(IFramebuffer& framebuffer,
+                                            const Dependencies& dependencies) {
   IGL_PROFILER_FUNCTION();
-  IGL_ASSERT(framebuffer);
 
-  framebuffer_ = framebuffer;
+  // accumulate the transitions of the dependencies and of all the attachments, and flush them as
+  // one vkCmdPipelineBarrier() call before the render pass starts
+  VulkanBarrierBatcher batcher;
 
   for (ITexture* IGL_NULLABLE tex : dependencies.textures) {
     if (tex) {
-      transitionToShaderReadOnly(wrapper_.cmdBuf_, tex);
+      transitionToShaderReadOnly(wrapper_->cmdBuf_, tex, &batcher);
     }
   }
 
   // prepare all the color attachments
-  for (const auto i : framebuffer->getColorAttachmentIndices()) {
-    ITexture* colorTex = framebuffer->getColorAttachment(i).get();
-    transitionToColorAttachment(wrapper_.cmdBuf_, colorTex);
+  for (const auto i : framebuffer.getColorAttachmentIndices()) {
+    ITexture* colorTex = framebuffer.getColorAttachment(i).get();
+    transitionToColorAttachment(wrapper_->cmdBuf_, colorTex, &batcher);
     // handle MSAA
-    ITexture* colorResolveTex = framebuffer->getResolveColorAttachment(i).get();
-    transitionToColorAttachment(wrapper_.cmdBuf_, colorResolveTex);
+    ITexture* colorResolveTex = framebuffer.getResolveColorAttachment(i).get();
+    transitionToColorAttachment(wrapper_->cmdBuf_, colorResolveTex, &batcher);
   }
 
   // prepare depth attachment
-  const auto depthTex = framebuffer->getDepthAttachment();
+  const auto depthTex = framebuffer.getDepthAttachment();
   if (depthTex) {
     const auto& vkDepthTex = static_cast<Texture&>(*depthTex);
     const auto& depthImg = vkDepthTex.getVulkanTexture().getVulkanImage();
     IGL_ASSERT_MSG(depthImg.imageFormat_ != VK_FORMAT_UNDEFINED, "Invalid depth attachment format");
     const VkImageAspectFlags flags =
         vkDepthTex.getVulkanTexture().getVulkanImage().getImageAspectFlags();
-    depthImg.transitionLayout(
-        wrapper_.cmdBuf_,
+    depthImg.transitionLayoutBatched(
+        batcher,
         VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL,
         VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT,
         VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
         VkImageSubresourceRange{flags, 0, VK_REMAINING_MIP_LEVELS, 0, VK_REMAINING_ARRAY_LAYERS});
   }
 
-  auto encoder = RenderCommandEncoder::create(
-      shared_from_this(), ctx_, renderPass, framebuffer, dependencies, outResult);
+  batcher.flush(ctx_.vf_, wrapper_->cmdBuf_);
+}
+
+void CommandBuffer::transitionAfterRenderPass(IFramebuffer& framebuffer,
+                                              const Dependencies& dependencies) {
+  IGL_PROFILER_FUNCTION();
+
+  // accumulate all the transitions below and flush them as one vkCmdPipelineBarrier() call
+  VulkanBarrierBatcher batcher;
+
+  for (ITexture* IGL_NULLABLE tex : dependencies.textures) {
+    // TODO: at some point we might want to know in which layout a dependent texture wants to be.
+    // We can implement that by adding a notion of image layouts to IGL.
+    if (!tex) {
+      continue;
+    }
+
+    // Retrieve the VulkanImage to check its usage
+    const auto& vkTex = static_cast<Texture&>(*tex);
+    const auto& img = vkTex.getVulkanTexture().getVulkanImage();
+
+    if (tex->getProperties().isDepthOrStencil()) {
+      // If the texture has not been marked as a depth/stencil attachment
+      // (TextureDesc::TextureUsageBits::Attachment), don't transition it to a depth/stencil
+      // attchment
+      if (img.usageFlags_ & VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) {
+        transitionToDepthStencilAttachment(wrapper_->cmdBuf_, tex, &batcher);
+      }
+    } else {
+      // If the texture has not been marked as a color attachment
+      // (TextureDesc::TextureUsageBits::Attachment), don't transition it to a color attchment
+      if (img.usageFlags_ & VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT) {
+        transitionToColorAttachment(wrapper_->cmdBuf_, tex, &batcher);
+      }
+    }
+  }
+
+  // set image layouts after the render pass
+  const FramebufferDesc& desc = static_cast<const Framebuffer&>(framebuffer).getDesc();
+
+  for (const auto& attachment : desc.colorAttachments) {
+    // the image layouts of color attachments must match the final layout of the render pass, which
+    // is always VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL (check VulkanRenderPassBuilder.cpp)
+    overrideImageLayout(attachment.texture.get(), VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+    overrideImageLayout(attachment.resolveTexture.get(), VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+    transitionToShaderReadOnly(wrapper_->cmdBuf_, attachment.texture.get(), &batcher);
+    transitionToShaderReadOnly(wrapper_->cmdBuf_, attachment.resolveTexture.get(), &batcher);
+  }
+
+  // this must match the final layout of the render pass, which is always
+  // VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL (check VulkanRenderPassBuilder.cpp)
+  overrideImageLayout(desc.depthAttachment.texture.get(),
+                      VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL);
+  transitionToShaderReadOnly(wrapper_->cmdBuf_, desc.depthAttachment.texture.get(), &batcher);
 
-  if (ctx_.enhancedShaderDebuggingStore_) {
+  mutableStatistics().barrierCount += static_cast<uint32_t>(batcher.size());
+  batcher.flush(ctx_.vf_, wrapper_->cmdBuf_);
+
+  if (ctx_.config_.enableGpuCrashBreadcrumbs) {
+    ctx_.writeGpuBreadcrumb(wrapper_->cmdBuf_, "render pass end");
+  }
+
+#if defined(IGL_WITH_TRACY_GPU)
+  TracyVkCollect(ctx_.tracyCtx_, wrapper_->cmdBuf_);
+#endif
+}
+
+bool CommandBuffer::deferRenderPassEnd(DeferredRenderPassEnd state) {
+  if (!ctx_.config_.enableRenderPassMerging) {
+    return false;
+  }
+  IGL_ASSERT_MSG(!hasDeferredPassEnd_, "Two render passes left open on one command buffer");
+
+  deferredPassEnd_ = std::move(state);
+  hasDeferredPassEnd_ = true;
+  return true;
+}
+
+void CommandBuffer::flushDeferredRenderPassEnd() {
+  if (!hasDeferredPassEnd_) {
+    return;
+  }
+  hasDeferredPassEnd_ = false;
+
+  // no merge happened: the pass ends here, in the same position RenderCommandEncoder::endEncoding()
+  // would have ended it, since nothing else can be recorded while the end is deferred
+  if (ctx_.useDynamicRendering_) {
+    ctx_.vf_.vkCmdEndRenderingKHR(wrapper_->cmdBuf_);
+  } else {
+    ctx_.vf_.vkCmdEndRenderPass(wrapper_->cmdBuf_);
+  }
+
+  transitionAfterRenderPass(*deferredPassEnd_.framebuffer, deferredPassEnd_.dependencies);
+
+  deferredPassEnd_ = {};
+}
+
+bool CommandBuffer::canMergeRenderPass(const RenderPassDesc& renderPass,
+                                       const IFramebuffer& framebuffer,
+                                       const Dependencies& dependencies,
+                                       Dependencies& outMergedDependencies) const {
+  if (!hasDeferredPassEnd_) {
+    return false;
+  }
+
+  // the open pass began with this framebuffer's image views, so only passes into the very same
+  // framebuffer object can merge
+  if (deferredPassEnd_.framebuffer.get() != &framebuffer) {
+    return false;
+  }
+
+  // a merged pass has no load/store ops of its own: clears cannot run mid-pass, and resolves
+  // would resolve too early (the open pass already excluded them, see
+  // RenderCommandEncoder::isMergeCandidate())
+  if (renderPass.hasRenderArea() || renderPass.colorResolveShaderStages) {
+    return false;
+  }
+  if (renderPass.viewMask != deferredPassEnd_.renderPass.viewMask) {
+    return false;
+  }
+
+  const RenderPassDesc& openPass = deferredPassEnd_.renderPass;
+
+  for (const auto i : framebuffer.getColorAttachmentIndices()) {
+    if (i >= renderPass.colorAttachments.size() || i >= openPass.colorAttachments.size()) {
+      return false;
+    }
+    const auto& descColor = renderPass.colorAttachments[i];
+    const auto& openColor = openPass.colorAttachments[i];
+    if (descColor.loadAction == LoadAction::Clear ||
+        descColor.storeAction == StoreAction::MsaaResolve) {
+      return false;
+    }
+    // the open pass renders into specific subresources - the merged pass must target the same ones
+    if (descColor.mipLevel != openColor.mipLevel || descColor.layer != openColor.layer ||
+        descColor.face != openColor.face) {
+      return false;
+    }
+  }
+
+  if (framebuffer.getDepthAttachment()) {
+    const auto& descDepth = renderPass.depthAttachment;
+    const auto& openDepth = openPass.depthAttachment;
+    if (descDepth.loadAction == LoadAction::Clear ||
+        renderPass.stencilAttachment.loadAction == LoadAction::Clear ||
+        descDepth.storeAction == StoreAction::MsaaResolve) {
+      return false;
+    }
+    if (descDepth.mipLevel != openDepth.mipLevel || descDepth.layer != openDepth.layer ||
+        descDepth.face != openDepth.face) {
+      return false;
+    }
+  }
+
+  // pipeline barriers are illegal inside a render pass, so every new dependency must already be
+  // in shader read-only layout; otherwise the passes cannot merge
+  for (ITexture* IGL_NULLABLE tex : dependencies.textures) {
+    if (!tex) {
+      continue;
+    }
+    const auto& img = static_cast<Texture&>(*tex).getVulkanTexture().getVulkanImage();
+    if (img.imageLayout_ != VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL) {
+      return false;
+    }
+  }
+
+  // the merged pass transitions the union of both passes' dependencies at its (deferred) end
+  outMergedDependencies = deferredPassEnd_.dependencies;
+  return mergeDependencies(outMergedDependencies, dependencies);
+}
+
+std::unique_ptr<IRenderCommandEncoder> CommandBuffer::createRenderCommandEncoder(
+    const RenderPassDesc& renderPass,
+    std::shared_ptr<IFramebuffer> framebuffer,
+    const Dependencies& dependencies,
+    Result* outResult) {
+  IGL_PROFILER_FUNCTION();
+  IGL_ASSERT(framebuffer);
+
+  framebuffer_ = framebuffer;
+
+  std::unique_ptr<RenderCommandEncoder> encoder;
+
+  Dependencies mergedDependencies;
+  if (canMergeRenderPass(renderPass, *framebuffer, dependencies, mergedDependencies)) {
+    // the previous pass is still open (see deferRenderPassEnd()): adopt it instead of ending it
+    // and beginning a new one, skipping the attachment store+load round-trip at the boundary
+    const uint32_t renderPassIndex = deferredPassEnd_.renderPassIndex;
+    deferredPassEnd_ = {};
+    hasDeferredPassEnd_ = false;
+
+    encoder = RenderCommandEncoder::createMerged(
+        shared_from_this(), ctx_, renderPass, framebuffer, mergedDependencies, renderPassIndex,
+        outResult);
+  } else {
+    flushDeferredRenderPassEnd();
+
+    transitionForRenderPass(*framebuffer, dependencies);
+
+    if (ctx_.config_.enableGpuCrashBreadcrumbs) {
+      // still outside the render pass here, so the vkCmdFillBuffer() fallback is legal
+      const std::string& fbName = static_cast<const Framebuffer&>(*framebuffer).getDesc().debugName;
+      ctx_.writeGpuBreadcrumb(
+          wrapper_->cmdBuf_,
+          fbName.empty() ? "render pass begin" : ("render pass begin: " + fbName).c_str());
+    }
+
+    encoder = RenderCommandEncoder::create(
+        shared_from_this(), ctx_, renderPass, framebuffer, dependencies, outResult);
+  }
+
+#if IGL_VULKAN_ENHANCED_SHADER_DEBUGGING
+  // the buffer stays bound even on frames skipped by the sampling interval: every shader compiled
+  // by the device references this binding
+  if (encoder && ctx_.enhancedShaderDebuggingStore_) {
     encoder->binder().bindStorageBuffer(
         EnhancedShaderDebuggingStore::kBufferIndex,
         static_cast<igl::vulkan::Buffer*>(ctx_.enhancedShaderDebuggingStore_->vertexBuffer().get()),
         0);
   }
+#endif // IGL_VULKAN_ENHANCED_SHADER_DEBUGGING
+
+  return encoder;
+}
+
+std::unique_ptr<IRenderCommandEncoder> CommandBuffer::createParallelRenderCommandEncoders(
+    const RenderPassDesc& renderPass,
+    const std::shared_ptr<IFramebuffer>& framebuffer,
+    const Dependencies& dependencies,
+    uint32_t numSecondaryEncoders,
+    std::vector<std::unique_ptr<IRenderCommandEncoder>>& outSecondaryEncoders,
+    Result* outResult) {
+  IGL_PROFILER_FUNCTION();
+  IGL_ASSERT(framebuffer);
+
+  framebuffer_ = framebuffer;
+
+  // parallel passes never merge (they begin with secondary command buffer contents)
+  flushDeferredRenderPassEnd();
+
+  transitionForRenderPass(*framebuffer, dependencies);
+
+  if (ctx_.config_.enableGpuCrashBreadcrumbs) {
+    ctx_.writeGpuBreadcrumb(wrapper_->cmdBuf_, "parallel render pass begin");
+  }
+
+  auto encoder = RenderCommandEncoder::createParallel(shared_from_this(),
+                                                      ctx_,
+                                                      renderPass,
+                                                      framebuffer,
+                                                      dependencies,
+                                                      numSecondaryEncoders,
+                                                      outSecondaryEncoders,
+                                                      outResult);
+
+#if IGL_VULKAN_ENHANCED_SHADER_DEBUGGING
+  if (encoder && ctx_.enhancedShaderDebuggingStore_) {
+    // draw calls are recorded through the secondary encoders, so bind the debug buffer there
+    for (auto& secondaryEncoder : outSecondaryEncoders) {
+      static_cast<RenderCommandEncoder&>(*secondaryEncoder)
+          .binder()
+          .bindStorageBuffer(EnhancedShaderDebuggingStore::kBufferIndex,
+                             static_cast<igl::vulkan::Buffer*>(
+                                 ctx_.enhancedShaderDebuggingStore_->vertexBuffer().get()),
+                             0);
+    }
+  }
+#endif // IGL_VULKAN_ENHANCED_SHADER_DEBUGGING
 
   return encoder;
 }
@@ -89,6 +538,10 @@ void CommandBuffer::present(std::shared_ptr<ITexture> surface) const {
 
   IGL_ASSERT(surface);
 
+  // a deferred render pass end (if any) must be recorded before the layout transitions below;
+  // present() is morally non-const here, like the mutable members it writes
+  const_cast<CommandBuffer*>(this)->flushDeferredRenderPassEnd();
+
   presentedSurface_ = surface;
 
   const auto& vkTex = static_cast<Texture&>(*surface);
@@ -103,7 +556,7 @@ void CommandBuffer::present(std::shared_ptr<ITexture> surface) const {
                                                  ? VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT
                                                  : VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
     img.transitionLayout(
-        wrapper_.cmdBuf_,
+        wrapper_->cmdBuf_,
         VK_IMAGE_LAYOUT_PRESENT_SRC_KHR,
         srcStage,
         VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, // wait for all subsequent operations
@@ -123,7 +576,7 @@ void CommandBuffer::present(std::shared_ptr<ITexture> surface) const {
                                               : VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
     // set the result of the previous render pass
     img.transitionLayout(
-        wrapper_.cmdBuf_,
+        wrapper_->cmdBuf_,
         VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
         srcStage,
         VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT |
@@ -134,11 +587,11 @@ void CommandBuffer::present(std::shared_ptr<ITexture> surface) const {
 
 void CommandBuffer::pushDebugGroupLabel(const char* label, const igl::Color& color) const {
   IGL_ASSERT(label != nullptr && *label);
-  ivkCmdBeginDebugUtilsLabel(&ctx_.vf_, wrapper_.cmdBuf_, label, color.toFloatPtr());
+  ivkCmdBeginDebugUtilsLabel(&ctx_.vf_, wrapper_->cmdBuf_, label, color.toFloatPtr());
 }
 
 void CommandBuffer::popDebugGroupLabel() const {
-  ivkCmdEndDebugUtilsLabel(&ctx_.vf_, wrapper_.cmdBuf_);
+  ivkCmdEndDebugUtilsLabel(&ctx_.vf_, wrapper_->cmdBuf_);
 }
 
 void CommandBuffer::waitUntilCompleted() {
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <igl/CommandBuffer.h>
+#include <igl/RenderPass.h>
 #include <igl/vulkan/Common.h>
 #include <igl/vulkan/VulkanImmediateCommands.h>
 
@@ -27,6 +28,8 @@ class CommandBuffer final : public ICommandBuffer,
   /// buffer.
   CommandBuffer(VulkanContext& ctx, CommandBufferDesc desc);
 
+  ~CommandBuffer() override;
+
   /// @brief Creates a ComputeCommandEncoder
   std::unique_ptr<IComputeCommandEncoder> createComputeCommandEncoder() override;
 
@@ -46,6 +49,24 @@ class CommandBuffer final : public ICommandBuffer,
       const Dependencies& dependencies,
       Result* outResult) override;
 
+  /** @brief Creates render command encoders for multi-threaded recording of one render pass.
+   * The returned "primary" encoder begins the render pass; `outSecondaryEncoders` receives
+   * `numSecondaryEncoders` encoders, each backed by its own VkCommandPool and a
+   * VK_COMMAND_BUFFER_LEVEL_SECONDARY command buffer, so every encoder can be handed to a
+   * different worker thread. Record draw calls only through the secondary encoders and call
+   * endEncoding() on each one (from its recording thread is fine). Afterwards, on the thread
+   * that owns this command buffer, call endEncoding() on the primary encoder: it stitches the
+   * secondary command buffers into the render pass with vkCmdExecuteCommands(). All encoders
+   * must be created and destroyed on the thread that owns this command buffer.
+   */
+  std::unique_ptr<IRenderCommandEncoder> createParallelRenderCommandEncoders(
+      const RenderPassDesc& renderPass,
+      const std::shared_ptr<IFramebuffer>& framebuffer,
+      const Dependencies& dependencies,
+      uint32_t numSecondaryEncoders,
+      std::vector<std::unique_ptr<IRenderCommandEncoder>>& outSecondaryEncoders,
+      Result* outResult);
+
   /** @brief Caches the texture passed in to the function for presentation later. Due to the
    * enhanced shader debugging functionality, the image cannot be presented here. It can only be
    * presented after the command buffer has been submitted, processed and then used by the enhanced
@@ -60,6 +81,19 @@ class CommandBuffer final : public ICommandBuffer,
 
   void popDebugGroupLabel() const override;
 
+  /// @brief Begins a GPU timing zone by writing a timestamp with vkCmdWriteTimestamp. The query
+  /// pool backing the zones is created lazily on the first call. Returns false when the device
+  /// cannot record timestamps on graphics/compute queues.
+  bool pushGpuTimestampZone(const char* name) override;
+
+  /// @brief Ends the most recently opened GPU timing zone
+  void popGpuTimestampZone() override;
+
+  /// @brief Retrieves the recorded zones with vkGetQueryPoolResults() using
+  /// VK_QUERY_RESULT_WITH_AVAILABILITY_BIT, so the call never blocks: it returns false until all
+  /// timestamps have been written by the GPU
+  bool getGpuTimestampZones(std::vector<GpuTimestampZone>& outZones) const override;
+
   /// @brief Waits until the command bufer has been executed by the device.
   void waitUntilCompleted() override;
 
@@ -67,13 +101,47 @@ class CommandBuffer final : public ICommandBuffer,
   void waitUntilScheduled() override;
 
   VkCommandBuffer getVkCommandBuffer() const {
-    return wrapper_.cmdBuf_;
+    return wrapper_->cmdBuf_;
   }
 
   bool isFromSwapchain() const {
     return isFromSwapchain_;
   }
 
+  /// @brief State of a render pass whose vkCmdEndRenderPass()/vkCmdEndRenderingKHR() has been
+  /// deferred so that a following compatible pass can merge into it (see
+  /// VulkanContextConfig::enableRenderPassMerging)
+  struct DeferredRenderPassEnd {
+    std::shared_ptr<IFramebuffer> framebuffer;
+    Dependencies dependencies;
+    RenderPassDesc renderPass;
+    // the RenderPipelineDynamicState render pass index of the open pass, adopted by the encoder
+    // of a merged pass so its pipelines stay compatible
+    uint32_t renderPassIndex = 0;
+  };
+
+  /// @brief Called by RenderCommandEncoder::endEncoding() on a merge-candidate pass: stashes the
+  /// open pass instead of ending it, so a following compatible pass can merge into it. Returns
+  /// false (and the encoder ends the pass itself) when merging is disabled
+  bool deferRenderPassEnd(DeferredRenderPassEnd state);
+
+  /// @brief Records the deferred render pass end (if any): ends the pass and transitions the
+  /// attachments, exactly as RenderCommandEncoder::endEncoding() would have. Called before
+  /// anything else is recorded into this command buffer and on submission
+  void flushDeferredRenderPassEnd();
+
+  /// @brief Transitions the dependencies back to their attachment layouts and all framebuffer
+  /// attachments to shader read-only layouts after a render pass, flushing all the transitions as
+  /// one batched pipeline barrier. The counterpart of transitionForRenderPass()
+  void transitionAfterRenderPass(IFramebuffer& framebuffer, const Dependencies& dependencies);
+
+  /// @brief True when this command buffer was created with CommandBufferDesc::reusable; its
+  /// recording survives submission and CommandQueue::submit() replays it via
+  /// VulkanImmediateCommands::resubmit()
+  bool isReusable() const {
+    return desc_.reusable;
+  }
+
   std::shared_ptr<igl::IFramebuffer> getFramebuffer() const;
 
   std::shared_ptr<ITexture> getPresentedSurface() const;
@@ -81,8 +149,27 @@ class CommandBuffer final : public ICommandBuffer,
  private:
   friend class CommandQueue;
 
+  /// @brief Prepares this instance for reuse from the CommandQueue command buffer pool: acquires
+  /// a fresh `VulkanImmediateCommands::CommandBufferWrapper` and clears all per-use state, as if
+  /// the object had just been constructed. The timestamp query pool is kept alive across uses
+  void reset(CommandBufferDesc desc);
+
+  /// @brief Transitions the dependencies and all framebuffer attachments to their render pass
+  /// layouts, flushing all the transitions as one batched pipeline barrier
+  void transitionForRenderPass(IFramebuffer& framebuffer, const Dependencies& dependencies);
+
+  /// @brief True when `renderPass`/`framebuffer` can merge into the deferred open pass: same
+  /// framebuffer and attachment subresources, no clears or resolves, dependencies already in
+  /// shader read-only layout. On success `outMergedDependencies` receives the union of the open
+  /// pass's dependencies and `dependencies`
+  bool canMergeRenderPass(const RenderPassDesc& renderPass,
+                          const IFramebuffer& framebuffer,
+                          const Dependencies& dependencies,
+                          Dependencies& outMergedDependencies) const;
+
   VulkanContext& ctx_;
-  const VulkanImmediateCommands::CommandBufferWrapper& wrapper_;
+  // pointer (not a reference) so reset() can re-acquire a wrapper when the object is recycled
+  const VulkanImmediateCommands::CommandBufferWrapper* wrapper_;
   CommandBufferDesc desc_;
   // was present() called with a swapchain image?
   mutable bool isFromSwapchain_ = false;
@@ -91,6 +178,24 @@ class CommandBuffer final : public ICommandBuffer,
   mutable std::shared_ptr<ITexture> presentedSurface_;
 
   VulkanImmediateCommands::SubmitHandle lastSubmitHandle_ = {};
+
+  // a render pass kept open for merging (see VulkanContextConfig::enableRenderPassMerging)
+  DeferredRenderPassEnd deferredPassEnd_;
+  bool hasDeferredPassEnd_ = false;
+
+  /// @brief A GPU timing zone: a name plus the indices of its begin/end timestamp queries within
+  /// timestampQueryPool_
+  struct TimestampZone {
+    std::string name;
+    uint32_t beginQuery = 0;
+    uint32_t endQuery = 0;
+  };
+
+  VkQueryPool timestampQueryPool_ = VK_NULL_HANDLE;
+  std::vector<TimestampZone> timestampZones_;
+  // indices into timestampZones_ of the zones that are currently open
+  std::vector<uint32_t> timestampZoneStack_;
+  uint32_t timestampQueryCount_ = 0;
 };
 
 } // namespace vulkan
@@ -15,6 +15,7 @@
 #include <igl/vulkan/VulkanDevice.h>
 #include <igl/vulkan/VulkanHelpers.h>
 #include <igl/vulkan/VulkanSwapchain.h>
+#include <igl/vulkan/VulkanUploadScheduler.h>
 
 namespace igl {
 namespace vulkan {
@@ -33,33 +34,102 @@ std::shared_ptr<ICommandBuffer> CommandQueue::createCommandBuffer(const CommandB
 
   isInsideFrame_ = true;
 
-  return std::make_shared<CommandBuffer>(device_.getVulkanContext(), desc);
+  // reusable command buffers (see CommandBufferDesc::reusable) hold on to their recording across
+  // submissions, so they cannot be recycled through the pool; the client owns their lifetime
+  if (desc.reusable) {
+    return std::make_shared<CommandBuffer>(device_.getVulkanContext(), desc);
+  }
+
+  // recycle a pooled wrapper object that the client has released (only the pool holds a
+  // reference); in the steady state the frame loop never allocates a new CommandBuffer
+  for (const std::shared_ptr<CommandBuffer>& pooled : commandBufferPool_) {
+    if (pooled.use_count() == 1) {
+      pooled->reset(desc);
+      return pooled;
+    }
+  }
+
+  auto commandBuffer = std::make_shared<CommandBuffer>(device_.getVulkanContext(), desc);
+
+  if (commandBufferPool_.size() < kMaxPooledCommandBuffers) {
+    commandBufferPool_.push_back(commandBuffer);
+  }
+
+  return commandBuffer;
 }
 
 SubmitHandle CommandQueue::submit(const ICommandBuffer& cmdBuffer, bool /* endOfFrame */) {
   IGL_PROFILER_FUNCTION();
   VulkanContext& ctx = device_.getVulkanContext();
 
-  if (ctx.enhancedShaderDebuggingStore_) {
+  auto* vkCmdBuffer =
+      const_cast<vulkan::CommandBuffer*>(static_cast<const vulkan::CommandBuffer*>(&cmdBuffer));
+
+  // a render pass whose end was deferred for merging must be closed before anything else is
+  // recorded - the debugging barrier below, and the command buffer itself is about to end
+  vkCmdBuffer->flushDeferredRenderPassEnd();
+
+#if IGL_VULKAN_ENHANCED_SHADER_DEBUGGING
+  // with a sampling interval of N, the debugging pass runs only once every N frames; the frames
+  // in between present directly and skip the barrier and the extra line-drawing pass
+  const bool debuggingThisFrame = ctx.enhancedShaderDebuggingStore_ &&
+                                  ctx.enhancedShaderDebuggingStore_->isActiveForCurrentFrame();
+  if (debuggingThisFrame) {
     ctx.enhancedShaderDebuggingStore_->installBufferBarrier(cmdBuffer);
   }
+#else
+  const bool debuggingThisFrame = false;
+#endif // IGL_VULKAN_ENHANCED_SHADER_DEBUGGING
+
+  IGL_PROFILER_COUNTER("IGL draw calls", static_cast<int64_t>(cmdBuffer.getCurrentDrawCount()));
 
   incrementDrawCount(cmdBuffer.getCurrentDrawCount());
 
-  IGL_ASSERT(isInsideFrame_);
+  // re-submission of a reusable command buffer happens on frames where createCommandBuffer() was
+  // never called for it, so it is legal outside of a createCommandBuffer()/submit() pair
+  const bool isResubmit = vkCmdBuffer->isReusable() && !vkCmdBuffer->wrapper_->isEncoding_;
+  IGL_ASSERT(isInsideFrame_ || isResubmit);
 
-  auto* vkCmdBuffer =
-      const_cast<vulkan::CommandBuffer*>(static_cast<const vulkan::CommandBuffer*>(&cmdBuffer));
-  const bool presentIfNotDebugging = ctx.enhancedShaderDebuggingStore_ == nullptr;
-  auto submitHandle = endCommandBuffer(ctx, vkCmdBuffer, presentIfNotDebugging);
+  // run this frame's slice of the scheduled uploads, then flush the coalesced buffer uploads:
+  // the staging copies go through the same in-order queue, so they are guaranteed to land before
+  // the command buffer that consumes them
+  if (ctx.uploadScheduler_) {
+    ctx.uploadScheduler_->processFrame();
+  }
+  ctx.flushPendingBufferUploads();
 
-  if (ctx.enhancedShaderDebuggingStore_) {
+  auto submitHandle = endCommandBuffer(ctx, vkCmdBuffer, !debuggingThisFrame);
+
+#if IGL_VULKAN_ENHANCED_SHADER_DEBUGGING
+  if (debuggingThisFrame) {
     enhancedShaderDebuggingPass(ctx, vkCmdBuffer);
   }
+  if (ctx.enhancedShaderDebuggingStore_ && vkCmdBuffer->isFromSwapchain()) {
+    ctx.enhancedShaderDebuggingStore_->nextFrame();
+  }
+#endif // IGL_VULKAN_ENHANCED_SHADER_DEBUGGING
 
   return submitHandle;
 }
 
+SubmitHandle CommandQueue::submitBatch(const ICommandBuffer* const* commandBuffers,
+                                       size_t count,
+                                       bool endOfFrame) {
+  IGL_PROFILER_FUNCTION();
+
+  SubmitHandle handle = 0;
+  for (size_t i = 0; i < count; ++i) {
+    if (!IGL_VERIFY(commandBuffers[i])) {
+      continue;
+    }
+    const bool isLast = i + 1 == count;
+    processDeferredTasksOnSubmit_ = isLast;
+    handle = submit(*commandBuffers[i], endOfFrame && isLast);
+  }
+  processDeferredTasksOnSubmit_ = true;
+  return handle;
+}
+
 SubmitHandle CommandQueue::endCommandBuffer(const igl::vulkan::VulkanContext& ctx,
                                             igl::vulkan::CommandBuffer* cmdBuffer,
                                             bool present) {
@@ -71,17 +141,22 @@ SubmitHandle CommandQueue::endCommandBuffer(const igl::vulkan::VulkanContext& ct
   const bool shouldPresent = isGraphicsQueue && ctx.hasSwapchain() &&
                              cmdBuffer->isFromSwapchain() && present;
   if (shouldPresent) {
-    ctx.immediate_->waitSemaphore(ctx.swapchain_->acquireSemaphore_->vkSemaphore_);
+    ctx.immediate_->waitSemaphore(ctx.swapchain_->getAcquireVkSemaphore());
   }
 
-  cmdBuffer->lastSubmitHandle_ = ctx.immediate_->submit(cmdBuffer->wrapper_);
+  // reusable command buffers that were already ended are replayed without re-encoding
+  cmdBuffer->lastSubmitHandle_ = cmdBuffer->isReusable() && !cmdBuffer->wrapper_->isEncoding_
+                                     ? ctx.immediate_->resubmit(*cmdBuffer->wrapper_)
+                                     : ctx.immediate_->submit(*cmdBuffer->wrapper_);
 
   if (shouldPresent) {
     ctx.present();
   }
   ctx.markSubmitted(cmdBuffer->lastSubmitHandle_);
   ctx.syncManager_->markSubmitted(cmdBuffer->lastSubmitHandle_);
-  ctx.processDeferredTasks();
+  if (processDeferredTasksOnSubmit_) {
+    ctx.processDeferredTasks();
+  }
 
   isInsideFrame_ = false;
 
@@ -11,6 +11,9 @@
 #include <igl/vulkan/Common.h>
 #include <igl/vulkan/Device.h>
 
+#include <memory>
+#include <vector>
+
 namespace igl {
 namespace vulkan {
 
@@ -22,6 +25,11 @@ class CommandBuffer;
  * This class also implements shader debugging facilities, which are executed after a command buffer
  * is submitted. This extra pass is only executed if the context provides additional information for
  * rendering. It is disabled by default.
+ *
+ * Thread safety: the queue is confined to the frame-loop thread - createCommandBuffer() and
+ * submit() must not race each other or a recording command buffer. Command buffers recorded
+ * elsewhere should be handed back for submission here (igl::SubmissionQueue provides a safe
+ * multi-producer handoff).
  */
 class CommandQueue final : public ICommandQueue {
  public:
@@ -30,7 +38,9 @@ class CommandQueue final : public ICommandQueue {
   ~CommandQueue() override = default;
 
   /// @brief Create a new command buffer. Sets the internal flag that tracks an active command
-  /// buffer has been created.
+  /// buffer has been created. Wrapper objects are pooled per queue: once the client releases its
+  /// reference the instance is reset and handed out again, so a steady-state frame loop performs
+  /// no heap allocations for command buffers.
   std::shared_ptr<ICommandBuffer> createCommandBuffer(const CommandBufferDesc& desc,
                                                       Result* outResult) override;
 
@@ -43,6 +53,13 @@ class CommandQueue final : public ICommandQueue {
   /// @param endOfFrame Not used
   SubmitHandle submit(const ICommandBuffer& commandBuffer, bool endOfFrame = false) override;
 
+  /// @brief Submits several command buffers in order. Buffers are still handed to the GPU one at
+  /// a time (VulkanImmediateCommands chains per-buffer fences and semaphores), but the deferred
+  /// destruction sweep runs only once per batch instead of once per submission.
+  SubmitHandle submitBatch(const ICommandBuffer* const* commandBuffers,
+                           size_t count,
+                           bool endOfFrame = false) override;
+
   const CommandQueueDesc& getCommandQueueDesc() const {
     return desc_;
   }
@@ -73,6 +90,18 @@ class CommandQueue final : public ICommandQueue {
   /// @brief Flag indicating whether or not there is an active command buffer. Currently only one
   /// command buffer can be active at a time.
   bool isInsideFrame_ = false;
+
+  /// @brief Cleared by submitBatch() for all but the last buffer of a batch so the deferred task
+  /// sweep in endCommandBuffer() runs once per batch.
+  bool processDeferredTasksOnSubmit_ = true;
+
+  /// @brief Upper bound on pooled CommandBuffer wrappers; buffers created beyond it are handed
+  /// out unpooled
+  static constexpr size_t kMaxPooledCommandBuffers = 8;
+
+  /// @brief Recycled CommandBuffer wrapper objects. An entry is available for reuse when the
+  /// pool holds the only remaining reference (see createCommandBuffer())
+  std::vector<std::shared_ptr<CommandBuffer>> commandBufferPool_;
 };
 
 } // namespace vulkan
@@ -18,6 +18,7 @@
 
 #include <igl/vulkan/ShaderModule.h>
 #include <igl/vulkan/Texture.h>
+#include <igl/vulkan/VulkanBarrierBatcher.h>
 #include <igl/vulkan/VulkanContext.h>
 #include <igl/vulkan/VulkanHelpers.h>
 #include <igl/vulkan/VulkanImage.h>
@@ -312,6 +313,25 @@ VkMemoryPropertyFlags resourceStorageToVkMemoryPropertyFlags(igl::ResourceStorag
   return memFlags;
 }
 
+VkMemoryPropertyFlags memoryPlacementToVkMemoryPropertyFlags(igl::MemoryPlacement placement) {
+  switch (placement) {
+  case MemoryPlacement::Default:
+    IGL_ASSERT_MSG(false, "Default placement should use resourceStorageToVkMemoryPropertyFlags()");
+    return 0;
+  case MemoryPlacement::DeviceLocal:
+    return VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+  case MemoryPlacement::HostUpload:
+    return VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+  case MemoryPlacement::Readback:
+    return VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT |
+           VK_MEMORY_PROPERTY_HOST_CACHED_BIT;
+  case MemoryPlacement::DeviceLocalHostVisible:
+    return VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+           VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+  }
+  return 0;
+}
+
 VkCompareOp compareFunctionToVkCompareOp(igl::CompareFunction func) {
   switch (func) {
   case igl::CompareFunction::Never:
@@ -335,6 +355,29 @@ VkCompareOp compareFunctionToVkCompareOp(igl::CompareFunction func) {
   return VK_COMPARE_OP_ALWAYS;
 }
 
+VkStencilOp stencilOperationToVkStencilOp(igl::StencilOperation op) {
+  switch (op) {
+  case igl::StencilOperation::Keep:
+    return VK_STENCIL_OP_KEEP;
+  case igl::StencilOperation::Zero:
+    return VK_STENCIL_OP_ZERO;
+  case igl::StencilOperation::Replace:
+    return VK_STENCIL_OP_REPLACE;
+  case igl::StencilOperation::IncrementClamp:
+    return VK_STENCIL_OP_INCREMENT_AND_CLAMP;
+  case igl::StencilOperation::DecrementClamp:
+    return VK_STENCIL_OP_DECREMENT_AND_CLAMP;
+  case igl::StencilOperation::Invert:
+    return VK_STENCIL_OP_INVERT;
+  case igl::StencilOperation::IncrementWrap:
+    return VK_STENCIL_OP_INCREMENT_AND_WRAP;
+  case igl::StencilOperation::DecrementWrap:
+    return VK_STENCIL_OP_DECREMENT_AND_WRAP;
+  }
+  IGL_ASSERT(false);
+  return VK_STENCIL_OP_KEEP;
+}
+
 VkSampleCountFlagBits getVulkanSampleCountFlags(size_t numSamples) {
   if (numSamples <= 1) {
     return VK_SAMPLE_COUNT_1_BIT;
@@ -380,7 +423,7 @@ TextureRangeDesc atVkLayer(TextureType type, const TextureRangeDesc& range, uint
   return type == TextureType::Cube ? range.atFace(vkLayer) : range.atLayer(vkLayer);
 }
 
-void transitionToGeneral(VkCommandBuffer cmdBuf, ITexture* texture) {
+void transitionToGeneral(VkCommandBuffer cmdBuf, ITexture* texture, VulkanBarrierBatcher* batcher) {
   IGL_PROFILER_FUNCTION_COLOR(IGL_PROFILER_COLOR_TRANSITION);
 
   if (!texture) {
@@ -401,16 +444,20 @@ void transitionToGeneral(VkCommandBuffer cmdBuf, ITexture* texture) {
       (img.imageLayout_ == VK_IMAGE_LAYOUT_GENERAL) ? VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT
       : img.isDepthOrStencilFormat_                 ? VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT
                                                     : VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
-  img.transitionLayout(
-      cmdBuf,
-      VK_IMAGE_LAYOUT_GENERAL,
-      srcStage,
-      VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
-      VkImageSubresourceRange{
-          img.getImageAspectFlags(), 0, VK_REMAINING_MIP_LEVELS, 0, VK_REMAINING_ARRAY_LAYERS});
+  const VkImageSubresourceRange range{
+      img.getImageAspectFlags(), 0, VK_REMAINING_MIP_LEVELS, 0, VK_REMAINING_ARRAY_LAYERS};
+  if (batcher) {
+    img.transitionLayoutBatched(
+        *batcher, VK_IMAGE_LAYOUT_GENERAL, srcStage, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, range);
+  } else {
+    img.transitionLayout(
+        cmdBuf, VK_IMAGE_LAYOUT_GENERAL, srcStage, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, range);
+  }
 }
 
-void transitionToColorAttachment(VkCommandBuffer cmdBuf, ITexture* colorTex) {
+void transitionToColorAttachment(VkCommandBuffer cmdBuf,
+                                 ITexture* colorTex,
+                                 VulkanBarrierBatcher* batcher) {
   IGL_PROFILER_FUNCTION_COLOR(IGL_PROFILER_COLOR_TRANSITION);
 
   if (!colorTex) {
@@ -431,19 +478,30 @@ void transitionToColorAttachment(VkCommandBuffer cmdBuf, ITexture* colorTex) {
   }
   if (img.usageFlags_ & VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT) {
     // transition to VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL
-    img.transitionLayout(
-        cmdBuf,
-        VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+    const VkPipelineStageFlags srcStage =
         VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT |
-            VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, // wait for all subsequent fragment/compute
-                                                  // shaders
-        VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
-        VkImageSubresourceRange{
-            VK_IMAGE_ASPECT_COLOR_BIT, 0, VK_REMAINING_MIP_LEVELS, 0, VK_REMAINING_ARRAY_LAYERS});
+        VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT; // wait for all subsequent fragment/compute shaders
+    const VkImageSubresourceRange range{
+        VK_IMAGE_ASPECT_COLOR_BIT, 0, VK_REMAINING_MIP_LEVELS, 0, VK_REMAINING_ARRAY_LAYERS};
+    if (batcher) {
+      img.transitionLayoutBatched(*batcher,
+                                  VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+                                  srcStage,
+                                  VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+                                  range);
+    } else {
+      img.transitionLayout(cmdBuf,
+                           VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+                           srcStage,
+                           VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+                           range);
+    }
   }
 }
 
-void transitionToDepthStencilAttachment(VkCommandBuffer cmdBuf, ITexture* depthStencilTex) {
+void transitionToDepthStencilAttachment(VkCommandBuffer cmdBuf,
+                                        ITexture* depthStencilTex,
+                                        VulkanBarrierBatcher* batcher) {
   IGL_PROFILER_FUNCTION_COLOR(IGL_PROFILER_COLOR_TRANSITION);
 
   if (!depthStencilTex) {
@@ -471,19 +529,30 @@ void transitionToDepthStencilAttachment(VkCommandBuffer cmdBuf, ITexture* depthS
     if (img.isStencilFormat_) {
       aspectFlags |= VK_IMAGE_ASPECT_STENCIL_BIT;
     }
-    img.transitionLayout(
-        cmdBuf,
-        VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL,
+    const VkPipelineStageFlags srcStage =
         VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT |
-            VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, // wait for all subsequent fragment/compute
-                                                  // shaders
-        VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT,
-        VkImageSubresourceRange{
-            aspectFlags, 0, VK_REMAINING_MIP_LEVELS, 0, VK_REMAINING_ARRAY_LAYERS});
+        VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT; // wait for all subsequent fragment/compute shaders
+    const VkImageSubresourceRange range{
+        aspectFlags, 0, VK_REMAINING_MIP_LEVELS, 0, VK_REMAINING_ARRAY_LAYERS};
+    if (batcher) {
+      img.transitionLayoutBatched(*batcher,
+                                  VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL,
+                                  srcStage,
+                                  VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT,
+                                  range);
+    } else {
+      img.transitionLayout(cmdBuf,
+                           VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL,
+                           srcStage,
+                           VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT,
+                           range);
+    }
   }
 }
 
-void transitionToShaderReadOnly(VkCommandBuffer cmdBuf, ITexture* texture) {
+void transitionToShaderReadOnly(VkCommandBuffer cmdBuf,
+                                ITexture* texture,
+                                VulkanBarrierBatcher* batcher) {
   IGL_PROFILER_FUNCTION_COLOR(IGL_PROFILER_COLOR_TRANSITION);
 
   if (!texture) {
@@ -497,15 +566,20 @@ void transitionToShaderReadOnly(VkCommandBuffer cmdBuf, ITexture* texture) {
 
   if (img.usageFlags_ & VK_IMAGE_USAGE_SAMPLED_BIT) {
     // transition sampled images to VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL
-    img.transitionLayout(
-        cmdBuf,
-        VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
-        isColor ? VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT
-                : VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT,
+    const VkPipelineStageFlags srcStage = isColor ? VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT
+                                                  : VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+    const VkPipelineStageFlags dstStage =
         VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT |
-            VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, // wait for subsequent fragment/compute shaders
-        VkImageSubresourceRange{
-            img.getImageAspectFlags(), 0, VK_REMAINING_MIP_LEVELS, 0, VK_REMAINING_ARRAY_LAYERS});
+        VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT; // wait for subsequent fragment/compute shaders
+    const VkImageSubresourceRange range{
+        img.getImageAspectFlags(), 0, VK_REMAINING_MIP_LEVELS, 0, VK_REMAINING_ARRAY_LAYERS};
+    if (batcher) {
+      img.transitionLayoutBatched(
+          *batcher, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, srcStage, dstStage, range);
+    } else {
+      img.transitionLayout(
+          cmdBuf, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, srcStage, dstStage, range);
+    }
   }
 }
 
@@ -114,23 +114,40 @@ VkFormat textureFormatToVkFormat(igl::TextureFormat format);
 igl::TextureFormat vkFormatToTextureFormat(VkFormat format);
 igl::ColorSpace vkColorSpaceToColorSpace(VkColorSpaceKHR colorSpace);
 VkMemoryPropertyFlags resourceStorageToVkMemoryPropertyFlags(igl::ResourceStorage resourceStorage);
+VkMemoryPropertyFlags memoryPlacementToVkMemoryPropertyFlags(igl::MemoryPlacement placement);
 VkCompareOp compareFunctionToVkCompareOp(igl::CompareFunction func);
+VkStencilOp stencilOperationToVkStencilOp(igl::StencilOperation op);
 VkSampleCountFlagBits getVulkanSampleCountFlags(size_t numSamples);
 VkSurfaceFormatKHR colorSpaceToVkSurfaceFormat(igl::ColorSpace colorSpace, bool isBGR);
 uint32_t getVkLayer(igl::TextureType type, uint32_t face, uint32_t layer);
 TextureRangeDesc atVkLayer(TextureType type, const TextureRangeDesc& range, uint32_t vkLayer);
 
+class VulkanBarrierBatcher;
+
+// The transition helpers below record the layout transition into `cmdBuf` immediately. When a
+// `batcher` is provided, the barrier is accumulated into it instead and is only recorded when the
+// batcher is flushed, which allows transitions of multiple resources to be combined into a single
+// vkCmdPipelineBarrier() call
+
 /// @brief Transition from the current layout to VK_IMAGE_LAYOUT_GENERAL
-void transitionToGeneral(VkCommandBuffer cmdBuf, ITexture* texture);
+void transitionToGeneral(VkCommandBuffer cmdBuf,
+                         ITexture* texture,
+                         VulkanBarrierBatcher* batcher = nullptr);
 
 /// @brief Transition from the current layout to VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL
-void transitionToColorAttachment(VkCommandBuffer cmdBuf, ITexture* colorTex);
+void transitionToColorAttachment(VkCommandBuffer cmdBuf,
+                                 ITexture* colorTex,
+                                 VulkanBarrierBatcher* batcher = nullptr);
 
 /// @brief Transition from the current layout to VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL
-void transitionToDepthStencilAttachment(VkCommandBuffer cmdBuf, ITexture* depthStencilTex);
+void transitionToDepthStencilAttachment(VkCommandBuffer cmdBuf,
+                                        ITexture* depthStencilTex,
+                                        VulkanBarrierBatcher* batcher = nullptr);
 
 /// @brief Transition from the current layout to VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL
-void transitionToShaderReadOnly(VkCommandBuffer cmdBuf, ITexture* texture);
+void transitionToShaderReadOnly(VkCommandBuffer cmdBuf,
+                                ITexture* texture,
+                                VulkanBarrierBatcher* batcher = nullptr);
 
 /// @brief Overrides the layout stored in the `texture` with the one in `layout`. This function does
 /// not perform a transition, it only updates the texture's member variable that stores its current
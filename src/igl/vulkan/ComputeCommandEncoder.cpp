@@ -7,6 +7,7 @@
 
 #include <igl/vulkan/ComputeCommandEncoder.h>
 
+#include <igl/TextureSampleFeedback.h>
 #include <igl/vulkan/Buffer.h>
 #include <igl/vulkan/ComputePipelineState.h>
 #include <igl/vulkan/Texture.h>
@@ -17,11 +18,14 @@
 #include <igl/vulkan/VulkanPipelineLayout.h>
 #include <igl/vulkan/VulkanTexture.h>
 
+#include <algorithm>
+
 namespace igl {
 namespace vulkan {
 
 ComputeCommandEncoder::ComputeCommandEncoder(const std::shared_ptr<CommandBuffer>& commandBuffer,
                                              VulkanContext& ctx) :
+  IComputeCommandEncoder(commandBuffer),
   ctx_(ctx),
   cmdBuffer_(commandBuffer ? commandBuffer->getVkCommandBuffer() : VK_NULL_HANDLE),
   binder_(commandBuffer, ctx_, VK_PIPELINE_BIND_POINT_COMPUTE) {
@@ -56,9 +60,14 @@ void ComputeCommandEncoder::endEncoding() {
                                                     VK_REMAINING_MIP_LEVELS,
                                                     0,
                                                     VK_REMAINING_ARRAY_LAYERS});
+      getCommandBuffer().mutableStatistics().barrierCount++;
     }
   }
   restoreLayout_.clear();
+
+  if (ctx_.config_.enableGpuCrashBreadcrumbs) {
+    ctx_.writeGpuBreadcrumb(cmdBuffer_, "compute pass end");
+  }
 }
 
 void ComputeCommandEncoder::bindComputePipelineState(
@@ -71,7 +80,9 @@ void ComputeCommandEncoder::bindComputePipelineState(
 
   cps_ = static_cast<igl::vulkan::ComputePipelineState*>(pipelineState.get());
 
-  binder_.bindPipeline(cps_->getVkPipeline(), &cps_->getSpvModuleInfo());
+  binder_.bindPipeline(cps_->getVkPipeline(), &cps_->getSpvModuleInfo(), cps_);
+
+  getCommandBuffer().mutableStatistics().pipelineBindCount++;
 
   if (ctx_.config_.enableDescriptorIndexing) {
     VkDescriptorSet dset = ctx_.getBindlessVkDescriptorSet();
@@ -79,50 +90,126 @@ void ComputeCommandEncoder::bindComputePipelineState(
 #if IGL_VULKAN_PRINT_COMMANDS
     IGL_LOG_INFO("%p vkCmdBindDescriptorSets(COMPUTE) - bindless\n", cmdBuffer_);
 #endif // IGL_VULKAN_PRINT_COMMANDS
-    ctx_.vf_.vkCmdBindDescriptorSets(cmdBuffer_,
-                                     VK_PIPELINE_BIND_POINT_COMPUTE,
-                                     cps_->getVkPipelineLayout(),
-                                     kBindPoint_Bindless,
-                                     1,
-                                     &dset,
-                                     0,
-                                     nullptr);
+    IGL_VULKAN_HOT_FN(ctx_.vf_, vkCmdBindDescriptorSets)(cmdBuffer_,
+                                                         VK_PIPELINE_BIND_POINT_COMPUTE,
+                                                         cps_->getVkPipelineLayout(),
+                                                         kBindPoint_Bindless,
+                                                         1,
+                                                         &dset,
+                                                         0,
+                                                         nullptr);
   }
 }
 
 void ComputeCommandEncoder::dispatchThreadGroups(const Dimensions& threadgroupCount,
                                                  const Dimensions& /*threadgroupSize*/,
                                                  const Dependencies& dependencies) {
-  (void)dependencies;
-
   IGL_PROFILER_FUNCTION();
 
   IGL_ASSERT_MSG(cps_, "Did you forget to call bindComputePipelineState()?");
 
+  auto& stats = getCommandBuffer().mutableStatistics();
+
   for (ITexture* tex : dependencies.textures) {
     if (!tex) {
       break;
     }
+    const VkImage image =
+        static_cast<igl::vulkan::Texture*>(tex)->getVulkanTexture().getVulkanImage().getVkImage();
+    // elide the barrier when this encoder already synchronized the image and no dispatch has
+    // written it since
+    if (synchronizedImages_.count(image) && !dirtyImages_.count(image)) {
+      continue;
+    }
     igl::vulkan::transitionToGeneral(cmdBuffer_, tex);
+    synchronizedImages_.insert(image);
+    dirtyImages_.erase(image);
+    stats.barrierCount++;
   }
   for (IBuffer* buf : dependencies.buffers) {
     if (!buf) {
       break;
     }
     const auto* vkBuf = static_cast<igl::vulkan::Buffer*>(buf);
+    const VkBuffer buffer = vkBuf->getVkBuffer();
+    if (synchronizedBuffers_.count(buffer) && !dirtyBuffers_.count(buffer)) {
+      continue;
+    }
     ivkBufferBarrier(&ctx_.vf_,
                      cmdBuffer_,
-                     vkBuf->getVkBuffer(),
+                     buffer,
                      vkBuf->getBufferUsageFlags(),
                      VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT |
                          VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
                      VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT);
+    synchronizedBuffers_.insert(buffer);
+    dirtyBuffers_.erase(buffer);
+    stats.barrierCount++;
   }
 
   binder_.updateBindings(cps_->getVkPipelineLayout(), *cps_);
+
+  // RAW/WAW hazards on resources the bound pipeline accesses (per its SPIR-V reflection data)
+  // that a previous dispatch in this encoder may have written and that the explicit dependencies
+  // above did not cover
+  const util::SpvModuleInfo& info = cps_->getSpvModuleInfo();
+  for (const util::BufferDescription& desc : info.storageBuffers) {
+    const VkBuffer buffer = binder_.boundStorageBuffer(desc.bindingLocation);
+    if (buffer == VK_NULL_HANDLE || dirtyBuffers_.count(buffer) == 0) {
+      continue;
+    }
+    ivkBufferBarrier(&ctx_.vf_,
+                     cmdBuffer_,
+                     buffer,
+                     0,
+                     VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                     VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT);
+    synchronizedBuffers_.insert(buffer);
+    dirtyBuffers_.erase(buffer);
+    stats.barrierCount++;
+  }
+  for (const util::TextureDescription& desc : info.textures) {
+    const igl::vulkan::VulkanTexture* tex = binder_.boundTexture(desc.bindingLocation);
+    if (!tex) {
+      continue;
+    }
+    const igl::vulkan::VulkanImage& img = tex->getVulkanImage();
+    if (dirtyImages_.count(img.getVkImage()) == 0) {
+      continue;
+    }
+    // the image is already in VK_IMAGE_LAYOUT_GENERAL here; this only inserts the
+    // compute->compute execution and memory dependency
+    img.transitionLayout(cmdBuffer_,
+                         VK_IMAGE_LAYOUT_GENERAL,
+                         VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                         VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                         VkImageSubresourceRange{img.getImageAspectFlags(),
+                                                 0,
+                                                 VK_REMAINING_MIP_LEVELS,
+                                                 0,
+                                                 VK_REMAINING_ARRAY_LAYERS});
+    synchronizedImages_.insert(img.getVkImage());
+    dirtyImages_.erase(img.getVkImage());
+    stats.barrierCount++;
+  }
+
   // threadgroupSize is controlled inside compute shaders
   ctx_.vf_.vkCmdDispatch(
       cmdBuffer_, threadgroupCount.width, threadgroupCount.height, threadgroupCount.depth);
+  stats.dispatchCount++;
+
+  // storage resources visible to the pipeline may have been written by this dispatch; the next
+  // dispatch touching them (or the next explicit dependency on them) has to emit a barrier
+  for (const util::BufferDescription& desc : info.storageBuffers) {
+    if (const VkBuffer buffer = binder_.boundStorageBuffer(desc.bindingLocation)) {
+      dirtyBuffers_.insert(buffer);
+    }
+  }
+  for (const util::TextureDescription& desc : info.textures) {
+    if (const igl::vulkan::VulkanTexture* tex = binder_.boundTexture(desc.bindingLocation)) {
+      dirtyImages_.insert(tex->getVulkanImage().getVkImage());
+    }
+  }
 }
 
 void ComputeCommandEncoder::pushDebugGroupLabel(const char* label, const igl::Color& color) const {
@@ -155,11 +242,27 @@ void ComputeCommandEncoder::bindTexture(size_t index, ITexture* texture) {
   const igl::vulkan::VulkanTexture& vkTex = tex->getVulkanTexture();
   const igl::vulkan::VulkanImage* vkImage = &vkTex.getVulkanImage();
 
-  igl::vulkan::transitionToGeneral(cmdBuffer_, texture);
+  auto& stats = getCommandBuffer().mutableStatistics();
+
+  // only transition on the first use within this encoder; if a previous dispatch wrote the image,
+  // the hazard check in dispatchThreadGroups() emits the barrier instead
+  if (synchronizedImages_.count(vkImage->getVkImage()) == 0) {
+    igl::vulkan::transitionToGeneral(cmdBuffer_, texture);
+    synchronizedImages_.insert(vkImage->getVkImage());
+    stats.barrierCount++;
+  }
 
-  restoreLayout_.push_back(vkImage);
+  if (std::find(restoreLayout_.begin(), restoreLayout_.end(), vkImage) == restoreLayout_.end()) {
+    restoreLayout_.push_back(vkImage);
+  }
 
   binder_.bindTexture(index, static_cast<igl::vulkan::Texture*>(texture));
+
+  if (const auto& feedback = ctx_.textureSampleFeedback()) {
+    feedback->recordSample(texture);
+  }
+
+  stats.textureBindCount++;
 }
 
 void ComputeCommandEncoder::bindBuffer(size_t index,
@@ -183,6 +286,8 @@ void ComputeCommandEncoder::bindBuffer(size_t index,
   }
 
   binder_.bindStorageBuffer((int)index, buf, offset);
+
+  getCommandBuffer().mutableStatistics().bufferBindCount++;
 }
 
 void ComputeCommandEncoder::bindBytes(size_t /*index*/, const void* /*data*/, size_t /*length*/) {
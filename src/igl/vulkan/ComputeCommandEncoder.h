@@ -13,6 +13,8 @@
 #include <igl/vulkan/ResourcesBinder.h>
 #include <igl/vulkan/util/SpvReflection.h>
 
+#include <unordered_set>
+
 namespace igl {
 
 class ICommandBuffer;
@@ -26,7 +28,7 @@ class ComputePipelineState;
 class VulkanImage;
 
 /// @brief Implements the igl::IComputeCommandEncoder interface for Vulkan
-class ComputeCommandEncoder : public IComputeCommandEncoder {
+class ComputeCommandEncoder final : public IComputeCommandEncoder {
  public:
   ComputeCommandEncoder(const std::shared_ptr<CommandBuffer>& commandBuffer, VulkanContext& ctx);
   ~ComputeCommandEncoder() override {
@@ -36,6 +38,11 @@ class ComputeCommandEncoder : public IComputeCommandEncoder {
 
   void bindComputePipelineState(
       const std::shared_ptr<IComputePipelineState>& pipelineState) override;
+
+  /// @brief Dispatches a compute workload. Barriers are emitted only on actual hazards: an
+  /// explicit dependency that has not been synchronized within this encoder yet, or a resource
+  /// of the bound pipeline (per its SPIR-V reflection data) that an earlier dispatch in this
+  /// encoder may have written. Independent dispatches are merged into barrier-free runs
   void dispatchThreadGroups(const Dimensions& threadgroupCount,
                             const Dimensions& threadgroupSize,
                             const Dependencies& dependencies) override;
@@ -80,6 +87,14 @@ class ComputeCommandEncoder : public IComputeCommandEncoder {
 
   std::vector<const igl::vulkan::VulkanImage*> restoreLayout_;
 
+  // Hazard tracking for inter-dispatch barrier elision: resources that earlier dispatches in
+  // this encoder may have written (and are therefore hazardous until the next barrier), and
+  // resources that have already been synchronized within this encoder since their last write
+  std::unordered_set<VkBuffer> dirtyBuffers_;
+  std::unordered_set<VkImage> dirtyImages_;
+  std::unordered_set<VkBuffer> synchronizedBuffers_;
+  std::unordered_set<VkImage> synchronizedImages_;
+
   const igl::vulkan::ComputePipelineState* cps_ = nullptr;
 };
 
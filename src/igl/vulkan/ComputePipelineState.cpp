@@ -35,6 +35,8 @@ ComputePipelineState ::~ComputePipelineState() {
 }
 
 VkPipeline ComputePipelineState::getVkPipeline() const {
+  IGL_PROFILER_FUNCTION_COLOR(IGL_PROFILER_COLOR_CREATE);
+
   const VulkanContext& ctx = device_.getVulkanContext();
 
   if (ctx.config_.enableDescriptorIndexing) {
@@ -78,11 +80,14 @@ VkPipeline ComputePipelineState::getVkPipeline() const {
 
   const auto& shaderModule = desc_.shaderStages->getComputeModule();
 
+  VkPipelineShaderStageCreateInfo stage = ivkGetPipelineShaderStageCreateInfo(
+      VK_SHADER_STAGE_COMPUTE_BIT,
+      igl::vulkan::ShaderModule::getVkShaderModule(shaderModule),
+      shaderModule->info().entryPoint.c_str());
+  stage.pSpecializationInfo = igl::vulkan::ShaderModule::getSpecializationInfo(shaderModule);
+
   igl::vulkan::VulkanComputePipelineBuilder()
-      .shaderStage(ivkGetPipelineShaderStageCreateInfo(
-          VK_SHADER_STAGE_COMPUTE_BIT,
-          igl::vulkan::ShaderModule::getVkShaderModule(shaderModule),
-          shaderModule->info().entryPoint.c_str()))
+      .shaderStage(stage)
       .build(ctx.vf_,
              ctx.device_->getVkDevice(),
              ctx.pipelineCache_,
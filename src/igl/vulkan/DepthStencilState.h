@@ -8,21 +8,68 @@
 #pragma once
 
 #include <igl/DepthStencilState.h>
+#include <igl/vulkan/Common.h>
 
 namespace igl {
 namespace vulkan {
 
-/// @brief Implements the igl::IDepthStencilState interface
+/// @brief Implements the igl::IDepthStencilState interface. All enum translation to Vulkan
+/// values happens once at creation; binding just feeds the resolved values into the encoder's
+/// dynamic state instead of translating the desc on every bind.
 class DepthStencilState final : public IDepthStencilState {
  public:
-  explicit DepthStencilState(const DepthStencilStateDesc& desc) : desc_(desc) {}
+  /// @brief Per-face stencil state resolved to ready-to-submit Vulkan values
+  struct ResolvedStencilFace {
+    /// false when the face equals the default StencilStateDesc; binding skips disabled faces
+    bool enabled = false;
+    VkStencilOp failOp = VK_STENCIL_OP_KEEP;
+    VkStencilOp passOp = VK_STENCIL_OP_KEEP;
+    VkStencilOp depthFailOp = VK_STENCIL_OP_KEEP;
+    VkCompareOp compareOp = VK_COMPARE_OP_ALWAYS;
+    uint32_t readMask = 0;
+    uint32_t writeMask = 0;
+  };
+
+  explicit DepthStencilState(const DepthStencilStateDesc& desc) :
+    desc_(desc),
+    depthCompareOp_(compareFunctionToVkCompareOp(desc.compareFunction)),
+    front_(resolveFace(desc.frontFaceStencil)),
+    back_(resolveFace(desc.backFaceStencil)) {}
 
   const DepthStencilStateDesc& getDepthStencilStateDesc() const {
     return desc_;
   }
 
+  [[nodiscard]] VkCompareOp getDepthCompareOp() const {
+    return depthCompareOp_;
+  }
+
+  [[nodiscard]] const ResolvedStencilFace& getFrontFace() const {
+    return front_;
+  }
+
+  [[nodiscard]] const ResolvedStencilFace& getBackFace() const {
+    return back_;
+  }
+
  private:
+  static ResolvedStencilFace resolveFace(const StencilStateDesc& desc) {
+    if (desc == StencilStateDesc()) {
+      return {};
+    }
+    return {true,
+            stencilOperationToVkStencilOp(desc.stencilFailureOperation),
+            stencilOperationToVkStencilOp(desc.depthStencilPassOperation),
+            stencilOperationToVkStencilOp(desc.depthFailureOperation),
+            compareFunctionToVkCompareOp(desc.stencilCompareFunction),
+            desc.readMask,
+            desc.writeMask};
+  }
+
   DepthStencilStateDesc desc_;
+  VkCompareOp depthCompareOp_ = VK_COMPARE_OP_LESS;
+  ResolvedStencilFace front_;
+  ResolvedStencilFace back_;
 };
 
 } // namespace vulkan
@@ -28,11 +28,10 @@
 #include <igl/vulkan/VulkanImageView.h>
 #include <igl/vulkan/VulkanShaderModule.h>
 
-// Writes the shader code to disk for debugging. Used in `Device::createShaderModule()`
-#if IGL_SHADER_DUMP && IGL_DEBUG
+// Used by the on-disk shader cache and, when enabled, by the shader dump debugging code in
+// `Device::createShaderModule()`
 #include <filesystem>
 #include <fstream>
-#endif // IGL_SHADER_DUMP && IGL_DEBUG
 
 namespace {
 
@@ -45,6 +44,45 @@ bool supportsFormat(const VulkanFunctionTable& vf,
          properties.optimalTilingFeatures != 0;
 }
 
+bool loadCachedSpirv(const std::string& directory,
+                     uint64_t hash,
+                     std::vector<uint32_t>& outSpirv) {
+  const std::filesystem::path path =
+      std::filesystem::path(directory) / IGL_FORMAT("{:016x}.spv", hash);
+  std::ifstream file(path, std::ios::in | std::ios::binary | std::ios::ate);
+  if (!file) {
+    return false;
+  }
+  const std::streamsize size = file.tellg();
+  if (size <= 0 || (size % sizeof(uint32_t)) != 0) {
+    return false;
+  }
+  outSpirv.resize(static_cast<size_t>(size) / sizeof(uint32_t));
+  file.seekg(0, std::ios::beg);
+  if (!file.read(reinterpret_cast<char*>(outSpirv.data()), size)) {
+    outSpirv.clear();
+    return false;
+  }
+  return true;
+}
+
+void saveCachedSpirv(const std::string& directory,
+                     uint64_t hash,
+                     const std::vector<uint32_t>& spirv) {
+  // failing to populate the cache is not an error - the shader has been compiled already
+  std::error_code ec;
+  std::filesystem::create_directories(directory, ec);
+  const std::filesystem::path path =
+      std::filesystem::path(directory) / IGL_FORMAT("{:016x}.spv", hash);
+  std::ofstream file(path, std::ios::out | std::ios::binary);
+  if (!file) {
+    IGL_LOG_INFO("Could not write shader cache file: %s\n", path.string().c_str());
+    return;
+  }
+  file.write(reinterpret_cast<const char*>(spirv.data()),
+             static_cast<std::streamsize>(spirv.size() * sizeof(uint32_t)));
+}
+
 VkShaderStageFlagBits shaderStageToVkShaderStage(igl::ShaderStage stage) {
   switch (stage) {
   case igl::ShaderStage::Vertex:
@@ -191,6 +229,8 @@ std::shared_ptr<IRenderPipelineState> Device::createRenderPipeline(const RenderP
                                                                    Result* outResult) const {
   IGL_PROFILER_FUNCTION_COLOR(IGL_PROFILER_COLOR_CREATE);
 
+  recordPipelineUsage(desc);
+
   if (IGL_UNEXPECTED(desc.shaderStages == nullptr)) {
     Result::setResult(outResult, Result::Code::ArgumentInvalid, "Missing shader stages");
     return nullptr;
@@ -240,7 +280,8 @@ std::shared_ptr<IShaderModule> Device::createShaderModule(const ShaderModuleDesc
     return nullptr;
   }
   Result::setResult(outResult, std::move(result));
-  return std::make_shared<ShaderModule>(desc.info, std::move(vulkanShaderModule));
+  return std::make_shared<ShaderModule>(
+      desc.info, std::move(vulkanShaderModule), desc.specializationConstants);
 }
 
 std::shared_ptr<VulkanShaderModule> Device::createShaderModule(const void* data,
@@ -296,7 +337,7 @@ std::shared_ptr<VulkanShaderModule> Device::createShaderModule(const void* data,
       ctx_->vf_,
       device,
       vkShaderModule,
-      util::getReflectionData(reinterpret_cast<const uint32_t*>(data), length));
+      ctx_->getOrCreateSpvModuleInfo(reinterpret_cast<const uint32_t*>(data), length));
 }
 
 std::shared_ptr<VulkanShaderModule> Device::createShaderModule(ShaderStage stage,
@@ -353,6 +394,10 @@ std::shared_ptr<VulkanShaderModule> Device::createShaderModule(ShaderStage stage
       )"
                                                                                       : "";
 
+    // reserve the final length up front so appending a large source cannot reallocate and copy it
+    sourcePatched.reserve(64 + extraExtensions.size() + enhancedShaderDebuggingCode.size() +
+                          bindlessTexturesSource.size() + strlen(source));
+
     // there's no header provided in the shader source, let's insert our own header
     if (vkStage == VK_SHADER_STAGE_VERTEX_BIT || vkStage == VK_SHADER_STAGE_COMPUTE_BIT) {
       sourcePatched += R"(
@@ -370,16 +415,61 @@ std::shared_ptr<VulkanShaderModule> Device::createShaderModule(ShaderStage stage
     source = sourcePatched.c_str();
   }
 
-  glslang_resource_t glslangResource;
-  ivkGlslangResource(&glslangResource, &ctx_->getVkPhysicalDeviceProperties());
+  // the patched source (not the user-provided one) is hashed, since the injected header depends on
+  // the context configuration and the enabled extensions
+  const std::string& shaderCacheDir = ctx_->config_.shaderCacheDirectoryPath;
+  const uint64_t sourceHash = VulkanShaderPack::hashShaderSource(source, vkStage);
+
+  // precompiled SPIR-V from the shader pack needs no caching or memoization - the words are
+  // consumed straight out of the mapped file (see VulkanContextConfig::shaderPackFilePath)
+  {
+    size_t packSizeInBytes = 0;
+    const uint32_t* packSpirv = ctx_->shaderPack_.find(sourceHash, &packSizeInBytes);
+    if (packSpirv != nullptr) {
+      return createShaderModule(packSpirv, packSizeInBytes, debugName, outResult);
+    }
+  }
 
   std::vector<uint32_t> spirv;
-  const Result result =
-      igl::vulkan::compileShader(ctx_->vf_, device, vkStage, source, spirv, &glslangResource);
+  Result result;
 
-  VkShaderModule vkShaderModule = VK_NULL_HANDLE;
-  VK_ASSERT(ivkCreateShaderModuleFromSPIRV(
-      &ctx_->vf_, device, spirv.data(), spirv.size() * sizeof(uint32_t), &vkShaderModule));
+  // glslang's C interface has no way to reuse a parsed AST across shaders, so repeated front-end
+  // work is avoided one level up: identical patched sources hit this in-memory memo and skip
+  // glslang entirely (the on-disk cache below only helps across runs, and only when configured)
+  bool memoHit = false;
+  {
+    const std::lock_guard<std::mutex> lock(spirvMemoMutex_);
+    const auto it = spirvMemo_.find(sourceHash);
+    if (it != spirvMemo_.end()) {
+      spirv = it->second;
+      memoHit = true;
+    }
+  }
+
+  if (!memoHit) {
+    if (shaderCacheDir.empty() || !loadCachedSpirv(shaderCacheDir, sourceHash, spirv)) {
+#if !IGL_VULKAN_NO_GLSLANG
+      glslang_resource_t glslangResource;
+      ivkGlslangResource(&glslangResource, &ctx_->getVkPhysicalDeviceProperties());
+
+      result =
+          igl::vulkan::compileShader(ctx_->vf_, device, vkStage, source, spirv, &glslangResource);
+
+      if (result.isOk() && !shaderCacheDir.empty()) {
+        saveCachedSpirv(shaderCacheDir, sourceHash, spirv);
+      }
+#else
+      result = Result(Result::Code::Unsupported,
+                      "Runtime shader compilation is compiled out (IGL_VULKAN_NO_GLSLANG); "
+                      "provide this shader through a shader pack, the SPIR-V cache, or as a "
+                      "binary input");
+#endif // !IGL_VULKAN_NO_GLSLANG
+    }
+    if (result.isOk()) {
+      const std::lock_guard<std::mutex> lock(spirvMemoMutex_);
+      spirvMemo_.emplace(sourceHash, spirv);
+    }
+  }
 
   Result::setResult(outResult, result);
 
@@ -387,6 +477,10 @@ std::shared_ptr<VulkanShaderModule> Device::createShaderModule(ShaderStage stage
     return nullptr;
   }
 
+  VkShaderModule vkShaderModule = VK_NULL_HANDLE;
+  VK_ASSERT(ivkCreateShaderModuleFromSPIRV(
+      &ctx_->vf_, device, spirv.data(), spirv.size() * sizeof(uint32_t), &vkShaderModule));
+
   if (!debugName.empty()) {
     // set debug name
     VK_ASSERT(ivkSetDebugObjectName(&ctx_->vf_,
@@ -402,7 +496,7 @@ std::shared_ptr<VulkanShaderModule> Device::createShaderModule(ShaderStage stage
       ctx_->vf_,
       device,
       vkShaderModule,
-      util::getReflectionData(spirv.data(), spirv.size() * sizeof(uint32_t)));
+      ctx_->getOrCreateSpvModuleInfo(spirv.data(), spirv.size() * sizeof(uint32_t)));
 }
 
 std::shared_ptr<IFramebuffer> Device::createFramebuffer(const FramebufferDesc& desc,
@@ -422,6 +516,16 @@ size_t Device::getCurrentDrawCount() const {
   return ctx_->drawCallCount_;
 }
 
+bool Device::getMemoryStatistics(DeviceMemoryStatistics& outStatistics) const {
+  return ctx_->getMemoryStatistics(outStatistics);
+}
+
+void Device::setTextureSampleFeedback(std::shared_ptr<TextureSampleFeedback> feedback) noexcept {
+  // the encoders read it from the context; keep the IDevice copy for getTextureSampleFeedback()
+  ctx_->setTextureSampleFeedback(feedback);
+  IDevice::setTextureSampleFeedback(std::move(feedback));
+}
+
 std::unique_ptr<igl::IShaderLibrary> Device::createShaderLibrary(const ShaderLibraryDesc& desc,
                                                                  Result* outResult) const {
   IGL_PROFILER_FUNCTION_COLOR(IGL_PROFILER_COLOR_CREATE);
@@ -553,6 +657,10 @@ bool Device::hasFeature(DeviceFeatures feature) const {
     return true;
   case DeviceFeatures::DrawIndexedIndirect:
     return true;
+  case DeviceFeatures::DrawIndirectCount:
+    return ctx_->extensions_.enabled(VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME);
+  case DeviceFeatures::TextureViews:
+    return true;
   case DeviceFeatures::ValidationLayersEnabled:
     return ctx_->areValidationLayersEnabled();
   }
@@ -13,6 +13,9 @@
 #include <igl/vulkan/PlatformDevice.h>
 #include <igl/vulkan/VulkanSemaphore.h>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 
 namespace igl::vulkan {
 
@@ -21,6 +24,13 @@ class VulkanShaderModule;
 struct DeviceQueues;
 
 /// @brief Implements the igl::IDevice interface for Vulkan
+///
+/// Resource creation is thread-safe: createBuffer(), createTexture() and createSamplerState()
+/// may be called from multiple loader threads concurrently. The expensive driver work
+/// (vkCreateImage/vkCreateBuffer and memory allocation) runs without any global lock; only the
+/// context-side registries (the texture/sampler pools feeding the bindless descriptor set) and
+/// the staging device serialize internally on short critical sections. Command buffer creation,
+/// submission and presentation remain single-threaded.
 class Device final : public IDevice {
  public:
   explicit Device(std::unique_ptr<VulkanContext> ctx);
@@ -78,6 +88,10 @@ class Device final : public IDevice {
   }
   size_t getCurrentDrawCount() const override;
 
+  bool getMemoryStatistics(DeviceMemoryStatistics& outStatistics) const override;
+
+  void setTextureSampleFeedback(std::shared_ptr<TextureSampleFeedback> feedback) noexcept override;
+
   VulkanContext& getVulkanContext() {
     return *ctx_.get();
   }
@@ -97,6 +111,12 @@ class Device final : public IDevice {
 
   std::unique_ptr<VulkanContext> ctx_;
 
+  /// In-memory SPIR-V memo for createShaderModule(), keyed by the hash of the patched GLSL
+  /// source. Repeated compiles of identical source (common when pipeline variants recreate their
+  /// modules) skip the whole glslang front end; works regardless of the on-disk shader cache.
+  mutable std::mutex spirvMemoMutex_;
+  mutable std::unordered_map<uint64_t, std::vector<uint32_t>> spirvMemo_;
+
   PlatformDevice platformDevice_;
 };
 
@@ -25,7 +25,8 @@
 namespace igl {
 namespace vulkan {
 
-EnhancedShaderDebuggingStore::EnhancedShaderDebuggingStore() {
+EnhancedShaderDebuggingStore::EnhancedShaderDebuggingStore(uint32_t sampleInterval) :
+  sampleInterval_(sampleInterval) {
 #if !IGL_PLATFORM_ANDROID
   enabled_ = true;
 #endif
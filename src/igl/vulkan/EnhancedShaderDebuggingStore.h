@@ -70,8 +70,11 @@ class EnhancedShaderDebuggingStore {
   static constexpr bool kDepthWriteEnabled = false;
   static constexpr igl::CompareFunction kDepthCompareFunction = igl::CompareFunction::AlwaysPass;
 
-  /** @brief Constructs the object */
-  explicit EnhancedShaderDebuggingStore();
+  /** @brief Constructs the object
+   * @param[in] sampleInterval run the debugging pass only once every `sampleInterval` frames
+   * (1 = every frame). The frames in between present directly and skip the debugging pass
+   */
+  explicit EnhancedShaderDebuggingStore(uint32_t sampleInterval = 1u);
 
   /** @brief Initialize the object and stores the `Device` needed to create resources */
   void initialize(const igl::vulkan::Device* device);
@@ -118,6 +121,17 @@ class EnhancedShaderDebuggingStore {
    * render pass and the line drawing pass */
   void installBufferBarrier(const igl::ICommandBuffer& commandBuffer) const;
 
+  /** @brief Returns true if the debugging pass should run for the current frame. With a sampling
+   * interval of N, only one frame in N is debugged; the other frames present directly */
+  bool isActiveForCurrentFrame() const {
+    return sampleInterval_ <= 1u || (frameIndex_ % sampleInterval_) == 0u;
+  }
+
+  /** @brief Advances the sampling frame counter. Called once per presented frame */
+  void nextFrame() {
+    frameIndex_++;
+  }
+
  private:
   /** @brief Initializes the vertex buffer */
   void initializeBuffer() const;
@@ -137,6 +151,8 @@ class EnhancedShaderDebuggingStore {
 
  private:
   bool enabled_ = false;
+  uint32_t sampleInterval_ = 1u;
+  uint64_t frameIndex_ = 0;
   const igl::vulkan::Device* device_ = nullptr;
   mutable std::shared_ptr<igl::IBuffer> vertexBuffer_;
   mutable std::shared_ptr<igl::IDepthStencilState> depthStencilState_;
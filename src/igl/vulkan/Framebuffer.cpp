@@ -134,10 +134,12 @@ void Framebuffer::copyTextureColorAttachment(ICommandQueue& cmdQueue,
                                              std::shared_ptr<ITexture> destTexture,
                                              const TextureRangeDesc& range) const {
   IGL_PROFILER_FUNCTION();
-  // Currently doesn't support mipmaps
-  if (!IGL_VERIFY(range.mipLevel == 0 && range.numMipLevels == 1)) {
+  if (!IGL_VERIFY(range.numMipLevels == 1)) {
     return;
   }
+  // range.mipLevel addresses both the source attachment and destination levels, matching the
+  // Metal implementation
+  const uint32_t mipLevel = static_cast<uint32_t>(range.mipLevel);
 
   const auto& ctx = device_.getVulkanContext();
 
@@ -170,7 +172,8 @@ void Framebuffer::copyTextureColorAttachment(ICommandQueue& cmdQueue,
                         VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
                         VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, // Don't wait for anything
                         VK_PIPELINE_STAGE_TRANSFER_BIT,
-                        VkImageSubresourceRange{VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1});
+                        // only the written mip: UNDEFINED discards, and other mips must survive
+                        VkImageSubresourceRange{VK_IMAGE_ASPECT_COLOR_BIT, mipLevel, 1, 0, 1});
 
   // 2. Transition src into TRANSFER_SRC_OPTIMAL
   srcVkTex.getVulkanTexture().getVulkanImage().transitionLayout(
@@ -179,11 +182,11 @@ void Framebuffer::copyTextureColorAttachment(ICommandQueue& cmdQueue,
       VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, // Wait for all previous operation to
                                             // be done
       VK_PIPELINE_STAGE_TRANSFER_BIT,
-      VkImageSubresourceRange{VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1});
+      VkImageSubresourceRange{VK_IMAGE_ASPECT_COLOR_BIT, mipLevel, 1, 0, 1});
   // 3. Copy Image
   const VkImageCopy copy = ivkGetImageCopy2D(
       VkOffset2D{static_cast<int32_t>(range.x), static_cast<int32_t>(range.y)},
-      VkImageSubresourceLayers{VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1},
+      VkImageSubresourceLayers{VK_IMAGE_ASPECT_COLOR_BIT, mipLevel, 0, 1},
       VkExtent2D{static_cast<uint32_t>(range.width), static_cast<uint32_t>(range.height)});
 
   ctx.vf_.vkCmdCopyImage(cmdBuf,
@@ -201,7 +204,7 @@ void Framebuffer::copyTextureColorAttachment(ICommandQueue& cmdQueue,
       VK_PIPELINE_STAGE_TRANSFER_BIT, // Wait for Copy to be done
       VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, // Don't start anything until Copy is
                                          // done
-      VkImageSubresourceRange{VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1});
+      VkImageSubresourceRange{VK_IMAGE_ASPECT_COLOR_BIT, mipLevel, 1, 0, 1});
   dstVkTex.getVulkanTexture().getVulkanImage().transitionLayout(
       cmdBuf,
       dstVkTex.isSwapchainTexture() ? VK_IMAGE_LAYOUT_PRESENT_SRC_KHR
@@ -209,7 +212,7 @@ void Framebuffer::copyTextureColorAttachment(ICommandQueue& cmdQueue,
       VK_PIPELINE_STAGE_TRANSFER_BIT, // Wait for vkCmdCopyImage()
       VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, // Don't start anything until Copy is
                                          // done
-      VkImageSubresourceRange{VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1});
+      VkImageSubresourceRange{VK_IMAGE_ASPECT_COLOR_BIT, mipLevel, 1, 0, 1});
 
   cmdQueue.submit(*buffer);
 }
@@ -250,6 +253,29 @@ void Framebuffer::updateDrawableInternal(SurfaceTextures surfaceTextures, bool u
       desc_.depthAttachment.texture = std::move(surfaceTextures.depth);
     }
   }
+
+  if (const auto& color = getColorAttachment(0)) {
+    const auto newWidth = static_cast<uint32_t>(color->getDimensions().width);
+    const auto newHeight = static_cast<uint32_t>(color->getDimensions().height);
+    if ((newWidth != width_ || newHeight != height_) && newWidth && newHeight) {
+      width_ = newWidth;
+      height_ = newHeight;
+      // A resize invalidates the framebuffer cache: the old entries are keyed by image views
+      // that no longer exist, and the driver may recycle those handles for the new attachments,
+      // in which case a stale entry would alias a VkFramebuffer of the old size. Drop them and
+      // rebuild the combinations that were in active use so the first encode after the resize
+      // does not pay for vkCreateFramebuffer()
+      std::vector<UsedCombination> used;
+      {
+        const std::lock_guard<std::mutex> lock(framebuffersMutex_);
+        framebuffers_.clear();
+        used.swap(usedCombinations_);
+      }
+      for (const auto& combination : used) {
+        getVkFramebuffer(combination.mipLevel, combination.layer, combination.pass);
+      }
+    }
+  }
 }
 
 Framebuffer::Framebuffer(const Device& device, FramebufferDesc desc) :
@@ -352,6 +378,16 @@ VkFramebuffer Framebuffer::getVkFramebuffer(uint32_t mipLevel,
   }
 
   // now we can find a corresponding framebuffer
+  const std::lock_guard<std::mutex> lock(framebuffersMutex_);
+
+  // remember the combination so updateDrawableInternal() can pre-warm the cache after a resize
+  const UsedCombination combination{mipLevel, layer, pass};
+  if (std::find(usedCombinations_.begin(), usedCombinations_.end(), combination) ==
+          usedCombinations_.end() &&
+      usedCombinations_.size() < kMaxUsedCombinations) {
+    usedCombinations_.push_back(combination);
+  }
+
   auto it = framebuffers_.find(attachments);
 
   if (it != framebuffers_.end()) {
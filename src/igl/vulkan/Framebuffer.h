@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <mutex>
 #include <unordered_map>
 
 #include <igl/Framebuffer.h>
@@ -119,15 +120,32 @@ class Framebuffer final : public IFramebuffer {
  private:
   void updateDrawableInternal(SurfaceTextures surfaceTextures, bool updateDepthStencil);
 
+  /// @brief A (mip level, layer, render pass) combination this framebuffer was encoded with.
+  /// Recorded by getVkFramebuffer() and replayed after a resize so the VkFramebuffers in active
+  /// use are rebuilt up front instead of at the first encode with the new attachments
+  struct UsedCombination {
+    uint32_t mipLevel = 0;
+    uint32_t layer = 0;
+    VkRenderPass pass = VK_NULL_HANDLE;
+    bool operator==(const UsedCombination& other) const {
+      return mipLevel == other.mipLevel && layer == other.layer && pass == other.pass;
+    }
+  };
+
   const igl::vulkan::Device& device_;
   FramebufferDesc desc_; // attachments
 
   uint32_t width_ = 0;
   uint32_t height_ = 0;
 
-  /// @brief Cache of framebuffers created from the same set of attachments
+  /// @brief Cache of framebuffers created from the same set of attachments. Guarded by
+  /// framebuffersMutex_ since the same igl::IFramebuffer may be encoded from multiple threads
+  mutable std::mutex framebuffersMutex_;
   mutable std::unordered_map<Attachments, std::shared_ptr<VulkanFramebuffer>, HashFunction>
       framebuffers_;
+  // guarded by framebuffersMutex_; see UsedCombination
+  mutable std::vector<UsedCombination> usedCombinations_;
+  static constexpr size_t kMaxUsedCombinations = 16;
 };
 
 } // namespace igl::vulkan
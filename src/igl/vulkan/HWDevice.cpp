@@ -59,5 +59,54 @@ std::unique_ptr<IDevice> HWDevice::create(std::unique_ptr<VulkanContext> ctx,
   return result.isOk() ? std::make_unique<igl::vulkan::Device>(std::move(ctx)) : nullptr;
 }
 
+std::vector<std::unique_ptr<IDevice>> HWDevice::createDevices(VulkanContextConfig config,
+                                                              const HWDeviceQueryDesc& queryDesc,
+                                                              uint32_t maxDevices,
+                                                              size_t numExtraDeviceExtensions,
+                                                              const char** extraDeviceExtensions,
+                                                              Result* outResult) {
+  std::vector<std::unique_ptr<IDevice>> outDevices;
+
+  // each device lives in its own VulkanContext (and VkInstance), so the global function pointers
+  // loaded by one context must not be trusted by another
+  config.enableConcurrentVkDevicesSupport = true;
+
+  // probe instance: the descriptors (keyed by physical device GUID) are stable across instances
+  auto probeCtx = createContext(config, nullptr);
+  Result result;
+  const std::vector<HWDeviceDesc> descs = queryDevices(*probeCtx, queryDesc, &result);
+  probeCtx.reset();
+
+  if (!result.isOk()) {
+    Result::setResult(outResult, std::move(result));
+    return outDevices;
+  }
+
+  for (const HWDeviceDesc& desc : descs) {
+    if (maxDevices != 0 && outDevices.size() == maxDevices) {
+      break;
+    }
+    auto device = create(createContext(config, nullptr),
+                         desc,
+                         0, // width: headless
+                         0, // height
+                         numExtraDeviceExtensions,
+                         extraDeviceExtensions,
+                         &result);
+    if (!device) {
+      IGL_LOG_ERROR(
+          "Skipping Vulkan device \"%s\": %s\n", desc.name.c_str(), result.message.c_str());
+      continue;
+    }
+    outDevices.push_back(std::move(device));
+  }
+
+  Result::setResult(outResult,
+                    outDevices.empty()
+                        ? Result(Result::Code::Unsupported, "No Vulkan devices could be created")
+                        : Result());
+  return outDevices;
+}
+
 } // namespace vulkan
 } // namespace igl
@@ -60,6 +60,22 @@ class HWDevice final {
                                          size_t numExtraDeviceExtensions = 0,
                                          const char** extraDeviceExtensions = nullptr,
                                          Result* outResult = nullptr);
+
+  /*
+   * @brief Creates one headless vulkan::Device per physical device matching `queryDesc`, up to
+   *        `maxDevices` of them (0 = all matches). Every device gets its own VulkanContext, so
+   *        the devices operate independently; resources are shared across them explicitly
+   *        through external memory (see TextureDesc::TextureUsageBits::Shareable and
+   *        PlatformDevice::createTextureFromExportedMemory()). Devices that fail to initialize
+   *        are skipped with a log; the call succeeds when at least one device was created.
+   */
+  static std::vector<std::unique_ptr<IDevice>> createDevices(
+      VulkanContextConfig config,
+      const HWDeviceQueryDesc& queryDesc,
+      uint32_t maxDevices = 0,
+      size_t numExtraDeviceExtensions = 0,
+      const char** extraDeviceExtensions = nullptr,
+      Result* outResult = nullptr);
 };
 
 } // namespace vulkan
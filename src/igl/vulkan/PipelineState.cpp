@@ -54,15 +54,21 @@ void PipelineState::initializeSpvModuleInfoFromShaderStages(const VulkanContext&
   if (pushConstantMask) {
     const VkPhysicalDeviceLimits& limits = ctx.getVkPhysicalDeviceProperties().limits;
 
-    constexpr uint32_t kPushConstantsSize = 128;
+    // fall back to a fixed size when the block size could not be reflected from the SPIR-V
+    constexpr uint32_t kDefaultPushConstantsSize = 128;
 
-    if (!IGL_VERIFY(kPushConstantsSize <= limits.maxPushConstantsSize)) {
+    // VUID-vkCmdPushConstants-size-00369: size must be a multiple of 4
+    const uint32_t pushConstantsSize = info_.pushConstantsSize
+                                           ? (info_.pushConstantsSize + 3u) & ~3u
+                                           : kDefaultPushConstantsSize;
+
+    if (!IGL_VERIFY(pushConstantsSize <= limits.maxPushConstantsSize)) {
       IGL_LOG_ERROR("Push constants size exceeded %u (max %u bytes)",
-                    kPushConstantsSize,
+                    pushConstantsSize,
                     limits.maxPushConstantsSize);
     }
 
-    pushConstantRange_ = ivkGetPushConstantRange(pushConstantMask, 0, kPushConstantsSize);
+    pushConstantRange_ = ivkGetPushConstantRange(pushConstantMask, 0, pushConstantsSize);
   }
 }
 
@@ -83,14 +89,10 @@ PipelineState::PipelineState(const VulkanContext& ctx,
       bindings.emplace_back(ivkGetDescriptorSetLayoutBinding(
           t.bindingLocation, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1));
     }
-    std::vector<VkDescriptorBindingFlags> bindingFlags(bindings.size());
-    dslCombinedImageSamplers_ = std::make_unique<VulkanDescriptorSetLayout>(
-        ctx.vf_,
-        ctx.getVkDevice(),
-        VkDescriptorSetLayoutCreateFlags{},
+    dslCombinedImageSamplers_ = ctx.getOrCreateDescriptorSetLayout(
+        VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
         static_cast<uint32_t>(bindings.size()),
         bindings.data(),
-        bindingFlags.data(),
         IGL_FORMAT("Descriptor Set Layout (COMBINED_IMAGE_SAMPLER): {}", debugName).c_str());
   }
   // 1. Uniform buffers
@@ -98,17 +100,20 @@ PipelineState::PipelineState(const VulkanContext& ctx,
     std::vector<VkDescriptorSetLayoutBinding> bindings;
     bindings.reserve(info_.uniformBuffers.size());
     for (const auto& b : info_.uniformBuffers) {
-      bindings.emplace_back(ivkGetDescriptorSetLayoutBinding(
-          b.bindingLocation, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1));
+      // blocks small enough for VK_EXT_inline_uniform_block live directly inside the descriptor
+      // set; their descriptor count is the block size in bytes (see
+      // VulkanContext::isInlineUniformBlock())
+      bindings.emplace_back(
+          ctx.isInlineUniformBlock(b.size)
+              ? ivkGetDescriptorSetLayoutBinding(
+                    b.bindingLocation, VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT, b.size)
+              : ivkGetDescriptorSetLayoutBinding(
+                    b.bindingLocation, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1));
     }
-    std::vector<VkDescriptorBindingFlags> bindingFlags(bindings.size());
-    dslUniformBuffers_ = std::make_unique<VulkanDescriptorSetLayout>(
-        ctx.vf_,
-        ctx.getVkDevice(),
-        VkDescriptorSetLayoutCreateFlags{},
+    dslUniformBuffers_ = ctx.getOrCreateDescriptorSetLayout(
+        VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
         static_cast<uint32_t>(bindings.size()),
         bindings.data(),
-        bindingFlags.data(),
         IGL_FORMAT("Descriptor Set Layout (UNIFORM_BUFFER): {}", debugName).c_str());
   }
   // 2. Storage buffers
@@ -119,14 +124,10 @@ PipelineState::PipelineState(const VulkanContext& ctx,
       bindings.emplace_back(ivkGetDescriptorSetLayoutBinding(
           b.bindingLocation, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1));
     }
-    std::vector<VkDescriptorBindingFlags> bindingFlags(bindings.size());
-    dslStorageBuffers_ = std::make_unique<VulkanDescriptorSetLayout>(
-        ctx.vf_,
-        ctx.getVkDevice(),
-        VkDescriptorSetLayoutCreateFlags{},
+    dslStorageBuffers_ = ctx.getOrCreateDescriptorSetLayout(
+        VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
         static_cast<uint32_t>(bindings.size()),
         bindings.data(),
-        bindingFlags.data(),
         IGL_FORMAT("Descriptor Set Layout (STORAGE_BUFFER): {}", debugName).c_str());
   }
 }
@@ -45,9 +45,11 @@ class PipelineState {
   // the last seen VkDescriptorSetLayout from VulkanContext::dslBindless_
   mutable VkDescriptorSetLayout lastBindlessVkDescriptorSetLayout_ = VK_NULL_HANDLE;
 
-  std::unique_ptr<VulkanDescriptorSetLayout> dslCombinedImageSamplers_;
-  std::unique_ptr<VulkanDescriptorSetLayout> dslUniformBuffers_;
-  std::unique_ptr<VulkanDescriptorSetLayout> dslStorageBuffers_;
+  // deduplicated through VulkanContext::getOrCreateDescriptorSetLayout(): pipelines whose shaders
+  // reflect the same bindings share layout handles, which keeps their pipeline layouts compatible
+  std::shared_ptr<VulkanDescriptorSetLayout> dslCombinedImageSamplers_;
+  std::shared_ptr<VulkanDescriptorSetLayout> dslUniformBuffers_;
+  std::shared_ptr<VulkanDescriptorSetLayout> dslStorageBuffers_;
 };
 
 } // namespace igl::vulkan
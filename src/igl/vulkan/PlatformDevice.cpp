@@ -10,7 +10,10 @@
 #include <igl/vulkan/PlatformDevice.h>
 #include <igl/vulkan/Texture.h>
 #include <igl/vulkan/VulkanContext.h>
+#include <igl/vulkan/VulkanImage.h>
+#include <igl/vulkan/VulkanImageView.h>
 #include <igl/vulkan/VulkanSwapchain.h>
+#include <igl/vulkan/VulkanTexture.h>
 
 namespace igl {
 namespace vulkan {
@@ -120,6 +123,131 @@ std::shared_ptr<ITexture> PlatformDevice::createTextureFromNativeDrawable(Result
   return nativeDrawableTextures_[currentImageIndex];
 }
 
+Result PlatformDevice::getTextureExportInfo(const ITexture& texture,
+                                            TextureExportInfo& outInfo) const {
+  const auto& vkTexture = static_cast<const Texture&>(texture);
+  const VulkanImage& image = vkTexture.getVulkanTexture().getVulkanImage();
+  if (!image.isExported_) {
+    return Result(Result::Code::InvalidOperation,
+                  "The texture was not created with TextureUsageBits::Shareable");
+  }
+  outInfo.fileDescriptor = image.exportedFd_;
+  outInfo.windowsHandle = image.exportedMemoryHandle_;
+  outInfo.memoryAllocationSize = image.allocatedSize;
+  return Result();
+}
+
+std::shared_ptr<ITexture> PlatformDevice::createTextureFromExportedMemory(
+    int fileDescriptor,
+    uint64_t memoryAllocationSize,
+    const TextureDesc& desc,
+    Result* outResult) {
+#if IGL_PLATFORM_LINUX || IGL_PLATFORM_ANDROID
+  IGL_PROFILER_FUNCTION();
+
+  const auto& ctx = device_.getVulkanContext();
+
+  const auto properties = TextureFormatProperties::fromTextureFormat(desc.format);
+  if (!IGL_VERIFY(!properties.isDepthOrStencil())) {
+    Result::setResult(
+        outResult, Result::Code::Unsupported, "Only color textures can be imported");
+    return nullptr;
+  }
+  const VkFormat vkFormat = textureFormatToVkFormat(desc.format);
+
+  // the image parameters must match the exported image; Shareable textures are always created
+  // with optimal tiling, transfer usage in both directions, and the usage bits mapped below (see
+  // Texture::create())
+  VkImageUsageFlags usageFlags = VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+  if (desc.usage & TextureDesc::TextureUsageBits::Sampled) {
+    usageFlags |= VK_IMAGE_USAGE_SAMPLED_BIT;
+  }
+  if (desc.usage & TextureDesc::TextureUsageBits::Storage) {
+    usageFlags |= VK_IMAGE_USAGE_STORAGE_BIT;
+  }
+  if (desc.usage & TextureDesc::TextureUsageBits::Attachment) {
+    usageFlags |= VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_INPUT_ATTACHMENT_BIT;
+  }
+
+  VkImageCreateFlags createFlags = 0;
+  uint32_t arrayLayerCount = static_cast<uint32_t>(desc.numLayers);
+  VkImageViewType imageViewType = VK_IMAGE_VIEW_TYPE_2D;
+  VkImageType imageType = VK_IMAGE_TYPE_2D;
+  VkSampleCountFlagBits samples = VK_SAMPLE_COUNT_1_BIT;
+  switch (desc.type) {
+  case TextureType::TwoD:
+    samples = getVulkanSampleCountFlags(desc.numSamples);
+    break;
+  case TextureType::TwoDArray:
+    imageViewType = VK_IMAGE_VIEW_TYPE_2D_ARRAY;
+    samples = getVulkanSampleCountFlags(desc.numSamples);
+    break;
+  case TextureType::Cube:
+    imageViewType = VK_IMAGE_VIEW_TYPE_CUBE;
+    arrayLayerCount *= 6;
+    createFlags = VK_IMAGE_CREATE_CUBE_COMPATIBLE_BIT;
+    break;
+  case TextureType::ThreeD:
+    imageViewType = VK_IMAGE_VIEW_TYPE_3D;
+    imageType = VK_IMAGE_TYPE_3D;
+    break;
+  default:
+    Result::setResult(
+        outResult, Result::Code::Unimplemented, "Unsupported texture type for import");
+    return nullptr;
+  }
+
+  Result result;
+  auto image = ctx.createImageFromFileDescriptor(
+      fileDescriptor,
+      memoryAllocationSize,
+      imageType,
+      VkExtent3D{(uint32_t)desc.width, (uint32_t)desc.height, (uint32_t)desc.depth},
+      vkFormat,
+      (uint32_t)desc.numMipLevels,
+      arrayLayerCount,
+      VK_IMAGE_TILING_OPTIMAL,
+      usageFlags,
+      createFlags,
+      samples,
+      &result,
+      "Image: imported memory");
+  if (!result.isOk() || !IGL_VERIFY(image)) {
+    Result::setResult(outResult, std::move(result));
+    return nullptr;
+  }
+
+  std::unique_ptr<VulkanImageView> imageView =
+      image->createImageView(imageViewType,
+                             vkFormat,
+                             VK_IMAGE_ASPECT_COLOR_BIT,
+                             0,
+                             VK_REMAINING_MIP_LEVELS,
+                             0,
+                             arrayLayerCount,
+                             "Image View: imported memory");
+  if (!IGL_VERIFY(imageView)) {
+    Result::setResult(
+        outResult, Result::Code::InvalidOperation, "Cannot create VulkanImageView");
+    return nullptr;
+  }
+
+  std::shared_ptr<VulkanTexture> vkTexture =
+      ctx.createTexture(std::move(image), std::move(imageView), desc.debugName.c_str());
+
+  Result::setOk(outResult);
+  return std::make_shared<Texture>(device_, std::move(vkTexture), desc);
+#else
+  (void)fileDescriptor;
+  (void)memoryAllocationSize;
+  (void)desc;
+  Result::setResult(outResult,
+                    Result::Code::Unsupported,
+                    "Importing exported texture memory is not supported on this platform");
+  return nullptr;
+#endif // IGL_PLATFORM_LINUX || IGL_PLATFORM_ANDROID
+}
+
 VkFence PlatformDevice::getVkFenceFromSubmitHandle(SubmitHandle handle) const {
   if (handle == 0) {
     IGL_LOG_ERROR("Invalid submit handle passed to getVkFenceFromSubmitHandle");
@@ -41,6 +41,31 @@ class PlatformDevice : public IPlatformDevice {
   /// @return pointer to generated Texture or nullptr
   std::shared_ptr<ITexture> createTextureFromNativeDrawable(Result* outResult);
 
+  /// Describes the external memory object backing a texture created with
+  /// TextureDesc::TextureUsageBits::Shareable. On Windows the memory is identified by an opaque
+  /// handle, elsewhere by a POSIX file descriptor. The descriptor stays owned by the exporting
+  /// texture; importers dup() it, so the same texture can be imported any number of times
+  struct TextureExportInfo {
+    int fileDescriptor = -1;
+    void* windowsHandle = nullptr;
+    uint64_t memoryAllocationSize = 0;
+  };
+
+  /// Returns the export info of a Shareable texture created on this device; fails with
+  /// InvalidOperation when the texture was not created with TextureUsageBits::Shareable
+  Result getTextureExportInfo(const ITexture& texture, TextureExportInfo& outInfo) const;
+
+  /// Creates a texture on this device whose memory is imported from a Shareable texture exported
+  /// by another device (see getTextureExportInfo()), so both devices read one allocation instead
+  /// of keeping redundant copies. `desc` must describe the exported texture exactly. Not
+  /// supported on Windows yet - the import path there requires a Vulkan-created KMT handle
+  /// @param outResult optional result
+  /// @return pointer to generated Texture or nullptr
+  std::shared_ptr<ITexture> createTextureFromExportedMemory(int fileDescriptor,
+                                                            uint64_t memoryAllocationSize,
+                                                            const TextureDesc& desc,
+                                                            Result* outResult);
+
   /// @param handle The handle to the GPU Fence
   /// @return The Vulkan fence associated with the handle
   [[nodiscard]] VkFence getVkFenceFromSubmitHandle(SubmitHandle handle) const;
@@ -9,7 +9,9 @@
 
 #include <algorithm>
 
+#include <igl/IGLSafeC.h>
 #include <igl/RenderPass.h>
+#include <igl/TextureSampleFeedback.h>
 #include <igl/vulkan/Buffer.h>
 #include <igl/vulkan/CommandBuffer.h>
 #include <igl/vulkan/Common.h>
@@ -20,16 +22,31 @@
 #include <igl/vulkan/Texture.h>
 #include <igl/vulkan/VertexInputState.h>
 #include <igl/vulkan/VulkanBuffer.h>
+#include <igl/vulkan/VulkanCommandPool.h>
 #include <igl/vulkan/VulkanContext.h>
 #include <igl/vulkan/VulkanDevice.h>
 #include <igl/vulkan/VulkanPipelineLayout.h>
+#include <igl/vulkan/VulkanProgrammableResolve.h>
 #include <igl/vulkan/VulkanRenderPassBuilder.h>
 #include <igl/vulkan/VulkanShaderModule.h>
 #include <igl/vulkan/VulkanSwapchain.h>
+#include <igl/vulkan/VulkanUniformRingBuffer.h>
 #include <igl/vulkan/util/SpvReflection.h>
 
 namespace {
 
+// RenderPassDesc::renderArea clamped to the pass dimensions, for partial (damage-region) passes
+igl::ScissorRect clampedRenderArea(const igl::RenderPassDesc& renderPass,
+                                   uint32_t width,
+                                   uint32_t height) {
+  const uint32_t x = std::min(renderPass.renderArea.x, width);
+  const uint32_t y = std::min(renderPass.renderArea.y, height);
+  return {x,
+          y,
+          std::min(renderPass.renderArea.width, width - x),
+          std::min(renderPass.renderArea.height, height - y)};
+}
+
 VkAttachmentLoadOp loadActionToVkAttachmentLoadOp(igl::LoadAction a) {
   using igl::LoadAction;
   switch (a) {
@@ -59,29 +76,6 @@ VkAttachmentStoreOp storeActionToVkAttachmentStoreOp(igl::StoreAction a) {
   return VK_ATTACHMENT_STORE_OP_DONT_CARE;
 }
 
-VkStencilOp stencilOperationToVkStencilOp(igl::StencilOperation op) {
-  switch (op) {
-  case igl::StencilOperation::Keep:
-    return VK_STENCIL_OP_KEEP;
-  case igl::StencilOperation::Zero:
-    return VK_STENCIL_OP_ZERO;
-  case igl::StencilOperation::Replace:
-    return VK_STENCIL_OP_REPLACE;
-  case igl::StencilOperation::IncrementClamp:
-    return VK_STENCIL_OP_INCREMENT_AND_CLAMP;
-  case igl::StencilOperation::DecrementClamp:
-    return VK_STENCIL_OP_DECREMENT_AND_CLAMP;
-  case igl::StencilOperation::Invert:
-    return VK_STENCIL_OP_INVERT;
-  case igl::StencilOperation::IncrementWrap:
-    return VK_STENCIL_OP_INCREMENT_AND_WRAP;
-  case igl::StencilOperation::DecrementWrap:
-    return VK_STENCIL_OP_DECREMENT_AND_WRAP;
-  }
-  IGL_ASSERT(false);
-  return VK_STENCIL_OP_KEEP;
-}
-
 VkIndexType indexFormatToVkIndexType(igl::IndexFormat fmt) {
   switch (fmt) {
   case igl::IndexFormat::UInt16:
@@ -126,33 +120,59 @@ RenderCommandEncoder::RenderCommandEncoder(const std::shared_ptr<CommandBuffer>&
   IGL_ASSERT(cmdBuffer_ != VK_NULL_HANDLE);
 }
 
-void RenderCommandEncoder::initialize(const RenderPassDesc& renderPass,
-                                      const std::shared_ptr<IFramebuffer>& framebuffer,
-                                      const Dependencies& dependencies,
-                                      Result* outResult) {
+RenderCommandEncoder::RenderCommandEncoder(const std::shared_ptr<CommandBuffer>& commandBuffer,
+                                           VulkanContext& ctx,
+                                           std::unique_ptr<VulkanCommandPool> secondaryPool,
+                                           VkCommandBuffer secondaryCmdBuffer) :
+  IRenderCommandEncoder::IRenderCommandEncoder(commandBuffer),
+  ctx_(ctx),
+  cmdBuffer_(secondaryCmdBuffer),
+  isSecondary_(true),
+  secondaryPool_(std::move(secondaryPool)),
+  binder_(secondaryCmdBuffer, ctx, VK_PIPELINE_BIND_POINT_GRAPHICS) {
   IGL_PROFILER_FUNCTION();
+  IGL_ASSERT(secondaryPool_);
+  IGL_ASSERT(cmdBuffer_ != VK_NULL_HANDLE);
+}
 
-  framebuffer_ = framebuffer;
-  dependencies_ = dependencies;
+RenderCommandEncoder::~RenderCommandEncoder() {
+  IGL_ASSERT(!isEncoding_); // did you forget to call endEncoding()?
+  endEncoding();
+
+  if (secondaryPool_) {
+    // the GPU may still be executing the secondary command buffer - release the pool (and with it
+    // the command buffer) only when the associated work is done
+    ctx_.deferredTask(std::packaged_task<void()>([pool = std::move(secondaryPool_)]() {}));
+  }
+}
+
+bool RenderCommandEncoder::buildRenderPass(const RenderPassDesc& renderPass,
+                                           const std::shared_ptr<IFramebuffer>& framebuffer,
+                                           VulkanRenderPassBuilder& outBuilder,
+                                           std::vector<VkClearValue>& outClearValues,
+                                           uint32_t& outMipLevel,
+                                           uint32_t& outLayer,
+                                           Result* outResult) {
+  IGL_PROFILER_FUNCTION();
 
   Result::setOk(outResult);
 
   if (!IGL_VERIFY(framebuffer)) {
     Result::setResult(outResult, Result::Code::ArgumentNull);
-    return;
+    return false;
   }
 
   const FramebufferDesc& desc = static_cast<const Framebuffer&>((*framebuffer)).getDesc();
 
-  std::vector<VkClearValue> clearValues;
-  uint32_t mipLevel = 0;
-  uint32_t layer = 0;
-
-  VulkanRenderPassBuilder builder;
+  std::vector<VkClearValue>& clearValues = outClearValues;
+  uint32_t& mipLevel = outMipLevel;
+  uint32_t& layer = outLayer;
+  VulkanRenderPassBuilder& builder = outBuilder;
 
   if (desc.mode != FramebufferMode::Mono) {
     if (desc.mode == FramebufferMode::Stereo) {
-      builder.setMultiviewMasks(0x00000003, 0x00000003);
+      const uint32_t viewMask = renderPass.viewMask ? renderPass.viewMask : 0x00000003u;
+      builder.setMultiviewMasks(viewMask, viewMask);
     } else {
       IGL_ASSERT_MSG(0, "FramebufferMode::Multiview is not implemented.");
     }
@@ -174,7 +194,7 @@ void RenderCommandEncoder::initialize(const RenderPassDesc& renderPass,
           outResult,
           Result::Code::ArgumentInvalid,
           "Framebuffer color attachment count larger than renderPass color attachment count");
-      return;
+      return false;
     }
 
     const auto& descColor = renderPass.colorAttachments[i];
@@ -214,6 +234,14 @@ void RenderCommandEncoder::initialize(const RenderPassDesc& renderPass,
                                                   descColor.clearColor.g,
                                                   descColor.clearColor.b,
                                                   descColor.clearColor.a));
+      if (renderPass.colorResolveShaderStages) {
+        // custom resolve: a second subpass reads the multisampled color as a subpass input and
+        // runs the app's resolve shader instead of the fixed-function resolve
+        builder.enableProgrammableResolve();
+        resolveShaderStages_ = renderPass.colorResolveShaderStages;
+        resolveMsaaColorView_ =
+            colorTexture.getVkImageViewForFramebuffer(mipLevel, layer, desc.mode);
+      }
     }
   }
 
@@ -244,6 +272,37 @@ void RenderCommandEncoder::initialize(const RenderPassDesc& renderPass,
                             depthTexture.getVulkanTexture().getVulkanImage().samples_);
   }
 
+  return true;
+}
+
+void RenderCommandEncoder::initialize(const RenderPassDesc& renderPass,
+                                      const std::shared_ptr<IFramebuffer>& framebuffer,
+                                      const Dependencies& dependencies,
+                                      VkSubpassContents subpassContents,
+                                      Result* outResult) {
+  IGL_PROFILER_FUNCTION();
+
+  framebuffer_ = framebuffer;
+  dependencies_ = dependencies;
+  renderPassDesc_ = renderPass;
+  // only inline passes can stay open for merging - parallel primaries stitch in secondary
+  // command buffers and must end their pass themselves
+  mergeCandidate_ = subpassContents == VK_SUBPASS_CONTENTS_INLINE && isMergeCandidate(renderPass);
+
+  if (ctx_.useDynamicRendering_) {
+    beginRendering(renderPass, framebuffer, subpassContents, outResult);
+    return;
+  }
+
+  VulkanRenderPassBuilder builder;
+  std::vector<VkClearValue> clearValues;
+  uint32_t mipLevel = 0;
+  uint32_t layer = 0;
+
+  if (!buildRenderPass(renderPass, framebuffer, builder, clearValues, mipLevel, layer, outResult)) {
+    return;
+  }
+
   const auto& fb = static_cast<vulkan::Framebuffer&>(*framebuffer);
 
   auto renderPassHandle = ctx_.findRenderPass(builder);
@@ -251,20 +310,369 @@ void RenderCommandEncoder::initialize(const RenderPassDesc& renderPass,
   dynamicState_.renderPassIndex_ = renderPassHandle.index;
   dynamicState_.depthBiasEnable_ = false;
 
-  const VkRenderPassBeginInfo bi = fb.getRenderPassBeginInfo(
+  VkRenderPassBeginInfo bi = fb.getRenderPassBeginInfo(
       renderPassHandle.pass, mipLevel, layer, (uint32_t)clearValues.size(), clearValues.data());
 
   const uint32_t width = std::max(fb.getWidth() >> mipLevel, 1u);
   const uint32_t height = std::max(fb.getHeight() >> mipLevel, 1u);
-  const igl::Viewport viewport = {0.0f, 0.0f, (float)width, (float)height, 0.0f, +1.0f};
-  const igl::ScissorRect scissor = {0, 0, width, height};
+  // dynamic resolution: the render area stays at full size (clears cover the whole attachment)
+  // while the default viewport/scissor confine rendering to the scaled sub-rect
+  const uint32_t scaledWidth = RenderPassDesc::scaledDimension(width, renderPass.renderScale);
+  const uint32_t scaledHeight = RenderPassDesc::scaledDimension(height, renderPass.renderScale);
+  igl::Viewport viewport = {0.0f, 0.0f, (float)scaledWidth, (float)scaledHeight, 0.0f, +1.0f};
+  igl::ScissorRect scissor = {0, 0, scaledWidth, scaledHeight};
+
+  if (renderPass.hasRenderArea()) {
+    // partial pass: load/store/clear ops only touch the render area, so content outside the
+    // damaged region is preserved. The viewport stays at full size - the render area is a
+    // damage rect, not a rescaled target
+    scissor = clampedRenderArea(renderPass, width, height);
+    viewport = {0.0f, 0.0f, (float)width, (float)height, 0.0f, +1.0f};
+    bi.renderArea = VkRect2D{VkOffset2D{(int32_t)scissor.x, (int32_t)scissor.y},
+                             VkExtent2D{scissor.width, scissor.height}};
+  }
+
+  if (resolveShaderStages_) {
+    resolveRenderPass_ = renderPassHandle.pass;
+    resolveExtent_ = VkExtent2D{width, height};
+  }
 
   bindViewport(viewport);
   bindScissorRect(scissor);
 
   ctx_.checkAndUpdateDescriptorSets();
 
-  ctx_.vf_.vkCmdBeginRenderPass(cmdBuffer_, &bi, VK_SUBPASS_CONTENTS_INLINE);
+  ctx_.vf_.vkCmdBeginRenderPass(cmdBuffer_, &bi, subpassContents);
+
+  isEncoding_ = true;
+
+  Result::setOk(outResult);
+}
+
+void RenderCommandEncoder::initializeSecondary(const RenderPassDesc& renderPass,
+                                               const std::shared_ptr<IFramebuffer>& framebuffer,
+                                               Result* outResult) {
+  IGL_PROFILER_FUNCTION();
+
+  framebuffer_ = framebuffer;
+
+  if (ctx_.useDynamicRendering_) {
+    beginSecondaryRendering(renderPass, framebuffer, outResult);
+    return;
+  }
+
+  // rebuild the same render pass description as the primary encoder; findRenderPass() returns the
+  // cached handle, which guarantees the inheritance info below is render pass compatible
+  VulkanRenderPassBuilder builder;
+  std::vector<VkClearValue> clearValues;
+  uint32_t mipLevel = 0;
+  uint32_t layer = 0;
+
+  if (!buildRenderPass(renderPass, framebuffer, builder, clearValues, mipLevel, layer, outResult)) {
+    return;
+  }
+
+  const auto& fb = static_cast<vulkan::Framebuffer&>(*framebuffer);
+
+  auto renderPassHandle = ctx_.findRenderPass(builder);
+
+  dynamicState_.renderPassIndex_ = renderPassHandle.index;
+  dynamicState_.depthBiasEnable_ = false;
+
+  // the framebuffer is optional in the inheritance info, but providing it lets drivers generate
+  // better code; clear values are owned by the primary encoder's vkCmdBeginRenderPass()
+  const VkRenderPassBeginInfo bi =
+      fb.getRenderPassBeginInfo(renderPassHandle.pass, mipLevel, layer, 0, nullptr);
+
+  const VkCommandBufferInheritanceInfo inheritance = {
+      VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO,
+      nullptr,
+      renderPassHandle.pass,
+      0,
+      bi.framebuffer,
+      VK_FALSE,
+      0,
+      0,
+  };
+  const VkCommandBufferBeginInfo cbi = {
+      VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+      nullptr,
+      VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT |
+          VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT,
+      &inheritance,
+  };
+  VK_ASSERT(ctx_.vf_.vkBeginCommandBuffer(cmdBuffer_, &cbi));
+
+  // same defaults as the primary encoder path, including the render-scale sub-rect or the
+  // explicit render area
+  const uint32_t fullWidth = std::max(fb.getWidth() >> mipLevel, 1u);
+  const uint32_t fullHeight = std::max(fb.getHeight() >> mipLevel, 1u);
+  if (renderPass.hasRenderArea()) {
+    bindViewport({0.0f, 0.0f, (float)fullWidth, (float)fullHeight, 0.0f, +1.0f});
+    bindScissorRect(clampedRenderArea(renderPass, fullWidth, fullHeight));
+  } else {
+    const uint32_t width = RenderPassDesc::scaledDimension(fullWidth, renderPass.renderScale);
+    const uint32_t height = RenderPassDesc::scaledDimension(fullHeight, renderPass.renderScale);
+    bindViewport({0.0f, 0.0f, (float)width, (float)height, 0.0f, +1.0f});
+    bindScissorRect({0, 0, width, height});
+  }
+
+  isEncoding_ = true;
+
+  Result::setOk(outResult);
+}
+
+void RenderCommandEncoder::beginRendering(const RenderPassDesc& renderPass,
+                                          const std::shared_ptr<IFramebuffer>& framebuffer,
+                                          VkSubpassContents subpassContents,
+                                          Result* outResult) {
+  IGL_PROFILER_FUNCTION();
+
+  const FramebufferDesc& desc = static_cast<const Framebuffer&>(*framebuffer).getDesc();
+
+  IGL_ASSERT_MSG(desc.mode != FramebufferMode::Multiview,
+                 "FramebufferMode::Multiview is not implemented.");
+
+  if (renderPass.colorResolveShaderStages) {
+    // dynamic rendering has no subpasses, so the programmable resolve cannot run in tile memory
+    IGL_LOG_ERROR_ONCE(
+        "colorResolveShaderStages requires render pass objects and is ignored with "
+        "VK_KHR_dynamic_rendering; the built-in resolve is used instead\n");
+  }
+
+  uint32_t mipLevel = 0;
+  uint32_t layer = 0;
+
+  std::vector<VkRenderingAttachmentInfoKHR> colorAttachments;
+  colorAttachments.reserve(IGL_COLOR_ATTACHMENTS_MAX);
+
+  for (size_t i = 0; i != IGL_COLOR_ATTACHMENTS_MAX; i++) {
+    const auto& attachment = desc.colorAttachments[i];
+    if (!attachment.texture) {
+      continue;
+    }
+
+    const auto& colorTexture = static_cast<vulkan::Texture&>(*attachment.texture);
+
+    if (i >= renderPass.colorAttachments.size()) {
+      IGL_ASSERT(false);
+      Result::setResult(
+          outResult,
+          Result::Code::ArgumentInvalid,
+          "Framebuffer color attachment count larger than renderPass color attachment count");
+      return;
+    }
+
+    const auto& descColor = renderPass.colorAttachments[i];
+    mipLevel = descColor.mipLevel;
+    layer = getVkLayer(colorTexture.getType(), descColor.face, descColor.layer);
+
+    // the attachments were transitioned to VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL before this
+    // encoder was created (see CommandBuffer::transitionForRenderPass())
+    VkRenderingAttachmentInfoKHR attachmentInfo = {
+        VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO_KHR,
+        nullptr,
+        colorTexture.getVkImageViewForFramebuffer(mipLevel, layer, desc.mode),
+        VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+        VK_RESOLVE_MODE_NONE,
+        VK_NULL_HANDLE,
+        VK_IMAGE_LAYOUT_UNDEFINED,
+        loadActionToVkAttachmentLoadOp(descColor.loadAction),
+        storeActionToVkAttachmentStoreOp(descColor.storeAction),
+        ivkGetClearColorValue(descColor.clearColor.r,
+                              descColor.clearColor.g,
+                              descColor.clearColor.b,
+                              descColor.clearColor.a),
+    };
+    // handle MSAA
+    if (descColor.storeAction == StoreAction::MsaaResolve) {
+      IGL_ASSERT_MSG(attachment.resolveTexture,
+                     "Framebuffer attachment should contain a resolve texture");
+      const auto& colorResolveTexture = static_cast<vulkan::Texture&>(*attachment.resolveTexture);
+      attachmentInfo.resolveMode = VK_RESOLVE_MODE_AVERAGE_BIT;
+      attachmentInfo.resolveImageView =
+          colorResolveTexture.getVkImageViewForFramebuffer(mipLevel, layer, desc.mode);
+      attachmentInfo.resolveImageLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+    }
+    colorAttachments.push_back(attachmentInfo);
+  }
+
+  VkRenderingAttachmentInfoKHR depthAttachment = {};
+  VkRenderingAttachmentInfoKHR stencilAttachment = {};
+  bool hasStencilAttachment = false;
+  hasDepthAttachment_ = false;
+
+  if (framebuffer->getDepthAttachment()) {
+    const auto& depthTexture = static_cast<vulkan::Texture&>(*(framebuffer->getDepthAttachment()));
+    hasDepthAttachment_ = true;
+    const RenderPassDesc::DepthAttachmentDesc descDepth = renderPass.depthAttachment;
+    const RenderPassDesc::StencilAttachmentDesc descStencil = renderPass.stencilAttachment;
+    depthAttachment = {
+        VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO_KHR,
+        nullptr,
+        depthTexture.getVkImageViewForFramebuffer(mipLevel, layer, desc.mode),
+        VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL,
+        VK_RESOLVE_MODE_NONE,
+        VK_NULL_HANDLE,
+        VK_IMAGE_LAYOUT_UNDEFINED,
+        loadActionToVkAttachmentLoadOp(descDepth.loadAction),
+        storeActionToVkAttachmentStoreOp(descDepth.storeAction),
+        ivkGetClearDepthStencilValue(descDepth.clearDepth, descStencil.clearStencil),
+    };
+    // a combined depth/stencil image must be referenced by both attachments
+    hasStencilAttachment = (depthTexture.getVulkanTexture().getVulkanImage().getImageAspectFlags() &
+                            VK_IMAGE_ASPECT_STENCIL_BIT) != 0;
+    if (hasStencilAttachment) {
+      stencilAttachment = depthAttachment;
+      stencilAttachment.loadOp = loadActionToVkAttachmentLoadOp(descStencil.loadAction);
+      stencilAttachment.storeOp = storeActionToVkAttachmentStoreOp(descStencil.storeAction);
+    }
+  }
+
+  const auto& fb = static_cast<vulkan::Framebuffer&>(*framebuffer);
+  const bool isStereo = desc.mode == FramebufferMode::Stereo;
+
+  // pipelines key their view mask off renderPassIndex_, which only distinguishes mono/stereo -
+  // custom RenderPassDesc::viewMask values are honored on the render pass object path only
+  IGL_ASSERT_MSG(renderPass.viewMask == 0 || renderPass.viewMask == 0x3u,
+                 "Dynamic rendering supports only the default stereo view mask (0x3)");
+
+  // there are no render pass objects: the render pass index field keys the view mask instead so
+  // that stereo and mono passes get distinct pipelines (see RenderPipelineState)
+  dynamicState_.renderPassIndex_ = isStereo ? 1 : 0;
+  dynamicState_.depthBiasEnable_ = false;
+
+  const uint32_t width = std::max(fb.getWidth() >> mipLevel, 1u);
+  const uint32_t height = std::max(fb.getHeight() >> mipLevel, 1u);
+
+  // an explicit render area restricts the pass to the damaged region (content outside it is
+  // preserved); otherwise the pass covers the whole attachment
+  const igl::ScissorRect area = renderPass.hasRenderArea()
+                                    ? clampedRenderArea(renderPass, width, height)
+                                    : igl::ScissorRect{0, 0, width, height};
+
+  const VkRenderingInfoKHR renderingInfo = {
+      VK_STRUCTURE_TYPE_RENDERING_INFO_KHR,
+      nullptr,
+      subpassContents == VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS
+          ? (VkRenderingFlagsKHR)VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT_KHR
+          : (VkRenderingFlagsKHR)0,
+      VkRect2D{VkOffset2D{(int32_t)area.x, (int32_t)area.y}, VkExtent2D{area.width, area.height}},
+      1u,
+      isStereo ? 0x3u : 0u,
+      (uint32_t)colorAttachments.size(),
+      colorAttachments.data(),
+      hasDepthAttachment_ ? &depthAttachment : nullptr,
+      hasStencilAttachment ? &stencilAttachment : nullptr,
+  };
+
+  if (renderPass.hasRenderArea()) {
+    // the viewport stays at full size - the render area is a damage rect, not a rescaled target
+    bindViewport({0.0f, 0.0f, (float)width, (float)height, 0.0f, +1.0f});
+    bindScissorRect(area);
+  } else {
+    // dynamic resolution: the render area above stays at full size (clears cover the whole
+    // attachment) while the default viewport/scissor confine rendering to the scaled sub-rect
+    const uint32_t scaledWidth = RenderPassDesc::scaledDimension(width, renderPass.renderScale);
+    const uint32_t scaledHeight = RenderPassDesc::scaledDimension(height, renderPass.renderScale);
+    bindViewport({0.0f, 0.0f, (float)scaledWidth, (float)scaledHeight, 0.0f, +1.0f});
+    bindScissorRect({0, 0, scaledWidth, scaledHeight});
+  }
+
+  ctx_.checkAndUpdateDescriptorSets();
+
+  ctx_.vf_.vkCmdBeginRenderingKHR(cmdBuffer_, &renderingInfo);
+
+  isEncoding_ = true;
+
+  Result::setOk(outResult);
+}
+
+void RenderCommandEncoder::beginSecondaryRendering(
+    const RenderPassDesc& renderPass,
+    const std::shared_ptr<IFramebuffer>& framebuffer,
+    Result* outResult) {
+  IGL_PROFILER_FUNCTION();
+
+  const FramebufferDesc& desc = static_cast<const Framebuffer&>(*framebuffer).getDesc();
+
+  uint32_t mipLevel = 0;
+  VkSampleCountFlagBits samples = VK_SAMPLE_COUNT_1_BIT;
+
+  std::vector<VkFormat> colorAttachmentFormats;
+  colorAttachmentFormats.reserve(IGL_COLOR_ATTACHMENTS_MAX);
+
+  for (size_t i = 0; i != IGL_COLOR_ATTACHMENTS_MAX; i++) {
+    const auto& attachment = desc.colorAttachments[i];
+    if (!attachment.texture || !IGL_VERIFY(i < renderPass.colorAttachments.size())) {
+      continue;
+    }
+    const auto& colorTexture = static_cast<vulkan::Texture&>(*attachment.texture);
+    colorAttachmentFormats.push_back(textureFormatToVkFormat(colorTexture.getFormat()));
+    mipLevel = renderPass.colorAttachments[i].mipLevel;
+    samples = colorTexture.getVulkanTexture().getVulkanImage().samples_;
+  }
+
+  VkFormat depthAttachmentFormat = VK_FORMAT_UNDEFINED;
+  VkFormat stencilAttachmentFormat = VK_FORMAT_UNDEFINED;
+  hasDepthAttachment_ = false;
+
+  if (framebuffer->getDepthAttachment()) {
+    const auto& depthTexture = static_cast<vulkan::Texture&>(*(framebuffer->getDepthAttachment()));
+    hasDepthAttachment_ = true;
+    depthAttachmentFormat = depthTexture.getVkFormat();
+    if (depthTexture.getVulkanTexture().getVulkanImage().getImageAspectFlags() &
+        VK_IMAGE_ASPECT_STENCIL_BIT) {
+      stencilAttachmentFormat = depthAttachmentFormat;
+    }
+    samples = depthTexture.getVulkanTexture().getVulkanImage().samples_;
+  }
+
+  const bool isStereo = desc.mode == FramebufferMode::Stereo;
+
+  dynamicState_.renderPassIndex_ = isStereo ? 1 : 0;
+  dynamicState_.depthBiasEnable_ = false;
+
+  // dynamic rendering secondaries inherit attachment formats instead of a render pass handle;
+  // these must match the VkRenderingInfoKHR of the primary encoder
+  const VkCommandBufferInheritanceRenderingInfoKHR inheritanceRendering = {
+      VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDERING_INFO_KHR,
+      nullptr,
+      0,
+      isStereo ? 0x3u : 0u,
+      (uint32_t)colorAttachmentFormats.size(),
+      colorAttachmentFormats.data(),
+      depthAttachmentFormat,
+      stencilAttachmentFormat,
+      samples,
+  };
+  const VkCommandBufferInheritanceInfo inheritance = {
+      VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO,
+      &inheritanceRendering,
+      VK_NULL_HANDLE,
+      0,
+      VK_NULL_HANDLE,
+      VK_FALSE,
+      0,
+      0,
+  };
+  const VkCommandBufferBeginInfo cbi = {
+      VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+      nullptr,
+      VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT |
+          VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT,
+      &inheritance,
+  };
+  VK_ASSERT(ctx_.vf_.vkBeginCommandBuffer(cmdBuffer_, &cbi));
+
+  // same defaults as the primary encoder path, including the render-scale sub-rect
+  const auto& fb = static_cast<vulkan::Framebuffer&>(*framebuffer);
+  const uint32_t width = RenderPassDesc::scaledDimension(std::max(fb.getWidth() >> mipLevel, 1u),
+                                                         renderPass.renderScale);
+  const uint32_t height = RenderPassDesc::scaledDimension(std::max(fb.getHeight() >> mipLevel, 1u),
+                                                          renderPass.renderScale);
+  bindViewport({0.0f, 0.0f, (float)width, (float)height, 0.0f, +1.0f});
+  bindScissorRect({0, 0, width, height});
 
   isEncoding_ = true;
 
@@ -283,7 +691,137 @@ std::unique_ptr<RenderCommandEncoder> RenderCommandEncoder::create(
   Result ret;
 
   std::unique_ptr<RenderCommandEncoder> encoder(new RenderCommandEncoder(commandBuffer, ctx));
-  encoder->initialize(renderPass, framebuffer, dependencies, &ret);
+  encoder->initialize(renderPass, framebuffer, dependencies, VK_SUBPASS_CONTENTS_INLINE, &ret);
+
+  Result::setResult(outResult, ret);
+  return ret.isOk() ? std::move(encoder) : nullptr;
+}
+
+bool RenderCommandEncoder::isMergeCandidate(const RenderPassDesc& renderPass) const {
+  if (!ctx_.config_.enableRenderPassMerging) {
+    return false;
+  }
+  if (renderPass.hasRenderArea() || renderPass.colorResolveShaderStages) {
+    return false;
+  }
+  for (const auto& descColor : renderPass.colorAttachments) {
+    if (descColor.storeAction == StoreAction::MsaaResolve) {
+      return false;
+    }
+  }
+  return renderPass.depthAttachment.storeAction != StoreAction::MsaaResolve &&
+         renderPass.stencilAttachment.storeAction != StoreAction::MsaaResolve;
+}
+
+void RenderCommandEncoder::adoptOpenPass(const RenderPassDesc& renderPass,
+                                         const std::shared_ptr<IFramebuffer>& framebuffer,
+                                         const Dependencies& dependencies,
+                                         uint32_t renderPassIndex,
+                                         Result* outResult) {
+  IGL_PROFILER_FUNCTION();
+
+  framebuffer_ = framebuffer;
+  dependencies_ = dependencies;
+  renderPassDesc_ = renderPass;
+  hasDepthAttachment_ = framebuffer->getDepthAttachment() != nullptr;
+  // the open pass was a merge candidate, so this pass can chain further merges in turn
+  mergeCandidate_ = isMergeCandidate(renderPass);
+
+  // stay pipeline compatible with the pass object (or view mask) the open pass began with
+  dynamicState_.renderPassIndex_ = renderPassIndex;
+  dynamicState_.depthBiasEnable_ = false;
+
+  uint32_t mipLevel = 0;
+  for (const auto i : framebuffer->getColorAttachmentIndices()) {
+    if (IGL_VERIFY(i < renderPassDesc_.colorAttachments.size())) {
+      mipLevel = renderPassDesc_.colorAttachments[i].mipLevel;
+    }
+  }
+
+  // same default viewport/scissor as initialize(); the render pass itself is left untouched
+  const auto& fb = static_cast<vulkan::Framebuffer&>(*framebuffer);
+  const uint32_t width = RenderPassDesc::scaledDimension(std::max(fb.getWidth() >> mipLevel, 1u),
+                                                         renderPass.renderScale);
+  const uint32_t height = RenderPassDesc::scaledDimension(std::max(fb.getHeight() >> mipLevel, 1u),
+                                                          renderPass.renderScale);
+  bindViewport({0.0f, 0.0f, (float)width, (float)height, 0.0f, +1.0f});
+  bindScissorRect({0, 0, width, height});
+
+  ctx_.checkAndUpdateDescriptorSets();
+
+  isEncoding_ = true;
+
+  Result::setOk(outResult);
+}
+
+std::unique_ptr<RenderCommandEncoder> RenderCommandEncoder::createMerged(
+    const std::shared_ptr<CommandBuffer>& commandBuffer,
+    VulkanContext& ctx,
+    const RenderPassDesc& renderPass,
+    const std::shared_ptr<IFramebuffer>& framebuffer,
+    const Dependencies& dependencies,
+    uint32_t renderPassIndex,
+    Result* outResult) {
+  IGL_PROFILER_FUNCTION();
+
+  Result ret;
+
+  std::unique_ptr<RenderCommandEncoder> encoder(new RenderCommandEncoder(commandBuffer, ctx));
+  encoder->adoptOpenPass(renderPass, framebuffer, dependencies, renderPassIndex, &ret);
+
+  Result::setResult(outResult, ret);
+  return ret.isOk() ? std::move(encoder) : nullptr;
+}
+
+std::unique_ptr<RenderCommandEncoder> RenderCommandEncoder::createParallel(
+    const std::shared_ptr<CommandBuffer>& commandBuffer,
+    VulkanContext& ctx,
+    const RenderPassDesc& renderPass,
+    const std::shared_ptr<IFramebuffer>& framebuffer,
+    const Dependencies& dependencies,
+    uint32_t numSecondaryEncoders,
+    std::vector<std::unique_ptr<IRenderCommandEncoder>>& outSecondaryEncoders,
+    Result* outResult) {
+  IGL_PROFILER_FUNCTION();
+
+  IGL_ASSERT(numSecondaryEncoders > 0);
+
+  Result ret;
+
+  std::unique_ptr<RenderCommandEncoder> encoder(new RenderCommandEncoder(commandBuffer, ctx));
+  encoder->initialize(
+      renderPass, framebuffer, dependencies, VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS, &ret);
+
+  if (!ret.isOk()) {
+    Result::setResult(outResult, ret);
+    return nullptr;
+  }
+
+  outSecondaryEncoders.clear();
+  outSecondaryEncoders.reserve(numSecondaryEncoders);
+
+  for (uint32_t i = 0; i != numSecondaryEncoders; i++) {
+    // one VkCommandPool per encoder: command pools are externally synchronized, so each encoder
+    // can be recorded on its own thread
+    auto pool = std::make_unique<VulkanCommandPool>(
+        ctx.vf_,
+        ctx.getVkDevice(),
+        VK_COMMAND_POOL_CREATE_TRANSIENT_BIT,
+        ctx.deviceQueues_.graphicsQueueFamilyIndex,
+        IGL_FORMAT("Command Pool: secondary render encoder #{}", i).c_str());
+    VkCommandBuffer cmdBuf = VK_NULL_HANDLE;
+    VK_ASSERT(ivkAllocateSecondaryCommandBuffer(
+        &ctx.vf_, ctx.getVkDevice(), pool->getVkCommandPool(), &cmdBuf));
+
+    std::unique_ptr<RenderCommandEncoder> secondary(
+        new RenderCommandEncoder(commandBuffer, ctx, std::move(pool), cmdBuf));
+    secondary->initializeSecondary(renderPass, framebuffer, &ret);
+    if (!ret.isOk()) {
+      break;
+    }
+    encoder->secondaryCmdBuffers_.push_back(cmdBuf);
+    outSecondaryEncoders.push_back(std::move(secondary));
+  }
 
   Result::setResult(outResult, ret);
   return ret.isOk() ? std::move(encoder) : nullptr;
@@ -298,57 +836,67 @@ void RenderCommandEncoder::endEncoding() {
 
   isEncoding_ = false;
 
-  ctx_.vf_.vkCmdEndRenderPass(cmdBuffer_);
-
-  for (ITexture* IGL_NULLABLE tex : dependencies_.textures) {
-    // TODO: at some point we might want to know in which layout a dependent texture wants to be. We
-    // can implement that by adding a notion of image layouts to IGL.
-    if (!tex) {
-      continue;
-    }
-
-    // Retrieve the VulkanImage to check its usage
-    const auto& vkTex = static_cast<Texture&>(*tex);
-    const auto& img = vkTex.getVulkanTexture().getVulkanImage();
+  if (isSecondary_) {
+    VK_ASSERT(ctx_.vf_.vkEndCommandBuffer(cmdBuffer_));
+    return;
+  }
 
-    if (tex->getProperties().isDepthOrStencil()) {
-      // If the texture has not been marked as a depth/stencil attachment
-      // (TextureDesc::TextureUsageBits::Attachment), don't transition it to a depth/stencil
-      // attchment
-      if (img.usageFlags_ & VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) {
-        transitionToDepthStencilAttachment(cmdBuffer_, tex);
-      }
-    } else {
-      // If the texture has not been marked as a color attachment
-      // (TextureDesc::TextureUsageBits::Attachment), don't transition it to a color attchment
-      if (img.usageFlags_ & VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT) {
-        transitionToColorAttachment(cmdBuffer_, tex);
-      }
-    }
+  if (!secondaryCmdBuffers_.empty()) {
+    // every secondary encoder must have had endEncoding() called on it by this point
+    ctx_.vf_.vkCmdExecuteCommands(
+        cmdBuffer_, (uint32_t)secondaryCmdBuffers_.size(), secondaryCmdBuffers_.data());
+    secondaryCmdBuffers_.clear();
   }
-  dependencies_ = {};
 
-  // set image layouts after the render pass
-  const FramebufferDesc& desc = static_cast<const Framebuffer&>((*framebuffer_)).getDesc();
+  auto& cmdBuffer = static_cast<CommandBuffer&>(getCommandBuffer());
 
-  for (const auto& attachment : desc.colorAttachments) {
-    // the image layouts of color attachments must match the final layout of the render pass, which
-    // is always VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL (check VulkanRenderPassBuilder.cpp)
-    overrideImageLayout(attachment.texture.get(), VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
-    overrideImageLayout(attachment.resolveTexture.get(), VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
-    transitionToShaderReadOnly(cmdBuffer_, attachment.texture.get());
-    transitionToShaderReadOnly(cmdBuffer_, attachment.resolveTexture.get());
+  if (mergeCandidate_ &&
+      cmdBuffer.deferRenderPassEnd(
+          {framebuffer_, dependencies_, renderPassDesc_, dynamicState_.renderPassIndex_})) {
+    // the pass stays open so a following compatible pass can merge into it; the command buffer
+    // records the end (and the attachment transitions) once it is clear that no merge happens
+    dependencies_ = {};
+    return;
   }
 
-  // this must match the final layout of the render pass, which is always
-  // VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL (check VulkanRenderPassBuilder.cpp)
-  overrideImageLayout(desc.depthAttachment.texture.get(),
-                      VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL);
-  transitionToShaderReadOnly(cmdBuffer_, desc.depthAttachment.texture.get());
+  if (ctx_.useDynamicRendering_) {
+    ctx_.vf_.vkCmdEndRenderingKHR(cmdBuffer_);
+  } else {
+    if (resolveShaderStages_) {
+      // record the programmable resolve subpass: a fullscreen triangle reading the multisampled
+      // color attachment as a subpass input (see RenderPassDesc::colorResolveShaderStages). The
+      // render pass has two subpasses, so vkCmdNextSubpass() must be recorded even when pipeline
+      // or descriptor set creation failed
+      auto& resolve = ctx_.getOrCreateProgrammableResolve();
+      const VkPipeline pipeline = resolve.acquirePipeline(resolveRenderPass_,
+                                                          resolveShaderStages_);
+      const VkDescriptorSet dset = resolve.acquireDescriptorSet(resolveMsaaColorView_);
+      ctx_.vf_.vkCmdNextSubpass(cmdBuffer_, VK_SUBPASS_CONTENTS_INLINE);
+      if (IGL_VERIFY(pipeline != VK_NULL_HANDLE && dset != VK_NULL_HANDLE)) {
+        // the resolve covers the whole attachment regardless of any viewport/scissor bound by
+        // the app's draw calls
+        bindViewport(
+            {0.0f, 0.0f, (float)resolveExtent_.width, (float)resolveExtent_.height, 0.0f, +1.0f});
+        bindScissorRect({0, 0, resolveExtent_.width, resolveExtent_.height});
+        ctx_.vf_.vkCmdBindPipeline(cmdBuffer_, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
+        ctx_.vf_.vkCmdBindDescriptorSets(cmdBuffer_,
+                                         VK_PIPELINE_BIND_POINT_GRAPHICS,
+                                         resolve.getVkPipelineLayout(),
+                                         0,
+                                         1,
+                                         &dset,
+                                         0,
+                                         nullptr);
+        ctx_.vf_.vkCmdDraw(cmdBuffer_, 3, 1, 0, 0);
+      }
+      resolveShaderStages_ = nullptr;
+    }
+    ctx_.vf_.vkCmdEndRenderPass(cmdBuffer_);
+  }
 
-#if defined(IGL_WITH_TRACY_GPU)
-  TracyVkCollect(ctx_.tracyCtx_, cmdBuffer_);
-#endif
+  // transition the dependencies and the attachments out of their render pass layouts
+  cmdBuffer.transitionAfterRenderPass(*framebuffer_, dependencies_);
+  dependencies_ = {};
 }
 
 void RenderCommandEncoder::pushDebugGroupLabel(const char* label, const igl::Color& color) const {
@@ -422,6 +970,8 @@ void RenderCommandEncoder::bindRenderPipelineState(
   }
 
   binder_.bindPipeline(VK_NULL_HANDLE, nullptr);
+
+  getCommandBuffer().mutableStatistics().pipelineBindCount++;
 }
 
 void RenderCommandEncoder::bindDepthStencilState(
@@ -434,29 +984,26 @@ void RenderCommandEncoder::bindDepthStencilState(
   const igl::vulkan::DepthStencilState* state =
       static_cast<igl::vulkan::DepthStencilState*>(depthStencilState.get());
 
-  const igl::DepthStencilStateDesc& desc = state->getDepthStencilStateDesc();
+  // the state object resolved all enum translation at creation; just replay the values
+  dynamicState_.depthWriteEnable_ = state->getDepthStencilStateDesc().isDepthWriteEnabled;
+  dynamicState_.setDepthCompareOp(state->getDepthCompareOp());
 
-  dynamicState_.depthWriteEnable_ = desc.isDepthWriteEnabled;
-  dynamicState_.setDepthCompareOp(compareFunctionToVkCompareOp(desc.compareFunction));
-
-  auto setStencilState = [this](VkStencilFaceFlagBits faceMask, const igl::StencilStateDesc& desc) {
-    if (desc == igl::StencilStateDesc()) {
+  auto setStencilState = [this](VkStencilFaceFlagBits faceMask,
+                                const DepthStencilState::ResolvedStencilFace& face) {
+    if (!face.enabled) {
       // do not update anything if we don't have an actual state
       return;
     }
-    dynamicState_.setStencilStateOps(faceMask,
-                                     stencilOperationToVkStencilOp(desc.stencilFailureOperation),
-                                     stencilOperationToVkStencilOp(desc.depthStencilPassOperation),
-                                     stencilOperationToVkStencilOp(desc.depthFailureOperation),
-                                     compareFunctionToVkCompareOp(desc.stencilCompareFunction));
+    dynamicState_.setStencilStateOps(
+        faceMask, face.failOp, face.passOp, face.depthFailOp, face.compareOp);
     // this is what the IGL/OGL backend does with masks
-    ctx_.vf_.vkCmdSetStencilReference(cmdBuffer_, faceMask, desc.readMask);
+    ctx_.vf_.vkCmdSetStencilReference(cmdBuffer_, faceMask, face.readMask);
     ctx_.vf_.vkCmdSetStencilCompareMask(cmdBuffer_, faceMask, 0xFF);
-    ctx_.vf_.vkCmdSetStencilWriteMask(cmdBuffer_, faceMask, desc.writeMask);
+    ctx_.vf_.vkCmdSetStencilWriteMask(cmdBuffer_, faceMask, face.writeMask);
   };
 
-  setStencilState(VK_STENCIL_FACE_FRONT_BIT, desc.frontFaceStencil);
-  setStencilState(VK_STENCIL_FACE_BACK_BIT, desc.backFaceStencil);
+  setStencilState(VK_STENCIL_FACE_FRONT_BIT, state->getFrontFace());
+  setStencilState(VK_STENCIL_FACE_BACK_BIT, state->getBackFace());
 }
 
 void RenderCommandEncoder::bindBuffer(int index,
@@ -507,15 +1054,20 @@ void RenderCommandEncoder::bindBuffer(int index,
       binder_.bindUniformBuffer(index, buf, bufferOffset);
     }
     if (isStorageBuffer) {
+#if IGL_VULKAN_ENHANCED_SHADER_DEBUGGING
       if (ctx_.enhancedShaderDebuggingStore_) {
         IGL_ASSERT_MSG(index < (IGL_UNIFORM_BLOCKS_BINDING_MAX - 1),
                        "The last buffer index is reserved for enhanced debugging features");
       }
+#endif // IGL_VULKAN_ENHANCED_SHADER_DEBUGGING
       binder_.bindStorageBuffer(index, buf, bufferOffset);
     }
   } else {
     IGL_ASSERT(false);
+    return;
   }
+
+  getCommandBuffer().mutableStatistics().bufferBindCount++;
 }
 
 void RenderCommandEncoder::bindVertexBuffer(uint32_t index,
@@ -541,13 +1093,63 @@ void RenderCommandEncoder::bindVertexBuffer(uint32_t index,
   VkBuffer vkBuf = static_cast<igl::vulkan::Buffer*>(buffer.get())->getVkBuffer();
   const VkDeviceSize offset = bufferOffset;
   ctx_.vf_.vkCmdBindVertexBuffers(cmdBuffer_, index, 1, &vkBuf, &offset);
+
+  getCommandBuffer().mutableStatistics().bufferBindCount++;
 }
 
-void RenderCommandEncoder::bindBytes(size_t /*index*/,
-                                     uint8_t /*target*/,
-                                     const void* /*data*/,
-                                     size_t /*length*/) {
-  IGL_ASSERT_NOT_IMPLEMENTED();
+void RenderCommandEncoder::bindBytes(size_t index,
+                                     uint8_t target,
+                                     const void* data,
+                                     size_t length) {
+  IGL_PROFILER_FUNCTION();
+
+  if (!IGL_VERIFY(target == igl::BindTarget::kAllGraphics)) {
+    IGL_ASSERT_MSG(false, "Bytes target should be BindTarget::kAllGraphics");
+    return;
+  }
+  if (!IGL_VERIFY(data && length)) {
+    return;
+  }
+  IGL_ASSERT_SAMPLED(rps_, "Did you forget to call bindRenderPipelineState()?");
+
+  getCommandBuffer().mutableStatistics().bufferBindCount++;
+
+  // Pipelines created with VulkanContextConfig::enableInlineUniformBlocks reflect small uniform
+  // blocks as VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT bindings: the bytes become part of the
+  // descriptor set itself, so no buffer is involved at all
+  if (ctx_.useInlineUniformBlocks_ && rps_) {
+    for (const util::BufferDescription& b : rps_->getSpvModuleInfo().uniformBuffers) {
+      if (b.bindingLocation == (uint32_t)index && ctx_.isInlineUniformBlock(b.size)) {
+        binder_.bindInlineUniformBlock((uint32_t)index, data, std::min((size_t)b.size, length));
+        return;
+      }
+    }
+  }
+
+  // Small per-draw uniform updates (e.g. MVP matrices) go through push constants: no buffer
+  // allocation and no descriptor updates, just vkCmdPushConstants() into the range reflected
+  // from the shaders. The data lands in the push constant block, not in a descriptor binding,
+  // so `index` is ignored on this path
+  if (rps_ && rps_->pushConstantRange_.size && length <= rps_->pushConstantRange_.size &&
+      length % 4 == 0) {
+    bindPushConstants(data, length, 0);
+    return;
+  }
+
+  // Payloads that do not fit the push constant block are memcpy'd into an aligned slice of the
+  // per-frame uniform ring - a persistently mapped, host-coherent buffer shared by all command
+  // buffers of a frame - and bound as a uniform buffer at `index`: no VkBuffer creation and no
+  // map/unmap syscalls per update
+  if (!IGL_VERIFY(ctx_.uniformRingBuffer_)) {
+    return;
+  }
+  const VulkanUniformRingBuffer::Slice slice = ctx_.uniformRingBuffer_->allocate(length);
+  if (!IGL_VERIFY(slice.valid())) {
+    // the ring region for this frame is exhausted; the overflow has already been logged
+    return;
+  }
+  checked_memcpy(slice.ptr, slice.range, data, length);
+  binder_.bindUniformBufferRange((uint32_t)index, slice.buffer, slice.offset, slice.range);
 }
 
 void RenderCommandEncoder::bindPushConstants(const void* data, size_t length, size_t offset) {
@@ -556,7 +1158,7 @@ void RenderCommandEncoder::bindPushConstants(const void* data, size_t length, si
 
   IGL_ASSERT(length % 4 == 0); // VUID-vkCmdPushConstants-size-00369: size must be a multiple of 4
 
-  IGL_ASSERT_MSG(rps_, "Did you forget to call bindRenderPipelineState()?");
+  IGL_ASSERT_SAMPLED(rps_, "Did you forget to call bindRenderPipelineState()?");
   IGL_ASSERT_MSG(rps_->pushConstantRange_.size,
                  "Currently bound render pipeline state has no push constants");
   IGL_ASSERT_MSG(offset + length <= rps_->pushConstantRange_.offset + rps_->pushConstantRange_.size,
@@ -594,6 +1196,40 @@ void RenderCommandEncoder::bindSamplerState(size_t index,
   }
 
   binder_.bindSamplerState(index, static_cast<igl::vulkan::SamplerState*>(samplerState));
+
+  getCommandBuffer().mutableStatistics().textureBindCount++;
+}
+
+void RenderCommandEncoder::bindSamplerStates(size_t index,
+                                             uint8_t target,
+                                             ISamplerState* const* samplerStates,
+                                             size_t count) {
+  IGL_PROFILER_FUNCTION();
+
+#if IGL_VULKAN_PRINT_COMMANDS
+  IGL_LOG_INFO("%p  bindSamplerStates(%u, %u, %u)\n",
+               cmdBuffer_,
+               (uint32_t)index,
+               (uint32_t)target,
+               (uint32_t)count);
+#endif // IGL_VULKAN_PRINT_COMMANDS
+
+  if (!IGL_VERIFY(target == igl::BindTarget::kFragment || target == igl::BindTarget::kVertex ||
+                  target == igl::BindTarget::kAllGraphics)) {
+    IGL_ASSERT_MSG(false, "Invalid sampler target");
+    return;
+  }
+  if (!IGL_VERIFY(samplerStates != nullptr)) {
+    return;
+  }
+
+  // one validation and one virtual dispatch for the whole range; the binder dirty-flags the
+  // descriptor set once and flushes every write in a single batch at draw time
+  for (size_t i = 0; i != count; i++) {
+    binder_.bindSamplerState(index + i, static_cast<igl::vulkan::SamplerState*>(samplerStates[i]));
+  }
+
+  getCommandBuffer().mutableStatistics().textureBindCount += static_cast<uint32_t>(count);
 }
 
 void RenderCommandEncoder::bindTexture(size_t index, uint8_t target, ITexture* texture) {
@@ -610,6 +1246,46 @@ void RenderCommandEncoder::bindTexture(size_t index, uint8_t target, ITexture* t
   }
 
   binder_.bindTexture(index, static_cast<igl::vulkan::Texture*>(texture));
+
+  if (const auto& feedback = ctx_.textureSampleFeedback()) {
+    feedback->recordSample(texture);
+  }
+
+  getCommandBuffer().mutableStatistics().textureBindCount++;
+}
+
+void RenderCommandEncoder::bindTextures(size_t index,
+                                        uint8_t target,
+                                        ITexture* const* textures,
+                                        size_t count) {
+  IGL_PROFILER_FUNCTION();
+
+#if IGL_VULKAN_PRINT_COMMANDS
+  IGL_LOG_INFO("%p  bindTextures(%u, %u, %u)\n",
+               cmdBuffer_,
+               (uint32_t)index,
+               (uint32_t)target,
+               (uint32_t)count);
+#endif // IGL_VULKAN_PRINT_COMMANDS
+
+  if (!IGL_VERIFY(target == igl::BindTarget::kFragment || target == igl::BindTarget::kVertex ||
+                  target == igl::BindTarget::kAllGraphics)) {
+    IGL_ASSERT_MSG(false, "Invalid texture target");
+    return;
+  }
+  if (!IGL_VERIFY(textures != nullptr)) {
+    return;
+  }
+
+  const auto& feedback = ctx_.textureSampleFeedback();
+  for (size_t i = 0; i != count; i++) {
+    binder_.bindTexture(index + i, static_cast<igl::vulkan::Texture*>(textures[i]));
+    if (feedback && textures[i]) {
+      feedback->recordSample(textures[i]);
+    }
+  }
+
+  getCommandBuffer().mutableStatistics().textureBindCount += static_cast<uint32_t>(count);
 }
 
 void RenderCommandEncoder::bindUniform(const UniformDesc& /*uniformDesc*/, const void* /*data*/) {
@@ -632,7 +1308,7 @@ void RenderCommandEncoder::draw(PrimitiveType primitiveType,
     return;
   }
 
-  IGL_ASSERT_MSG(rps_, "Did you forget to call bindRenderPipelineState()?");
+  IGL_ASSERT_SAMPLED(rps_, "Did you forget to call bindRenderPipelineState()?");
 
   ensureVertexBuffers();
 
@@ -648,8 +1324,14 @@ void RenderCommandEncoder::draw(PrimitiveType primitiveType,
                baseInstance);
 #endif // IGL_VULKAN_PRINT_COMMANDS
 
-  ctx_.vf_.vkCmdDraw(
+  IGL_VULKAN_HOT_FN(ctx_.vf_, vkCmdDraw)(
       cmdBuffer_, (uint32_t)vertexCount, instanceCount, (uint32_t)vertexStart, baseInstance);
+
+  auto& stats = getCommandBuffer().mutableStatistics();
+  stats.currentDrawCount++;
+  stats.instanceCount += instanceCount;
+  stats.estimatedPrimitiveCount += estimatedPrimitiveCount(primitiveType, vertexCount) *
+                                   instanceCount;
 }
 
 void RenderCommandEncoder::drawIndexed(PrimitiveType primitiveType,
@@ -670,7 +1352,7 @@ void RenderCommandEncoder::drawIndexed(PrimitiveType primitiveType,
     return;
   }
 
-  IGL_ASSERT_MSG(rps_, "Did you forget to call bindRenderPipelineState()?");
+  IGL_ASSERT_SAMPLED(rps_, "Did you forget to call bindRenderPipelineState()?");
 
   ensureVertexBuffers();
 
@@ -688,8 +1370,14 @@ void RenderCommandEncoder::drawIndexed(PrimitiveType primitiveType,
 #if IGL_VULKAN_PRINT_COMMANDS
   IGL_LOG_INFO("%p vkCmdDrawIndexed(%u, %u)\n", cmdBuffer_, (uint32_t)indexCount, instanceCount);
 #endif // IGL_VULKAN_PRINT_COMMANDS
-  ctx_.vf_.vkCmdDrawIndexed(
+  IGL_VULKAN_HOT_FN(ctx_.vf_, vkCmdDrawIndexed)(
       cmdBuffer_, (uint32_t)indexCount, instanceCount, 0, baseVertex, baseInstance);
+
+  auto& stats = getCommandBuffer().mutableStatistics();
+  stats.currentDrawCount++;
+  stats.instanceCount += instanceCount;
+  stats.estimatedPrimitiveCount += estimatedPrimitiveCount(primitiveType, indexCount) *
+                                   instanceCount;
 }
 
 void RenderCommandEncoder::drawIndexedIndirect(PrimitiveType primitiveType,
@@ -714,7 +1402,7 @@ void RenderCommandEncoder::multiDrawIndirect(PrimitiveType primitiveType,
   IGL_PROFILER_ZONE_GPU_COLOR_VK(
       "multiDrawIndirect()", ctx_.tracyCtx_, cmdBuffer_, IGL_PROFILER_COLOR_DRAW);
 
-  IGL_ASSERT_MSG(rps_, "Did you forget to call bindRenderPipelineState()?");
+  IGL_ASSERT_SAMPLED(rps_, "Did you forget to call bindRenderPipelineState()?");
 
   ensureVertexBuffers();
 
@@ -725,11 +1413,14 @@ void RenderCommandEncoder::multiDrawIndirect(PrimitiveType primitiveType,
 
   const igl::vulkan::Buffer* bufIndirect = static_cast<igl::vulkan::Buffer*>(&indirectBuffer);
 
-  ctx_.vf_.vkCmdDrawIndirect(cmdBuffer_,
-                             bufIndirect->getVkBuffer(),
-                             indirectBufferOffset,
-                             drawCount,
-                             stride ? stride : sizeof(VkDrawIndirectCommand));
+  IGL_VULKAN_HOT_FN(ctx_.vf_, vkCmdDrawIndirect)(
+      cmdBuffer_,
+      bufIndirect->getVkBuffer(),
+      indirectBufferOffset,
+      drawCount,
+      stride ? stride : sizeof(VkDrawIndirectCommand));
+
+  getCommandBuffer().mutableStatistics().currentDrawCount += drawCount;
 }
 
 void RenderCommandEncoder::multiDrawIndexedIndirect(PrimitiveType primitiveType,
@@ -743,7 +1434,57 @@ void RenderCommandEncoder::multiDrawIndexedIndirect(PrimitiveType primitiveType,
   IGL_PROFILER_ZONE_GPU_COLOR_VK(
       "multiDrawIndexedIndirect()", ctx_.tracyCtx_, cmdBuffer_, IGL_PROFILER_COLOR_DRAW);
 
-  IGL_ASSERT_MSG(rps_, "Did you forget to call bindRenderPipelineState()?");
+  IGL_ASSERT_SAMPLED(rps_, "Did you forget to call bindRenderPipelineState()?");
+
+  ensureVertexBuffers();
+
+  dynamicState_.setTopology(primitiveTypeToVkPrimitiveTopology(primitiveType));
+  flushDynamicState();
+
+  ctx_.drawCallCount_ += drawCallCountEnabled_;
+
+  const igl::vulkan::Buffer* bufIndex = static_cast<igl::vulkan::Buffer*>(&indexBuffer);
+  const igl::vulkan::Buffer* bufIndirect = static_cast<igl::vulkan::Buffer*>(&indirectBuffer);
+
+  const VkIndexType type = indexFormatToVkIndexType(indexFormat);
+  ctx_.vf_.vkCmdBindIndexBuffer(cmdBuffer_, bufIndex->getVkBuffer(), 0, type);
+
+  IGL_VULKAN_HOT_FN(ctx_.vf_, vkCmdDrawIndexedIndirect)(
+      cmdBuffer_,
+      bufIndirect->getVkBuffer(),
+      indirectBufferOffset,
+      drawCount,
+      stride ? stride : sizeof(VkDrawIndexedIndirectCommand));
+
+  getCommandBuffer().mutableStatistics().currentDrawCount += drawCount;
+}
+
+void RenderCommandEncoder::multiDrawIndexedIndirectCount(PrimitiveType primitiveType,
+                                                         IndexFormat indexFormat,
+                                                         IBuffer& indexBuffer,
+                                                         IBuffer& indirectBuffer,
+                                                         size_t indirectBufferOffset,
+                                                         IBuffer& countBuffer,
+                                                         size_t countBufferOffset,
+                                                         uint32_t maxDrawCount,
+                                                         uint32_t stride) {
+  IGL_PROFILER_FUNCTION_COLOR(IGL_PROFILER_COLOR_DRAW);
+  IGL_PROFILER_ZONE_GPU_COLOR_VK(
+      "multiDrawIndexedIndirectCount()", ctx_.tracyCtx_, cmdBuffer_, IGL_PROFILER_COLOR_DRAW);
+
+  IGL_ASSERT_SAMPLED(rps_, "Did you forget to call bindRenderPipelineState()?");
+
+  if (!ctx_.extensions_.enabled(VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME)) {
+    // no GPU-side count: draw every command slot and rely on the producer zeroing out culled ones
+    multiDrawIndexedIndirect(primitiveType,
+                             indexFormat,
+                             indexBuffer,
+                             indirectBuffer,
+                             indirectBufferOffset,
+                             maxDrawCount,
+                             stride);
+    return;
+  }
 
   ensureVertexBuffers();
 
@@ -754,15 +1495,22 @@ void RenderCommandEncoder::multiDrawIndexedIndirect(PrimitiveType primitiveType,
 
   const igl::vulkan::Buffer* bufIndex = static_cast<igl::vulkan::Buffer*>(&indexBuffer);
   const igl::vulkan::Buffer* bufIndirect = static_cast<igl::vulkan::Buffer*>(&indirectBuffer);
+  const igl::vulkan::Buffer* bufCount = static_cast<igl::vulkan::Buffer*>(&countBuffer);
 
   const VkIndexType type = indexFormatToVkIndexType(indexFormat);
   ctx_.vf_.vkCmdBindIndexBuffer(cmdBuffer_, bufIndex->getVkBuffer(), 0, type);
 
-  ctx_.vf_.vkCmdDrawIndexedIndirect(cmdBuffer_,
-                                    bufIndirect->getVkBuffer(),
-                                    indirectBufferOffset,
-                                    drawCount,
-                                    stride ? stride : sizeof(VkDrawIndexedIndirectCommand));
+  ctx_.vf_.vkCmdDrawIndexedIndirectCountKHR(
+      cmdBuffer_,
+      bufIndirect->getVkBuffer(),
+      indirectBufferOffset,
+      bufCount->getVkBuffer(),
+      countBufferOffset,
+      maxDrawCount,
+      stride ? stride : sizeof(VkDrawIndexedIndirectCommand));
+
+  // the actual draw count lives in the count buffer on the GPU; record the upper bound
+  getCommandBuffer().mutableStatistics().currentDrawCount += maxDrawCount;
 }
 
 void RenderCommandEncoder::setStencilReferenceValue(uint32_t value) {
@@ -800,7 +1548,10 @@ bool RenderCommandEncoder::setDrawCallCountEnabled(bool value) {
 }
 
 void RenderCommandEncoder::flushDynamicState() {
-  binder_.bindPipeline(rps_->getVkPipeline(dynamicState_), &rps_->getSpvModuleInfo());
+  const VkPipeline pipeline = ctx_.config_.enablePipelineCompileFallback
+                                  ? rps_->getVkPipelineOrFallback(dynamicState_)
+                                  : rps_->getVkPipeline(dynamicState_);
+  binder_.bindPipeline(pipeline, &rps_->getSpvModuleInfo(), rps_);
   binder_.updateBindings(rps_->getVkPipelineLayout(), *rps_);
 
   if (ctx_.config_.enableDescriptorIndexing) {
@@ -809,20 +1560,24 @@ void RenderCommandEncoder::flushDynamicState() {
 #if IGL_VULKAN_PRINT_COMMANDS
     IGL_LOG_INFO("%p vkCmdBindDescriptorSets(GRAPHICS) - bindless\n", cmdBuffer_);
 #endif // IGL_VULKAN_PRINT_COMMANDS
-    ctx_.vf_.vkCmdBindDescriptorSets(cmdBuffer_,
-                                     VK_PIPELINE_BIND_POINT_GRAPHICS,
-                                     rps_->getVkPipelineLayout(),
-                                     kBindPoint_Bindless,
-                                     1,
-                                     &dset,
-                                     0,
-                                     nullptr);
+    IGL_VULKAN_HOT_FN(ctx_.vf_, vkCmdBindDescriptorSets)(cmdBuffer_,
+                                                         VK_PIPELINE_BIND_POINT_GRAPHICS,
+                                                         rps_->getVkPipelineLayout(),
+                                                         kBindPoint_Bindless,
+                                                         1,
+                                                         &dset,
+                                                         0,
+                                                         nullptr);
   }
 }
 
 void RenderCommandEncoder::ensureVertexBuffers() {
   IGL_PROFILER_FUNCTION();
 
+  // this function does no binding work - it only validates that every vertex input binding of
+  // the current pipeline saw a bindBuffer() call - so the whole body is a per-draw contract and
+  // belongs to the full validation tier
+#if IGL_VALIDATION_LEVEL >= 2
   if (!IGL_VERIFY(rps_)) {
     return;
   }
@@ -852,6 +1607,7 @@ void RenderCommandEncoder::ensureVertexBuffers() {
           "Did you forget to call bindBuffer() for one of your vertex input buffers?");
     }
   }
+#endif // IGL_VALIDATION_LEVEL >= 2
 }
 
 } // namespace vulkan
@@ -12,6 +12,7 @@
 #include <igl/Common.h>
 #include <igl/Framebuffer.h>
 #include <igl/RenderCommandEncoder.h>
+#include <igl/RenderPass.h>
 #include <igl/vulkan/CommandBuffer.h>
 #include <igl/vulkan/RenderPipelineState.h>
 #include <igl/vulkan/ResourcesBinder.h>
@@ -19,8 +20,11 @@
 
 namespace igl::vulkan {
 
+class VulkanCommandPool;
+class VulkanRenderPassBuilder;
+
 /// @brief This class implements the igl::IRenderCommandEncoder interface for Vulkan
-class RenderCommandEncoder : public IRenderCommandEncoder {
+class RenderCommandEncoder final : public IRenderCommandEncoder {
  public:
   static std::unique_ptr<RenderCommandEncoder> create(
       const std::shared_ptr<CommandBuffer>& commandBuffer,
@@ -30,10 +34,41 @@ class RenderCommandEncoder : public IRenderCommandEncoder {
       const Dependencies& dependencies,
       Result* outResult);
 
-  ~RenderCommandEncoder() override {
-    IGL_ASSERT(!isEncoding_); // did you forget to call endEncoding()?
-    endEncoding();
-  }
+  /** @brief Creates an encoder that merges into the render pass left open by the previous
+   * encoder (see VulkanContextConfig::enableRenderPassMerging): no render pass is begun or ended
+   * here, the encoder simply continues recording into the open pass. `dependencies` must be the
+   * union of both passes' dependencies and `renderPassIndex` the pipeline-compatibility index of
+   * the open pass, both produced by CommandBuffer::canMergeRenderPass().
+   */
+  static std::unique_ptr<RenderCommandEncoder> createMerged(
+      const std::shared_ptr<CommandBuffer>& commandBuffer,
+      VulkanContext& ctx,
+      const RenderPassDesc& renderPass,
+      const std::shared_ptr<IFramebuffer>& framebuffer,
+      const Dependencies& dependencies,
+      uint32_t renderPassIndex,
+      Result* outResult);
+
+  /** @brief Creates a "parallel" encoder: the returned primary encoder begins the render pass
+   * with VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS, and `outSecondaryEncoders` receives
+   * `numSecondaryEncoders` encoders, each recording into a VK_COMMAND_BUFFER_LEVEL_SECONDARY
+   * command buffer allocated from its own VkCommandPool, so each one can be handed to a
+   * different worker thread. Record draw calls only through the secondary encoders; call
+   * endEncoding() on every secondary encoder (on its own thread is fine) before calling
+   * endEncoding() on the primary encoder, which stitches the secondary command buffers into the
+   * render pass with vkCmdExecuteCommands().
+   */
+  static std::unique_ptr<RenderCommandEncoder> createParallel(
+      const std::shared_ptr<CommandBuffer>& commandBuffer,
+      VulkanContext& ctx,
+      const RenderPassDesc& renderPass,
+      const std::shared_ptr<IFramebuffer>& framebuffer,
+      const Dependencies& dependencies,
+      uint32_t numSecondaryEncoders,
+      std::vector<std::unique_ptr<IRenderCommandEncoder>>& outSecondaryEncoders,
+      Result* outResult);
+
+  ~RenderCommandEncoder() override;
 
   /// @brief Ends encoding for render commands and transitions the layouts of all images bound to
   /// this encoder back to `VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL`. Also transitions all
@@ -60,7 +95,10 @@ class RenderCommandEncoder : public IRenderCommandEncoder {
                         const std::shared_ptr<IBuffer>& buffer,
                         size_t bufferOffset) override;
 
-  /// @brief Not implemented
+  /// @brief Fast path for small per-draw uniform updates: the data is pushed with
+  /// `vkCmdPushConstants()` into the push constant range reflected from the shaders of the
+  /// currently bound pipeline, bypassing buffer allocation and descriptor updates. `length` must
+  /// be a multiple of 4 and fit the reflected range; `index` is ignored
   void bindBytes(size_t index, uint8_t target, const void* data, size_t length) override;
 
   /// @brief Binds push constants pointed by `data` with `length` bytes starting at `offset`.
@@ -68,8 +106,18 @@ class RenderCommandEncoder : public IRenderCommandEncoder {
   void bindPushConstants(const void* data, size_t length, size_t offset) override;
   void bindSamplerState(size_t index, uint8_t target, ISamplerState* samplerState) override;
 
+  /// @brief Binds a consecutive range of sampler states with a single target validation; the
+  /// binder batches the descriptor writes for the whole range into one update at draw time
+  void bindSamplerStates(size_t index,
+                         uint8_t target,
+                         ISamplerState* const* samplerStates,
+                         size_t count) override;
+
   void bindTexture(size_t index, uint8_t target, ITexture* texture) override;
 
+  /// @brief Binds a consecutive range of textures; the array counterpart of bindTexture()
+  void bindTextures(size_t index, uint8_t target, ITexture* const* textures, size_t count) override;
+
   /// @brief This is only for backends that MUST use single uniforms in some situations. Do not
   /// implement!
   void bindUniform(const UniformDesc& uniformDesc, const void* data) override;
@@ -104,6 +152,17 @@ class RenderCommandEncoder : public IRenderCommandEncoder {
                                 size_t indirectBufferOffset,
                                 uint32_t drawCount,
                                 uint32_t stride = 0) override;
+  /// Uses vkCmdDrawIndexedIndirectCountKHR when VK_KHR_draw_indirect_count is available;
+  /// otherwise draws all maxDrawCount commands (the producer must zero out culled commands)
+  void multiDrawIndexedIndirectCount(PrimitiveType primitiveType,
+                                     IndexFormat indexFormat,
+                                     IBuffer& indexBuffer,
+                                     IBuffer& indirectBuffer,
+                                     size_t indirectBufferOffset,
+                                     IBuffer& countBuffer,
+                                     size_t countBufferOffset,
+                                     uint32_t maxDrawCount,
+                                     uint32_t stride = 0) override;
 
   void setStencilReferenceValue(uint32_t value) override;
   void setStencilReferenceValues(uint32_t frontValue, uint32_t backValue) override;
@@ -126,6 +185,13 @@ class RenderCommandEncoder : public IRenderCommandEncoder {
  private:
   RenderCommandEncoder(const std::shared_ptr<CommandBuffer>& commandBuffer, VulkanContext& ctx);
 
+  /// @brief Constructs a secondary encoder recording into `secondaryCmdBuffer`, allocated from
+  /// `secondaryPool`. The pool is kept alive until the GPU has executed the command buffer
+  RenderCommandEncoder(const std::shared_ptr<CommandBuffer>& commandBuffer,
+                       VulkanContext& ctx,
+                       std::unique_ptr<VulkanCommandPool> secondaryPool,
+                       VkCommandBuffer secondaryCmdBuffer);
+
   /// @brief Ensures that the vertex buffers are bound by performing checks. If the function doesn't
   /// assert at some point, the vertex buffer(s) is bound correctly.
   void ensureVertexBuffers();
@@ -134,13 +200,67 @@ class RenderCommandEncoder : public IRenderCommandEncoder {
   void initialize(const RenderPassDesc& renderPass,
                   const std::shared_ptr<IFramebuffer>& framebuffer,
                   const Dependencies& dependencies,
+                  VkSubpassContents subpassContents,
                   Result* outResult);
 
+  /// @brief Counterpart of initialize() for createMerged(): binds the default viewport/scissor
+  /// and per-pass state without beginning a render pass, since the previous pass is still open
+  void adoptOpenPass(const RenderPassDesc& renderPass,
+                     const std::shared_ptr<IFramebuffer>& framebuffer,
+                     const Dependencies& dependencies,
+                     uint32_t renderPassIndex,
+                     Result* outResult);
+
+  /// @brief True when this pass may leave its render pass open at endEncoding() so a following
+  /// compatible pass can merge into it: merging must be enabled and the pass must have no render
+  /// area and no resolves (a merged pass keeps rendering past this pass's boundary, so a resolve
+  /// here would run too early)
+  bool isMergeCandidate(const RenderPassDesc& renderPass) const;
+
+  /// @brief Begins the secondary command buffer with the render pass continuation inheritance
+  /// info matching the primary encoder's render pass and framebuffer
+  void initializeSecondary(const RenderPassDesc& renderPass,
+                           const std::shared_ptr<IFramebuffer>& framebuffer,
+                           Result* outResult);
+
+  /// @brief VK_KHR_dynamic_rendering counterpart of initialize(): begins rendering directly from
+  /// the render pass description with vkCmdBeginRenderingKHR(), creating no VkRenderPass or
+  /// VkFramebuffer objects. Used when `VulkanContext::useDynamicRendering_` is set
+  void beginRendering(const RenderPassDesc& renderPass,
+                      const std::shared_ptr<IFramebuffer>& framebuffer,
+                      VkSubpassContents subpassContents,
+                      Result* outResult);
+
+  /// @brief VK_KHR_dynamic_rendering counterpart of initializeSecondary(): begins the secondary
+  /// command buffer with a VkCommandBufferInheritanceRenderingInfoKHR built from the attachment
+  /// formats instead of a render pass handle
+  void beginSecondaryRendering(const RenderPassDesc& renderPass,
+                               const std::shared_ptr<IFramebuffer>& framebuffer,
+                               Result* outResult);
+
+  /// @brief Translates `renderPass`/`framebuffer` into a VulkanRenderPassBuilder plus clear
+  /// values and the common mip-level/layer of the attachments. Returns false (and sets
+  /// `outResult`) when the descriptions are inconsistent
+  bool buildRenderPass(const RenderPassDesc& renderPass,
+                       const std::shared_ptr<IFramebuffer>& framebuffer,
+                       VulkanRenderPassBuilder& outBuilder,
+                       std::vector<VkClearValue>& outClearValues,
+                       uint32_t& outMipLevel,
+                       uint32_t& outLayer,
+                       Result* outResult);
+
  private:
   VulkanContext& ctx_;
   VkCommandBuffer cmdBuffer_ = VK_NULL_HANDLE;
   bool isEncoding_ = false;
   bool hasDepthAttachment_ = false;
+  // a secondary encoder records into its own VK_COMMAND_BUFFER_LEVEL_SECONDARY command buffer and
+  // leaves all render pass handling to the primary encoder that created it
+  bool isSecondary_ = false;
+  std::unique_ptr<VulkanCommandPool> secondaryPool_;
+  // secondary command buffers to stitch into the render pass on endEncoding(); only non-empty on
+  // a primary encoder created with createParallel()
+  std::vector<VkCommandBuffer> secondaryCmdBuffers_;
   std::shared_ptr<IFramebuffer> framebuffer_;
 
   igl::vulkan::ResourcesBinder binder_;
@@ -156,6 +276,19 @@ class RenderCommandEncoder : public IRenderCommandEncoder {
 
   Dependencies dependencies_ = {};
 
+  // the pass description this encoder was created with, stashed with the open pass when the pass
+  // end is deferred for merging (see CommandBuffer::deferRenderPassEnd())
+  RenderPassDesc renderPassDesc_;
+  // see isMergeCandidate(); always false for secondary and parallel-primary encoders
+  bool mergeCandidate_ = false;
+
+  // programmable MSAA resolve (see RenderPassDesc::colorResolveShaderStages): armed by
+  // buildRenderPass(), recorded by endEncoding() as a second subpass before vkCmdEndRenderPass()
+  std::shared_ptr<IShaderStages> resolveShaderStages_;
+  VkImageView resolveMsaaColorView_ = VK_NULL_HANDLE;
+  VkRenderPass resolveRenderPass_ = VK_NULL_HANDLE;
+  VkExtent2D resolveExtent_ = {};
+
   const igl::vulkan::RenderPipelineState* rps_ = nullptr;
 };
 
@@ -312,6 +312,13 @@ RenderPipelineState::RenderPipelineState(const igl::vulkan::Device& device,
 }
 
 RenderPipelineState::~RenderPipelineState() {
+  // make sure no background warm-up is still creating pipelines before destroying them
+  for (auto& task : warmUpTasks_) {
+    if (task.valid()) {
+      task.wait();
+    }
+  }
+
   const VulkanContext& ctx = device_.getVulkanContext();
   VkDevice device = ctx.device_->getVkDevice();
 
@@ -333,7 +340,8 @@ VkPipeline RenderPipelineState::getVkPipeline(
     // the bindless descriptor set layout can be changed in VulkanContext when the number of
     // existing textures increases
     if (lastBindlessVkDescriptorSetLayout_ != ctx.getBindlessVkDescriptorSetLayout()) {
-      // there's a new descriptor set layout - drop the previous Vulkan pipeline
+      // there's a new descriptor set layout - drop the previous Vulkan pipelines
+      const std::lock_guard<std::mutex> lock(pipelinesMutex_);
       VkDevice device = ctx.device_->getVkDevice();
       for (const auto& p : pipelines_) {
         if (p.second != VK_NULL_HANDLE) {
@@ -344,39 +352,111 @@ VkPipeline RenderPipelineState::getVkPipeline(
         }
       }
       pipelines_.clear();
+      // force the next build to recreate the pipeline layout against the new descriptor set layout
+      pipelineLayout_.reset();
       lastBindlessVkDescriptorSetLayout_ = ctx.getBindlessVkDescriptorSetLayout();
     }
   }
 
-  const auto it = pipelines_.find(dynamicState);
+  {
+    const std::lock_guard<std::mutex> lock(pipelinesMutex_);
+    const auto it = pipelines_.find(dynamicState);
 
-  if (it != pipelines_.end()) {
-    return it->second;
+    if (it != pipelines_.end()) {
+      return it->second;
+    }
   }
 
-  // @fb-only
-  const VkDescriptorSetLayout DSLs[] = {
-      dslCombinedImageSamplers_->getVkDescriptorSetLayout(),
-      dslUniformBuffers_->getVkDescriptorSetLayout(),
-      dslStorageBuffers_->getVkDescriptorSetLayout(),
-      ctx.getBindlessVkDescriptorSetLayout(),
-  };
-
-  pipelineLayout_ = std::make_unique<VulkanPipelineLayout>(
-      ctx,
-      ctx.getVkDevice(),
-      DSLs,
-      static_cast<uint32_t>(ctx.config_.enableDescriptorIndexing
-                                ? IGL_ARRAY_NUM_ELEMENTS(DSLs)
-                                : IGL_ARRAY_NUM_ELEMENTS(DSLs) - 1u),
-      info_.hasPushConstants ? &pushConstantRange_ : nullptr,
-      IGL_FORMAT("Pipeline Layout: {}", desc_.debugName.c_str()).c_str());
+  return createVkPipeline(dynamicState);
+}
+
+void RenderPipelineState::warmUpAsync(const RenderPipelineDynamicState& dynamicState) const {
+  {
+    const std::lock_guard<std::mutex> lock(pipelinesMutex_);
+    if (pipelines_.find(dynamicState) != pipelines_.end()) {
+      return;
+    }
+  }
+
+  warmUpTasks_.push_back(std::async(
+      std::launch::async, [this, dynamicState]() { (void)createVkPipeline(dynamicState); }));
+}
+
+VkPipeline RenderPipelineState::getVkPipelineOrFallback(
+    const RenderPipelineDynamicState& dynamicState) const {
+  {
+    const std::lock_guard<std::mutex> lock(pipelinesMutex_);
+    const auto it = pipelines_.find(dynamicState);
+
+    if (it != pipelines_.end()) {
+      return it->second;
+    }
+  }
+
+  // the exact pipeline isn't ready - build it in the background and keep rendering with a
+  // previously created pipeline that differs only in its dynamic state
+  warmUpAsync(dynamicState);
+
+  {
+    const std::lock_guard<std::mutex> lock(pipelinesMutex_);
+    if (!pipelines_.empty()) {
+      return pipelines_.begin()->second;
+    }
+  }
+
+  // no stand-in exists yet - there's nothing to render with, so build synchronously
+  return createVkPipeline(dynamicState);
+}
+
+VkPipeline RenderPipelineState::createVkPipeline(
+    const RenderPipelineDynamicState& dynamicState) const {
+  IGL_PROFILER_FUNCTION_COLOR(IGL_PROFILER_COLOR_CREATE);
+
+  const VulkanContext& ctx = device_.getVulkanContext();
+
+  // one build at a time: VulkanPipelineBuilder setup below is not reentrant, and this also
+  // prevents a background warm-up and a synchronous build from creating the same pipeline twice
+  const std::lock_guard<std::mutex> buildLock(buildMutex_);
+
+  {
+    const std::lock_guard<std::mutex> lock(pipelinesMutex_);
+    const auto it = pipelines_.find(dynamicState);
+
+    if (it != pipelines_.end()) {
+      // another thread created this pipeline while we were waiting for the build mutex
+      return it->second;
+    }
+  }
+
+  if (!pipelineLayout_) {
+    // @fb-only
+    const VkDescriptorSetLayout DSLs[] = {
+        dslCombinedImageSamplers_->getVkDescriptorSetLayout(),
+        dslUniformBuffers_->getVkDescriptorSetLayout(),
+        dslStorageBuffers_->getVkDescriptorSetLayout(),
+        ctx.getBindlessVkDescriptorSetLayout(),
+    };
+
+    pipelineLayout_ = std::make_unique<VulkanPipelineLayout>(
+        ctx,
+        ctx.getVkDevice(),
+        DSLs,
+        static_cast<uint32_t>(ctx.config_.enableDescriptorIndexing
+                                  ? IGL_ARRAY_NUM_ELEMENTS(DSLs)
+                                  : IGL_ARRAY_NUM_ELEMENTS(DSLs) - 1u),
+        info_.hasPushConstants ? &pushConstantRange_ : nullptr,
+        IGL_FORMAT("Pipeline Layout: {}", desc_.debugName.c_str()).c_str());
+  }
 
   const VkPhysicalDeviceFeatures2& deviceFeatures = ctx.getVkPhysicalDeviceFeatures2();
   VkBool32 dualSrcBlendSupported = deviceFeatures.features.dualSrcBlend;
 
-  // build a new Vulkan pipeline
-  VkRenderPass renderPass = ctx.getRenderPass(dynamicState.renderPassIndex_).pass;
+  // build a new Vulkan pipeline. With dynamic rendering there are no render pass objects: the
+  // pipeline is built against the attachment formats instead, and the render pass index field of
+  // the dynamic state carries the view mask selector (see RenderCommandEncoder)
+  const VkRenderPass renderPass = ctx.useDynamicRendering_
+                                      ? VK_NULL_HANDLE
+                                      : ctx.getRenderPass(dynamicState.renderPassIndex_).pass;
 
   VkPipeline pipeline = VK_NULL_HANDLE;
 
@@ -414,8 +494,39 @@ VkPipeline RenderPipelineState::getVkPipeline(
 
   const auto& vertexModule = desc_.shaderStages->getVertexModule();
   const auto& fragmentModule = desc_.shaderStages->getFragmentModule();
+
+  VkPipelineShaderStageCreateInfo vertexStage = ivkGetPipelineShaderStageCreateInfo(
+      VK_SHADER_STAGE_VERTEX_BIT,
+      igl::vulkan::ShaderModule::getVkShaderModule(vertexModule),
+      vertexModule->info().entryPoint.c_str());
+  vertexStage.pSpecializationInfo = igl::vulkan::ShaderModule::getSpecializationInfo(vertexModule);
+
+  VkPipelineShaderStageCreateInfo fragmentStage = ivkGetPipelineShaderStageCreateInfo(
+      VK_SHADER_STAGE_FRAGMENT_BIT,
+      igl::vulkan::ShaderModule::getVkShaderModule(fragmentModule),
+      fragmentModule->info().entryPoint.c_str());
+  fragmentStage.pSpecializationInfo =
+      igl::vulkan::ShaderModule::getSpecializationInfo(fragmentModule);
+
+  igl::vulkan::VulkanPipelineBuilder builder;
+
+  if (ctx.useDynamicRendering_) {
+    std::vector<VkFormat> colorAttachmentFormats;
+    colorAttachmentFormats.reserve(desc_.targetDesc.colorAttachments.size());
+    for (const auto& attachment : desc_.targetDesc.colorAttachments) {
+      if (attachment.textureFormat != TextureFormat::Invalid) {
+        colorAttachmentFormats.push_back(textureFormatToVkFormat(attachment.textureFormat));
+      }
+    }
+    builder.dynamicRenderingAttachmentFormats(
+        std::move(colorAttachmentFormats),
+        textureFormatToVkFormat(desc_.targetDesc.depthAttachmentFormat),
+        textureFormatToVkFormat(desc_.targetDesc.stencilAttachmentFormat),
+        dynamicState.renderPassIndex_ ? 0x3u : 0u);
+  }
+
   VK_ASSERT_RETURN_NULL_HANDLE(
-      igl::vulkan::VulkanPipelineBuilder()
+      builder
           .dynamicStates({
               // from Vulkan 1.0
               VK_DYNAMIC_STATE_VIEWPORT,
@@ -442,16 +553,7 @@ VkPipeline RenderPipelineState::getVkPipeline(
                            dynamicState.getStencilStatePassOp(false),
                            dynamicState.getStencilStateDepthFailOp(false),
                            dynamicState.getStencilStateCompareOp(false))
-          .shaderStages({
-              ivkGetPipelineShaderStageCreateInfo(
-                  VK_SHADER_STAGE_VERTEX_BIT,
-                  igl::vulkan::ShaderModule::getVkShaderModule(vertexModule),
-                  vertexModule->info().entryPoint.c_str()),
-              ivkGetPipelineShaderStageCreateInfo(
-                  VK_SHADER_STAGE_FRAGMENT_BIT,
-                  igl::vulkan::ShaderModule::getVkShaderModule(fragmentModule),
-                  fragmentModule->info().entryPoint.c_str()),
-          })
+          .shaderStages({vertexStage, fragmentStage})
           .cullMode(cullModeToVkCullMode(desc_.cullMode))
           .frontFace(windingModeToVkFrontFace(desc_.frontFaceWinding))
           .vertexInputState(vertexInputStateCreateInfo_)
@@ -464,7 +566,10 @@ VkPipeline RenderPipelineState::getVkPipeline(
                  &pipeline,
                  desc_.debugName.c_str()));
 
-  pipelines_[dynamicState] = pipeline;
+  {
+    const std::lock_guard<std::mutex> lock(pipelinesMutex_);
+    pipelines_[dynamicState] = pipeline;
+  }
 
   // @fb-only
   // @lint-ignore CLANGTIDY
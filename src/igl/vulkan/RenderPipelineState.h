@@ -7,10 +7,12 @@
 
 #pragma once
 
+#include <future>
 #include <igl/RenderPipelineState.h>
 #include <igl/vulkan/Common.h>
 #include <igl/vulkan/PipelineState.h>
 #include <igl/vulkan/RenderPipelineReflection.h>
+#include <mutex>
 #include <unordered_map>
 
 namespace igl {
@@ -177,9 +179,29 @@ class RenderPipelineState final : public IRenderPipelineState, public vulkan::Pi
    */
   VkPipeline getVkPipeline(const RenderPipelineDynamicState& dynamicState) const;
 
+  /** @brief Schedules the creation of the pipeline for `dynamicState` on a background thread so
+   * that a later `getVkPipeline()` call with the same state finds it in the cache instead of
+   * stalling the frame on vkCreateGraphicsPipelines(). The VkPipelineCache in VulkanContext is
+   * shared with the background build. A no-op when the pipeline already exists. Warm-up should be
+   * requested before encoding with this pipeline state
+   */
+  void warmUpAsync(const RenderPipelineDynamicState& dynamicState) const;
+
+  /** @brief Returns the pipeline for `dynamicState` when it has already been created. Otherwise
+   * schedules its creation on a background thread and returns a previously created pipeline with
+   * different dynamic state as a temporary stand-in so rendering does not hitch; the exact pipeline
+   * is picked up by a later call once the background build finishes. Falls back to a synchronous
+   * build when no stand-in exists yet
+   */
+  VkPipeline getVkPipelineOrFallback(const RenderPipelineDynamicState& dynamicState) const;
+
  private:
   friend class Device;
 
+  /// @brief Builds the Vulkan pipeline for `dynamicState` and stores it in `pipelines_`. Builds are
+  /// serialized by `buildMutex_` so that background warm-ups do not race synchronous creation
+  VkPipeline createVkPipeline(const RenderPipelineDynamicState& dynamicState) const;
+
   int getIndexByName(const igl::NameHandle& name, ShaderStage stage) const override;
   int getIndexByName(const std::string& name, ShaderStage stage) const override;
 
@@ -202,6 +224,16 @@ class RenderPipelineState final : public IRenderPipelineState, public vulkan::Pi
                              VkPipeline,
                              RenderPipelineDynamicState::HashFunction>
       pipelines_;
+
+  /// @brief Guards `pipelines_`, which is read on the render thread and written by background
+  /// warm-up builds
+  mutable std::mutex pipelinesMutex_;
+  /// @brief Serializes pipeline builds: only one vkCreateGraphicsPipelines() per pipeline state
+  /// object runs at a time, and `pipelineLayout_` is only (re)created under this mutex
+  mutable std::mutex buildMutex_;
+  /// @brief In-flight background warm-up builds; waited on in the destructor. Only accessed from
+  /// the thread that calls `warmUpAsync()`
+  mutable std::vector<std::future<void>> warmUpTasks_;
 };
 
 } // namespace vulkan
@@ -5,6 +5,8 @@
  * LICENSE file in the root directory of this source tree.
  */
 
+#include <cstring>
+
 #include <igl/vulkan/Buffer.h>
 #include <igl/vulkan/PipelineState.h>
 #include <igl/vulkan/ResourcesBinder.h>
@@ -12,6 +14,7 @@
 #include <igl/vulkan/Texture.h>
 #include <igl/vulkan/VulkanBuffer.h>
 #include <igl/vulkan/VulkanContext.h>
+#include <igl/vulkan/VulkanDescriptorSetLayout.h>
 #include <igl/vulkan/VulkanImage.h>
 #include <igl/vulkan/VulkanImageView.h>
 #include <igl/vulkan/VulkanPipelineLayout.h>
@@ -26,6 +29,11 @@ ResourcesBinder::ResourcesBinder(const std::shared_ptr<CommandBuffer>& commandBu
                                  VkPipelineBindPoint bindPoint) :
   ctx_(ctx), cmdBuffer_(commandBuffer->getVkCommandBuffer()), bindPoint_(bindPoint) {}
 
+ResourcesBinder::ResourcesBinder(VkCommandBuffer cmdBuffer,
+                                 const VulkanContext& ctx,
+                                 VkPipelineBindPoint bindPoint) :
+  ctx_(ctx), cmdBuffer_(cmdBuffer), bindPoint_(bindPoint) {}
+
 void ResourcesBinder::bindUniformBuffer(uint32_t index,
                                         igl::vulkan::Buffer* buffer,
                                         size_t bufferOffset) {
@@ -42,8 +50,55 @@ void ResourcesBinder::bindUniformBuffer(uint32_t index,
   VkBuffer buf = buffer ? buffer->getVkBuffer() : ctx_.dummyUniformBuffer_->getVkBuffer();
   VkDescriptorBufferInfo& slot = bindingsUniformBuffers_.buffers[index];
 
-  if (slot.buffer != buf || slot.offset != bufferOffset) {
-    slot = {buf, bufferOffset, VK_WHOLE_SIZE};
+  // Suballocated buffers share a VkBuffer page with other buffers: offset the binding by the
+  // suballocation offset and clamp the range so the shader cannot read past this buffer
+  VkDeviceSize range = VK_WHOLE_SIZE;
+  if (buffer && buffer->isSuballocated()) {
+    range = buffer->getSizeInBytes() - bufferOffset;
+    bufferOffset += buffer->getVkBufferOffset();
+  }
+
+  if (slot.buffer != buf || slot.offset != bufferOffset || slot.range != range) {
+    slot = {buf, bufferOffset, range};
+    isDirtyFlags_ |= DirtyFlagBits_UniformBuffers;
+  }
+}
+
+void ResourcesBinder::bindUniformBufferRange(uint32_t index,
+                                             VkBuffer buffer,
+                                             VkDeviceSize bufferOffset,
+                                             VkDeviceSize range) {
+  IGL_PROFILER_FUNCTION();
+
+  if (!IGL_VERIFY(index < IGL_UNIFORM_BLOCKS_BINDING_MAX)) {
+    IGL_ASSERT_MSG(false, "Buffer index should not exceed kMaxBindingSlots");
+    return;
+  }
+
+  VkBuffer buf = buffer != VK_NULL_HANDLE ? buffer : ctx_.dummyUniformBuffer_->getVkBuffer();
+  VkDescriptorBufferInfo& slot = bindingsUniformBuffers_.buffers[index];
+
+  if (slot.buffer != buf || slot.offset != bufferOffset || slot.range != range) {
+    slot = {buf, bufferOffset, range};
+    isDirtyFlags_ |= DirtyFlagBits_UniformBuffers;
+  }
+}
+
+void ResourcesBinder::bindInlineUniformBlock(uint32_t index, const void* data, size_t size) {
+  IGL_PROFILER_FUNCTION();
+
+  if (!IGL_VERIFY(index < IGL_UNIFORM_BLOCKS_BINDING_MAX)) {
+    IGL_ASSERT_MSG(false, "Buffer index should not exceed kMaxBindingSlots");
+    return;
+  }
+  if (!IGL_VERIFY(data && size && size <= kInlineUniformBlockMaxSize)) {
+    return;
+  }
+
+  uint8_t* dst = bindingsInlineUniforms_.data[index];
+
+  if (memcmp(dst, data, size) != 0) {
+    memcpy(dst, data, size);
     isDirtyFlags_ |= DirtyFlagBits_UniformBuffers;
   }
 }
@@ -64,8 +119,15 @@ void ResourcesBinder::bindStorageBuffer(uint32_t index,
   VkBuffer buf = buffer ? buffer->getVkBuffer() : ctx_.dummyStorageBuffer_->getVkBuffer();
   VkDescriptorBufferInfo& slot = bindingsStorageBuffers_.buffers[index];
 
-  if (slot.buffer != buf || slot.offset != bufferOffset) {
-    slot = {buf, bufferOffset, VK_WHOLE_SIZE};
+  // see bindUniformBuffer() above
+  VkDeviceSize range = VK_WHOLE_SIZE;
+  if (buffer && buffer->isSuballocated()) {
+    range = buffer->getSizeInBytes() - bufferOffset;
+    bufferOffset += buffer->getVkBufferOffset();
+  }
+
+  if (slot.buffer != buf || slot.offset != bufferOffset || slot.range != range) {
+    slot = {buf, bufferOffset, range};
     isDirtyFlags_ |= DirtyFlagBits_StorageBuffers;
   }
 }
@@ -158,6 +220,7 @@ void ResourcesBinder::updateBindings(VkPipelineLayout layout, const vulkan::Pipe
                                       layout,
                                       bindPoint_,
                                       bindingsUniformBuffers_,
+                                      bindingsInlineUniforms_,
                                       *state.dslUniformBuffers_,
                                       state.info_);
   }
@@ -173,22 +236,61 @@ void ResourcesBinder::updateBindings(VkPipelineLayout layout, const vulkan::Pipe
   isDirtyFlags_ = 0;
 }
 
-void ResourcesBinder::bindPipeline(VkPipeline pipeline, const util::SpvModuleInfo* info) {
+void ResourcesBinder::bindPipeline(VkPipeline pipeline,
+                                   const util::SpvModuleInfo* info,
+                                   const PipelineState* state) {
   if (lastPipelineBound_ == pipeline) {
     return;
   }
 
   if (info) {
-    // a new pipeline might want a new descriptors configuration
-    if (!info->uniformBuffers.empty()) {
+    // A new pipeline might want a new descriptors configuration. Under the Vulkan pipeline layout
+    // compatibility rules, descriptor sets stay bound across a pipeline switch as long as both
+    // layouts were created with identical push constant ranges and identical descriptor set
+    // layouts for this set and all lower-numbered sets; count how many leading sets survive and
+    // only re-dirty the rest. Our set order is fixed by the SPIR-V reflection (samplers=0,
+    // uniform=1, storage=2), which already puts the most frequently changing resources first
+    VkDescriptorSetLayout newLayouts[kNumTrackedSets] = {};
+    uint32_t compatibleSets = 0;
+    if (state) {
+      newLayouts[kBindPoint_CombinedImageSamplers] =
+          state->dslCombinedImageSamplers_->getVkDescriptorSetLayout();
+      newLayouts[kBindPoint_BuffersUniform] = state->dslUniformBuffers_->getVkDescriptorSetLayout();
+      newLayouts[kBindPoint_BuffersStorage] = state->dslStorageBuffers_->getVkDescriptorSetLayout();
+      const VkPushConstantRange& pcr = state->pushConstantRange_;
+      if (pcr.stageFlags == lastPushConstantRange_.stageFlags &&
+          pcr.offset == lastPushConstantRange_.offset && pcr.size == lastPushConstantRange_.size) {
+        while (compatibleSets < kNumTrackedSets &&
+               newLayouts[compatibleSets] != VK_NULL_HANDLE &&
+               newLayouts[compatibleSets] == lastDescriptorSetLayouts_[compatibleSets]) {
+          compatibleSets++;
+        }
+      }
+      for (uint32_t i = 0; i != kNumTrackedSets; i++) {
+        lastDescriptorSetLayouts_[i] = newLayouts[i];
+      }
+      lastPushConstantRange_ = pcr;
+    } else {
+      for (uint32_t i = 0; i != kNumTrackedSets; i++) {
+        lastDescriptorSetLayouts_[i] = VK_NULL_HANDLE;
+      }
+      lastPushConstantRange_ = {};
+    }
+    if (!info->textures.empty() && compatibleSets <= kBindPoint_CombinedImageSamplers) {
+      isDirtyFlags_ |= DirtyFlagBits_Textures;
+    }
+    if (!info->uniformBuffers.empty() && compatibleSets <= kBindPoint_BuffersUniform) {
       isDirtyFlags_ |= DirtyFlagBits_UniformBuffers;
     }
-    if (!info->storageBuffers.empty()) {
+    if (!info->storageBuffers.empty() && compatibleSets <= kBindPoint_BuffersStorage) {
       isDirtyFlags_ |= DirtyFlagBits_StorageBuffers;
     }
-    if (!info->textures.empty()) {
-      isDirtyFlags_ |= DirtyFlagBits_Textures;
+  } else {
+    // resetting the pipeline invalidates any compatibility with the next one
+    for (uint32_t i = 0; i != kNumTrackedSets; i++) {
+      lastDescriptorSetLayouts_[i] = VK_NULL_HANDLE;
     }
+    lastPushConstantRange_ = {};
   }
 
   lastPipelineBound_ = pipeline;
@@ -31,6 +31,16 @@ struct BindingsBuffers {
   VkDescriptorBufferInfo buffers[IGL_UNIFORM_BLOCKS_BINDING_MAX] = {};
 };
 
+// Uniform blocks of at most this many bytes qualify for VK_EXT_inline_uniform_block promotion
+// (see VulkanContextConfig::enableInlineUniformBlocks and VulkanContext::isInlineUniformBlock())
+constexpr uint32_t kInlineUniformBlockMaxSize = 256;
+
+// CPU-side staging for the contents of inline uniform block bindings; the bytes are written
+// directly into the descriptor set by VulkanContext::updateBindingsUniformBuffers()
+struct BindingsInlineUniforms {
+  uint8_t data[IGL_UNIFORM_BLOCKS_BINDING_MAX][kInlineUniformBlockMaxSize] = {};
+};
+
 struct BindingsTextures {
   igl::vulkan::VulkanTexture* textures[IGL_TEXTURE_SAMPLERS_MAX] = {};
   igl::vulkan::VulkanSampler* samplers[IGL_TEXTURE_SAMPLERS_MAX] = {};
@@ -54,9 +64,28 @@ class ResourcesBinder final {
                   const VulkanContext& ctx,
                   VkPipelineBindPoint bindPoint);
 
+  /// @brief Same as above, but records into an explicitly provided command buffer instead of the
+  /// one owned by a CommandBuffer object. Used by secondary command buffer render encoders
+  ResourcesBinder(VkCommandBuffer cmdBuffer, const VulkanContext& ctx, VkPipelineBindPoint bindPoint);
+
   /// @brief Binds a uniform buffer with an offset to index equal to `index`
   void bindUniformBuffer(uint32_t index, igl::vulkan::Buffer* buffer, size_t bufferOffset);
 
+  /// @brief Binds an explicit `(VkBuffer, offset, range)` triple as a uniform buffer to index
+  /// equal to `index`. Used for slices of internally owned buffers that have no igl::IBuffer
+  /// wrapper, such as the per-frame uniform ring (see RenderCommandEncoder::bindBytes())
+  void bindUniformBufferRange(uint32_t index,
+                              VkBuffer buffer,
+                              VkDeviceSize bufferOffset,
+                              VkDeviceSize range);
+
+  /// @brief Stores `size` bytes of uniform data for the inline uniform block binding at index
+  /// equal to `index`. Only meaningful for bindings that the current pipeline promoted to
+  /// VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT (see
+  /// VulkanContextConfig::enableInlineUniformBlocks); the bytes become part of the descriptor set
+  /// itself, so no buffer is involved
+  void bindInlineUniformBlock(uint32_t index, const void* data, size_t size);
+
   /// @brief Binds a storage buffer with an offset to index equal to `index`
   void bindStorageBuffer(uint32_t index, igl::vulkan::Buffer* buffer, size_t bufferOffset);
 
@@ -71,8 +100,26 @@ class ResourcesBinder final {
   void updateBindings(VkPipelineLayout layout, const vulkan::PipelineState& state);
 
   /// @brief If the pipeline passed in as a parameter is different than the last pipeline bound
-  /// through this class, binds it and cache it as the last pipeline bound. Does nothing otherwise
-  void bindPipeline(VkPipeline pipeline, const util::SpvModuleInfo* info);
+  /// through this class, binds it and cache it as the last pipeline bound. Does nothing otherwise.
+  /// When `state` is provided, descriptor sets that stay valid across the pipeline switch under
+  /// the Vulkan pipeline layout compatibility rules (identical descriptor set layouts for all
+  /// lower-numbered sets and identical push constant ranges) are not re-dirtied, so material-only
+  /// pipeline switches do not reallocate and rebind unchanged sets
+  void bindPipeline(VkPipeline pipeline,
+                    const util::SpvModuleInfo* info,
+                    const PipelineState* state = nullptr);
+
+  /// @brief Returns the Vulkan buffer bound as a storage buffer at `index`, or VK_NULL_HANDLE
+  /// when none is bound. Used by the compute encoder for inter-dispatch hazard tracking
+  VkBuffer boundStorageBuffer(uint32_t index) const {
+    return index < IGL_UNIFORM_BLOCKS_BINDING_MAX ? bindingsStorageBuffers_.buffers[index].buffer
+                                                  : VK_NULL_HANDLE;
+  }
+
+  /// @brief Returns the texture bound at `index`, or nullptr when none is bound
+  igl::vulkan::VulkanTexture* boundTexture(uint32_t index) const {
+    return index < IGL_TEXTURE_SAMPLERS_MAX ? bindingsTextures_.textures[index] : nullptr;
+  }
 
  private:
   friend class VulkanContext;
@@ -90,14 +137,25 @@ class ResourcesBinder final {
     DirtyFlagBits_StorageBuffers = 1 << 2,
   };
 
+ private:
+  /// @brief Number of descriptor sets whose layout compatibility is tracked across pipeline
+  /// switches: kBindPoint_CombinedImageSamplers, kBindPoint_BuffersUniform and
+  /// kBindPoint_BuffersStorage. The bindless set is managed separately by the encoders
+  static constexpr uint32_t kNumTrackedSets = 3;
+
  private:
   const VulkanContext& ctx_;
   VkCommandBuffer cmdBuffer_ = VK_NULL_HANDLE;
   VkPipeline lastPipelineBound_ = VK_NULL_HANDLE;
+  /// @brief Descriptor set layouts and push constant range of the last pipeline bound, used to
+  /// detect the compatible layout prefix when switching pipelines
+  VkDescriptorSetLayout lastDescriptorSetLayouts_[kNumTrackedSets] = {};
+  VkPushConstantRange lastPushConstantRange_ = {};
   uint32_t isDirtyFlags_ =
       DirtyFlagBits_Textures | DirtyFlagBits_UniformBuffers | DirtyFlagBits_StorageBuffers;
   BindingsTextures bindingsTextures_;
   BindingsBuffers bindingsUniformBuffers_;
+  BindingsInlineUniforms bindingsInlineUniforms_;
   BindingsBuffers bindingsStorageBuffers_;
   VkPipelineBindPoint bindPoint_ = VK_PIPELINE_BIND_POINT_GRAPHICS;
 };
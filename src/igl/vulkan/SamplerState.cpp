@@ -111,9 +111,12 @@ Result SamplerState::create(const SamplerStateDesc& desc) {
 
   const VulkanContext& ctx = device_.getVulkanContext();
 
+  // deduplicated: SamplerStates created from equal descriptors (ignoring the debug name) share
+  // one VkSampler, keyed by the perfect hash of the descriptor
   Result result;
-  sampler_ = ctx.createSampler(
+  sampler_ = ctx.getOrCreateSampler(
       samplerStateDescToVkSamplerCreateInfo(desc, ctx.getVkPhysicalDeviceProperties().limits),
+      std::hash<SamplerStateDesc>()(desc),
       &result,
       desc_.debugName.c_str());
 
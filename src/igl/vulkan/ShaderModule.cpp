@@ -7,6 +7,7 @@
 
 #include <igl/vulkan/ShaderModule.h>
 
+#include <cstddef>
 #include <igl/Shader.h>
 #include <igl/vulkan/Device.h>
 #include <igl/vulkan/VulkanShaderModule.h>
@@ -16,9 +17,30 @@ namespace igl {
 namespace vulkan {
 
 ShaderModule::ShaderModule(ShaderModuleInfo info,
-                           std::shared_ptr<VulkanShaderModule> shaderModule) :
-  IShaderModule(std::move(info)), module_(std::move(shaderModule)) {
+                           std::shared_ptr<VulkanShaderModule> shaderModule,
+                           std::vector<SpecializationConstant> specializationConstants) :
+  IShaderModule(std::move(info)),
+  module_(std::move(shaderModule)),
+  specializationConstants_(std::move(specializationConstants)) {
   IGL_ASSERT(module_);
+
+  // Build the VkSpecializationInfo once; specializationConstants_ doubles as the data blob since
+  // each constant's value is a tightly packed 32-bit pattern
+  specializationEntries_.reserve(specializationConstants_.size());
+  for (size_t i = 0; i != specializationConstants_.size(); i++) {
+    specializationEntries_.push_back(VkSpecializationMapEntry{
+        specializationConstants_[i].id,
+        static_cast<uint32_t>(i * sizeof(SpecializationConstant) +
+                              offsetof(SpecializationConstant, value)),
+        sizeof(uint32_t),
+    });
+  }
+  specializationInfo_ = {
+      static_cast<uint32_t>(specializationEntries_.size()),
+      specializationEntries_.data(),
+      specializationConstants_.size() * sizeof(SpecializationConstant),
+      specializationConstants_.data(),
+  };
 }
 
 VkShaderModule ShaderModule::getVkShaderModule(const std::shared_ptr<IShaderModule>& shaderModule) {
@@ -29,6 +51,13 @@ VkShaderModule ShaderModule::getVkShaderModule(const std::shared_ptr<IShaderModu
   return sm ? sm->module_->getVkShaderModule() : VK_NULL_HANDLE;
 }
 
+const VkSpecializationInfo* ShaderModule::getSpecializationInfo(
+    const std::shared_ptr<IShaderModule>& shaderModule) {
+  const ShaderModule* sm = static_cast<ShaderModule*>(shaderModule.get());
+  return (sm != nullptr && !sm->specializationConstants_.empty()) ? &sm->specializationInfo_
+                                                                  : nullptr;
+}
+
 ShaderStages::ShaderStages(ShaderStagesDesc desc) : IShaderStages(std::move(desc)) {}
 
 ShaderLibrary::ShaderLibrary(std::vector<std::shared_ptr<IShaderModule>> modules) :
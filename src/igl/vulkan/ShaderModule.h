@@ -21,7 +21,9 @@ class VulkanShaderModule;
 /// @brief Implements the igl::IShaderModule interface
 class ShaderModule final : public IShaderModule {
  public:
-  ShaderModule(ShaderModuleInfo info, std::shared_ptr<VulkanShaderModule> shaderModule);
+  ShaderModule(ShaderModuleInfo info,
+               std::shared_ptr<VulkanShaderModule> shaderModule,
+               std::vector<SpecializationConstant> specializationConstants = {});
   ~ShaderModule() override = default;
 
   const VulkanShaderModule& getVulkanShaderModule() const {
@@ -30,8 +32,17 @@ class ShaderModule final : public IShaderModule {
 
   static VkShaderModule getVkShaderModule(const std::shared_ptr<IShaderModule>& shaderModule);
 
+  /// @brief Returns the VkSpecializationInfo for this module's specialization constants, or
+  /// nullptr when there are none. The returned pointer stays valid for the module's lifetime, so
+  /// pipelines can reference it in their shader stage create info.
+  static const VkSpecializationInfo* getSpecializationInfo(
+      const std::shared_ptr<IShaderModule>& shaderModule);
+
  private:
   std::shared_ptr<VulkanShaderModule> module_;
+  std::vector<SpecializationConstant> specializationConstants_;
+  std::vector<VkSpecializationMapEntry> specializationEntries_;
+  VkSpecializationInfo specializationInfo_ = {};
 };
 
 /// @brief Implements the igl::IShaderStages interface
@@ -34,6 +34,13 @@ void SyncManager::acquireNext() noexcept {
 
   // Wait for the current buffer to become available
   ctx_.immediate_->wait(submitHandles_[currentIndex_]);
+
+  // The frame this slot previously tracked has fully retired; bulk-recycle the descriptor pools
+  // it used so descriptor memory stays bounded under churn.
+  ctx_.retireFrameDescriptorPools();
+
+  // ...and hand its uniform ring region back for reuse by the new frame
+  ctx_.advanceFrameUniformRing();
 }
 
 void SyncManager::markSubmitted(SubmitHandle handle) noexcept {
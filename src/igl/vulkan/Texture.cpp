@@ -5,6 +5,7 @@
  * LICENSE file in the root directory of this source tree.
  */
 
+#include <algorithm>
 #include <igl/IGLSafeC.h>
 #include <igl/vulkan/CommandBuffer.h>
 #include <igl/vulkan/Common.h>
@@ -19,6 +20,31 @@
 namespace igl {
 namespace vulkan {
 
+namespace {
+
+/// Tracks the staging submission covering an uploadAsync() batch. Uploads go through a single
+/// in-order queue, so this submission completing implies every earlier upload has completed too
+class StagingUploadToken final : public ITextureUploadToken {
+ public:
+  StagingUploadToken(VulkanStagingDevice& stagingDevice,
+                     VulkanImmediateCommands::SubmitHandle handle) :
+    stagingDevice_(stagingDevice), handle_(handle) {}
+
+  [[nodiscard]] bool isCompleted() const final {
+    return stagingDevice_.isUploadComplete(handle_);
+  }
+
+  void wait() final {
+    stagingDevice_.waitUpload(handle_);
+  }
+
+ private:
+  VulkanStagingDevice& stagingDevice_;
+  VulkanImmediateCommands::SubmitHandle handle_;
+};
+
+} // namespace
+
 Texture::Texture(const igl::vulkan::Device& device, TextureFormat format) :
   ITexture(format), device_(device) {}
 
@@ -80,12 +106,28 @@ Result Texture::create(const TextureDesc& desc) {
   VkImageUsageFlags usageFlags =
       (desc_.storage == ResourceStorage::Private) ? VK_IMAGE_USAGE_TRANSFER_DST_BIT : 0;
 
+  const bool isSparse = (desc_.usage & TextureDesc::TextureUsageBits::Sparse) != 0;
+  const bool isShareable = (desc_.usage & TextureDesc::TextureUsageBits::Shareable) != 0;
+
   // On M1 Macs, depth texture has to be ResourceStorage::Private.
-  if (!ctx.useStagingForBuffers_ && desc_.storage == ResourceStorage::Private &&
+  if (!ctx.useStagingForBuffers_ && desc_.storage == ResourceStorage::Private && !isSparse &&
       !getProperties().isDepthOrStencil()) {
     desc_.storage = ResourceStorage::Shared;
   }
 
+  const bool isMemoryless = desc_.storage == ResourceStorage::Memoryless;
+  if (isMemoryless) {
+    if (!IGL_VERIFY(desc_.usage & TextureDesc::TextureUsageBits::Attachment)) {
+      return Result(Result::Code::Unsupported,
+                    "Memoryless textures must have TextureUsageBits::Attachment");
+    }
+    if (!IGL_VERIFY((desc_.usage & (TextureDesc::TextureUsageBits::Sampled |
+                                    TextureDesc::TextureUsageBits::Storage)) == 0)) {
+      return Result(Result::Code::Unsupported,
+                    "Memoryless textures cannot be sampled or used for storage");
+    }
+  }
+
   if (desc_.usage & TextureDesc::TextureUsageBits::Sampled) {
     usageFlags |= VK_IMAGE_USAGE_SAMPLED_BIT;
   }
@@ -94,12 +136,37 @@ Result Texture::create(const TextureDesc& desc) {
     usageFlags |= VK_IMAGE_USAGE_STORAGE_BIT;
   }
   if (desc_.usage & TextureDesc::TextureUsageBits::Attachment) {
-    usageFlags |= getProperties().isDepthOrStencil() ? VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT
-                                                     : VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+    // INPUT_ATTACHMENT lets multisampled color attachments be read back as a subpass input by a
+    // programmable resolve pass (see RenderPassDesc::colorResolveShaderStages)
+    usageFlags |= getProperties().isDepthOrStencil()
+                      ? VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT
+                      : (VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT |
+                         VK_IMAGE_USAGE_INPUT_ATTACHMENT_BIT);
   }
 
-  // For now, always set this flag so we can read it back
-  usageFlags |= VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+  if (isMemoryless) {
+    // transient attachments are never read back, copied, or sampled, so the intermediate data
+    // (e.g. 4xMSAA color/depth that is resolved on store) can stay in tile memory on tiled GPUs
+    usageFlags |= VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT;
+  } else {
+    // For now, always set this flag so we can read it back
+    usageFlags |= VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+  }
+
+  if (isSparse) {
+    const VkPhysicalDeviceFeatures& features = ctx.getVkPhysicalDeviceFeatures2().features;
+    if (!features.sparseBinding || !features.sparseResidencyImage2D) {
+      return Result(Result::Code::Unsupported,
+                    "Sparse image residency is not supported by the physical device");
+    }
+    if (!IGL_VERIFY(type == TextureType::TwoD || type == TextureType::TwoDArray)) {
+      return Result(Result::Code::Unsupported,
+                    "Sparse textures are only supported for 2D and 2D array textures");
+    }
+    if (!IGL_VERIFY(desc_.storage == ResourceStorage::Private)) {
+      return Result(Result::Code::Unsupported, "Sparse textures must use ResourceStorage::Private");
+    }
+  }
 
   IGL_ASSERT_MSG(usageFlags != 0, "Invalid usage flags");
 
@@ -141,20 +208,52 @@ Result Texture::create(const TextureDesc& desc) {
     return Result(Result::Code::Unimplemented, "Unimplemented or unsupported texture type.");
   }
 
+  if (isSparse) {
+    createFlags |= VK_IMAGE_CREATE_SPARSE_BINDING_BIT | VK_IMAGE_CREATE_SPARSE_RESIDENCY_BIT;
+  }
+
   Result result;
-  auto image = ctx.createImage(
-      imageType,
-      VkExtent3D{(uint32_t)desc_.width, (uint32_t)desc_.height, (uint32_t)desc_.depth},
-      vkFormat,
-      (uint32_t)desc_.numMipLevels,
-      arrayLayerCount,
-      VK_IMAGE_TILING_OPTIMAL,
-      usageFlags,
-      memFlags,
-      createFlags,
-      samples,
-      &result,
-      debugNameImage.c_str());
+  std::shared_ptr<VulkanImage> image;
+  if (isShareable) {
+    if (!IGL_VERIFY(!isSparse && !isMemoryless)) {
+      return Result(Result::Code::Unsupported,
+                    "Shareable textures cannot be sparse or memoryless");
+    }
+#if IGL_PLATFORM_WIN || IGL_PLATFORM_LINUX || IGL_PLATFORM_ANDROID
+    // the memory is allocated as an exportable external memory object so other devices (or
+    // processes) can import it; see PlatformDevice::getTextureExportInfo()
+    image = VulkanImage::createWithExportMemory(
+        ctx,
+        ctx.getVkDevice(),
+        VkExtent3D{(uint32_t)desc_.width, (uint32_t)desc_.height, (uint32_t)desc_.depth},
+        imageType,
+        vkFormat,
+        (uint32_t)desc_.numMipLevels,
+        arrayLayerCount,
+        VK_IMAGE_TILING_OPTIMAL,
+        usageFlags,
+        createFlags,
+        samples,
+        debugNameImage.c_str());
+#else
+    return Result(Result::Code::Unsupported,
+                  "Shareable textures are not supported on this platform");
+#endif // IGL_PLATFORM_WIN || IGL_PLATFORM_LINUX || IGL_PLATFORM_ANDROID
+  } else {
+    image = ctx.createImage(
+        imageType,
+        VkExtent3D{(uint32_t)desc_.width, (uint32_t)desc_.height, (uint32_t)desc_.depth},
+        vkFormat,
+        (uint32_t)desc_.numMipLevels,
+        arrayLayerCount,
+        VK_IMAGE_TILING_OPTIMAL,
+        usageFlags,
+        memFlags,
+        createFlags,
+        samples,
+        &result,
+        debugNameImage.c_str());
+  }
   if (!IGL_VERIFY(result.isOk())) {
     return result;
   }
@@ -206,12 +305,132 @@ Result Texture::uploadInternal(TextureType /*type*/,
   }
 
   const VulkanContext& ctx = device_.getVulkanContext();
+
+  // Identical bytes re-uploaded into the same range (glyph atlases, UI images) are dropped before
+  // they reach the staging device. Textures the GPU can write to (attachments, storage images)
+  // cannot trust a CPU-side memo of their contents and always upload
+  const bool gpuCanWrite = (desc_.usage & (TextureDesc::TextureUsageBits::Attachment |
+                                           TextureDesc::TextureUsageBits::Storage)) != 0;
+  if (ctx.config_.enableUploadDeduplication && !gpuCanWrite) {
+    const size_t sizeInBytes = getProperties().getBytesPerRange(range, bytesPerRow);
+    if (uploadDedup_.isDuplicate(
+            range, bytesPerRow, UploadDeduplicator::hashBytes(data, sizeInBytes))) {
+      return Result();
+    }
+  }
+
   ctx.stagingDevice_->imageData(
       texture_->getVulkanImage(), desc_.type, range, getProperties(), bytesPerRow, data);
 
   return Result();
 }
 
+std::shared_ptr<ITextureUploadToken> Texture::uploadAsync(
+    const TextureUploadDesc* IGL_NONNULL uploads,
+    size_t count,
+    Result* IGL_NULLABLE outResult) const {
+  Result result;
+  for (size_t i = 0; i < count; ++i) {
+    const auto uploadResult = upload(uploads[i].range, uploads[i].data, uploads[i].bytesPerRow);
+    if (!uploadResult.isOk() && result.isOk()) {
+      result = uploadResult;
+    }
+  }
+  Result::setResult(outResult, result);
+  if (!result.isOk()) {
+    return nullptr;
+  }
+
+  VulkanStagingDevice& stagingDevice = *device_.getVulkanContext().stagingDevice_;
+  return std::make_shared<StagingUploadToken>(stagingDevice, stagingDevice.getLastUploadHandle());
+}
+
+std::shared_ptr<ITexture> Texture::createView(const TextureViewDesc& desc,
+                                              Result* IGL_NULLABLE outResult) {
+  if (!IGL_VERIFY(texture_)) {
+    Result::setResult(
+        outResult, Result::Code::InvalidOperation, "The texture has not been created");
+    return nullptr;
+  }
+
+  const uint32_t numVkLayers = getNumVkLayers();
+  const uint32_t numMipLevels =
+      desc.numMipLevels == 0 ? desc_.numMipLevels - desc.mipLevel : desc.numMipLevels;
+  const uint32_t numLayers = desc.numLayers == 0 ? numVkLayers - desc.layer : desc.numLayers;
+  if (desc.mipLevel >= desc_.numMipLevels || desc.mipLevel + numMipLevels > desc_.numMipLevels ||
+      desc.layer >= numVkLayers || desc.layer + numLayers > numVkLayers) {
+    Result::setResult(outResult,
+                      Result::Code::ArgumentOutOfRange,
+                      "The view range is outside the parent texture");
+    return nullptr;
+  }
+
+  const TextureFormat format = desc.format == TextureFormat::Invalid ? desc_.format : desc.format;
+
+  const VulkanContext& ctx = device_.getVulkanContext();
+  const VkFormat vkFormat = TextureFormatProperties::fromTextureFormat(format).isDepthOrStencil()
+                                ? ctx.getClosestDepthStencilFormat(format)
+                                : textureFormatToVkFormat(format);
+
+  // a single-layer view of an array or cube texture becomes a plain 2D texture so it can be used
+  // as a color attachment and sampled through sampler2D
+  TextureType viewType = desc_.type;
+  if ((viewType == TextureType::TwoDArray || viewType == TextureType::Cube) && numLayers == 1) {
+    viewType = TextureType::TwoD;
+  }
+  VkImageViewType vkViewType = VK_IMAGE_VIEW_TYPE_2D;
+  switch (viewType) {
+  case TextureType::TwoD:
+    vkViewType = VK_IMAGE_VIEW_TYPE_2D;
+    break;
+  case TextureType::TwoDArray:
+    vkViewType = VK_IMAGE_VIEW_TYPE_2D_ARRAY;
+    break;
+  case TextureType::Cube:
+    vkViewType = VK_IMAGE_VIEW_TYPE_CUBE;
+    break;
+  case TextureType::ThreeD:
+    vkViewType = VK_IMAGE_VIEW_TYPE_3D;
+    break;
+  default:
+    Result::setResult(outResult, Result::Code::Unimplemented, "Unsupported texture type");
+    return nullptr;
+  }
+
+  VulkanImage& image = texture_->getVulkanImage();
+  std::unique_ptr<VulkanImageView> imageView =
+      image.createImageView(vkViewType,
+                            vkFormat,
+                            image.getImageAspectFlags(),
+                            desc.mipLevel,
+                            numMipLevels,
+                            desc.layer,
+                            numLayers,
+                            desc.debugName.c_str());
+  if (!IGL_VERIFY(imageView)) {
+    Result::setResult(outResult, Result::Code::InvalidOperation, "Cannot create VulkanImageView");
+    return nullptr;
+  }
+
+  // the view shares the parent's VulkanImage (and thus its layout tracking) but receives its own
+  // bindless slot through VulkanContext::createTexture()
+  std::shared_ptr<VulkanTexture> vkTexture = ctx.createTexture(
+      texture_->getSharedVulkanImage(), std::move(imageView), desc.debugName.c_str());
+
+  TextureDesc viewDesc = desc_;
+  viewDesc.format = format;
+  viewDesc.type = viewType;
+  viewDesc.width = std::max<size_t>(desc_.width >> desc.mipLevel, 1);
+  viewDesc.height = std::max<size_t>(desc_.height >> desc.mipLevel, 1);
+  viewDesc.depth = std::max<size_t>(desc_.depth >> desc.mipLevel, 1);
+  viewDesc.numMipLevels = numMipLevels;
+  viewDesc.numLayers = viewType == TextureType::TwoDArray ? numLayers : 1;
+  viewDesc.debugName = desc.debugName;
+
+  Result::setOk(outResult);
+  return std::make_shared<Texture>(device_, std::move(vkTexture), std::move(viewDesc));
+}
+
 Dimensions Texture::getDimensions() const {
   return Dimensions{desc_.width, desc_.height, desc_.depth};
 }
@@ -243,6 +462,8 @@ uint32_t Texture::getNumMipLevels() const {
 
 void Texture::generateMipmap(ICommandQueue& /*cmdQueue*/) const {
   if (desc_.numMipLevels > 1) {
+    // the blits overwrite mips 1..N on the GPU, so the upload dedup memo is stale for them
+    uploadDedup_.invalidate();
     const auto& ctx = device_.getVulkanContext();
     const auto& wrapper = ctx.immediate_->acquire();
     texture_->getVulkanImage().generateMipmap(wrapper.cmdBuf_);
@@ -251,6 +472,7 @@ void Texture::generateMipmap(ICommandQueue& /*cmdQueue*/) const {
 }
 
 void Texture::generateMipmap(ICommandBuffer& cmdBuffer) const {
+  uploadDedup_.invalidate();
   auto& vkCmdBuffer = static_cast<vulkan::CommandBuffer&>(cmdBuffer);
   texture_->getVulkanImage().generateMipmap(vkCmdBuffer.getVkCommandBuffer());
 }
@@ -316,5 +538,48 @@ uint32_t Texture::getNumVkLayers() const {
   return desc_.type == TextureType::Cube ? 6u : static_cast<uint32_t>(desc_.numLayers);
 }
 
+Result Texture::bindSparseRange(const TextureRangeDesc& range) {
+  if (!IGL_VERIFY(texture_)) {
+    return Result(Result::Code::InvalidOperation, "The texture has not been created");
+  }
+  return texture_->getVulkanImage().bindSparseRegion(
+      VkOffset3D{(int32_t)range.x, (int32_t)range.y, (int32_t)range.z},
+      VkExtent3D{(uint32_t)range.width, (uint32_t)range.height, (uint32_t)range.depth},
+      (uint32_t)range.mipLevel,
+      (uint32_t)range.layer,
+      true);
+}
+
+Result Texture::unbindSparseRange(const TextureRangeDesc& range) {
+  if (!IGL_VERIFY(texture_)) {
+    return Result(Result::Code::InvalidOperation, "The texture has not been created");
+  }
+  return texture_->getVulkanImage().bindSparseRegion(
+      VkOffset3D{(int32_t)range.x, (int32_t)range.y, (int32_t)range.z},
+      VkExtent3D{(uint32_t)range.width, (uint32_t)range.height, (uint32_t)range.depth},
+      (uint32_t)range.mipLevel,
+      (uint32_t)range.layer,
+      false);
+}
+
+bool Texture::isSparseRangeResident(const TextureRangeDesc& range) const {
+  if (!texture_) {
+    return false;
+  }
+  return texture_->getVulkanImage().isSparseRegionResident(
+      VkOffset3D{(int32_t)range.x, (int32_t)range.y, (int32_t)range.z},
+      VkExtent3D{(uint32_t)range.width, (uint32_t)range.height, (uint32_t)range.depth},
+      (uint32_t)range.mipLevel,
+      (uint32_t)range.layer);
+}
+
+Dimensions Texture::getSparseTileSize() const {
+  if (!texture_) {
+    return Dimensions{0, 0, 0};
+  }
+  const VkExtent3D granularity = texture_->getVulkanImage().sparseTileGranularity_;
+  return Dimensions{granularity.width, granularity.height, granularity.depth};
+}
+
 } // namespace vulkan
 } // namespace igl
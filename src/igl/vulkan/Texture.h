@@ -11,6 +11,7 @@
 #include <igl/Framebuffer.h>
 #include <igl/Texture.h>
 #include <igl/vulkan/Common.h>
+#include <igl/vulkan/UploadDeduplicator.h>
 
 #include <vector>
 
@@ -54,6 +55,21 @@ class Texture final : public ITexture {
   bool isRequiredGenerateMipmap() const override;
   uint64_t getTextureId() const override;
   bool isSwapchainTexture() const override;
+
+  /// @brief Performs the uploads through the staging device and returns a token tracking the last
+  /// staging submission. Uploads go through a single in-order queue, so that submission completing
+  /// implies the whole batch has landed on the GPU
+  [[nodiscard]] std::shared_ptr<ITextureUploadToken> uploadAsync(
+      const TextureUploadDesc* IGL_NONNULL uploads,
+      size_t count,
+      Result* IGL_NULLABLE outResult) const override;
+
+  /// @brief Creates a zero-copy view: a new VkImageView over the parent's VkImage with its own
+  /// bindless slot. The shared VulkanImage keeps the storage (and its layout tracking) alive and
+  /// consistent for both textures
+  [[nodiscard]] std::shared_ptr<ITexture> createView(const TextureViewDesc& desc,
+                                                     Result* IGL_NULLABLE outResult) override;
+
   VkFormat getVkFormat() const;
 
   VkImageView getVkImageView() const;
@@ -72,6 +88,25 @@ class Texture final : public ITexture {
 
   uint32_t getNumVkLayers() const;
 
+  /** @brief Makes the tiles covered by `range` resident (backed by device memory), for textures
+   * created with `TextureUsageBits::Sparse`. The range is expanded to whole sparse tiles (see
+   * `getSparseTileSize()`) and clamped to the mip dimensions. The residency change is applied
+   * synchronously on the graphics queue, so call this between frames from the thread that submits
+   * command buffers. Mip levels inside the mip tail are always resident
+   */
+  Result bindSparseRange(const TextureRangeDesc& range);
+
+  /// @brief Releases the device memory backing the tiles covered by `range`. Reading an unbound
+  /// region from a shader returns undefined data (or zeroes with the sparseResidencyStrict
+  /// feature). Mip levels inside the mip tail cannot be unbound
+  Result unbindSparseRange(const TextureRangeDesc& range);
+
+  /// @brief Returns true when every sparse tile covered by `range` is resident
+  bool isSparseRangeResident(const TextureRangeDesc& range) const;
+
+  /// @brief Returns the sparse tile dimensions in texels, or zeroes when the texture is not sparse
+  Dimensions getSparseTileSize() const;
+
  private:
   /// @brief Creates the resource on the device given the properties in `desc`. This function should
   /// only be called by the `Device` class, from its `vulkan::Device::createTexture()`
@@ -93,6 +128,10 @@ class Texture final : public ITexture {
   std::shared_ptr<VulkanTexture> texture_;
   mutable std::vector<std::unique_ptr<VulkanImageView>> imageViewsForFramebufferMono_;
   mutable std::vector<std::unique_ptr<VulkanImageView>> imageViewsForFramebufferStereo_;
+
+  // content-hash memo for VulkanContextConfig::enableUploadDeduplication; only consulted for
+  // textures the GPU cannot write to (no Attachment/Storage usage), @see uploadInternal()
+  mutable UploadDeduplicator uploadDedup_;
 };
 
 } // namespace vulkan
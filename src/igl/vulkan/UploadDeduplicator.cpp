@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <igl/vulkan/UploadDeduplicator.h>
+
+#include <cstring>
+
+namespace igl {
+namespace vulkan {
+namespace {
+
+bool rangesOverlap(const TextureRangeDesc& a, const TextureRangeDesc& b) {
+  const auto intersects = [](size_t aStart, size_t aCount, size_t bStart, size_t bCount) {
+    return aStart < bStart + bCount && bStart < aStart + aCount;
+  };
+  if (!intersects(a.mipLevel, a.numMipLevels, b.mipLevel, b.numMipLevels) ||
+      !intersects(a.layer, a.numLayers, b.layer, b.numLayers) ||
+      !intersects(a.face, a.numFaces, b.face, b.numFaces)) {
+    return false;
+  }
+  // x/y/z are expressed at the range's first mip level; once multiple mip levels are involved the
+  // coordinates of the two ranges are not directly comparable, so be conservative
+  if (a.numMipLevels > 1 || b.numMipLevels > 1) {
+    return true;
+  }
+  return intersects(a.x, a.width, b.x, b.width) && intersects(a.y, a.height, b.y, b.height) &&
+         intersects(a.z, a.depth, b.z, b.depth);
+}
+
+} // namespace
+
+uint64_t UploadDeduplicator::hashBytes(const void* data, size_t sizeInBytes) {
+  const uint8_t* bytes = static_cast<const uint8_t*>(data);
+  size_t remaining = sizeInBytes;
+  uint64_t hash = 0xcbf29ce484222325ull;
+  while (remaining >= sizeof(uint64_t)) {
+    uint64_t word = 0;
+    memcpy(&word, bytes, sizeof(word));
+    hash ^= word;
+    hash *= 0x100000001b3ull;
+    bytes += sizeof(word);
+    remaining -= sizeof(word);
+  }
+  while (remaining > 0) {
+    hash ^= *bytes++;
+    hash *= 0x100000001b3ull;
+    remaining--;
+  }
+  // mix the length in so that ranges of repeated content with different sizes do not collide
+  hash ^= static_cast<uint64_t>(sizeInBytes);
+  hash *= 0x100000001b3ull;
+  return hash;
+}
+
+bool UploadDeduplicator::isDuplicate(const TextureRangeDesc& range,
+                                     size_t bytesPerRow,
+                                     uint64_t contentHash) {
+  const std::lock_guard<std::mutex> lock(mutex_);
+
+  for (const Entry& entry : entries_) {
+    if (entry.valid && entry.contentHash == contentHash && entry.bytesPerRow == bytesPerRow &&
+        entry.range == range) {
+      return true;
+    }
+  }
+
+  // this upload overwrites whatever it touches, so any remembered range it overlaps no longer
+  // describes the resource contents
+  for (Entry& entry : entries_) {
+    if (entry.valid && rangesOverlap(entry.range, range)) {
+      entry.valid = false;
+    }
+  }
+
+  entries_[nextEntry_] = Entry{range, bytesPerRow, contentHash, true};
+  nextEntry_ = (nextEntry_ + 1) % kNumEntries;
+  return false;
+}
+
+bool UploadDeduplicator::isDuplicate(uint64_t offset, uint64_t sizeInBytes, uint64_t contentHash) {
+  return isDuplicate(TextureRangeDesc::new1D(offset, sizeInBytes), 0, contentHash);
+}
+
+void UploadDeduplicator::invalidate() {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  for (Entry& entry : entries_) {
+    entry.valid = false;
+  }
+}
+
+} // namespace vulkan
+} // namespace igl
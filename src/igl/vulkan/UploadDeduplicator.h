@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+#include <igl/Texture.h>
+
+namespace igl {
+namespace vulkan {
+
+/// @brief Opt-in content-hash memo for repeated uploads
+/// (VulkanContextConfig::enableUploadDeduplication). UI-heavy workloads re-upload identical
+/// glyph/image bytes from different call sites every frame; each resource remembers the content
+/// hashes of its last few uploads, and an upload whose destination range and content hash both
+/// match a remembered entry is dropped before it reaches the staging device. An upload that
+/// overlaps a remembered range without matching it exactly evicts that entry, so the memo never
+/// claims content that a later write has partially overwritten.
+class UploadDeduplicator final {
+ public:
+  /// @brief 64-bit FNV-1a folded over 8-byte words (plus a byte-wise tail), with the length mixed
+  /// in last. Word-wide folding keeps the hash cheap enough for multi-megabyte image uploads
+  static uint64_t hashBytes(const void* data, size_t sizeInBytes);
+
+  /// @brief Returns true when an upload into `range` (with the given row pitch) and matching
+  /// content hash is already remembered. Otherwise evicts every remembered entry overlapping
+  /// `range`, remembers the new upload and returns false
+  bool isDuplicate(const TextureRangeDesc& range, size_t bytesPerRow, uint64_t contentHash);
+
+  /// @brief Buffer flavor: the byte range [offset, offset + sizeInBytes) is tracked as a 1D range
+  bool isDuplicate(uint64_t offset, uint64_t sizeInBytes, uint64_t contentHash);
+
+  /// @brief Forgets all remembered uploads. Call whenever the resource contents can change
+  /// through any path other than upload(), e.g. when a buffer is mapped for writing
+  void invalidate();
+
+ private:
+  struct Entry {
+    TextureRangeDesc range;
+    size_t bytesPerRow = 0;
+    uint64_t contentHash = 0;
+    bool valid = false;
+  };
+  // uploads remembered per resource; enough for a glyph atlas alternating between a handful of
+  // disjoint dirty regions (or a cube texture uploaded face by face) without an unbounded history
+  static constexpr size_t kNumEntries = 8;
+
+  std::mutex mutex_; // upload() can be called from loader threads
+  Entry entries_[kNumEntries];
+  size_t nextEntry_ = 0;
+};
+
+} // namespace vulkan
+} // namespace igl
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <igl/vulkan/VulkanBarrierBatcher.h>
+
+#include <igl/vulkan/VulkanFunctionTable.h>
+
+namespace igl {
+namespace vulkan {
+
+void VulkanBarrierBatcher::addImageBarrier(VkImage image,
+                                           VkAccessFlags srcAccessMask,
+                                           VkAccessFlags dstAccessMask,
+                                           VkImageLayout oldImageLayout,
+                                           VkImageLayout newImageLayout,
+                                           VkPipelineStageFlags srcStageMask,
+                                           VkPipelineStageFlags dstStageMask,
+                                           const VkImageSubresourceRange& subresourceRange) {
+  const VkImageMemoryBarrier barrier = {
+      VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+      nullptr,
+      srcAccessMask,
+      dstAccessMask,
+      oldImageLayout,
+      newImageLayout,
+      VK_QUEUE_FAMILY_IGNORED,
+      VK_QUEUE_FAMILY_IGNORED,
+      image,
+      subresourceRange,
+  };
+  barriers_.push_back(barrier);
+  srcStageMask_ |= srcStageMask;
+  dstStageMask_ |= dstStageMask;
+}
+
+void VulkanBarrierBatcher::flush(const VulkanFunctionTable& vf, VkCommandBuffer cmdBuf) {
+  IGL_PROFILER_FUNCTION_COLOR(IGL_PROFILER_COLOR_TRANSITION);
+
+  if (barriers_.empty()) {
+    return;
+  }
+
+  IGL_VULKAN_HOT_FN(vf, vkCmdPipelineBarrier)(cmdBuf,
+                                              srcStageMask_,
+                                              dstStageMask_,
+                                              0,
+                                              0,
+                                              nullptr,
+                                              0,
+                                              nullptr,
+                                              static_cast<uint32_t>(barriers_.size()),
+                                              barriers_.data());
+
+  barriers_.clear();
+  srcStageMask_ = 0;
+  dstStageMask_ = 0;
+}
+
+} // namespace vulkan
+} // namespace igl
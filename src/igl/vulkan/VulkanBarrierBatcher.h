@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include <igl/vulkan/Common.h>
+#include <igl/vulkan/VulkanHelpers.h>
+
+struct VulkanFunctionTable;
+
+namespace igl {
+namespace vulkan {
+
+/**
+ * @brief Accumulates pending image layout transitions so they can be recorded as a single
+ * `vkCmdPipelineBarrier()` call instead of one call per resource. Encoders batch the transitions
+ * they perform at encode boundaries (e.g. when a render pass starts or ends) and flush them at
+ * once, which gives the driver one synchronization scope to optimize rather than a sequence of
+ * back-to-back barriers. The batcher merges the source and destination stage masks of all the
+ * barriers added to it, which is equivalent to - but not stronger than - executing the accumulated
+ * barriers sequentially
+ */
+class VulkanBarrierBatcher final {
+ public:
+  VulkanBarrierBatcher() = default;
+  ~VulkanBarrierBatcher() = default;
+
+  VulkanBarrierBatcher(const VulkanBarrierBatcher&) = delete;
+  VulkanBarrierBatcher& operator=(const VulkanBarrierBatcher&) = delete;
+
+  /// @brief Adds an image memory barrier to the batch. The barrier is not recorded until `flush()`
+  /// is called
+  void addImageBarrier(VkImage image,
+                       VkAccessFlags srcAccessMask,
+                       VkAccessFlags dstAccessMask,
+                       VkImageLayout oldImageLayout,
+                       VkImageLayout newImageLayout,
+                       VkPipelineStageFlags srcStageMask,
+                       VkPipelineStageFlags dstStageMask,
+                       const VkImageSubresourceRange& subresourceRange);
+
+  /// @brief Records all accumulated barriers into the command buffer as one
+  /// `vkCmdPipelineBarrier()` call and clears the batch. A no-op when the batch is empty
+  void flush(const VulkanFunctionTable& vf, VkCommandBuffer cmdBuf);
+
+  /// @brief Returns true if no barriers have been accumulated since the last flush
+  [[nodiscard]] bool empty() const {
+    return barriers_.empty();
+  }
+
+  /// @brief Number of barriers accumulated since the last flush
+  [[nodiscard]] size_t size() const {
+    return barriers_.size();
+  }
+
+ private:
+  std::vector<VkImageMemoryBarrier> barriers_;
+  /// @brief Union of the source stage masks of all accumulated barriers
+  VkPipelineStageFlags srcStageMask_ = 0;
+  /// @brief Union of the destination stage masks of all accumulated barriers
+  VkPipelineStageFlags dstStageMask_ = 0;
+};
+
+} // namespace vulkan
+} // namespace igl
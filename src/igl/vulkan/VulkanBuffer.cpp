@@ -29,8 +29,17 @@ VulkanBuffer::VulkanBuffer(const VulkanContext& ctx,
 
   IGL_ASSERT(bufferSize > 0);
 
+  // defragmentation moves copy the contents on the GPU, which requires transfer usage on both the
+  // source and the destination buffer
+  const bool isDefragmentable = IGL_VULKAN_USE_VMA && ctx.config_.enableDefragmentation &&
+                                !(memFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) &&
+                                !(usageFlags & VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT_KHR);
+  if (isDefragmentable) {
+    usageFlags_ |= VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+  }
+
   // Initialize Buffer Info
-  const VkBufferCreateInfo ci = ivkGetBufferCreateInfo(bufferSize, usageFlags);
+  const VkBufferCreateInfo ci = ivkGetBufferCreateInfo(bufferSize, usageFlags_);
 
   if (IGL_VULKAN_USE_VMA) {
     VmaAllocationCreateInfo ciAlloc = {};
@@ -40,6 +49,12 @@ VulkanBuffer::VulkanBuffer(const VulkanContext& ctx,
       ciAlloc.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
       ciAlloc.preferredFlags =
           VK_MEMORY_PROPERTY_HOST_COHERENT_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT;
+      if (memFlags & VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT) {
+        // BAR/ReBAR placement: prefer the CPU-visible slice of VRAM; VMA falls back to a plain
+        // upload heap when the device has no such memory type
+        ciAlloc.preferredFlags =
+            VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+      }
       ciAlloc.flags =
           VMA_ALLOCATION_CREATE_MAPPED_BIT | VMA_ALLOCATION_CREATE_HOST_ACCESS_RANDOM_BIT;
     }
@@ -60,8 +75,21 @@ VulkanBuffer::VulkanBuffer(const VulkanContext& ctx,
 
     ciAlloc.usage = VMA_MEMORY_USAGE_AUTO;
 
-    vmaCreateBuffer(
-        (VmaAllocator)ctx_.getVmaAllocator(), &ci, &ciAlloc, &vkBuffer_, &vmaAllocation_, nullptr);
+    if (memFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) {
+      // IBuffer::map() promises base pointers aligned to IBuffer::kMapAlignment (64). The driver
+      // guarantees minMemoryMapAlignment >= 64 for the memory block, so the allocation offset
+      // within the block must preserve that alignment
+      vmaCreateBufferWithAlignment((VmaAllocator)ctx_.getVmaAllocator(),
+                                   &ci,
+                                   &ciAlloc,
+                                   64,
+                                   &vkBuffer_,
+                                   &vmaAllocation_,
+                                   nullptr);
+    } else {
+      vmaCreateBuffer(
+          (VmaAllocator)ctx_.getVmaAllocator(), &ci, &ciAlloc, &vkBuffer_, &vmaAllocation_, nullptr);
+    }
     IGL_ASSERT(vmaAllocation_ != nullptr);
 
     // handle memory-mapped buffers
@@ -98,6 +126,8 @@ VulkanBuffer::VulkanBuffer(const VulkanContext& ctx,
 
   IGL_ASSERT(vkBuffer_ != VK_NULL_HANDLE);
 
+  ctx_.totalBufferAllocatedBytes_.fetch_add(bufferSize_, std::memory_order_relaxed);
+
   // set debug name
   VK_ASSERT(ivkSetDebugObjectName(
       &ctx_.vf_, device_, VK_OBJECT_TYPE_BUFFER, (uint64_t)vkBuffer_, debugName));
@@ -109,11 +139,21 @@ VulkanBuffer::VulkanBuffer(const VulkanContext& ctx,
     vkDeviceAddress_ = ctx_.vf_.vkGetBufferDeviceAddressKHR(device_, &ai);
     IGL_ASSERT(vkDeviceAddress_);
   }
+
+  if (isDefragmentable && vmaAllocation_) {
+    ctx_.registerDefragmentableBuffer(vmaAllocation_, this);
+  }
 }
 
 VulkanBuffer::~VulkanBuffer() {
   IGL_PROFILER_FUNCTION_COLOR(IGL_PROFILER_COLOR_DESTROY);
 
+  ctx_.totalBufferAllocatedBytes_.fetch_sub(bufferSize_, std::memory_order_relaxed);
+
+  if (IGL_VULKAN_USE_VMA && ctx_.config_.enableDefragmentation && vmaAllocation_) {
+    ctx_.unregisterDefragmentableBuffer(vmaAllocation_);
+  }
+
   if (IGL_VULKAN_USE_VMA) {
     if (mappedPtr_) {
       vmaUnmapMemory((VmaAllocator)ctx_.getVmaAllocator(), vmaAllocation_);
@@ -134,6 +174,20 @@ VulkanBuffer::~VulkanBuffer() {
   }
 }
 
+void VulkanBuffer::exchangeDefragmentedBuffer(VkBuffer newBuffer) {
+  IGL_ASSERT(newBuffer != VK_NULL_HANDLE);
+  IGL_ASSERT_MSG(!mappedPtr_ && !vkDeviceAddress_, "Only GPU-only buffers can be moved");
+
+  // the old buffer may still be referenced by command buffers submitted before the
+  // defragmentation pass, so it goes through the usual deferred destruction
+  ctx_.deferredTask(std::packaged_task<void()>(
+      [vf = &ctx_.vf_, device = device_, buffer = vkBuffer_]() {
+        vf->vkDestroyBuffer(device, buffer, nullptr);
+      }));
+
+  vkBuffer_ = newBuffer;
+}
+
 void VulkanBuffer::flushMappedMemory(VkDeviceSize offset, VkDeviceSize size) const {
   if (!IGL_VERIFY(isMapped())) {
     return;
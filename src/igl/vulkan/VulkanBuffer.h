@@ -67,6 +67,14 @@ class VulkanBuffer {
   /// @brief Invalidates the mapped memory range to make it visible to the CPU.
   void invalidateMappedMemory(VkDeviceSize offset, VkDeviceSize size) const;
 
+  /** @brief Called by VulkanContext during a defragmentation pass, after the buffer's contents
+   * have been copied on the GPU into `newBuffer`, which is bound to the allocation's new memory
+   * location. Releases the old VkBuffer through a deferred task and adopts the new handle; the
+   * VmaAllocation handle is unchanged. Only GPU-only buffers without a device address are ever
+   * moved, so no mapped pointers or shader addresses are invalidated.
+   */
+  void exchangeDefragmentedBuffer(VkBuffer newBuffer);
+
   VkBuffer getVkBuffer() const {
     return vkBuffer_;
   }
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <igl/vulkan/VulkanBufferPool.h>
+
+#include <algorithm>
+
+#include <igl/vulkan/VulkanBuffer.h>
+#include <igl/vulkan/VulkanContext.h>
+
+namespace igl {
+namespace vulkan {
+
+VulkanBufferPool::VulkanBufferPool(const VulkanContext& ctx,
+                                   VkBufferUsageFlags usageFlags,
+                                   VkMemoryPropertyFlags memFlags,
+                                   VkDeviceSize alignment,
+                                   VkDeviceSize pageSize,
+                                   const char* debugName) :
+  ctx_(ctx),
+  usageFlags_(usageFlags),
+  memFlags_(memFlags),
+  alignment_(std::max<VkDeviceSize>(alignment, 1u)),
+  pageSize_(pageSize),
+  debugName_(debugName) {}
+
+VulkanBufferPool::Suballocation VulkanBufferPool::allocate(VkDeviceSize size) {
+  IGL_PROFILER_FUNCTION();
+
+  const std::lock_guard<std::mutex> lock(mutex_);
+
+  const VkDeviceSize alignedSize = (size + alignment_ - 1) & ~(alignment_ - 1);
+
+  // first-fit within the existing pages
+  for (auto& page : pages_) {
+    for (auto& block : page.freeList) {
+      if (block.size >= alignedSize) {
+        const Suballocation suballocation = {page.buffer.get(), block.offset, alignedSize};
+        block.offset += alignedSize;
+        block.size -= alignedSize;
+        if (block.size == 0) {
+          page.freeList.erase(page.freeList.begin() + (&block - page.freeList.data()));
+        }
+        return suballocation;
+      }
+    }
+  }
+
+  // no page has enough contiguous free space - create a new one
+  const VkDeviceSize newPageSize = std::max(pageSize_, alignedSize);
+  Result result;
+  auto buffer = ctx_.createBuffer(
+      newPageSize,
+      usageFlags_,
+      memFlags_,
+      &result,
+      IGL_FORMAT("{} - page {}", debugName_.c_str(), pages_.size()).c_str());
+  if (!IGL_VERIFY(result.isOk() && buffer)) {
+    return {};
+  }
+
+  Page page = {std::move(buffer), {}};
+  if (newPageSize > alignedSize) {
+    page.freeList.push_back({alignedSize, newPageSize - alignedSize});
+  }
+  pages_.push_back(std::move(page));
+
+  return {pages_.back().buffer.get(), 0, alignedSize};
+}
+
+void VulkanBufferPool::free(const Suballocation& suballocation) {
+  IGL_PROFILER_FUNCTION();
+
+  if (!suballocation.valid()) {
+    return;
+  }
+
+  const std::lock_guard<std::mutex> lock(mutex_);
+
+  for (auto& page : pages_) {
+    if (page.buffer.get() != suballocation.buffer) {
+      continue;
+    }
+
+    // insert the block keeping the free list sorted by offset
+    auto it = page.freeList.begin();
+    while (it != page.freeList.end() && it->offset < suballocation.offset) {
+      ++it;
+    }
+    it = page.freeList.insert(it, {suballocation.offset, suballocation.size});
+
+    // merge with the next block
+    const auto next = it + 1;
+    if (next != page.freeList.end() && it->offset + it->size == next->offset) {
+      it->size += next->size;
+      it = page.freeList.erase(next) - 1;
+    }
+    // merge with the previous block
+    if (it != page.freeList.begin()) {
+      const auto prev = it - 1;
+      if (prev->offset + prev->size == it->offset) {
+        prev->size += it->size;
+        page.freeList.erase(it);
+      }
+    }
+    return;
+  }
+
+  IGL_ASSERT_MSG(false, "Freeing a suballocation that does not belong to this pool");
+}
+
+} // namespace vulkan
+} // namespace igl
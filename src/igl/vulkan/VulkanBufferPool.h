@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <igl/vulkan/Common.h>
+#include <igl/vulkan/VulkanHelpers.h>
+
+namespace igl {
+namespace vulkan {
+
+class VulkanBuffer;
+class VulkanContext;
+
+/** @brief Suballocates small buffer allocations out of large shared `VkBuffer` pages. Creating one
+ * `VkBuffer` (and one VMA or raw memory allocation) per small uniform buffer wastes memory on
+ * allocation granularity and makes buffer creation a hot path; this pool instead hands out offsets
+ * into pages that are created on demand and kept mapped, so a suballocation costs a free-list
+ * lookup. Suballocations are aligned to the alignment provided at construction (callers should pass
+ * the appropriate `minUniformBufferOffsetAlignment`/`minStorageBufferOffsetAlignment` device
+ * limit). Freed blocks are merged with their neighbors to limit fragmentation. allocate() and
+ * free() serialize on an internal mutex, so buffers can be created from multiple loader threads;
+ * freeing a block that may still be in use by the GPU must be deferred by the caller (see
+ * VulkanContext::deferredTask())
+ */
+class VulkanBufferPool final {
+ public:
+  /// @brief A block handed out by the pool: a pointer to the pool-owned page buffer plus the offset
+  /// and aligned size of the block within it
+  struct Suballocation {
+    VulkanBuffer* buffer = nullptr;
+    VkDeviceSize offset = 0;
+    VkDeviceSize size = 0;
+
+    [[nodiscard]] bool valid() const {
+      return buffer != nullptr;
+    }
+  };
+
+  VulkanBufferPool(const VulkanContext& ctx,
+                   VkBufferUsageFlags usageFlags,
+                   VkMemoryPropertyFlags memFlags,
+                   VkDeviceSize alignment,
+                   VkDeviceSize pageSize,
+                   const char* debugName);
+  ~VulkanBufferPool() = default;
+
+  VulkanBufferPool(const VulkanBufferPool&) = delete;
+  VulkanBufferPool& operator=(const VulkanBufferPool&) = delete;
+
+  /// @brief Returns a block at least `size` bytes large, creating a new page when no existing page
+  /// has enough contiguous free space. Returns an invalid Suballocation when the page buffer could
+  /// not be created
+  [[nodiscard]] Suballocation allocate(VkDeviceSize size);
+
+  /// @brief Returns a block to the free list of its page, merging it with adjacent free blocks
+  void free(const Suballocation& suballocation);
+
+ private:
+  struct FreeBlock {
+    VkDeviceSize offset = 0;
+    VkDeviceSize size = 0;
+  };
+
+  struct Page {
+    std::unique_ptr<VulkanBuffer> buffer;
+    /// @brief Free blocks within the page, sorted by offset
+    std::vector<FreeBlock> freeList;
+  };
+
+ private:
+  const VulkanContext& ctx_;
+  VkBufferUsageFlags usageFlags_ = 0;
+  VkMemoryPropertyFlags memFlags_ = 0;
+  VkDeviceSize alignment_ = 1;
+  VkDeviceSize pageSize_ = 0;
+  std::string debugName_;
+  std::vector<Page> pages_;
+  /// @brief Guards pages_ and their free lists
+  std::mutex mutex_;
+};
+
+} // namespace vulkan
+} // namespace igl
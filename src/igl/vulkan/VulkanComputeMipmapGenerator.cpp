@@ -0,0 +1,275 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <igl/vulkan/VulkanComputeMipmapGenerator.h>
+
+#include <algorithm>
+#include <vector>
+
+#include <igl/vulkan/VulkanContext.h>
+#include <igl/vulkan/VulkanImage.h>
+#include <igl/vulkan/VulkanImageView.h>
+#include <igl/vulkan/VulkanShaderModule.h>
+
+namespace igl {
+namespace vulkan {
+
+namespace {
+
+// one thread per destination texel; each dispatch downsamples one mip level into the next
+const char* kDownsampleShader = R"(
+#version 460
+
+layout (local_size_x = 8, local_size_y = 8, local_size_z = 1) in;
+
+layout (set = 0, binding = 0) uniform sampler2D srcTexture;
+layout (set = 0, binding = 1) uniform writeonly image2D dstImage;
+
+void main() {
+  ivec2 dstSize = imageSize(dstImage);
+  ivec2 xy = ivec2(gl_GlobalInvocationID.xy);
+  if (xy.x >= dstSize.x || xy.y >= dstSize.y) {
+    return;
+  }
+  // a linear tap at the texel center of the destination averages the 2x2 source footprint
+  vec2 uv = (vec2(xy) + vec2(0.5)) / vec2(dstSize);
+  imageStore(dstImage, xy, textureLod(srcTexture, uv, 0.0));
+}
+)";
+
+} // namespace
+
+VulkanComputeMipmapGenerator::VulkanComputeMipmapGenerator(const VulkanContext& ctx) : ctx_(ctx) {
+  IGL_PROFILER_FUNCTION_COLOR(IGL_PROFILER_COLOR_CREATE);
+
+  const VkDevice device = ctx_.getVkDevice();
+
+  std::vector<uint32_t> spirv;
+#if !IGL_VULKAN_NO_GLSLANG
+  const Result result =
+      compileShader(ctx_.vf_, device, VK_SHADER_STAGE_COMPUTE_BIT, kDownsampleShader, spirv);
+
+  if (!IGL_VERIFY(result.isOk())) {
+    // leave the pipeline null - canGenerate() will report the compute path as unavailable
+    return;
+  }
+#else
+  // the built-in downsample shader cannot be compiled without the runtime compiler; leave the
+  // pipeline null so mipmap generation falls back to the vkCmdBlitImage() chain
+  return;
+#endif // !IGL_VULKAN_NO_GLSLANG
+
+  VK_ASSERT(ivkCreateShaderModuleFromSPIRV(
+      &ctx_.vf_, device, spirv.data(), spirv.size() * sizeof(uint32_t), &shaderModule_));
+
+  const VkDescriptorSetLayoutBinding bindings[] = {
+      ivkGetDescriptorSetLayoutBinding(0, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1),
+      ivkGetDescriptorSetLayoutBinding(1, VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, 1),
+  };
+  const VkDescriptorBindingFlags bindingFlags[] = {0, 0};
+  VK_ASSERT(ivkCreateDescriptorSetLayout(
+      &ctx_.vf_, device, 0, IGL_ARRAY_NUM_ELEMENTS(bindings), bindings, bindingFlags, &dsl_));
+
+  const VkPipelineLayoutCreateInfo layoutInfo = ivkGetPipelineLayoutCreateInfo(1, &dsl_, nullptr);
+  VK_ASSERT(ctx_.vf_.vkCreatePipelineLayout(device, &layoutInfo, nullptr, &pipelineLayout_));
+
+  const VkPipelineShaderStageCreateInfo stage =
+      ivkGetPipelineShaderStageCreateInfo(VK_SHADER_STAGE_COMPUTE_BIT, shaderModule_, "main");
+  VK_ASSERT(ivkCreateComputePipeline(
+      &ctx_.vf_, device, ctx_.pipelineCache_, &stage, pipelineLayout_, &pipeline_));
+
+  const VkSamplerCreateInfo samplerInfo =
+      ivkGetSamplerCreateInfo(VK_FILTER_LINEAR,
+                              VK_FILTER_LINEAR,
+                              VK_SAMPLER_MIPMAP_MODE_NEAREST,
+                              VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE,
+                              VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE,
+                              VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE,
+                              0.0f,
+                              0.0f);
+  VK_ASSERT(ctx_.vf_.vkCreateSampler(device, &samplerInfo, nullptr, &sampler_));
+}
+
+VulkanComputeMipmapGenerator::~VulkanComputeMipmapGenerator() {
+  // the GPU may still be generating mipmaps - destroy the pipeline objects when it is done
+  ctx_.deferredTask(std::packaged_task<void()>([vf = &ctx_.vf_,
+                                                device = ctx_.getVkDevice(),
+                                                sampler = sampler_,
+                                                dsl = dsl_,
+                                                layout = pipelineLayout_,
+                                                shaderModule = shaderModule_,
+                                                pipeline = pipeline_]() {
+    vf->vkDestroyPipeline(device, pipeline, nullptr);
+    vf->vkDestroySampler(device, sampler, nullptr);
+    vf->vkDestroyShaderModule(device, shaderModule, nullptr);
+    vf->vkDestroyPipelineLayout(device, layout, nullptr);
+    vf->vkDestroyDescriptorSetLayout(device, dsl, nullptr);
+  }));
+}
+
+bool VulkanComputeMipmapGenerator::canGenerate(const VulkanImage& image) const {
+  constexpr VkImageUsageFlags usageMask = VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_STORAGE_BIT;
+
+  return pipeline_ != VK_NULL_HANDLE && image.type_ == VK_IMAGE_TYPE_2D &&
+         image.samples_ == VK_SAMPLE_COUNT_1_BIT && !image.isDepthOrStencilFormat_ &&
+         image.mipLevels_ > 1 && (image.usageFlags_ & usageMask) == usageMask &&
+         (image.formatProperties_.optimalTilingFeatures & VK_FORMAT_FEATURE_STORAGE_IMAGE_BIT) !=
+             0 &&
+         ctx_.getVkPhysicalDeviceFeatures2().features.shaderStorageImageWriteWithoutFormat ==
+             VK_TRUE;
+}
+
+void VulkanComputeMipmapGenerator::generate(VkCommandBuffer commandBuffer,
+                                            const VulkanImage& image) const {
+  IGL_PROFILER_FUNCTION();
+  IGL_ASSERT(canGenerate(image));
+
+  const VkDevice device = ctx_.getVkDevice();
+
+  ivkCmdBeginDebugUtilsLabel(
+      &ctx_.vf_, commandBuffer, "Generate mipmaps (compute)", kColorGenerateMipmaps.toFloatPtr());
+
+  IGL_SCOPE_EXIT {
+    ivkCmdEndDebugUtilsLabel(&ctx_.vf_, commandBuffer);
+  };
+
+  const VkImageLayout originalImageLayout = image.imageLayout_;
+
+  IGL_ASSERT(originalImageLayout != VK_IMAGE_LAYOUT_UNDEFINED);
+
+  // descriptor sets live until the GPU has executed the dispatches, so allocate them from a
+  // transient per-call pool and destroy the whole pool in a deferred task
+  const uint32_t numSets = (image.mipLevels_ - 1) * image.arrayLayers_;
+  const VkDescriptorPoolSize poolSizes[] = {
+      VkDescriptorPoolSize{VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, numSets},
+      VkDescriptorPoolSize{VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, numSets},
+  };
+  VkDescriptorPool pool = VK_NULL_HANDLE;
+  VK_ASSERT(ivkCreateDescriptorPool(
+      &ctx_.vf_, device, 0, numSets, IGL_ARRAY_NUM_ELEMENTS(poolSizes), poolSizes, &pool));
+
+  // 0: Transition the first mip level - all layers - to VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL
+  // and the remaining levels to VK_IMAGE_LAYOUT_GENERAL for storage writes
+  ivkImageMemoryBarrier(&ctx_.vf_,
+                        commandBuffer,
+                        image.vkImage_,
+                        VK_ACCESS_MEMORY_WRITE_BIT, /* srcAccessMask */
+                        VK_ACCESS_SHADER_READ_BIT, /* dstAccessMask */
+                        originalImageLayout, /* oldImageLayout */
+                        VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, /* newImageLayout */
+                        VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, /* srcStageMask */
+                        VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, /* dstStageMask */
+                        VkImageSubresourceRange{
+                            VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, image.arrayLayers_});
+  ivkImageMemoryBarrier(&ctx_.vf_,
+                        commandBuffer,
+                        image.vkImage_,
+                        0, /* srcAccessMask */
+                        VK_ACCESS_SHADER_WRITE_BIT, /* dstAccessMask */
+                        VK_IMAGE_LAYOUT_UNDEFINED, /* oldImageLayout */
+                        VK_IMAGE_LAYOUT_GENERAL, /* newImageLayout */
+                        VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, /* srcStageMask */
+                        VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, /* dstStageMask */
+                        VkImageSubresourceRange{
+                            VK_IMAGE_ASPECT_COLOR_BIT, 1, image.mipLevels_ - 1, 0,
+                            image.arrayLayers_});
+
+  ctx_.vf_.vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline_);
+
+  // image views are referenced by descriptor sets until the GPU is done; VulkanImageView defers
+  // the destruction of its VkImageView, so collecting them here is enough
+  std::vector<std::unique_ptr<VulkanImageView>> views;
+  views.reserve(static_cast<size_t>(numSets) * 2);
+
+  for (uint32_t layer = 0; layer < image.arrayLayers_; ++layer) {
+    for (uint32_t i = 1; i < image.mipLevels_; ++i) {
+      auto srcView = image.createImageView(VK_IMAGE_VIEW_TYPE_2D,
+                                           image.imageFormat_,
+                                           VK_IMAGE_ASPECT_COLOR_BIT,
+                                           i - 1,
+                                           1,
+                                           layer,
+                                           1,
+                                           "Image View: mipmap downsample source");
+      auto dstView = image.createImageView(VK_IMAGE_VIEW_TYPE_2D,
+                                           image.imageFormat_,
+                                           VK_IMAGE_ASPECT_COLOR_BIT,
+                                           i,
+                                           1,
+                                           layer,
+                                           1,
+                                           "Image View: mipmap downsample destination");
+
+      VkDescriptorSet set = VK_NULL_HANDLE;
+      VK_ASSERT(ivkAllocateDescriptorSet(&ctx_.vf_, device, pool, dsl_, &set));
+
+      const VkDescriptorImageInfo srcInfo = {
+          sampler_, srcView->getVkImageView(), VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL};
+      const VkDescriptorImageInfo dstInfo = {
+          VK_NULL_HANDLE, dstView->getVkImageView(), VK_IMAGE_LAYOUT_GENERAL};
+      const VkWriteDescriptorSet writes[] = {
+          ivkGetWriteDescriptorSet_ImageInfo(
+              set, 0, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1, &srcInfo),
+          ivkGetWriteDescriptorSet_ImageInfo(
+              set, 1, VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, 1, &dstInfo),
+      };
+      ctx_.vf_.vkUpdateDescriptorSets(
+          device, IGL_ARRAY_NUM_ELEMENTS(writes), writes, 0, nullptr);
+
+      IGL_VULKAN_HOT_FN(ctx_.vf_, vkCmdBindDescriptorSets)(commandBuffer,
+                                                           VK_PIPELINE_BIND_POINT_COMPUTE,
+                                                           pipelineLayout_,
+                                                           0,
+                                                           1,
+                                                           &set,
+                                                           0,
+                                                           nullptr);
+
+      const uint32_t dstWidth = std::max(image.extent_.width >> i, 1u);
+      const uint32_t dstHeight = std::max(image.extent_.height >> i, 1u);
+      ctx_.vf_.vkCmdDispatch(commandBuffer, (dstWidth + 7) / 8, (dstHeight + 7) / 8, 1);
+
+      // make the freshly written level readable by the next iteration
+      ivkImageMemoryBarrier(&ctx_.vf_,
+                            commandBuffer,
+                            image.vkImage_,
+                            VK_ACCESS_SHADER_WRITE_BIT, /* srcAccessMask */
+                            VK_ACCESS_SHADER_READ_BIT, /* dstAccessMask */
+                            VK_IMAGE_LAYOUT_GENERAL, /* oldImageLayout */
+                            VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, /* newImageLayout */
+                            VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, /* srcStageMask */
+                            VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, /* dstStageMask */
+                            VkImageSubresourceRange{VK_IMAGE_ASPECT_COLOR_BIT, i, 1, layer, 1});
+
+      views.push_back(std::move(srcView));
+      views.push_back(std::move(dstView));
+    }
+  }
+
+  // transition all levels and layers back to their original layout
+  ivkImageMemoryBarrier(&ctx_.vf_,
+                        commandBuffer,
+                        image.vkImage_,
+                        VK_ACCESS_SHADER_READ_BIT, /* srcAccessMask */
+                        0, /* dstAccessMask */
+                        VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, /* oldImageLayout */
+                        originalImageLayout, /* newImageLayout */
+                        VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, /* srcStageMask */
+                        VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, /* dstStageMask */
+                        VkImageSubresourceRange{
+                            VK_IMAGE_ASPECT_COLOR_BIT, 0, image.mipLevels_, 0,
+                            image.arrayLayers_});
+
+  image.imageLayout_ = originalImageLayout;
+
+  ctx_.deferredTask(std::packaged_task<void()>([vf = &ctx_.vf_, device, pool]() {
+    vf->vkDestroyDescriptorPool(device, pool, nullptr);
+  }));
+}
+
+} // namespace vulkan
+} // namespace igl
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <igl/vulkan/Common.h>
+#include <igl/vulkan/VulkanHelpers.h>
+
+namespace igl {
+namespace vulkan {
+
+class VulkanContext;
+class VulkanImage;
+
+/** @brief Generates mip chains with a compute shader instead of a serial chain of
+ * vkCmdBlitImage() calls. Each mip level is produced by one dispatch that samples the previous
+ * level and writes the next one as a storage image, with compute-to-compute barriers between
+ * levels; on tiled GPUs this avoids the per-level transfer round trips of the blit path.
+ * The pipeline and descriptor set layout are created once; each generate() call allocates its
+ * descriptor sets from a transient pool that is destroyed via VulkanContext::deferredTask() when
+ * the GPU is done with it. Images must be 2D, single-sampled, non-depth/stencil, created with
+ * both sampled and storage usage, and have a format with storage-image support - use
+ * canGenerate() to check, and fall back to VulkanImage::generateMipmap() otherwise.
+ */
+class VulkanComputeMipmapGenerator final {
+ public:
+  explicit VulkanComputeMipmapGenerator(const VulkanContext& ctx);
+  ~VulkanComputeMipmapGenerator();
+
+  VulkanComputeMipmapGenerator(const VulkanComputeMipmapGenerator&) = delete;
+  VulkanComputeMipmapGenerator& operator=(const VulkanComputeMipmapGenerator&) = delete;
+
+  /// @brief Returns true when the generator was initialized successfully and the image can have
+  /// its mip chain generated in compute
+  [[nodiscard]] bool canGenerate(const VulkanImage& image) const;
+
+  /// @brief Records commands generating mip levels 1..N of the image from level 0. The image is
+  /// returned to its original layout. Call canGenerate() first.
+  void generate(VkCommandBuffer commandBuffer, const VulkanImage& image) const;
+
+ private:
+  const VulkanContext& ctx_;
+  VkSampler sampler_ = VK_NULL_HANDLE;
+  VkDescriptorSetLayout dsl_ = VK_NULL_HANDLE;
+  VkPipelineLayout pipelineLayout_ = VK_NULL_HANDLE;
+  VkShaderModule shaderModule_ = VK_NULL_HANDLE;
+  VkPipeline pipeline_ = VK_NULL_HANDLE;
+};
+
+} // namespace vulkan
+} // namespace igl
@@ -5,10 +5,14 @@
  * LICENSE file in the root directory of this source tree.
  */
 
+#include <algorithm>
 #include <array>
+#include <cstdio>
 #include <cstring>
+#include <list>
 #include <memory>
 #include <set>
+#include <tuple>
 #include <vector>
 
 #include <igl/IGLSafeC.h>
@@ -25,9 +29,12 @@
 
 #include <igl/vulkan/Buffer.h>
 #include <igl/vulkan/Device.h>
+#include <igl/vulkan/ResourcesBinder.h>
 #include <igl/vulkan/EnhancedShaderDebuggingStore.h>
 #include <igl/vulkan/SyncManager.h>
 #include <igl/vulkan/VulkanBuffer.h>
+#include <igl/vulkan/VulkanBufferPool.h>
+#include <igl/vulkan/VulkanComputeMipmapGenerator.h>
 #include <igl/vulkan/VulkanContext.h>
 #include <igl/vulkan/VulkanDescriptorSetLayout.h>
 #include <igl/vulkan/VulkanDevice.h>
@@ -35,10 +42,13 @@
 #include <igl/vulkan/VulkanImageView.h>
 #include <igl/vulkan/VulkanPipelineBuilder.h>
 #include <igl/vulkan/VulkanPipelineLayout.h>
+#include <igl/vulkan/VulkanProgrammableResolve.h>
 #include <igl/vulkan/VulkanSampler.h>
 #include <igl/vulkan/VulkanSemaphore.h>
 #include <igl/vulkan/VulkanSwapchain.h>
 #include <igl/vulkan/VulkanTexture.h>
+#include <igl/vulkan/VulkanUniformRingBuffer.h>
+#include <igl/vulkan/VulkanUploadScheduler.h>
 #include <igl/vulkan/VulkanVma.h>
 #include <igl/vulkan/util/SpvReflection.h>
 
@@ -192,6 +202,18 @@ bool validateImageLimits(VkImageType imageType,
   return true;
 }
 
+// Order-dependent 64-bit FNV-1a over the raw binding key words. XOR-folding alone would make the
+// key order- and pairing-independent: swapping two buffers between two binding slots must yield a
+// different hash, or a cache hit would silently bind the wrong descriptor set.
+uint64_t hashBindingKey(const uint64_t* key, uint32_t numKeyWords) {
+  uint64_t hash = 0xcbf29ce484222325ull;
+  for (uint32_t i = 0; i != numKeyWords; i++) {
+    hash ^= key[i];
+    hash *= 0x100000001b3ull;
+  }
+  return hash;
+}
+
 } // namespace
 
 namespace igl {
@@ -204,11 +226,15 @@ class DescriptorPoolsArena final {
                        VkDescriptorType type,
                        VkDescriptorSetLayout dsl,
                        uint32_t numDescriptorsPerDSet,
-                       const char* debugName) :
+                       const char* debugName,
+                       uint32_t numInlineBindingsPerDSet = 0,
+                       uint32_t numInlineBytesPerDSet = 0) :
     vf_(ctx.vf_),
     device_(ctx.getVkDevice()),
     type_(type),
     numDescriptorsPerDSet_(numDescriptorsPerDSet),
+    numInlineBindingsPerDSet_(numInlineBindingsPerDSet),
+    numInlineBytesPerDSet_(numInlineBytesPerDSet),
     dsl_(dsl) {
     IGL_ASSERT(debugName);
     dpDebugName_ = IGL_FORMAT("Descriptor Pool: {}", debugName ? debugName : "");
@@ -221,6 +247,9 @@ class DescriptorPoolsArena final {
     for (const auto& p : extinct_) {
       vf_.vkDestroyDescriptorPool(device_, p.pool_, nullptr);
     }
+    for (VkDescriptorPool p : ready_) {
+      vf_.vkDestroyDescriptorPool(device_, p, nullptr);
+    }
   }
   [[nodiscard]] VkDescriptorSetLayout getVkDescriptorSetLayout() const {
     return dsl_;
@@ -236,6 +265,65 @@ class DescriptorPoolsArena final {
     numRemainingDSetsInPool_--;
     return dset;
   }
+  /// @brief Returns a previously written descriptor set for the given bindings key, or
+  /// VK_NULL_HANDLE if there is no such set. The full key is compared on every lookup - the hash
+  /// is just the bucket index, a collision must not re-bind a set written for different resources.
+  /// A hit refreshes the entry in the LRU list.
+  [[nodiscard]] VkDescriptorSet findCachedDescriptorSet(uint64_t bindingsHash,
+                                                        const uint64_t* key,
+                                                        uint32_t numKeyWords) {
+    const auto it = cache_.find(bindingsHash);
+    if (it == cache_.end()) {
+      return VK_NULL_HANDLE;
+    }
+    const CachedDescriptorSet& cached = it->second;
+    if (cached.key_.size() != numKeyWords ||
+        memcmp(cached.key_.data(), key, numKeyWords * sizeof(uint64_t)) != 0) {
+      return VK_NULL_HANDLE;
+    }
+    lru_.splice(lru_.begin(), lru_, cached.lruIt_);
+    return cached.dset_;
+  }
+  /// @brief Stores a freshly written descriptor set under the given bindings key so that the
+  /// next frame using the same combination of resources can re-bind it without a new
+  /// vkUpdateDescriptorSets() call.
+  void cacheDescriptorSet(uint64_t bindingsHash,
+                          const uint64_t* key,
+                          uint32_t numKeyWords,
+                          VkDescriptorSet dset) {
+    const auto it = cache_.find(bindingsHash);
+    if (it != cache_.end()) {
+      // a different key hashed into an occupied slot - replace the old entry and its LRU node
+      lru_.erase(it->second.lruIt_);
+      cache_.erase(it);
+    } else if (cache_.size() >= kMaxCachedDSets_) {
+      // evict the least recently used combination; the set itself is reclaimed when its pool is
+      // recycled
+      cache_.erase(lru_.back());
+      lru_.pop_back();
+    }
+    lru_.push_front(bindingsHash);
+    cache_[bindingsHash] = {dset, {key, key + numKeyWords}, lru_.begin()};
+  }
+  /// @brief Bulk-recycles extinct pools whose GPU work has retired. Invoked once per frame when
+  /// the sync manager advances to the next frame; it only kicks in once the arena has accumulated
+  /// more than a few frames' worth of extinct pools, so the steady state keeps the descriptor set
+  /// cache warm while descriptor churn is bounded to kMaxExtinctPools_ pools instead of growing
+  /// without limit.
+  void retireExtinctPools(VulkanImmediateCommands& ic) {
+    if (extinct_.size() <= kMaxExtinctPools_) {
+      return;
+    }
+    while (extinct_.size() > kMaxExtinctPools_ && ic.isRecycled(extinct_.front().handle_)) {
+      const ExtinctDescriptorPool p = extinct_.front();
+      extinct_.pop_front();
+      // one vkResetDescriptorPool() reclaims every set allocated from the pool; the cache never
+      // holds sets from extinct pools (it is purged in switchToNewDescriptorPool()), so no cached
+      // entry can reference the pool being reset
+      VK_ASSERT(vf_.vkResetDescriptorPool(device_, p.pool_, VkDescriptorPoolResetFlags{}));
+      ready_.push_back(p.pool_);
+    }
+  }
 
  private:
   void switchToNewDescriptorPool(VulkanImmediateCommands& ic,
@@ -244,6 +332,17 @@ class DescriptorPoolsArena final {
 
     if (pool_ != VK_NULL_HANDLE) {
       extinct_.push_back({pool_, lastSubmitHandle});
+      // the cache must only hold sets from the current pool: an extinct pool is reset as soon as
+      // the submit handle captured here is recycled, and a cache hit would re-bind its sets into
+      // newer in-flight submissions without refreshing that handle
+      cache_.clear();
+      lru_.clear();
+    }
+    // pools recycled by retireExtinctPools() are already reset and ready to go
+    if (!ready_.empty()) {
+      pool_ = ready_.back();
+      ready_.pop_back();
+      return;
     }
     // first, let's try to reuse the oldest extinct pool
     if (extinct_.size() > 1) {
@@ -255,22 +354,54 @@ class DescriptorPoolsArena final {
         return;
       }
     }
-    const VkDescriptorPoolSize poolSize = VkDescriptorPoolSize{
-        type_, numDescriptorsPerDSet_ ? kNumDSetsPerPool_ * numDescriptorsPerDSet_ : 1u};
-    VK_ASSERT(ivkCreateDescriptorPool(
-        &vf_, device_, VkDescriptorPoolCreateFlags{}, kNumDSetsPerPool_, 1, &poolSize, &pool_));
+    uint32_t numPoolSizes = 0;
+    VkDescriptorPoolSize poolSizes[2];
+    if (numDescriptorsPerDSet_ || !numInlineBytesPerDSet_) {
+      poolSizes[numPoolSizes++] = VkDescriptorPoolSize{
+          type_, numDescriptorsPerDSet_ ? kNumDSetsPerPool_ * numDescriptorsPerDSet_ : 1u};
+    }
+    if (numInlineBytesPerDSet_) {
+      // for inline uniform blocks the pool size is specified in bytes, not in descriptors, and
+      // the number of inline bindings is capped separately through the chained create info
+      poolSizes[numPoolSizes++] = VkDescriptorPoolSize{VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT,
+                                                       kNumDSetsPerPool_ * numInlineBytesPerDSet_};
+      const VkDescriptorPoolInlineUniformBlockCreateInfoEXT inlineInfo = {
+          VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_INLINE_UNIFORM_BLOCK_CREATE_INFO_EXT,
+          nullptr,
+          kNumDSetsPerPool_ * numInlineBindingsPerDSet_};
+      const VkDescriptorPoolCreateInfo ci = {VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
+                                             &inlineInfo,
+                                             VkDescriptorPoolCreateFlags{},
+                                             kNumDSetsPerPool_,
+                                             numPoolSizes,
+                                             poolSizes};
+      VK_ASSERT(vf_.vkCreateDescriptorPool(device_, &ci, nullptr, &pool_));
+    } else {
+      VK_ASSERT(ivkCreateDescriptorPool(&vf_,
+                                        device_,
+                                        VkDescriptorPoolCreateFlags{},
+                                        kNumDSetsPerPool_,
+                                        numPoolSizes,
+                                        poolSizes,
+                                        &pool_));
+    }
     VK_ASSERT(ivkSetDebugObjectName(
         &vf_, device_, VK_OBJECT_TYPE_DESCRIPTOR_POOL, (uint64_t)pool_, dpDebugName_.c_str()));
   }
 
  private:
   static constexpr uint32_t kNumDSetsPerPool_ = 256;
+  static constexpr size_t kMaxCachedDSets_ = 1024;
+  static constexpr size_t kMaxExtinctPools_ = 4;
 
   const VulkanFunctionTable& vf_;
   VkDevice device_ = VK_NULL_HANDLE;
   VkDescriptorPool pool_ = VK_NULL_HANDLE;
   const VkDescriptorType type_ = VK_DESCRIPTOR_TYPE_MAX_ENUM;
   const uint32_t numDescriptorsPerDSet_ = 0;
+  // inline uniform block bindings mixed into the layout (see VulkanContext::isInlineUniformBlock())
+  const uint32_t numInlineBindingsPerDSet_ = 0;
+  const uint32_t numInlineBytesPerDSet_ = 0;
   uint32_t numRemainingDSetsInPool_ = 0;
   std::string dpDebugName_;
 
@@ -282,6 +413,18 @@ class DescriptorPoolsArena final {
   };
 
   std::deque<ExtinctDescriptorPool> extinct_;
+  std::vector<VkDescriptorPool> ready_; // reset pools awaiting reuse
+
+  // LRU cache of already written descriptor sets keyed by a hash of the bindings they contain;
+  // only sets allocated from the current pool_ are ever cached
+  struct CachedDescriptorSet {
+    VkDescriptorSet dset_ = VK_NULL_HANDLE;
+    std::vector<uint64_t> key_; // the full bindings key, compared on lookup
+    std::list<uint64_t>::iterator lruIt_ = {};
+  };
+
+  std::list<uint64_t> lru_; // most recently used bindings hashes first
+  std::unordered_map<uint64_t, CachedDescriptorSet> cache_;
 };
 
 struct VulkanContextImpl final {
@@ -300,6 +443,14 @@ struct VulkanContextImpl final {
   VulkanImmediateCommands::SubmitHandle lastSubmitHandle_ = {};
   uint32_t currentMaxBindlessTextures_ = 8;
   uint32_t currentMaxBindlessSamplers_ = 8;
+  // first bindless array slot that needs rewriting in checkAndUpdateDescriptorSets(); slots below
+  // it are up to date in dsBindless_, so updates only touch the tail of the array
+  uint32_t bindlessTexturesDirtyWatermark_ = 0;
+  uint32_t bindlessSamplersDirtyWatermark_ = 0;
+  // a slot that may be referenced by in-flight GPU work was rewritten (a texture or sampler was
+  // destroyed); the update must then wait for the GPU. Newly created slots are covered by
+  // VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT and need no wait
+  bool bindlessSlotsReleased_ = false;
 
   igl::vulkan::DescriptorPoolsArena& getOrCreateArena_CombinedImageSamplers(
       const VulkanContext& ctx,
@@ -319,13 +470,21 @@ struct VulkanContextImpl final {
   }
   igl::vulkan::DescriptorPoolsArena& getOrCreateArena_UniformBuffers(const VulkanContext& ctx,
                                                                      VkDescriptorSetLayout dsl,
-                                                                     uint32_t numBindings) {
+                                                                     uint32_t numBindings,
+                                                                     uint32_t numInlineBindings,
+                                                                     uint32_t numInlineBytes) {
     auto it = arenaBuffersUniform_.find(dsl);
     if (it != arenaBuffersUniform_.end()) {
       return *it->second;
     }
-    arenaBuffersUniform_[dsl] = std::make_unique<DescriptorPoolsArena>(
-        ctx, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, dsl, numBindings, "arenaBuffersUniform_");
+    arenaBuffersUniform_[dsl] =
+        std::make_unique<DescriptorPoolsArena>(ctx,
+                                               VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
+                                               dsl,
+                                               numBindings,
+                                               "arenaBuffersUniform_",
+                                               numInlineBindings,
+                                               numInlineBytes);
     return *arenaBuffersUniform_[dsl].get();
   }
   igl::vulkan::DescriptorPoolsArena& getOrCreateArena_StorageBuffers(const VulkanContext& ctx,
@@ -361,7 +520,9 @@ VulkanContext::VulkanContext(const VulkanContextConfig& config,
 
   vulkan::functions::initialize(*tableImpl_);
 
+#if !IGL_VULKAN_NO_GLSLANG
   glslang_initialize_process();
+#endif // !IGL_VULKAN_NO_GLSLANG
 
   createInstance(numExtraInstanceExtensions, extraInstanceExtensions);
 
@@ -385,9 +546,12 @@ VulkanContext::~VulkanContext() {
 #endif
 
   enhancedShaderDebuggingStore_.reset(nullptr);
+  programmableResolve_.reset(nullptr);
 
+  uniformRingBuffer_.reset();
   dummyStorageBuffer_.reset();
   dummyUniformBuffer_.reset();
+  breadcrumbBuffer_.reset();
 #if IGL_DEBUG
   for (const auto& t : textures_.objects_) {
     if (t.obj_.use_count() > 1) {
@@ -434,6 +598,8 @@ VulkanContext::~VulkanContext() {
     pimpl_->arenaCombinedImageSamplers_.clear();
     pimpl_->arenaBuffersUniform_.clear();
     pimpl_->arenaBuffersStorage_.clear();
+    dslCache_.clear();
+    savePipelineCacheFile();
     vf_.vkDestroyPipelineCache(device, pipelineCache_, nullptr);
   }
 
@@ -441,6 +607,10 @@ VulkanContext::~VulkanContext() {
 
   // Clean up VMA
   if (IGL_VULKAN_USE_VMA) {
+    if (defragContext_) {
+      vmaEndDefragmentation(pimpl_->vma_, (VmaDefragmentationContext)defragContext_, nullptr);
+      defragContext_ = nullptr;
+    }
     vmaDestroyAllocator(pimpl_->vma_);
   }
 
@@ -450,7 +620,9 @@ VulkanContext::~VulkanContext() {
 #endif // defined(VK_EXT_debug_utils) && !IGL_PLATFORM_ANDROID
   vf_.vkDestroyInstance(vkInstance_, nullptr);
 
+#if !IGL_VULKAN_NO_GLSLANG
   glslang_finalize_process();
+#endif // !IGL_VULKAN_NO_GLSLANG
 
 #if IGL_DEBUG || defined(IGL_FORCE_ENABLE_LOGS)
   if (config_.enableExtraLogs) {
@@ -520,6 +692,110 @@ void VulkanContext::createSurface(void* window, void* display) {
   VK_ASSERT(ivkCreateSurface(&vf_, vkInstance_, window, display, layer, &vkSurface_));
 }
 
+igl::Result VulkanContext::createDirectToDisplaySurface() {
+#if defined(VK_KHR_display)
+  if (!extensions_.enabled(VK_KHR_DISPLAY_EXTENSION_NAME)) {
+    return Result(Result::Code::Unsupported, "VK_KHR_display is not enabled");
+  }
+  if (!vf_.vkGetPhysicalDeviceDisplayPropertiesKHR || !vf_.vkGetDisplayModePropertiesKHR ||
+      !vf_.vkGetPhysicalDeviceDisplayPlanePropertiesKHR ||
+      !vf_.vkGetDisplayPlaneSupportedDisplaysKHR || !vf_.vkCreateDisplayPlaneSurfaceKHR) {
+    return Result(Result::Code::Unsupported, "VK_KHR_display entry points are not available");
+  }
+
+  uint32_t displayCount = 0;
+  vf_.vkGetPhysicalDeviceDisplayPropertiesKHR(vkPhysicalDevice_, &displayCount, nullptr);
+  if (displayCount == 0) {
+    return Result(Result::Code::Unsupported, "No displays available for direct scanout");
+  }
+  std::vector<VkDisplayPropertiesKHR> displays(displayCount);
+  vf_.vkGetPhysicalDeviceDisplayPropertiesKHR(vkPhysicalDevice_, &displayCount, displays.data());
+
+  uint32_t planeCount = 0;
+  vf_.vkGetPhysicalDeviceDisplayPlanePropertiesKHR(vkPhysicalDevice_, &planeCount, nullptr);
+  std::vector<VkDisplayPlanePropertiesKHR> planes(planeCount);
+  vf_.vkGetPhysicalDeviceDisplayPlanePropertiesKHR(vkPhysicalDevice_, &planeCount, planes.data());
+
+  for (const VkDisplayPropertiesKHR& displayProps : displays) {
+    const VkDisplayKHR display = displayProps.display;
+
+    uint32_t modeCount = 0;
+    vf_.vkGetDisplayModePropertiesKHR(vkPhysicalDevice_, display, &modeCount, nullptr);
+    if (modeCount == 0) {
+      continue;
+    }
+    std::vector<VkDisplayModePropertiesKHR> modes(modeCount);
+    vf_.vkGetDisplayModePropertiesKHR(vkPhysicalDevice_, display, &modeCount, modes.data());
+
+    // prefer the mode with the largest visible region, breaking ties with the highest refresh
+    // rate - that is the panel's native timing, which scanout wants
+    const VkDisplayModePropertiesKHR* bestMode = nullptr;
+    for (const VkDisplayModePropertiesKHR& mode : modes) {
+      const auto area = [](const VkDisplayModePropertiesKHR& m) -> uint64_t {
+        return static_cast<uint64_t>(m.parameters.visibleRegion.width) *
+               m.parameters.visibleRegion.height;
+      };
+      if (bestMode == nullptr || area(mode) > area(*bestMode) ||
+          (area(mode) == area(*bestMode) &&
+           mode.parameters.refreshRate > bestMode->parameters.refreshRate)) {
+        bestMode = &mode;
+      }
+    }
+
+    for (uint32_t plane = 0; plane < planeCount; ++plane) {
+      // a plane bound to another display cannot be repurposed without disturbing that display
+      if (planes[plane].currentDisplay != VK_NULL_HANDLE &&
+          planes[plane].currentDisplay != display) {
+        continue;
+      }
+      uint32_t supportedCount = 0;
+      vf_.vkGetDisplayPlaneSupportedDisplaysKHR(vkPhysicalDevice_, plane, &supportedCount, nullptr);
+      std::vector<VkDisplayKHR> supported(supportedCount);
+      vf_.vkGetDisplayPlaneSupportedDisplaysKHR(
+          vkPhysicalDevice_, plane, &supportedCount, supported.data());
+      if (std::find(supported.begin(), supported.end(), display) == supported.end()) {
+        continue;
+      }
+
+      const VkDisplaySurfaceCreateInfoKHR ci = {
+          VK_STRUCTURE_TYPE_DISPLAY_SURFACE_CREATE_INFO_KHR,
+          nullptr,
+          0,
+          bestMode->displayMode,
+          plane,
+          planes[plane].currentStackIndex,
+          VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR,
+          1.0f,
+          VK_DISPLAY_PLANE_ALPHA_OPAQUE_BIT_KHR,
+          bestMode->parameters.visibleRegion,
+      };
+      VkSurfaceKHR displaySurface = VK_NULL_HANDLE;
+      if (vf_.vkCreateDisplayPlaneSurfaceKHR(vkInstance_, &ci, nullptr, &displaySurface) !=
+          VK_SUCCESS) {
+        continue;
+      }
+
+      // the display surface replaces the windowed one for everything downstream (capability
+      // queries, swapchain creation), so presentation scans out without a compositor hop
+      if (vkSurface_ != VK_NULL_HANDLE) {
+        vf_.vkDestroySurfaceKHR(vkInstance_, vkSurface_, nullptr);
+      }
+      vkSurface_ = displaySurface;
+      useDirectToDisplay_ = true;
+      IGL_LOG_INFO("Direct-to-display: %s, %ux%u @ %u mHz\n",
+                   displayProps.displayName ? displayProps.displayName : "(unnamed display)",
+                   bestMode->parameters.visibleRegion.width,
+                   bestMode->parameters.visibleRegion.height,
+                   bestMode->parameters.refreshRate);
+      return Result();
+    }
+  }
+  return Result(Result::Code::Unsupported, "No display/plane pair supports direct scanout");
+#else
+  return Result(Result::Code::Unsupported, "VK_KHR_display is not available in this build");
+#endif // defined(VK_KHR_display)
+}
+
 igl::Result VulkanContext::queryDevices(const HWDeviceQueryDesc& desc,
                                         std::vector<HWDeviceDesc>& outDevices) {
   outDevices.clear();
@@ -625,6 +901,62 @@ igl::Result VulkanContext::initContext(const HWDeviceDesc& desc,
     (void)IGL_VERIFY(extensions_.enable(VK_KHR_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME,
                                         VulkanExtensions::ExtensionType::Device));
   }
+  if (config_.enableTimelineSemaphores && !config_.exportableFences) {
+    useTimelineSemaphores_ =
+        vkPhysicalDeviceTimelineSemaphoreFeatures_.timelineSemaphore == VK_TRUE &&
+        extensions_.enable(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME,
+                           VulkanExtensions::ExtensionType::Device);
+    if (!useTimelineSemaphores_) {
+      IGL_LOG_INFO(
+          "VK_KHR_timeline_semaphore is not supported - command buffer completion will be tracked "
+          "with fences\n");
+    }
+  }
+  if (config_.enableDynamicRendering) {
+    useDynamicRendering_ = vkPhysicalDeviceDynamicRenderingFeatures_.dynamicRendering == VK_TRUE &&
+                           extensions_.enable(VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME,
+                                              VulkanExtensions::ExtensionType::Device);
+    if (!useDynamicRendering_) {
+      IGL_LOG_INFO(
+          "VK_KHR_dynamic_rendering is not supported - falling back to the cached "
+          "VkRenderPass/VkFramebuffer path\n");
+    }
+  }
+  if (config_.enableInlineUniformBlocks) {
+    useInlineUniformBlocks_ =
+        vkPhysicalDeviceInlineUniformBlockFeatures_.inlineUniformBlock == VK_TRUE &&
+        extensions_.enable(VK_EXT_INLINE_UNIFORM_BLOCK_EXTENSION_NAME,
+                           VulkanExtensions::ExtensionType::Device);
+    if (!useInlineUniformBlocks_) {
+      IGL_LOG_INFO(
+          "VK_EXT_inline_uniform_block is not supported - small uniform blocks will be bound as "
+          "uniform buffers\n");
+    }
+  }
+#if defined(VK_EXT_image_compression_control)
+  if (config_.enableImageCompressionControl) {
+    useImageCompressionControl_ =
+        vkPhysicalDeviceImageCompressionControlFeatures_.imageCompressionControl == VK_TRUE &&
+        extensions_.enable(VK_EXT_IMAGE_COMPRESSION_CONTROL_EXTENSION_NAME,
+                           VulkanExtensions::ExtensionType::Device);
+    if (!useImageCompressionControl_) {
+      IGL_LOG_INFO(
+          "VK_EXT_image_compression_control is not supported - image compression state will not "
+          "be reported\n");
+    }
+  }
+#endif // defined(VK_EXT_image_compression_control)
+  if (config_.enableGpuCrashBreadcrumbs) {
+    useBufferMarkerAMD_ = extensions_.enable(VK_AMD_BUFFER_MARKER_EXTENSION_NAME,
+                                             VulkanExtensions::ExtensionType::Device);
+    useDiagnosticCheckpoints_ = extensions_.enable(
+        VK_NV_DEVICE_DIAGNOSTIC_CHECKPOINTS_EXTENSION_NAME, VulkanExtensions::ExtensionType::Device);
+    if (!useBufferMarkerAMD_) {
+      IGL_LOG_INFO(
+          "VK_AMD_buffer_marker is not supported - GPU breadcrumbs will fall back to "
+          "vkCmdFillBuffer() writes\n");
+    }
+  }
 
   VulkanQueuePool queuePool(vf_, vkPhysicalDevice_);
 
@@ -670,6 +1002,23 @@ igl::Result VulkanContext::initContext(const HWDeviceDesc& desc,
     queuePool.reserveQueue(descriptor);
   }
 
+  // Reserve a dedicated transfer queue for staging uploads when requested. We only use it when it
+  // lives in a family separate from the graphics and compute queues; otherwise uploads would not
+  // overlap rendering anyway
+  if (config_.useDedicatedTransferQueue) {
+    const auto transferQueueDescriptor = queuePool.findQueueDescriptor(VK_QUEUE_TRANSFER_BIT);
+    if (transferQueueDescriptor.isValid() &&
+        transferQueueDescriptor.familyIndex != deviceQueues_.graphicsQueueFamilyIndex &&
+        transferQueueDescriptor.familyIndex != deviceQueues_.computeQueueFamilyIndex) {
+      deviceQueues_.transferQueueFamilyIndex = transferQueueDescriptor.familyIndex;
+      queuePool.reserveQueue(transferQueueDescriptor);
+    } else {
+      IGL_LOG_INFO(
+          "No separate transfer queue family available - staging uploads will use the graphics "
+          "queue\n");
+    }
+  }
+
   const auto qcis = queuePool.getQueueCreationInfos();
 
   VkDevice device;
@@ -684,6 +1033,10 @@ igl::Result VulkanContext::initContext(const HWDeviceDesc& desc,
                       vkPhysicalDeviceShaderFloat16Int8Features_.shaderFloat16,
                       config_.enableBufferDeviceAddress,
                       config_.enableDescriptorIndexing,
+                      useTimelineSemaphores_,
+                      useDynamicRendering_,
+                      useInlineUniformBlocks_,
+                      useImageCompressionControl_,
                       &vkPhysicalDeviceFeatures2_.features,
                       &device));
   if (!config_.enableConcurrentVkDevicesSupport) {
@@ -695,6 +1048,14 @@ igl::Result VulkanContext::initContext(const HWDeviceDesc& desc,
   // should use own copy of function table bound to a device.
   vulkan::functions::loadDeviceFunctions(*tableImpl_, device);
 
+#if defined(VK_EXT_image_compression_control)
+  if (useImageCompressionControl_) {
+    vkGetImageSubresourceLayout2EXT_ = (PFN_vkGetImageSubresourceLayout2EXT)
+        vf_.vkGetDeviceProcAddr(device, "vkGetImageSubresourceLayout2EXT");
+    useImageCompressionControl_ = vkGetImageSubresourceLayout2EXT_ != nullptr;
+  }
+#endif // defined(VK_EXT_image_compression_control)
+
   if (config_.enableBufferDeviceAddress && vf_.vkGetBufferDeviceAddressKHR == nullptr) {
     return Result(Result::Code::InvalidOperation, "Cannot initialize VK_KHR_buffer_device_address");
   }
@@ -703,6 +1064,10 @@ igl::Result VulkanContext::initContext(const HWDeviceDesc& desc,
       device, deviceQueues_.graphicsQueueFamilyIndex, 0, &deviceQueues_.graphicsQueue);
   vf_.vkGetDeviceQueue(
       device, deviceQueues_.computeQueueFamilyIndex, 0, &deviceQueues_.computeQueue);
+  if (deviceQueues_.transferQueueFamilyIndex != DeviceQueues::INVALID) {
+    vf_.vkGetDeviceQueue(
+        device, deviceQueues_.transferQueueFamilyIndex, 0, &deviceQueues_.transferQueue);
+  }
 
   device_ =
       std::make_unique<igl::vulkan::VulkanDevice>(vf_, device, "Device: VulkanContext::device_");
@@ -711,21 +1076,57 @@ igl::Result VulkanContext::initContext(const HWDeviceDesc& desc,
                                                              device,
                                                              deviceQueues_.graphicsQueueFamilyIndex,
                                                              config_.exportableFences,
+                                                             useTimelineSemaphores_,
                                                              "VulkanContext::immediate_");
   syncManager_ = std::make_unique<SyncManager>(*this, config_.maxResourceCount);
 
+  if (config_.enableGpuCrashBreadcrumbs) {
+    breadcrumbBuffer_ =
+        std::make_unique<VulkanBuffer>(*this,
+                                       device,
+                                       kNumGpuBreadcrumbs * sizeof(uint32_t),
+                                       VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                                       VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+                                           VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                                       "Buffer: VulkanContext::breadcrumbBuffer_");
+    // a zeroed ring means "no marker reached yet"; marker values start at 1
+    const std::vector<uint32_t> zeros(kNumGpuBreadcrumbs, 0u);
+    breadcrumbBuffer_->bufferSubData(0, kNumGpuBreadcrumbs * sizeof(uint32_t), zeros.data());
+    immediate_->setSubmitErrorCallback([this](VkResult result) {
+      if (result == VK_ERROR_DEVICE_LOST) {
+        IGL_LOG_ERROR("GPU device lost.\n%s", getGpuBreadcrumbReport().c_str());
+      }
+    });
+  }
+
   // create Vulkan pipeline cache
   {
+    // application-provided data takes precedence over the cache file
+    std::vector<uint8_t> fileData;
+    if (!config_.pipelineCacheData && !config_.pipelineCacheFilePath.empty()) {
+      fileData = loadPipelineCacheFile();
+    }
     const VkPipelineCacheCreateInfo ci = {
         VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO,
         nullptr,
         VkPipelineCacheCreateFlags(0),
-        config_.pipelineCacheDataSize,
-        config_.pipelineCacheData,
+        config_.pipelineCacheData ? config_.pipelineCacheDataSize : fileData.size(),
+        config_.pipelineCacheData ? config_.pipelineCacheData : fileData.data(),
     };
     vf_.vkCreatePipelineCache(device, &ci, nullptr, &pipelineCache_);
   }
 
+  // map the precompiled shader pack, if one is configured
+  if (!config_.shaderPackFilePath.empty()) {
+    if (shaderPack_.open(config_.shaderPackFilePath.c_str())) {
+      IGL_LOG_INFO("Loaded shader pack with %zu shaders from: %s\n",
+                   shaderPack_.getShaderCount(),
+                   config_.shaderPackFilePath.c_str());
+    } else {
+      IGL_LOG_ERROR("Failed to load shader pack: %s\n", config_.shaderPackFilePath.c_str());
+    }
+  }
+
   // Create Vulkan Memory Allocator
   if (IGL_VULKAN_USE_VMA) {
     VK_ASSERT_RETURN(ivkVmaCreateAllocator(&vf_,
@@ -741,6 +1142,37 @@ igl::Result VulkanContext::initContext(const HWDeviceDesc& desc,
   // to happen after VMA has been initialized.
   stagingDevice_ = std::make_unique<igl::vulkan::VulkanStagingDevice>(*this);
 
+  uploadScheduler_ = std::make_unique<igl::vulkan::VulkanUploadScheduler>(*this);
+
+  if (config_.enableUploadCalibration) {
+    // measures this device's upload paths once (~10 ms) so the strategy choices below are based
+    // on measurements rather than hand-tuned per-SoC thresholds
+    uploadCalibration_ = runUploadCalibration(*this);
+  }
+
+  if (config_.enableBufferSuballocation) {
+    const VkPhysicalDeviceLimits& limits = getVkPhysicalDeviceProperties().limits;
+    constexpr VkDeviceSize kBufferPoolPageSize = 1024 * 1024;
+    const VkBufferUsageFlags optionalBDA =
+        config_.enableBufferDeviceAddress ? VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT_KHR : 0;
+    // suballocation offsets must respect both the descriptor offset limits and the 64-byte
+    // IBuffer::kMapAlignment guarantee of map()
+    uniformBufferPool_ = std::make_unique<igl::vulkan::VulkanBufferPool>(
+        *this,
+        VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT | optionalBDA,
+        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT,
+        std::max<VkDeviceSize>(limits.minUniformBufferOffsetAlignment, IBuffer::kMapAlignment),
+        kBufferPoolPageSize,
+        "Buffer: pool (uniform)");
+    storageBufferPool_ = std::make_unique<igl::vulkan::VulkanBufferPool>(
+        *this,
+        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT | optionalBDA,
+        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT,
+        std::max<VkDeviceSize>(limits.minStorageBufferOffsetAlignment, IBuffer::kMapAlignment),
+        kBufferPoolPageSize,
+        "Buffer: pool (storage)");
+  }
+
   // Unextended Vulkan 1.1 does not allow sparse (VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT)
   // bindings. Our descriptor set layout emulates OpenGL binding slots but we cannot put
   // VK_NULL_HANDLE into empty slots. We use dummy buffers to stick them into those empty slots.
@@ -755,6 +1187,18 @@ igl::Result VulkanContext::initContext(const HWDeviceDesc& desc,
                                      nullptr,
                                      "Buffer: dummy storage");
 
+  // one persistently mapped, host-coherent region per frame in flight for bindBytes() payloads
+  // that do not fit into push constants; regions are recycled by SyncManager::acquireNext()
+  {
+    constexpr VkDeviceSize kUniformRingRegionSize = 256 * 1024;
+    uniformRingBuffer_ = std::make_unique<igl::vulkan::VulkanUniformRingBuffer>(
+        *this,
+        syncManager_->maxResourceCount(),
+        kUniformRingRegionSize,
+        getVkPhysicalDeviceProperties().limits.minUniformBufferOffsetAlignment,
+        "Buffer: uniform ring");
+  }
+
   // default texture
   {
     const VkFormat dummyTextureFormat = VK_FORMAT_R8G8B8A8_UNORM;
@@ -820,6 +1264,14 @@ igl::Result VulkanContext::initContext(const HWDeviceDesc& desc,
   growBindlessDescriptorPool(pimpl_->currentMaxBindlessTextures_,
                              pimpl_->currentMaxBindlessSamplers_);
 
+  if (config_.enableDirectToDisplay) {
+    const igl::Result directResult = createDirectToDisplaySurface();
+    if (!directResult.isOk()) {
+      IGL_LOG_INFO("Direct-to-display unavailable (%s); using the windowed swapchain\n",
+                   directResult.message.c_str());
+    }
+  }
+
   querySurfaceCapabilities();
 
 #if defined(IGL_WITH_TRACY_GPU)
@@ -857,9 +1309,12 @@ igl::Result VulkanContext::initContext(const HWDeviceDesc& desc,
 #endif // IGL_WITH_TRACY_GPU
 
   // enables/disables enhanced shader debugging
+#if IGL_VULKAN_ENHANCED_SHADER_DEBUGGING
   if (config_.enhancedShaderDebugging) {
-    enhancedShaderDebuggingStore_ = std::make_unique<EnhancedShaderDebuggingStore>();
+    enhancedShaderDebuggingStore_ =
+        std::make_unique<EnhancedShaderDebuggingStore>(config_.enhancedShaderDebuggingSampleInterval);
   }
+#endif // IGL_VULKAN_ENHANCED_SHADER_DEBUGGING
 
   return Result();
 }
@@ -975,6 +1430,10 @@ void VulkanContext::growBindlessDescriptorPool(uint32_t newMaxTextures, uint32_t
                                   VK_OBJECT_TYPE_DESCRIPTOR_SET,
                                   (uint64_t)pimpl_->dsBindless_,
                                   "Descriptor Set: dsBindless_"));
+
+  // the freshly allocated descriptor set is empty - every slot has to be (re)written
+  pimpl_->bindlessTexturesDirtyWatermark_ = 0;
+  pimpl_->bindlessSamplersDirtyWatermark_ = 0;
 }
 
 igl::Result VulkanContext::initSwapchain(uint32_t width, uint32_t height) {
@@ -986,6 +1445,15 @@ igl::Result VulkanContext::initSwapchain(uint32_t width, uint32_t height) {
   }
 
   if (swapchain_) {
+    if (width && height) {
+      // Incremental recreation for resizes (foldables, split-screen): reuse the surface-query
+      // results and format decisions made at construction and let vkCreateSwapchainKHR() recycle
+      // the presentable images of the old swapchain. Only the surface capabilities are re-queried
+      // because currentExtent/currentTransform change with the window
+      vf_.vkGetPhysicalDeviceSurfaceCapabilitiesKHR(
+          vkPhysicalDevice_, vkSurface_, &deviceSurfaceCaps_);
+      return swapchain_->resize(width, height);
+    }
     vf_.vkDeviceWaitIdle(device_->device_);
     swapchain_ = nullptr; // Destroy old swapchain first
   }
@@ -1018,7 +1486,23 @@ Result VulkanContext::present() const {
     return Result(Result::Code::InvalidOperation, "No swapchain available");
   }
 
-  return swapchain_->present(immediate_->acquireLastSubmitSemaphore());
+  const Result result = swapchain_->present(immediate_->acquireLastSubmitSemaphore());
+
+  if (config_.pipelineCacheFileSaveInterval && !config_.pipelineCacheFilePath.empty()) {
+    const uint64_t frameNumber = getFrameNumber();
+    if (frameNumber && (frameNumber % config_.pipelineCacheFileSaveInterval == 0)) {
+      savePipelineCacheFile();
+    }
+  }
+
+  if (config_.enableDefragmentation && config_.defragmentationFrameInterval) {
+    const uint64_t frameNumber = getFrameNumber();
+    if (frameNumber && (frameNumber % config_.defragmentationFrameInterval == 0)) {
+      processDefragmentation();
+    }
+  }
+
+  return result;
 }
 
 std::unique_ptr<VulkanBuffer> VulkanContext::createBuffer(VkDeviceSize bufferSize,
@@ -1120,6 +1604,10 @@ std::unique_ptr<VulkanImage> VulkanContext::createImageFromFileDescriptor(
 }
 
 void VulkanContext::checkAndUpdateDescriptorSets() {
+  // runs on the submission thread; the lock keeps the pools stable while loader threads create
+  // resources concurrently
+  const std::lock_guard<std::mutex> lock(objectPoolsMutex_);
+
   if (!awaitingCreation_) {
     // nothing to update here
     return;
@@ -1135,10 +1623,15 @@ void VulkanContext::checkAndUpdateDescriptorSets() {
   {
     while (textures_.objects_.size() > 1 && textures_.objects_.back().obj_.use_count() == 1) {
       textures_.objects_.pop_back();
+      pimpl_->bindlessSlotsReleased_ = true;
     }
     for (uint32_t i = 1; i < (uint32_t)textures_.objects_.size(); i++) {
       if (textures_.objects_[i].obj_ && textures_.objects_[i].obj_.use_count() == 1) {
         textures_.destroy(i);
+        // the slot is rewritten with the dummy texture below
+        pimpl_->bindlessTexturesDirtyWatermark_ =
+            std::min(pimpl_->bindlessTexturesDirtyWatermark_, i);
+        pimpl_->bindlessSlotsReleased_ = true;
       }
     }
   }
@@ -1146,10 +1639,14 @@ void VulkanContext::checkAndUpdateDescriptorSets() {
   {
     while (samplers_.objects_.size() > 1 && samplers_.objects_.back().obj_.use_count() == 1) {
       samplers_.objects_.pop_back();
+      pimpl_->bindlessSlotsReleased_ = true;
     }
     for (uint32_t i = 1; i < (uint32_t)samplers_.objects_.size(); i++) {
       if (samplers_.objects_[i].obj_ && samplers_.objects_[i].obj_.use_count() == 1) {
         samplers_.destroy(i);
+        pimpl_->bindlessSamplersDirtyWatermark_ =
+            std::min(pimpl_->bindlessSamplersDirtyWatermark_, i);
+        pimpl_->bindlessSlotsReleased_ = true;
       }
     }
   }
@@ -1177,18 +1674,25 @@ void VulkanContext::checkAndUpdateDescriptorSets() {
   IGL_ASSERT(!textures_.objects_.empty());
   IGL_ASSERT(!samplers_.objects_.empty());
 
+  // only the slots from the dirty watermarks onwards have changed since the last update; the
+  // descriptor arrays below the watermarks are already up to date in the descriptor set
+  const uint32_t firstTexture =
+      std::min(pimpl_->bindlessTexturesDirtyWatermark_, (uint32_t)textures_.objects_.size());
+  const uint32_t firstSampler =
+      std::min(pimpl_->bindlessSamplersDirtyWatermark_, (uint32_t)samplers_.objects_.size());
+
   // 1. Sampled and storage images
   std::vector<VkDescriptorImageInfo> infoSampledImages;
   std::vector<VkDescriptorImageInfo> infoStorageImages;
-  infoSampledImages.reserve(textures_.objects_.size());
-  infoStorageImages.reserve(textures_.objects_.size());
+  infoSampledImages.reserve(textures_.objects_.size() - firstTexture);
+  infoStorageImages.reserve(textures_.objects_.size() - firstTexture);
 
   // use the dummy texture/sampler to avoid sparse array
   VkImageView dummyImageView = textures_.objects_[0].obj_->imageView_->getVkImageView();
   VkSampler dummySampler = samplers_.objects_[0].obj_->getVkSampler();
 
-  for (const auto& entry : textures_.objects_) {
-    const VulkanTexture* texture = entry.obj_.get();
+  for (uint32_t i = firstTexture; i < (uint32_t)textures_.objects_.size(); i++) {
+    const VulkanTexture* texture = textures_.objects_[i].obj_.get();
     if (texture) {
       // multisampled images cannot be directly accessed from shaders
       const bool isTextureAvailable =
@@ -1215,10 +1719,10 @@ void VulkanContext::checkAndUpdateDescriptorSets() {
 
   // 2. Samplers
   std::vector<VkDescriptorImageInfo> infoSamplers;
-  infoSamplers.reserve(samplers_.objects_.size());
+  infoSamplers.reserve(samplers_.objects_.size() - firstSampler);
 
-  for (const auto& entry : samplers_.objects_) {
-    const VulkanSampler* sampler = entry.obj_.get();
+  for (uint32_t i = firstSampler; i < (uint32_t)samplers_.objects_.size(); i++) {
+    const VulkanSampler* sampler = samplers_.objects_[i].obj_.get();
     infoSamplers.push_back({sampler ? sampler->getVkSampler() : dummySampler,
                             VK_NULL_HANDLE,
                             VK_IMAGE_LAYOUT_UNDEFINED});
@@ -1229,30 +1733,36 @@ void VulkanContext::checkAndUpdateDescriptorSets() {
   if (!infoSampledImages.empty()) {
     // use the same indexing for every texture type
     for (uint32_t i = kBinding_Texture2D; i != kBinding_TextureCube + 1; i++) {
-      write.push_back(ivkGetWriteDescriptorSet_ImageInfo(pimpl_->dsBindless_,
-                                                         i,
-                                                         VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE,
-                                                         (uint32_t)infoSampledImages.size(),
-                                                         infoSampledImages.data()));
+      VkWriteDescriptorSet w = ivkGetWriteDescriptorSet_ImageInfo(pimpl_->dsBindless_,
+                                                                  i,
+                                                                  VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE,
+                                                                  (uint32_t)infoSampledImages.size(),
+                                                                  infoSampledImages.data());
+      w.dstArrayElement = firstTexture;
+      write.push_back(w);
     }
   };
 
   if (!infoSamplers.empty()) {
     for (uint32_t i = kBinding_Sampler; i != kBinding_SamplerShadow + 1; i++) {
-      write.push_back(ivkGetWriteDescriptorSet_ImageInfo(pimpl_->dsBindless_,
-                                                         i,
-                                                         VK_DESCRIPTOR_TYPE_SAMPLER,
-                                                         (uint32_t)infoSamplers.size(),
-                                                         infoSamplers.data()));
+      VkWriteDescriptorSet w = ivkGetWriteDescriptorSet_ImageInfo(pimpl_->dsBindless_,
+                                                                  i,
+                                                                  VK_DESCRIPTOR_TYPE_SAMPLER,
+                                                                  (uint32_t)infoSamplers.size(),
+                                                                  infoSamplers.data());
+      w.dstArrayElement = firstSampler;
+      write.push_back(w);
     }
   }
 
   if (!infoStorageImages.empty()) {
-    write.push_back(ivkGetWriteDescriptorSet_ImageInfo(pimpl_->dsBindless_,
-                                                       kBinding_StorageImages,
-                                                       VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,
-                                                       (uint32_t)infoStorageImages.size(),
-                                                       infoStorageImages.data()));
+    VkWriteDescriptorSet w = ivkGetWriteDescriptorSet_ImageInfo(pimpl_->dsBindless_,
+                                                                kBinding_StorageImages,
+                                                                VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,
+                                                                (uint32_t)infoStorageImages.size(),
+                                                                infoStorageImages.data());
+    w.dstArrayElement = firstTexture;
+    write.push_back(w);
   };
 
   // do not switch to the next descriptor set if there is nothing to update
@@ -1260,31 +1770,45 @@ void VulkanContext::checkAndUpdateDescriptorSets() {
 #if IGL_VULKAN_PRINT_COMMANDS
     IGL_LOG_INFO("Updating descriptor set dsBindless_\n");
 #endif // IGL_VULKAN_PRINT_COMMANDS
-    immediate_->wait(std::exchange(pimpl_->lastSubmitHandle_, immediate_->getLastSubmitHandle()));
+    // rewriting a released slot may race with in-flight GPU work still referencing it, so wait for
+    // the GPU first. Appending brand-new slots needs no wait: the bindless set is created with
+    // VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT and no submitted command buffer can
+    // reference a texture that did not exist when it was recorded
+    if (pimpl_->bindlessSlotsReleased_) {
+      immediate_->wait(std::exchange(pimpl_->lastSubmitHandle_, immediate_->getLastSubmitHandle()));
+      pimpl_->bindlessSlotsReleased_ = false;
+    } else {
+      pimpl_->lastSubmitHandle_ = immediate_->getLastSubmitHandle();
+    }
     vf_.vkUpdateDescriptorSets(
         device_->getVkDevice(), static_cast<uint32_t>(write.size()), write.data(), 0, nullptr);
   }
 
+  pimpl_->bindlessTexturesDirtyWatermark_ = (uint32_t)textures_.objects_.size();
+  pimpl_->bindlessSamplersDirtyWatermark_ = (uint32_t)samplers_.objects_.size();
+
   awaitingCreation_ = false;
 }
 
 std::shared_ptr<VulkanTexture> VulkanContext::createTexture(
-    std::unique_ptr<VulkanImage> image,
+    std::shared_ptr<VulkanImage> image,
     std::unique_ptr<VulkanImageView> imageView,
     [[maybe_unused]] const char* debugName) const {
   IGL_PROFILER_FUNCTION();
 
-  const TextureHandle handle = textures_.create(
-      std::make_shared<VulkanTexture>(*this, std::move(image), std::move(imageView)));
+  // create the VulkanTexture outside of the lock - only the pool insertion needs to be serialized
+  auto texture = std::make_shared<VulkanTexture>(*this, std::move(image), std::move(imageView));
 
-  auto texture = *textures_.get(handle);
+  const std::lock_guard<std::mutex> lock(objectPoolsMutex_);
 
-  if (!IGL_VERIFY(texture)) {
-    return nullptr;
-  }
+  const TextureHandle handle = textures_.create(std::shared_ptr<VulkanTexture>(texture));
 
   texture->textureId_ = handle.index();
 
+  // the slot (possibly a reused one below the watermark) needs to be written to the bindless set
+  pimpl_->bindlessTexturesDirtyWatermark_ =
+      std::min(pimpl_->bindlessTexturesDirtyWatermark_, handle.index());
+
   awaitingCreation_ = true;
 
   return texture;
@@ -1306,23 +1830,101 @@ std::shared_ptr<VulkanSampler> VulkanContext::createSampler(const VkSamplerCreat
                                                             const char* debugName) const {
   IGL_PROFILER_FUNCTION();
 
-  const SamplerHandle handle = samplers_.create(
-      std::make_shared<VulkanSampler>(*this, device_->getVkDevice(), ci, debugName));
+  // create the VulkanSampler outside of the lock - only the pool insertion needs to be serialized
+  auto sampler = std::make_shared<VulkanSampler>(*this, device_->getVkDevice(), ci, debugName);
 
-  auto sampler = *samplers_.get(handle);
+  const std::lock_guard<std::mutex> lock(objectPoolsMutex_);
 
-  if (!IGL_VERIFY(sampler)) {
-    Result::setResult(outResult, Result::Code::InvalidOperation);
-    return nullptr;
-  }
+  const SamplerHandle handle = samplers_.create(std::shared_ptr<VulkanSampler>(sampler));
 
   sampler->samplerId_ = handle.index();
 
+  // the slot (possibly a reused one below the watermark) needs to be written to the bindless set
+  pimpl_->bindlessSamplersDirtyWatermark_ =
+      std::min(pimpl_->bindlessSamplersDirtyWatermark_, handle.index());
+
   awaitingCreation_ = true;
 
   return sampler;
 }
 
+std::shared_ptr<VulkanSampler> VulkanContext::getOrCreateSampler(const VkSamplerCreateInfo& ci,
+                                                                 size_t samplerHash,
+                                                                 igl::Result* outResult,
+                                                                 const char* debugName) const {
+  IGL_PROFILER_FUNCTION();
+
+  {
+    const std::lock_guard<std::mutex> lock(samplerCacheMutex_);
+    auto it = samplerCache_.find(samplerHash);
+    if (it != samplerCache_.end()) {
+      if (auto sampler = it->second.lock()) {
+        Result::setOk(outResult);
+        return sampler;
+      }
+      // the sampler was garbage collected after all its users were destroyed
+      samplerCache_.erase(it);
+    }
+  }
+
+  auto sampler = createSampler(ci, outResult, debugName);
+  if (sampler) {
+    const std::lock_guard<std::mutex> lock(samplerCacheMutex_);
+    samplerCache_[samplerHash] = sampler;
+  }
+  return sampler;
+}
+
+std::shared_ptr<VulkanDescriptorSetLayout> VulkanContext::getOrCreateDescriptorSetLayout(
+    VkDescriptorType type,
+    uint32_t numBindings,
+    const VkDescriptorSetLayoutBinding* bindings,
+    const char* debugName) const {
+  IGL_PROFILER_FUNCTION();
+
+  // All bindings created by ivkGetDescriptorSetLayoutBinding() differ only in their binding
+  // location, descriptor type and descriptor count (inline uniform blocks encode their byte size
+  // in the count), so sorted (location, type, count) triples are an exact key - no hashing of
+  // struct contents that could collide and alias two different layouts
+  std::vector<std::tuple<uint32_t, uint32_t, uint32_t>> sortedBindings;
+  sortedBindings.reserve(numBindings);
+  for (uint32_t i = 0; i != numBindings; i++) {
+    sortedBindings.emplace_back(
+        bindings[i].binding, (uint32_t)bindings[i].descriptorType, bindings[i].descriptorCount);
+  }
+  std::sort(sortedBindings.begin(), sortedBindings.end());
+
+  std::string key;
+  key.reserve(16 + 16 * numBindings);
+  key.append(std::to_string((int)type));
+  for (const auto& [location, bindingType, count] : sortedBindings) {
+    key.push_back(':');
+    key.append(std::to_string(location));
+    key.push_back('.');
+    key.append(std::to_string(bindingType));
+    key.push_back('.');
+    key.append(std::to_string(count));
+  }
+
+  const std::lock_guard<std::mutex> lock(dslCacheMutex_);
+
+  auto it = dslCache_.find(key);
+  if (it != dslCache_.end()) {
+    return it->second;
+  }
+
+  const std::vector<VkDescriptorBindingFlags> bindingFlags(numBindings);
+  auto dsl = std::make_shared<VulkanDescriptorSetLayout>(vf_,
+                                                         device_->getVkDevice(),
+                                                         VkDescriptorSetLayoutCreateFlags{},
+                                                         numBindings,
+                                                         bindings,
+                                                         bindingFlags.data(),
+                                                         debugName);
+  dslCache_[key] = dsl;
+  return dsl;
+}
+
 void VulkanContext::querySurfaceCapabilities() {
   // This is not an exhaustive list. It's only formats that we are using.
   // @fb-only
@@ -1393,22 +1995,47 @@ VkFormat VulkanContext::getClosestDepthStencilFormat(igl::TextureFormat desiredF
 }
 
 VulkanContext::RenderPassHandle VulkanContext::getRenderPass(uint8_t index) const {
+  const std::shared_lock lock(renderPassesMutex_);
   return RenderPassHandle{renderPasses_[index], index};
 }
 
+VulkanProgrammableResolve& VulkanContext::getOrCreateProgrammableResolve() const {
+  const std::lock_guard<std::mutex> lock(programmableResolveMutex_);
+  if (!programmableResolve_) {
+    programmableResolve_ = std::make_unique<VulkanProgrammableResolve>(*this);
+  }
+  return *programmableResolve_;
+}
+
 VulkanContext::RenderPassHandle VulkanContext::findRenderPass(
     const VulkanRenderPassBuilder& builder) const {
   IGL_PROFILER_FUNCTION();
 
-  auto it = renderPassesHash_.find(builder);
+  {
+    const std::shared_lock lock(renderPassesMutex_);
+
+    const auto it = renderPassesHash_.find(builder);
 
-  if (it != renderPassesHash_.end()) {
-    return RenderPassHandle{renderPasses_[it->second], it->second};
+    if (it != renderPassesHash_.end()) {
+      return RenderPassHandle{renderPasses_[it->second], it->second};
+    }
   }
 
+  // build the render pass without holding the lock, so other recording threads are not blocked on
+  // vkCreateRenderPass()
   VkRenderPass pass = VK_NULL_HANDLE;
   builder.build(vf_, device_->getVkDevice(), &pass);
 
+  const std::unique_lock lock(renderPassesMutex_);
+
+  const auto it = renderPassesHash_.find(builder);
+
+  if (it != renderPassesHash_.end()) {
+    // another thread created the same render pass while we were building ours
+    vf_.vkDestroyRenderPass(device_->getVkDevice(), pass, nullptr);
+    return RenderPassHandle{renderPasses_[it->second], it->second};
+  }
+
   const size_t index = renderPasses_.size();
 
   IGL_ASSERT(index <= 255);
@@ -1421,6 +2048,38 @@ VulkanContext::RenderPassHandle VulkanContext::findRenderPass(
   return RenderPassHandle{pass, uint8_t(index)};
 }
 
+util::SpvModuleInfo VulkanContext::getOrCreateSpvModuleInfo(const uint32_t* spirv,
+                                                            size_t numBytes) const {
+  IGL_PROFILER_FUNCTION();
+
+  // FNV-1a over the binary: SPIR-V generated from the same source is identical bit-for-bit, so a
+  // hash of the words uniquely identifies a module for the purpose of this cache
+  uint64_t hash = 0xcbf29ce484222325ull;
+  const size_t numWords = numBytes / sizeof(uint32_t);
+  for (size_t i = 0; i != numWords; i++) {
+    hash ^= spirv[i];
+    hash *= 0x100000001b3ull;
+  }
+
+  {
+    const std::lock_guard<std::mutex> lock(spvModuleInfoCacheMutex_);
+    const auto it = spvModuleInfoCache_.find(hash);
+    if (it != spvModuleInfoCache_.end()) {
+      return it->second;
+    }
+  }
+
+  // parse outside of the lock - modules can be reflected concurrently
+  util::SpvModuleInfo info = util::getReflectionData(spirv, numBytes);
+
+  {
+    const std::lock_guard<std::mutex> lock(spvModuleInfoCacheMutex_);
+    spvModuleInfoCache_[hash] = info;
+  }
+
+  return info;
+}
+
 std::vector<uint8_t> VulkanContext::getPipelineCacheData() const {
   VkDevice device = device_->getVkDevice();
 
@@ -1436,6 +2095,94 @@ std::vector<uint8_t> VulkanContext::getPipelineCacheData() const {
   return data;
 }
 
+namespace {
+
+// prepended to the raw vkGetPipelineCacheData() blob so that a cache file produced by a different
+// device, driver or an incompatible library version is rejected before it reaches the driver
+struct PipelineCacheFileHeader {
+  uint32_t magic = kMagic;
+  uint32_t version = kVersion;
+  uint32_t vendorID = 0;
+  uint32_t deviceID = 0;
+  uint32_t driverVersion = 0;
+  uint32_t dataSize = 0;
+  uint8_t pipelineCacheUUID[VK_UUID_SIZE] = {};
+
+  static constexpr uint32_t kMagic = 0x49474C50; // 'IGLP'
+  static constexpr uint32_t kVersion = 1;
+};
+
+} // namespace
+
+std::vector<uint8_t> VulkanContext::loadPipelineCacheFile() const {
+  std::FILE* file = std::fopen(config_.pipelineCacheFilePath.c_str(), "rb");
+  if (!file) {
+    return {};
+  }
+
+  PipelineCacheFileHeader header;
+  const bool isHeaderValid = std::fread(&header, sizeof(header), 1, file) == 1;
+
+  const VkPhysicalDeviceProperties& props = getVkPhysicalDeviceProperties();
+
+  if (!isHeaderValid || header.magic != PipelineCacheFileHeader::kMagic ||
+      header.version != PipelineCacheFileHeader::kVersion || header.vendorID != props.vendorID ||
+      header.deviceID != props.deviceID || header.driverVersion != props.driverVersion ||
+      memcmp(header.pipelineCacheUUID, props.pipelineCacheUUID, VK_UUID_SIZE) != 0) {
+    IGL_LOG_INFO("Ignoring incompatible pipeline cache file: %s\n",
+                 config_.pipelineCacheFilePath.c_str());
+    std::fclose(file);
+    return {};
+  }
+
+  std::vector<uint8_t> data(header.dataSize);
+
+  if (header.dataSize && std::fread(data.data(), 1, data.size(), file) != data.size()) {
+    data.clear();
+  }
+
+  std::fclose(file);
+
+  return data;
+}
+
+void VulkanContext::savePipelineCacheFile() const {
+  if (config_.pipelineCacheFilePath.empty() || pipelineCache_ == VK_NULL_HANDLE) {
+    return;
+  }
+
+  const std::vector<uint8_t> data = getPipelineCacheData();
+
+  if (data.empty()) {
+    return;
+  }
+
+  std::FILE* file = std::fopen(config_.pipelineCacheFilePath.c_str(), "wb");
+  if (!file) {
+    IGL_LOG_ERROR("Cannot write pipeline cache file: %s\n", config_.pipelineCacheFilePath.c_str());
+    return;
+  }
+
+  const VkPhysicalDeviceProperties& props = getVkPhysicalDeviceProperties();
+
+  PipelineCacheFileHeader header;
+  header.vendorID = props.vendorID;
+  header.deviceID = props.deviceID;
+  header.driverVersion = props.driverVersion;
+  header.dataSize = static_cast<uint32_t>(data.size());
+  memcpy(header.pipelineCacheUUID, props.pipelineCacheUUID, VK_UUID_SIZE);
+
+  const bool ok = std::fwrite(&header, sizeof(header), 1, file) == 1 &&
+                  std::fwrite(data.data(), 1, data.size(), file) == data.size();
+
+  std::fclose(file);
+
+  if (!ok) {
+    IGL_LOG_ERROR("Failed writing pipeline cache file: %s\n",
+                  config_.pipelineCacheFilePath.c_str());
+  }
+}
+
 uint64_t VulkanContext::getFrameNumber() const {
   return swapchain_ ? swapchain_->getFrameNumber() : 0u;
 }
@@ -1448,19 +2195,15 @@ void VulkanContext::updateBindingsTextures(VkCommandBuffer cmdBuf,
                                            const util::SpvModuleInfo& info) const {
   IGL_PROFILER_FUNCTION();
 
+  const std::lock_guard<std::mutex> lock(bindingsUpdateMutex_);
+
   DescriptorPoolsArena& arena = pimpl_->getOrCreateArena_CombinedImageSamplers(
       *this, dsl.getVkDescriptorSetLayout(), dsl.numBindings_);
 
-  VkDescriptorSet dset = arena.getNextDescriptorSet(*immediate_, pimpl_->lastSubmitHandle_);
-
   // @fb-only
   VkDescriptorImageInfo infoSampledImages[IGL_TEXTURE_SAMPLERS_MAX]; // uninitialized
   uint32_t numImages = 0;
 
-  // @fb-only
-  VkWriteDescriptorSet writes[IGL_TEXTURE_SAMPLERS_MAX]; // uninitialized
-  uint32_t numWrites = 0;
-
   // make sure the guard value is always there
   IGL_ASSERT(!textures_.objects_.empty());
   IGL_ASSERT(!samplers_.objects_.empty());
@@ -1471,6 +2214,11 @@ void VulkanContext::updateBindingsTextures(VkCommandBuffer cmdBuf,
 
   const bool isGraphics = bindPoint == VK_PIPELINE_BIND_POINT_GRAPHICS;
 
+  // collect the (location, sampler, image view) triples we are about to write - recurring
+  // combinations re-bind an already written descriptor set instead of writing a new one
+  uint64_t key[IGL_TEXTURE_SAMPLERS_MAX * 3]; // uninitialized
+  uint32_t numKeyWords = 0;
+
   for (const util::TextureDescription& d : info.textures) {
     IGL_ASSERT(d.descriptorSet == kBindPoint_CombinedImageSamplers);
     const uint32_t loc = d.bindingLocation;
@@ -1484,65 +2232,164 @@ void VulkanContext::updateBindingsTextures(VkCommandBuffer cmdBuf,
     const bool isTextureAvailable =
         texture && ((texture->image_->samples_ & VK_SAMPLE_COUNT_1_BIT) == VK_SAMPLE_COUNT_1_BIT);
     const bool isSampledImage = isTextureAvailable && texture->image_->isSampledImage();
-    writes[numWrites++] = ivkGetWriteDescriptorSet_ImageInfo(
-        dset, loc, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1, &infoSampledImages[numImages]);
-    infoSampledImages[numImages++] = {isSampledImage ? sampler : dummySampler,
-                                      isSampledImage ? texture->imageView_->getVkImageView()
-                                                     : dummyImageView,
-                                      VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL};
-  }
+    infoSampledImages[numImages] = {isSampledImage ? sampler : dummySampler,
+                                    isSampledImage ? texture->imageView_->getVkImageView()
+                                                   : dummyImageView,
+                                    VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL};
+    key[numKeyWords++] = loc;
+    key[numKeyWords++] = (uint64_t)infoSampledImages[numImages].sampler;
+    key[numKeyWords++] = (uint64_t)infoSampledImages[numImages].imageView;
+    numImages++;
+  }
+
+  if (numImages) {
+    const uint64_t hash = hashBindingKey(key, numKeyWords);
+
+    VkDescriptorSet dset = arena.findCachedDescriptorSet(hash, key, numKeyWords);
+
+    if (dset == VK_NULL_HANDLE) {
+      dset = arena.getNextDescriptorSet(*immediate_, pimpl_->lastSubmitHandle_);
+
+      // @fb-only
+      VkWriteDescriptorSet writes[IGL_TEXTURE_SAMPLERS_MAX]; // uninitialized
+      uint32_t numWrites = 0;
+      uint32_t imageIndex = 0;
+
+      for (const util::TextureDescription& d : info.textures) {
+        writes[numWrites++] = ivkGetWriteDescriptorSet_ImageInfo(dset,
+                                                                 d.bindingLocation,
+                                                                 VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+                                                                 1,
+                                                                 &infoSampledImages[imageIndex++]);
+      }
 
-  if (numWrites) {
-    IGL_PROFILER_ZONE("vkUpdateDescriptorSets()", IGL_PROFILER_COLOR_UPDATE);
-    vf_.vkUpdateDescriptorSets(device_->getVkDevice(), numWrites, writes, 0, nullptr);
-    IGL_PROFILER_ZONE_END();
+      IGL_PROFILER_ZONE("vkUpdateDescriptorSets()", IGL_PROFILER_COLOR_UPDATE);
+      vf_.vkUpdateDescriptorSets(device_->getVkDevice(), numWrites, writes, 0, nullptr);
+      IGL_PROFILER_ZONE_END();
+
+      arena.cacheDescriptorSet(hash, key, numKeyWords, dset);
+    }
 
 #if IGL_VULKAN_PRINT_COMMANDS
     IGL_LOG_INFO("%p vkCmdBindDescriptorSets(%u) - textures\n", cmdBuf, bindPoint);
 #endif // IGL_VULKAN_PRINT_COMMANDS
-    vf_.vkCmdBindDescriptorSets(
+    IGL_VULKAN_HOT_FN(vf_, vkCmdBindDescriptorSets)(
         cmdBuf, bindPoint, layout, kBindPoint_CombinedImageSamplers, 1, &dset, 0, nullptr);
   }
 }
 
+bool VulkanContext::isInlineUniformBlock(uint32_t blockSizeBytes) const {
+  // VUID-VkWriteDescriptorSetInlineUniformBlock-dataSize-02222: the data size must be a multiple
+  // of 4. Blocks whose size could not be reflected from the SPIR-V (0) always go through a
+  // uniform buffer
+  return useInlineUniformBlocks_ && blockSizeBytes > 0 && blockSizeBytes % 4 == 0 &&
+         blockSizeBytes <= kInlineUniformBlockMaxSize &&
+         blockSizeBytes <= vkPhysicalDeviceInlineUniformBlockProperties_.maxInlineUniformBlockSize;
+}
+
 void VulkanContext::updateBindingsUniformBuffers(VkCommandBuffer cmdBuf,
                                                  VkPipelineLayout layout,
                                                  VkPipelineBindPoint bindPoint,
                                                  BindingsBuffers& data,
+                                                 const BindingsInlineUniforms& inlineData,
                                                  const VulkanDescriptorSetLayout& dsl,
                                                  const util::SpvModuleInfo& info) const {
   IGL_PROFILER_FUNCTION();
 
-  DescriptorPoolsArena& arena = pimpl_->getOrCreateArena_UniformBuffers(
-      *this, dsl.getVkDescriptorSetLayout(), dsl.numBindings_);
+  const std::lock_guard<std::mutex> lock(bindingsUpdateMutex_);
 
-  VkDescriptorSet dsetBufUniform =
-      arena.getNextDescriptorSet(*immediate_, pimpl_->lastSubmitHandle_);
+  // bindings promoted to inline uniform blocks size the pool in bytes, not in descriptors
+  uint32_t numBufferBindings = 0;
+  uint32_t numInlineBindings = 0;
+  uint32_t numInlineBytes = 0;
+  for (const util::BufferDescription& b : info.uniformBuffers) {
+    if (isInlineUniformBlock(b.size)) {
+      numInlineBindings++;
+      numInlineBytes += b.size;
+    } else {
+      numBufferBindings++;
+    }
+  }
 
-  // @fb-only
-  VkWriteDescriptorSet writes[IGL_UNIFORM_BLOCKS_BINDING_MAX]; // uninitialized
-  uint32_t numWrites = 0;
+  DescriptorPoolsArena& arena = pimpl_->getOrCreateArena_UniformBuffers(
+      *this, dsl.getVkDescriptorSetLayout(), numBufferBindings, numInlineBindings, numInlineBytes);
+
+  // per binding: the location plus either the inline data words or (buffer, offset, range);
+  // the array is uninitialized
+  uint64_t key[IGL_UNIFORM_BLOCKS_BINDING_MAX * (1 + kInlineUniformBlockMaxSize / 4)];
+  uint32_t numKeyWords = 0;
 
   for (const util::BufferDescription& b : info.uniformBuffers) {
     IGL_ASSERT(b.descriptorSet == kBindPoint_BuffersUniform);
-    writes[numWrites++] = ivkGetWriteDescriptorSet_BufferInfo(dsetBufUniform,
-                                                              b.bindingLocation,
-                                                              VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
-                                                              1,
-                                                              &data.buffers[b.bindingLocation]);
+    key[numKeyWords++] = b.bindingLocation;
+    if (isInlineUniformBlock(b.size)) {
+      // the descriptor content is the data itself - key on the bytes
+      const uint8_t* bytes = inlineData.data[b.bindingLocation];
+      for (uint32_t ofs = 0; ofs != b.size; ofs += 4) {
+        uint32_t word;
+        memcpy(&word, bytes + ofs, sizeof(word));
+        key[numKeyWords++] = ((uint64_t)ofs << 32) | word;
+      }
+      continue;
+    }
+    const VkDescriptorBufferInfo& bi = data.buffers[b.bindingLocation];
+    key[numKeyWords++] = (uint64_t)bi.buffer;
+    key[numKeyWords++] = bi.offset;
+    key[numKeyWords++] = bi.range;
   }
 
-  if (numWrites) {
+  if (info.uniformBuffers.empty()) {
+    return;
+  }
+
+  const uint64_t hash = hashBindingKey(key, numKeyWords);
+
+  VkDescriptorSet dsetBufUniform = arena.findCachedDescriptorSet(hash, key, numKeyWords);
+
+  if (dsetBufUniform == VK_NULL_HANDLE) {
+    dsetBufUniform = arena.getNextDescriptorSet(*immediate_, pimpl_->lastSubmitHandle_);
+
+    // @fb-only
+    VkWriteDescriptorSet writes[IGL_UNIFORM_BLOCKS_BINDING_MAX]; // uninitialized
+    VkWriteDescriptorSetInlineUniformBlockEXT inlineWrites[IGL_UNIFORM_BLOCKS_BINDING_MAX];
+    uint32_t numWrites = 0;
+    uint32_t numInlineWrites = 0;
+
+    for (const util::BufferDescription& b : info.uniformBuffers) {
+      if (isInlineUniformBlock(b.size)) {
+        inlineWrites[numInlineWrites] = {
+            VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_INLINE_UNIFORM_BLOCK_EXT,
+            nullptr,
+            b.size,
+            inlineData.data[b.bindingLocation]};
+        VkWriteDescriptorSet& write = writes[numWrites++];
+        write = ivkGetWriteDescriptorSet_BufferInfo(dsetBufUniform,
+                                                    b.bindingLocation,
+                                                    VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT,
+                                                    b.size,
+                                                    nullptr);
+        write.pNext = &inlineWrites[numInlineWrites++];
+        continue;
+      }
+      writes[numWrites++] = ivkGetWriteDescriptorSet_BufferInfo(dsetBufUniform,
+                                                                b.bindingLocation,
+                                                                VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
+                                                                1,
+                                                                &data.buffers[b.bindingLocation]);
+    }
+
     IGL_PROFILER_ZONE("vkUpdateDescriptorSets()", IGL_PROFILER_COLOR_UPDATE);
     vf_.vkUpdateDescriptorSets(device_->getVkDevice(), numWrites, writes, 0, nullptr);
     IGL_PROFILER_ZONE_END();
 
+    arena.cacheDescriptorSet(hash, key, numKeyWords, dsetBufUniform);
+  }
+
 #if IGL_VULKAN_PRINT_COMMANDS
-    IGL_LOG_INFO("%p vkCmdBindDescriptorSets(%u) - uniform buffers\n", cmdBuf, bindPoint);
+  IGL_LOG_INFO("%p vkCmdBindDescriptorSets(%u) - uniform buffers\n", cmdBuf, bindPoint);
 #endif // IGL_VULKAN_PRINT_COMMANDS
-    vf_.vkCmdBindDescriptorSets(
-        cmdBuf, bindPoint, layout, kBindPoint_BuffersUniform, 1, &dsetBufUniform, 0, nullptr);
-  }
+  IGL_VULKAN_HOT_FN(vf_, vkCmdBindDescriptorSets)(
+      cmdBuf, bindPoint, layout, kBindPoint_BuffersUniform, 1, &dsetBufUniform, 0, nullptr);
 }
 
 void VulkanContext::updateBindingsStorageBuffers(VkCommandBuffer cmdBuf,
@@ -1553,36 +2400,59 @@ void VulkanContext::updateBindingsStorageBuffers(VkCommandBuffer cmdBuf,
                                                  const util::SpvModuleInfo& info) const {
   IGL_PROFILER_FUNCTION();
 
+  const std::lock_guard<std::mutex> lock(bindingsUpdateMutex_);
+
   DescriptorPoolsArena& arena = pimpl_->getOrCreateArena_StorageBuffers(
       *this, dsl.getVkDescriptorSetLayout(), dsl.numBindings_);
 
-  VkDescriptorSet dsetBufStorage =
-      arena.getNextDescriptorSet(*immediate_, pimpl_->lastSubmitHandle_);
-
-  // @fb-only
-  VkWriteDescriptorSet writes[IGL_UNIFORM_BLOCKS_BINDING_MAX]; // uninitialized
-  uint32_t numWrites = 0;
+  // per binding: (location, buffer, offset, range)
+  uint64_t key[IGL_UNIFORM_BLOCKS_BINDING_MAX * 4]; // uninitialized
+  uint32_t numKeyWords = 0;
 
   for (const util::BufferDescription& b : info.storageBuffers) {
     IGL_ASSERT(b.descriptorSet == kBindPoint_BuffersStorage);
-    writes[numWrites++] = ivkGetWriteDescriptorSet_BufferInfo(dsetBufStorage,
-                                                              b.bindingLocation,
-                                                              VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
-                                                              1,
-                                                              &data.buffers[b.bindingLocation]);
+    const VkDescriptorBufferInfo& bi = data.buffers[b.bindingLocation];
+    key[numKeyWords++] = b.bindingLocation;
+    key[numKeyWords++] = (uint64_t)bi.buffer;
+    key[numKeyWords++] = bi.offset;
+    key[numKeyWords++] = bi.range;
+  }
+
+  if (info.storageBuffers.empty()) {
+    return;
   }
 
-  if (numWrites) {
+  const uint64_t hash = hashBindingKey(key, numKeyWords);
+
+  VkDescriptorSet dsetBufStorage = arena.findCachedDescriptorSet(hash, key, numKeyWords);
+
+  if (dsetBufStorage == VK_NULL_HANDLE) {
+    dsetBufStorage = arena.getNextDescriptorSet(*immediate_, pimpl_->lastSubmitHandle_);
+
+    // @fb-only
+    VkWriteDescriptorSet writes[IGL_UNIFORM_BLOCKS_BINDING_MAX]; // uninitialized
+    uint32_t numWrites = 0;
+
+    for (const util::BufferDescription& b : info.storageBuffers) {
+      writes[numWrites++] = ivkGetWriteDescriptorSet_BufferInfo(dsetBufStorage,
+                                                                b.bindingLocation,
+                                                                VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+                                                                1,
+                                                                &data.buffers[b.bindingLocation]);
+    }
+
     IGL_PROFILER_ZONE("vkUpdateDescriptorSets()", IGL_PROFILER_COLOR_UPDATE);
     vf_.vkUpdateDescriptorSets(device_->getVkDevice(), numWrites, writes, 0, nullptr);
     IGL_PROFILER_ZONE_END();
 
+    arena.cacheDescriptorSet(hash, key, numKeyWords, dsetBufStorage);
+  }
+
 #if IGL_VULKAN_PRINT_COMMANDS
-    IGL_LOG_INFO("%p vkCmdBindDescriptorSets(%u) - storage buffers\n", cmdBuf, bindPoint);
+  IGL_LOG_INFO("%p vkCmdBindDescriptorSets(%u) - storage buffers\n", cmdBuf, bindPoint);
 #endif // IGL_VULKAN_PRINT_COMMANDS
-    vf_.vkCmdBindDescriptorSets(
-        cmdBuf, bindPoint, layout, kBindPoint_BuffersStorage, 1, &dsetBufStorage, 0, nullptr);
-  }
+  IGL_VULKAN_HOT_FN(vf_, vkCmdBindDescriptorSets)(
+      cmdBuf, bindPoint, layout, kBindPoint_BuffersStorage, 1, &dsetBufStorage, 0, nullptr);
 }
 
 void VulkanContext::markSubmitted(const VulkanImmediateCommands::SubmitHandle& handle) const {
@@ -1593,6 +2463,7 @@ void VulkanContext::deferredTask(std::packaged_task<void()>&& task, SubmitHandle
   if (handle.empty()) {
     handle = immediate_->getLastSubmitHandle();
   }
+  const std::lock_guard<std::mutex> lock(deferredTasksMutex_);
   deferredTasks_.emplace_back(std::move(task), handle);
   deferredTasks_.back().frameId_ = this->getFrameNumber();
 }
@@ -1605,30 +2476,349 @@ void* VulkanContext::getVmaAllocator() const {
   return pimpl_->vma_;
 }
 
+bool VulkanContext::getMemoryStatistics(DeviceMemoryStatistics& outStatistics) const {
+  IGL_PROFILER_FUNCTION();
+
+  VkPhysicalDeviceMemoryProperties memoryProperties = {};
+  vf_.vkGetPhysicalDeviceMemoryProperties(vkPhysicalDevice_, &memoryProperties);
+
+  if (!IGL_VERIFY(memoryProperties.memoryHeapCount <= DeviceMemoryStatistics::kMaxHeaps)) {
+    return false;
+  }
+
+  outStatistics.heapCount = memoryProperties.memoryHeapCount;
+  for (uint32_t i = 0; i != memoryProperties.memoryHeapCount; i++) {
+    outStatistics.heaps[i] = {};
+    outStatistics.heaps[i].isDeviceLocal =
+        (memoryProperties.memoryHeaps[i].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) != 0;
+  }
+
+  bool haveHeapUsage = false;
+
+#if defined(VK_EXT_memory_budget)
+  if (extensions_.enabled(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME) &&
+      vf_.vkGetPhysicalDeviceMemoryProperties2 != nullptr) {
+    VkPhysicalDeviceMemoryBudgetPropertiesEXT budgetProperties = {
+        VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT, nullptr};
+    VkPhysicalDeviceMemoryProperties2 memoryProperties2 = {
+        VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2, &budgetProperties};
+    vf_.vkGetPhysicalDeviceMemoryProperties2(vkPhysicalDevice_, &memoryProperties2);
+    for (uint32_t i = 0; i != memoryProperties.memoryHeapCount; i++) {
+      outStatistics.heaps[i].budgetBytes = budgetProperties.heapBudget[i];
+      outStatistics.heaps[i].usageBytes = budgetProperties.heapUsage[i];
+    }
+    haveHeapUsage = true;
+  }
+#endif // VK_EXT_memory_budget
+
+  if (!haveHeapUsage && IGL_VULKAN_USE_VMA) {
+    // without VK_EXT_memory_budget, VMA reports its own allocations per heap and estimates the
+    // budget as a fraction of the heap size - this misses other processes but is still useful
+    VmaBudget budgets[VK_MAX_MEMORY_HEAPS] = {};
+    vmaGetHeapBudgets(pimpl_->vma_, budgets);
+    for (uint32_t i = 0; i != memoryProperties.memoryHeapCount; i++) {
+      outStatistics.heaps[i].budgetBytes = budgets[i].budget;
+      outStatistics.heaps[i].usageBytes = budgets[i].usage;
+    }
+    haveHeapUsage = true;
+  }
+
+  outStatistics.bufferBytes = totalBufferAllocatedBytes_.load(std::memory_order_relaxed);
+  outStatistics.textureBytes = totalImageAllocatedBytes_.load(std::memory_order_relaxed);
+  outStatistics.uncompressedAttachmentBytes =
+      totalUncompressedAttachmentBytes_.load(std::memory_order_relaxed);
+
+  return haveHeapUsage;
+}
+
+void VulkanContext::writeGpuBreadcrumb(VkCommandBuffer cmdBuffer, const char* label) const {
+  if (!breadcrumbBuffer_) {
+    return;
+  }
+  const uint32_t value = ++breadcrumbCounter_; // 1-based; 0 in the ring means "never reached"
+  {
+    const std::lock_guard<std::mutex> lock(breadcrumbsMutex_);
+    breadcrumbLabels_[value % kNumGpuBreadcrumbs] = label;
+  }
+  const VkDeviceSize offset = (value % kNumGpuBreadcrumbs) * sizeof(uint32_t);
+  if (useBufferMarkerAMD_) {
+    vf_.vkCmdWriteBufferMarkerAMD(cmdBuffer,
+                                  VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                                  breadcrumbBuffer_->getVkBuffer(),
+                                  offset,
+                                  value);
+  } else {
+    // transfer-stage write: coarser than a bottom-of-pipe marker, but available everywhere.
+    // Unlike vkCmdWriteBufferMarkerAMD() this is illegal inside a render pass, which is why the
+    // built-in breadcrumbs are only written at encoder boundaries
+    vf_.vkCmdFillBuffer(
+        cmdBuffer, breadcrumbBuffer_->getVkBuffer(), offset, sizeof(uint32_t), value);
+  }
+  if (useDiagnosticCheckpoints_) {
+    vf_.vkCmdSetCheckpointNV(cmdBuffer,
+                             reinterpret_cast<const void*>(static_cast<uintptr_t>(value)));
+  }
+}
+
+std::string VulkanContext::getGpuBreadcrumbReport() const {
+  if (!breadcrumbBuffer_ || !breadcrumbBuffer_->isMapped()) {
+    return {};
+  }
+  const uint32_t lastRecorded = breadcrumbCounter_.load();
+  if (lastRecorded == 0) {
+    return {};
+  }
+
+  // the ring slots hold the marker values the GPU wrote, so the highest one is the last
+  // breadcrumb it reached (bottom-of-pipe with VK_AMD_buffer_marker)
+  const auto* markers = reinterpret_cast<const uint32_t*>(breadcrumbBuffer_->getMappedPtr());
+  uint32_t lastReached = 0;
+  for (uint32_t i = 0; i != kNumGpuBreadcrumbs; i++) {
+    lastReached = std::max(lastReached, markers[i]);
+  }
+
+  std::string report;
+  const std::lock_guard<std::mutex> lock(breadcrumbsMutex_);
+  if (lastReached == 0) {
+    report = "GPU breadcrumbs: no marker was reached\n";
+  } else {
+    report = IGL_FORMAT("GPU breadcrumbs: last marker reached #{} '{}'\n",
+                        lastReached,
+                        breadcrumbLabels_[lastReached % kNumGpuBreadcrumbs]);
+  }
+  // everything recorded after the last reached marker never completed on the GPU; labels older
+  // than the ring capacity were overwritten and cannot be listed
+  const uint32_t firstListable = lastRecorded > kNumGpuBreadcrumbs - 1
+                                     ? std::max(lastReached + 1, lastRecorded - kNumGpuBreadcrumbs + 1)
+                                     : lastReached + 1;
+  for (uint32_t v = firstListable; v <= lastRecorded; v++) {
+    report += IGL_FORMAT("  pending #{} '{}'\n", v, breadcrumbLabels_[v % kNumGpuBreadcrumbs]);
+  }
+
+  if (useDiagnosticCheckpoints_ && vf_.vkGetQueueCheckpointDataNV != nullptr) {
+    uint32_t count = 0;
+    vf_.vkGetQueueCheckpointDataNV(deviceQueues_.graphicsQueue, &count, nullptr);
+    std::vector<VkCheckpointDataNV> checkpoints(count);
+    for (auto& checkpoint : checkpoints) {
+      checkpoint = {VK_STRUCTURE_TYPE_CHECKPOINT_DATA_NV, nullptr, VkPipelineStageFlagBits(0), nullptr};
+    }
+    vf_.vkGetQueueCheckpointDataNV(deviceQueues_.graphicsQueue, &count, checkpoints.data());
+    for (const auto& checkpoint : checkpoints) {
+      report += IGL_FORMAT("  checkpoint: stage {:#x} marker #{}\n",
+                           static_cast<uint64_t>(checkpoint.stage),
+                           static_cast<uint32_t>(
+                               reinterpret_cast<uintptr_t>(checkpoint.pCheckpointMarker)));
+    }
+  }
+  return report;
+}
+
+void VulkanContext::registerDefragmentableBuffer(void* vmaAllocation, VulkanBuffer* buffer) const {
+  const std::lock_guard<std::mutex> lock(defragMutex_);
+  defragBuffers_[vmaAllocation] = buffer;
+}
+
+void VulkanContext::unregisterDefragmentableBuffer(void* vmaAllocation) const {
+  const std::lock_guard<std::mutex> lock(defragMutex_);
+  defragBuffers_.erase(vmaAllocation);
+}
+
+void VulkanContext::registerPendingBufferUpload(Buffer* buffer) const {
+  const std::lock_guard<std::mutex> lock(pendingUploadsMutex_);
+  pendingUploadBuffers_.push_back(buffer);
+}
+
+void VulkanContext::unregisterPendingBufferUpload(Buffer* buffer) const {
+  const std::lock_guard<std::mutex> lock(pendingUploadsMutex_);
+  pendingUploadBuffers_.erase(
+      std::remove(pendingUploadBuffers_.begin(), pendingUploadBuffers_.end(), buffer),
+      pendingUploadBuffers_.end());
+}
+
+void VulkanContext::flushPendingBufferUploads() const {
+  IGL_PROFILER_FUNCTION();
+
+  // the buffers are flushed while the registry lock is held so a buffer destroyed on another
+  // thread cannot slip out from under us between the snapshot and the flush; the lock ordering
+  // (registry mutex, then the per-buffer and staging device mutexes) is never taken in reverse
+  const std::lock_guard<std::mutex> lock(pendingUploadsMutex_);
+  for (Buffer* buffer : pendingUploadBuffers_) {
+    buffer->flushPendingUploads();
+  }
+  pendingUploadBuffers_.clear();
+}
+
+void VulkanContext::processDefragmentation() const {
+  IGL_PROFILER_FUNCTION();
+
+  if (!IGL_VULKAN_USE_VMA || !config_.enableDefragmentation) {
+    return;
+  }
+
+  const VmaAllocator vma = pimpl_->vma_;
+
+  if (!defragContext_) {
+    const VmaDefragmentationInfo info = {
+        .flags = VMA_DEFRAGMENTATION_FLAG_ALGORITHM_BALANCED_BIT,
+        .maxAllocationsPerPass = config_.defragmentationMaxMovesPerPass,
+    };
+    VmaDefragmentationContext context = VK_NULL_HANDLE;
+    if (vmaBeginDefragmentation(vma, &info, &context) != VK_SUCCESS) {
+      return;
+    }
+    defragContext_ = context;
+  }
+
+  VmaDefragmentationPassMoveInfo pass = {};
+  const VkResult result =
+      vmaBeginDefragmentationPass(vma, (VmaDefragmentationContext)defragContext_, &pass);
+
+  if (result == VK_SUCCESS) {
+    // no moves are left - the heaps are as compact as the algorithm can make them
+    VmaDefragmentationStats stats = {};
+    vmaEndDefragmentation(vma, (VmaDefragmentationContext)defragContext_, &stats);
+    defragContext_ = nullptr;
+    if (stats.allocationsMoved && config_.enableExtraLogs) {
+      IGL_LOG_INFO("Defragmentation moved %u allocations (%llu bytes), freed %llu bytes\n",
+                   stats.allocationsMoved,
+                   (unsigned long long)stats.bytesMoved,
+                   (unsigned long long)stats.bytesFreed);
+    }
+    return;
+  }
+
+  if (!IGL_VERIFY(result == VK_INCOMPLETE)) {
+    vmaEndDefragmentation(vma, (VmaDefragmentationContext)defragContext_, nullptr);
+    defragContext_ = nullptr;
+    return;
+  }
+
+  // create the destination buffers bound to the new memory locations
+  struct BufferMove {
+    VulkanBuffer* buffer = nullptr;
+    VkBuffer newBuffer = VK_NULL_HANDLE;
+  };
+  std::vector<BufferMove> moves;
+  moves.reserve(pass.moveCount);
+  {
+    const std::lock_guard<std::mutex> lock(defragMutex_);
+    for (uint32_t i = 0; i != pass.moveCount; i++) {
+      VmaDefragmentationMove& move = pass.pMoves[i];
+      const auto it = defragBuffers_.find(move.srcAllocation);
+      if (it == defragBuffers_.end()) {
+        // images and non-movable buffers (host-mapped, device address) stay in place
+        move.operation = VMA_DEFRAGMENTATION_MOVE_OPERATION_IGNORE;
+        continue;
+      }
+      VulkanBuffer* buffer = it->second;
+      const VkBufferCreateInfo ci =
+          ivkGetBufferCreateInfo(buffer->getSize(), buffer->getBufferUsageFlags());
+      VkBuffer newBuffer = VK_NULL_HANDLE;
+      if (vf_.vkCreateBuffer(getVkDevice(), &ci, nullptr, &newBuffer) != VK_SUCCESS ||
+          vmaBindBufferMemory(vma, move.dstTmpAllocation, newBuffer) != VK_SUCCESS) {
+        if (newBuffer != VK_NULL_HANDLE) {
+          vf_.vkDestroyBuffer(getVkDevice(), newBuffer, nullptr);
+        }
+        move.operation = VMA_DEFRAGMENTATION_MOVE_OPERATION_IGNORE;
+        continue;
+      }
+      moves.push_back({buffer, newBuffer});
+    }
+  }
+
+  if (!moves.empty()) {
+    // copy the contents on the GPU and wait: passes run between frames, so the wait is short
+    const auto& wrapper = immediate_->acquire();
+    for (const BufferMove& move : moves) {
+      const VkBufferCopy region = {0, 0, move.buffer->getSize()};
+      vf_.vkCmdCopyBuffer(wrapper.cmdBuf_, move.buffer->getVkBuffer(), move.newBuffer, 1, &region);
+    }
+    immediate_->wait(immediate_->submit(wrapper));
+
+    // patch the owners: the old VkBuffer handles are released through deferred tasks, while the
+    // VmaAllocation handles stay valid and point at the new memory after the pass ends
+    for (const BufferMove& move : moves) {
+      move.buffer->exchangeDefragmentedBuffer(move.newBuffer);
+    }
+  }
+
+  vmaEndDefragmentationPass(vma, (VmaDefragmentationContext)defragContext_, &pass);
+}
+
 void VulkanContext::processDeferredTasks() const {
   IGL_PROFILER_FUNCTION();
 
   const uint64_t frameId = getFrameNumber();
   constexpr uint64_t kNumWaitFrames = 1u;
 
-  while (!deferredTasks_.empty() && immediate_->isRecycled(deferredTasks_.front().handle_)) {
-    if (frameId && frameId <= deferredTasks_.front().frameId_ + kNumWaitFrames) {
-      // do not check anything if it is not yet older than kNumWaitFrames
-      break;
+  const uint32_t budget = config_.maxDeferredTasksPerSubmit;
+  uint32_t numProcessed = 0;
+
+  while (true) {
+    std::packaged_task<void()> task;
+    {
+      const std::lock_guard<std::mutex> lock(deferredTasksMutex_);
+      if (deferredTasks_.empty() || !immediate_->isRecycled(deferredTasks_.front().handle_)) {
+        break;
+      }
+      if (frameId && frameId <= deferredTasks_.front().frameId_ + kNumWaitFrames) {
+        // do not check anything if it is not yet older than kNumWaitFrames
+        break;
+      }
+      if (budget && numProcessed >= budget) {
+        // the budget is exhausted; the remaining backlog stays queued - the deque is ordered by
+        // submission, so later calls keep draining it oldest-first until it is empty
+        break;
+      }
+      task = std::move(deferredTasks_.front().task_);
+      deferredTasks_.pop_front();
     }
-    deferredTasks_.front().task_();
-    deferredTasks_.pop_front();
+    // run the task outside of the lock: destroying a resource inside a task can enqueue another
+    // deferred task
+    task();
+    numProcessed++;
+  }
+}
+
+void VulkanContext::retireFrameDescriptorPools() const {
+  IGL_PROFILER_FUNCTION();
+
+  for (auto& [dsl, arena] : pimpl_->arenaCombinedImageSamplers_) {
+    arena->retireExtinctPools(*immediate_);
+  }
+  for (auto& [dsl, arena] : pimpl_->arenaBuffersUniform_) {
+    arena->retireExtinctPools(*immediate_);
+  }
+  for (auto& [dsl, arena] : pimpl_->arenaBuffersStorage_) {
+    arena->retireExtinctPools(*immediate_);
+  }
+}
+
+void VulkanContext::advanceFrameUniformRing() const {
+  if (uniformRingBuffer_) {
+    uniformRingBuffer_->nextRegion();
   }
 }
 
 void VulkanContext::waitDeferredTasks() {
   IGL_PROFILER_FUNCTION_COLOR(IGL_PROFILER_COLOR_WAIT);
 
-  for (auto& task : deferredTasks_) {
-    immediate_->wait(task.handle_);
-    task.task_();
+  // drain the whole backlog, including tasks enqueued by the tasks themselves
+  while (true) {
+    std::deque<DeferredTask> tasks;
+    {
+      const std::lock_guard<std::mutex> lock(deferredTasksMutex_);
+      tasks = std::move(deferredTasks_);
+      deferredTasks_.clear();
+    }
+    if (tasks.empty()) {
+      break;
+    }
+    for (auto& task : tasks) {
+      immediate_->wait(task.handle_);
+      task.task_();
+    }
   }
-  deferredTasks_.clear();
 }
 
 VkDescriptorSetLayout VulkanContext::getBindlessVkDescriptorSetLayout() const {
@@ -7,9 +7,14 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <deque>
 #include <future>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
 #include <unordered_map>
 
 #include <igl/HWDevice.h>
@@ -21,18 +26,23 @@
 #include <igl/vulkan/VulkanImmediateCommands.h>
 #include <igl/vulkan/VulkanQueuePool.h>
 #include <igl/vulkan/VulkanRenderPassBuilder.h>
+#include <igl/vulkan/VulkanShaderPack.h>
 #include <igl/vulkan/VulkanStagingDevice.h>
+#include <igl/vulkan/VulkanUploadCalibration.h>
+#include <igl/vulkan/util/SpvReflection.h>
 
 #if defined(IGL_WITH_TRACY_GPU)
 #include "tracy/TracyVulkan.hpp"
 #endif
 
 namespace igl {
+
+struct DeviceMemoryStatistics;
+class TextureSampleFeedback;
+
 namespace vulkan {
-namespace util {
-struct SpvModuleInfo;
-} // namespace util
 
+class Buffer;
 class Device;
 class EnhancedShaderDebuggingStore;
 class CommandQueue;
@@ -40,17 +50,23 @@ class ComputeCommandEncoder;
 class RenderCommandEncoder;
 class SyncManager;
 class VulkanBuffer;
+class VulkanBufferPool;
+class VulkanUniformRingBuffer;
+class VulkanComputeMipmapGenerator;
 class VulkanDevice;
 class VulkanDescriptorSetLayout;
 class VulkanImage;
 class VulkanImageView;
 class VulkanPipelineLayout;
+class VulkanProgrammableResolve;
 class VulkanSampler;
 class VulkanSemaphore;
 class VulkanSwapchain;
 class VulkanTexture;
+class VulkanUploadScheduler;
 
 struct BindingsBuffers;
+struct BindingsInlineUniforms;
 struct BindingsTextures;
 struct VulkanContextImpl;
 struct VulkanImageCreateInfo;
@@ -70,13 +86,23 @@ enum {
   kBindPoint_Bindless = 3,
 };
 
+// Define IGL_VULKAN_ENHANCED_SHADER_DEBUGGING to 0 to compile the enhanced shader debugging hooks
+// out of the per-frame code paths entirely: the store is never created and all hooks fold away
+#if !defined(IGL_VULKAN_ENHANCED_SHADER_DEBUGGING)
+#define IGL_VULKAN_ENHANCED_SHADER_DEBUGGING 1
+#endif
+
 struct DeviceQueues {
   const static uint32_t INVALID = 0xFFFFFFFF;
   uint32_t graphicsQueueFamilyIndex = INVALID;
   uint32_t computeQueueFamilyIndex = INVALID;
+  // only valid when VulkanContextConfig::useDedicatedTransferQueue is enabled and the device
+  // exposes a transfer-capable family distinct from the graphics and compute families
+  uint32_t transferQueueFamilyIndex = INVALID;
 
   VkQueue graphicsQueue = VK_NULL_HANDLE;
   VkQueue computeQueue = VK_NULL_HANDLE;
+  VkQueue transferQueue = VK_NULL_HANDLE;
 
   DeviceQueues() = default;
 };
@@ -87,6 +113,10 @@ struct VulkanContextConfig {
   // enable/disable enhanced shader debugging capabilities (line drawing)
   bool enhancedShaderDebugging = false;
 
+  // when `enhancedShaderDebugging` is on, run the debugging pass only once every N frames
+  // (1 = every frame); the frames in between present directly and pay no per-frame cost
+  uint32_t enhancedShaderDebuggingSampleInterval = 1u;
+
   bool enableConcurrentVkDevicesSupport = false;
 
   bool enableValidation = true;
@@ -102,15 +132,158 @@ struct VulkanContextConfig {
 
   uint32_t maxResourceCount = 3u;
 
+  // maximum number of deferred destruction tasks executed per submitted command buffer
+  // (0 = unbounded). Bounding it amortizes large destruction spikes - for example a scene unload
+  // retiring thousands of objects - across several frames instead of hitching on one
+  uint32_t maxDeferredTasksPerSubmit = 0u;
+
   // owned by the application - should be alive until initContext() returns
   const void* pipelineCacheData = nullptr;
   size_t pipelineCacheDataSize = 0;
 
+  // when non-empty, the pipeline cache is loaded from this file at startup (validated against the
+  // current device and driver) and written back at teardown. `pipelineCacheData` takes precedence
+  // when both are provided.
+  std::string pipelineCacheFilePath;
+
+  // when non-zero and a `pipelineCacheFilePath` is set, the cache file is also rewritten every N
+  // presented frames so that a crash does not lose all compiled pipelines
+  uint32_t pipelineCacheFileSaveInterval = 0;
+
+  // when non-empty, GLSL shader modules compiled by Device::createShaderModule() are cached on
+  // disk in this directory, keyed by a hash of the patched source. Sources seen on a previous run
+  // load the stored SPIR-V and skip the glslang front end entirely
+  std::string shaderCacheDirectoryPath;
+
+  // when non-empty, a pack of precompiled SPIR-V binaries (produced offline by the
+  // igl_shader_pack tool) is mapped at startup and consulted by Device::createShaderModule()
+  // before any runtime compilation. Together with IGL_VULKAN_NO_GLSLANG this removes the glslang
+  // front end from shipping binaries entirely (see VulkanShaderPack)
+  std::string shaderPackFilePath;
+
   // This enables fences generated at the end of submission to be exported to the client.
   // The client can then use the SubmitHandle to wait for the completion of the GPU work.
   bool exportableFences = false;
+
+  // route staging uploads to a dedicated VK_QUEUE_TRANSFER_BIT queue (when the device has one in
+  // a family separate from the graphics and compute queues) so that large texture and buffer
+  // streaming overlaps rendering; ownership is handed back to the graphics queue with semaphores
+  bool useDedicatedTransferQueue = false;
+
+  // place small non-ring uniform and storage buffer allocations into large shared VkBuffers and
+  // hand out offsets (see VulkanBufferPool), instead of creating one VkBuffer and one memory
+  // allocation per igl::vulkan::Buffer. This avoids the per-allocation granularity overhead and
+  // the allocation cost of thousands of tiny per-object buffers
+  bool enableBufferSuballocation = false;
+
+  // generate texture mip chains with compute dispatches instead of a serial chain of
+  // vkCmdBlitImage() calls when the image supports storage access (see
+  // VulkanComputeMipmapGenerator); images that do not qualify fall back to the blit path
+  bool enableComputeMipmapGeneration = false;
+
+  // schedule presents against predicted display refresh times with VK_GOOGLE_display_timing
+  // (when available), trading a little throughput for consistent frame latency. See
+  // VulkanSwapchain::present(). Ignored when the extension is not supported
+  bool enableDisplayTimingPacing = false;
+
+  // when binding a render pipeline state whose exact Vulkan pipeline has not been created yet,
+  // compile it on a background thread and render with a previously created pipeline (same shaders,
+  // different dynamic state) until it is ready, instead of stalling the frame on
+  // vkCreateGraphicsPipelines(). See RenderPipelineState::getVkPipelineOrFallback()
+  bool enablePipelineCompileFallback = false;
+
+  // track command buffer completion with a single VK_KHR_timeline_semaphore counter instead of one
+  // fence per command buffer, which avoids vkResetFences()/vkWaitForFences() on submission-heavy
+  // workloads. Requires VK_KHR_timeline_semaphore; silently falls back to fences when the device
+  // does not support it. Ignored when `exportableFences` is enabled, since no fences are submitted
+  // in this mode
+  bool enableTimelineSemaphores = false;
+
+  // begin rendering directly from the render pass description with VK_KHR_dynamic_rendering,
+  // creating no VkRenderPass/VkFramebuffer objects and skipping the per-pass cache lookups;
+  // graphics pipelines are built against attachment formats instead of render pass objects.
+  // Silently falls back to the cached render pass path when the device does not support the
+  // extension
+  bool enableDynamicRendering = false;
+
+  // when a render pass ends, keep it open inside the command buffer in case the next render pass
+  // can be merged into it: consecutive passes that target the same framebuffer with Load (or
+  // DontCare) load actions and no clears/resolves then run as one Vulkan pass, so tiled GPUs skip
+  // the attachment store+load round-trip through memory at the pass boundary. Passes that cannot
+  // merge are unaffected - the deferred end is recorded in the same position it would have been
+  bool enableRenderPassMerging = false;
+
+  // promote uniform blocks of at most kInlineUniformBlockMaxSize bytes to
+  // VK_EXT_inline_uniform_block descriptors: bindBytes() then writes the constants directly into
+  // the descriptor set and no uniform buffer is involved at all. Pipelines created while this is
+  // enabled expect every such block to be fed through bindBytes(); binding an IBuffer to a
+  // promoted slot is ignored. Silently falls back to binding uniform buffers when the device does
+  // not support the extension
+  bool enableInlineUniformBlocks = false;
+
+  // request VK_IMAGE_USAGE_STORAGE_BIT for swapchain images when the surface supports it, so
+  // compute shaders can write the swapchain directly. On desktop GPUs (notably AMD) the storage
+  // usage disables delta color compression (DCC) for the whole swapchain, taxing every pass that
+  // renders to it - disable this when no compute pass writes swapchain images
+  bool enableStorageSwapchainImages = true;
+
+  // query the driver-reported compression state of every created image with
+  // VK_EXT_image_compression_control; render-target bytes that end up uncompressed are reported
+  // through DeviceMemoryStatistics::uncompressedAttachmentBytes so accidental decompression (e.g.
+  // a speculative TextureUsageBits::Storage on a render target) shows up in telemetry instead of
+  // as silently lost bandwidth. Silently does nothing when the extension is unavailable
+  bool enableImageCompressionControl = false;
+
+  // record lightweight GPU progress breadcrumbs: every encoder begin/end writes a monotonically
+  // increasing marker into a small host-visible ring, via VK_AMD_buffer_marker where available
+  // and vkCmdFillBuffer otherwise, plus VK_NV_device_diagnostic_checkpoints when present. When a
+  // submission fails with VK_ERROR_DEVICE_LOST the last marker the GPU reached and the labels of
+  // the breadcrumbs still pending are logged (see getGpuBreadcrumbReport()). The cost is a few
+  // dwords per command buffer, cheap enough to leave enabled in production builds
+  bool enableGpuCrashBreadcrumbs = false;
+
+  // incrementally defragment the VMA heaps of long-running sessions: every
+  // `defragmentationFrameInterval` presented frames one VmaDefragmentationContext pass runs,
+  // moving up to `defragmentationMaxMovesPerPass` GPU-only buffers into tighter memory blocks
+  // and patching the VulkanBuffer handles transparently. This keeps large allocations from
+  // failing after hours of streaming even though plenty of memory is nominally free. Buffers
+  // that are host-mapped or expose a buffer device address are never moved, and images stay in
+  // place because their views and cached framebuffers reference the VkImage handle
+  bool enableDefragmentation = false;
+  uint32_t defragmentationFrameInterval = 120u;
+  uint32_t defragmentationMaxMovesPerPass = 8u;
+
+  // per-frame byte budget for Streaming and Background uploads scheduled through
+  // VulkanUploadScheduler (0 = unbounded). FrameCritical uploads are never budgeted; uploads
+  // larger than the remaining budget are split across frames
+  uint32_t maxScheduledUploadBytesPerFrame = 0u;
+
+  // runs a ~10 ms probe at device creation measuring staged-copy bandwidth, mapped-memory write
+  // throughput, and fixed per-upload latency for this device; the results drive per-device
+  // upload strategy selection instead of thresholds hand-tuned per SoC (see
+  // VulkanUploadCalibration)
+  bool enableUploadCalibration = false;
+
+  // remembers the content hashes of the last few uploads per buffer/texture and drops uploads
+  // whose destination range and bytes match a remembered one. Pure bandwidth win for UI-heavy
+  // workloads that re-upload identical glyph/image data every frame; costs one hash of the
+  // incoming bytes per upload (see UploadDeduplicator)
+  bool enableUploadDeduplication = false;
+
+  // kiosk/fullscreen: acquire a display through VK_KHR_display at context initialization and
+  // present directly to scanout, bypassing the compositor. Saves one frame of latency and the
+  // composition copy; falls back to the regular windowed swapchain when the extension is missing
+  // or no display/plane pair can be acquired
+  bool enableDirectToDisplay = false;
+  // explicit scanout format for the direct-to-display path (Invalid keeps the colorspace-driven
+  // swapchain selection); only honored when the display surface exposes the format
+  TextureFormat directToDisplayFormat = TextureFormat::Invalid;
 };
 
+/// Thread safety: resource creation (buffers, textures, samplers, pipelines) may be called from
+/// any thread - the caches and pools behind it take their own locks - while command recording and
+/// submission are confined to the thread that drives the frame loop. Releasing a resource is safe
+/// from any thread: destruction is parked through deferred tasks and drained on submission.
 class VulkanContext final {
  public:
   VulkanContext(const VulkanContextConfig& config,
@@ -158,7 +331,7 @@ class VulkanContext final {
                                              VkMemoryPropertyFlags memFlags,
                                              igl::Result* outResult,
                                              const char* debugName = nullptr) const;
-  std::shared_ptr<VulkanTexture> createTexture(std::unique_ptr<VulkanImage> image,
+  std::shared_ptr<VulkanTexture> createTexture(std::shared_ptr<VulkanImage> image,
                                                std::unique_ptr<VulkanImageView> imageView,
                                                const char* debugName) const;
   std::shared_ptr<VulkanTexture> createTextureFromVkImage(
@@ -171,10 +344,38 @@ class VulkanContext final {
                                                igl::Result* outResult,
                                                const char* debugName = nullptr) const;
 
+  /// @brief Returns a sampler for the given create info, deduplicated across all SamplerState
+  /// objects. `samplerHash` must be the perfect hash of the originating SamplerStateDesc (see
+  /// std::hash<igl::SamplerStateDesc>), so equal descriptors share one VkSampler. Fewer distinct
+  /// samplers means more hits in the descriptor set cache (see DescriptorPoolsArena), which keys
+  /// cached sets on the bound sampler handles. The cache holds weak references only: unused
+  /// samplers are still garbage collected by checkAndUpdateDescriptorSets()
+  std::shared_ptr<VulkanSampler> getOrCreateSampler(const VkSamplerCreateInfo& ci,
+                                                    size_t samplerHash,
+                                                    igl::Result* outResult,
+                                                    const char* debugName = nullptr) const;
+
+  /// @brief Returns a descriptor set layout with the given bindings, deduplicated across all
+  /// pipelines: pipelines whose shaders reflect the same bindings share one VkDescriptorSetLayout
+  /// handle. This is what makes pipeline layouts compatible under the Vulkan rules, which in turn
+  /// lets ResourcesBinder keep descriptor sets bound across pipeline switches (see
+  /// ResourcesBinder::bindPipeline()). The bindings must come from
+  /// ivkGetDescriptorSetLayoutBinding(), which uses fixed stage flags and descriptor counts
+  std::shared_ptr<VulkanDescriptorSetLayout> getOrCreateDescriptorSetLayout(
+      VkDescriptorType type,
+      uint32_t numBindings,
+      const VkDescriptorSetLayoutBinding* bindings,
+      const char* debugName) const;
+
   bool hasSwapchain() const noexcept {
     return swapchain_ != nullptr;
   }
 
+  /// @brief Returns true when a uniform block of `blockSizeBytes` bytes (as reflected from the
+  /// SPIR-V) is bound as a VK_EXT_inline_uniform_block descriptor instead of a uniform buffer.
+  /// See VulkanContextConfig::enableInlineUniformBlocks
+  bool isInlineUniformBlock(uint32_t blockSizeBytes) const;
+
   Result waitIdle() const;
   Result present() const;
 
@@ -197,6 +398,19 @@ class VulkanContext final {
   RenderPassHandle findRenderPass(const VulkanRenderPassBuilder& builder) const;
   RenderPassHandle getRenderPass(uint8_t index) const;
 
+  /// @brief Returns the pipelines and descriptor sets backing programmable MSAA resolves (see
+  /// RenderPassDesc::colorResolveShaderStages), creating them on first use
+  VulkanProgrammableResolve& getOrCreateProgrammableResolve() const;
+
+  /// @brief Installs the texture sample feedback recorder the encoders report texture binds to;
+  /// forwarded from IDevice::setTextureSampleFeedback()
+  void setTextureSampleFeedback(std::shared_ptr<TextureSampleFeedback> feedback) {
+    textureSampleFeedback_ = std::move(feedback);
+  }
+  const std::shared_ptr<TextureSampleFeedback>& textureSampleFeedback() const {
+    return textureSampleFeedback_;
+  }
+
   // OpenXR needs Vulkan instance to find physical device
   VkInstance getVkInstance() const {
     return vkInstance_;
@@ -210,8 +424,18 @@ class VulkanContext final {
   VkDescriptorSetLayout getBindlessVkDescriptorSetLayout() const;
   VkDescriptorSet getBindlessVkDescriptorSet() const;
 
+  /// @brief Returns SPIR-V reflection data for the given binary. Results are cached keyed by a
+  /// hash of the binary, so reflecting an already-seen module skips parsing entirely (see
+  /// util::getReflectionData()). Thread-safe.
+  util::SpvModuleInfo getOrCreateSpvModuleInfo(const uint32_t* spirv, size_t numBytes) const;
+
   std::vector<uint8_t> getPipelineCacheData() const;
 
+  // writes the current pipeline cache contents to `config.pipelineCacheFilePath`; no-op when the
+  // path is empty. Called automatically at teardown and, optionally, every
+  // `pipelineCacheFileSaveInterval` frames.
+  void savePipelineCacheFile() const;
+
   uint64_t getFrameNumber() const;
 
   using SubmitHandle = VulkanImmediateCommands::SubmitHandle;
@@ -223,6 +447,51 @@ class VulkanContext final {
 
   void* getVmaAllocator() const;
 
+  /// @brief Fills `outStatistics` with per-heap budgets and usage (from VK_EXT_memory_budget when
+  /// available, otherwise estimated by VMA) plus the running buffer/image allocation totals.
+  /// Cheap enough to call every frame. Returns false when no heap information could be queried
+  bool getMemoryStatistics(DeviceMemoryStatistics& outStatistics) const;
+
+  /// @brief Writes one GPU progress breadcrumb into `cmdBuffer` and remembers `label` (copied)
+  /// for it. No-op unless VulkanContextConfig::enableGpuCrashBreadcrumbs is set. Command buffers
+  /// and encoders call this automatically; applications may add their own markers around suspect
+  /// workloads. Must be called outside a render pass unless VK_AMD_buffer_marker is available
+  void writeGpuBreadcrumb(VkCommandBuffer cmdBuffer, const char* label) const;
+
+  /// @brief Human-readable report of the last breadcrumb marker the GPU reached and the
+  /// breadcrumbs recorded after it (the hang is in there), plus per-stage checkpoint data when
+  /// VK_NV_device_diagnostic_checkpoints is available. Logged automatically when a submission
+  /// reports VK_ERROR_DEVICE_LOST; returns an empty string when breadcrumbs are disabled or
+  /// nothing was recorded
+  std::string getGpuBreadcrumbReport() const;
+
+  /// @brief Runs one incremental defragmentation pass (see
+  /// `VulkanContextConfig::enableDefragmentation`). Called automatically from present() every
+  /// `defragmentationFrameInterval` frames; applications without a swapchain can call it directly
+  /// during idle time. Each pass copies a bounded number of buffers on the GPU and waits for the
+  /// copies, so it should not be called in the middle of a frame
+  void processDefragmentation() const;
+
+  /// @brief Registers a GPU-only buffer as eligible for defragmentation moves. Called by
+  /// VulkanBuffer; `vmaAllocation` is the buffer's VmaAllocation handle
+  void registerDefragmentableBuffer(void* vmaAllocation, VulkanBuffer* buffer) const;
+
+  /// @brief Removes a buffer from the defragmentation registry. No-op if it was never registered
+  void unregisterDefragmentableBuffer(void* vmaAllocation) const;
+
+  /// @brief Registers a buffer that has pending coalesced uploads (see
+  /// igl::vulkan::Buffer::upload()). The buffer is flushed on the next
+  /// flushPendingBufferUploads() call
+  void registerPendingBufferUpload(Buffer* buffer) const;
+
+  /// @brief Removes a buffer from the pending-upload registry. No-op if it was never registered
+  void unregisterPendingBufferUpload(Buffer* buffer) const;
+
+  /// @brief Flushes the pending coalesced uploads of every registered buffer into the staging
+  /// device. Called right before command buffer submission so the staging copies land on the
+  /// queue ahead of the commands that consume them
+  void flushPendingBufferUploads() const;
+
 #if defined(IGL_WITH_TRACY_GPU)
   TracyVkCtx tracyCtx_ = nullptr;
   std::unique_ptr<VulkanCommandPool> profilingCommandPool_;
@@ -232,19 +501,28 @@ class VulkanContext final {
  private:
   void createInstance(const size_t numExtraExtensions, const char** extraExtensions);
   void createSurface(void* window, void* display);
+  // acquires a display and plane through VK_KHR_display and replaces vkSurface_ with a display
+  // surface presenting straight to scanout; returns Unsupported when no display/plane pair is
+  // usable, leaving the windowed surface in place (see VulkanContextConfig::enableDirectToDisplay)
+  igl::Result createDirectToDisplaySurface();
+  std::vector<uint8_t> loadPipelineCacheFile() const;
   void checkAndUpdateDescriptorSets();
   void querySurfaceCapabilities();
   void processDeferredTasks() const;
+  void retireFrameDescriptorPools() const;
+  void advanceFrameUniformRing() const;
   void waitDeferredTasks();
   void growBindlessDescriptorPool(uint32_t newMaxTextures, uint32_t newMaxSamplers);
 
  private:
   friend class igl::vulkan::Device;
   friend class igl::vulkan::VulkanStagingDevice;
+  friend class igl::vulkan::VulkanUploadScheduler;
   friend class igl::vulkan::VulkanSwapchain;
   friend class igl::vulkan::CommandQueue;
   friend class igl::vulkan::ComputeCommandEncoder;
   friend class igl::vulkan::RenderCommandEncoder;
+  friend class igl::vulkan::SyncManager;
 
   // should be kept on the heap, otherwise global Vulkan functions can cause arbitrary crashes.
   std::unique_ptr<VulkanFunctionTable> tableImpl_;
@@ -259,7 +537,7 @@ class VulkanContext final {
       VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES_EXT,
       // Ignore clang-diagnostic-missing-field-initializers
       // @lint-ignore CLANGTIDY
-      nullptr};
+      &vkPhysicalDeviceInlineUniformBlockProperties_};
 
   // Provided by VK_KHR_driver_properties
   VkPhysicalDeviceDriverPropertiesKHR vkPhysicalDeviceDriverProperties_ = {
@@ -273,10 +551,42 @@ class VulkanContext final {
   VkSurfaceCapabilitiesKHR deviceSurfaceCaps_;
   std::vector<VkPresentModeKHR> devicePresentModes_;
 
+#if defined(VK_EXT_image_compression_control)
+  // Provided by VK_EXT_image_compression_control
+  VkPhysicalDeviceImageCompressionControlFeaturesEXT
+      vkPhysicalDeviceImageCompressionControlFeatures_ = {
+          VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_COMPRESSION_CONTROL_FEATURES_EXT,
+          nullptr};
+#endif // defined(VK_EXT_image_compression_control)
+
+  // Provided by VK_EXT_inline_uniform_block
+  VkPhysicalDeviceInlineUniformBlockFeaturesEXT vkPhysicalDeviceInlineUniformBlockFeatures_ = {
+      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INLINE_UNIFORM_BLOCK_FEATURES_EXT,
+#if defined(VK_EXT_image_compression_control)
+      &vkPhysicalDeviceImageCompressionControlFeatures_};
+#else
+      nullptr};
+#endif // defined(VK_EXT_image_compression_control)
+
+  // Provided by VK_EXT_inline_uniform_block
+  VkPhysicalDeviceInlineUniformBlockPropertiesEXT vkPhysicalDeviceInlineUniformBlockProperties_ = {
+      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INLINE_UNIFORM_BLOCK_PROPERTIES_EXT,
+      nullptr};
+
+  // Provided by VK_VERSION_1_3
+  VkPhysicalDeviceDynamicRenderingFeaturesKHR vkPhysicalDeviceDynamicRenderingFeatures_ = {
+      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES_KHR,
+      &vkPhysicalDeviceInlineUniformBlockFeatures_};
+
+  // Provided by VK_VERSION_1_2
+  VkPhysicalDeviceTimelineSemaphoreFeaturesKHR vkPhysicalDeviceTimelineSemaphoreFeatures_ = {
+      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES_KHR,
+      &vkPhysicalDeviceDynamicRenderingFeatures_};
+
   // Provided by VK_VERSION_1_2
   VkPhysicalDeviceShaderFloat16Int8Features vkPhysicalDeviceShaderFloat16Int8Features_ = {
       VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_FLOAT16_INT8_FEATURES_KHR,
-      nullptr};
+      &vkPhysicalDeviceTimelineSemaphoreFeatures_};
 
   // Provided by VK_VERSION_1_1
   VkPhysicalDeviceProperties2 vkPhysicalDeviceProperties2_ = {
@@ -300,10 +610,81 @@ class VulkanContext final {
   std::unique_ptr<igl::vulkan::VulkanImmediateCommands> immediate_;
   std::unique_ptr<igl::vulkan::VulkanStagingDevice> stagingDevice_;
 
+  // priority-based buffer upload scheduling with a per-frame byte budget (see
+  // VulkanContextConfig::maxScheduledUploadBytesPerFrame); drained once per submitted command
+  // buffer in CommandQueue::submit()
+  std::unique_ptr<igl::vulkan::VulkanUploadScheduler> uploadScheduler_;
+
+  // measured upload costs for this device; only populated (valid == true) when
+  // VulkanContextConfig::enableUploadCalibration is set
+  VulkanUploadCalibration uploadCalibration_;
+
+  // precompiled SPIR-V binaries mapped from VulkanContextConfig::shaderPackFilePath; closed (and
+  // every find() a miss) when no pack is configured
+  VulkanShaderPack shaderPack_;
+
+  // suballocation pools for small uniform and storage buffers. Only created when
+  // VulkanContextConfig::enableBufferSuballocation is set; mutable because suballocations are
+  // made and released through a const context (see VulkanContext::createBuffer())
+  mutable std::unique_ptr<igl::vulkan::VulkanBufferPool> uniformBufferPool_;
+  mutable std::unique_ptr<igl::vulkan::VulkanBufferPool> storageBufferPool_;
+
+  // compute-based mipmap generation; created lazily on the first eligible
+  // VulkanImage::generateMipmap() call when `enableComputeMipmapGeneration` is set
+  mutable std::unique_ptr<igl::vulkan::VulkanComputeMipmapGenerator> computeMipmapGenerator_;
+
+  // running totals of memory allocated for VkBuffer/VkImage objects, maintained by
+  // VulkanBuffer/VulkanImage and reported through getMemoryStatistics()
+  mutable std::atomic<uint64_t> totalBufferAllocatedBytes_ = 0;
+  mutable std::atomic<uint64_t> totalImageAllocatedBytes_ = 0;
+  // bytes of attachment-capable images whose compression the driver reported as disabled; only
+  // maintained when useImageCompressionControl_ is set (see VulkanImage)
+  mutable std::atomic<uint64_t> totalUncompressedAttachmentBytes_ = 0;
+
   std::unique_ptr<igl::vulkan::VulkanBuffer> dummyUniformBuffer_;
   std::unique_ptr<igl::vulkan::VulkanBuffer> dummyStorageBuffer_;
+  // persistently mapped host-coherent ring for per-draw uniform data that does not fit into push
+  // constants (see RenderCommandEncoder::bindBytes()); one region per frame in flight
+  std::unique_ptr<igl::vulkan::VulkanUniformRingBuffer> uniformRingBuffer_;
   // don't use staging on devices with device-local host-visible memory
   bool useStagingForBuffers_ = true;
+  // true when `VulkanContextConfig::enableTimelineSemaphores` was requested and the device supports
+  // VK_KHR_timeline_semaphore; command buffer completion is then tracked with timeline counters
+  // instead of fences
+  bool useTimelineSemaphores_ = false;
+  // true when `VulkanContextConfig::enableDynamicRendering` was requested and the device supports
+  // VK_KHR_dynamic_rendering; render passes then begin with vkCmdBeginRenderingKHR() and no
+  // VkRenderPass/VkFramebuffer objects are created
+  bool useDynamicRendering_ = false;
+  // true when `VulkanContextConfig::enableInlineUniformBlocks` was requested and the device
+  // supports VK_EXT_inline_uniform_block; small uniform blocks are then written directly into
+  // descriptor sets (see isInlineUniformBlock())
+  bool useInlineUniformBlocks_ = false;
+  // true when `VulkanContextConfig::enableDirectToDisplay` was requested and a VK_KHR_display
+  // surface was acquired; the swapchain then presents straight to scanout
+  bool useDirectToDisplay_ = false;
+  // true when `VulkanContextConfig::enableImageCompressionControl` was requested and the device
+  // supports VK_EXT_image_compression_control; VulkanImage then queries the driver-reported
+  // compression state of every image it creates
+  bool useImageCompressionControl_ = false;
+  // breadcrumb markers are written with VK_AMD_buffer_marker when the device supports it;
+  // otherwise writeGpuBreadcrumb() falls back to vkCmdFillBuffer() (transfer stage, coarser)
+  bool useBufferMarkerAMD_ = false;
+  // VK_NV_device_diagnostic_checkpoints: checkpoints mirror the breadcrumbs and per-stage
+  // checkpoint data is appended to getGpuBreadcrumbReport()
+  bool useDiagnosticCheckpoints_ = false;
+  // GPU breadcrumb state (see VulkanContextConfig::enableGpuCrashBreadcrumbs): a host-visible
+  // marker ring the GPU writes into, and the CPU-side labels of the last kNumGpuBreadcrumbs
+  // markers. Slots hold the marker values so the highest value is the last one the GPU reached
+  static constexpr uint32_t kNumGpuBreadcrumbs = 64u;
+  std::unique_ptr<igl::vulkan::VulkanBuffer> breadcrumbBuffer_;
+  mutable std::atomic<uint32_t> breadcrumbCounter_ = 0;
+  mutable std::mutex breadcrumbsMutex_;
+  mutable std::array<std::string, kNumGpuBreadcrumbs> breadcrumbLabels_;
+#if defined(VK_EXT_image_compression_control)
+  // loaded on demand in initContext(); the generated VulkanFunctionTable predates the extension
+  PFN_vkGetImageSubresourceLayout2EXT vkGetImageSubresourceLayout2EXT_ = nullptr;
+#endif // defined(VK_EXT_image_compression_control)
 
   std::unique_ptr<VulkanContextImpl> pimpl_;
 
@@ -319,20 +700,57 @@ class VulkanContext final {
   // a texture/sampler was created since the last descriptor set update
   mutable bool awaitingCreation_ = false;
 
-  mutable size_t drawCallCount_ = 0;
+  // guards textures_/samplers_ and the bindless bookkeeping derived from them (the dirty
+  // watermarks and awaitingCreation_). Resources can be created from several loader threads
+  // concurrently; the lock only covers the pool insertion and the garbage collection in
+  // checkAndUpdateDescriptorSets() - the expensive Vulkan object creation happens outside of it
+  mutable std::mutex objectPoolsMutex_;
+
+  // atomic: draw calls can be recorded from multiple threads through secondary command buffer
+  // encoders (see RenderCommandEncoder::createParallel())
+  mutable std::atomic<size_t> drawCallCount_ = 0;
 
+  // serializes descriptor set allocation and caching in updateBindings*() when several encoders
+  // record concurrently (parallel secondary command buffer recording)
+  mutable std::mutex bindingsUpdateMutex_;
+
+  // guards renderPassesHash_ and renderPasses_. Render passes are looked up on every render pass
+  // begin, possibly from multiple command buffer recording threads, and created only a handful of
+  // times per run - so lookups take a shared (read) lock and only insertions take an exclusive one
+  mutable std::shared_mutex renderPassesMutex_;
   // stores an index into renderPasses_
   mutable std::
       unordered_map<VulkanRenderPassBuilder, uint8_t, VulkanRenderPassBuilder::HashFunction>
           renderPassesHash_;
   mutable std::vector<VkRenderPass> renderPasses_;
 
+  // SPIR-V reflection results keyed by a hash of the binary (see getOrCreateSpvModuleInfo())
+  mutable std::mutex spvModuleInfoCacheMutex_;
+  mutable std::unordered_map<uint64_t, util::SpvModuleInfo> spvModuleInfoCache_;
+
+  // descriptor set layouts keyed by their exact binding description (see
+  // getOrCreateDescriptorSetLayout())
+  mutable std::mutex dslCacheMutex_;
+  mutable std::unordered_map<std::string, std::shared_ptr<VulkanDescriptorSetLayout>> dslCache_;
+
+  // samplers keyed by the perfect hash of their SamplerStateDesc (see getOrCreateSampler())
+  mutable std::mutex samplerCacheMutex_;
+  mutable std::unordered_map<size_t, std::weak_ptr<VulkanSampler>> samplerCache_;
+
   VulkanExtensions extensions_;
   VulkanContextConfig config_;
 
   // Enhanced shader debug: line drawing
   std::unique_ptr<EnhancedShaderDebuggingStore> enhancedShaderDebuggingStore_;
 
+  // programmable MSAA resolve (see RenderPassDesc::colorResolveShaderStages); created lazily by
+  // getOrCreateProgrammableResolve()
+  mutable std::mutex programmableResolveMutex_;
+  mutable std::unique_ptr<VulkanProgrammableResolve> programmableResolve_;
+
+  // texture sample feedback (see TextureSampleFeedback); the encoders report texture binds here
+  std::shared_ptr<TextureSampleFeedback> textureSampleFeedback_;
+
   void updateBindingsTextures(VkCommandBuffer cmdBuf,
                               VkPipelineLayout layout,
                               VkPipelineBindPoint bindPoint,
@@ -343,6 +761,7 @@ class VulkanContext final {
                                     VkPipelineLayout layout,
                                     VkPipelineBindPoint bindPoint,
                                     BindingsBuffers& data,
+                                    const BindingsInlineUniforms& inlineData,
                                     const VulkanDescriptorSetLayout& dsl,
                                     const util::SpvModuleInfo& info) const;
   void updateBindingsStorageBuffers(VkCommandBuffer cmdBuf,
@@ -362,6 +781,20 @@ class VulkanContext final {
   };
 
   mutable std::deque<DeferredTask> deferredTasks_;
+  // deferred tasks are enqueued whenever a resource owner is destroyed, which can happen on any
+  // thread; the processing paths pop tasks under the lock and run them outside of it so a task
+  // that itself enqueues a new deferred task does not deadlock
+  mutable std::mutex deferredTasksMutex_;
+
+  // buffers with pending coalesced uploads; they register themselves on the first small upload
+  // and are flushed (and the registry cleared) at every command buffer submission
+  mutable std::mutex pendingUploadsMutex_;
+  mutable std::vector<Buffer*> pendingUploadBuffers_;
+
+  // buffers eligible for defragmentation moves, keyed by their VmaAllocation handle
+  mutable std::mutex defragMutex_;
+  mutable std::unordered_map<void*, VulkanBuffer*> defragBuffers_;
+  mutable void* defragContext_ = nullptr; // VmaDefragmentationContext
 
   std::unique_ptr<SyncManager> syncManager_;
 };
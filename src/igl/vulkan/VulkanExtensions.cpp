@@ -129,6 +129,14 @@ void VulkanExtensions::enableCommonExtensions(ExtensionType extensionType,
     }
 #endif
 
+#if defined(VK_KHR_display)
+    if (config.enableDirectToDisplay) {
+      // direct scanout (see VulkanContext::createDirectToDisplaySurface()); enable() fails
+      // quietly when the loader does not expose the extension and the windowed path is used
+      enable(VK_KHR_DISPLAY_EXTENSION_NAME, ExtensionType::Instance);
+    }
+#endif
+
   } else if (extensionType == ExtensionType::Device) {
 #if IGL_PLATFORM_ANDROID
     if (config.enableDescriptorIndexing) {
@@ -143,6 +151,10 @@ void VulkanExtensions::enableCommonExtensions(ExtensionType extensionType,
 #if defined(VK_KHR_driver_properties)
     enable(VK_KHR_DRIVER_PROPERTIES_EXTENSION_NAME, ExtensionType::Device);
 #endif // VK_KHR_driver_properties
+#if defined(VK_EXT_memory_budget)
+    // per-heap budget/usage reporting for VulkanContext::getMemoryStatistics()
+    enable(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME, ExtensionType::Device);
+#endif // VK_EXT_memory_budget
 #if defined(VK_KHR_shader_non_semantic_info)
 #if !IGL_PLATFORM_ANDROID || !IGL_DEBUG
     // On Android, vkEnumerateInstanceExtensionProperties crashes when validation layers are enabled
@@ -153,6 +165,18 @@ void VulkanExtensions::enableCommonExtensions(ExtensionType extensionType,
 #endif // VK_KHR_shader_non_semantic_info
     enable(VK_KHR_SWAPCHAIN_EXTENSION_NAME, ExtensionType::Device);
 
+#if defined(VK_KHR_draw_indirect_count)
+    // GPU-driven submission: consume compute-culled indirect draws with a GPU-written draw count
+    // (see IRenderCommandEncoder::multiDrawIndexedIndirectCount)
+    enable(VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME, ExtensionType::Device);
+#endif // VK_KHR_draw_indirect_count
+
+#if defined(VK_GOOGLE_display_timing)
+    if (config.enableDisplayTimingPacing) {
+      enable(VK_GOOGLE_DISPLAY_TIMING_EXTENSION_NAME, ExtensionType::Device);
+    }
+#endif // VK_GOOGLE_display_timing
+
 #if IGL_PLATFORM_MACOS
     IGL_VERIFY(enable("VK_KHR_portability_subset", ExtensionType::Device));
 #endif
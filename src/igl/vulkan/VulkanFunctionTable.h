@@ -1123,6 +1123,88 @@ void loadVulkanDeviceFunctions(struct VulkanFunctionTable* table,
                                VkDevice context,
                                PFN_vkGetDeviceProcAddr load);
 
+/*
+ * IGL_VULKAN_STATIC_HOT_FUNCTIONS: optional static dispatch for the hottest entry points.
+ *
+ * When enabled (and the binary links against a known Vulkan loader version), the entry points
+ * dominating draw-heavy frames - vkCmdDraw*, vkCmdBindDescriptorSets, vkCmdPipelineBarrier - are
+ * called directly through the statically linked loader instead of through the function table,
+ * removing the indirect call and its branch-predictor pressure. Everything else keeps dynamic
+ * dispatch. Hot call sites go through IGL_VULKAN_HOT_FN(table, fn), which expands to either the
+ * direct call or the table lookup.
+ *
+ * The declarations below cannot use the real function names: volk already declares those as
+ * global function pointers, so they are aliased onto the loader symbols with asm labels (hence
+ * the GCC/Clang requirement; the option targets ARM/Android where this overhead is measurable).
+ */
+#if defined(IGL_VULKAN_STATIC_HOT_FUNCTIONS) && IGL_VULKAN_STATIC_HOT_FUNCTIONS
+
+#if !defined(__GNUC__) && !defined(__clang__)
+#error "IGL_VULKAN_STATIC_HOT_FUNCTIONS requires a GCC-compatible compiler (asm symbol aliases)"
+#endif
+
+#if defined(__APPLE__)
+#define IGL_VULKAN_ASM_NAME(name) "_" name
+#else
+#define IGL_VULKAN_ASM_NAME(name) name
+#endif
+
+VKAPI_ATTR void VKAPI_CALL iglvk_vkCmdBindDescriptorSets(VkCommandBuffer commandBuffer,
+                                                         VkPipelineBindPoint pipelineBindPoint,
+                                                         VkPipelineLayout layout,
+                                                         uint32_t firstSet,
+                                                         uint32_t descriptorSetCount,
+                                                         const VkDescriptorSet* pDescriptorSets,
+                                                         uint32_t dynamicOffsetCount,
+                                                         const uint32_t* pDynamicOffsets)
+    __asm__(IGL_VULKAN_ASM_NAME("vkCmdBindDescriptorSets"));
+VKAPI_ATTR void VKAPI_CALL iglvk_vkCmdDraw(VkCommandBuffer commandBuffer,
+                                           uint32_t vertexCount,
+                                           uint32_t instanceCount,
+                                           uint32_t firstVertex,
+                                           uint32_t firstInstance)
+    __asm__(IGL_VULKAN_ASM_NAME("vkCmdDraw"));
+VKAPI_ATTR void VKAPI_CALL iglvk_vkCmdDrawIndexed(VkCommandBuffer commandBuffer,
+                                                  uint32_t indexCount,
+                                                  uint32_t instanceCount,
+                                                  uint32_t firstIndex,
+                                                  int32_t vertexOffset,
+                                                  uint32_t firstInstance)
+    __asm__(IGL_VULKAN_ASM_NAME("vkCmdDrawIndexed"));
+VKAPI_ATTR void VKAPI_CALL iglvk_vkCmdDrawIndexedIndirect(VkCommandBuffer commandBuffer,
+                                                          VkBuffer buffer,
+                                                          VkDeviceSize offset,
+                                                          uint32_t drawCount,
+                                                          uint32_t stride)
+    __asm__(IGL_VULKAN_ASM_NAME("vkCmdDrawIndexedIndirect"));
+VKAPI_ATTR void VKAPI_CALL iglvk_vkCmdDrawIndirect(VkCommandBuffer commandBuffer,
+                                                   VkBuffer buffer,
+                                                   VkDeviceSize offset,
+                                                   uint32_t drawCount,
+                                                   uint32_t stride)
+    __asm__(IGL_VULKAN_ASM_NAME("vkCmdDrawIndirect"));
+VKAPI_ATTR void VKAPI_CALL
+iglvk_vkCmdPipelineBarrier(VkCommandBuffer commandBuffer,
+                           VkPipelineStageFlags srcStageMask,
+                           VkPipelineStageFlags dstStageMask,
+                           VkDependencyFlags dependencyFlags,
+                           uint32_t memoryBarrierCount,
+                           const VkMemoryBarrier* pMemoryBarriers,
+                           uint32_t bufferMemoryBarrierCount,
+                           const VkBufferMemoryBarrier* pBufferMemoryBarriers,
+                           uint32_t imageMemoryBarrierCount,
+                           const VkImageMemoryBarrier* pImageMemoryBarriers)
+    __asm__(IGL_VULKAN_ASM_NAME("vkCmdPipelineBarrier"));
+
+#define IGL_VULKAN_HOT_FN(table, fn) (iglvk_##fn)
+
+#else
+
+/* default: dynamic dispatch through the function table */
+#define IGL_VULKAN_HOT_FN(table, fn) ((table).fn)
+
+#endif /* IGL_VULKAN_STATIC_HOT_FUNCTIONS */
+
 #ifdef __cplusplus
 }
 #endif
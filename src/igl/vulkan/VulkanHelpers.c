@@ -192,6 +192,21 @@ VkResult ivkAllocateCommandBuffer(const struct VulkanFunctionTable* vt,
   return vt->vkAllocateCommandBuffers(device, &ai, outCommandBuffer);
 }
 
+VkResult ivkAllocateSecondaryCommandBuffer(const struct VulkanFunctionTable* vt,
+                                           VkDevice device,
+                                           VkCommandPool commandPool,
+                                           VkCommandBuffer* outCommandBuffer) {
+  const VkCommandBufferAllocateInfo ai = {
+      .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+      .pNext = NULL,
+      .commandPool = commandPool,
+      .level = VK_COMMAND_BUFFER_LEVEL_SECONDARY,
+      .commandBufferCount = 1,
+  };
+
+  return vt->vkAllocateCommandBuffers(device, &ai, outCommandBuffer);
+}
+
 VkResult ivkAllocateMemory(const struct VulkanFunctionTable* vt,
                            VkPhysicalDevice physDev,
                            VkDevice device,
@@ -201,6 +216,45 @@ VkResult ivkAllocateMemory(const struct VulkanFunctionTable* vt,
                            VkDeviceMemory* outMemory) {
   assert(memRequirements);
 
+  // lazily allocated memory backs transient attachments that can live entirely in tile memory on
+  // tiled GPUs; desktop implementations commonly expose no such memory type, so fall back to
+  // plain device-local memory in that case
+  if (props & VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT) {
+    VkPhysicalDeviceMemoryProperties memProperties;
+    vt->vkGetPhysicalDeviceMemoryProperties(physDev, &memProperties);
+    bool found = false;
+    for (uint32_t i = 0; i < memProperties.memoryTypeCount; i++) {
+      const bool hasProperties = (memProperties.memoryTypes[i].propertyFlags & props) == props;
+      if ((memRequirements->memoryTypeBits & (1u << i)) && hasProperties) {
+        found = true;
+        break;
+      }
+    }
+    if (!found) {
+      props &= ~(VkMemoryPropertyFlags)VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT;
+    }
+  }
+
+  // device-local host-visible memory (BAR/ReBAR) may not be exposed, or not for this resource;
+  // fall back to a plain host-visible upload heap in that case
+  const VkMemoryPropertyFlags barFlags =
+      VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
+  if ((props & barFlags) == barFlags) {
+    VkPhysicalDeviceMemoryProperties memProperties;
+    vt->vkGetPhysicalDeviceMemoryProperties(physDev, &memProperties);
+    bool found = false;
+    for (uint32_t i = 0; i < memProperties.memoryTypeCount; i++) {
+      const bool hasProperties = (memProperties.memoryTypes[i].propertyFlags & props) == props;
+      if ((memRequirements->memoryTypeBits & (1u << i)) && hasProperties) {
+        found = true;
+        break;
+      }
+    }
+    if (!found) {
+      props &= ~(VkMemoryPropertyFlags)VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+    }
+  }
+
   const VkMemoryAllocateFlagsInfo memoryAllocateFlagsInfo = {
       .sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO,
       .flags = enableBufferDeviceAddress ? VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT_KHR : 0,
@@ -274,6 +328,24 @@ VkResult ivkCreateSemaphore(const struct VulkanFunctionTable* vt,
   return vt->vkCreateSemaphore(device, &ci, NULL, outSemaphore);
 }
 
+VkResult ivkCreateSemaphoreTimeline(const struct VulkanFunctionTable* vt,
+                                    VkDevice device,
+                                    uint64_t initialValue,
+                                    VkSemaphore* outSemaphore) {
+  const VkSemaphoreTypeCreateInfo typeInfo = {
+      .sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO,
+      .pNext = NULL,
+      .semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE,
+      .initialValue = initialValue,
+  };
+  const VkSemaphoreCreateInfo ci = {
+      .sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO,
+      .pNext = &typeInfo,
+      .flags = 0,
+  };
+  return vt->vkCreateSemaphore(device, &ci, NULL, outSemaphore);
+}
+
 VkResult ivkCreateFence(const struct VulkanFunctionTable* vt,
                         VkDevice device,
                         VkFlags flags,
@@ -316,6 +388,10 @@ VkResult ivkCreateDevice(const struct VulkanFunctionTable* vt,
                          VkBool32 enableShaderFloat16,
                          VkBool32 enableBufferDeviceAddress,
                          VkBool32 enableDescriptorIndexing,
+                         VkBool32 enableTimelineSemaphore,
+                         VkBool32 enableDynamicRendering,
+                         VkBool32 enableInlineUniformBlock,
+                         VkBool32 enableImageCompressionControl,
                          const VkPhysicalDeviceFeatures* supported,
                          VkDevice* outDevice) {
   assert(numQueueCreateInfos >= 1);
@@ -326,6 +402,8 @@ VkResult ivkCreateDevice(const struct VulkanFunctionTable* vt,
       .depthBiasClamp = supported ? supported->depthBiasClamp : VK_TRUE,
       .fillModeNonSolid = supported ? supported->fillModeNonSolid : VK_TRUE,
       .shaderInt16 = supported ? supported->shaderInt16 : VK_TRUE,
+      .sparseBinding = supported ? supported->sparseBinding : VK_TRUE,
+      .sparseResidencyImage2D = supported ? supported->sparseResidencyImage2D : VK_TRUE,
   };
   VkDeviceCreateInfo ci = {
       .sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO,
@@ -375,6 +453,46 @@ VkResult ivkCreateDevice(const struct VulkanFunctionTable* vt,
   }
 #endif // defined(VK_KHR_buffer_device_address)
 
+#if defined(VK_KHR_timeline_semaphore)
+  const VkPhysicalDeviceTimelineSemaphoreFeaturesKHR timelineSemaphoreFeature = {
+      .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES_KHR,
+      .timelineSemaphore = VK_TRUE,
+  };
+  if (enableTimelineSemaphore) {
+    ivkAddNext(&ci, &timelineSemaphoreFeature);
+  }
+#endif // defined(VK_KHR_timeline_semaphore)
+
+#if defined(VK_KHR_dynamic_rendering)
+  const VkPhysicalDeviceDynamicRenderingFeaturesKHR dynamicRenderingFeature = {
+      .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES_KHR,
+      .dynamicRendering = VK_TRUE,
+  };
+  if (enableDynamicRendering) {
+    ivkAddNext(&ci, &dynamicRenderingFeature);
+  }
+#endif // defined(VK_KHR_dynamic_rendering)
+
+#if defined(VK_EXT_inline_uniform_block)
+  const VkPhysicalDeviceInlineUniformBlockFeaturesEXT inlineUniformBlockFeature = {
+      .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INLINE_UNIFORM_BLOCK_FEATURES_EXT,
+      .inlineUniformBlock = VK_TRUE,
+  };
+  if (enableInlineUniformBlock) {
+    ivkAddNext(&ci, &inlineUniformBlockFeature);
+  }
+#endif // defined(VK_EXT_inline_uniform_block)
+
+#if defined(VK_EXT_image_compression_control)
+  const VkPhysicalDeviceImageCompressionControlFeaturesEXT imageCompressionControlFeature = {
+      .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_COMPRESSION_CONTROL_FEATURES_EXT,
+      .imageCompressionControl = VK_TRUE,
+  };
+  if (enableImageCompressionControl) {
+    ivkAddNext(&ci, &imageCompressionControlFeature);
+  }
+#endif // defined(VK_EXT_image_compression_control)
+
   // Note this must exist outside of the if statement below
   // due to scope issues.
   VkPhysicalDeviceMultiviewFeatures multiviewFeature = {
@@ -513,6 +631,7 @@ VkResult ivkCreateSwapchain(const struct VulkanFunctionTable* vt,
                             uint32_t queueFamilyIndex,
                             uint32_t width,
                             uint32_t height,
+                            VkSwapchainKHR oldSwapchain,
                             VkSwapchainKHR* outSwapchain) {
   assert(caps);
   const bool isCompositeAlphaOpaqueSupported =
@@ -534,7 +653,7 @@ VkResult ivkCreateSwapchain(const struct VulkanFunctionTable* vt,
                                                         : VK_COMPOSITE_ALPHA_INHERIT_BIT_KHR,
       .presentMode = presentMode,
       .clipped = VK_TRUE,
-      .oldSwapchain = VK_NULL_HANDLE,
+      .oldSwapchain = oldSwapchain,
   };
   return vt->vkCreateSwapchainKHR(device, &ci, NULL, outSwapchain);
 }
@@ -852,6 +971,16 @@ VkResult ivkBeginCommandBuffer(const struct VulkanFunctionTable* vt, VkCommandBu
   return vt->vkBeginCommandBuffer(buffer, &bi);
 }
 
+VkResult ivkBeginCommandBufferForReuse(const struct VulkanFunctionTable* vt,
+                                       VkCommandBuffer buffer) {
+  const VkCommandBufferBeginInfo bi = {
+      .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+      .pNext = NULL,
+      .flags = 0,
+  };
+  return vt->vkBeginCommandBuffer(buffer, &bi);
+}
+
 VkResult ivkEndCommandBuffer(const struct VulkanFunctionTable* vt, VkCommandBuffer buffer) {
   return vt->vkEndCommandBuffer(buffer);
 }
@@ -1217,6 +1346,8 @@ VkRect2D ivkGetRect2D(int32_t x, int32_t y, uint32_t width, uint32_t height) {
   return rect;
 }
 
+#if !IGL_VULKAN_NO_GLSLANG
+
 static glslang_stage_t getGLSLangShaderStage(VkShaderStageFlagBits stage) {
   switch (stage) {
   case VK_SHADER_STAGE_VERTEX_BIT:
@@ -1259,6 +1390,8 @@ glslang_input_t ivkGetGLSLangInput(VkShaderStageFlagBits stage,
   return input;
 }
 
+#endif // !IGL_VULKAN_NO_GLSLANG
+
 VkResult ivkCreateShaderModuleFromSPIRV(const struct VulkanFunctionTable* vt,
                                         VkDevice device,
                                         const void* dataSPIRV,
@@ -1288,10 +1421,12 @@ VkResult ivkCreateGraphicsPipeline(const struct VulkanFunctionTable* vt,
                                    const VkPipelineDynamicStateCreateInfo* dynamicState,
                                    VkPipelineLayout pipelineLayout,
                                    VkRenderPass renderPass,
+                                   uint32_t subpass,
+                                   const VkPipelineRenderingCreateInfoKHR* dynamicRenderingInfo,
                                    VkPipeline* outPipeline) {
   const VkGraphicsPipelineCreateInfo ci = {
       .sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
-      .pNext = NULL,
+      .pNext = dynamicRenderingInfo,
       .flags = 0,
       .stageCount = numShaderStages,
       .pStages = shaderStages,
@@ -1306,7 +1441,7 @@ VkResult ivkCreateGraphicsPipeline(const struct VulkanFunctionTable* vt,
       .pDynamicState = dynamicState,
       .layout = pipelineLayout,
       .renderPass = renderPass,
-      .subpass = 0,
+      .subpass = subpass,
       .basePipelineHandle = VK_NULL_HANDLE,
       .basePipelineIndex = -1,
   };
@@ -1350,7 +1485,60 @@ void ivkImageMemoryBarrier(const struct VulkanFunctionTable* vt,
       .image = image,
       .subresourceRange = subresourceRange,
   };
-  vt->vkCmdPipelineBarrier(buffer, srcStageMask, dstStageMask, 0, 0, NULL, 0, NULL, 1, &barrier);
+  IGL_VULKAN_HOT_FN(*vt, vkCmdPipelineBarrier)
+  (buffer, srcStageMask, dstStageMask, 0, 0, NULL, 0, NULL, 1, &barrier);
+}
+
+void ivkImageMemoryBarrierQueueTransfer(const struct VulkanFunctionTable* vt,
+                                        VkCommandBuffer buffer,
+                                        VkImage image,
+                                        VkAccessFlags srcAccessMask,
+                                        VkAccessFlags dstAccessMask,
+                                        VkImageLayout oldImageLayout,
+                                        VkImageLayout newImageLayout,
+                                        VkPipelineStageFlags srcStageMask,
+                                        VkPipelineStageFlags dstStageMask,
+                                        uint32_t srcQueueFamilyIndex,
+                                        uint32_t dstQueueFamilyIndex,
+                                        VkImageSubresourceRange subresourceRange) {
+  const VkImageMemoryBarrier barrier = {
+      .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+      .srcAccessMask = srcAccessMask,
+      .dstAccessMask = dstAccessMask,
+      .oldLayout = oldImageLayout,
+      .newLayout = newImageLayout,
+      .srcQueueFamilyIndex = srcQueueFamilyIndex,
+      .dstQueueFamilyIndex = dstQueueFamilyIndex,
+      .image = image,
+      .subresourceRange = subresourceRange,
+  };
+  IGL_VULKAN_HOT_FN(*vt, vkCmdPipelineBarrier)
+  (buffer, srcStageMask, dstStageMask, 0, 0, NULL, 0, NULL, 1, &barrier);
+}
+
+void ivkBufferMemoryBarrierQueueTransfer(const struct VulkanFunctionTable* vt,
+                                         VkCommandBuffer cmdBuffer,
+                                         VkBuffer buffer,
+                                         VkAccessFlags srcAccessMask,
+                                         VkAccessFlags dstAccessMask,
+                                         VkDeviceSize offset,
+                                         VkDeviceSize size,
+                                         VkPipelineStageFlags srcStageMask,
+                                         VkPipelineStageFlags dstStageMask,
+                                         uint32_t srcQueueFamilyIndex,
+                                         uint32_t dstQueueFamilyIndex) {
+  const VkBufferMemoryBarrier barrier = {
+      .sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
+      .srcAccessMask = srcAccessMask,
+      .dstAccessMask = dstAccessMask,
+      .srcQueueFamilyIndex = srcQueueFamilyIndex,
+      .dstQueueFamilyIndex = dstQueueFamilyIndex,
+      .buffer = buffer,
+      .offset = offset,
+      .size = size,
+  };
+  IGL_VULKAN_HOT_FN(*vt, vkCmdPipelineBarrier)
+  (cmdBuffer, srcStageMask, dstStageMask, 0, 0, NULL, 1, &barrier, 0, NULL);
 }
 
 void ivkBufferBarrier(const struct VulkanFunctionTable* vt,
@@ -1377,7 +1565,8 @@ void ivkBufferBarrier(const struct VulkanFunctionTable* vt,
     barrier.dstAccessMask |= VK_ACCESS_INDEX_READ_BIT;
   }
 
-  vt->vkCmdPipelineBarrier(cmdBuffer, srcStageMask, dstStageMask, 0, 0, NULL, 1, &barrier, 0, NULL);
+  IGL_VULKAN_HOT_FN(*vt, vkCmdPipelineBarrier)
+  (cmdBuffer, srcStageMask, dstStageMask, 0, 0, NULL, 1, &barrier, 0, NULL);
 }
 
 void ivkBufferMemoryBarrier(const struct VulkanFunctionTable* vt,
@@ -1399,7 +1588,8 @@ void ivkBufferMemoryBarrier(const struct VulkanFunctionTable* vt,
       .offset = offset,
       .size = size,
   };
-  vt->vkCmdPipelineBarrier(cmdBuffer, srcStageMask, dstStageMask, 0, 0, NULL, 1, &barrier, 0, NULL);
+  IGL_VULKAN_HOT_FN(*vt, vkCmdPipelineBarrier)
+  (cmdBuffer, srcStageMask, dstStageMask, 0, 0, NULL, 1, &barrier, 0, NULL);
 }
 
 void ivkCmdBlitImage(const struct VulkanFunctionTable* vt,
@@ -1624,6 +1814,8 @@ VkResult ivkVmaCreateAllocator(const struct VulkanFunctionTable* vt,
   return vmaCreateAllocator(&ci, outVma);
 }
 
+#if !IGL_VULKAN_NO_GLSLANG
+
 void ivkGlslangResource(glslang_resource_t* glslangResource,
                         const VkPhysicalDeviceProperties* deviceProperties) {
   const VkPhysicalDeviceLimits* limits = deviceProperties ? &deviceProperties->limits : NULL;
@@ -1742,3 +1934,5 @@ void ivkGlslangResource(glslang_resource_t* glslangResource,
 
   *glslangResource = resource;
 }
+
+#endif // !IGL_VULKAN_NO_GLSLANG
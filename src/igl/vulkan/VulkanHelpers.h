@@ -9,7 +9,16 @@
 
 #pragma once
 
+// Set to 1 (see IGL_VULKAN_NO_RUNTIME_SHADER_COMPILER in CMake) to exclude the glslang runtime
+// compiler from the build; shaders must then be provided as SPIR-V binaries or through a
+// precompiled shader pack (see VulkanShaderPack)
+#if !defined(IGL_VULKAN_NO_GLSLANG)
+#define IGL_VULKAN_NO_GLSLANG 0
+#endif
+
+#if !IGL_VULKAN_NO_GLSLANG
 #include <glslang/Include/glslang_c_interface.h>
+#endif // !IGL_VULKAN_NO_GLSLANG
 
 #include <igl/Macros.h>
 #include <igl/vulkan/VulkanFunctionTable.h>
@@ -58,6 +67,13 @@ VkResult ivkCreateSemaphore(const struct VulkanFunctionTable* vt,
                             bool exportable,
                             VkSemaphore* outSemaphore);
 
+/// Creates a VK_SEMAPHORE_TYPE_TIMELINE semaphore with the provided initial value. Requires the
+/// VK_KHR_timeline_semaphore extension (or Vulkan 1.2) to be enabled on the device
+VkResult ivkCreateSemaphoreTimeline(const struct VulkanFunctionTable* vt,
+                                    VkDevice device,
+                                    uint64_t initialValue,
+                                    VkSemaphore* outSemaphore);
+
 VkResult ivkCreateFence(const struct VulkanFunctionTable* vt,
                         VkDevice device,
                         VkFlags flags,
@@ -95,7 +111,12 @@ VkResult ivkCreateSurface(const struct VulkanFunctionTable* vt,
  * VkPhysicalDeviceShaderFloat16Int8Features::shaderFloat16
  * If the `VK_KHR_buffer_device_address` extension is available, then
  * VkPhysicalDeviceBufferDeviceAddressFeaturesKHR::bufferDeviceAddress is enabled If multiview is
- * enabled, then VkPhysicalDeviceMultiviewFeatures::multiview is enabled
+ * enabled, then VkPhysicalDeviceMultiviewFeatures::multiview is enabled. If dynamic rendering is
+ * enabled, then VkPhysicalDeviceDynamicRenderingFeaturesKHR::dynamicRendering is enabled. If
+ * inline uniform blocks are enabled, then
+ * VkPhysicalDeviceInlineUniformBlockFeaturesEXT::inlineUniformBlock is enabled. If image
+ * compression control is enabled, then
+ * VkPhysicalDeviceImageCompressionControlFeaturesEXT::imageCompressionControl is enabled
  */
 VkResult ivkCreateDevice(const struct VulkanFunctionTable* vt,
                          VkPhysicalDevice physicalDevice,
@@ -107,6 +128,10 @@ VkResult ivkCreateDevice(const struct VulkanFunctionTable* vt,
                          VkBool32 enableShaderFloat16,
                          VkBool32 enableBufferDeviceAddress,
                          VkBool32 enableDescriptorIndexing,
+                         VkBool32 enableTimelineSemaphore,
+                         VkBool32 enableDynamicRendering,
+                         VkBool32 enableInlineUniformBlock,
+                         VkBool32 enableImageCompressionControl,
                          const VkPhysicalDeviceFeatures* supported,
                          VkDevice* outDevice);
 
@@ -125,6 +150,7 @@ VkResult ivkCreateSwapchain(const struct VulkanFunctionTable* vt,
                             uint32_t queueFamilyIndex,
                             uint32_t width,
                             uint32_t height,
+                            VkSwapchainKHR oldSwapchain,
                             VkSwapchainKHR* outSwapchain);
 
 /// @brief Creates a Vulkan Sampler object with default values
@@ -171,6 +197,11 @@ VkResult ivkAllocateCommandBuffer(const struct VulkanFunctionTable* vt,
                                   VkCommandPool commandPool,
                                   VkCommandBuffer* outCommandBuffer);
 
+VkResult ivkAllocateSecondaryCommandBuffer(const struct VulkanFunctionTable* vt,
+                                           VkDevice device,
+                                           VkCommandPool commandPool,
+                                           VkCommandBuffer* outCommandBuffer);
+
 VkResult ivkAllocateMemory(const struct VulkanFunctionTable* vt,
                            VkPhysicalDevice physDev,
                            VkDevice device,
@@ -218,6 +249,8 @@ VkResult ivkCreateGraphicsPipeline(const struct VulkanFunctionTable* vt,
                                    const VkPipelineDynamicStateCreateInfo* dynamicState,
                                    VkPipelineLayout pipelineLayout,
                                    VkRenderPass renderPass,
+                                   uint32_t subpass,
+                                   const VkPipelineRenderingCreateInfoKHR* dynamicRenderingInfo,
                                    VkPipeline* outPipeline);
 
 VkResult ivkCreateComputePipeline(const struct VulkanFunctionTable* vt,
@@ -284,6 +317,10 @@ VkResult ivkCreateDescriptorPool(const struct VulkanFunctionTable* vt,
 /// reused)
 VkResult ivkBeginCommandBuffer(const struct VulkanFunctionTable* vt, VkCommandBuffer buffer);
 
+/* begins a command buffer without ONE_TIME_SUBMIT, so the recording can be submitted repeatedly */
+VkResult ivkBeginCommandBufferForReuse(const struct VulkanFunctionTable* vt,
+                                       VkCommandBuffer buffer);
+
 VkResult ivkEndCommandBuffer(const struct VulkanFunctionTable* vt, VkCommandBuffer buffer);
 
 /// @brief Creates a VkSubmitInfo structure with an optional semaphore, used to signal when the
@@ -420,9 +457,11 @@ VkBufferImageCopy ivkGetBufferImageCopy3D(uint32_t bufferOffset,
                                           const VkExtent3D extent,
                                           VkImageSubresourceLayers imageSubresource);
 
+#if !IGL_VULKAN_NO_GLSLANG
 glslang_input_t ivkGetGLSLangInput(VkShaderStageFlagBits stage,
                                    const glslang_resource_t* resource,
                                    const char* shaderCode);
+#endif // !IGL_VULKAN_NO_GLSLANG
 
 void ivkImageMemoryBarrier(const struct VulkanFunctionTable* vt,
                            VkCommandBuffer buffer,
@@ -445,6 +484,35 @@ void ivkBufferMemoryBarrier(const struct VulkanFunctionTable* vt,
                             VkPipelineStageFlags srcStageMask,
                             VkPipelineStageFlags dstStageMask);
 
+/* Same as ivkImageMemoryBarrier(), but performs a queue family ownership transfer. Record the
+ * release half on the source queue and the matching acquire half on the destination queue. */
+void ivkImageMemoryBarrierQueueTransfer(const struct VulkanFunctionTable* vt,
+                                        VkCommandBuffer buffer,
+                                        VkImage image,
+                                        VkAccessFlags srcAccessMask,
+                                        VkAccessFlags dstAccessMask,
+                                        VkImageLayout oldImageLayout,
+                                        VkImageLayout newImageLayout,
+                                        VkPipelineStageFlags srcStageMask,
+                                        VkPipelineStageFlags dstStageMask,
+                                        uint32_t srcQueueFamilyIndex,
+                                        uint32_t dstQueueFamilyIndex,
+                                        VkImageSubresourceRange subresourceRange);
+
+/* Same as ivkBufferMemoryBarrier(), but performs a queue family ownership transfer. Record the
+ * release half on the source queue and the matching acquire half on the destination queue. */
+void ivkBufferMemoryBarrierQueueTransfer(const struct VulkanFunctionTable* vt,
+                                         VkCommandBuffer cmdBuffer,
+                                         VkBuffer buffer,
+                                         VkAccessFlags srcAccessMask,
+                                         VkAccessFlags dstAccessMask,
+                                         VkDeviceSize offset,
+                                         VkDeviceSize size,
+                                         VkPipelineStageFlags srcStageMask,
+                                         VkPipelineStageFlags dstStageMask,
+                                         uint32_t srcQueueFamilyIndex,
+                                         uint32_t dstQueueFamilyIndex);
+
 void ivkBufferBarrier(const struct VulkanFunctionTable* vt,
                       VkCommandBuffer cmdBuffer,
                       VkBuffer buffer,
@@ -512,8 +580,10 @@ VkResult ivkVmaCreateAllocator(const struct VulkanFunctionTable* vt,
                                bool enableBufferDeviceAddress,
                                VmaAllocator* outVma);
 
+#if !IGL_VULKAN_NO_GLSLANG
 void ivkGlslangResource(glslang_resource_t* glslangResource,
                         const VkPhysicalDeviceProperties* deviceProperties);
+#endif // !IGL_VULKAN_NO_GLSLANG
 
 #ifdef __cplusplus
 }
@@ -7,9 +7,12 @@
 
 #include "VulkanImage.h"
 
+#include <algorithm>
 #include <array>
 #include <cinttypes>
 #include <igl/vulkan/Common.h>
+#include <igl/vulkan/VulkanBarrierBatcher.h>
+#include <igl/vulkan/VulkanComputeMipmapGenerator.h>
 #include <igl/vulkan/VulkanContext.h>
 #include <igl/vulkan/VulkanImageView.h>
 
@@ -38,6 +41,17 @@ uint32_t ivkGetMemoryTypeIndex(const VkPhysicalDeviceMemoryProperties& memProps,
   return 0;
 }
 
+// packs a tile coordinate into a key for VulkanImage::sparseResidentTiles_; tile coordinates are
+// in units of the sparse tile granularity, which keeps each component well below its bit budget
+uint64_t ivkGetSparseTileKey(uint32_t tileX,
+                             uint32_t tileY,
+                             uint32_t tileZ,
+                             uint32_t mipLevel,
+                             uint32_t arrayLayer) {
+  return ((uint64_t)mipLevel << 60) | ((uint64_t)arrayLayer << 48) | ((uint64_t)tileZ << 32) |
+         ((uint64_t)tileY << 16) | (uint64_t)tileX;
+}
+
 // VkImage export and import is only implemented on Windows, Linux and Android platforms.
 #if IGL_PLATFORM_WIN
 constexpr auto kHandleType = VK_EXTERNAL_MEMORY_HANDLE_TYPE_OPAQUE_WIN32_KMT_BIT;
@@ -149,12 +163,96 @@ VulkanImage::VulkanImage(const VulkanContext& ctx,
                                                      createFlags,
                                                      samples);
 
-  if (IGL_VULKAN_USE_VMA) {
+  if (createFlags & VK_IMAGE_CREATE_SPARSE_RESIDENCY_BIT) {
+    isSparse_ = true;
+
+    // sparse images own no memory at creation: tiles are bound on demand with bindSparseRegion().
+    // Only the mip tail - the levels too small to be split into tiles - is bound here, so coarse
+    // mips can always be sampled
+    VK_ASSERT(ctx_.vf_.vkCreateImage(device_, &ci, nullptr, &vkImage_));
+
+    VkMemoryRequirements memRequirements = {};
+    ctx_.vf_.vkGetImageMemoryRequirements(device, vkImage_, &memRequirements);
+    // for sparse images the required alignment is the size of one sparse memory block
+    sparseBlockSizeBytes_ = memRequirements.alignment;
+    sparseMemoryTypeBits_ = memRequirements.memoryTypeBits;
+
+    uint32_t requirementsCount = 1;
+    VkSparseImageMemoryRequirements sparseRequirements = {};
+    ctx_.vf_.vkGetImageSparseMemoryRequirements(
+        device, vkImage_, &requirementsCount, &sparseRequirements);
+
+    if (IGL_VERIFY(requirementsCount)) {
+      sparseTileGranularity_ = sparseRequirements.formatProperties.imageGranularity;
+      sparseMipTailFirstLod_ = sparseRequirements.imageMipTailFirstLod;
+
+      if (sparseRequirements.imageMipTailSize) {
+        const bool singleMipTail = (sparseRequirements.formatProperties.flags &
+                                    VK_SPARSE_IMAGE_FORMAT_SINGLE_MIPTAIL_BIT) != 0;
+        const uint32_t numMipTails = singleMipTail ? 1u : arrayLayers_;
+        const VkMemoryRequirements mipTailRequirements = {
+            numMipTails * sparseRequirements.imageMipTailSize,
+            sparseBlockSizeBytes_,
+            sparseMemoryTypeBits_,
+        };
+        VK_ASSERT(ivkAllocateMemory(&ctx_.vf_,
+                                    physicalDevice_,
+                                    device_,
+                                    &mipTailRequirements,
+                                    VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+                                    false,
+                                    &vkMemory_));
+
+        std::vector<VkSparseMemoryBind> mipTailBinds;
+        mipTailBinds.reserve(numMipTails);
+        for (uint32_t i = 0; i != numMipTails; i++) {
+          mipTailBinds.push_back(VkSparseMemoryBind{
+              sparseRequirements.imageMipTailOffset + i * sparseRequirements.imageMipTailStride,
+              sparseRequirements.imageMipTailSize,
+              vkMemory_,
+              i * sparseRequirements.imageMipTailSize,
+              0,
+          });
+        }
+        const VkSparseImageOpaqueMemoryBindInfo opaqueBindInfo = {
+            vkImage_,
+            (uint32_t)mipTailBinds.size(),
+            mipTailBinds.data(),
+        };
+        const VkBindSparseInfo bindInfo = {
+            VK_STRUCTURE_TYPE_BIND_SPARSE_INFO,
+            nullptr,
+            0,
+            nullptr,
+            0,
+            nullptr,
+            1,
+            &opaqueBindInfo,
+            0,
+            nullptr,
+            0,
+            nullptr,
+        };
+        VK_ASSERT(ctx_.vf_.vkQueueBindSparse(
+            ctx_.deviceQueues_.graphicsQueue, 1, &bindInfo, VK_NULL_HANDLE));
+        VK_ASSERT(ctx_.vf_.vkQueueWaitIdle(ctx_.deviceQueues_.graphicsQueue));
+
+        allocatedSize = mipTailRequirements.size;
+        ctx_.totalImageAllocatedBytes_.fetch_add(allocatedSize, std::memory_order_relaxed);
+      }
+    }
+  } else if (IGL_VULKAN_USE_VMA) {
     VmaAllocationCreateInfo ciAlloc = {};
 
     ciAlloc.usage = memFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT ? VMA_MEMORY_USAGE_CPU_TO_GPU
                                                                    : VMA_MEMORY_USAGE_AUTO;
 
+    if (memFlags & VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT) {
+      // transient attachments prefer lazily allocated (tile) memory; VMA falls back to regular
+      // device-local memory when the implementation exposes no such memory type
+      ciAlloc.usage = VMA_MEMORY_USAGE_GPU_LAZILY_ALLOCATED;
+    }
+
     VkResult result = vmaCreateImage(
         (VmaAllocator)ctx_.getVmaAllocator(), &ci, &ciAlloc, &vkImage_, &vmaAllocation_, nullptr);
 
@@ -174,6 +272,7 @@ VulkanImage::VulkanImage(const VulkanContext& ctx,
       VmaAllocationInfo allocationInfo;
       vmaGetAllocationInfo((VmaAllocator)ctx_.getVmaAllocator(), vmaAllocation_, &allocationInfo);
       allocatedSize = allocationInfo.size;
+      ctx_.totalImageAllocatedBytes_.fetch_add(allocatedSize, std::memory_order_relaxed);
     }
   } else {
     // create image
@@ -194,6 +293,7 @@ VulkanImage::VulkanImage(const VulkanContext& ctx,
       VK_ASSERT(ctx_.vf_.vkBindImageMemory(device_, vkImage_, vkMemory_, 0));
 
       allocatedSize = memRequirements.size;
+      ctx_.totalImageAllocatedBytes_.fetch_add(allocatedSize, std::memory_order_relaxed);
     }
 
     // handle memory-mapped images
@@ -207,6 +307,34 @@ VulkanImage::VulkanImage(const VulkanContext& ctx,
 
   // Get physical device's properties for the image's format
   ctx_.vf_.vkGetPhysicalDeviceFormatProperties(physicalDevice_, imageFormat_, &formatProperties_);
+
+#if defined(VK_EXT_image_compression_control)
+  if (ctx_.useImageCompressionControl_ && !isSparse_) {
+    // ask the driver whether the image actually ended up compressed; on desktop GPUs a render
+    // target can silently lose delta color compression, e.g. when it also carries
+    // VK_IMAGE_USAGE_STORAGE_BIT, costing bandwidth on every subsequent pass
+    VkImageCompressionPropertiesEXT compressionProps = {
+        VK_STRUCTURE_TYPE_IMAGE_COMPRESSION_PROPERTIES_EXT, nullptr};
+    VkSubresourceLayout2EXT layout = {VK_STRUCTURE_TYPE_SUBRESOURCE_LAYOUT_2_EXT,
+                                      &compressionProps};
+    const VkImageAspectFlags aspect = isDepthFormat_     ? VK_IMAGE_ASPECT_DEPTH_BIT
+                                      : isStencilFormat_ ? VK_IMAGE_ASPECT_STENCIL_BIT
+                                                         : VK_IMAGE_ASPECT_COLOR_BIT;
+    const VkImageSubresource2EXT subresource = {
+        VK_STRUCTURE_TYPE_IMAGE_SUBRESOURCE_2_EXT, nullptr, {aspect, 0, 0}};
+    ctx_.vkGetImageSubresourceLayout2EXT_(device_, vkImage_, &subresource, &layout);
+    isCompressionDisabled_ =
+        compressionProps.imageCompressionFlags == VK_IMAGE_COMPRESSION_DISABLED_EXT;
+    const VkImageUsageFlags attachmentUsage =
+        VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT;
+    if (isCompressionDisabled_ && (usageFlags_ & attachmentUsage) != 0) {
+      ctx_.totalUncompressedAttachmentBytes_.fetch_add(allocatedSize, std::memory_order_relaxed);
+      IGL_LOG_INFO("Attachment image '%s' was created without compression (usage flags 0x%x)\n",
+                   debugName ? debugName : "",
+                   usageFlags_);
+    }
+  }
+#endif // defined(VK_EXT_image_compression_control)
 }
 
 VulkanImage::VulkanImage(const VulkanContext& ctx,
@@ -610,8 +738,35 @@ VulkanImage::VulkanImage(const VulkanContext& ctx,
 VulkanImage::~VulkanImage() {
   IGL_PROFILER_FUNCTION_COLOR(IGL_PROFILER_COLOR_DESTROY);
 
+  // `allocatedSize` is only non-zero for images whose memory was allocated by this class
+  ctx_.totalImageAllocatedBytes_.fetch_sub(allocatedSize, std::memory_order_relaxed);
+
+  if (isCompressionDisabled_ &&
+      (usageFlags_ & (VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT |
+                      VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT)) != 0) {
+    ctx_.totalUncompressedAttachmentBytes_.fetch_sub(allocatedSize, std::memory_order_relaxed);
+  }
+
+  if (isSparse_ && !sparseResidentTiles_.empty()) {
+    ctx_.totalImageAllocatedBytes_.fetch_sub(sparseBlockSizeBytes_ * sparseResidentTiles_.size(),
+                                             std::memory_order_relaxed);
+    std::vector<VkDeviceMemory> tiles;
+    tiles.reserve(sparseResidentTiles_.size());
+    for (const auto& [key, memory] : sparseResidentTiles_) {
+      tiles.push_back(memory);
+    }
+    ctx_.deferredTask(std::packaged_task<void()>(
+        [vf = &ctx_.vf_, device = device_, tiles = std::move(tiles)]() {
+          for (VkDeviceMemory memory : tiles) {
+            vf->vkFreeMemory(device, memory, nullptr);
+          }
+        }));
+  }
+
   if (!isExternallyManaged_) {
-    if (IGL_VULKAN_USE_VMA && !isImported_ && !isExported_) {
+    // sparse images are created without VMA even when VMA is enabled; their image handle and the
+    // mip tail memory go through the non-VMA path below
+    if (IGL_VULKAN_USE_VMA && !isImported_ && !isExported_ && !isSparse_) {
       if (mappedPtr_) {
         vmaUnmapMemory((VmaAllocator)ctx_.getVmaAllocator(), vmaAllocation_);
       }
@@ -659,17 +814,196 @@ std::unique_ptr<VulkanImageView> VulkanImage::createImageView(VulkanImageViewCre
   return std::make_unique<VulkanImageView>(ctx_, device_, vkImage_, createInfo, debugName);
 }
 
-void VulkanImage::transitionLayout(VkCommandBuffer cmdBuf,
-                                   VkImageLayout newImageLayout,
-                                   VkPipelineStageFlags srcStageMask,
-                                   VkPipelineStageFlags dstStageMask,
-                                   const VkImageSubresourceRange& subresourceRange) const {
-  IGL_PROFILER_FUNCTION_COLOR(IGL_PROFILER_COLOR_TRANSITION);
+Result VulkanImage::bindSparseRegion(VkOffset3D offset,
+                                     VkExtent3D extent,
+                                     uint32_t mipLevel,
+                                     uint32_t arrayLayer,
+                                     bool bind) {
+  IGL_PROFILER_FUNCTION();
 
-  VkAccessFlags srcAccessMask = 0;
-  VkAccessFlags dstAccessMask = 0;
+  if (!IGL_VERIFY(isSparse_ && sparseTileGranularity_.width)) {
+    return Result(Result::Code::InvalidOperation, "The image does not support sparse residency");
+  }
+  if (!IGL_VERIFY(mipLevel < mipLevels_ && arrayLayer < arrayLayers_)) {
+    return Result(Result::Code::ArgumentOutOfRange, "Mip level or array layer is out of range");
+  }
+  if (mipLevel >= sparseMipTailFirstLod_) {
+    // the mip tail was bound at creation and stays resident for the lifetime of the image
+    return bind ? Result()
+                : Result(Result::Code::InvalidOperation,
+                         "Mip levels inside the mip tail cannot be unbound");
+  }
 
-  if (imageLayout_ == VK_IMAGE_LAYOUT_UNDEFINED) {
+  const uint32_t mipWidth = std::max(extent_.width >> mipLevel, 1u);
+  const uint32_t mipHeight = std::max(extent_.height >> mipLevel, 1u);
+  const uint32_t mipDepth = std::max(extent_.depth >> mipLevel, 1u);
+
+  const uint32_t tileX0 = (uint32_t)offset.x / sparseTileGranularity_.width;
+  const uint32_t tileY0 = (uint32_t)offset.y / sparseTileGranularity_.height;
+  const uint32_t tileZ0 = (uint32_t)offset.z / sparseTileGranularity_.depth;
+  const uint32_t tileX1 =
+      std::min((uint32_t)offset.x + extent.width + sparseTileGranularity_.width - 1,
+               mipWidth + sparseTileGranularity_.width - 1) /
+      sparseTileGranularity_.width;
+  const uint32_t tileY1 =
+      std::min((uint32_t)offset.y + extent.height + sparseTileGranularity_.height - 1,
+               mipHeight + sparseTileGranularity_.height - 1) /
+      sparseTileGranularity_.height;
+  const uint32_t tileZ1 =
+      std::min((uint32_t)offset.z + extent.depth + sparseTileGranularity_.depth - 1,
+               mipDepth + sparseTileGranularity_.depth - 1) /
+      sparseTileGranularity_.depth;
+
+  std::vector<VkSparseImageMemoryBind> binds;
+  std::vector<VkDeviceMemory> retiredMemory;
+
+  for (uint32_t tileZ = tileZ0; tileZ < tileZ1; tileZ++) {
+    for (uint32_t tileY = tileY0; tileY < tileY1; tileY++) {
+      for (uint32_t tileX = tileX0; tileX < tileX1; tileX++) {
+        const uint64_t key = ivkGetSparseTileKey(tileX, tileY, tileZ, mipLevel, arrayLayer);
+        const auto it = sparseResidentTiles_.find(key);
+        if (bind == (it != sparseResidentTiles_.end())) {
+          // already in the requested state
+          continue;
+        }
+        const VkOffset3D tileOffset = {
+            (int32_t)(tileX * sparseTileGranularity_.width),
+            (int32_t)(tileY * sparseTileGranularity_.height),
+            (int32_t)(tileZ * sparseTileGranularity_.depth),
+        };
+        // tiles on the right/bottom/back edges of a mip are truncated to the mip dimensions
+        const VkExtent3D tileExtent = {
+            std::min(sparseTileGranularity_.width, mipWidth - (uint32_t)tileOffset.x),
+            std::min(sparseTileGranularity_.height, mipHeight - (uint32_t)tileOffset.y),
+            std::min(sparseTileGranularity_.depth, mipDepth - (uint32_t)tileOffset.z),
+        };
+        VkDeviceMemory memory = VK_NULL_HANDLE;
+        if (bind) {
+          const VkMemoryRequirements tileRequirements = {
+              sparseBlockSizeBytes_,
+              sparseBlockSizeBytes_,
+              sparseMemoryTypeBits_,
+          };
+          const VkResult result = ivkAllocateMemory(&ctx_.vf_,
+                                                    physicalDevice_,
+                                                    device_,
+                                                    &tileRequirements,
+                                                    VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+                                                    false,
+                                                    &memory);
+          if (!IGL_VERIFY(result == VK_SUCCESS)) {
+            break;
+          }
+          sparseResidentTiles_[key] = memory;
+        } else {
+          retiredMemory.push_back(it->second);
+          sparseResidentTiles_.erase(it);
+        }
+        binds.push_back(VkSparseImageMemoryBind{
+            {getImageAspectFlags(), mipLevel, arrayLayer},
+            tileOffset,
+            tileExtent,
+            memory,
+            0,
+            0,
+        });
+      }
+    }
+  }
+
+  if (!binds.empty()) {
+    const VkSparseImageMemoryBindInfo imageBindInfo = {
+        vkImage_,
+        (uint32_t)binds.size(),
+        binds.data(),
+    };
+    const VkBindSparseInfo bindInfo = {
+        VK_STRUCTURE_TYPE_BIND_SPARSE_INFO,
+        nullptr,
+        0,
+        nullptr,
+        0,
+        nullptr,
+        0,
+        nullptr,
+        1,
+        &imageBindInfo,
+        0,
+        nullptr,
+    };
+    // synchronous by design: residency changes are expected between frames, and waiting here
+    // keeps the binds ordered against any command buffers submitted afterwards
+    VK_ASSERT_RETURN(
+        ctx_.vf_.vkQueueBindSparse(ctx_.deviceQueues_.graphicsQueue, 1, &bindInfo, VK_NULL_HANDLE));
+    VK_ASSERT_RETURN(ctx_.vf_.vkQueueWaitIdle(ctx_.deviceQueues_.graphicsQueue));
+
+    if (bind) {
+      ctx_.totalImageAllocatedBytes_.fetch_add(sparseBlockSizeBytes_ * binds.size(),
+                                               std::memory_order_relaxed);
+    } else {
+      ctx_.totalImageAllocatedBytes_.fetch_sub(sparseBlockSizeBytes_ * retiredMemory.size(),
+                                               std::memory_order_relaxed);
+      for (VkDeviceMemory memory : retiredMemory) {
+        ctx_.vf_.vkFreeMemory(device_, memory, nullptr);
+      }
+    }
+  }
+
+  return Result();
+}
+
+bool VulkanImage::isSparseRegionResident(VkOffset3D offset,
+                                         VkExtent3D extent,
+                                         uint32_t mipLevel,
+                                         uint32_t arrayLayer) const {
+  if (!isSparse_ || !sparseTileGranularity_.width) {
+    return false;
+  }
+  if (mipLevel >= sparseMipTailFirstLod_) {
+    // the mip tail is always resident
+    return mipLevel < mipLevels_;
+  }
+
+  const uint32_t tileX0 = (uint32_t)offset.x / sparseTileGranularity_.width;
+  const uint32_t tileY0 = (uint32_t)offset.y / sparseTileGranularity_.height;
+  const uint32_t tileZ0 = (uint32_t)offset.z / sparseTileGranularity_.depth;
+  const uint32_t tileX1 = ((uint32_t)offset.x + extent.width + sparseTileGranularity_.width - 1) /
+                          sparseTileGranularity_.width;
+  const uint32_t tileY1 = ((uint32_t)offset.y + extent.height + sparseTileGranularity_.height - 1) /
+                          sparseTileGranularity_.height;
+  const uint32_t tileZ1 = ((uint32_t)offset.z + extent.depth + sparseTileGranularity_.depth - 1) /
+                          sparseTileGranularity_.depth;
+
+  for (uint32_t tileZ = tileZ0; tileZ < tileZ1; tileZ++) {
+    for (uint32_t tileY = tileY0; tileY < tileY1; tileY++) {
+      for (uint32_t tileX = tileX0; tileX < tileX1; tileX++) {
+        if (sparseResidentTiles_.count(
+                ivkGetSparseTileKey(tileX, tileY, tileZ, mipLevel, arrayLayer)) == 0) {
+          return false;
+        }
+      }
+    }
+  }
+
+  return true;
+}
+
+namespace {
+
+/// @brief Deduces the source and destination access masks for an image layout transition from the
+/// provided stage masks. Not all `VkPipelineStageFlags` are supported. The stage masks are taken by
+/// reference because they may be overridden: the source stage collapses to
+/// VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT when the old layout is VK_IMAGE_LAYOUT_UNDEFINED, and
+/// IGL_DEBUG_ENFORCE_FULL_IMAGE_BARRIER replaces everything with a full barrier
+void deduceAccessMasks(VkImageLayout oldImageLayout,
+                       VkPipelineStageFlags& srcStageMask,
+                       VkPipelineStageFlags& dstStageMask,
+                       VkAccessFlags& srcAccessMask,
+                       VkAccessFlags& dstAccessMask) {
+  srcAccessMask = 0;
+  dstAccessMask = 0;
+
+  if (oldImageLayout == VK_IMAGE_LAYOUT_UNDEFINED) {
     // we do not need to wait for any previous operations in this case
     srcStageMask = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
   }
@@ -767,6 +1101,20 @@ void VulkanImage::transitionLayout(VkCommandBuffer cmdBuf,
   srcStageMask = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
   dstStageMask = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
 #endif // IGL_DEBUG_ENFORCE_FULL_IMAGE_BARRIER
+}
+
+} // namespace
+
+void VulkanImage::transitionLayout(VkCommandBuffer cmdBuf,
+                                   VkImageLayout newImageLayout,
+                                   VkPipelineStageFlags srcStageMask,
+                                   VkPipelineStageFlags dstStageMask,
+                                   const VkImageSubresourceRange& subresourceRange) const {
+  IGL_PROFILER_FUNCTION_COLOR(IGL_PROFILER_COLOR_TRANSITION);
+
+  VkAccessFlags srcAccessMask = 0;
+  VkAccessFlags dstAccessMask = 0;
+  deduceAccessMasks(imageLayout_, srcStageMask, dstStageMask, srcAccessMask, dstAccessMask);
 
   ivkImageMemoryBarrier(&ctx_.vf_,
                         cmdBuf,
@@ -782,6 +1130,27 @@ void VulkanImage::transitionLayout(VkCommandBuffer cmdBuf,
   imageLayout_ = newImageLayout;
 }
 
+void VulkanImage::transitionLayoutBatched(VulkanBarrierBatcher& batcher,
+                                          VkImageLayout newImageLayout,
+                                          VkPipelineStageFlags srcStageMask,
+                                          VkPipelineStageFlags dstStageMask,
+                                          const VkImageSubresourceRange& subresourceRange) const {
+  VkAccessFlags srcAccessMask = 0;
+  VkAccessFlags dstAccessMask = 0;
+  deduceAccessMasks(imageLayout_, srcStageMask, dstStageMask, srcAccessMask, dstAccessMask);
+
+  batcher.addImageBarrier(vkImage_,
+                          srcAccessMask,
+                          dstAccessMask,
+                          imageLayout_,
+                          newImageLayout,
+                          srcStageMask,
+                          dstStageMask,
+                          subresourceRange);
+
+  imageLayout_ = newImageLayout;
+}
+
 VkImageAspectFlags VulkanImage::getImageAspectFlags() const {
   VkImageAspectFlags flags = 0;
 
@@ -801,6 +1170,18 @@ VkImageAspectFlags VulkanImage::getImageAspectFlags() const {
 void VulkanImage::generateMipmap(VkCommandBuffer commandBuffer) const {
   IGL_PROFILER_FUNCTION();
 
+  // Use the compute downsample path when enabled and supported by this image; images that do not
+  // qualify (no storage usage, depth/stencil, multisampled, ...) fall through to the blit chain
+  if (ctx_.config_.enableComputeMipmapGeneration) {
+    if (!ctx_.computeMipmapGenerator_) {
+      ctx_.computeMipmapGenerator_ = std::make_unique<VulkanComputeMipmapGenerator>(ctx_);
+    }
+    if (ctx_.computeMipmapGenerator_->canGenerate(*this)) {
+      ctx_.computeMipmapGenerator_->generate(commandBuffer, *this);
+      return;
+    }
+  }
+
   // Check if device supports downscaling for color or depth/stencil buffer based on image format
   {
     const uint32_t formatFeatureMask =
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 #include <igl/vulkan/Common.h>
@@ -16,6 +17,7 @@
 namespace igl {
 namespace vulkan {
 
+class VulkanBarrierBatcher;
 class VulkanContext;
 class VulkanImageView;
 struct VulkanImageViewCreateInfo;
@@ -225,8 +227,42 @@ class VulkanImage final {
                         VkPipelineStageFlags dstStageMask,
                         const VkImageSubresourceRange& subresourceRange) const;
 
+  /**
+   * @brief Same as `transitionLayout()`, but instead of recording the Image Memory Barrier
+   * immediately, appends it to the provided batcher so that transitions of several images can be
+   * flushed as a single `vkCmdPipelineBarrier()` call. The layout stored in the object is updated
+   * right away, so callers must flush the batcher into the command buffer before recording any
+   * command that depends on the new layout
+   */
+  void transitionLayoutBatched(VulkanBarrierBatcher& batcher,
+                               VkImageLayout newImageLayout,
+                               VkPipelineStageFlags srcStageMask,
+                               VkPipelineStageFlags dstStageMask,
+                               const VkImageSubresourceRange& subresourceRange) const;
+
   VkImageAspectFlags getImageAspectFlags() const;
 
+  /** @brief Binds (or unbinds) device memory for all sparse tiles covered by the given region of
+   * one mip level and array layer. Newly covered tiles get one sparse memory block each; tiles
+   * that are already in the requested state are left untouched. The residency change is applied
+   * synchronously with `vkQueueBindSparse()` on the graphics queue, so this must be called from
+   * the thread that submits command buffers and not while a frame is being recorded. Only valid
+   * for images created with `VK_IMAGE_CREATE_SPARSE_RESIDENCY_BIT`. Mip levels inside the mip
+   * tail are always resident and cannot be unbound
+   */
+  Result bindSparseRegion(VkOffset3D offset,
+                          VkExtent3D extent,
+                          uint32_t mipLevel,
+                          uint32_t arrayLayer,
+                          bool bind);
+
+  /// @brief Returns true when every sparse tile covered by the region is resident. Mip levels
+  /// inside the mip tail are always resident
+  bool isSparseRegionResident(VkOffset3D offset,
+                              VkExtent3D extent,
+                              uint32_t mipLevel,
+                              uint32_t arrayLayer) const;
+
   static bool isDepthFormat(VkFormat format);
   static bool isStencilFormat(VkFormat format);
 
@@ -251,7 +287,19 @@ class VulkanImage final {
   bool isStencilFormat_ = false;
   bool isDepthOrStencilFormat_ = false;
   VkDeviceSize allocatedSize = 0;
+  // sparse images (VK_IMAGE_CREATE_SPARSE_RESIDENCY_BIT): the tile granularity in texels, the
+  // size of one sparse memory block, and the memory bound to each resident tile, keyed by
+  // (mipLevel, layer, tileX, tileY, tileZ). `vkMemory_` holds the always-resident mip tail
+  bool isSparse_ = false;
+  VkExtent3D sparseTileGranularity_ = {0, 0, 0};
+  VkDeviceSize sparseBlockSizeBytes_ = 0;
+  uint32_t sparseMemoryTypeBits_ = 0;
+  uint32_t sparseMipTailFirstLod_ = 0;
+  std::unordered_map<uint64_t, VkDeviceMemory> sparseResidentTiles_;
   mutable VkImageLayout imageLayout_ = VK_IMAGE_LAYOUT_UNDEFINED; // current image layout
+  // true when the driver reported all compression (e.g. DCC) disabled for this image; only
+  // queried when VulkanContext::useImageCompressionControl_ is set, false otherwise
+  bool isCompressionDisabled_ = false;
   bool isImported_ = false;
   bool isExported_ = false;
   void* exportedMemoryHandle_ = nullptr; // windows handle
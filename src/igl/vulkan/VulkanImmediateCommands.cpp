@@ -17,6 +17,7 @@ VulkanImmediateCommands::VulkanImmediateCommands(const VulkanFunctionTable& vf,
                                                  VkDevice device,
                                                  uint32_t queueFamilyIndex,
                                                  bool exportableFences,
+                                                 bool useTimelineSemaphores,
                                                  const char* debugName) :
   vf_(vf),
   device_(device),
@@ -31,6 +32,15 @@ VulkanImmediateCommands::VulkanImmediateCommands(const VulkanFunctionTable& vf,
 
   vf_.vkGetDeviceQueue(device, queueFamilyIndex, 0, &queue_);
 
+  if (useTimelineSemaphores) {
+    // exportable fences are handed out via getVkFenceFromSubmitHandle(), which is incompatible
+    // with this mode because no fences are submitted
+    IGL_ASSERT_MSG(!exportableFences,
+                   "Timeline semaphores cannot be combined with exportable fences");
+    timelineSemaphore_ = std::make_unique<VulkanSemaphore>(
+        vf_, device_, uint64_t(0), IGL_FORMAT("Semaphore: {} (timeline)", debugName).c_str());
+  }
+
   buffers_.reserve(kMaxCommandBuffers);
 
   for (uint32_t i = 0; i != kMaxCommandBuffers; i++) {
@@ -52,14 +62,42 @@ VulkanImmediateCommands::~VulkanImmediateCommands() {
   waitAll();
 }
 
+uint64_t VulkanImmediateCommands::getTimelineCounterValue() const {
+  IGL_ASSERT(timelineSemaphore_);
+
+  uint64_t value = 0;
+  VK_ASSERT(
+      vf_.vkGetSemaphoreCounterValueKHR(device_, timelineSemaphore_->getVkSemaphore(), &value));
+  return value;
+}
+
 void VulkanImmediateCommands::purge() {
   IGL_PROFILER_FUNCTION();
 
+  // in timeline semaphore mode, one query of the timeline counter is enough to recycle all
+  // completed command buffers - no per-buffer fence checks and no fence resets
+  const uint64_t completedValue = timelineSemaphore_ ? getTimelineCounterValue() : 0;
+
   for (auto& buf : buffers_) {
     if (buf.cmdBuf_ == VK_NULL_HANDLE || buf.isEncoding_) {
       continue;
     }
 
+    // reusable command buffers keep their recording across submissions; they only return to the
+    // pool through releaseReusable()
+    if (buf.isReusable_) {
+      continue;
+    }
+
+    if (timelineSemaphore_) {
+      if (completedValue >= buf.timelineWaitValue_) {
+        VK_ASSERT(vf_.vkResetCommandBuffer(buf.cmdBuf_, VkCommandBufferResetFlags{0}));
+        buf.cmdBuf_ = VK_NULL_HANDLE;
+        numAvailableCommandBuffers_++;
+      }
+      continue;
+    }
+
     const VkResult result = vf_.vkWaitForFences(device_, 1, &buf.fence_.vkFence_, VK_TRUE, 0);
 
     if (result == VK_SUCCESS) {
@@ -75,7 +113,8 @@ void VulkanImmediateCommands::purge() {
   }
 }
 
-const VulkanImmediateCommands::CommandBufferWrapper& VulkanImmediateCommands::acquire() {
+const VulkanImmediateCommands::CommandBufferWrapper& VulkanImmediateCommands::acquire(
+    bool reusable) {
   IGL_PROFILER_FUNCTION();
 
   if (!numAvailableCommandBuffers_) {
@@ -111,7 +150,13 @@ const VulkanImmediateCommands::CommandBufferWrapper& VulkanImmediateCommands::ac
 
   current->cmdBuf_ = current->cmdBufAllocated_;
   current->isEncoding_ = true;
-  VK_ASSERT(ivkBeginCommandBuffer(&vf_, current->cmdBuf_));
+  current->isReusable_ = reusable;
+  if (reusable) {
+    // no ONE_TIME_SUBMIT: the recording must stay valid for resubmit()
+    VK_ASSERT(ivkBeginCommandBufferForReuse(&vf_, current->cmdBuf_));
+  } else {
+    VK_ASSERT(ivkBeginCommandBuffer(&vf_, current->cmdBuf_));
+  }
 
   return *current;
 }
@@ -129,8 +174,21 @@ void VulkanImmediateCommands::wait(const SubmitHandle handle, uint64_t timeoutNa
 
   IGL_PROFILER_FUNCTION_COLOR(IGL_PROFILER_COLOR_WAIT);
 
-  VK_ASSERT(vf_.vkWaitForFences(
-      device_, 1, &buffers_[handle.bufferIndex_].fence_.vkFence_, VK_TRUE, timeoutNanoseconds));
+  if (timelineSemaphore_) {
+    const VkSemaphore semaphore = timelineSemaphore_->getVkSemaphore();
+    const VkSemaphoreWaitInfoKHR waitInfo = {
+        VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO_KHR,
+        nullptr,
+        0,
+        1,
+        &semaphore,
+        &buffers_[handle.bufferIndex_].timelineWaitValue_,
+    };
+    VK_ASSERT(vf_.vkWaitSemaphoresKHR(device_, &waitInfo, timeoutNanoseconds));
+  } else {
+    VK_ASSERT(vf_.vkWaitForFences(
+        device_, 1, &buffers_[handle.bufferIndex_].fence_.vkFence_, VK_TRUE, timeoutNanoseconds));
+  }
 
   purge();
 }
@@ -138,6 +196,24 @@ void VulkanImmediateCommands::wait(const SubmitHandle handle, uint64_t timeoutNa
 void VulkanImmediateCommands::waitAll() {
   IGL_PROFILER_FUNCTION_COLOR(IGL_PROFILER_COLOR_WAIT);
 
+  if (timelineSemaphore_) {
+    // waiting for the most recently signaled value covers all previous submissions
+    if (lastSignaledValue_) {
+      const VkSemaphore semaphore = timelineSemaphore_->getVkSemaphore();
+      const VkSemaphoreWaitInfoKHR waitInfo = {
+          VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO_KHR,
+          nullptr,
+          0,
+          1,
+          &semaphore,
+          &lastSignaledValue_,
+      };
+      VK_ASSERT(vf_.vkWaitSemaphoresKHR(device_, &waitInfo, UINT64_MAX));
+    }
+    purge();
+    return;
+  }
+
   // @lint-ignore CLANGTIDY
   VkFence fences[kMaxCommandBuffers];
 
@@ -188,6 +264,10 @@ bool VulkanImmediateCommands::isReady(const SubmitHandle handle) const {
     return true;
   }
 
+  if (timelineSemaphore_) {
+    return getTimelineCounterValue() >= buf.timelineWaitValue_;
+  }
+
   return vf_.vkWaitForFences(device_, 1, &buf.fence_.vkFence_, VK_TRUE, 0) == VK_SUCCESS;
 }
 
@@ -197,6 +277,52 @@ VulkanImmediateCommands::SubmitHandle VulkanImmediateCommands::submit(
   IGL_ASSERT(wrapper.isEncoding_);
   VK_ASSERT(ivkEndCommandBuffer(&vf_, wrapper.cmdBuf_));
 
+  return submitInternal(wrapper);
+}
+
+VulkanImmediateCommands::SubmitHandle VulkanImmediateCommands::resubmit(
+    const CommandBufferWrapper& wrapper) {
+  IGL_PROFILER_FUNCTION_COLOR(IGL_PROFILER_COLOR_SUBMIT);
+  IGL_ASSERT_MSG(wrapper.isReusable_, "Only reusable command buffers can be resubmitted");
+  IGL_ASSERT_MSG(!wrapper.isEncoding_, "Cannot resubmit a command buffer that is still encoding");
+  IGL_ASSERT(wrapper.cmdBuf_ != VK_NULL_HANDLE);
+
+  // a command buffer recorded without ONE_TIME_SUBMIT can be submitted repeatedly, but not while
+  // a previous submission of it is still pending
+  if (!isReady(wrapper.handle_)) {
+    wait(wrapper.handle_);
+  }
+  if (!timelineSemaphore_ && !wrapper.handle_.empty()) {
+    // purge() skips reusable command buffers, so the fence of the previous submission is still
+    // signaled and must be reset by hand
+    VK_ASSERT(vf_.vkResetFences(device_, 1, &wrapper.fence_.vkFence_));
+  }
+
+  const_cast<CommandBufferWrapper&>(wrapper).handle_.submitId_ = submitCounter_;
+
+  return submitInternal(wrapper);
+}
+
+void VulkanImmediateCommands::releaseReusable(const CommandBufferWrapper& wrapper) {
+  IGL_ASSERT(wrapper.isReusable_);
+
+  if (!isReady(wrapper.handle_)) {
+    wait(wrapper.handle_);
+  }
+
+  auto& buf = const_cast<CommandBufferWrapper&>(wrapper);
+  VK_ASSERT(vf_.vkResetCommandBuffer(buf.cmdBuf_, VkCommandBufferResetFlags{0}));
+  if (!timelineSemaphore_ && !buf.handle_.empty()) {
+    VK_ASSERT(vf_.vkResetFences(device_, 1, &buf.fence_.vkFence_));
+  }
+  buf.cmdBuf_ = VK_NULL_HANDLE;
+  buf.isReusable_ = false;
+  buf.isEncoding_ = false;
+  numAvailableCommandBuffers_++;
+}
+
+VulkanImmediateCommands::SubmitHandle VulkanImmediateCommands::submitInternal(
+    const CommandBufferWrapper& wrapper) {
   // @lint-ignore CLANGTIDY
   const VkPipelineStageFlags waitStageMasks[] = {VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
                                                  VK_PIPELINE_STAGE_ALL_COMMANDS_BIT};
@@ -210,18 +336,49 @@ VulkanImmediateCommands::SubmitHandle VulkanImmediateCommands::submit(
     waitSemaphores[numWaitSemaphores++] = lastSubmitSemaphore_;
   }
 
-  const VkSubmitInfo si = ivkGetSubmitInfo(&wrapper.cmdBuf_,
-                                           numWaitSemaphores,
-                                           waitSemaphores,
-                                           waitStageMasks,
-                                           &wrapper.semaphore_.vkSemaphore_);
+  VkSubmitInfo si = ivkGetSubmitInfo(&wrapper.cmdBuf_,
+                                     numWaitSemaphores,
+                                     waitSemaphores,
+                                     waitStageMasks,
+                                     &wrapper.semaphore_.vkSemaphore_);
   // @lint-ignore CLANGTIDY
-  const VkFence vkFence = wrapper.fence_.vkFence_;
+  VkFence vkFence = wrapper.fence_.vkFence_;
+
+  // @lint-ignore CLANGTIDY
+  const VkSemaphore signalSemaphores[] = {wrapper.semaphore_.vkSemaphore_,
+                                          timelineSemaphore_ ? timelineSemaphore_->getVkSemaphore()
+                                                             : VK_NULL_HANDLE};
+  // @lint-ignore CLANGTIDY
+  const uint64_t signalValues[] = {0, lastSignaledValue_ + 1};
+  // @lint-ignore CLANGTIDY
+  const uint64_t waitValues[] = {0, 0}; // ignored for binary wait semaphores
+  const VkTimelineSemaphoreSubmitInfoKHR timelineInfo = {
+      VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR,
+      nullptr,
+      numWaitSemaphores,
+      waitValues,
+      2u,
+      signalValues,
+  };
+  if (timelineSemaphore_) {
+    // signal both the binary semaphore used for submission chaining and the timeline semaphore
+    // that tracks completion; no fence is submitted in this mode
+    si.pNext = &timelineInfo;
+    si.signalSemaphoreCount = 2u;
+    si.pSignalSemaphores = signalSemaphores;
+    const_cast<CommandBufferWrapper&>(wrapper).timelineWaitValue_ = ++lastSignaledValue_;
+    vkFence = VK_NULL_HANDLE;
+  }
   IGL_PROFILER_ZONE("vkQueueSubmit()", IGL_PROFILER_COLOR_SUBMIT);
 #if IGL_VULKAN_PRINT_COMMANDS
   IGL_LOG_INFO("%p vkQueueSubmit()\n\n", wrapper.cmdBuf_);
 #endif // IGL_VULKAN_PRINT_COMMANDS
-  VK_ASSERT(vf_.vkQueueSubmit(queue_, 1u, &si, vkFence));
+  const VkResult submitResult = vf_.vkQueueSubmit(queue_, 1u, &si, vkFence);
+  if (submitResult != VK_SUCCESS && submitErrorCallback_) {
+    // gives VulkanContext a chance to report GPU breadcrumbs before the assert below fires
+    submitErrorCallback_(submitResult);
+  }
+  VK_ASSERT(submitResult);
   IGL_PROFILER_ZONE_END();
 
   lastSubmitSemaphore_ = wrapper.semaphore_.vkSemaphore_;
@@ -256,6 +413,8 @@ VulkanImmediateCommands::SubmitHandle VulkanImmediateCommands::getLastSubmitHand
 
 VkFence VulkanImmediateCommands::getVkFenceFromSubmitHandle(SubmitHandle handle) {
   IGL_ASSERT(handle.bufferIndex_ < buffers_.size());
+  IGL_ASSERT_MSG(!timelineSemaphore_,
+                 "No fences are submitted when timeline semaphores are in use");
 
   if (isRecycled(handle)) {
     return VK_NULL_HANDLE;
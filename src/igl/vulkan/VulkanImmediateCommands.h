@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <functional>
+#include <memory>
 #include <vector>
 
 #include <igl/vulkan/Common.h>
@@ -32,11 +34,17 @@ class VulkanImmediateCommands final {
    * it easier for debugging
    * The constructor initializes the vector of `CommandBufferWrapper` structures with
    * a total of `kMaxCommandBuffers`
+   * When `useTimelineSemaphores` is true, completion of all submissions is tracked by a single
+   * monotonically increasing timeline semaphore counter instead of one fence per command buffer,
+   * which removes the vkResetFences()/vkWaitForFences() overhead on submission-heavy workloads. The
+   * device must have been created with the VK_KHR_timeline_semaphore feature enabled, and
+   * `exportableFences` must be false since no fences are submitted in this mode
    */
   VulkanImmediateCommands(const VulkanFunctionTable& vf,
                           VkDevice device,
                           uint32_t queueFamilyIndex,
                           bool exportableFences,
+                          bool useTimelineSemaphores,
                           const char* debugName);
   ~VulkanImmediateCommands();
   VulkanImmediateCommands(const VulkanImmediateCommands&) = delete;
@@ -101,12 +109,21 @@ class VulkanImmediateCommands final {
     /// @brief A VulkanSemaphore object associated with the submission of the command buffer for
     /// execution.
     VulkanSemaphore semaphore_;
+    /// @brief The timeline semaphore value signaled when this command buffer finishes executing.
+    /// Only valid in timeline semaphore mode, where it replaces the fence for completion tracking
+    uint64_t timelineWaitValue_ = 0;
     bool isEncoding_ = false;
+    /// @brief True for command buffers acquired for reuse (see CommandBufferDesc::reusable). A
+    /// reusable command buffer is begun without ONE_TIME_SUBMIT, is skipped by purge() so its
+    /// recording survives completion, and can be submitted again via resubmit() until it is
+    /// returned to the pool with releaseReusable()
+    bool isReusable_ = false;
   };
 
   /// @brief Returns a `CommandBufferWrapper` object with the current command buffer (creates one if
-  /// it does not exist) and its associated synchronization objects
-  const CommandBufferWrapper& acquire();
+  /// it does not exist) and its associated synchronization objects. Pass `reusable` to begin the
+  /// command buffer without ONE_TIME_SUBMIT so the recording can be resubmitted (see resubmit())
+  const CommandBufferWrapper& acquire(bool reusable = false);
 
   /** @brief Submits a command buffer (stored in a `CommandBufferWrapper` object) for submission and
    * returns the `SubmitHandle` associated with the command buffer. Caches the semaphore associated
@@ -119,6 +136,18 @@ class VulkanImmediateCommands final {
    */
   SubmitHandle submit(const CommandBufferWrapper& wrapper);
 
+  /** @brief Submits an already-recorded reusable command buffer again without re-encoding it.
+   * The wrapper must have been acquired with `reusable = true` and submitted at least once. A
+   * command buffer begun without ONE_TIME_SUBMIT may not be pending execution when it is
+   * submitted, so this waits for the previous submission of the same wrapper to complete (and
+   * resets its fence in fence mode) before queueing it again. Returns the new `SubmitHandle`
+   */
+  SubmitHandle resubmit(const CommandBufferWrapper& wrapper);
+
+  /// @brief Returns a reusable command buffer to the pool: waits for its last submission to
+  /// complete, resets the recording and makes the slot available to acquire() again
+  void releaseReusable(const CommandBufferWrapper& wrapper);
+
   /// @brief Stores the semaphore as the current wait semaphore (`waitSemaphore_`)
   void waitSemaphore(VkSemaphore semaphore);
 
@@ -137,14 +166,17 @@ class VulkanImmediateCommands final {
   /** @brief Checks whether a SubmitHandle is ready. A SubmitHandle is ready if it is recycled or
    * empty. If it has not been recycled and is not empty, a SubmitHandle is ready if the fence
    * associated with the command buffer referred by the SubmitHandle structure has been signaled.
+   * In timeline semaphore mode, the timeline counter is compared against the value signaled by
+   * the command buffer instead of checking a fence.
    *  Note that this function does not wait for a fence to be signaled if it has not been signaled.
    * It merely checks the fence status
    */
   [[nodiscard]] bool isReady(SubmitHandle handle) const;
 
   /// @brief If the SubmitHandle is not ready, this function waits for the fence associated with the
-  /// command buffer referred by the handle to become signaled. The maximum wait time is
-  /// `UINT64_MAX` nanoseconds
+  /// command buffer referred by the handle to become signaled (or, in timeline semaphore mode, for
+  /// the timeline counter to reach the value signaled by the command buffer). The maximum wait time
+  /// is `UINT64_MAX` nanoseconds
   void wait(SubmitHandle handle, uint64_t timeoutNanoseconds = UINT64_MAX);
 
   /// @brief Wait for _all_ fences for all command buffers stored in `VulkanImmediateCommands` to
@@ -152,15 +184,31 @@ class VulkanImmediateCommands final {
   void waitAll();
 
   /// @brief Returns the fence associated with the handle if the handle has not been recycled.
-  /// Returns `VK_NULL_HANDLE` otherwise.
+  /// Returns `VK_NULL_HANDLE` otherwise. Must not be called in timeline semaphore mode, where no
+  /// fences are submitted.
   VkFence getVkFenceFromSubmitHandle(SubmitHandle handle);
 
+  /// @brief Installs a callback invoked when vkQueueSubmit() fails, with the failing VkResult.
+  /// Used by VulkanContext to report GPU breadcrumbs on VK_ERROR_DEVICE_LOST
+  void setSubmitErrorCallback(std::function<void(VkResult)> callback) {
+    submitErrorCallback_ = std::move(callback);
+  }
+
  private:
   /// @brief Resets all commands buffers and their associated fences that are valid, are not being
   /// encoded, and have completed execution by the GPU (their fences have been signaled). Resets the
   /// number of available command buffers.
   void purge();
 
+  /// @brief Returns the current value of the timeline semaphore counter. Only valid in timeline
+  /// semaphore mode
+  [[nodiscard]] uint64_t getTimelineCounterValue() const;
+
+  /// @brief Queues `wrapper` for execution: chains the wait/signal semaphores, submits with the
+  /// wrapper's fence (or the timeline semaphore) and advances the submit counter. Shared by
+  /// submit() and resubmit(); the command buffer must already be in the executable state
+  SubmitHandle submitInternal(const CommandBufferWrapper& wrapper);
+
  private:
   const VulkanFunctionTable& vf_;
   VkDevice device_ = VK_NULL_HANDLE;
@@ -175,6 +223,9 @@ class VulkanImmediateCommands final {
   /// @brief The semaphore submitted with the last command buffer. Updated on `submit()`
   VkSemaphore lastSubmitSemaphore_ = VK_NULL_HANDLE;
 
+  /// @brief Invoked when vkQueueSubmit() fails; see setSubmitErrorCallback()
+  std::function<void(VkResult)> submitErrorCallback_;
+
   /// @brief A semaphore to be associated with the next command buffer to be submitted. Can be used
   /// with command buffers that present swapchain images.
   VkSemaphore waitSemaphore_ = VK_NULL_HANDLE;
@@ -182,6 +233,15 @@ class VulkanImmediateCommands final {
 
   // @brief The submission counter. Incremented on `submit()`
   uint32_t submitCounter_ = 1;
+
+  /// @brief Timeline semaphore signaled by every submission with a monotonically increasing value.
+  /// Only created in timeline semaphore mode; when present, it replaces the per-command-buffer
+  /// fences for completion tracking
+  std::unique_ptr<VulkanSemaphore> timelineSemaphore_;
+
+  /// @brief The timeline value signaled by the most recent submission. Incremented on `submit()` in
+  /// timeline semaphore mode
+  uint64_t lastSignaledValue_ = 0;
 };
 
 } // namespace vulkan
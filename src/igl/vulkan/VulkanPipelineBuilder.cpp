@@ -86,6 +86,11 @@ VulkanPipelineBuilder& VulkanPipelineBuilder::colorBlendAttachmentStates(
   return *this;
 }
 
+VulkanPipelineBuilder& VulkanPipelineBuilder::subpassIndex(uint32_t index) {
+  subpassIndex_ = index;
+  return *this;
+}
+
 VulkanPipelineBuilder& VulkanPipelineBuilder::shaderStage(VkPipelineShaderStageCreateInfo stage) {
   shaderStages_.push_back(stage);
   return *this;
@@ -124,6 +129,19 @@ VulkanPipelineBuilder& VulkanPipelineBuilder::stencilStateOps(VkStencilFaceFlags
   return *this;
 }
 
+VulkanPipelineBuilder& VulkanPipelineBuilder::dynamicRenderingAttachmentFormats(
+    std::vector<VkFormat> colorFormats,
+    VkFormat depthFormat,
+    VkFormat stencilFormat,
+    uint32_t viewMask) {
+  dynamicRenderingEnabled_ = true;
+  colorAttachmentFormats_ = std::move(colorFormats);
+  depthAttachmentFormat_ = depthFormat;
+  stencilAttachmentFormat_ = stencilFormat;
+  viewMask_ = viewMask;
+  return *this;
+}
+
 VkResult VulkanPipelineBuilder::build(const VulkanFunctionTable& vf,
                                       VkDevice device,
                                       VkPipelineCache pipelineCache,
@@ -140,6 +158,16 @@ VkResult VulkanPipelineBuilder::build(const VulkanFunctionTable& vf,
       ivkGetPipelineColorBlendStateCreateInfo(uint32_t(colorBlendAttachmentStates_.size()),
                                               colorBlendAttachmentStates_.data());
 
+  const VkPipelineRenderingCreateInfoKHR renderingInfo = {
+      VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO_KHR,
+      nullptr,
+      viewMask_,
+      (uint32_t)colorAttachmentFormats_.size(),
+      colorAttachmentFormats_.data(),
+      depthAttachmentFormat_,
+      stencilAttachmentFormat_,
+  };
+
   const auto result = ivkCreateGraphicsPipeline(&vf,
                                                 device,
                                                 pipelineCache,
@@ -155,7 +183,10 @@ VkResult VulkanPipelineBuilder::build(const VulkanFunctionTable& vf,
                                                 &colorBlendState,
                                                 &dynamicState,
                                                 pipelineLayout,
-                                                renderPass,
+                                                dynamicRenderingEnabled_ ? VK_NULL_HANDLE
+                                                                         : renderPass,
+                                                dynamicRenderingEnabled_ ? 0 : subpassIndex_,
+                                                dynamicRenderingEnabled_ ? &renderingInfo : nullptr,
                                                 outPipeline);
 
   if (!IGL_VERIFY(result == VK_SUCCESS)) {
@@ -40,6 +40,17 @@ class VulkanPipelineBuilder final {
   VulkanPipelineBuilder& vertexInputState(const VkPipelineVertexInputStateCreateInfo& state);
   VulkanPipelineBuilder& colorBlendAttachmentStates(
       std::vector<VkPipelineColorBlendAttachmentState>& states);
+  /// @brief Index of the subpass this pipeline is used in (0 by default). Ignored with dynamic
+  /// rendering
+  VulkanPipelineBuilder& subpassIndex(uint32_t index);
+  /// @brief Builds the pipeline for VK_KHR_dynamic_rendering: a VkPipelineRenderingCreateInfoKHR
+  /// with the given attachment formats is chained into the pipeline create info and the render
+  /// pass handle passed to build() is ignored. `viewMask` must match the view mask passed to
+  /// vkCmdBeginRenderingKHR() (0 for non-multiview rendering)
+  VulkanPipelineBuilder& dynamicRenderingAttachmentFormats(std::vector<VkFormat> colorFormats,
+                                                           VkFormat depthFormat,
+                                                           VkFormat stencilFormat,
+                                                           uint32_t viewMask);
 
   [[nodiscard]] VkResult build(const VulkanFunctionTable& vf,
                                VkDevice device,
@@ -62,6 +73,12 @@ class VulkanPipelineBuilder final {
   VkPipelineMultisampleStateCreateInfo multisampleState_;
   VkPipelineDepthStencilStateCreateInfo depthStencilState_;
   std::vector<VkPipelineColorBlendAttachmentState> colorBlendAttachmentStates_;
+  uint32_t subpassIndex_ = 0;
+  bool dynamicRenderingEnabled_ = false;
+  std::vector<VkFormat> colorAttachmentFormats_;
+  VkFormat depthAttachmentFormat_ = VK_FORMAT_UNDEFINED;
+  VkFormat stencilAttachmentFormat_ = VK_FORMAT_UNDEFINED;
+  uint32_t viewMask_ = 0;
   static uint32_t numPipelinesCreated_;
 };
 
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "VulkanProgrammableResolve.h"
+
+#include <igl/Shader.h>
+#include <igl/vulkan/ShaderModule.h>
+#include <igl/vulkan/VulkanContext.h>
+#include <igl/vulkan/VulkanDescriptorSetLayout.h>
+#include <igl/vulkan/VulkanPipelineBuilder.h>
+#include <igl/vulkan/VulkanPipelineLayout.h>
+#include <vector>
+
+namespace {
+
+// one descriptor set per multisampled color image view; views are cached per texture, so in
+// practice this is bounded by the number of distinct MSAA render targets
+constexpr uint32_t kMaxDescriptorSets = 64;
+
+} // namespace
+
+namespace igl {
+namespace vulkan {
+
+VulkanProgrammableResolve::VulkanProgrammableResolve(const VulkanContext& ctx) : ctx_(ctx) {
+  const VkDevice device = ctx_.getVkDevice();
+
+  const VkDescriptorSetLayoutBinding binding = {
+      0, VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT, 1, VK_SHADER_STAGE_FRAGMENT_BIT, nullptr};
+  const VkDescriptorBindingFlags bindingFlags = 0;
+  dsl_ = std::make_unique<VulkanDescriptorSetLayout>(
+      ctx_.vf_, device, 0, 1, &binding, &bindingFlags, "Descriptor Set Layout: programmable resolve");
+
+  const VkDescriptorSetLayout dsl = dsl_->getVkDescriptorSetLayout();
+  pipelineLayout_ = std::make_unique<VulkanPipelineLayout>(
+      ctx_, device, &dsl, 1, nullptr, "Pipeline Layout: programmable resolve");
+
+  const VkDescriptorPoolSize poolSize = {VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT, kMaxDescriptorSets};
+  VK_ASSERT(ivkCreateDescriptorPool(&ctx_.vf_, device, 0, kMaxDescriptorSets, 1, &poolSize, &dp_));
+}
+
+VulkanProgrammableResolve::~VulkanProgrammableResolve() {
+  std::vector<VkPipeline> pipelines;
+  pipelines.reserve(pipelines_.size());
+  for (const auto& p : pipelines_) {
+    pipelines.push_back(p.second);
+  }
+  ctx_.deferredTask(std::packaged_task<void()>(
+      [vf = &ctx_.vf_, device = ctx_.getVkDevice(), dp = dp_, pipelines = std::move(pipelines)]() {
+        for (VkPipeline p : pipelines) {
+          vf->vkDestroyPipeline(device, p, nullptr);
+        }
+        vf->vkDestroyDescriptorPool(device, dp, nullptr);
+      }));
+}
+
+VkPipelineLayout VulkanProgrammableResolve::getVkPipelineLayout() const {
+  return pipelineLayout_->getVkPipelineLayout();
+}
+
+VkPipeline VulkanProgrammableResolve::acquirePipeline(
+    VkRenderPass renderPass,
+    const std::shared_ptr<IShaderStages>& stages) {
+  IGL_PROFILER_FUNCTION();
+
+  if (!IGL_VERIFY(stages && stages->getVertexModule() && stages->getFragmentModule())) {
+    return VK_NULL_HANDLE;
+  }
+
+  const auto& vertexModule = stages->getVertexModule();
+  const auto& fragmentModule = stages->getFragmentModule();
+
+  const PipelineKey key = {renderPass,
+                           ShaderModule::getVkShaderModule(vertexModule),
+                           ShaderModule::getVkShaderModule(fragmentModule)};
+
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  const auto it = pipelines_.find(key);
+  if (it != pipelines_.end()) {
+    return it->second;
+  }
+
+  VkPipelineShaderStageCreateInfo vertexStage = ivkGetPipelineShaderStageCreateInfo(
+      VK_SHADER_STAGE_VERTEX_BIT, key.vertexModule, vertexModule->info().entryPoint.c_str());
+  vertexStage.pSpecializationInfo = ShaderModule::getSpecializationInfo(vertexModule);
+
+  VkPipelineShaderStageCreateInfo fragmentStage = ivkGetPipelineShaderStageCreateInfo(
+      VK_SHADER_STAGE_FRAGMENT_BIT, key.fragmentModule, fragmentModule->info().entryPoint.c_str());
+  fragmentStage.pSpecializationInfo = ShaderModule::getSpecializationInfo(fragmentModule);
+
+  // fullscreen triangle into the single-sampled resolve attachment of subpass 1: no vertex
+  // buffers, no depth/stencil tests, no blending
+  std::vector<VkPipelineColorBlendAttachmentState> colorBlendAttachmentStates = {
+      ivkGetPipelineColorBlendAttachmentState_NoBlending()};
+
+  VkPipeline pipeline = VK_NULL_HANDLE;
+  const VkResult result = VulkanPipelineBuilder()
+                              .dynamicStates({
+                                  VK_DYNAMIC_STATE_VIEWPORT,
+                                  VK_DYNAMIC_STATE_SCISSOR,
+                              })
+                              .shaderStages({vertexStage, fragmentStage})
+                              .colorBlendAttachmentStates(colorBlendAttachmentStates)
+                              .subpassIndex(1)
+                              .build(ctx_.vf_,
+                                     ctx_.getVkDevice(),
+                                     ctx_.pipelineCache_,
+                                     pipelineLayout_->getVkPipelineLayout(),
+                                     renderPass,
+                                     &pipeline,
+                                     "Pipeline: programmable resolve");
+  if (!IGL_VERIFY(result == VK_SUCCESS)) {
+    return VK_NULL_HANDLE;
+  }
+
+  pipelines_[key] = pipeline;
+
+  return pipeline;
+}
+
+VkDescriptorSet VulkanProgrammableResolve::acquireDescriptorSet(VkImageView msaaColorView) {
+  IGL_PROFILER_FUNCTION();
+
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  const auto it = descriptorSets_.find(msaaColorView);
+  if (it != descriptorSets_.end()) {
+    return it->second;
+  }
+
+  if (!IGL_VERIFY(descriptorSets_.size() < kMaxDescriptorSets)) {
+    IGL_LOG_ERROR("Too many distinct MSAA color attachments use a programmable resolve\n");
+    return VK_NULL_HANDLE;
+  }
+
+  VkDescriptorSet descriptorSet = VK_NULL_HANDLE;
+  VK_ASSERT(ivkAllocateDescriptorSet(
+      &ctx_.vf_, ctx_.getVkDevice(), dp_, dsl_->getVkDescriptorSetLayout(), &descriptorSet));
+  if (descriptorSet == VK_NULL_HANDLE) {
+    return VK_NULL_HANDLE;
+  }
+
+  const VkDescriptorImageInfo imageInfo = {
+      VK_NULL_HANDLE, msaaColorView, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL};
+  const VkWriteDescriptorSet write = {
+      VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+      nullptr,
+      descriptorSet,
+      0,
+      0,
+      1,
+      VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT,
+      &imageInfo,
+      nullptr,
+      nullptr,
+  };
+  ctx_.vf_.vkUpdateDescriptorSets(ctx_.getVkDevice(), 1, &write, 0, nullptr);
+
+  descriptorSets_[msaaColorView] = descriptorSet;
+
+  return descriptorSet;
+}
+
+} // namespace vulkan
+} // namespace igl
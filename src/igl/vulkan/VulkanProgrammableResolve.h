@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <igl/vulkan/Common.h>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace igl {
+
+class IShaderStages;
+
+namespace vulkan {
+
+class VulkanContext;
+class VulkanDescriptorSetLayout;
+class VulkanPipelineLayout;
+
+/// @brief Owns the Vulkan objects behind RenderPassDesc::colorResolveShaderStages: the descriptor
+/// set layout with a single subpass input binding (set 0, binding 0, fragment stage), the matching
+/// pipeline layout, a descriptor pool with one cached descriptor set per multisampled color image
+/// view, and one cached graphics pipeline per (render pass, resolve shaders) pair. Created lazily
+/// by VulkanContext on the first pass that uses a programmable resolve and kept for the context's
+/// lifetime; RenderCommandEncoder::endEncoding() acquires a pipeline and a descriptor set from
+/// here to record the resolve subpass
+class VulkanProgrammableResolve final {
+ public:
+  explicit VulkanProgrammableResolve(const VulkanContext& ctx);
+  ~VulkanProgrammableResolve();
+
+  VulkanProgrammableResolve(const VulkanProgrammableResolve&) = delete;
+  VulkanProgrammableResolve& operator=(const VulkanProgrammableResolve&) = delete;
+
+  VkPipelineLayout getVkPipelineLayout() const;
+
+  /// @brief Returns the resolve pipeline for `stages` in subpass 1 of `renderPass`, creating and
+  /// caching it on first use. Returns VK_NULL_HANDLE when pipeline creation fails
+  VkPipeline acquirePipeline(VkRenderPass renderPass,
+                             const std::shared_ptr<IShaderStages>& stages);
+
+  /// @brief Returns a descriptor set with `msaaColorView` bound as the subpass input, creating
+  /// and caching it on first use. Returns VK_NULL_HANDLE when the descriptor pool is exhausted
+  VkDescriptorSet acquireDescriptorSet(VkImageView msaaColorView);
+
+ private:
+  struct PipelineKey {
+    VkRenderPass renderPass = VK_NULL_HANDLE;
+    VkShaderModule vertexModule = VK_NULL_HANDLE;
+    VkShaderModule fragmentModule = VK_NULL_HANDLE;
+    bool operator==(const PipelineKey& other) const {
+      return renderPass == other.renderPass && vertexModule == other.vertexModule &&
+             fragmentModule == other.fragmentModule;
+    }
+    struct HashFunction {
+      uint64_t operator()(const PipelineKey& key) const {
+        return std::hash<void*>()((void*)key.renderPass) ^
+               std::hash<void*>()((void*)key.vertexModule) ^
+               std::hash<void*>()((void*)key.fragmentModule);
+      }
+    };
+  };
+
+  const VulkanContext& ctx_;
+  std::unique_ptr<VulkanDescriptorSetLayout> dsl_;
+  std::unique_ptr<VulkanPipelineLayout> pipelineLayout_;
+  VkDescriptorPool dp_ = VK_NULL_HANDLE;
+  // endEncoding() can run on multiple threads; guards both caches below
+  std::mutex mutex_;
+  std::unordered_map<VkImageView, VkDescriptorSet> descriptorSets_;
+  std::unordered_map<PipelineKey, VkPipeline, PipelineKey::HashFunction> pipelines_;
+};
+
+} // namespace vulkan
+} // namespace igl
@@ -32,24 +32,82 @@ VkResult VulkanRenderPassBuilder::build(const VulkanFunctionTable& vf,
       "color attachment");
 
   const bool hasDepthStencilAttachment = refDepth_.layout != VK_IMAGE_LAYOUT_UNDEFINED;
-  const VkSubpassDescription subpass =
-      ivkGetSubpassDescription((uint32_t)refsColor_.size(),
-                               refsColor_.data(),
-                               refsColorResolve_.data(),
-                               hasDepthStencilAttachment ? &refDepth_ : nullptr);
-  const VkSubpassDependency dep = ivkGetSubpassDependency();
   const bool hasViewMask = viewMask_ != 0;
-
   const VkRenderPassMultiviewCreateInfo ci =
       ivkGetRenderPassMultiviewCreateInfo(&viewMask_, &correlationMask_);
-  const VkResult result = ivkCreateRenderPass(&vf,
-                                              device,
-                                              (uint32_t)attachments_.size(),
-                                              attachments_.data(),
-                                              &subpass,
-                                              &dep,
-                                              hasViewMask ? &ci : nullptr,
-                                              outRenderPass);
+
+  VkResult result = VK_SUCCESS;
+
+  if (programmableResolve_) {
+    IGL_ASSERT_MSG(refsColor_.size() == 1 && refsColorResolve_.size() == 1,
+                   "Programmable resolve requires exactly one color attachment with a resolve "
+                   "attachment");
+    IGL_ASSERT_MSG(!hasViewMask, "Programmable resolve does not support multiview");
+    // subpass 0 renders the multisampled color (no fixed-function resolve); subpass 1 reads it
+    // as a subpass input and writes the single-sampled resolve attachment
+    const VkAttachmentReference refInput = {refsColor_[0].attachment,
+                                            VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL};
+    VkSubpassDescription resolveSubpass{};
+    resolveSubpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+    resolveSubpass.inputAttachmentCount = 1;
+    resolveSubpass.pInputAttachments = &refInput;
+    resolveSubpass.colorAttachmentCount = 1;
+    resolveSubpass.pColorAttachments = refsColorResolve_.data();
+    const VkSubpassDescription subpasses[2] = {
+        ivkGetSubpassDescription((uint32_t)refsColor_.size(),
+                                 refsColor_.data(),
+                                 nullptr,
+                                 hasDepthStencilAttachment ? &refDepth_ : nullptr),
+        resolveSubpass,
+    };
+    const VkSubpassDependency deps[2] = {
+        // subpass 0 color writes are visible to subpass 1 input attachment reads, per region so
+        // tilers can resolve each tile as soon as it is rendered
+        {0,
+         1,
+         VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+         VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+         VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT,
+         VK_ACCESS_INPUT_ATTACHMENT_READ_BIT,
+         VK_DEPENDENCY_BY_REGION_BIT},
+        // same external dependency as ivkGetSubpassDependency(), but sourced from subpass 1
+        {1,
+         VK_SUBPASS_EXTERNAL,
+         VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+         VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+         VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT,
+         VK_ACCESS_SHADER_READ_BIT,
+         0},
+    };
+    // ivkCreateRenderPass() builds single-subpass passes only, so fill the create info here
+    const VkRenderPassCreateInfo rpci = {
+        VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO,
+        nullptr,
+        0,
+        (uint32_t)attachments_.size(),
+        attachments_.data(),
+        2u,
+        subpasses,
+        2u,
+        deps,
+    };
+    result = vf.vkCreateRenderPass(device, &rpci, nullptr, outRenderPass);
+  } else {
+    const VkSubpassDescription subpass =
+        ivkGetSubpassDescription((uint32_t)refsColor_.size(),
+                                 refsColor_.data(),
+                                 refsColorResolve_.data(),
+                                 hasDepthStencilAttachment ? &refDepth_ : nullptr);
+    const VkSubpassDependency dep = ivkGetSubpassDependency();
+    result = ivkCreateRenderPass(&vf,
+                                 device,
+                                 (uint32_t)attachments_.size(),
+                                 attachments_.data(),
+                                 &subpass,
+                                 &dep,
+                                 hasViewMask ? &ci : nullptr,
+                                 outRenderPass);
+  }
   if (!IGL_VERIFY(result == VK_SUCCESS)) {
     return result;
   }
@@ -147,11 +205,17 @@ VulkanRenderPassBuilder& VulkanRenderPassBuilder::setMultiviewMasks(
   return *this;
 }
 
+VulkanRenderPassBuilder& VulkanRenderPassBuilder::enableProgrammableResolve() {
+  programmableResolve_ = true;
+  return *this;
+}
+
 bool VulkanRenderPassBuilder::operator==(const VulkanRenderPassBuilder& other) const {
   return attachments_ == other.attachments_ && refsColor_ == other.refsColor_ &&
          refsColorResolve_ == other.refsColorResolve_ && refDepth_ == other.refDepth_ &&
          refDepthResolve_ == other.refDepthResolve_ && viewMask_ == other.viewMask_ &&
-         correlationMask_ == other.correlationMask_;
+         correlationMask_ == other.correlationMask_ &&
+         programmableResolve_ == other.programmableResolve_;
 }
 
 uint64_t VulkanRenderPassBuilder::HashFunction::operator()(
@@ -182,6 +246,7 @@ uint64_t VulkanRenderPassBuilder::HashFunction::operator()(
   hash ^= std::hash<uint32_t>()(builder.refDepthResolve_.layout);
   hash ^= std::hash<uint32_t>()(builder.viewMask_);
   hash ^= std::hash<uint32_t>()(builder.correlationMask_);
+  hash ^= std::hash<bool>()(builder.programmableResolve_);
   return hash;
 }
 
@@ -57,6 +57,12 @@ class VulkanRenderPassBuilder final {
       VkImageLayout finalLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL);
   VulkanRenderPassBuilder& setMultiviewMasks(const uint32_t viewMask,
                                              const uint32_t correlationMask);
+  /// @brief Replaces the fixed-function MSAA resolve with a second subpass: subpass 0 renders
+  /// into the multisampled color attachment without resolve attachments, and subpass 1 reads it
+  /// as a subpass input and writes the resolve attachment, so a custom resolve shader can run
+  /// without the samples ever leaving tile memory. Requires exactly one color attachment with a
+  /// matching color resolve attachment. See RenderPassDesc::colorResolveShaderStages
+  VulkanRenderPassBuilder& enableProgrammableResolve();
 
   // comparison operator and a hash function for std::unordered_map<>
   bool operator==(const VulkanRenderPassBuilder& other) const;
@@ -82,6 +88,7 @@ class VulkanRenderPassBuilder final {
   VkAttachmentReference refDepthResolve_ = {};
   uint32_t viewMask_ = 0;
   uint32_t correlationMask_ = 0;
+  bool programmableResolve_ = false;
 };
 
 } // namespace vulkan
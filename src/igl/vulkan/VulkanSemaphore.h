@@ -27,6 +27,13 @@ class VulkanSemaphore final {
                            VkDevice device,
                            bool exportable = false,
                            const char* debugName = nullptr);
+
+  /// @brief Creates a VK_SEMAPHORE_TYPE_TIMELINE semaphore with the provided initial value. The
+  /// device must have been created with the timeline semaphore feature enabled
+  explicit VulkanSemaphore(const VulkanFunctionTable& vf,
+                           VkDevice device,
+                           uint64_t initialValue,
+                           const char* debugName = nullptr);
   ~VulkanSemaphore();
 
   VulkanSemaphore(VulkanSemaphore&& other) noexcept;
@@ -7,9 +7,12 @@
 
 #include <igl/vulkan/VulkanShaderModule.h>
 
+#if !IGL_VULKAN_NO_GLSLANG
 #include <glslang/Include/glslang_c_interface.h>
+#endif // !IGL_VULKAN_NO_GLSLANG
 #include <igl/vulkan/Common.h>
 
+#if !IGL_VULKAN_NO_GLSLANG
 namespace {
 
 // Logs GLSL shaders with line numbers annotation
@@ -52,10 +55,12 @@ void logShaderSource(const char* text) {
 }
 
 } // namespace
+#endif // !IGL_VULKAN_NO_GLSLANG
 
 namespace igl {
 namespace vulkan {
 
+#if !IGL_VULKAN_NO_GLSLANG
 Result compileShader(const VulkanFunctionTable& vf,
                      VkDevice device,
                      VkShaderStageFlagBits stage,
@@ -127,6 +132,7 @@ Result compileShader(const VulkanFunctionTable& vf,
 
   return Result();
 }
+#endif // !IGL_VULKAN_NO_GLSLANG
 
 VulkanShaderModule::VulkanShaderModule(const VulkanFunctionTable& vf,
                                        VkDevice device,
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <igl/vulkan/VulkanShaderPack.h>
+
+#include <cstring>
+#include <fstream>
+
+#if !IGL_PLATFORM_WIN
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // !IGL_PLATFORM_WIN
+
+namespace igl {
+namespace vulkan {
+
+namespace {
+
+constexpr char kPackMagic[8] = {'I', 'G', 'L', 'S', 'P', 'K', '0', '1'};
+constexpr size_t kPackHeaderSize = sizeof(kPackMagic) + sizeof(uint64_t);
+
+} // namespace
+
+VulkanShaderPack::~VulkanShaderPack() {
+  close();
+}
+
+bool VulkanShaderPack::open(const char* path) {
+  close();
+
+#if !IGL_PLATFORM_WIN
+  const int fd = ::open(path, O_RDONLY); // NOLINT(cppcoreguidelines-pro-type-vararg)
+  if (fd < 0) {
+    return false;
+  }
+  struct stat st = {};
+  if (fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(kPackHeaderSize)) {
+    ::close(fd);
+    return false;
+  }
+  void* mapping = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd); // the mapping keeps its own reference
+  if (mapping == MAP_FAILED) {
+    return false;
+  }
+  data_ = static_cast<const uint8_t*>(mapping);
+  size_ = static_cast<size_t>(st.st_size);
+  mapped_ = true;
+#else
+  std::ifstream file(path, std::ios::in | std::ios::binary | std::ios::ate);
+  if (!file) {
+    return false;
+  }
+  const std::streamsize fileSize = file.tellg();
+  if (fileSize < static_cast<std::streamsize>(kPackHeaderSize)) {
+    return false;
+  }
+  heapData_.resize(static_cast<size_t>(fileSize));
+  file.seekg(0, std::ios::beg);
+  if (!file.read(reinterpret_cast<char*>(heapData_.data()), fileSize)) {
+    heapData_.clear();
+    return false;
+  }
+  data_ = heapData_.data();
+  size_ = heapData_.size();
+  mapped_ = false;
+#endif // !IGL_PLATFORM_WIN
+
+  // validate the directory before trusting any offset in it
+  if (memcmp(data_, kPackMagic, sizeof(kPackMagic)) != 0) {
+    close();
+    return false;
+  }
+  memcpy(&count_, data_ + sizeof(kPackMagic), sizeof(count_));
+  const size_t directoryEnd = kPackHeaderSize + count_ * sizeof(VulkanShaderPackEntry);
+  if (count_ == 0 || directoryEnd > size_) {
+    close();
+    return false;
+  }
+  entries_ = reinterpret_cast<const VulkanShaderPackEntry*>(data_ + kPackHeaderSize);
+  for (uint64_t i = 0; i != count_; i++) {
+    const VulkanShaderPackEntry& entry = entries_[i];
+    const bool sorted = i == 0 || entries_[i - 1].hash < entry.hash;
+    if (!sorted || (entry.offset % sizeof(uint32_t)) != 0 ||
+        (entry.sizeInBytes % sizeof(uint32_t)) != 0 || entry.sizeInBytes == 0 ||
+        entry.offset + entry.sizeInBytes > size_) {
+      close();
+      return false;
+    }
+  }
+  return true;
+}
+
+void VulkanShaderPack::close() {
+#if !IGL_PLATFORM_WIN
+  if (mapped_ && data_ != nullptr) {
+    munmap(const_cast<uint8_t*>(data_), size_);
+  }
+#endif // !IGL_PLATFORM_WIN
+  heapData_.clear();
+  data_ = nullptr;
+  size_ = 0;
+  entries_ = nullptr;
+  count_ = 0;
+  mapped_ = false;
+}
+
+const uint32_t* VulkanShaderPack::find(uint64_t hash, size_t* outSizeInBytes) const {
+  if (entries_ == nullptr) {
+    return nullptr;
+  }
+  // binary search over the hash-sorted directory
+  uint64_t lo = 0;
+  uint64_t hi = count_;
+  while (lo < hi) {
+    const uint64_t mid = lo + (hi - lo) / 2;
+    if (entries_[mid].hash < hash) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  if (lo == count_ || entries_[lo].hash != hash) {
+    return nullptr;
+  }
+  if (outSizeInBytes != nullptr) {
+    *outSizeInBytes = static_cast<size_t>(entries_[lo].sizeInBytes);
+  }
+  return reinterpret_cast<const uint32_t*>(data_ + entries_[lo].offset);
+}
+
+uint64_t VulkanShaderPack::hashShaderSource(const char* source, VkShaderStageFlagBits stage) {
+  uint64_t hash = 0xcbf29ce484222325ull;
+  for (const char* p = source; *p; p++) {
+    hash ^= static_cast<uint8_t>(*p);
+    hash *= 0x100000001b3ull;
+  }
+  hash ^= static_cast<uint64_t>(stage);
+  hash *= 0x100000001b3ull;
+  return hash;
+}
+
+} // namespace vulkan
+} // namespace igl
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <igl/vulkan/Common.h>
+
+namespace igl {
+namespace vulkan {
+
+/// One directory entry of a shader pack. The payload offset is relative to the start of the file
+/// and is 4-byte aligned so the SPIR-V words can be consumed in place.
+struct VulkanShaderPackEntry {
+  uint64_t hash = 0;
+  uint64_t offset = 0;
+  uint64_t sizeInBytes = 0;
+};
+
+/// Read-only view of a pack of precompiled SPIR-V binaries produced offline by the
+/// igl_shader_pack tool. The pack replaces runtime GLSL compilation: Device::createShaderModule()
+/// looks up the source hash here before consulting the in-memory memo, the on-disk cache, and
+/// finally glslang (when it is compiled in at all; see IGL_VULKAN_NO_GLSLANG).
+///
+/// The file is mapped read-only where the platform allows it, so lookups copy nothing and cold
+/// entries never touch physical memory. Layout (little-endian, host byte order):
+///   char                  magic[8]  = "IGLSPK01"
+///   uint64_t              count
+///   VulkanShaderPackEntry entries[count]   sorted by hash
+///   uint32_t              payloads[]       SPIR-V words, 4-byte aligned
+class VulkanShaderPack final {
+ public:
+  VulkanShaderPack() = default;
+  ~VulkanShaderPack();
+
+  VulkanShaderPack(const VulkanShaderPack&) = delete;
+  VulkanShaderPack& operator=(const VulkanShaderPack&) = delete;
+
+  /// Maps (or, on platforms without mmap, reads) the pack and validates its directory. Returns
+  /// false when the file is missing or malformed; the pack stays closed and find() misses.
+  bool open(const char* path);
+  void close();
+
+  [[nodiscard]] bool isOpen() const {
+    return data_ != nullptr;
+  }
+  [[nodiscard]] size_t getShaderCount() const {
+    return static_cast<size_t>(count_);
+  }
+
+  /// Returns a pointer to the SPIR-V words for `hash`, or nullptr when the pack does not contain
+  /// it. The pointer aliases the mapped file and stays valid until close().
+  [[nodiscard]] const uint32_t* find(uint64_t hash, size_t* outSizeInBytes) const;
+
+  /// FNV-1a hash of a shader source and its target stage. This is the key the runtime looks up,
+  /// exposed here so the offline packer writes matching keys. Sources are hashed exactly as the
+  /// device consumes them: sources that carry their own `#version` header are used verbatim,
+  /// which is the deployment mode packs are meant for.
+  [[nodiscard]] static uint64_t hashShaderSource(const char* source, VkShaderStageFlagBits stage);
+
+ private:
+  const uint8_t* data_ = nullptr;
+  size_t size_ = 0;
+  const VulkanShaderPackEntry* entries_ = nullptr;
+  uint64_t count_ = 0;
+  bool mapped_ = false; // mmap'ed vs read into heapData_
+  std::vector<uint8_t> heapData_;
+};
+
+} // namespace vulkan
+} // namespace igl
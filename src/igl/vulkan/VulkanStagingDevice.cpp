@@ -36,8 +36,22 @@ VulkanStagingDevice::VulkanStagingDevice(VulkanContext& ctx) : ctx_(ctx) {
       ctx_.device_->getVkDevice(),
       ctx_.deviceQueues_.graphicsQueueFamilyIndex,
       ctx_.config_.exportableFences,
+      ctx_.useTimelineSemaphores_,
       "VulkanStagingDevice::immediate_");
   IGL_ASSERT(immediate_.get());
+
+  // When a dedicated transfer queue family was reserved, uploads get their own command context so
+  // that texture and buffer streaming overlaps rendering on the graphics queue
+  if (ctx_.config_.useDedicatedTransferQueue &&
+      ctx_.deviceQueues_.transferQueueFamilyIndex != DeviceQueues::INVALID) {
+    transferImmediate_ = std::make_unique<igl::vulkan::VulkanImmediateCommands>(
+        ctx_.vf_,
+        ctx_.device_->getVkDevice(),
+        ctx_.deviceQueues_.transferQueueFamilyIndex,
+        ctx_.config_.exportableFences,
+        ctx_.useTimelineSemaphores_,
+        "VulkanStagingDevice::transferImmediate_");
+  }
 }
 
 void VulkanStagingDevice::bufferSubData(VulkanBuffer& buffer,
@@ -45,13 +59,18 @@ void VulkanStagingDevice::bufferSubData(VulkanBuffer& buffer,
                                         size_t size,
                                         const void* data) {
   IGL_PROFILER_FUNCTION();
+
+  const std::lock_guard<std::mutex> lock(mutex_);
   if (buffer.isMapped()) {
     buffer.bufferSubData(dstOffset, size, data);
     return;
   }
 
+  IGL_PROFILER_COUNTER("IGL staging buffer bytes", static_cast<int64_t>(size));
+
   uint32_t chunkDstOffset = dstOffset;
   void* copyData = const_cast<void*>(data);
+  const size_t fullSize = size;
 
 #if IGL_VULKAN_DEBUG_STAGING_DEVICE
   IGL_LOG_INFO("Upload requested for data with %u bytes\n", size);
@@ -72,16 +91,51 @@ void VulkanStagingDevice::bufferSubData(VulkanBuffer& buffer,
     // do the transfer
     const VkBufferCopy copy = {memoryChunk.offset, chunkDstOffset, copySize};
 
-    auto& wrapper = immediate_->acquire();
+    auto& wrapper = uploadCommands().acquire();
     ctx_.vf_.vkCmdCopyBuffer(
         wrapper.cmdBuf_, stagingBuffer_->getVkBuffer(), buffer.getVkBuffer(), 1, &copy);
-    memoryChunk.handle = immediate_->submit(wrapper); // store the submit handle with the allocation
+    if (transferImmediate_ && size == copySize) {
+      // last chunk: release ownership of the whole destination range to the graphics queue. The
+      // chunks are chained with semaphores on the transfer queue, so one release is enough
+      ivkBufferMemoryBarrierQueueTransfer(&ctx_.vf_,
+                                          wrapper.cmdBuf_,
+                                          buffer.getVkBuffer(),
+                                          VK_ACCESS_TRANSFER_WRITE_BIT,
+                                          0,
+                                          dstOffset,
+                                          fullSize,
+                                          VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                          VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                                          ctx_.deviceQueues_.transferQueueFamilyIndex,
+                                          ctx_.deviceQueues_.graphicsQueueFamilyIndex);
+    }
+    // store the submit handle with the allocation
+    memoryChunk.handle = uploadCommands().submit(wrapper);
+    lastUploadHandle_ = memoryChunk.handle;
     regions_.push_back(memoryChunk);
 
     size -= copySize;
     copyData = (uint8_t*)copyData + copySize;
     chunkDstOffset += copySize;
   }
+
+  if (transferImmediate_) {
+    // acquire ownership on the graphics queue once the transfer queue is done
+    auto& wrapper = ctx_.immediate_->acquire();
+    ivkBufferMemoryBarrierQueueTransfer(&ctx_.vf_,
+                                        wrapper.cmdBuf_,
+                                        buffer.getVkBuffer(),
+                                        0,
+                                        VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT,
+                                        dstOffset,
+                                        fullSize,
+                                        VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                                        VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                                        ctx_.deviceQueues_.transferQueueFamilyIndex,
+                                        ctx_.deviceQueues_.graphicsQueueFamilyIndex);
+    ctx_.immediate_->waitSemaphore(transferImmediate_->acquireLastSubmitSemaphore());
+    ctx_.immediate_->submit(wrapper);
+  }
 }
 
 VulkanStagingDevice::MemoryRegion VulkanStagingDevice::nextFreeBlock(VkDeviceSize size) {
@@ -93,94 +147,65 @@ VulkanStagingDevice::MemoryRegion VulkanStagingDevice::nextFreeBlock(VkDeviceSiz
     growStagingBuffer(nextSize(requestedAlignedSize));
   }
 
-  IGL_ASSERT(!regions_.empty());
-
 #if IGL_VULKAN_DEBUG_STAGING_DEVICE
   IGL_LOG_INFO("nextFreeBlock() with %u bytes, aligned %u bytes\n", size, requestedAlignedSize);
 #endif
 
-  // If we can't find an empty free region that is as big as the requestedAlignedSize, return
-  // whatever we could find, which will be stored in bestNextIt
-  auto bestNextIt = regions_.begin();
-
-  for (auto it = regions_.begin(); it != regions_.end(); ++it) {
-    if (immediate_->isReady(it->handle)) {
-      // This region is free, but is it big enough?
-      if (it->size >= requestedAlignedSize) {
-        // It is big enough!
-        const uint32_t unusedSize = it->size - requestedAlignedSize;
-        const uint32_t unusedOffset = it->offset + requestedAlignedSize;
-
-        // Return this region and add the remaining unused size to the regions_ deque
-        IGL_SCOPE_EXIT {
-          regions_.erase(it);
-          if (unusedSize > 0) {
-            regions_.push_front(
-                {unusedOffset, unusedSize, unusedSize, VulkanImmediateCommands::SubmitHandle()});
-          }
-        };
-
-#if IGL_VULKAN_DEBUG_STAGING_DEVICE
-        IGL_LOG_INFO("Found block with %u bytes at offset %u\n", it->size, it->offset);
-#endif
+  for (;;) {
+    // Reclaim all in-flight regions whose associated command buffers have completed. The deque is
+    // ordered by submission, oldest regions first, so the free space is always contiguous (modulo
+    // the wrap-around): everything between the write head and the oldest in-flight region
+    while (!regions_.empty() && uploadCommands().isReady(regions_.front().handle)) {
+      regions_.pop_front();
+    }
 
-        return {it->offset, size, requestedAlignedSize, VulkanImmediateCommands::SubmitHandle()};
-      }
+    VkDeviceSize available = 0;
 
-      // Cache the largest available region that isn't as big as the one we're looking for
-      if (it->size > bestNextIt->size) {
-        bestNextIt = it;
+    if (regions_.empty()) {
+      // the entire buffer is free
+      head_ = 0;
+      available = stagingBufferSize_;
+    } else {
+      const VkDeviceSize tail = regions_.front().offset;
+      if (head_ > tail) {
+        available = stagingBufferSize_ - head_;
+        // wrap around when the space at the end of the buffer is too small and there is a larger
+        // contiguous block at the beginning; the skipped bytes at the end stay unused until the
+        // oldest regions are reclaimed
+        if (available < requestedAlignedSize && tail > available) {
+          head_ = 0;
+          available = tail;
+        }
+      } else if (head_ < tail) {
+        available = tail - head_;
       }
+      // head_ == tail with in-flight regions means the ring is full: available stays 0
     }
-  }
 
-  // We found a region that is available that is smaller than the requested size. It's the best we
-  // can do
-  if (bestNextIt != regions_.end() && immediate_->isReady(bestNextIt->handle)) {
-    IGL_SCOPE_EXIT {
-      regions_.erase(bestNextIt);
-    };
+    if (available > 0) {
+      const VkDeviceSize blockSize = std::min(requestedAlignedSize, available);
+      const VkDeviceSize offset = head_;
+      head_ += blockSize;
 
 #if IGL_VULKAN_DEBUG_STAGING_DEVICE
-    IGL_LOG_INFO("Found block smaller than size needed with %u bytes (%u aligned) at offset %u\n",
-                 bestNextIt->size,
-                 bestNextIt->alignedSize,
-                 bestNextIt->offset);
+      IGL_LOG_INFO("Found block with %u bytes at offset %u\n", blockSize, offset);
 #endif
 
-    return {bestNextIt->offset,
-            bestNextIt->size,
-            bestNextIt->alignedSize,
-            VulkanImmediateCommands::SubmitHandle()};
-  }
+      return {offset,
+              std::min(size, blockSize),
+              blockSize,
+              VulkanImmediateCommands::SubmitHandle()};
+    }
 
 #if IGL_VULKAN_DEBUG_STAGING_DEVICE
-  IGL_LOG_INFO(
-      "Could not find an available block. Waiting for the staging device to become fully "
-      "available\n");
+    IGL_LOG_INFO("Ring buffer is full. Waiting for the oldest in-flight region\n");
 #endif
 
-  // Nothing was available. Let's wait for the entire staging buffer to become free
-  waitAndReset();
-
-  // waitAndReset() adds a region that spans the entire buffer. Since we'll be using part of it, we
-  // need to replace it with a used block and an unused portion
-  regions_.clear();
-
-  // Store the unused size in the deque first...
-  const VkDeviceSize unusedSize =
-      stagingBufferSize_ > requestedAlignedSize ? stagingBufferSize_ - requestedAlignedSize : 0;
-  if (unusedSize > 0) {
-    const uint32_t unusedOffset = requestedAlignedSize;
-    regions_.push_front(
-        {unusedOffset, unusedSize, unusedSize, VulkanImmediateCommands::SubmitHandle()});
+    // The ring is full: the GPU is too far behind. Block only on the fence of the oldest
+    // in-flight region instead of draining the whole staging buffer
+    uploadCommands().wait(regions_.front().handle);
+    regions_.pop_front();
   }
-
-  //... and then return the smallest free region that can hold the requested size
-  return {0,
-          std::min(size, stagingBufferSize_),
-          std::min(requestedAlignedSize, stagingBufferSize_),
-          VulkanImmediateCommands::SubmitHandle()};
 }
 
 void VulkanStagingDevice::getBufferSubData(const VulkanBuffer& buffer,
@@ -188,6 +213,8 @@ void VulkanStagingDevice::getBufferSubData(const VulkanBuffer& buffer,
                                            size_t size,
                                            void* data) {
   IGL_PROFILER_FUNCTION();
+
+  const std::lock_guard<std::mutex> lock(mutex_);
   if (buffer.isMapped()) {
     buffer.getBufferSubData(srcOffset, size, data);
     return;
@@ -224,7 +251,8 @@ void VulkanStagingDevice::getBufferSubData(const VulkanBuffer& buffer,
     dstData = (uint8_t*)dstData + copySize;
     chunkSrcOffset += copySize;
 
-    regions_.push_front(memoryChunk);
+    // the copy was waited on above, so the region is immediately reclaimable
+    regions_.push_back(memoryChunk);
   }
 }
 
@@ -236,9 +264,13 @@ void VulkanStagingDevice::imageData(const VulkanImage& image,
                                     const void* data) {
   IGL_PROFILER_FUNCTION();
 
+  const std::lock_guard<std::mutex> lock(mutex_);
+
   const uint32_t storageSize =
       static_cast<uint32_t>(properties.getBytesPerRange(range, bytesPerRow));
 
+  IGL_PROFILER_COUNTER("IGL staging image bytes", static_cast<int64_t>(storageSize));
+
   // We don't support uploading image data in small chunks. If the total upload size exceeds the
   // the maximum allowed staging buffer size, we can't upload it
   IGL_ASSERT_MSG(storageSize <= maxStagingBufferSize_,
@@ -265,7 +297,7 @@ void VulkanStagingDevice::imageData(const VulkanImage& image,
   // 1. Copy the pixel data into the host visible staging buffer
   stagingBuffer_->bufferSubData(memoryChunk.offset, storageSize, data);
 
-  auto& wrapper = immediate_->acquire();
+  auto& wrapper = uploadCommands().acquire();
   const uint32_t initialLayer = getVkLayer(type, range.face, range.layer);
   const uint32_t numLayers = getVkLayer(type, range.numFaces, range.numLayers);
 
@@ -376,24 +408,61 @@ void VulkanStagingDevice::imageData(const VulkanImage& image,
                                                    : 0)));
 
   // 3. Transition TRANSFER_DST_OPTIMAL into `targetLayout`
-  ivkImageMemoryBarrier(&ctx_.vf_,
-                        wrapper.cmdBuf_,
-                        image.getVkImage(),
-                        VK_ACCESS_TRANSFER_WRITE_BIT,
-                        dstAccessMask,
-                        VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-                        targetLayout,
-                        VK_PIPELINE_STAGE_TRANSFER_BIT,
-                        VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
-                        subresourceRange);
+  if (transferImmediate_) {
+    // release half of the queue family ownership transfer; the matching acquire half is recorded
+    // on the graphics queue below
+    ivkImageMemoryBarrierQueueTransfer(&ctx_.vf_,
+                                       wrapper.cmdBuf_,
+                                       image.getVkImage(),
+                                       VK_ACCESS_TRANSFER_WRITE_BIT,
+                                       0,
+                                       VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                                       targetLayout,
+                                       VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                       VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                                       ctx_.deviceQueues_.transferQueueFamilyIndex,
+                                       ctx_.deviceQueues_.graphicsQueueFamilyIndex,
+                                       subresourceRange);
+  } else {
+    ivkImageMemoryBarrier(&ctx_.vf_,
+                          wrapper.cmdBuf_,
+                          image.getVkImage(),
+                          VK_ACCESS_TRANSFER_WRITE_BIT,
+                          dstAccessMask,
+                          VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                          targetLayout,
+                          VK_PIPELINE_STAGE_TRANSFER_BIT,
+                          VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                          subresourceRange);
+  }
 
   image.imageLayout_ = targetLayout;
 
   ivkCmdEndDebugUtilsLabel(&ctx_.vf_, wrapper.cmdBuf_);
 
   // Store the allocated block with the SubmitHandle at the end of the deque
-  memoryChunk.handle = immediate_->submit(wrapper);
-  regions_.push_front(memoryChunk);
+  memoryChunk.handle = uploadCommands().submit(wrapper);
+  lastUploadHandle_ = memoryChunk.handle;
+  regions_.push_back(memoryChunk);
+
+  if (transferImmediate_) {
+    // acquire ownership on the graphics queue once the transfer queue is done
+    auto& acquireWrapper = ctx_.immediate_->acquire();
+    ivkImageMemoryBarrierQueueTransfer(&ctx_.vf_,
+                                       acquireWrapper.cmdBuf_,
+                                       image.getVkImage(),
+                                       0,
+                                       dstAccessMask,
+                                       VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                                       targetLayout,
+                                       VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                                       VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                                       ctx_.deviceQueues_.transferQueueFamilyIndex,
+                                       ctx_.deviceQueues_.graphicsQueueFamilyIndex,
+                                       subresourceRange);
+    ctx_.immediate_->waitSemaphore(transferImmediate_->acquireLastSubmitSemaphore());
+    ctx_.immediate_->submit(acquireWrapper);
+  }
 }
 
 void VulkanStagingDevice::getImageData2D(VkImage srcImage,
@@ -407,6 +476,8 @@ void VulkanStagingDevice::getImageData2D(VkImage srcImage,
                                          uint32_t bytesPerRow,
                                          bool flipImageVertical) {
   IGL_PROFILER_FUNCTION();
+
+  const std::lock_guard<std::mutex> lock(mutex_);
   IGL_ASSERT(layout != VK_IMAGE_LAYOUT_UNDEFINED);
 
   bool mustRepack = bytesPerRow != 0 && bytesPerRow % properties.bytesPerBlock != 0;
@@ -506,11 +577,13 @@ void VulkanStagingDevice::getImageData2D(VkImage srcImage,
 
   // the data should be available as we get out of this function
   immediate_->wait(immediate_->submit(wrapper2));
-  regions_.push_front(memoryChunk);
+  regions_.push_back(memoryChunk);
 }
 
 VkDeviceSize VulkanStagingDevice::getAlignedSize(VkDeviceSize size) const {
-  constexpr VkDeviceSize kStagingBufferAlignment = 16; // updated to support BC7 compressed image
+  // 64 keeps staging regions aligned to IBuffer::kMapAlignment for SIMD writers (and covers the
+  // 16-byte alignment BC7 compressed images need)
+  constexpr VkDeviceSize kStagingBufferAlignment = 64;
   return (size + kStagingBufferAlignment - 1) & ~(kStagingBufferAlignment - 1);
 }
 
@@ -518,13 +591,11 @@ void VulkanStagingDevice::waitAndReset() {
   IGL_PROFILER_FUNCTION();
 
   for (const auto region : regions_) {
-    immediate_->wait(region.handle);
+    uploadCommands().wait(region.handle);
   }
 
   regions_.clear();
-
-  regions_.push_front(
-      {0, stagingBufferSize_, stagingBufferSize_, VulkanImmediateCommands::SubmitHandle()});
+  head_ = 0;
 }
 
 bool VulkanStagingDevice::shouldGrowStagingBuffer(VkDeviceSize sizeNeeded) const {
@@ -572,10 +643,9 @@ void VulkanStagingDevice::growStagingBuffer(VkDeviceSize minimumSize) {
           .c_str());
   IGL_ASSERT(stagingBuffer_.get());
 
-  // Clear out the old regions and add one that represents the entire buffer
+  // The new buffer starts out empty
   regions_.clear();
-  regions_.push_front(
-      {0, stagingBufferSize_, stagingBufferSize_, VulkanImmediateCommands::SubmitHandle()});
+  head_ = 0;
 }
 
 } // namespace vulkan
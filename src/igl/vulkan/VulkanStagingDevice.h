@@ -9,6 +9,7 @@
 
 #include <deque>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include <igl/vulkan/Common.h>
@@ -31,6 +32,13 @@ class VulkanImage;
  * determined at runtime and is the minimum between VkPhysicalDeviceLimits::VkPhysicalDeviceLimits
  * and 256 MB. Some architectures limit the size of staging buffers to 256MB (buffers that are both
  * host and device visible).
+ *
+ * The transfer entry points (bufferSubData(), getBufferSubData(), imageData(), getImageData2D())
+ * can be called from any thread; they serialize on an internal mutex, so individual transfers do
+ * not overlap. With VulkanContextConfig::useDedicatedTransferQueue enabled, uploads additionally
+ * record a queue ownership acquire barrier through the context's graphics-queue immediate
+ * commands; in that configuration uploads must be externally synchronized with command buffer
+ * creation and submission.
  */
 class VulkanStagingDevice final {
  public:
@@ -88,6 +96,22 @@ class VulkanStagingDevice final {
     return maxStagingBufferSize_;
   }
 
+  /// @brief Returns the handle of the most recent upload submission. Uploads go through a single
+  /// in-order queue, so once this handle completes every earlier upload has completed too
+  [[nodiscard]] VulkanImmediateCommands::SubmitHandle getLastUploadHandle() const {
+    return lastUploadHandle_;
+  }
+
+  /// @brief Returns true when the given upload submission has completed on the GPU. Never blocks
+  [[nodiscard]] bool isUploadComplete(VulkanImmediateCommands::SubmitHandle handle) const {
+    return transferImmediate_ ? transferImmediate_->isReady(handle) : immediate_->isReady(handle);
+  }
+
+  /// @brief Blocks until the given upload submission has completed on the GPU
+  void waitUpload(VulkanImmediateCommands::SubmitHandle handle) {
+    uploadCommands().wait(handle);
+  }
+
  private:
   struct MemoryRegion {
     VkDeviceSize offset = 0u;
@@ -97,9 +121,11 @@ class VulkanStagingDevice final {
   };
 
   /**
-   * @brief Searches for an available block in the staging buffer that is as large as the size
-   * requested. If the only contiguous block of memory available is smaller than the requested size,
-   * the function returns the amount of memory it was able to find.
+   * @brief Allocates a block from the staging ring buffer that is as large as the size requested.
+   * If the contiguous space between the write head and the oldest in-flight region is smaller than
+   * the requested size, the function returns the amount of memory it was able to find. When the
+   * ring is full, the function blocks only on the fence of the oldest in-flight region instead of
+   * draining the entire staging buffer.
    *
    * @return The offset of the free memory block on the staging buffer and the size of the block
    * found.
@@ -115,6 +141,12 @@ class VulkanStagingDevice final {
   /// @brief Returns true if the staging buffer cannot store the size requested
   [[nodiscard]] bool shouldGrowStagingBuffer(VkDeviceSize sizeNeeded) const;
 
+  /// @brief Returns the command context used for uploads: the dedicated transfer queue context
+  /// when one is available, the graphics queue context otherwise
+  [[nodiscard]] VulkanImmediateCommands& uploadCommands() {
+    return transferImmediate_ ? *transferImmediate_ : *immediate_;
+  }
+
   /// @brief Returns the next size to allocate for the staging buffer given the requested size
   [[nodiscard]] VkDeviceSize nextSize(VkDeviceSize requestedSize) const;
 
@@ -125,6 +157,11 @@ class VulkanStagingDevice final {
   VulkanContext& ctx_;
   std::unique_ptr<VulkanBuffer> stagingBuffer_;
   std::unique_ptr<VulkanImmediateCommands> immediate_;
+  /// @brief Command context on the dedicated transfer queue. Only created when
+  /// VulkanContextConfig::useDedicatedTransferQueue is enabled and the device exposes a suitable
+  /// queue family; uploads then overlap rendering and hand ownership back to the graphics queue
+  /// with queue family transfer barriers and a semaphore
+  std::unique_ptr<VulkanImmediateCommands> transferImmediate_;
 
   /// @brief Current size of the staging buffer
   VkDeviceSize stagingBufferSize_ = 0;
@@ -136,13 +173,23 @@ class VulkanStagingDevice final {
   uint32_t stagingBufferCounter_ = 0;
 
   /**
-   * @brief Stores the used and unused blocks of memory in the staging buffer. There is no
-   * distinction between used and unused blocks in the deque, as we always `wait` on each block
-   * before using them. Older blocks are stored at the front of the deque, while used/busy
-   * ones are stored at the end. Older blocks have a higher chance of being unused (not waiting for
-   * the associated command buffer to finish)
+   * @brief Stores the in-flight blocks of the staging ring buffer, each carrying the SubmitHandle
+   * of the command buffer that consumed it. The deque is ordered by submission, oldest blocks at
+   * the front, so the free space is always the contiguous area (modulo the wrap-around) between
+   * the write head and the front of the deque. Blocks are reclaimed from the front as their
+   * associated command buffers complete
    */
   std::deque<MemoryRegion> regions_;
+
+  /// @brief Offset in the staging buffer where the next block will be allocated
+  VkDeviceSize head_ = 0;
+
+  /// @brief Handle of the most recent upload submission. @see getLastUploadHandle()
+  VulkanImmediateCommands::SubmitHandle lastUploadHandle_;
+
+  /// @brief Serializes the public transfer entry points so resources can be uploaded from
+  /// multiple loader threads; guards the staging ring state and the immediate command contexts
+  mutable std::mutex mutex_;
 };
 
 } // namespace vulkan
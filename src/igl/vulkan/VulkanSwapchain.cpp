@@ -7,6 +7,8 @@
 
 #include "VulkanSwapchain.h"
 
+#include <chrono>
+
 #include <igl/vulkan/Device.h>
 #include <igl/vulkan/VulkanContext.h>
 #include <igl/vulkan/VulkanDevice.h>
@@ -88,7 +90,8 @@ VkPresentModeKHR chooseSwapPresentMode(const std::vector<VkPresentModeKHR>& mode
 VkImageUsageFlags chooseUsageFlags(const VulkanFunctionTable& vf,
                                    VkPhysicalDevice pd,
                                    VkSurfaceKHR surface,
-                                   VkFormat format) {
+                                   VkFormat format,
+                                   bool allowStorage) {
   VkImageUsageFlags usageFlags = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT |
                                  VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
   VkSurfaceCapabilitiesKHR caps = {};
@@ -102,7 +105,9 @@ VkImageUsageFlags chooseUsageFlags(const VulkanFunctionTable& vf,
   const bool isTilingOptimalSupported =
       (props.optimalTilingFeatures & VK_IMAGE_USAGE_STORAGE_BIT) > 0;
 
-  if (isStorageSupported && isTilingOptimalSupported) {
+  // storage usage can disable framebuffer compression for the whole swapchain on desktop GPUs;
+  // VulkanContextConfig::enableStorageSwapchainImages lets applications opt out of it
+  if (allowStorage && isStorageSupported && isTilingOptimalSupported) {
     usageFlags |= VK_IMAGE_USAGE_STORAGE_BIT;
   }
 
@@ -122,15 +127,23 @@ VulkanSwapchain::VulkanSwapchain(const VulkanContext& ctx, uint32_t width, uint3
   height_(height) {
   surfaceFormat_ =
       chooseSwapSurfaceFormat(ctx.deviceSurfaceFormats_, ctx.config_.swapChainColorSpace);
+  // explicit scanout format for the direct-to-display path: honored when the display surface
+  // exposes it, otherwise the colorspace-driven selection above stands
+  if (ctx.useDirectToDisplay_ && ctx.config_.directToDisplayFormat != TextureFormat::Invalid) {
+    const VkFormat scanoutFormat = textureFormatToVkFormat(ctx.config_.directToDisplayFormat);
+    for (const VkSurfaceFormatKHR& format : ctx.deviceSurfaceFormats_) {
+      if (format.format == scanoutFormat) {
+        surfaceFormat_ = format;
+        break;
+      }
+    }
+  }
   IGL_DEBUG_LOG(
       "Swapchain format: %s; colorSpace: %s\n",
       TextureFormatProperties::fromTextureFormat(vkFormatToTextureFormat(surfaceFormat_.format))
           .name,
       colorSpaceToString(vkColorSpaceToColorSpace(surfaceFormat_.colorSpace)));
 
-  acquireSemaphore_ = std::make_unique<igl::vulkan::VulkanSemaphore>(
-      ctx_.vf_, device_, false, "Semaphore: swapchain-acquire");
-
   IGL_ASSERT_MSG(
       ctx.vkSurface_ != VK_NULL_HANDLE,
       "You are trying to create a swapchain but your OS surface is empty. Did you want to "
@@ -150,25 +163,43 @@ VulkanSwapchain::VulkanSwapchain(const VulkanContext& ctx, uint32_t width, uint3
   }
 #endif
 
-  const VkImageUsageFlags usageFlags =
-      chooseUsageFlags(ctx.vf_, ctx.getVkPhysicalDevice(), ctx.vkSurface_, surfaceFormat_.format);
-
-  VK_ASSERT(ivkCreateSwapchain(&ctx_.vf_,
-                               device_,
-                               ctx.vkSurface_,
-                               chooseSwapImageCount(ctx.deviceSurfaceCaps_),
-                               surfaceFormat_,
-                               chooseSwapPresentMode(ctx.devicePresentModes_),
-                               &ctx.deviceSurfaceCaps_,
-                               usageFlags,
-                               ctx.deviceQueues_.graphicsQueueFamilyIndex,
-                               width,
-                               height,
-                               &swapchain_));
-  VK_ASSERT(ctx.vf_.vkGetSwapchainImagesKHR(device_, swapchain_, &numSwapchainImages_, nullptr));
+  usageFlags_ = chooseUsageFlags(ctx.vf_,
+                                 ctx.getVkPhysicalDevice(),
+                                 ctx.vkSurface_,
+                                 surfaceFormat_.format,
+                                 ctx.config_.enableStorageSwapchainImages);
+  presentMode_ = chooseSwapPresentMode(ctx.devicePresentModes_);
+
+#if defined(VK_GOOGLE_display_timing)
+  displayTimingEnabled_ = ctx.config_.enableDisplayTimingPacing &&
+                          ctx.extensions_.enabled(VK_GOOGLE_DISPLAY_TIMING_EXTENSION_NAME) &&
+                          ctx.vf_.vkGetRefreshCycleDurationGOOGLE != nullptr &&
+                          ctx.vf_.vkGetPastPresentationTimingGOOGLE != nullptr;
+#endif // VK_GOOGLE_display_timing
+
+  const Result result = createSwapchain(VK_NULL_HANDLE);
+  IGL_ASSERT_MSG(result.isOk(), result.message.c_str());
+}
+
+Result VulkanSwapchain::createSwapchain(VkSwapchainKHR oldSwapchain) {
+  VK_ASSERT_RETURN(ivkCreateSwapchain(&ctx_.vf_,
+                                      device_,
+                                      ctx_.vkSurface_,
+                                      chooseSwapImageCount(ctx_.deviceSurfaceCaps_),
+                                      surfaceFormat_,
+                                      presentMode_,
+                                      &ctx_.deviceSurfaceCaps_,
+                                      usageFlags_,
+                                      ctx_.deviceQueues_.graphicsQueueFamilyIndex,
+                                      width_,
+                                      height_,
+                                      oldSwapchain,
+                                      &swapchain_));
+  VK_ASSERT_RETURN(
+      ctx_.vf_.vkGetSwapchainImagesKHR(device_, swapchain_, &numSwapchainImages_, nullptr));
   std::vector<VkImage> swapchainImages(numSwapchainImages_);
   swapchainImages.resize(numSwapchainImages_);
-  VK_ASSERT(ctx.vf_.vkGetSwapchainImagesKHR(
+  VK_ASSERT_RETURN(ctx_.vf_.vkGetSwapchainImagesKHR(
       device_, swapchain_, &numSwapchainImages_, swapchainImages.data()));
 
   IGL_ASSERT(numSwapchainImages_ > 0);
@@ -176,7 +207,27 @@ VulkanSwapchain::VulkanSwapchain(const VulkanContext& ctx, uint32_t width, uint3
   // Prevent underflow when doing (frameNumber_ - numSwapchainImages_).
   // Every resource submitted in the frame (frameNumber_ - numSwapchainImages_) or earlier is
   // guaranteed to be processed by the GPU in the frame (frameNumber_).
-  frameNumber_ = numSwapchainImages_;
+  if (frameNumber_ < numSwapchainImages_) {
+    frameNumber_ = numSwapchainImages_;
+  }
+
+#if defined(VK_GOOGLE_display_timing)
+  // past presentation timings refer to the previous VkSwapchainKHR - start predicting from scratch
+  refreshCycleDuration_ = 0;
+  lastActualPresentTime_ = 0;
+  lastPresentId_ = 0;
+#endif // VK_GOOGLE_display_timing
+
+  // one acquire semaphore per swapchain image, so an image can be pre-acquired at the end of a
+  // frame while the semaphore of the previous acquisition is still pending its queue wait. The
+  // callers of createSwapchain() guarantee that no submitted work references the old semaphores
+  acquireSemaphores_.clear();
+  acquireSemaphores_.reserve(numSwapchainImages_);
+  for (uint32_t i = 0; i < numSwapchainImages_; i++) {
+    acquireSemaphores_.emplace_back(std::make_unique<igl::vulkan::VulkanSemaphore>(
+        ctx_.vf_, device_, false, IGL_FORMAT("Semaphore: swapchain-acquire #{}", i).c_str()));
+  }
+  acquireSemaphoreIndex_ = 0;
 
   // create images, image views and framebuffers
   swapchainTextures_ = std::make_unique<std::shared_ptr<VulkanTexture>[]>(numSwapchainImages_);
@@ -184,7 +235,7 @@ VulkanSwapchain::VulkanSwapchain(const VulkanContext& ctx, uint32_t width, uint3
     auto image = std::make_unique<VulkanImage>(
         ctx_, device_, swapchainImages[i], IGL_FORMAT("Image: swapchain #{}", i).c_str());
     // set usage flags for retrieved images
-    image->usageFlags_ = usageFlags;
+    image->usageFlags_ = usageFlags_;
     image->imageFormat_ = surfaceFormat_.format;
 
     auto imageView = image->createImageView(VK_IMAGE_VIEW_TYPE_2D,
@@ -198,6 +249,71 @@ VulkanSwapchain::VulkanSwapchain(const VulkanContext& ctx, uint32_t width, uint3
     swapchainTextures_[i] =
         std::make_shared<VulkanTexture>(ctx_, std::move(image), std::move(imageView));
   }
+
+  return Result();
+}
+
+bool VulkanSwapchain::isPresentModeSupported(VkPresentModeKHR presentMode) const {
+  return std::find(ctx_.devicePresentModes_.cbegin(),
+                   ctx_.devicePresentModes_.cend(),
+                   presentMode) != ctx_.devicePresentModes_.cend();
+}
+
+Result VulkanSwapchain::setPresentMode(VkPresentModeKHR presentMode) {
+  if (presentMode == presentMode_) {
+    return Result();
+  }
+
+  if (!isPresentModeSupported(presentMode)) {
+    return Result(Result::Code::Unsupported, "The surface does not support this present mode");
+  }
+
+  // vkCreateSwapchainKHR() reuses the presentable images of `oldSwapchain`, but our VulkanTexture
+  // wrappers (and their image views) must not be released while the GPU still renders into them
+  ctx_.waitIdle();
+
+  presentMode_ = presentMode;
+
+  const VkSwapchainKHR oldSwapchain = swapchain_;
+  swapchainTextures_ = nullptr;
+  currentImageIndex_ = 0;
+  getNextImage_ = true;
+
+  const Result result = createSwapchain(oldSwapchain);
+
+  // the old swapchain is retired by vkCreateSwapchainKHR() but still has to be destroyed
+  ctx_.vf_.vkDestroySwapchainKHR(device_, oldSwapchain, nullptr);
+
+  return result;
+}
+
+Result VulkanSwapchain::resize(uint32_t width, uint32_t height) {
+  if (width == width_ && height == height_) {
+    return Result();
+  }
+
+  // as in setPresentMode(): the VulkanTexture wrappers of the old presentable images (and their
+  // image views) must not be released while the GPU still renders into them
+  ctx_.waitIdle();
+
+  width_ = width;
+  height_ = height;
+
+  // the depth buffer is size-dependent; drop it and let the next getCurrentDepthTexture() call
+  // reallocate it at the new size
+  depthTexture_ = nullptr;
+
+  const VkSwapchainKHR oldSwapchain = swapchain_;
+  swapchainTextures_ = nullptr;
+  currentImageIndex_ = 0;
+  getNextImage_ = true;
+
+  const Result result = createSwapchain(oldSwapchain);
+
+  // the old swapchain is retired by vkCreateSwapchainKHR() but still has to be destroyed
+  ctx_.vf_.vkDestroySwapchainKHR(device_, oldSwapchain, nullptr);
+
+  return result;
 }
 
 VkImage VulkanSwapchain::getDepthVkImage() const {
@@ -254,15 +370,31 @@ VulkanSwapchain::~VulkanSwapchain() {
   ctx_.vf_.vkDestroySwapchainKHR(device_, swapchain_, nullptr);
 }
 
+VkSemaphore VulkanSwapchain::getAcquireVkSemaphore() const {
+  return acquireSemaphores_[acquireSemaphoreIndex_]->vkSemaphore_;
+}
+
 Result VulkanSwapchain::acquireNextImage() {
   IGL_PROFILER_FUNCTION();
+
+  acquireSemaphoreIndex_ = (acquireSemaphoreIndex_ + 1) % (uint32_t)acquireSemaphores_.size();
+
+  // time how long the compositor makes us wait - this is the part of the frame that telemetry
+  // should attribute to presentation back-pressure, not to our own CPU work
+  const auto startTime = std::chrono::steady_clock::now();
+
   // when timeout is set to UINT64_MAX, we wait until the next image has been acquired
   VK_ASSERT_RETURN(ctx_.vf_.vkAcquireNextImageKHR(device_,
                                                   swapchain_,
                                                   UINT64_MAX,
-                                                  acquireSemaphore_->vkSemaphore_,
+                                                  getAcquireVkSemaphore(),
                                                   VK_NULL_HANDLE,
                                                   &currentImageIndex_));
+
+  lastAcquireWaitNanos_ = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+                              std::chrono::steady_clock::now() - startTime)
+                              .count();
+
   // increase the frame number every time we acquire a new swapchain image
   frameNumber_++;
   return Result();
@@ -272,12 +404,70 @@ Result VulkanSwapchain::present(VkSemaphore waitSemaphore) {
   IGL_PROFILER_FUNCTION();
 
   IGL_PROFILER_ZONE("vkQueuePresent()", IGL_PROFILER_COLOR_PRESENT);
-  VK_ASSERT_RETURN(
-      ivkQueuePresent(&ctx_.vf_, graphicsQueue_, waitSemaphore, swapchain_, currentImageIndex_));
+#if defined(VK_GOOGLE_display_timing)
+  if (displayTimingEnabled_) {
+    if (refreshCycleDuration_ == 0) {
+      VkRefreshCycleDurationGOOGLE refreshCycle = {};
+      if (ctx_.vf_.vkGetRefreshCycleDurationGOOGLE(device_, swapchain_, &refreshCycle) ==
+          VK_SUCCESS) {
+        refreshCycleDuration_ = refreshCycle.refreshDuration;
+      }
+    }
+    // feed back when our previous frames actually hit the display, so that the prediction below
+    // tracks the compositor instead of drifting
+    uint32_t timingCount = 0;
+    ctx_.vf_.vkGetPastPresentationTimingGOOGLE(device_, swapchain_, &timingCount, nullptr);
+    if (timingCount > 0) {
+      std::vector<VkPastPresentationTimingGOOGLE> timings(timingCount);
+      if (ctx_.vf_.vkGetPastPresentationTimingGOOGLE(
+              device_, swapchain_, &timingCount, timings.data()) >= VK_SUCCESS) {
+        const VkPastPresentationTimingGOOGLE& newest = timings[timingCount - 1];
+        lastActualPresentTime_ = newest.actualPresentTime;
+        lastPresentId_ = newest.presentID;
+      }
+    }
+    // predict the refresh cycle this frame should land on; requesting slightly earlier than the
+    // predicted vblank keeps a frame that finishes marginally late from slipping a whole cycle.
+    // desiredPresentTime == 0 means "no preference" until we have seen an actual present
+    uint64_t desiredPresentTime = 0;
+    const uint32_t presentId = static_cast<uint32_t>(frameNumber_);
+    if (lastActualPresentTime_ != 0 && refreshCycleDuration_ != 0 && presentId > lastPresentId_) {
+      desiredPresentTime = lastActualPresentTime_ +
+                           (presentId - lastPresentId_) * refreshCycleDuration_ -
+                           refreshCycleDuration_ / 4;
+    }
+    const VkPresentTimeGOOGLE presentTime = {
+        .presentID = presentId,
+        .desiredPresentTime = desiredPresentTime,
+    };
+    const VkPresentTimesInfoGOOGLE presentTimesInfo = {
+        .sType = VK_STRUCTURE_TYPE_PRESENT_TIMES_INFO_GOOGLE,
+        .swapchainCount = 1u,
+        .pTimes = &presentTime,
+    };
+    const VkPresentInfoKHR pi = {
+        .sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR,
+        .pNext = &presentTimesInfo,
+        .waitSemaphoreCount = 1u,
+        .pWaitSemaphores = &waitSemaphore,
+        .swapchainCount = 1u,
+        .pSwapchains = &swapchain_,
+        .pImageIndices = &currentImageIndex_,
+    };
+    VK_ASSERT_RETURN(ctx_.vf_.vkQueuePresentKHR(graphicsQueue_, &pi));
+  } else
+#endif // VK_GOOGLE_display_timing
+  {
+    VK_ASSERT_RETURN(
+        ivkQueuePresent(&ctx_.vf_, graphicsQueue_, waitSemaphore, swapchain_, currentImageIndex_));
+  }
   IGL_PROFILER_ZONE_END();
 
-  // Ready to call acquireNextImage() on the next getCurrentVulkanTexture();
-  getNextImage_ = true;
+  // Pre-acquire the image for the next frame right away: the compositor wait then happens at a
+  // predictable point (the end of this frame, captured by getLastAcquireWaitNanoseconds())
+  // instead of blocking the next frame at an arbitrary getCurrentVulkanTexture() call. On
+  // failure, fall back to acquiring lazily on the next getCurrentVulkanTexture()
+  getNextImage_ = !acquireNextImage().isOk();
 
   IGL_PROFILER_FRAME(nullptr);
 
@@ -29,6 +29,26 @@ class VulkanSwapchain final {
 
   Result acquireNextImage();
   Result present(VkSemaphore waitSemaphore);
+
+  /// @brief Returns true if the surface supports the given present mode
+  bool isPresentModeSupported(VkPresentModeKHR presentMode) const;
+
+  /// @brief Switches the swapchain to a different present mode (e.g. FIFO for battery/latency
+  /// consistency, MAILBOX or IMMEDIATE for throughput) at runtime. The swapchain is recreated in
+  /// place via VkSwapchainCreateInfoKHR::oldSwapchain; the depth buffer is preserved. Returns
+  /// Result::Code::Unsupported if the surface does not support `presentMode`.
+  Result setPresentMode(VkPresentModeKHR presentMode);
+
+  /// @brief Recreates the swapchain in place for a new surface size (foldables, split-screen).
+  /// Only size-dependent resources are recreated: the presentable images and the lazily allocated
+  /// depth buffer. The surface format, usage flags and present mode chosen at construction are
+  /// kept, and the old swapchain is handed to vkCreateSwapchainKHR() as `oldSwapchain` so the
+  /// driver can recycle its presentable image memory. No-op when the size is unchanged.
+  Result resize(uint32_t width, uint32_t height);
+
+  VkPresentModeKHR getPresentMode() const {
+    return presentMode_;
+  }
   VkImage getCurrentVkImage() const {
     if (IGL_VERIFY(currentImageIndex_ < numSwapchainImages_)) {
       return swapchainTextures_[currentImageIndex_]->getVulkanImage().getVkImage();
@@ -91,11 +111,21 @@ class VulkanSwapchain final {
     return frameNumber_;
   }
 
+  /// @brief Returns the semaphore signaled by the most recent image acquisition. Submissions that
+  /// render into the current swapchain image must wait on it (see CommandQueue)
+  VkSemaphore getAcquireVkSemaphore() const;
+
+  /// @brief Wall-clock duration the most recent vkAcquireNextImageKHR() call blocked, in
+  /// nanoseconds. Images are pre-acquired right after present(), so this is the time the frame
+  /// spent waiting on the compositor - telemetry can use it to tell compositor-bound frames from
+  /// CPU-bound ones
+  uint64_t getLastAcquireWaitNanoseconds() const {
+    return lastAcquireWaitNanos_;
+  }
+
  private:
   void lazyAllocateDepthBuffer() const;
-
- public:
-  std::unique_ptr<igl::vulkan::VulkanSemaphore> acquireSemaphore_;
+  Result createSwapchain(VkSwapchainKHR oldSwapchain);
 
  private:
   const VulkanContext& ctx_;
@@ -107,10 +137,24 @@ class VulkanSwapchain final {
   uint32_t currentImageIndex_ = 0;
   uint64_t frameNumber_ = 0;
   bool getNextImage_ = true;
-  VkSwapchainKHR swapchain_;
+  VkSwapchainKHR swapchain_ = VK_NULL_HANDLE;
+  // one acquire semaphore per swapchain image, rotated on every acquisition so the next image can
+  // be acquired at the end of a frame while the previous semaphore is still pending a queue wait
+  std::vector<std::unique_ptr<igl::vulkan::VulkanSemaphore>> acquireSemaphores_;
+  uint32_t acquireSemaphoreIndex_ = 0;
+  uint64_t lastAcquireWaitNanos_ = 0;
   std::unique_ptr<std::shared_ptr<VulkanTexture>[]> swapchainTextures_;
   mutable std::shared_ptr<VulkanTexture> depthTexture_;
   VkSurfaceFormatKHR surfaceFormat_;
+  VkPresentModeKHR presentMode_ = VK_PRESENT_MODE_FIFO_KHR;
+  VkImageUsageFlags usageFlags_ = 0;
+#if defined(VK_GOOGLE_display_timing)
+  // frame pacing state for VK_GOOGLE_display_timing (see present())
+  bool displayTimingEnabled_ = false;
+  uint64_t refreshCycleDuration_ = 0; // nanoseconds; 0 until queried
+  uint64_t lastActualPresentTime_ = 0;
+  uint32_t lastPresentId_ = 0;
+#endif // VK_GOOGLE_display_timing
 };
 
 } // namespace vulkan
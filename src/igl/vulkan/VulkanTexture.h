@@ -22,8 +22,10 @@ class VulkanImageView;
 
 class VulkanTexture final {
  public:
+  /// @brief The image is shared so that texture views (igl::ITexture::createView) can alias the
+  /// storage of their parent texture while owning their own VulkanImageView and bindless slot
   VulkanTexture(const VulkanContext& ctx,
-                std::unique_ptr<VulkanImage> image,
+                std::shared_ptr<VulkanImage> image,
                 std::unique_ptr<VulkanImageView> imageView);
   ~VulkanTexture() = default;
 
@@ -45,11 +47,15 @@ class VulkanTexture final {
   uint32_t getTextureId() const {
     return textureId_;
   }
+  /// @brief Returns the shared image so a view's VulkanTexture can alias it
+  std::shared_ptr<VulkanImage> getSharedVulkanImage() const {
+    return image_;
+  }
 
  private:
   friend class VulkanContext;
   const VulkanContext& ctx_;
-  std::unique_ptr<VulkanImage> image_;
+  std::shared_ptr<VulkanImage> image_;
   std::unique_ptr<VulkanImageView> imageView_;
   // an index into VulkanContext::textures_
   uint32_t textureId_ = 0;
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <igl/vulkan/VulkanUniformRingBuffer.h>
+
+#include <igl/vulkan/VulkanBuffer.h>
+#include <igl/vulkan/VulkanContext.h>
+
+namespace igl {
+namespace vulkan {
+
+VulkanUniformRingBuffer::VulkanUniformRingBuffer(const VulkanContext& ctx,
+                                                 uint32_t regionCount,
+                                                 VkDeviceSize regionSize,
+                                                 VkDeviceSize alignment,
+                                                 const char* debugName) :
+  ctx_(ctx), regionCount_(regionCount), alignment_(alignment) {
+  IGL_ASSERT(regionCount_ > 0);
+  IGL_ASSERT(alignment_ > 0);
+
+  // round the region size up so every region starts at an aligned offset
+  regionSize_ = (regionSize + alignment_ - 1) & ~(alignment_ - 1);
+
+  Result result;
+  buffer_ = ctx_.createBuffer(regionSize_ * regionCount_,
+                              VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT,
+                              VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+                                  VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                              &result,
+                              debugName);
+  if (!IGL_VERIFY(result.isOk() && buffer_ && buffer_->isMapped())) {
+    buffer_.reset();
+  }
+}
+
+VulkanUniformRingBuffer::~VulkanUniformRingBuffer() = default;
+
+VulkanUniformRingBuffer::Slice VulkanUniformRingBuffer::allocate(VkDeviceSize size) {
+  if (!buffer_ || size == 0) {
+    return {};
+  }
+
+  const VkDeviceSize alignedSize = (size + alignment_ - 1) & ~(alignment_ - 1);
+
+  // claim the slice with an atomic fetch_add: parallel secondary encoders call bindBytes() from
+  // worker threads, so concurrent allocations must receive disjoint slices. On failure the cursor
+  // stays past regionSize_ (no rollback - a concurrent allocation may already sit above us) until
+  // nextRegion() resets it
+  const VkDeviceSize sliceStart = cursor_.fetch_add(alignedSize, std::memory_order_relaxed);
+
+  if (sliceStart + alignedSize > regionSize_) {
+    // The region is sized for a whole frame's worth of bindBytes() updates; running out means the
+    // remaining updates in this frame fall back to the caller's slow path
+    if (!overflowLogged_.exchange(true)) {
+      IGL_LOG_ERROR("Uniform ring buffer region exhausted (%u bytes); increase the region size\n",
+                    (uint32_t)regionSize_);
+    }
+    return {};
+  }
+
+  const VkDeviceSize offset = regionIndex_ * regionSize_ + sliceStart;
+
+  // the memory is host-coherent: the memcpy done by the caller needs no flush
+  return Slice{buffer_->getVkBuffer(), offset, alignedSize, buffer_->getMappedPtr() + offset};
+}
+
+void VulkanUniformRingBuffer::nextRegion() noexcept {
+  // runs at the frame boundary, after all encoding threads for the retiring frame have joined
+  regionIndex_ = (regionIndex_ + 1) % regionCount_;
+  cursor_.store(0, std::memory_order_relaxed);
+  overflowLogged_.store(false, std::memory_order_relaxed);
+}
+
+} // namespace vulkan
+} // namespace igl
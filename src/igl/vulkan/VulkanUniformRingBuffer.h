@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+
+#include <igl/vulkan/Common.h>
+
+namespace igl {
+namespace vulkan {
+
+class VulkanBuffer;
+class VulkanContext;
+
+/** @brief A persistently mapped, host-coherent uniform buffer shared by all command buffers of a
+ * frame. The buffer is split into one region per frame in flight (see SyncManager); per-draw
+ * uniform data too large for push constants is memcpy'd into aligned slices carved from the
+ * current region, with no map/unmap syscalls and no flushes. Regions are recycled in lockstep
+ * with SyncManager::acquireNext(): when a frame slot retires, its region's write cursor is reset
+ * and the region is reused, so slices never need to be freed individually. Slices are aligned to
+ * the alignment provided at construction (callers should pass the device's
+ * `minUniformBufferOffsetAlignment` limit). allocate() is thread-safe (the write cursor is a
+ * lock-free atomic) because parallel secondary encoders call bindBytes() from worker threads;
+ * nextRegion() must be externally synchronized with all allocations, which SyncManager's
+ * frame boundary already guarantees
+ */
+class VulkanUniformRingBuffer final {
+ public:
+  /// @brief A slice handed out by the ring: the ring-owned buffer handle, the aligned offset and
+  /// size of the slice within it, and a write pointer into the persistently mapped memory
+  struct Slice {
+    VkBuffer buffer = VK_NULL_HANDLE;
+    VkDeviceSize offset = 0;
+    VkDeviceSize range = 0;
+    uint8_t* ptr = nullptr;
+
+    [[nodiscard]] bool valid() const {
+      return ptr != nullptr;
+    }
+  };
+
+  VulkanUniformRingBuffer(const VulkanContext& ctx,
+                          uint32_t regionCount,
+                          VkDeviceSize regionSize,
+                          VkDeviceSize alignment,
+                          const char* debugName);
+  ~VulkanUniformRingBuffer();
+
+  VulkanUniformRingBuffer(const VulkanUniformRingBuffer&) = delete;
+  VulkanUniformRingBuffer& operator=(const VulkanUniformRingBuffer&) = delete;
+
+  /// @brief Carves an aligned slice of at least `size` bytes out of the current region. Returns an
+  /// invalid Slice when the region is exhausted or the backing buffer could not be created
+  [[nodiscard]] Slice allocate(VkDeviceSize size);
+
+  /// @brief Advances to the next region and resets its write cursor. Must be called exactly once
+  /// per SyncManager::acquireNext(), after the retiring frame slot has been waited on
+  void nextRegion() noexcept;
+
+ private:
+  const VulkanContext& ctx_;
+  std::unique_ptr<VulkanBuffer> buffer_;
+  uint32_t regionCount_ = 1;
+  VkDeviceSize regionSize_ = 0;
+  VkDeviceSize alignment_ = 16;
+  uint32_t regionIndex_ = 0;
+  /// @brief Write cursor relative to the start of the current region; advanced with fetch_add so
+  /// concurrent allocate() calls always receive disjoint slices. It can overshoot regionSize_ on
+  /// a failed allocation and is brought back by nextRegion()
+  std::atomic<VkDeviceSize> cursor_ = 0;
+  /// @brief Set when an allocation did not fit, to log the overflow only once per region
+  std::atomic<bool> overflowLogged_ = false;
+};
+
+} // namespace vulkan
+} // namespace igl
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+namespace igl {
+namespace vulkan {
+
+class VulkanContext;
+
+/// Results of the opt-in upload calibration probe that runs at device creation when
+/// VulkanContextConfig::enableUploadCalibration is set. The probe spends roughly ten
+/// milliseconds measuring what this particular device's upload paths actually cost, so upload
+/// strategy selection can be driven by measurements instead of thresholds hand-tuned per SoC.
+/// All measurements are best-of-N to shave off warm-up noise; a probe that could not complete
+/// leaves `valid` false and every consumer falls back to the uncalibrated defaults.
+struct VulkanUploadCalibration {
+  /// True when every measurement completed; false results must be ignored.
+  bool valid = false;
+  /// Throughput of a copy into a device-local buffer through the staging ring, including the
+  /// submission and the wait for the transfer to complete.
+  double stagingBytesPerSecond = 0.0;
+  /// Throughput of a CPU write into persistently mapped host-visible memory (typically
+  /// write-combined), including the flush for non-coherent memory.
+  double hostVisibleBytesPerSecond = 0.0;
+  /// Fixed cost of one minimal upload through the staging ring. Buffers in this backend stay
+  /// persistently mapped, so this round-trip cost stands in for the map/unmap latency of
+  /// designs that map per upload; it is what makes the staging path lose for small uploads.
+  double stagingLatencySeconds = 0.0;
+
+  /// Returns true when writing mapped memory directly is preferable to the staging path for
+  /// per-frame streamed data on this device. Direct writes skip one CPU copy and one submission,
+  /// so they win whenever mapped-memory throughput is within half of the staged-copy bandwidth.
+  [[nodiscard]] bool preferDirectHostVisibleWrites() const;
+};
+
+/// Runs the calibration probe against a fully initialized context. Called from
+/// VulkanContext::initContext() after the staging device exists; the probe allocates two
+/// megabyte-sized scratch buffers and submits a handful of transfers, so it must not run
+/// per frame.
+VulkanUploadCalibration runUploadCalibration(VulkanContext& ctx);
+
+} // namespace vulkan
+} // namespace igl
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <igl/vulkan/VulkanUploadScheduler.h>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#include <igl/vulkan/VulkanContext.h>
+
+namespace igl {
+namespace vulkan {
+
+VulkanUploadScheduler::VulkanUploadScheduler(VulkanContext& ctx) : ctx_(ctx) {}
+
+UploadToken VulkanUploadScheduler::enqueue(std::shared_ptr<IBuffer> buffer,
+                                           const void* data,
+                                           const BufferRange& range,
+                                           UploadPriority priority) {
+  if (!IGL_VERIFY(buffer && data) || !range.size) {
+    return 0;
+  }
+
+  if (priority == UploadPriority::FrameCritical) {
+    // never budgeted; runs on the staging path right away and completes immediately
+    buffer->upload(data, range);
+    const std::lock_guard<std::mutex> lock(mutex_);
+    return nextToken_++;
+  }
+
+  Request request;
+  request.buffer = std::move(buffer);
+  request.data.resize(range.size);
+  std::memcpy(request.data.data(), data, range.size);
+  request.dstOffset = range.offset;
+
+  const std::lock_guard<std::mutex> lock(mutex_);
+  request.token = nextToken_++;
+  pendingTokens_.insert(request.token);
+  auto& queue = priority == UploadPriority::Streaming ? streaming_ : background_;
+  queue.push_back(std::move(request));
+  return queue.back().token;
+}
+
+bool VulkanUploadScheduler::isCompleted(UploadToken token) const {
+  if (!token) {
+    return true;
+  }
+  const std::lock_guard<std::mutex> lock(mutex_);
+  return token < nextToken_ && pendingTokens_.count(token) == 0;
+}
+
+void VulkanUploadScheduler::processFrame() {
+  IGL_PROFILER_FUNCTION();
+
+  const std::lock_guard<std::mutex> lock(mutex_);
+
+  const uint32_t configBudget = ctx_.config_.maxScheduledUploadBytesPerFrame;
+  size_t budget = configBudget ? configBudget : std::numeric_limits<size_t>::max();
+
+  drainQueue(streaming_, budget);
+  drainQueue(background_, budget);
+}
+
+size_t VulkanUploadScheduler::pendingUploadBytes() const {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  size_t bytes = 0;
+  for (const auto& request : streaming_) {
+    bytes += request.data.size() - request.submittedBytes;
+  }
+  for (const auto& request : background_) {
+    bytes += request.data.size() - request.submittedBytes;
+  }
+  return bytes;
+}
+
+void VulkanUploadScheduler::drainQueue(std::deque<Request>& queue, size_t& budget) {
+  while (!queue.empty() && budget) {
+    Request& request = queue.front();
+    const size_t remaining = request.data.size() - request.submittedBytes;
+    // an upload larger than the remaining budget is split; the rest carries over to later frames
+    const size_t chunk = std::min(remaining, budget);
+    request.buffer->upload(request.data.data() + request.submittedBytes,
+                           BufferRange(chunk, request.dstOffset + request.submittedBytes));
+    request.submittedBytes += chunk;
+    budget -= chunk;
+    if (request.submittedBytes == request.data.size()) {
+      pendingTokens_.erase(request.token);
+      queue.pop_front();
+    }
+  }
+}
+
+} // namespace vulkan
+} // namespace igl
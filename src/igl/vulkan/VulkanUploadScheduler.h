@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <deque>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+#include <igl/Buffer.h>
+
+namespace igl {
+namespace vulkan {
+
+class VulkanContext;
+
+/// @brief Priority class of a scheduled upload (see VulkanUploadScheduler)
+enum class UploadPriority : uint8_t {
+  /// Must land before the next submitted command buffer: executed immediately, never budgeted
+  FrameCritical,
+  /// Level streaming: budgeted, served before Background
+  Streaming,
+  /// Prefetches and other deferrable work: budgeted, served after Streaming
+  Background,
+};
+
+/// @brief Completion token of a scheduled upload; 0 is the null token (trivially completed)
+using UploadToken = uint64_t;
+
+/// @brief Schedules buffer uploads by priority with a per-frame byte budget, so large streaming
+/// uploads stop delaying latency-critical ones on the shared staging path.
+///
+/// FrameCritical uploads run immediately at enqueue() time. Streaming and Background uploads are
+/// copied aside and drained once per submitted command buffer (see CommandQueue::submit()) in
+/// priority order, spending at most VulkanContextConfig::maxScheduledUploadBytesPerFrame bytes
+/// per frame; an upload larger than the remaining budget is split and carried across frames.
+/// enqueue() returns a token that completes once all bytes of the upload have been handed to the
+/// in-order queue - from then on any subsequently submitted command buffer observes the data.
+///
+/// enqueue() and isCompleted() may be called from loader threads; the uploads themselves always
+/// run on the thread that submits command buffers.
+class VulkanUploadScheduler final {
+ public:
+  explicit VulkanUploadScheduler(VulkanContext& ctx);
+
+  VulkanUploadScheduler(const VulkanUploadScheduler&) = delete;
+  VulkanUploadScheduler& operator=(const VulkanUploadScheduler&) = delete;
+
+  /// @brief Schedules `size`/`offset` bytes of `data` for upload into `buffer`. FrameCritical
+  /// data is uploaded before returning; other priorities copy the data aside (the caller may
+  /// reuse its memory immediately) and upload within the per-frame budget. Returns the
+  /// completion token; the buffer is kept alive until its upload has been submitted
+  UploadToken enqueue(std::shared_ptr<IBuffer> buffer,
+                      const void* data,
+                      const BufferRange& range,
+                      UploadPriority priority);
+
+  /// @brief True once every byte of the upload has been handed to the in-order queue (always
+  /// true for the null token and for FrameCritical uploads)
+  bool isCompleted(UploadToken token) const;
+
+  /// @brief Drains the Streaming and then the Background queue, spending at most
+  /// VulkanContextConfig::maxScheduledUploadBytesPerFrame bytes (0 = unbounded). Called once per
+  /// submitted command buffer, before the pending coalesced uploads are flushed
+  void processFrame();
+
+  /// @brief Bytes still waiting in the Streaming and Background queues
+  size_t pendingUploadBytes() const;
+
+ private:
+  struct Request {
+    std::shared_ptr<IBuffer> buffer;
+    std::vector<uint8_t> data;
+    size_t dstOffset = 0;
+    // bytes of `data` already handed to the in-order queue (partial for split uploads)
+    size_t submittedBytes = 0;
+    UploadToken token = 0;
+  };
+
+  // drains `queue` front-to-back, decrementing `budget`; stops when the budget is exhausted
+  void drainQueue(std::deque<Request>& queue, size_t& budget);
+
+  VulkanContext& ctx_;
+
+  mutable std::mutex mutex_;
+  std::deque<Request> streaming_;
+  std::deque<Request> background_;
+  // tokens of uploads still queued (fully submitted tokens are erased)
+  std::unordered_set<UploadToken> pendingTokens_;
+  UploadToken nextToken_ = 1;
+};
+
+} // namespace vulkan
+} // namespace igl
@@ -9,6 +9,9 @@
 
 #include <spirv/unified1/spirv.h>
 
+#include <algorithm>
+#include <type_traits>
+
 #define IGL_COMMON_SKIP_CHECK
 #include <igl/Assert.h>
 #include <igl/Macros.h>
@@ -22,6 +25,12 @@ struct SpirvId {
   uint32_t storageClass = 0;
   uint32_t binding = kNoBindingLocation;
   uint32_t dset = kNoDescriptorSet;
+  uint32_t width = 0; // OpTypeInt/OpTypeFloat: width in bits
+  uint32_t count = 0; // OpTypeVector/OpTypeMatrix: component/column count; OpTypeArray: length id
+  uint32_t value = 0; // OpConstant: the constant value (single-word constants only)
+  uint32_t arrayStride = 0; // OpTypeArray: the ArrayStride decoration, in bytes
+  std::vector<uint32_t> memberTypeIds; // OpTypeStruct: type id of every member
+  std::vector<uint32_t> memberOffsets; // OpTypeStruct: byte offset of every member
   TextureType type = TextureType::Invalid;
 };
 
@@ -54,6 +63,48 @@ TextureType getIGLTextureType(uint32_t dim, bool isArrayed) {
   }
 }
 
+/// @brief Computes the size in bytes of the SPIR-V type `typeId`. Struct sizes are derived from
+/// the explicit Offset decorations, array sizes from the ArrayStride decoration, and matrix
+/// column strides from the column's base alignment. Returns 0 for unsupported types
+uint32_t getTypeSizeBytes(const std::vector<SpirvId>& ids, uint32_t typeId) {
+  if (!IGL_VERIFY(typeId < ids.size())) {
+    return 0;
+  }
+
+  const SpirvId& id = ids[typeId];
+
+  switch (SpvOp(id.opCode)) {
+  case SpvOpTypeInt:
+  case SpvOpTypeFloat:
+    return id.width / 8;
+  case SpvOpTypeVector:
+    return id.count * getTypeSizeBytes(ids, id.typeId);
+  case SpvOpTypeMatrix: {
+    // the column stride is the column's base alignment: 8 bytes for 2-component columns, 16 bytes
+    // for 3- and 4-component columns
+    const uint32_t columnSize = getTypeSizeBytes(ids, id.typeId);
+    return id.count * (columnSize > 8 ? 16 : columnSize);
+  }
+  case SpvOpTypeArray: {
+    const uint32_t stride = id.arrayStride ? id.arrayStride : getTypeSizeBytes(ids, id.typeId);
+    const uint32_t length =
+        id.count < ids.size() && ids[id.count].opCode == SpvOpConstant ? ids[id.count].value : 0;
+    return length * stride;
+  }
+  case SpvOpTypeStruct: {
+    uint32_t size = 0;
+    for (size_t i = 0; i != id.memberTypeIds.size(); i++) {
+      const uint32_t offset = i < id.memberOffsets.size() ? id.memberOffsets[i] : size;
+      const uint32_t memberSize = getTypeSizeBytes(ids, id.memberTypeIds[i]);
+      size = std::max(size, offset + memberSize);
+    }
+    return size;
+  }
+  default:
+    return 0;
+  }
+}
+
 } // namespace
 
 SpvModuleInfo getReflectionData(const uint32_t* spirv, size_t numBytes) {
@@ -121,11 +172,39 @@ SpvModuleInfo getReflectionData(const uint32_t* spirv, size_t numBytes) {
         ids[targetId].dset = words[kOpDecorateOperandIds];
         break;
       }
+      case SpvDecorationArrayStride: {
+        IGL_ASSERT_MSG(words + kOpDecorateOperandIds <= spirv + size, "OpDecorate out of bounds");
+        ids[targetId].arrayStride = words[kOpDecorateOperandIds];
+        break;
+      }
       default:
         break;
       }
       break;
     }
+    case SpvOpMemberDecorate: {
+      constexpr uint32_t kOpMemberDecorateTargetId = 1;
+      constexpr uint32_t kOpMemberDecorateMember = 2;
+      constexpr uint32_t kOpMemberDecorateDecoration = 3;
+      constexpr uint32_t kOpMemberDecorateOperandIds = 4;
+
+      IGL_ASSERT_MSG(words + kOpMemberDecorateDecoration <= spirv + size,
+                     "OpMemberDecorate out of bounds");
+
+      const uint32_t targetId = words[kOpMemberDecorateTargetId];
+      const uint32_t member = words[kOpMemberDecorateMember];
+      IGL_ASSERT(targetId < kBound);
+
+      if (words[kOpMemberDecorateDecoration] == SpvDecorationOffset) {
+        IGL_ASSERT_MSG(words + kOpMemberDecorateOperandIds <= spirv + size,
+                       "OpMemberDecorate out of bounds");
+        if (member >= ids[targetId].memberOffsets.size()) {
+          ids[targetId].memberOffsets.resize(member + 1, 0);
+        }
+        ids[targetId].memberOffsets[member] = words[kOpMemberDecorateOperandIds];
+      }
+      break;
+    }
     case SpvOpTypeStruct:
     case SpvOpTypeImage:
     case SpvOpTypeSampler:
@@ -136,7 +215,11 @@ SpvModuleInfo getReflectionData(const uint32_t* spirv, size_t numBytes) {
       IGL_ASSERT(targetId < kBound);
       IGL_ASSERT(ids[targetId].opCode == 0);
       ids[targetId].opCode = opCode;
-      if (opCode == SpvOpTypeSampledImage) {
+      if (opCode == SpvOpTypeStruct) {
+        constexpr uint32_t kOpTypeStructMemberTypeIds = 2;
+        ids[targetId].memberTypeIds.assign(words + kOpTypeStructMemberTypeIds,
+                                           words + instructionSize);
+      } else if (opCode == SpvOpTypeSampledImage) {
         constexpr uint32_t kOpTypeSampledImageImageTypeId = 2;
         ids[targetId].typeId = words[kOpTypeSampledImageImageTypeId];
       } else if (opCode == SpvOpTypeImage) {
@@ -169,12 +252,56 @@ SpvModuleInfo getReflectionData(const uint32_t* spirv, size_t numBytes) {
     case SpvOpConstant: {
       constexpr uint32_t kOpConstantTypeId = 1;
       constexpr uint32_t kOpConstantTargetId = 2;
+      constexpr uint32_t kOpConstantValue = 3;
       IGL_ASSERT_MSG(words + kOpConstantTargetId <= spirv + size, "OpTypePointer out of bounds");
       const uint32_t targetId = words[kOpConstantTargetId];
       IGL_ASSERT(targetId < kBound);
       IGL_ASSERT(ids[targetId].opCode == 0);
       ids[targetId].opCode = opCode;
       ids[targetId].typeId = words[kOpConstantTypeId];
+      if (instructionSize > kOpConstantValue) {
+        ids[targetId].value = words[kOpConstantValue];
+      }
+      break;
+    }
+    case SpvOpTypeInt:
+    case SpvOpTypeFloat: {
+      constexpr uint32_t kOpTypeScalarResultId = 1;
+      constexpr uint32_t kOpTypeScalarWidth = 2;
+      IGL_ASSERT_MSG(words + kOpTypeScalarWidth <= spirv + size, "OpTypeInt/Float out of bounds");
+      const uint32_t targetId = words[kOpTypeScalarResultId];
+      IGL_ASSERT(targetId < kBound);
+      IGL_ASSERT(ids[targetId].opCode == 0);
+      ids[targetId].opCode = opCode;
+      ids[targetId].width = words[kOpTypeScalarWidth];
+      break;
+    }
+    case SpvOpTypeVector:
+    case SpvOpTypeMatrix: {
+      constexpr uint32_t kOpTypeCompositeResultId = 1;
+      constexpr uint32_t kOpTypeCompositeTypeId = 2;
+      constexpr uint32_t kOpTypeCompositeCount = 3;
+      IGL_ASSERT_MSG(words + kOpTypeCompositeCount <= spirv + size,
+                     "OpTypeVector/Matrix out of bounds");
+      const uint32_t targetId = words[kOpTypeCompositeResultId];
+      IGL_ASSERT(targetId < kBound);
+      IGL_ASSERT(ids[targetId].opCode == 0);
+      ids[targetId].opCode = opCode;
+      ids[targetId].typeId = words[kOpTypeCompositeTypeId];
+      ids[targetId].count = words[kOpTypeCompositeCount];
+      break;
+    }
+    case SpvOpTypeArray: {
+      constexpr uint32_t kOpTypeArrayResultId = 1;
+      constexpr uint32_t kOpTypeArrayTypeId = 2;
+      constexpr uint32_t kOpTypeArrayLengthId = 3;
+      IGL_ASSERT_MSG(words + kOpTypeArrayLengthId <= spirv + size, "OpTypeArray out of bounds");
+      const uint32_t targetId = words[kOpTypeArrayResultId];
+      IGL_ASSERT(targetId < kBound);
+      // the ArrayStride decoration may have been stored already
+      ids[targetId].opCode = opCode;
+      ids[targetId].typeId = words[kOpTypeArrayTypeId];
+      ids[targetId].count = words[kOpTypeArrayLengthId];
       break;
     }
     case SpvOpVariable: {
@@ -210,7 +337,8 @@ SpvModuleInfo getReflectionData(const uint32_t* spirv, size_t numBytes) {
 
       switch (SpvOp(opCode)) {
       case SpvOpTypeStruct:
-        (isStorage ? info.storageBuffers : info.uniformBuffers).push_back({id.binding, id.dset});
+        (isStorage ? info.storageBuffers : info.uniformBuffers)
+            .push_back({id.binding, id.dset, getTypeSizeBytes(ids, ids[id.typeId].typeId)});
         break;
       case SpvOpTypeImage:
         break;
@@ -230,6 +358,10 @@ SpvModuleInfo getReflectionData(const uint32_t* spirv, size_t numBytes) {
     }
     if (id.opCode == SpvOpVariable && id.storageClass == SpvStorageClassPushConstant) {
       info.hasPushConstants = true;
+      IGL_ASSERT(ids[id.typeId].opCode == SpvOpTypePointer);
+      IGL_ASSERT(ids[id.typeId].typeId < kBound);
+      info.pushConstantsSize =
+          std::max(info.pushConstantsSize, getTypeSizeBytes(ids, ids[id.typeId].typeId));
     }
   }
 
@@ -250,6 +382,10 @@ void combineDescriptions(std::vector<T>& out, const std::vector<T>& c1, const st
       out.emplace_back(desc);
     } else {
       IGL_ASSERT(desc.descriptorSet == it->descriptorSet);
+      if constexpr (std::is_same_v<T, BufferDescription>) {
+        // one stage may see the block through a smaller interface; keep the larger size
+        it->size = std::max(it->size, desc.size);
+      }
     }
   }
 }
@@ -264,6 +400,7 @@ SpvModuleInfo mergeReflectionData(const SpvModuleInfo& info1, const SpvModuleInf
   combineDescriptions(result.textures, info1.textures, info2.textures);
 
   result.hasPushConstants = info1.hasPushConstants || info2.hasPushConstants;
+  result.pushConstantsSize = std::max(info1.pushConstantsSize, info2.pushConstantsSize);
 
   return result;
 }
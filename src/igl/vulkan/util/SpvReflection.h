@@ -26,6 +26,9 @@ struct TextureDescription {
 struct BufferDescription {
   uint32_t bindingLocation = kNoBindingLocation;
   uint32_t descriptorSet = kNoDescriptorSet;
+  // size in bytes of the block, computed from the explicit offsets in the SPIR-V type layout;
+  // 0 when the size could not be determined (e.g. the block ends in a runtime array)
+  uint32_t size = 0;
 };
 
 struct SpvModuleInfo {
@@ -33,6 +36,9 @@ struct SpvModuleInfo {
   std::vector<BufferDescription> storageBuffers;
   std::vector<TextureDescription> textures;
   bool hasPushConstants = false;
+  // size in bytes of the push constant block, computed from the explicit offsets in the SPIR-V
+  // type layout; 0 when there is no push constant block or its size could not be determined
+  uint32_t pushConstantsSize = 0;
 };
 
 SpvModuleInfo getReflectionData(const uint32_t* spirv, size_t numBytes);